@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+
+"""
+Convert a compressed ULog file (.ulgz, written by the logger with SDLOG_COMPRESS=1)
+back into a regular ULog file (.ulg) that can be processed with pyulog.
+
+File format:
+    header: 'ULogZp', version (1), algorithm (1 = heatshrink), window bits, lookahead bits
+    frames: uint16 compressed size, uint16 uncompressed size (little-endian),
+            followed by an independent heatshrink stream
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+HEADER_MAGIC = b'ULogZp'
+HEADER_SIZE = 10
+FRAME_HEADER_SIZE = 4
+
+
+def heatshrink_decode(data, window_bits, lookahead_bits):
+    """ decode a single heatshrink stream """
+    out = bytearray()
+    bit_index = 0
+    total_bits = len(data) * 8
+
+    def read_bits(count):
+        nonlocal bit_index
+        if bit_index + count > total_bits:
+            return None
+        value = 0
+        for _ in range(count):
+            byte = data[bit_index >> 3]
+            value = (value << 1) | ((byte >> (7 - (bit_index & 7))) & 1)
+            bit_index += 1
+        return value
+
+    while True:
+        tag = read_bits(1)
+        if tag is None:
+            break
+        if tag:
+            literal = read_bits(8)
+            if literal is None:
+                break
+            out.append(literal)
+        else:
+            index = read_bits(window_bits)
+            if index is None:
+                break
+            count = read_bits(lookahead_bits)
+            if count is None:
+                break
+            offset = index + 1
+            for _ in range(count + 1):
+                # the window is zero-initialized, so back-references can point before the start
+                out.append(out[-offset] if offset <= len(out) else 0)
+    return bytes(out)
+
+
+def decompress(data):
+    if len(data) < HEADER_SIZE or not data.startswith(HEADER_MAGIC):
+        raise ValueError('not a compressed ULog file')
+
+    version, algorithm, window_bits, lookahead_bits = struct.unpack_from('<BBBB', data, len(HEADER_MAGIC))
+
+    if version != 1 or algorithm != 1:
+        raise ValueError('unsupported version ({:}) or algorithm ({:})'.format(version, algorithm))
+
+    out = bytearray()
+    offset = HEADER_SIZE
+
+    while offset + FRAME_HEADER_SIZE <= len(data):
+        compressed_size, uncompressed_size = struct.unpack_from('<HH', data, offset)
+        offset += FRAME_HEADER_SIZE
+
+        if offset + compressed_size > len(data):
+            print('Warning: truncated frame at offset {:}, ignoring the rest of the file'.format(offset),
+                  file=sys.stderr)
+            break
+
+        frame = heatshrink_decode(data[offset:offset + compressed_size], window_bits, lookahead_bits)
+        offset += compressed_size
+
+        if len(frame) != uncompressed_size:
+            print('Warning: corrupt frame at offset {:}, ignoring the rest of the file'.format(offset),
+                  file=sys.stderr)
+            break
+
+        out += frame
+
+    return bytes(out)
+
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser(description="""CLI tool to decompress a .ulgz file into a .ulg file""")
+    parser.add_argument("ulog_file", help="compressed .ulgz file")
+    parser.add_argument("-o", "--output", help="output file (default: input file with .ulg extension)", default=None)
+
+    args = parser.parse_args()
+
+    output = args.output
+    if output is None:
+        output = os.path.splitext(args.ulog_file)[0] + '.ulg'
+
+    with open(args.ulog_file, 'rb') as f:
+        data = f.read()
+
+    try:
+        ulog = decompress(data)
+    except ValueError as e:
+        print('Error: {:}'.format(e))
+        sys.exit(1)
+
+    with open(output, 'wb') as f:
+        f.write(ulog)
+
+    print('Wrote {:} ({:} -> {:} bytes)'.format(output, len(data), len(ulog)))
@@ -3,6 +3,7 @@
 from Crypto.PublicKey import RSA
 from Crypto.Cipher import PKCS1_OAEP
 from Crypto.Cipher import ChaCha20
+from Crypto.Cipher import AES
 from Crypto.Hash import SHA256
 import binascii
 import argparse
@@ -56,7 +57,12 @@ if __name__ == "__main__":
     #print(binascii.hexlify(ulog_key))
 
     # Read and decrypt the .ulgc
-    cipher = ChaCha20.new(key=ulog_key, nonce=nonce)
+    # The algorithm follows from the nonce: 24 bytes for XChaCha20, 12 bytes for AES-CTR
+    # (with a 32 bit block counter starting at 0)
+    if len(nonce) == 12:
+        cipher = AES.new(ulog_key, AES.MODE_CTR, nonce=nonce, initial_value=0)
+    else:
+        cipher = ChaCha20.new(key=ulog_key, nonce=nonce)
     with open(args.ulog_file, 'rb') as f:
         with open(args.ulog_file.rstrip(args.ulog_file[-1]), 'wb') as out:
             out.write(cipher.decrypt(f.read()))
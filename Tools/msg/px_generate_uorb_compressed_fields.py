@@ -74,21 +74,22 @@ def get_ordered_list_by_dependency(name: str, definitions: dict) -> [str]:
     return ret
 
 
-def get_field_definitions(names: [str], definitions: dict) -> (bytes, [str]):
-    """Get byte array with all definitions"""
-    ret = bytes()
+def get_field_definitions(names: [str], definitions: dict) -> ([bytes], [str]):
+    """Get byte array of each definition"""
+    ret = []
     formats_list = []
 
     for name in names:
+        entry = bytes()
         # Format as '<# orb_ids><orb_id0...><# orb_ids dependencies<orb_id_dependency0...><fields><null>'
         assert len(definitions[name]['orb_ids']) < 255
         assert len(definitions[name]['dependencies']) < 255
-        ret += struct.pack('<B', len(definitions[name]['orb_ids']))
+        entry += struct.pack('<B', len(definitions[name]['orb_ids']))
         for orb_id in definitions[name]['orb_ids']:
             assert orb_id < (1 << 16)
-            ret += struct.pack('<H', orb_id)
+            entry += struct.pack('<H', orb_id)
         # Dependencies
-        ret += struct.pack('<B', len(definitions[name]['dependencies']))
+        entry += struct.pack('<B', len(definitions[name]['dependencies']))
         for dependent_message_name in definitions[name]['dependencies']:
             # Get ORB ID by looking up the name in all definitions
             dependent_orb_id_list = [definitions[k]['main_orb_id'] for k in definitions if
@@ -96,17 +97,58 @@ def get_field_definitions(names: [str], definitions: dict) -> (bytes, [str]):
             assert len(dependent_orb_id_list) == 1
             orb_id = dependent_orb_id_list[0]
             assert (1 << 16) > orb_id >= 0
-            ret += struct.pack('<H', orb_id)
+            entry += struct.pack('<H', orb_id)
 
-        ret += bytes(definitions[name]['fields'], 'latin1')
-        ret += b'\0'
+        entry += bytes(definitions[name]['fields'], 'latin1')
+        entry += b'\0'
 
+        ret.append(entry)
         formats_list.append(definitions[name]['fields'])
 
     return ret, formats_list
 
 
-def write_fields_to_cpp_file(file_name: str, compressed_fields: bytes):
+def compress_blocks(field_definitions: [bytes], definitions: dict, names: [str], block_length: int,
+                    window_size: int, lookahead: int) -> ([int], [int], [int]):
+    """
+    Split the definitions into blocks of about block_length bytes, each compressed independently, so that a
+    single format can be found by decompressing only its block.
+    @return concatenated compressed blocks, block offsets (including the end) and block index per orb id
+    """
+    blocks = []
+    current = bytes()
+    orb_id_blocks = {}
+
+    for name, entry in zip(names, field_definitions):
+        if current and len(current) + len(entry) > block_length:
+            blocks.append(current)
+            current = bytes()
+
+        current += entry
+
+        for orb_id in definitions[name]['orb_ids']:
+            orb_id_blocks[orb_id] = len(blocks)
+
+    if current:
+        blocks.append(current)
+
+    compressed = []
+    offsets = [0]
+
+    for block in blocks:
+        compressed.extend(heatshrink_encode.encode(block, window_size, lookahead))
+        offsets.append(len(compressed))
+
+    assert len(blocks) < 255
+    assert len(compressed) < (1 << 16)
+
+    num_orb_ids = max(orb_id_blocks.keys()) + 1 if orb_id_blocks else 0
+    block_index = [orb_id_blocks.get(orb_id, 255) for orb_id in range(num_orb_ids)]
+
+    return compressed, offsets, block_index
+
+
+def write_fields_to_cpp_file(file_name: str, compressed_fields: [int], block_offsets: [int], block_index: [int]):
     fields_str = ', '.join(str(c) for c in compressed_fields)
     with open(file_name, 'w') as file_handle:
         file_handle.write('''
@@ -119,6 +161,16 @@ static const uint8_t compressed_fields[] = {
     {FIELDS}
 };
 
+// start of each independently compressed block, followed by the end of the last one
+static const uint16_t compressed_block_offsets[] = {
+    {BLOCK_OFFSETS}
+};
+
+// block containing the format of each orb id, 255 if none
+static const uint8_t orb_id_block_index[] = {
+    {BLOCK_INDEX}
+};
+
 const uint8_t* orb_compressed_message_formats()
 {
     return compressed_fields;
@@ -128,8 +180,28 @@ unsigned orb_compressed_message_formats_size()
     return sizeof(compressed_fields) / sizeof(compressed_fields[0]);
 }
 
+unsigned orb_compressed_message_formats_num_blocks()
+{
+    return sizeof(compressed_block_offsets) / sizeof(compressed_block_offsets[0]) - 1;
+}
+const uint16_t* orb_compressed_message_formats_block_offsets()
+{
+    return compressed_block_offsets;
+}
+
+int orb_compressed_message_formats_block(orb_id_size_t orb_id)
+{
+    if (orb_id >= sizeof(orb_id_block_index) / sizeof(orb_id_block_index[0]) || orb_id_block_index[orb_id] == 255) {
+        return -1;
+    }
+
+    return orb_id_block_index[orb_id];
+}
+
 } // namespace uORB
-'''.replace('{FIELDS}', fields_str))
+'''.replace('{FIELDS}', fields_str)
+   .replace('{BLOCK_OFFSETS}', ', '.join(str(c) for c in block_offsets))
+   .replace('{BLOCK_INDEX}', ', '.join(str(c) for c in block_index)))
 
 
 def c_encode(s, encoding='ascii'):
@@ -154,6 +226,7 @@ def write_fields_to_hpp_file(file_name: str, definitions: dict, window_length: i
         file_handle.write('''
 // Auto-generated from px4_generate_uorb_compressed_fields.py
 #include <cstdint>
+#include <uORB/uORB.h>
 
 namespace uORB {
 
@@ -167,6 +240,23 @@ const uint8_t* orb_compressed_message_formats();
  */
 unsigned orb_compressed_message_formats_size();
 
+/**
+ * The formats are split into blocks that are compressed independently (the decoder is reset at the start of
+ * each block), so that a single format can be read by decompressing only its block.
+ */
+unsigned orb_compressed_message_formats_num_blocks();
+
+/**
+ * Get the offset of each block into the compressed formats, followed by the total size (num_blocks + 1 entries)
+ */
+const uint16_t* orb_compressed_message_formats_block_offsets();
+
+/**
+ * Get the block containing the format of an orb id
+ * @return block index, -1 if there is no format for the orb id
+ */
+int orb_compressed_message_formats_block(orb_id_size_t orb_id);
+
 static constexpr unsigned orb_tokenized_fields_max_length = {MAX_TOKENIZED_FIELD_LENGTH}; // {MAX_TOKENIZED_FIELD_LENGTH_MSG}
 static constexpr unsigned orb_untokenized_fields_max_length = {MAX_UNTOKENIZED_FIELD_LENGTH};
 static constexpr unsigned orb_compressed_max_num_orb_ids = {MAX_NUM_ORB_IDS};
@@ -220,14 +310,17 @@ def main():
         # Compress
         window_size = 8  # Larger value = better compression; memory requirement (for decompression): 2 ^ window_size
         lookahead = 4
-        compressed_field_definitions = heatshrink_encode.encode(field_definitions, window_size, lookahead)
+        block_length = 2048  # Uncompressed size of a block; smaller value = faster lookup of a single format
+        compressed_field_definitions, block_offsets, block_index = compress_blocks(
+            field_definitions, definitions, names, block_length, window_size, lookahead)
 
         if args.verbose:
+            total_length = sum(len(entry) for entry in field_definitions)
             print(
-                f'Field definitions: size: {len(field_definitions)}, reduction from compression: {len(field_definitions) - len(compressed_field_definitions)}')
+                f'Field definitions: size: {total_length}, reduction from compression: {total_length - len(compressed_field_definitions)}, blocks: {len(block_offsets) - 1}')
 
         # Write cpp & hpp file
-        write_fields_to_cpp_file(args.output_cpp, compressed_field_definitions)
+        write_fields_to_cpp_file(args.output_cpp, compressed_field_definitions, block_offsets, block_index)
         write_fields_to_hpp_file(args.output_hpp, definitions, window_size, lookahead, format_list)
 
 
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+#############################################################################
+#
+#   Copyright (C) 2023 PX4 Pro Development Team. All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+# 3. Neither the name PX4 nor the names of its contributors may be
+#    used to endorse or promote products derived from this software
+#    without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+# OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+# AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+#############################################################################
+
+"""
+Generates the cpp source with the preallocated uORB topic buffers from a
+topic manifest (list of topics and number of instances)
+"""
+
+import argparse
+import os
+import re
+import sys
+
+TOPICS_TOKEN = '# TOPICS '
+QUEUE_LENGTH_PATTERN = re.compile(r'^\s*uint8\s+ORB_QUEUE_LENGTH\s*=\s*(\d+)')
+
+
+def snake_case(name: str) -> str:
+    """PascalCase (file name) to snake_case (topic name)"""
+    return re.sub(r'(?<!^)(?=[A-Z])', '_', name).lower()
+
+
+def parse_msg_files(msg_files: [str]) -> dict:
+    """Map each topic name to (message name, queue length)"""
+    topics = {}
+    for msg_file in msg_files:
+        msg_name = snake_case(os.path.basename(msg_file).replace('.msg', ''))
+        msg_topics = []
+        queue_length = 1
+        with open(msg_file, encoding='utf-8') as file_handle:
+            for line in file_handle:
+                if line.startswith(TOPICS_TOKEN):
+                    msg_topics.extend(snake_case(t) for t in line.replace(TOPICS_TOKEN, '').split())
+                match = QUEUE_LENGTH_PATTERN.match(line)
+                if match:
+                    queue_length = int(match.group(1))
+
+        if len(msg_topics) == 0:
+            msg_topics.append(msg_name)
+
+        for topic in msg_topics:
+            topics[topic] = (msg_name, queue_length)
+
+    return topics
+
+
+def parse_manifest(manifest_file: str) -> [(str, int)]:
+    """Read '<topic> [<instances>]' lines, '#' starts a comment"""
+    entries = []
+    with open(manifest_file, encoding='utf-8') as file_handle:
+        for line_number, line in enumerate(file_handle, 1):
+            line = line.split('#')[0].split()
+            if len(line) == 0:
+                continue
+            instances = int(line[1]) if len(line) > 1 else 1
+            if len(line) > 2 or not 1 <= instances <= 10:
+                sys.exit('{}:{}: invalid entry'.format(manifest_file, line_number))
+            entries.append((line[0], instances))
+    return entries
+
+
+def write_cpp_file(file_name: str, entries: [(str, int)], topics: dict):
+    msg_names = sorted(set(topics[topic][0] for topic, _ in entries))
+    includes = ''.join('#include <uORB/topics/{}.h>\n'.format(msg) for msg in msg_names)
+    list_entries = ''.join(
+        '\t{{ORB_ID::{}, {}, buffer_size(sizeof({}_s) * {})}},\n'.format(
+            topic, instances, topics[topic][0], topics[topic][1])
+        for topic, instances in entries)
+    region_size = ' + '.join(
+        '{} * buffer_size(sizeof({}_s) * {})'.format(instances, topics[topic][0], topics[topic][1])
+        for topic, instances in entries) or '0'
+
+    with open(file_name, 'w') as file_handle:
+        file_handle.write('''
+// Auto-generated from px_generate_uorb_prealloc.py
+#include <uORB/uORBPrealloc.hpp>
+
+{INCLUDES}
+namespace uORB
+{{
+namespace Prealloc
+{{
+
+static constexpr uint32_t buffer_size(size_t size) {{ return (size + (ALIGNMENT - 1)) & ~(ALIGNMENT - 1); }}
+
+const Entry entries[] = {{
+{ENTRIES}	{{ORB_ID::INVALID, 0, 0}}
+}};
+
+static constexpr size_t REGION_SIZE = {REGION_SIZE};
+
+alignas(ALIGNMENT) uint8_t region[REGION_SIZE > 0 ? REGION_SIZE : 1];
+const size_t region_size = REGION_SIZE;
+
+}} // namespace Prealloc
+}} // namespace uORB
+'''.format(INCLUDES=includes, ENTRIES=list_entries, REGION_SIZE=region_size))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Generate the preallocated uORB topic buffers')
+    parser.add_argument('-f', dest='msg_files', help='msg files', nargs='+', required=True)
+    parser.add_argument('-m', dest='manifest', help='topic manifest', required=True)
+    parser.add_argument('-o', dest='output_file', help='output cpp file', required=True)
+    args = parser.parse_args()
+
+    topics = parse_msg_files(args.msg_files)
+    entries = parse_manifest(args.manifest)
+
+    seen = set()
+    for topic, _ in entries:
+        if topic not in topics:
+            sys.exit('{}: unknown topic {}'.format(args.manifest, topic))
+        if topic in seen:
+            sys.exit('{}: duplicate topic {}'.format(args.manifest, topic))
+        seen.add(topic)
+
+    write_cpp_file(args.output_file, entries, topics)
@@ -52,8 +52,22 @@ from px_generate_uorb_topic_helper import * # this is in Tools/
 topic = name_snake_case
 uorb_struct = '%s_s'%name_snake_case
 
+# get the offsets of the top-level fields in the uORB struct (same layout as the uorb/msg.h.em template)
+def get_uorb_offsets(msg_fields):
+	sorted_fields = sorted(msg_fields, key=sizeof_field_type, reverse=True)
+	add_padding_bytes(sorted_fields, search_path)
+	offsets = {}
+	offset = 0
+	for field in sorted_fields:
+		if not field.is_header:
+			array_size = field.array_len if field.is_array else 1
+			offsets[field.name] = offset
+			offset += field.sizeof_field_type * array_size
+	return offsets
+
 # get fields, struct size and paddings
-def add_fields(msg_fields, name_prefix='', offset=0):
+# uorb_offsets: offsets in the uORB struct of top-level fields, None for fields of nested types
+def add_fields(msg_fields, name_prefix='', offset=0, uorb_offsets=None):
 	fields = []
 	for field in msg_fields:
 		if not field.is_header:
@@ -90,11 +104,49 @@ def add_fields(msg_fields, name_prefix='', offset=0):
 				# note: the maximum alignment for XCDR is 8 and for XCDR2 it is 4
 				padding = (field_size - (offset % field_size)) & (field_size - 1)
 
-				fields.append((type_name, name_prefix+field.name, field_size * array_size, padding))
+				uorb_offset = uorb_offsets[field.name] if uorb_offsets is not None else None
+				fields.append((type_name, name_prefix+field.name, field_size * array_size, padding, uorb_offset))
 				offset += array_size * field_size + padding
 	return fields, offset
 
-fields, struct_size = add_fields(spec.parsed_fields())
+fields, struct_size = add_fields(spec.parsed_fields(), uorb_offsets=get_uorb_offsets(spec.parsed_fields()))
+
+# merge consecutive fields that are contiguous in both CDR (no padding) and the uORB struct into
+# a single memcpy, timestamps are kept separate because they get adjusted by the time offset
+def is_timestamp(field_type, field_name):
+	return field_type == 'uint64' and (field_name == 'timestamp' or field_name == 'timestamp_sample')
+
+copy_regions = []
+for field_type, field_name, field_size, padding, uorb_offset in fields:
+	mergeable = uorb_offset is not None and not is_timestamp(field_type, field_name)
+	last = copy_regions[-1] if copy_regions else None
+	if mergeable and padding == 0 and last is not None and last['mergeable'] and last['uorb_end'] == uorb_offset:
+		last['fields'].append((field_name, field_size))
+		last['size'] += field_size
+		last['uorb_end'] += field_size
+	else:
+		copy_regions.append({'type': field_type, 'fields': [(field_name, field_size)], 'size': field_size,
+			'padding': padding, 'mergeable': mergeable,
+			'uorb_end': uorb_offset + field_size if uorb_offset is not None else None})
+
+def print_padding(padding):
+	if padding > 0:
+		print('\tbuf.iterator += {:}; // padding'.format(padding))
+		print('\tbuf.offset += {:}; // padding'.format(padding))
+
+def print_region_asserts(region):
+	for field_name, field_size in region['fields']:
+		print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
+	first = region['fields'][0][0]
+	region_offset = region['fields'][0][1]
+	for field_name, field_size in region['fields'][1:]:
+		print('\tstatic_assert(offsetof({0}, {1}) == offsetof({0}, {2}) + {3}, "layout mismatch");'.format(
+			uorb_struct, field_name, first, region_offset))
+		region_offset += field_size
+
+def print_advance(size_expr):
+	print('\tbuf.iterator += {:};'.format(size_expr))
+	print('\tbuf.offset += {:};'.format(size_expr))
 
 }@
 
@@ -103,6 +155,7 @@ fields, struct_size = add_fields(spec.parsed_fields())
 #pragma once
 
 #include <ucdr/microcdr.h>
+#include <stddef.h>
 #include <string.h>
 #include <uORB/topics/@(topic).h>
 
@@ -128,26 +181,28 @@ static inline bool ucdr_serialize_@(topic)(const void* data, ucdrBuffer& buf, in
 {
 	const @(uorb_struct)& topic = *static_cast<const @(uorb_struct)*>(data);
 @{
-for field_type, field_name, field_size, padding in fields:
-	if padding > 0:
-		print('\tbuf.iterator += {:}; // padding'.format(padding))
-		print('\tbuf.offset += {:}; // padding'.format(padding))
+for region in copy_regions:
+	print_padding(region['padding'])
+	print_region_asserts(region)
+	field_name = region['fields'][0][0]
 
-	print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
+	if len(region['fields']) > 1:
+		print('\tmemcpy(buf.iterator, &topic.{0}, {1});'.format(field_name, region['size']))
+		print_advance(region['size'])
+		continue
 
-	if field_type == 'uint64' and field_name == 'timestamp':
+	if region['type'] == 'uint64' and field_name == 'timestamp':
 		print('\tconst uint64_t timestamp_adjusted = topic.timestamp + time_offset;')
 		print('\tmemcpy(buf.iterator, &timestamp_adjusted, sizeof(topic.{0}));'.format(field_name))
 
-	elif field_type == 'uint64' and field_name == 'timestamp_sample':
+	elif region['type'] == 'uint64' and field_name == 'timestamp_sample':
 		print('\tconst uint64_t timestamp_sample_adjusted = topic.timestamp_sample + time_offset;')
 		print('\tmemcpy(buf.iterator, &timestamp_sample_adjusted, sizeof(topic.{0}));'.format(field_name))
 
 	else:
 		print('\tmemcpy(buf.iterator, &topic.{0}, sizeof(topic.{0}));'.format(field_name))
 
-	print('\tbuf.iterator += sizeof(topic.{:});'.format(field_name))
-	print('\tbuf.offset += sizeof(topic.{:});'.format(field_name))
+	print_advance('sizeof(topic.{:})'.format(field_name))
 
 }@
 	return true;
@@ -156,20 +211,23 @@ for field_type, field_name, field_size, padding in fields:
 static inline bool ucdr_deserialize_@(topic)(ucdrBuffer& buf, @(uorb_struct)& topic, int64_t time_offset = 0)
 {
 @{
-for field_type, field_name, field_size, padding in fields:
-	if padding > 0:
-		print('\tbuf.iterator += {:}; // padding'.format(padding))
-		print('\tbuf.offset += {:}; // padding'.format(padding))
+for region in copy_regions:
+	print_padding(region['padding'])
+	print_region_asserts(region)
+	field_name = region['fields'][0][0]
+
+	if len(region['fields']) > 1:
+		print('\tmemcpy(&topic.{0}, buf.iterator, {1});'.format(field_name, region['size']))
+		print_advance(region['size'])
+		continue
 
-	print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
 	print('\tmemcpy(&topic.{0}, buf.iterator, sizeof(topic.{0}));'.format(field_name))
 
-	if field_type == 'uint64' and (field_name == 'timestamp' or field_name == 'timestamp_sample'):
+	if is_timestamp(region['type'], field_name):
 		print('\tif (topic.{0} == 0) topic.{0} = hrt_absolute_time();'.format(field_name, field_name))
 		print('\telse topic.{0} = math::min(topic.{0} - time_offset, hrt_absolute_time());'.format(field_name, field_name))
 
-	print('\tbuf.iterator += sizeof(topic.{:});'.format(field_name))
-	print('\tbuf.offset += sizeof(topic.{:});'.format(field_name))
+	print_advance('sizeof(topic.{:})'.format(field_name))
 
 }@
 	return true;
@@ -0,0 +1,260 @@
+#!/usr/bin/env python3
+
+"""
+Per-module flash and RAM footprint of a firmware build from the GNU ld map file.
+
+Every input section of the final link is attributed to the module (source
+directory) of the object or library it comes from, and accounted as text
+(code and constants in flash), data (initialized RAM, also stored in flash)
+or bss (zero-initialized RAM). Modules are grouped by src/modules,
+src/drivers, src/lib, platforms, NuttX and toolchain.
+
+The JSON output contains the totals, groups, modules and the symbols
+(input sections, one per function/variable with -ffunction-sections and
+-fdata-sections) of every module. Given a baseline JSON from another build,
+the differences are printed and added to the output.
+
+Usage:
+    size_report.py --map px4_fmu-v6c_default.map [--json size.json] [--compare baseline.json]
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+# output sections that are not loaded to the target
+IGNORED_SECTIONS = ('.debug', '.comment', '.ARM.attributes', '.stab', '.note', '.gnu.attributes')
+DATA_SECTIONS = ('.data', '.ramfunc', '.ramtext', '.fastcode')
+BSS_SECTIONS = ('.bss', '.noinit', '.heap', '.stack', 'COMMON')
+
+# group module paths by these prefixes (first match)
+GROUPS = ('src/modules', 'src/drivers', 'src/lib', 'src/systemcmds', 'src/examples',
+          'platforms', 'boards', 'msg', 'NuttX')
+
+OUTPUT_SECTION_PATTERN = re.compile(r'^(\.?[\w.]+)\s*(?:0x[0-9a-fA-F]+\s+0x[0-9a-fA-F]+)?')
+INPUT_SECTION_PATTERN = re.compile(r'^ (\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(.+)$')
+INPUT_SECTION_NAME_PATTERN = re.compile(r'^ (\S+)$')
+INPUT_SECTION_CONTINUATION_PATTERN = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(.+)$')
+
+
+def section_type(output_section):
+    """ classify an output section as text, data, bss or None (not loaded) """
+    if output_section.startswith(IGNORED_SECTIONS):
+        return None
+    if output_section.startswith(BSS_SECTIONS):
+        return 'bss'
+    if output_section.startswith(DATA_SECTIONS):
+        return 'data'
+    return 'text'
+
+
+def module_of(object_file, build_dir):
+    """ module (source directory) and group of an object file or archive member """
+    archive = object_file.split('(')[0]
+
+    if build_dir and os.path.isabs(archive) and archive.startswith(build_dir):
+        archive = os.path.relpath(archive, build_dir)
+
+    if os.path.isabs(archive):
+        # compiler runtime and C library
+        return os.path.basename(archive), 'toolchain'
+
+    module = os.path.dirname(archive)
+
+    # objects of executables are in <dir>/CMakeFiles/<target>.dir/...
+    if '/CMakeFiles/' in '/' + module + '/':
+        module = ('/' + module).split('/CMakeFiles/')[0].lstrip('/')
+
+    module = module or archive
+
+    for group in GROUPS:
+        if module == group or module.startswith(group + '/'):
+            return module, group
+
+    return module, 'other'
+
+
+def symbol_of(input_section, object_file):
+    """ symbol name of a function/data section, otherwise section and object """
+    for prefix in ('.text.', '.rodata.', '.data.', '.bss.', '.ramfunc.', '.noinit.'):
+        if input_section.startswith(prefix) and not input_section.startswith('.rodata.str'):
+            return input_section[len(prefix):]
+
+    member = object_file.split('(')[-1].rstrip(')')
+    return '{} ({})'.format(input_section, os.path.basename(member))
+
+
+def parse_map(map_file, build_dir):
+    """ collect the input section sizes per module from a GNU ld map file """
+    modules = {}
+
+    def add(output_section, input_section, size, object_file):
+        kind = section_type(output_section)
+        if kind is None or size == 0 or input_section.startswith('*'):
+            return
+
+        name, group = module_of(object_file.strip(), build_dir)
+        module = modules.setdefault(name, {'group': group, 'text': 0, 'data': 0, 'bss': 0, 'symbols': {}})
+        module[kind] += size
+
+        symbol = module['symbols'].setdefault(symbol_of(input_section, object_file), {'text': 0, 'data': 0, 'bss': 0})
+        symbol[kind] += size
+
+    with open(map_file, encoding='utf-8', errors='replace') as file_handle:
+        in_memory_map = False
+        output_section = None
+        pending_input_section = None
+
+        for line in file_handle:
+            line = line.rstrip('\n')
+
+            if not in_memory_map:
+                # skip the discarded input sections and memory configuration
+                in_memory_map = line.startswith('Linker script and memory map')
+                continue
+
+            if pending_input_section is not None:
+                # long section names continue with address, size and object on the next line
+                match = INPUT_SECTION_CONTINUATION_PATTERN.match(line)
+                if match:
+                    add(output_section, pending_input_section, int(match.group(2), 16), match.group(3))
+                pending_input_section = None
+                continue
+
+            if line and not line[0].isspace():
+                match = OUTPUT_SECTION_PATTERN.match(line)
+                output_section = match.group(1) if match else None
+                continue
+
+            if output_section is None:
+                continue
+
+            match = INPUT_SECTION_PATTERN.match(line)
+            if match:
+                add(output_section, match.group(1), int(match.group(3), 16), match.group(4))
+                continue
+
+            match = INPUT_SECTION_NAME_PATTERN.match(line)
+            if match:
+                pending_input_section = match.group(1)
+
+    return modules
+
+
+def summarize(modules):
+    """ totals and per group sums; flash = text + data, ram = data + bss """
+    def sizes(text, data, bss):
+        return {'text': text, 'data': data, 'bss': bss, 'flash': text + data, 'ram': data + bss}
+
+    groups = {}
+    for module in modules.values():
+        group = groups.setdefault(module['group'], [0, 0, 0])
+        group[0] += module['text']
+        group[1] += module['data']
+        group[2] += module['bss']
+
+    for name, module in modules.items():
+        module.update(sizes(module['text'], module['data'], module['bss']))
+
+    total = [sum(g[i] for g in groups.values()) for i in range(3)]
+
+    return sizes(*total), {name: sizes(*group) for name, group in groups.items()}
+
+
+def compare(current, baseline):
+    """ differences in flash/ram per group, module and symbol, with the largest changes first """
+    def delta(new, old):
+        return {key: new.get(key, 0) - old.get(key, 0) for key in ('text', 'data', 'bss', 'flash', 'ram')}
+
+    def changed(entries):
+        return {name: d for name, d in entries.items() if any(d.values())}
+
+    groups = changed({name: delta(current['groups'].get(name, {}), baseline['groups'].get(name, {}))
+                      for name in set(current['groups']) | set(baseline['groups'])})
+
+    modules = {}
+    symbols = {}
+    for name in set(current['modules']) | set(baseline['modules']):
+        new = current['modules'].get(name, {})
+        old = baseline['modules'].get(name, {})
+        modules[name] = delta(new, old)
+
+        new_symbols = new.get('symbols', {})
+        old_symbols = old.get('symbols', {})
+        for symbol in set(new_symbols) | set(old_symbols):
+            new_sizes = new_symbols.get(symbol, {})
+            old_sizes = old_symbols.get(symbol, {})
+            d = {key: new_sizes.get(key, 0) - old_sizes.get(key, 0) for key in ('text', 'data', 'bss')}
+            if any(d.values()):
+                symbols[name + ':' + symbol] = d
+
+    return {'total': delta(current['total'], baseline['total']), 'groups': groups,
+            'modules': changed(modules), 'symbols': symbols}
+
+
+def print_table(title, entries, count):
+    print('\n{:<56} {:>9} {:>9} {:>9} {:>9} {:>9}'.format(title, 'TEXT', 'DATA', 'BSS', 'FLASH', 'RAM'))
+    for name, sizes in entries[:count]:
+        print('{:<56} {:>9} {:>9} {:>9} {:>9} {:>9}'.format(
+            name[-56:], sizes['text'], sizes['data'], sizes['bss'], sizes['flash'], sizes['ram']))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Per-module flash and RAM footprint from a linker map file')
+    parser.add_argument('--map', required=True, help='GNU ld map file of the firmware (-Wl,-Map)')
+    parser.add_argument('--board', default='', help='board target name stored in the report')
+    parser.add_argument('--build-dir', default=None,
+                        help='build directory, to make absolute object paths relative (default: map file directory)')
+    parser.add_argument('--json', default=None, help='write the report as JSON')
+    parser.add_argument('--compare', default=None, help='baseline JSON report of another build')
+    parser.add_argument('-n', '--count', type=int, default=30, help='number of modules/symbols to print')
+    args = parser.parse_args()
+
+    build_dir = os.path.abspath(args.build_dir or os.path.dirname(os.path.abspath(args.map)))
+    modules = parse_map(args.map, build_dir)
+
+    if len(modules) == 0:
+        print('no input sections found in {}'.format(args.map))
+        return 1
+
+    total, groups = summarize(modules)
+    report = {'board': args.board, 'total': total, 'groups': groups, 'modules': modules}
+
+    print_table('GROUP', sorted(groups.items(), key=lambda g: -g[1]['flash']), len(groups))
+    print_table('MODULE', sorted(modules.items(), key=lambda m: -m[1]['flash']), args.count)
+    print_table('TOTAL', [('', total)], 1)
+
+    if args.compare:
+        if os.path.exists(args.compare):
+            with open(args.compare, encoding='utf-8') as file_handle:
+                baseline = json.load(file_handle)
+
+            diff = compare(report, baseline)
+            report['compare'] = dict(diff, baseline=baseline.get('board', args.compare))
+
+            by_change = lambda e: -(abs(e[1]['flash']) + abs(e[1]['ram']))
+            print('\n=== compared to {} ==='.format(args.compare))
+            print_table('GROUP', sorted(diff['groups'].items(), key=by_change), len(diff['groups']))
+            print_table('MODULE', sorted(diff['modules'].items(), key=by_change), args.count)
+            print_table('TOTAL', [('', diff['total'])], 1)
+
+            print('\n{:<74} {:>9} {:>9} {:>9}'.format('SYMBOL', 'TEXT', 'DATA', 'BSS'))
+            for name, d in sorted(diff['symbols'].items(),
+                                  key=lambda e: -(abs(e[1]['text']) + abs(e[1]['data']) + abs(e[1]['bss'])))[:args.count]:
+                print('{:<74} {:>9} {:>9} {:>9}'.format(name[-74:], d['text'], d['data'], d['bss']))
+
+        else:
+            print('\nbaseline {} not found, no comparison'.format(args.compare))
+
+    if args.json:
+        with open(args.json, 'w', encoding='utf-8') as file_handle:
+            json.dump(report, file_handle, indent=1, sort_keys=True)
+        print('\nWritten to {}'.format(args.json))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+
+"""
+Recommend work queue stack sizes (wq_config_t in WorkQueueManager.hpp) from
+the stack high-water marks in one or more ULog files.
+
+load_mon publishes task_stack_info for every task (including the work queue
+threads) when SYS_STCK_EN is set. The stack usage of a task is its stack size
+minus the lowest free stack seen in any of the logs. Logs should cover all
+flight modes and configurations the stack sizes are meant for.
+
+Usage:
+    stack_size_report.py [--margin 0.25] [--min-margin 256] log1.ulg [log2.ulg ...]
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+try:
+    from pyulog import ULog
+except ImportError:
+    print("Failed to import pyulog, install it with: pip3 install --user pyulog")
+    sys.exit(1)
+
+WQ_CONFIG_PATTERN = re.compile(
+    r'static constexpr wq_config_t (\w+)\{"(wq:[^"]+)", (\d+), ([^}]+)\};')
+
+WORK_QUEUE_MANAGER_HPP = os.path.join(
+    os.path.dirname(os.path.realpath(__file__)), '..', '..', 'platforms', 'common', 'include',
+    'px4_platform_common', 'px4_work_queue', 'WorkQueueManager.hpp')
+
+
+def read_wq_configs(header_file):
+    """ map work queue thread name -> (variable name, stack size, remaining arguments) """
+    configs = {}
+    with open(header_file, encoding='utf-8') as file_handle:
+        for match in WQ_CONFIG_PATTERN.finditer(file_handle.read()):
+            configs[match.group(2)] = (match.group(1), int(match.group(3)), match.group(4))
+    return configs
+
+
+def read_stack_usage(log_files):
+    """ map task name -> (stack size, lowest free stack) over all logs """
+    tasks = {}
+    for log_file in log_files:
+        ulog = ULog(log_file, ['task_stack_info'])
+        for data in ulog.data_list:
+            if 'stack_free' not in data.data:
+                continue
+            for i in range(len(data.data['timestamp'])):
+                name = ''
+                for c in range(24):
+                    field = 'task_name[{}]'.format(c)
+                    if field not in data.data or data.data[field][i] == 0:
+                        break
+                    name += chr(data.data[field][i])
+                stack_free = int(data.data['stack_free'][i])
+                stack_size = int(data.data['stack_size'][i]) if 'stack_size' in data.data else 0
+                size, free = tasks.get(name, (stack_size, stack_free))
+                tasks[name] = (max(size, stack_size), min(free, stack_free))
+    return tasks
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Recommend work queue stack sizes from logged stack usage')
+    parser.add_argument('--margin', type=float, default=0.25,
+                        help='relative margin on top of the measured usage (default 0.25)')
+    parser.add_argument('--min-margin', type=int, default=256,
+                        help='minimum margin in bytes (default 256)')
+    parser.add_argument('--header', default=WORK_QUEUE_MANAGER_HPP,
+                        help='WorkQueueManager.hpp with the current wq_config_t definitions')
+    parser.add_argument('logs', nargs='+', help='ULog files')
+    args = parser.parse_args()
+
+    configs = read_wq_configs(args.header)
+    tasks = read_stack_usage(args.logs)
+
+    if len(tasks) == 0:
+        print('no task_stack_info in the logs (enable SYS_STCK_EN)')
+        return 1
+
+    print('{:<24} {:>6} {:>6} {:>6}'.format('TASK', 'SIZE', 'USED', 'FREE'))
+    for name in sorted(tasks):
+        size, free = tasks[name]
+        print('{:<24} {:>6} {:>6} {:>6}'.format(name, size if size > 0 else '-',
+                                                size - free if size > 0 else '-', free))
+
+    print('\n// recommended work queue stack sizes')
+    for name in sorted(tasks, key=lambda n: configs[n][0] if n in configs else n):
+        if name not in configs:
+            continue
+        variable, configured, remaining = configs[name]
+        size, free = tasks[name]
+        # the logged size is PX4_STACK_ADJUSTED(configured), the difference is platform overhead
+        used = size - free if size > 0 else configured - free
+        overhead = size - configured if size > configured else 0
+        recommended = used + max(int(math.ceil(used * args.margin)), args.min_margin) - overhead
+        recommended = int(math.ceil(recommended / 8.0)) * 8
+        print('static constexpr wq_config_t {}{{"{}", {}, {}}}; // currently {}, used {}'.format(
+            variable, name, recommended, remaining, configured, used))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,279 @@
+#!/usr/bin/env python3
+
+"""
+Convert a ULog file with delta encoded data messages (written by the logger with
+SDLOG_DELTA_KF > 0) into a regular ULog file that can be processed with pyulog.
+
+Delta message ('d'): uint16 msg_id, uint64 timestamp, a bit mask with one bit per
+4 byte block of the payload after the timestamp (LSB first), followed by the
+changed blocks. The other blocks are the same as in the previous data message
+with the same msg_id.
+
+FIFO message ('f', sensor_gyro_fifo and sensor_accel_fifo): uint16 msg_id,
+uint64 timestamp, uint8 flags, [uint32 device_id, float dt, float scale],
+varint timestamp - timestamp_sample, uint8 samples, then the x, y and z samples
+as varint differences to the previous sample of the axis (see
+ulog_message_data_fifo_s in src/modules/logger/messages.h).
+
+The file offsets in the flag bits and the appended index are updated as well.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+FILE_HEADER_SIZE = 16
+MSG_HEADER_SIZE = 3
+BLOCK_SIZE = 4
+INCOMPAT_FLAG0_DATA_DELTA_MASK = 1 << 1
+FIFO_FLAG_PARAMS = 1 << 0
+FIFO_FLAG_RESET = 1 << 1
+
+TYPE_FORMATS = {
+    'int8_t': 'b', 'uint8_t': 'B', 'bool': '?', 'char': 'c',
+    'int16_t': 'h', 'uint16_t': 'H', 'int32_t': 'i', 'uint32_t': 'I',
+    'int64_t': 'q', 'uint64_t': 'Q', 'float': 'f', 'double': 'd',
+}
+
+
+def parse_format(format_str):
+    """ field layout of a format message: {name: (offset, struct format, array length)}, payload size """
+    fields = {}
+    offset = 0
+    size = 0
+    for field in format_str.split(':', 1)[1].split(';'):
+        if not field:
+            continue
+        field_type, name = field.split(' ')
+        count = 1
+        if '[' in field_type:
+            field_type, count = field_type[:-1].split('[')
+            count = int(count)
+        if field_type not in TYPE_FORMATS:
+            return None, 0  # nested types are not needed for the FIFO topics
+        fields[name] = (offset, '<' + TYPE_FORMATS[field_type], count)
+        offset += struct.calcsize('<' + TYPE_FORMATS[field_type]) * count
+        if not name.startswith('_padding'):
+            size = offset
+    return fields, size
+
+
+def read_varint(data, offset):
+    """ read a zigzag varint, returns (value, new offset) """
+    value = 0
+    shift = 0
+    while True:
+        byte = data[offset]
+        offset += 1
+        value |= (byte & 0x7f) << shift
+        shift += 7
+        if not byte & 0x80:
+            break
+    return (value >> 1) ^ -(value & 1), offset
+
+
+def decode_fifo(body, last, layout):
+    """ decode a FIFO message body (without msg_id), last is the previous payload (or None) """
+    fields, size = layout
+    flags = body[8]
+    reset = flags & FIFO_FLAG_RESET
+
+    if not reset and last is None:
+        raise ValueError('FIFO message without reference')
+
+    def get(name, index=0):
+        offset, fmt, _ = fields[name]
+        return struct.unpack_from(fmt, last, offset + index * struct.calcsize(fmt))[0]
+
+    def put(name, value, index=0):
+        offset, fmt, _ = fields[name]
+        struct.pack_into(fmt, data, offset + index * struct.calcsize(fmt), value)
+
+    data = bytearray(size) if reset else bytearray(last)
+    data[0:8] = body[0:8]
+    timestamp, = struct.unpack_from('<Q', body, 0)
+    offset = 9
+
+    if flags & FIFO_FLAG_PARAMS:
+        device_id, dt, scale = struct.unpack_from('<Iff', body, offset)
+        put('device_id', device_id)
+        put('dt', dt)
+        put('scale', scale)
+        offset += 12
+
+    timestamp_offset, offset = read_varint(body, offset)
+    put('timestamp_sample', timestamp - timestamp_offset)
+    samples = body[offset]
+    offset += 1
+    put('samples', samples)
+
+    for axis in ('x', 'y', 'z'):
+        last_samples = 0 if reset else get('samples')
+        previous = get(axis, last_samples - 1) if last_samples > 0 else 0
+        for i in range(fields[axis][2]):
+            if i < samples:
+                delta, offset = read_varint(body, offset)
+                previous += delta
+                put(axis, previous, i)
+            else:
+                put(axis, 0, i)
+
+    if offset != len(body):
+        raise ValueError('FIFO message size mismatch')
+
+    return bytes(data)
+
+
+def decode_delta(body, last):
+    """ apply a delta message body (without msg_id) to the last payload """
+    data = bytearray(last)
+    data[0:8] = body[0:8]
+    data_size = len(last) - 8
+    num_blocks = (data_size + BLOCK_SIZE - 1) // BLOCK_SIZE
+    mask_size = (num_blocks + 7) // 8
+    mask = body[8:8 + mask_size]
+    offset = 8 + mask_size
+
+    for block in range(num_blocks):
+        if mask[block // 8] & (1 << (block % 8)):
+            start = 8 + block * BLOCK_SIZE
+            length = min(BLOCK_SIZE, len(last) - start)
+            data[start:start + length] = body[offset:offset + length]
+            offset += length
+
+    if offset != len(body):
+        raise ValueError('delta size mismatch')
+
+    return bytes(data)
+
+
+def decode(data):
+    if len(data) < FILE_HEADER_SIZE or not data.startswith(b'ULog'):
+        raise ValueError('not a ULog file')
+
+    out = bytearray(data[:FILE_HEADER_SIZE])
+    offset = FILE_HEADER_SIZE
+    offset_map = {}  # input file offset of a message -> output file offset
+    last_data = {}  # msg_id -> last payload
+    flag_bits_offset = None
+    index_offsets = []  # output offsets of index entries to remap
+    layouts = {}  # message name -> layout
+    msg_names = {}  # msg_id -> message name
+    num_deltas = 0
+
+    while offset + MSG_HEADER_SIZE <= len(data):
+        msg_size, msg_type = struct.unpack_from('<HB', data, offset)
+        end = offset + MSG_HEADER_SIZE + msg_size
+
+        if end > len(data):
+            print('Warning: truncated message at offset {:}, ignoring the rest of the file'.format(offset),
+                  file=sys.stderr)
+            break
+
+        offset_map[offset] = len(out)
+        body = data[offset + MSG_HEADER_SIZE:end]
+
+        if msg_type == ord('D'):
+            msg_id, = struct.unpack_from('<H', body, 0)
+            last_data[msg_id] = body[2:]
+            out += data[offset:end]
+
+        elif msg_type == ord('d'):
+            msg_id, = struct.unpack_from('<H', body, 0)
+
+            if msg_id not in last_data:
+                print('Warning: delta without reference for msg_id {:} at offset {:}'.format(msg_id, offset),
+                      file=sys.stderr)
+            else:
+                payload = decode_delta(body[2:], last_data[msg_id])
+                last_data[msg_id] = payload
+                out += struct.pack('<HBH', len(payload) + 2, ord('D'), msg_id) + payload
+                num_deltas += 1
+
+        elif msg_type == ord('f'):
+            msg_id, = struct.unpack_from('<H', body, 0)
+            layout = layouts.get(msg_names.get(msg_id))
+
+            if layout is None or layout[0] is None:
+                print('Warning: no format for FIFO msg_id {:} at offset {:}'.format(msg_id, offset), file=sys.stderr)
+            else:
+                try:
+                    payload = decode_fifo(body[2:], last_data.get(msg_id), layout)
+                    last_data[msg_id] = payload
+                    out += struct.pack('<HBH', len(payload) + 2, ord('D'), msg_id) + payload
+                    num_deltas += 1
+                except ValueError as e:
+                    print('Warning: {:} (msg_id {:} at offset {:})'.format(e, msg_id, offset), file=sys.stderr)
+
+        elif msg_type == ord('F'):
+            format_str = body.decode('utf-8', errors='replace')
+            layouts[format_str.split(':', 1)[0]] = parse_format(format_str)
+            out += data[offset:end]
+
+        elif msg_type == ord('A'):
+            multi_id, msg_id = struct.unpack_from('<BH', body, 0)
+            msg_names[msg_id] = body[3:].decode('utf-8', errors='replace')
+            out += data[offset:end]
+
+        elif msg_type == ord('B'):
+            flag_bits_offset = len(out)
+            out += data[offset:end]
+
+        elif msg_type == ord('X'):
+            # msg_id, interval_ms, num_messages, first_timestamp, last_timestamp, then (timestamp, offset) entries
+            entries_start = len(out) + MSG_HEADER_SIZE + 2 + 4 + 4 + 8 + 8
+            num_entries = (msg_size - (2 + 4 + 4 + 8 + 8)) // 16
+            index_offsets += [entries_start + 16 * i + 8 for i in range(num_entries)]
+            out += data[offset:end]
+
+        else:
+            out += data[offset:end]
+
+        offset = end
+
+    def remap(file_offset):
+        return offset_map.get(file_offset, file_offset)
+
+    for pos in index_offsets:
+        file_offset, = struct.unpack_from('<Q', out, pos)
+        struct.pack_into('<Q', out, pos, remap(file_offset))
+
+    if flag_bits_offset is not None:
+        incompat_pos = flag_bits_offset + MSG_HEADER_SIZE + 8
+        out[incompat_pos] &= ~INCOMPAT_FLAG0_DATA_DELTA_MASK & 0xff
+        appended_pos = incompat_pos + 8
+
+        for i in range(3):
+            file_offset, = struct.unpack_from('<Q', out, appended_pos + 8 * i)
+            if file_offset != 0:
+                struct.pack_into('<Q', out, appended_pos + 8 * i, remap(file_offset))
+
+    return bytes(out), num_deltas
+
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser(description="""CLI tool to expand the delta encoded data messages of a .ulg file""")
+    parser.add_argument("ulog_file", help="ULog file with delta encoded data")
+    parser.add_argument("-o", "--output", help="output file (default: input file with _decoded.ulg suffix)", default=None)
+
+    args = parser.parse_args()
+
+    output = args.output
+    if output is None:
+        output = os.path.splitext(args.ulog_file)[0] + '_decoded.ulg'
+
+    with open(args.ulog_file, 'rb') as f:
+        data = f.read()
+
+    try:
+        ulog, num_deltas = decode(data)
+    except ValueError as e:
+        print('Error: {:}'.format(e))
+        sys.exit(1)
+
+    with open(output, 'wb') as f:
+        f.write(ulog)
+
+    print('Wrote {:} ({:} delta messages, {:} -> {:} bytes)'.format(output, num_deltas, len(data), len(ulog)))
@@ -31,7 +31,7 @@ parser.add_argument('-f', '--file', metavar='file', action='store',
                     help='output file name prefix',
                     default='graph')
 parser.add_argument('-o', '--output', metavar='output', action='store',
-                    help='output format (json or graphviz)',
+                    help='output format (json, graphviz or unused)',
                     default='json')
 parser.add_argument('-u','--use-topic-union', action='store_true',
                     help='''
@@ -42,6 +42,17 @@ parser.add_argument('-m', '--modules', action='store',
                     help='Comma-separated whitelist of modules (the module\'s '+
                     'MAIN, e.g. from a startup script)',
                     default='')
+parser.add_argument('--logger-topics', metavar='file', action='store',
+                    help='(unused output) logger topic list (logged_topics.cpp), '+
+                    'topics added there count as subscribed',
+                    default=None)
+parser.add_argument('--dds-topics', metavar='file', action='store',
+                    help='(unused output) uXRCE-DDS topic list (dds_topics.yaml), '+
+                    'topics sent to the agent count as subscribed',
+                    default=None)
+parser.add_argument('--header', metavar='file', action='store',
+                    help='(unused output) also write a C++ header with the unused topics',
+                    default=None)
 
 
 logging.basicConfig(level=logging.WARNING,format='%(message)s')
@@ -72,6 +83,20 @@ def topic_filename(topic):
                     return msg_file
     return "no_file"
 
+def msg_topics(msg_path='msg/'):
+    """ get the set of all topic names defined by the messages """
+    topics = set()
+    for file in os.listdir(msg_path):
+        if not file.endswith('.msg'):
+            continue
+        # Pascal case to snake case (MsgFile -> msg_file)
+        name = re.sub(r'(.)([A-Z][a-z]+)', r'\1_\2', file.replace('.msg', ''))
+        topics.add(re.sub(r'([a-z0-9])([A-Z])', r'\1_\2', name).lower())
+        with open(os.path.join(msg_path, file)) as f:
+            for line in re.findall(r'^# TOPICS(.*)$', f.read(), re.MULTILINE):
+                topics.update(line.split())
+    return topics
+
 class PubSub(object):
     """ Collects either publication or subscription information for nodes
     (modules and topics) & edges """
@@ -327,6 +352,7 @@ class Graph(object):
         subscribed_topics = set()
         published_topics = set()
         ambiguous_topics = set()
+        referenced_topics = set()
 
         # gather all found scopes:
         all_scopes = { **self._found_libraries, **self._found_modules }
@@ -356,6 +382,7 @@ class Graph(object):
                 log.debug('            - ' + topic )
                 published_topics.add(topic)
 
+            referenced_topics |= scope.ambiguities
             scope.reduce_ambiguities()
 
             log.debug('        ## Ambiguities: ' + str(len(scope.ambiguities)))
@@ -370,6 +397,7 @@ class Graph(object):
                 scopes_with_topic[name] = scope
 
         self._print_ambiguities = ambiguous_topics
+        self._print_referenced_topics = referenced_topics
         if use_topic_pubsub_union:
             self._print_topics = subscribed_topics | published_topics
             self._print_scopes = scopes_with_topic
@@ -439,7 +467,7 @@ class Graph(object):
                 if 1 < len(tokens):
                     found_library_def = True
                     library_name = tokens[1].split()[0].strip().rstrip(')')
-                    library_scope = LibraryScope(library_name)
+                    library_scope = self._found_libraries.get(library_name, LibraryScope(library_name))
                     self._current_scope.append(library_scope)
                     scope_added = True
                     self._found_libraries[library_name] = library_scope
@@ -471,7 +499,8 @@ class Graph(object):
             # get the definition of MAIN
             if found_module_def and 'MAIN' in words and len(words) >= 2:
                 module_name = words[1]
-                module_scope = ModuleScope(module_name)
+                # the same module can be defined per platform, collect them in one scope
+                module_scope = self._found_modules.get(module_name, ModuleScope(module_name))
                 self._current_scope.append(module_scope)
                 scope_added = True
                 self._found_modules[module_name] = module_scope
@@ -560,7 +589,7 @@ class Graph(object):
                         for topic in dep.subscriptions:
                             module.subscriptions.add(topic)
                         for topic in dep.ambiguities:
-                            module.ambiguities
+                            module.ambiguities.add(topic)
 
         # omit all libraries -- they've already been merged into their respective dependees
         self._scope_whitelist = set([ str(s) for s in self._scope_whitelist if s not in self._found_libraries])
@@ -571,6 +600,11 @@ class Graph(object):
         """ get the set of all modules """
         return self._print_scopes
 
+    @property
+    def output_referenced_topics(self):
+        """ get the set of topics referenced without a detectable publication/subscription """
+        return self._print_referenced_topics
+
     @property
     def output_topics(self):
         """ get set set of all topics """
@@ -711,6 +745,79 @@ class OutputJSON(object):
             json.dump(data, outfile) # add indent=2 for readable formatting
 
 
+class OutputUnused(object):
+    """ write the topics that are published, but neither subscribed nor logged """
+
+    def __init__(self, graph):
+        self._graph = graph
+
+    @staticmethod
+    def _read_topics(file_name, regex):
+        if file_name is None:
+            return set()
+
+        with open(file_name, 'r') as f:
+            return set(re.findall(regex, f.read()))
+
+    def unused_topics(self, logger_topics=None, dds_topics=None):
+        """ get the sorted list of unused topics and the set of topics that are kept """
+        published = set()
+        used = set()
+
+        for _, scope in self._graph.output_scopes.items():
+            published |= scope.publications
+            used |= scope.subscriptions
+
+        # a topic referenced in any other way (e.g. a subscription array) is
+        # possibly subscribed, keep it
+        used |= self._graph.output_referenced_topics
+        used |= self._read_topics(logger_topics, r'add_(?:optional_)?topic(?:_multi)?\(\s*"(\w+)"')
+        used |= self._read_topics(dds_topics, r'topic:\s*/fmu/out/(\w+)')
+
+        # drop matches that are no topic (e.g. in commented out code)
+        published &= msg_topics()
+
+        return sorted(published - used), used & published
+
+    def write(self, file_name, logger_topics=None, dds_topics=None, header=None):
+
+        unused, used = self.unused_topics(logger_topics, dds_topics)
+
+        print('Writing to '+file_name)
+
+        with open(file_name, 'w') as outfile:
+            outfile.write('# topics published, but not subscribed or logged by any module of this build\n')
+
+            for topic in unused:
+                publishers = [name for name, scope in sorted(self._graph.output_scopes.items())
+                              if topic in scope.publications]
+                outfile.write('{:<48s} {}\n'.format(topic, ' '.join(publishers)))
+
+        print('{} unused of {} published topics'.format(len(unused), len(unused) + len(used)))
+
+        if header is not None:
+            print('Writing to '+header)
+
+            with open(header, 'w') as outfile:
+                outfile.write('// auto-generated by Tools/uorb_graph/create.py, do not edit\n\n')
+                outfile.write('#pragma once\n\n')
+                outfile.write('#include <uORB/topics/uORBTopics.hpp>\n\n')
+                outfile.write('namespace uORB\n{\n\n')
+                outfile.write('static constexpr ORB_ID unused_topics[] = {\n')
+
+                for topic in unused:
+                    outfile.write('\tORB_ID::{},\n'.format(topic))
+
+                outfile.write('\tORB_ID::INVALID\n};\n\n')
+                outfile.write('// topics published, but neither subscribed nor logged in this build\n')
+                outfile.write('static constexpr bool topic_unused(ORB_ID id)\n{\n')
+                outfile.write('\tfor (const ORB_ID unused_id : unused_topics) {\n')
+                outfile.write('\t\tif (unused_id == id && id != ORB_ID::INVALID) {\n')
+                outfile.write('\t\t\treturn true;\n\t\t}\n\t}\n\n')
+                outfile.write('\treturn false;\n}\n\n')
+                outfile.write('} // namespace uORB\n')
+
+
 if "__main__" == __name__:
 
     args = parser.parse_args()
@@ -759,6 +866,10 @@ if "__main__" == __name__:
     if path_blacklist:
         print('Excluded Path: '+str(path_blacklist))
 
+    if args.output == 'unused':
+        # every publication is needed to find the ones without subscriber
+        args.use_topic_union = True
+
     graph.build(source_paths, path_blacklist=path_blacklist, use_topic_pubsub_union=args.use_topic_union, merge_depends=args.merge_depends)
 
     if args.output == 'json':
@@ -780,6 +891,10 @@ if "__main__" == __name__:
         output_graphviz.write(args.file+'.fv', engine=engine)
         output_graphviz.write(args.file+'_subs.fv', show_publications=False, engine=engine)
         output_graphviz.write(args.file+'_pubs.fv', show_subscriptions=False, engine=engine)
+    elif args.output == 'unused':
+        output_unused = OutputUnused(graph)
+        output_unused.write(args.file+'_unused.txt', logger_topics=args.logger_topics,
+                dds_topics=args.dds_topics, header=args.header)
     elif args.output == 'none':
         pass
     else:
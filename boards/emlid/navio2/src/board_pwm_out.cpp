@@ -54,6 +54,7 @@ NavioSysfsPWMOut::NavioSysfsPWMOut(int max_num_outputs)
 
 	for (int i = 0; i < MAX_NUM_PWM; ++i) {
 		_pwm_fd[i] = -1;
+		_pwm_last[i] = UINT16_MAX;
 	}
 
 	_pwm_num = max_num_outputs;
@@ -122,11 +123,21 @@ int NavioSysfsPWMOut::send_output_pwm(const uint16_t *pwm, int num_outputs)
 
 	//convert this to duty_cycle in ns
 	for (int i = 0; i < num_outputs; ++i) {
+		if (pwm[i] == _pwm_last[i]) {
+			continue;
+		}
+
 		int n = ::snprintf(data, sizeof(data), "%u", pwm[i] * 1000);
-		int write_ret = ::write(_pwm_fd[i], data, n);
+
+		// sysfs attributes are always written from the start, the fd stays open
+		int write_ret = ::pwrite(_pwm_fd[i], data, n, 0);
 
 		if (n != write_ret) {
+			_pwm_last[i] = UINT16_MAX;
 			ret = -1;
+
+		} else {
+			_pwm_last[i] = pwm[i];
 		}
 	}
 
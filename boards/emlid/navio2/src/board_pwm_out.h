@@ -61,6 +61,7 @@ private:
 	static const int FREQUENCY_PWM = 400;
 
 	int _pwm_fd[MAX_NUM_PWM];
+	uint16_t _pwm_last[MAX_NUM_PWM]; ///< last written pulse width, only changed channels are written
 	int _pwm_num;
 
 	static const char _device[];
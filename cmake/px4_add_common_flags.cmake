@@ -197,4 +197,12 @@ function(px4_add_common_flags)
 		-D__STDC_FORMAT_MACROS
 		)
 
+	if(CONFIG_LIB_MATRIX_SIMD)
+		add_definitions(-DMATRIX_SIMD)
+	endif()
+
+	if(CONFIG_LIB_MATHLIB_FAST_MATH)
+		add_definitions(-DMATHLIB_FAST_MATH)
+	endif()
+
 endfunction()
@@ -79,6 +79,11 @@ ssize_t Serial::readAtLeast(uint8_t *buffer, size_t buffer_size, size_t characte
 	return _impl.readAtLeast(buffer, buffer_size, character_count, timeout_us);
 }
 
+ssize_t Serial::readFrame(uint8_t *buffer, size_t buffer_size, uint32_t timeout_us, uint64_t *timestamp)
+{
+	return _impl.readFrame(buffer, buffer_size, timeout_us, timestamp);
+}
+
 ssize_t Serial::write(const void *buffer, size_t buffer_size)
 {
 	return _impl.write(buffer, buffer_size);
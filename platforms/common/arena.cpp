@@ -0,0 +1,174 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <px4_platform_common/arena.h>
+#include <px4_platform_common/log.h>
+
+#include <containers/LockGuard.hpp>
+
+#include <pthread.h>
+
+static constexpr size_t ALIGNMENT = 8;
+static constexpr uint32_t BLOCK_MAGIC = 0x41524e41;
+
+struct BlockHeader {
+	uint32_t size;	///< payload size [bytes], multiple of ALIGNMENT
+	uint32_t magic;	///< BLOCK_MAGIC while allocated
+};
+
+static_assert(sizeof(BlockHeader) % ALIGNMENT == 0, "header must keep the payload aligned");
+
+/// freed block, the list pointer is stored in the payload (at least ALIGNMENT bytes)
+struct FreeBlock {
+	BlockHeader header;
+	FreeBlock *next;
+};
+
+alignas(ALIGNMENT) static uint8_t _arena[CONFIG_PX4_ARENA_SIZE];
+static size_t _top{0};				///< arena bytes handed out so far (including freed ones)
+static FreeBlock *_free_list{nullptr};
+static px4_arena_usage_s _usage{CONFIG_PX4_ARENA_SIZE, 0, 0, 0, 0};
+static pthread_mutex_t _mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static size_t block_size(const BlockHeader *header) { return sizeof(BlockHeader) + header->size; }
+
+void *px4_arena_alloc(size_t size)
+{
+	const size_t payload = (size == 0) ? ALIGNMENT : ((size + ALIGNMENT - 1) & ~(ALIGNMENT - 1));
+
+	{
+		LockGuard lg{_mutex};
+
+		// reuse the best fitting free block, accepting up to 1/8 of unused space
+		FreeBlock **best = nullptr;
+
+		for (FreeBlock **it = &_free_list; *it != nullptr; it = &(*it)->next) {
+			const size_t free_size = (*it)->header.size;
+
+			if ((free_size >= payload) && (free_size <= payload + payload / 8)
+			    && ((best == nullptr) || (free_size < (*best)->header.size))) {
+				best = it;
+
+				if (free_size == payload) {
+					break;
+				}
+			}
+		}
+
+		BlockHeader *header = nullptr;
+
+		if (best != nullptr) {
+			FreeBlock *block = *best;
+			*best = block->next;
+			header = &block->header;
+			_usage.free_list -= block_size(header);
+
+		} else if (_top + sizeof(BlockHeader) + payload <= sizeof(_arena)) {
+			header = reinterpret_cast<BlockHeader *>(&_arena[_top]);
+			header->size = payload;
+			_top += block_size(header);
+		}
+
+		if (header != nullptr) {
+			header->magic = BLOCK_MAGIC;
+			_usage.used += block_size(header);
+
+			if (_usage.used > _usage.peak) {
+				_usage.peak = _usage.used;
+			}
+
+			return header + 1;
+		}
+
+		_usage.fallbacks++;
+	}
+
+	return malloc(size);
+}
+
+void px4_arena_free(void *ptr)
+{
+	if (ptr == nullptr) {
+		return;
+	}
+
+	if ((ptr < (void *)_arena) || (ptr >= (void *)&_arena[sizeof(_arena)])) {
+		free(ptr);
+		return;
+	}
+
+	LockGuard lg{_mutex};
+
+	BlockHeader *header = static_cast<BlockHeader *>(ptr) - 1;
+
+	if (header->magic != BLOCK_MAGIC) {
+		PX4_ERR("arena: invalid free %p", ptr);
+		return;
+	}
+
+	header->magic = 0;
+	_usage.used -= block_size(header);
+
+	if (reinterpret_cast<uint8_t *>(header) + block_size(header) == &_arena[_top]) {
+		// last block, give it back to the unused part of the arena together with
+		// the free blocks right below it
+		_top -= block_size(header);
+
+		for (FreeBlock **it = &_free_list; *it != nullptr;) {
+			FreeBlock *block = *it;
+
+			if (reinterpret_cast<uint8_t *>(block) + block_size(&block->header) == &_arena[_top]) {
+				*it = block->next;
+				_top -= block_size(&block->header);
+				_usage.free_list -= block_size(&block->header);
+				it = &_free_list; // start over, the block below may be earlier in the list
+
+			} else {
+				it = &block->next;
+			}
+		}
+
+	} else {
+		FreeBlock *block = reinterpret_cast<FreeBlock *>(header);
+		block->next = _free_list;
+		_free_list = block;
+		_usage.free_list += block_size(header);
+	}
+}
+
+int px4_arena_get_usage(px4_arena_usage_s *usage)
+{
+	LockGuard lg{_mutex};
+	*usage = _usage;
+	return 0;
+}
@@ -0,0 +1,124 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file boot_trace.cpp
+ */
+
+#include <px4_platform_common/boot_trace.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/log.h>
+
+#include <drivers/drv_hrt.h>
+
+#include <string.h>
+
+static px4_boot_trace_event_s boot_trace_events[PX4_BOOT_TRACE_MAX_EVENTS];
+static px4::atomic_int boot_trace_count{0};
+static px4::atomic_int boot_trace_dropped{0};
+
+int px4_boot_trace_begin(const char *name)
+{
+	const int handle = boot_trace_count.fetch_add(1);
+
+	if (handle >= PX4_BOOT_TRACE_MAX_EVENTS) {
+		boot_trace_count.store(PX4_BOOT_TRACE_MAX_EVENTS);
+		boot_trace_dropped.fetch_add(1);
+		return -1;
+	}
+
+	px4_boot_trace_event_s &event = boot_trace_events[handle];
+	strncpy(event.name, name, sizeof(event.name) - 1);
+	event.name[sizeof(event.name) - 1] = '\0';
+	event.duration = UINT32_MAX;
+	event.start = hrt_absolute_time();
+	return handle;
+}
+
+void px4_boot_trace_end(int handle)
+{
+	if (handle >= 0 && handle < PX4_BOOT_TRACE_MAX_EVENTS) {
+		px4_boot_trace_event_s &event = boot_trace_events[handle];
+		event.duration = hrt_elapsed_time(&event.start);
+	}
+}
+
+int px4_boot_trace_end_name(const char *name)
+{
+	for (int i = px4_boot_trace_count() - 1; i >= 0; i--) {
+		px4_boot_trace_event_s &event = boot_trace_events[i];
+
+		if ((event.duration == UINT32_MAX) && (strncmp(event.name, name, sizeof(event.name) - 1) == 0)) {
+			px4_boot_trace_end(i);
+			return 0;
+		}
+	}
+
+	return -1;
+}
+
+int px4_boot_trace_count()
+{
+	const int count = boot_trace_count.load();
+	return (count < PX4_BOOT_TRACE_MAX_EVENTS) ? count : PX4_BOOT_TRACE_MAX_EVENTS;
+}
+
+bool px4_boot_trace_get(int index, px4_boot_trace_event_s *event)
+{
+	if (index < 0 || index >= px4_boot_trace_count()) {
+		return false;
+	}
+
+	*event = boot_trace_events[index];
+	return true;
+}
+
+void px4_boot_trace_print()
+{
+	PX4_INFO_RAW("  # section              start [ms] duration [ms]\n");
+
+	for (int i = 0; i < px4_boot_trace_count(); i++) {
+		const px4_boot_trace_event_s &event = boot_trace_events[i];
+
+		if (event.duration == UINT32_MAX) {
+			PX4_INFO_RAW("%3d %-20s %10.1f       running\n", i, event.name, (double)event.start * 1e-3);
+
+		} else {
+			PX4_INFO_RAW("%3d %-20s %10.1f %13.1f\n", i, event.name, (double)event.start * 1e-3, (double)event.duration * 1e-3);
+		}
+	}
+
+	if (boot_trace_dropped.load() > 0) {
+		PX4_INFO_RAW("%d events dropped\n", boot_trace_dropped.load());
+	}
+}
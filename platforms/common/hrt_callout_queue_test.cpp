@@ -0,0 +1,155 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <px4_platform_common/hrt_callout_queue.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <set>
+#include <utility>
+
+/**
+ * @file hrt_callout_queue_test.cpp
+ *
+ * Checks the callout heap against an ordered reference under random insert, move, remove and pop.
+ */
+
+class HrtCalloutQueueTest : public ::testing::Test
+{
+public:
+	static constexpr int NUM_ENTRIES = 100;
+
+	void SetUp() override
+	{
+		memset(_entries, 0, sizeof(_entries));
+		hrt_callout_queue_init(&_queue);
+	}
+
+	void insert(hrt_call *entry, hrt_abstime deadline)
+	{
+		remove(entry);
+		entry->deadline = deadline;
+		hrt_callout_queue_insert(&_queue, entry);
+		_reference.insert(std::make_pair(deadline, entry));
+	}
+
+	void remove(hrt_call *entry)
+	{
+		if (hrt_callout_queue_contains(&_queue, entry)) {
+			_reference.erase(_reference.find(std::make_pair(entry->deadline, entry)));
+		}
+
+		hrt_callout_queue_remove(&_queue, entry);
+	}
+
+	hrt_call _entries[NUM_ENTRIES];
+	hrt_callout_queue_t _queue;
+	std::multiset<std::pair<hrt_abstime, hrt_call *>> _reference;
+};
+
+TEST_F(HrtCalloutQueueTest, Empty)
+{
+	EXPECT_EQ(hrt_callout_queue_peek(&_queue), nullptr);
+	EXPECT_EQ(hrt_callout_queue_pop(&_queue), nullptr);
+	EXPECT_FALSE(hrt_callout_queue_contains(&_queue, &_entries[0]));
+
+	// removing an entry that was never queued does nothing
+	hrt_callout_queue_remove(&_queue, &_entries[0]);
+	EXPECT_EQ(_queue.count, 0u);
+}
+
+TEST_F(HrtCalloutQueueTest, PopsInDeadlineOrder)
+{
+	for (int i = 0; i < NUM_ENTRIES; i++) {
+		// descending deadlines, the worst case for the former sorted list
+		insert(&_entries[i], 1000 - i);
+	}
+
+	EXPECT_EQ(_queue.count, (uint32_t)NUM_ENTRIES);
+	EXPECT_EQ(_queue.count_max, (uint32_t)NUM_ENTRIES);
+
+	hrt_abstime previous = 0;
+
+	for (int i = 0; i < NUM_ENTRIES; i++) {
+		hrt_call *entry = hrt_callout_queue_pop(&_queue);
+		ASSERT_NE(entry, nullptr);
+		EXPECT_GE(entry->deadline, previous);
+		EXPECT_FALSE(hrt_callout_queue_contains(&_queue, entry));
+		previous = entry->deadline;
+	}
+
+	EXPECT_EQ(hrt_callout_queue_pop(&_queue), nullptr);
+}
+
+TEST_F(HrtCalloutQueueTest, RandomOperations)
+{
+	srand(1);
+
+	for (int i = 0; i < 20000; i++) {
+		hrt_call *entry = &_entries[rand() % NUM_ENTRIES];
+
+		switch (rand() % 4) {
+		case 0:
+		case 1:
+			// insert, or move if already queued, with many equal deadlines
+			insert(entry, rand() % 50);
+			break;
+
+		case 2:
+			remove(entry);
+			break;
+
+		default: {
+				hrt_call *popped = hrt_callout_queue_pop(&_queue);
+
+				if (_reference.empty()) {
+					ASSERT_EQ(popped, nullptr);
+
+				} else {
+					ASSERT_NE(popped, nullptr);
+					ASSERT_EQ(popped->deadline, _reference.begin()->first);
+					_reference.erase(_reference.find(std::make_pair(popped->deadline, popped)));
+				}
+			}
+			break;
+		}
+
+		ASSERT_EQ(_queue.count, _reference.size());
+
+		if (!_reference.empty()) {
+			ASSERT_EQ(hrt_callout_queue_peek(&_queue)->deadline, _reference.begin()->first);
+		}
+	}
+}
@@ -38,13 +38,17 @@
 #endif
 
 #include <lib/drivers/device/Device.hpp>
+#include <px4_platform_common/boot_trace.h>
 #include <px4_platform_common/i2c_spi_buses.h>
+#include <px4_platform_common/micro_hal.h>
 #include <px4_platform_common/px4_work_queue/WorkItemSingleShot.hpp>
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/getopt.h>
 
 #include <pthread.h>
 
+using namespace time_literals;
+
 static List<I2CSPIInstance *> i2c_spi_module_instances; ///< list of currently running instances
 static pthread_mutex_t i2c_spi_module_instances_mutex = PTHREAD_MUTEX_INITIALIZER;
 
@@ -642,8 +646,10 @@ int I2CSPIDriverBase::module_start(const BusCLIArguments &cli, BusInstanceIterat
 		I2CSPIDriverInitializing initializer_data{driver_config, instantiate, runtime_instance};
 		// initialize the object and bus on the work queue thread - this will also probe for the device
 		px4::WorkItemSingleShot initializer(wq_config, initializer_trampoline, &initializer_data);
+		const int trace = px4_boot_trace_begin(iterator.moduleName());
 		initializer.ScheduleNow();
 		initializer.wait();
+		px4_boot_trace_end(trace);
 		I2CSPIDriverBase *instance = initializer_data.instance;
 
 		if (!instance) {
@@ -826,6 +832,68 @@ void I2CSPIDriverBase::print_status()
 #endif // CONFIG_SPI
 }
 
+#if defined(CONFIG_SPI)
+bool I2CSPIDriverBase::DataReadyInterruptConfigure(bool rising_edge, bool falling_edge, bool event)
+{
+	_data_ready_interrupt_enabled = false;
+
+	if (_drdy_gpio == 0) {
+		return false;
+	}
+
+	_drdy_timestamp_sample.store(0);
+
+	_data_ready_interrupt_enabled = (px4_arch_gpiosetevent(_drdy_gpio, rising_edge, falling_edge, event,
+					 &DataReadyInterruptCallback, this) == 0);
+
+	return _data_ready_interrupt_enabled;
+}
+
+bool I2CSPIDriverBase::DataReadyInterruptDisable()
+{
+	_data_ready_interrupt_enabled = false;
+
+	if (_drdy_gpio == 0) {
+		return false;
+	}
+
+	return px4_arch_gpiosetevent(_drdy_gpio, false, false, false, nullptr, nullptr) == 0;
+}
+
+bool I2CSPIDriverBase::DataReadyScheduleStart(uint32_t interval_us, bool rising_edge, bool falling_edge, bool event)
+{
+	if (DataReadyInterruptConfigure(rising_edge, falling_edge, event)) {
+		// backup schedule as a watchdog timeout
+		ScheduleDelayed(100_ms);
+		return true;
+	}
+
+	ScheduleOnInterval(interval_us, interval_us);
+	return false;
+}
+
+hrt_abstime I2CSPIDriverBase::DataReadyTimestampSample(const hrt_abstime &now, uint32_t max_age_us)
+{
+	const hrt_abstime timestamp_sample = _drdy_timestamp_sample.fetch_and(0);
+
+	if ((timestamp_sample != 0) && ((now - timestamp_sample) < max_age_us)) {
+		return timestamp_sample;
+	}
+
+	return 0;
+}
+
+int I2CSPIDriverBase::DataReadyInterruptCallback(int irq, void *context, void *arg)
+{
+	I2CSPIDriverBase *driver = static_cast<I2CSPIDriverBase *>(arg);
+
+	// timestamp the sample in the interrupt, before any scheduling latency
+	driver->_drdy_timestamp_sample.store(hrt_absolute_time());
+	driver->ScheduleNow();
+	return 0;
+}
+#endif // CONFIG_SPI
+
 void I2CSPIDriverBase::request_stop_and_wait()
 {
 	_task_should_exit.store(true);
@@ -64,6 +64,15 @@ public:
 	ssize_t read(uint8_t *buffer, size_t buffer_size);
 	ssize_t readAtLeast(uint8_t *buffer, size_t buffer_size, size_t character_count = 1, uint32_t timeout_us = 0);
 
+	// Wait up to timeout_us for data, then read until the line has been idle for
+	// SerialConfig::FRAME_GAP_CHARACTERS (at least 1 ms) or the buffer is full, so that
+	// a burst of data (eg an RC or GPS frame) is returned with a single wakeup.
+	// With UART RX DMA (NuttX boards configuring CONFIG_<chip>_<uart>_RXDMA) the driver
+	// delivers the data on the idle line interrupt, i.e. once per frame.
+	// The optional timestamp is the estimated receive time of the first byte.
+	// Returns the number of bytes read, 0 on timeout, or -1 on error.
+	ssize_t readFrame(uint8_t *buffer, size_t buffer_size, uint32_t timeout_us, uint64_t *timestamp = nullptr);
+
 	ssize_t write(const void *buffer, size_t buffer_size);
 
 	void flush();
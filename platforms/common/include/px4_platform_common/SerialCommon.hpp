@@ -33,6 +33,8 @@
 
 #pragma once
 
+#include <stdint.h>
+
 namespace device
 {
 namespace SerialConfig
@@ -66,5 +68,15 @@ enum class FlowControl {
 	Enabled  = 1,
 };
 
+// A received frame ends once the line has been idle for this many character times
+static constexpr uint32_t FRAME_GAP_CHARACTERS = 3;
+
+// Time to transfer one character (start, data, parity and stop bits) [us], rounded up
+static inline uint32_t characterTime(uint32_t baudrate, ByteSize bytesize, Parity parity, StopBits stopbits)
+{
+	const uint32_t bits = 1 + (uint32_t)bytesize + ((parity == Parity::None) ? 0 : 1) + (uint32_t)stopbits;
+	return (baudrate > 0) ? (bits * 1000000 + baudrate - 1) / baudrate : 0;
+}
+
 } // namespace SerialConfig
 } // namespace device
@@ -0,0 +1,94 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file arena.h
+ * Startup arena for long-lived allocations
+ *
+ * Objects that are created at startup and recreated on mode changes or
+ * reconnects (work items, uORB topic buffers) are allocated from a fixed
+ * arena instead of the heap. Freed blocks are kept on a free list and reused
+ * for allocations of (nearly) the same size, so restarting a module reuses
+ * its previous memory instead of leaving holes in the heap.
+ * If the arena is full, allocations fall back to the heap.
+ *
+ * Without CONFIG_PX4_ARENA all functions map to malloc()/free().
+ */
+
+#pragma once
+
+#include <px4_platform_common/px4_config.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+__BEGIN_DECLS
+
+typedef struct px4_arena_usage {
+	uint32_t total;		///< arena size [bytes]
+	uint32_t used;		///< bytes in use, including block headers
+	uint32_t peak;		///< maximum of used
+	uint32_t free_list;	///< bytes on the free list, available for reuse
+	uint32_t fallbacks;	///< number of allocations that did not fit and went to the heap
+} px4_arena_usage_s;
+
+#if defined(CONFIG_PX4_ARENA)
+
+/**
+ * Allocate from the arena, or from the heap if the arena is full.
+ * Not to be called from interrupt context.
+ * @return 8 byte aligned memory, nullptr if both are out of memory
+ */
+__EXPORT void *px4_arena_alloc(size_t size);
+
+/**
+ * Free memory from px4_arena_alloc() (nullptr is ignored).
+ */
+__EXPORT void px4_arena_free(void *ptr);
+
+/**
+ * Get the arena usage.
+ * @return 0 on success
+ */
+__EXPORT int px4_arena_get_usage(px4_arena_usage_s *usage);
+
+#else
+
+static inline void *px4_arena_alloc(size_t size) { return malloc(size); }
+static inline void px4_arena_free(void *ptr) { free(ptr); }
+static inline int px4_arena_get_usage(px4_arena_usage_s *usage) { (void)usage; return -1; }
+
+#endif // CONFIG_PX4_ARENA
+
+__END_DECLS
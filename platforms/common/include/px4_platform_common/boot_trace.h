@@ -0,0 +1,116 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file boot_trace.h
+ * Boot time tracing: records when the parts of the boot (platform init, parameter load,
+ * module starts, driver probing, startup script sections) begin and how long they take.
+ */
+
+#pragma once
+
+#include <px4_platform_common/px4_config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define PX4_BOOT_TRACE_MAX_EVENTS 32
+#define PX4_BOOT_TRACE_NAME_LENGTH 20
+
+__BEGIN_DECLS
+
+struct px4_boot_trace_event_s {
+	char name[PX4_BOOT_TRACE_NAME_LENGTH];
+	uint64_t start;    ///< hrt time at begin (microseconds)
+	uint32_t duration; ///< time until end (microseconds), UINT32_MAX while not ended
+};
+
+/**
+ * Mark the begin of a boot section. Events after the first PX4_BOOT_TRACE_MAX_EVENTS are dropped.
+ * @param name section name, copied (and truncated)
+ * @return handle for px4_boot_trace_end(), -1 if dropped
+ */
+__EXPORT int px4_boot_trace_begin(const char *name);
+
+/**
+ * Mark the end of a boot section
+ * @param handle return value of px4_boot_trace_begin()
+ */
+__EXPORT void px4_boot_trace_end(int handle);
+
+/**
+ * End the last begun, not yet ended section with the given name (for the shell, which has no handle)
+ * @return 0 on success, -1 if there is no such section
+ */
+__EXPORT int px4_boot_trace_end_name(const char *name);
+
+/**
+ * Copy a recorded event
+ * @return false if index is out of range
+ */
+__EXPORT bool px4_boot_trace_get(int index, struct px4_boot_trace_event_s *event);
+
+/**
+ * @return number of recorded events
+ */
+__EXPORT int px4_boot_trace_count(void);
+
+/**
+ * Print the boot timeline
+ */
+__EXPORT void px4_boot_trace_print(void);
+
+__END_DECLS
+
+#ifdef __cplusplus
+namespace px4
+{
+
+/**
+ * Traces the lifetime of the object as a boot section
+ */
+class BootTraceScope
+{
+public:
+	explicit BootTraceScope(const char *name) : _handle(px4_boot_trace_begin(name)) {}
+	~BootTraceScope() { px4_boot_trace_end(_handle); }
+
+	BootTraceScope(const BootTraceScope &) = delete;
+	BootTraceScope &operator=(const BootTraceScope &) = delete;
+
+private:
+	const int _handle;
+};
+
+} // namespace px4
+#endif
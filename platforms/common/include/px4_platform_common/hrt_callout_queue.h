@@ -0,0 +1,284 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file hrt_callout_queue.h
+ *
+ * Deadline ordered queue of hrt_call entries, shared by the hrt drivers.
+ *
+ * The queue is a binary min-heap kept as a complete binary tree in the entries
+ * themselves (parent, left and right links of struct hrt_call), so it needs no
+ * storage besides the entries and has no capacity limit. Insert, remove and pop
+ * are O(log n) in the worst case, which bounds the time spent in the timer
+ * interrupt independently of the order the entries are scheduled in.
+ *
+ * Entries must be zero-initialized (or passed through hrt_call_init()) before
+ * their first use, their links are only valid while they are queued.
+ * The functions do not lock, the caller serializes access.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <drivers/drv_hrt.h>
+
+typedef struct hrt_callout_queue {
+	struct hrt_call	*root;
+	uint32_t	count;
+	uint32_t	count_max;	/**< maximum number of entries queued at the same time */
+} hrt_callout_queue_t;
+
+static inline void hrt_callout_queue_init(hrt_callout_queue_t *queue)
+{
+	queue->root = NULL;
+	queue->count = 0;
+	queue->count_max = 0;
+}
+
+/**
+ * Entry with the earliest deadline, NULL if the queue is empty.
+ */
+static inline struct hrt_call *hrt_callout_queue_peek(const hrt_callout_queue_t *queue)
+{
+	return queue->root;
+}
+
+static inline bool hrt_callout_queue_contains(const hrt_callout_queue_t *queue, const struct hrt_call *entry)
+{
+	return (entry == queue->root) || (entry->parent != NULL);
+}
+
+/**
+ * Entry at 1-based level order position index (1 <= index <= count).
+ */
+static inline struct hrt_call *hrt_callout_queue_at(const hrt_callout_queue_t *queue, uint32_t index)
+{
+	uint32_t mask = 1;
+
+	while ((mask << 1) <= index && (mask << 1) != 0) {
+		mask <<= 1;
+	}
+
+	struct hrt_call *node = queue->root;
+
+	// the bits below the most significant one are the path from the root, 0: left, 1: right
+	for (mask >>= 1; mask != 0; mask >>= 1) {
+		node = (index & mask) ? node->right : node->left;
+	}
+
+	return node;
+}
+
+/**
+ * Exchange the tree positions of entry and its parent.
+ */
+static inline void hrt_callout_queue_swap_with_parent(hrt_callout_queue_t *queue, struct hrt_call *entry)
+{
+	struct hrt_call *parent = entry->parent;
+	struct hrt_call *grandparent = parent->parent;
+	struct hrt_call *left = entry->left;
+	struct hrt_call *right = entry->right;
+
+	if (parent->left == entry) {
+		entry->left = parent;
+		entry->right = parent->right;
+
+		if (entry->right) {
+			entry->right->parent = entry;
+		}
+
+	} else {
+		entry->right = parent;
+		entry->left = parent->left;
+
+		if (entry->left) {
+			entry->left->parent = entry;
+		}
+	}
+
+	parent->left = left;
+	parent->right = right;
+
+	if (left) {
+		left->parent = parent;
+	}
+
+	if (right) {
+		right->parent = parent;
+	}
+
+	parent->parent = entry;
+	entry->parent = grandparent;
+
+	if (grandparent == NULL) {
+		queue->root = entry;
+
+	} else if (grandparent->left == parent) {
+		grandparent->left = entry;
+
+	} else {
+		grandparent->right = entry;
+	}
+}
+
+static inline void hrt_callout_queue_sift_up(hrt_callout_queue_t *queue, struct hrt_call *entry)
+{
+	while ((entry->parent != NULL) && (entry->deadline < entry->parent->deadline)) {
+		hrt_callout_queue_swap_with_parent(queue, entry);
+	}
+}
+
+static inline void hrt_callout_queue_sift_down(hrt_callout_queue_t *queue, struct hrt_call *entry)
+{
+	// the tree is complete, an entry without a left child has no children
+	while (entry->left != NULL) {
+		struct hrt_call *child = entry->left;
+
+		if ((entry->right != NULL) && (entry->right->deadline < child->deadline)) {
+			child = entry->right;
+		}
+
+		if (child->deadline >= entry->deadline) {
+			break;
+		}
+
+		hrt_callout_queue_swap_with_parent(queue, child);
+	}
+}
+
+/**
+ * Remove entry from the queue, does nothing if it is not queued.
+ */
+static inline void hrt_callout_queue_remove(hrt_callout_queue_t *queue, struct hrt_call *entry)
+{
+	if (!hrt_callout_queue_contains(queue, entry)) {
+		return;
+	}
+
+	// detach the last entry, it fills the gap left by the removed one
+	struct hrt_call *last = hrt_callout_queue_at(queue, queue->count);
+
+	if (last->parent == NULL) {
+		queue->root = NULL;
+
+	} else if (last->parent->right == last) {
+		last->parent->right = NULL;
+
+	} else {
+		last->parent->left = NULL;
+	}
+
+	queue->count--;
+
+	if (last != entry) {
+		last->parent = entry->parent;
+		last->left = entry->left;
+		last->right = entry->right;
+
+		if (last->left) {
+			last->left->parent = last;
+		}
+
+		if (last->right) {
+			last->right->parent = last;
+		}
+
+		if (entry->parent == NULL) {
+			queue->root = last;
+
+		} else if (entry->parent->left == entry) {
+			entry->parent->left = last;
+
+		} else {
+			entry->parent->right = last;
+		}
+
+		hrt_callout_queue_sift_up(queue, last);
+		hrt_callout_queue_sift_down(queue, last);
+	}
+
+	entry->parent = NULL;
+	entry->left = NULL;
+	entry->right = NULL;
+}
+
+/**
+ * Insert entry ordered by its deadline, an entry that is already queued is moved.
+ */
+static inline void hrt_callout_queue_insert(hrt_callout_queue_t *queue, struct hrt_call *entry)
+{
+	hrt_callout_queue_remove(queue, entry);
+
+	entry->left = NULL;
+	entry->right = NULL;
+	queue->count++;
+
+	if (queue->count > queue->count_max) {
+		queue->count_max = queue->count;
+	}
+
+	if (queue->count == 1) {
+		entry->parent = NULL;
+		queue->root = entry;
+		return;
+	}
+
+	struct hrt_call *parent = hrt_callout_queue_at(queue, queue->count >> 1);
+	entry->parent = parent;
+
+	if (queue->count & 1) {
+		parent->right = entry;
+
+	} else {
+		parent->left = entry;
+	}
+
+	hrt_callout_queue_sift_up(queue, entry);
+}
+
+/**
+ * Remove and return the entry with the earliest deadline, NULL if the queue is empty.
+ */
+static inline struct hrt_call *hrt_callout_queue_pop(hrt_callout_queue_t *queue)
+{
+	struct hrt_call *entry = queue->root;
+
+	if (entry != NULL) {
+		hrt_callout_queue_remove(queue, entry);
+	}
+
+	return entry;
+}
@@ -284,7 +284,11 @@ class I2CSPIDriverBase : public px4::ScheduledWorkItem, public I2CSPIInstance
 public:
 	I2CSPIDriverBase(const I2CSPIDriverConfig &config)
 		: ScheduledWorkItem(config.module_name, config.wq_config),
-		  I2CSPIInstance(config) {}
+		  I2CSPIInstance(config)
+#if defined(CONFIG_SPI)
+		, _drdy_gpio(config.drdy_gpio)
+#endif // CONFIG_SPI
+	{}
 
 	static int module_stop(BusInstanceIterator &iterator);
 	static int module_status(BusInstanceIterator &iterator);
@@ -311,6 +315,40 @@ protected:
 	static int module_start(const BusCLIArguments &cli, BusInstanceIterator &iterator, void(*print_usage)(),
 				instantiate_method instantiate);
 
+#if defined(CONFIG_SPI)
+	/**
+	 * Register the data ready (DRDY) interrupt of the device, if the board has a DRDY line for it.
+	 * Every interrupt captures the sample timestamp and schedules the driver immediately.
+	 *
+	 * @return true if the interrupt is enabled, false if the driver has to poll instead
+	 */
+	bool DataReadyInterruptConfigure(bool rising_edge = false, bool falling_edge = true, bool event = true);
+	bool DataReadyInterruptDisable();
+	bool DataReadyInterruptEnabled() const { return _data_ready_interrupt_enabled; }
+
+	/**
+	 * Start sampling from the data ready interrupt, with a backup schedule as watchdog,
+	 * or fall back to polling on a fixed interval if the interrupt isn't available.
+	 *
+	 * @param interval_us	polling interval (e.g. FIFO watermark interval)
+	 * @return true if sampling is interrupt driven
+	 */
+	bool DataReadyScheduleStart(uint32_t interval_us, bool rising_edge = false, bool falling_edge = true,
+				    bool event = true);
+
+	/**
+	 * Get and clear the sample timestamp captured by the last data ready interrupt.
+	 *
+	 * @param now		current time
+	 * @param max_age_us	older timestamps are considered a missed interrupt
+	 * @return captured timestamp, or 0 if there was no recent interrupt
+	 */
+	hrt_abstime DataReadyTimestampSample(const hrt_abstime &now, uint32_t max_age_us);
+
+	// discard a captured timestamp (e.g. after a FIFO reset)
+	void DataReadyTimestampReset() { _drdy_timestamp_sample.store(0); }
+#endif // CONFIG_SPI
+
 private:
 	static void custom_method_trampoline(void *argument);
 
@@ -318,6 +356,14 @@ private:
 
 	px4::atomic_bool _task_should_exit{false};
 	px4::atomic_bool _task_exited{false};
+
+#if defined(CONFIG_SPI)
+	static int DataReadyInterruptCallback(int irq, void *context, void *arg);
+
+	const spi_drdy_gpio_t _drdy_gpio;
+	px4::atomic<hrt_abstime> _drdy_timestamp_sample{0};
+	bool _data_ready_interrupt_enabled{false};
+#endif // CONFIG_SPI
 };
 
 /**
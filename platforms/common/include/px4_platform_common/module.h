@@ -42,6 +42,7 @@
 #include <stdbool.h>
 
 #include <px4_platform_common/atomic.h>
+#include <px4_platform_common/boot_trace.h>
 #include <px4_platform_common/time.h>
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/tasks.h>
@@ -206,7 +207,9 @@ public:
 			PX4_ERR("Task already running");
 
 		} else {
+			const int trace = px4_boot_trace_begin(MODULE_NAME);
 			ret = T::task_spawn(argc, argv);
+			px4_boot_trace_end(trace);
 
 			if (ret < 0) {
 				PX4_ERR("Task start failed (%i)", ret);
@@ -402,10 +405,11 @@ protected:
 private:
 	/**
 	 * @brief lock_module Mutex to lock the module thread.
+	 *        Every module has its own mutex, so that different modules can be started concurrently.
 	 */
 	static void lock_module()
 	{
-		pthread_mutex_lock(&px4_modules_mutex);
+		pthread_mutex_lock(&_module_mutex);
 	}
 
 	/**
@@ -413,9 +417,12 @@ private:
 	 */
 	static void unlock_module()
 	{
-		pthread_mutex_unlock(&px4_modules_mutex);
+		pthread_mutex_unlock(&_module_mutex);
 	}
 
+	/** @var _module_mutex Protects _object and _task_id of this module. */
+	static pthread_mutex_t _module_mutex;
+
 	/** @var _task_should_exit Boolean flag to indicate if the task should exit. */
 	px4::atomic_bool _task_should_exit{false};
 };
@@ -426,6 +433,9 @@ px4::atomic<T *> ModuleBase<T>::_object{nullptr};
 template<class T>
 int ModuleBase<T>::_task_id = -1;
 
+template<class T>
+pthread_mutex_t ModuleBase<T>::_module_mutex = PTHREAD_MUTEX_INITIALIZER;
+
 
 #endif /* __cplusplus */
 
@@ -40,6 +40,7 @@
 #pragma once
 
 #include <containers/List.hpp>
+#include <uORB/topics/parameter_update.h>
 
 #include "param.h"
 
@@ -90,13 +91,63 @@ protected:
 		updateParamsImpl();
 	}
 
+	/**
+	 * @brief Like updateParams(), but skips the update if none of the parameters changed in a
+	 *        parameter_update notification is used by this module or its children.
+	 *        Falls back to updating everything if a notification was missed or listed only part of the changes.
+	 *        Only use this if every parameter of the module tree is declared with DEFINE_PARAMETERS().
+	 * @param update the parameter_update notification
+	 * @return true if updateParams() was called
+	 */
+	bool updateParamsIfChanged(const parameter_update_s &update)
+	{
+		// the list of changed parameters only covers the changes since the previous instance
+		bool update_all = !_param_update_valid || (update.instance != _param_update_instance + 1)
+				  || update.changed_params_overflow;
+
+		_param_update_instance = update.instance;
+		_param_update_valid = true;
+
+		for (int i = 0; !update_all && (i < update.changed_params_count); i++) {
+			update_all = usesParam(update.changed_params[i]);
+		}
+
+		if (update_all) {
+			updateParams();
+		}
+
+		return update_all;
+	}
+
+	/**
+	 * @brief Check if this module or one of its children uses a parameter
+	 */
+	bool usesParam(param_t param)
+	{
+		for (const auto &child : _children) {
+			if (child->usesParam(param)) {
+				return true;
+			}
+		}
+
+		return usesParamImpl(param);
+	}
+
 	/**
 	 * @brief The implementation for this is generated with the macro DEFINE_PARAMETERS()
 	 */
 	virtual void updateParamsImpl() {}
 
+	/**
+	 * @brief The implementation for this is generated with the macro DEFINE_PARAMETERS()
+	 */
+	virtual bool usesParamImpl(param_t param) const { return false; }
+
 private:
 	/** @list _children The module parameter list of inheriting classes. */
 	List<ModuleParams *> _children;
 	ModuleParams *_parent{nullptr};
+
+	uint32_t _param_update_instance{0};
+	bool _param_update_valid{false};
 };
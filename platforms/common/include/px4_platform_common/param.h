@@ -62,6 +62,9 @@ inline static param_t param_handle(px4::params p)
 #define _CALL_UPDATE(x) \
 	STRIP(x).update();
 
+#define _CHECK_HANDLE(x) \
+	if (STRIP(x).handle() == param) { return true; }
+
 // define the parameter update method, which will update all parameters.
 // It is marked as 'final', so that wrong usages lead to a compile error (see below)
 #define _DEFINE_PARAMETER_UPDATE_METHOD(...) \
@@ -69,6 +72,10 @@ inline static param_t param_handle(px4::params p)
 	void updateParamsImpl() final { \
 		APPLY_ALL(_CALL_UPDATE, __VA_ARGS__) \
 	} \
+	bool usesParamImpl(param_t param) const final { \
+		APPLY_ALL(_CHECK_HANDLE, __VA_ARGS__) \
+		return false; \
+	} \
 	private:
 
 // Define a list of parameters. This macro also creates code to update parameters.
@@ -88,6 +95,10 @@ inline static param_t param_handle(px4::params p)
 		parent_class::updateParamsImpl(); \
 		APPLY_ALL(_CALL_UPDATE, __VA_ARGS__) \
 	} \
+	bool usesParamImpl(param_t param) const override { \
+		APPLY_ALL(_CHECK_HANDLE, __VA_ARGS__) \
+		return parent_class::usesParamImpl(param); \
+	} \
 	private:
 
 #define DEFINE_PARAMETERS_CUSTOM_PARENT(parent_class, ...) \
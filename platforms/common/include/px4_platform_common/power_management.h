@@ -0,0 +1,110 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file power_management.h
+ * Low-power idle and CPU performance level hooks
+ *
+ * PX4 does not put the CPU to sleep or change its clock itself, the board
+ * registers the operations that do (@see px4_pm_register_ops()).
+ * - load_mon lowers the performance level while the CPU load is low
+ *   (SYS_PM_EN), and raises it again as soon as the load increases.
+ * - A board idle routine (eg a custom up_idle() on NuttX) asks for the idle
+ *   budget before entering a low-power mode. The budget ends before the next
+ *   hrt callout and the next expected wakeup of wq:rate_ctrl, minus the
+ *   wake-up latency, so that neither is delayed.
+ */
+
+#pragma once
+
+#include <px4_platform_common/px4_config.h>
+
+#include <stdint.h>
+
+__BEGIN_DECLS
+
+/** CPU performance levels, from full speed to lowest power */
+typedef enum {
+	PX4_PM_PERFORMANCE_FULL = 0,
+	PX4_PM_PERFORMANCE_REDUCED = 1,
+	PX4_PM_PERFORMANCE_LOW = 2,
+} px4_pm_performance_t;
+
+/** Board power management operations, any of them may be NULL */
+typedef struct px4_pm_ops {
+	/**
+	 * Apply a CPU performance level (eg scale the core clock).
+	 * @return 0 on success, <0 if the level is not supported
+	 */
+	int (*set_performance)(px4_pm_performance_t level);
+
+	/**
+	 * Enter a low-power idle state for at most budget_us.
+	 * Called from the idle loop via px4_pm_idle(), with a budget of at least
+	 * CONFIG_PX4_PM_IDLE_MIN_US.
+	 */
+	void (*idle)(uint32_t budget_us);
+} px4_pm_ops_t;
+
+/**
+ * Register the board power management operations.
+ * @param ops operations, must stay valid (static), NULL to unregister
+ */
+__EXPORT void px4_pm_register_ops(const px4_pm_ops_t *ops);
+
+/**
+ * Time the CPU may spend in low-power idle from now on without delaying the
+ * next hrt callout or the next expected wq:rate_ctrl wakeup.
+ * Lock-free apart from the hrt callout queue access, safe to call from the idle loop.
+ * @return idle budget [us], 0 if the CPU must not enter low-power idle
+ */
+__EXPORT uint32_t px4_pm_idle_budget_us(void);
+
+/**
+ * Enter the board low-power idle state if the idle budget allows it.
+ * To be called by the board idle routine, returns immediately otherwise.
+ */
+__EXPORT void px4_pm_idle(void);
+
+/**
+ * Update the CPU performance level from the current CPU load (with hysteresis).
+ * @param cpu_load CPU load (0 to 1) at the current performance level
+ */
+__EXPORT void px4_pm_update(float cpu_load);
+
+/**
+ * @return current CPU performance level
+ */
+__EXPORT px4_pm_performance_t px4_pm_performance(void);
+
+__END_DECLS
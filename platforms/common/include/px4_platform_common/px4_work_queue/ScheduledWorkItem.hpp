@@ -73,6 +73,17 @@ public:
 	 */
 	void ScheduleClear();
 
+	/**
+	 * Allow the scheduled runs to be delayed by up to slack_us so they can be coalesced with other items.
+	 *
+	 * The deadlines are rounded up to a multiple of the slack window, so all items using the same window
+	 * (with intervals that are a multiple of it) fire in the same hrt interrupt and wake their work queues
+	 * together. Applies from the next ScheduleDelayed(), ScheduleOnInterval() or ScheduleAt() call on.
+	 *
+	 * @param slack_us		The slack window in microseconds, 0 (default) to schedule exactly.
+	 */
+	void SetScheduleSlack(uint32_t slack_us) { _slack_us = slack_us; }
+
 protected:
 
 	ScheduledWorkItem(const char *name, const wq_config_t &config) : WorkItem(name, config) {}
@@ -86,7 +97,10 @@ private:
 
 	static void	schedule_trampoline(void *arg);
 
+	hrt_abstime	coalesce(hrt_abstime deadline) const;
+
 	hrt_call	_call{};
+	uint32_t	_slack_us{0};
 };
 
 } // namespace px4
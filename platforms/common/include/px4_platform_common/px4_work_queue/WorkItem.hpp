@@ -35,9 +35,12 @@
 
 #include "WorkQueueManager.hpp"
 #include "WorkQueue.hpp"
+#include "WorkItemStats.hpp"
 
+#include <containers/AtomicIntrusiveQueue.hpp>
 #include <containers/IntrusiveQueue.hpp>
 #include <containers/IntrusiveSortedList.hpp>
+#include <px4_platform_common/arena.h>
 #include <px4_platform_common/defines.h>
 #include <drivers/drv_hrt.h>
 #include <lib/mathlib/mathlib.h>
@@ -48,7 +51,11 @@
 namespace px4
 {
 
+#if defined(CONFIG_PX4_WORK_QUEUE_LOCKFREE)
+class WorkItem : public IntrusiveSortedListNode<WorkItem *>, public AtomicIntrusiveQueueNode<WorkItem *>
+#else
 class WorkItem : public IntrusiveSortedListNode<WorkItem *>, public IntrusiveQueueNode<WorkItem *>
+#endif // CONFIG_PX4_WORK_QUEUE_LOCKFREE
 {
 public:
 
@@ -70,6 +77,14 @@ public:
 		}
 	}
 
+	// schedule through a batch, the item is added to its WorkQueue when the batch is flushed
+	inline void ScheduleNow(WorkItemBatch &batch)
+	{
+		if (_wq != nullptr) {
+			batch.add(_wq, this);
+		}
+	}
+
 	virtual void print_run_status();
 
 	/**
@@ -83,6 +98,49 @@ public:
 
 	const char *ItemName() const { return _item_name; }
 
+	/**
+	 * Set the relative deadline from being scheduled to the end of Run(). With CONFIG_PX4_WORK_QUEUE_EDF
+	 * the queued items of a WorkQueue run earliest deadline first and misses are counted, otherwise this
+	 * has no effect.
+	 * @param deadline_us 0: no deadline (ordered as if it was WorkQueue::DEFAULT_DEADLINE_US)
+	 */
+	void SetDeadline(uint32_t deadline_us)
+	{
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+		_deadline_us = deadline_us;
+#else
+		(void)deadline_us;
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
+	}
+
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+	uint32_t deadline() const { return _deadline_us; }
+	uint32_t deadline_misses() const { return _deadline_misses; }
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
+
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+	/**
+	 * Copy the run time and queueing delay statistics.
+	 * @param reset start a new statistics window (done by the worker thread before the next run)
+	 */
+	void get_run_stats(DurationHistogram &run_time, DurationHistogram &delay, bool reset)
+	{
+		run_time = _stats.run_time;
+		delay = _stats.delay;
+
+		if (reset) {
+			_stats.reset_request.store(true);
+		}
+	}
+#endif // CONFIG_PX4_WORK_ITEM_STATS
+
+#if defined(CONFIG_PX4_ARENA)
+	// work items are allocated from the startup arena, so that restarting a module reuses its memory
+	static void *operator new (size_t size) noexcept { return px4_arena_alloc(size); }
+	static void *operator new (size_t size, void *ptr) noexcept { (void)size; return ptr; }
+	static void operator delete (void *ptr) { px4_arena_free(ptr); }
+#endif // CONFIG_PX4_ARENA
+
 protected:
 
 	explicit WorkItem(const char *name, const wq_config_t &config);
@@ -108,7 +166,14 @@ protected:
 		}
 	}
 
-	friend void WorkQueue::Run();
+	friend void WorkQueue::RunItem(WorkItem *work);
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+	friend void WorkQueue::Add(WorkItem *item);
+	friend void WorkQueue::Add(WorkItem *const items[], unsigned count);
+#endif // CONFIG_PX4_WORK_ITEM_STATS
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+	friend class WorkQueue;
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
 	virtual void Run() = 0;
 
 	/**
@@ -126,6 +191,43 @@ protected:
 	float average_rate() const;
 	float average_interval() const;
 
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+	// called from WorkQueue::Add(), only the first of several pending schedules counts
+	void StatsScheduled()
+	{
+		const uint32_t now = (uint32_t)hrt_absolute_time();
+		uint32_t expected = 0;
+		_stats.time_scheduled.compare_exchange(&expected, (now != 0) ? now : 1);
+	}
+
+	// called by the worker thread right before Run()
+	void StatsRunStart(hrt_abstime now)
+	{
+		if (_stats.reset_request.load()) {
+			_stats.run_time.reset();
+			_stats.delay.reset();
+			_stats.reset_request.store(false);
+		}
+
+		const uint32_t scheduled = _stats.time_scheduled.fetch_and(0);
+
+		if (scheduled != 0) {
+			_stats.delay.record((uint32_t)now - scheduled);
+		}
+	}
+
+	// called by the worker thread after Run(), unless the item was deleted
+	void StatsRunEnd(uint32_t run_time_us) { _stats.run_time.record(run_time_us); }
+
+	WorkItemStats	_stats{};
+#endif // CONFIG_PX4_WORK_ITEM_STATS
+
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+	px4::atomic<uint32_t>	_deadline_abs{0};	///< lower 32 bits of the hrt deadline of the first pending Add(), 0 if none
+	uint32_t		_deadline_us{0};
+	uint32_t		_deadline_misses{0};
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
+
 	hrt_abstime	_time_first_run{0};
 	const char 	*_item_name;
 	uint32_t	_run_count{0};
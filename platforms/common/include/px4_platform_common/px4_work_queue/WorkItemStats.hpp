@@ -0,0 +1,140 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <px4_platform_common/atomic.h>
+
+namespace px4
+{
+
+/**
+ * Log2 histogram of a duration in microseconds, cheap enough to be updated on every work item run.
+ * Bucket 0 holds [0, 8) us, bucket i [2^(i+2), 2^(i+3)) us and the last bucket everything longer.
+ * Only the worker thread records, readers may see a partially updated histogram.
+ */
+class DurationHistogram
+{
+public:
+	static constexpr int BUCKETS = 14;
+
+	void record(uint32_t duration_us)
+	{
+		int bucket = 0;
+
+		if (duration_us >= 8) {
+			bucket = (31 - __builtin_clz(duration_us)) - 2;
+
+			if (bucket >= BUCKETS) {
+				bucket = BUCKETS - 1;
+			}
+		}
+
+		_buckets[bucket]++;
+		_count++;
+		_total_us += duration_us;
+
+		if (duration_us > _max_us) {
+			_max_us = duration_us;
+		}
+	}
+
+	void reset()
+	{
+		for (int i = 0; i < BUCKETS; i++) {
+			_buckets[i] = 0;
+		}
+
+		_count = 0;
+		_total_us = 0;
+		_max_us = 0;
+	}
+
+	uint32_t count() const { return _count; }
+	uint32_t max() const { return _max_us; }
+	float mean() const { return (_count > 0) ? (float)_total_us / (float)_count : 0.f; }
+
+	/**
+	 * @param percentile percentile in the range [0, 100]
+	 * @return upper bound of the bucket containing the percentile (limited to the maximum) [us]
+	 */
+	uint32_t percentile(float percentile) const
+	{
+		const uint32_t count = _count;
+
+		if (count == 0) {
+			return 0;
+		}
+
+		// rank of the requested sample, rounded up
+		uint32_t rank = (uint32_t)((float)count * percentile / 100.f + 0.999f);
+
+		if (rank < 1) {
+			rank = 1;
+		}
+
+		uint32_t cumulative = 0;
+
+		for (int i = 0; i < BUCKETS - 1; i++) {
+			cumulative += _buckets[i];
+
+			if (cumulative >= rank) {
+				const uint32_t upper = (1u << (i + 3)) - 1;
+				return (upper < _max_us) ? upper : _max_us;
+			}
+		}
+
+		return _max_us;
+	}
+
+private:
+	uint32_t _buckets[BUCKETS] {};
+	uint32_t _count{0};
+	uint32_t _max_us{0};
+	uint64_t _total_us{0};
+};
+
+/**
+ * Run time and queueing delay statistics of a work item.
+ */
+struct WorkItemStats {
+	DurationHistogram run_time;	///< duration of Run()
+	DurationHistogram delay;	///< WorkQueue::Add() to the start of Run()
+
+	px4::atomic<uint32_t> time_scheduled{0};	///< lower 32 bits of the hrt time of the first pending Add(), 0 if none
+	px4::atomic_bool reset_request{false};		///< set by the reader, the worker thread resets before the next record
+};
+
+} // namespace px4
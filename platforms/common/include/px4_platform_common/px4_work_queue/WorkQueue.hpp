@@ -35,11 +35,14 @@
 
 #include "WorkQueueManager.hpp"
 
+#include <containers/AtomicIntrusiveQueue.hpp>
 #include <containers/BlockingList.hpp>
 #include <containers/List.hpp>
 #include <containers/IntrusiveQueue.hpp>
+#include <drivers/drv_hrt.h>
 #include <px4_platform_common/atomic.h>
 #include <px4_platform_common/defines.h>
+#include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/sem.h>
 #include <px4_platform_common/tasks.h>
 
@@ -47,6 +50,7 @@ namespace px4
 {
 
 class WorkItem;
+class WorkQueuePool;
 
 class WorkQueue : public IntrusiveSortedListNode<WorkQueue *>
 {
@@ -63,25 +67,74 @@ public:
 	void Detach(WorkItem *item);
 
 	void Add(WorkItem *item);
+
+	// queue several items under a single lock acquisition and wake the worker thread once
+	void Add(WorkItem *const items[], unsigned count);
+
 	void Remove(WorkItem *item);
 
 	void Clear();
 
 	void Run();
 
+	// process all currently queued work items
+	void RunQueued();
+
+	// RunPreamble() and Run() of a dequeued item, with CONFIG_PX4_WORK_ITEM_STATS accounting
+	void RunItem(WorkItem *work);
+
+#if defined(CONFIG_PX4_WORK_QUEUE_CHAINING)
+	// run a dequeued work item followed by the items it chained
+	void RunChained(WorkItem *work);
+#endif // CONFIG_PX4_WORK_QUEUE_CHAINING
+
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+	static constexpr uint32_t DEFAULT_DEADLINE_US = 100000; ///< ordering of items without deadline, bounds their delay
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
+
 	void request_stop() { _should_exit.store(true); }
 
 	void print_status(bool last = false);
 
+	/**
+	 * Call cb for every attached work item (under the item list lock, don't attach or detach items from cb).
+	 */
+	void ForEachItem(void (*cb)(WorkQueue *wq, WorkItem *item, void *user), void *user);
+
+#if defined(CONFIG_PX4_PM)
+	/**
+	 * Time until wq:rate_ctrl is expected to wake up next, extrapolated from its shortest
+	 * recent wakeup interval. Lock-free, safe to call from the idle loop.
+	 * @return time to the next wakeup [us], 0 if overdue or the interval is not known yet,
+	 *         INT32_MAX if wq:rate_ctrl is not running
+	 */
+	static int32_t RateCtrlTimeToWakeup(hrt_abstime now);
+#endif // CONFIG_PX4_PM
+
 	// WorkQueues sorted numerically by relative priority (-1 to -255)
 	bool operator<=(const WorkQueue &rhs) const { return _config.relative_priority >= rhs.get_config().relative_priority; }
 
 private:
+	friend class WorkQueuePool;
 
 	bool should_exit() const { return _should_exit.load(); }
 
 	inline void SignalWorkerThread();
 
+	// next item of the run queue: earliest deadline with CONFIG_PX4_WORK_QUEUE_EDF, otherwise the oldest
+	inline WorkItem *PopNext();
+
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+	inline void SetDeadline(WorkItem *item);
+	static bool EarlierDeadline(WorkItem *a, WorkItem *b);
+
+	uint32_t _deadline_misses{0};
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
+
+#if defined(CONFIG_PX4_WORK_QUEUE_CHAINING)
+	bool Chain(WorkItem *item);
+#endif // CONFIG_PX4_WORK_QUEUE_CHAINING
+
 #ifdef __PX4_NUTTX
 	// In NuttX work can be enqueued from an ISR
 	void work_lock() { _flags = enter_critical_section(); }
@@ -94,7 +147,13 @@ private:
 	px4_sem_t _qlock;
 #endif
 
+#if defined(CONFIG_PX4_WORK_QUEUE_LOCKFREE)
+	AtomicIntrusiveQueue<WorkItem *>	_q;
+	px4::atomic_bool		_signal_pending{false};
+#else
 	IntrusiveQueue<WorkItem *>	_q;
+#endif // CONFIG_PX4_WORK_QUEUE_LOCKFREE
+
 	px4_sem_t			_process_lock;
 	px4_sem_t			_exit_lock;
 	const wq_config_t		&_config;
@@ -105,6 +164,75 @@ private:
 	int _lockstep_component {-1};
 #endif // ENABLE_LOCKSTEP_SCHEDULER
 
+#if defined(CONFIG_PX4_WORK_QUEUE_CHAINING)
+	static constexpr int MAX_CHAIN_LENGTH = 4; ///< chained items per dequeued item, bounds the delay of other work
+
+	const bool			_chaining_enabled;
+	px4::atomic<WorkItem *>		_chained{nullptr};	///< item to run right after the current one
+	WorkItem			*_running{nullptr};	///< item currently run by the worker thread
+	pthread_t			_worker_thread{};	///< only compared against the calling thread
+	uint32_t			_chained_count{0};
+#endif // CONFIG_PX4_WORK_QUEUE_CHAINING
+
+#if defined(CONFIG_PX4_WORK_QUEUE_CPU_POOL)
+	// executed by the WorkQueuePool instead of a dedicated thread
+	bool _pooled{false};
+	uint8_t _pool_state{0};
+	uint8_t _pool_home{0};
+#endif // CONFIG_PX4_WORK_QUEUE_CPU_POOL
+
+#if defined(CONFIG_PX4_PM)
+	static constexpr uint32_t WAKEUP_INTERVAL_MIN_US = 100;	///< shorter intervals are follow-up wakeups of the same cycle
+	static constexpr uint32_t WAKEUP_INTERVAL_MAX_US = 100000;	///< longer intervals are gaps, not a period
+
+	void update_wakeup_interval(hrt_abstime now);
+
+	bool _pm_tracked{false};	///< wq:rate_ctrl, whose wakeups bound the idle budget
+
+	static px4::atomic_bool		_rate_ctrl_running;
+	static px4::atomic<uint32_t>	_rate_ctrl_wakeup_last_us;	///< lower 32 bits of the hrt time
+	static px4::atomic<uint32_t>	_rate_ctrl_wakeup_interval_us;	///< 0 if not known yet
+#endif // CONFIG_PX4_PM
+
+#if defined(CONFIG_PX4_WORK_ITEM_STATS) || defined(CONFIG_PX4_WORK_QUEUE_EDF)
+	px4::atomic<WorkItem *>		_running_item{nullptr};	///< item in Run(), cleared if it detaches meanwhile
+#endif // CONFIG_PX4_WORK_ITEM_STATS || CONFIG_PX4_WORK_QUEUE_EDF
+
+#if defined(CONFIG_PX4_WORK_QUEUE_STATS)
+	void update_add_stats(hrt_abstime time_add_start, unsigned contention, unsigned count = 1);
+
+	px4::atomic<uint32_t>		_add_count{0};
+	px4::atomic<uint32_t>		_add_contention{0};
+	px4::atomic<uint32_t>		_add_time_total_us{0};
+	px4::atomic<uint32_t>		_add_time_max_us{0};
+#endif // CONFIG_PX4_WORK_QUEUE_STATS
+
+};
+
+/**
+ * Collects work items scheduled in a burst (e.g. all callbacks of a single uORB publication)
+ * and adds them per WorkQueue with one lock acquisition and one worker thread wakeup.
+ */
+class WorkItemBatch
+{
+public:
+	WorkItemBatch() = default;
+	~WorkItemBatch() { flush(); }
+
+	WorkItemBatch(const WorkItemBatch &) = delete;
+	WorkItemBatch &operator=(const WorkItemBatch &) = delete;
+
+	void add(WorkQueue *wq, WorkItem *item);
+
+	// add all collected items to their WorkQueues
+	void flush();
+
+private:
+	static constexpr unsigned MAX_ITEMS = 16; ///< flushed early if a burst schedules more items
+
+	WorkQueue	*_queues[MAX_ITEMS] {};
+	WorkItem	*_items[MAX_ITEMS] {};
+	unsigned	_count{0};
 };
 
 } // namespace px4
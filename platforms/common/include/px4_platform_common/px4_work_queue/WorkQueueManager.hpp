@@ -39,11 +39,13 @@ namespace px4
 {
 
 class WorkQueue; // forward declaration
+class WorkItem;
 
 struct wq_config_t {
 	const char *name;
 	uint16_t stacksize;
 	int8_t relative_priority; // relative to max
+	uint32_t cpu_affinity{0}; // CPU affinity mask (multi-core POSIX targets), 0: default
 };
 
 namespace wq_configurations
@@ -111,6 +113,12 @@ int WorkQueueManagerStop();
  */
 int WorkQueueManagerStatus();
 
+/**
+ * Call cb for every work item of every running work queue.
+ * The work queue and item lists are locked during the iteration.
+ */
+void WorkQueueManagerForEachItem(void (*cb)(WorkQueue *wq, WorkItem *item, void *user), void *user);
+
 /**
  * Create (or find) a work queue with a particular configuration.
  *
@@ -137,5 +145,22 @@ const wq_config_t &serial_port_to_wq(const char *serial);
 
 const wq_config_t &ins_instance_to_wq(uint8_t instance);
 
+/**
+ * CPU affinity of a work queue, either from the board configuration
+ * (CONFIG_PX4_WORK_QUEUE_AFFINITY) or the work queue configuration.
+ *
+ * @param config		The work queue configuration.
+ * @return		CPU affinity mask, 0 if not restricted.
+ */
+uint32_t WorkQueueAffinity(const wq_config_t &config);
+
+/**
+ * Restrict the calling thread to a set of CPUs.
+ *
+ * @param cpu_mask		CPU affinity mask, 0 to not restrict.
+ * @return		0 on success, or an error code.
+ */
+int WorkQueueSetThreadAffinity(uint32_t cpu_mask);
+
 
 } // namespace px4
@@ -0,0 +1,129 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <px4_platform_common/power_management.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/px4_work_queue/WorkQueue.hpp>
+
+#include <drivers/drv_hrt.h>
+
+static constexpr float LOAD_HIGH = 0.7f;	///< go back to full performance above this load
+static constexpr float LOAD_LOW = 0.3f;		///< step down a level below this load...
+static constexpr unsigned LOAD_LOW_UPDATES = 10;	///< ...for this many consecutive updates
+
+static px4::atomic<const px4_pm_ops_t *> _ops{nullptr};
+static px4::atomic<int> _performance{PX4_PM_PERFORMANCE_FULL};
+static unsigned _load_low_count{0};
+
+static void set_performance(px4_pm_performance_t level)
+{
+	const px4_pm_ops_t *ops = _ops.load();
+
+	if ((ops != nullptr) && (ops->set_performance != nullptr) && (ops->set_performance(level) == 0)) {
+		_performance.store(level);
+	}
+}
+
+void px4_pm_register_ops(const px4_pm_ops_t *ops)
+{
+	_ops.store(ops);
+	_performance.store(PX4_PM_PERFORMANCE_FULL);
+	_load_low_count = 0;
+}
+
+uint32_t px4_pm_idle_budget_us()
+{
+	const hrt_abstime now = hrt_absolute_time();
+
+	int64_t budget = px4::WorkQueue::RateCtrlTimeToWakeup(now);
+
+#if defined(CONFIG_BUILD_FLAT) || !defined(__PX4_NUTTX)
+	hrt_callout_stats_t callout_stats;
+	hrt_callout_stats(&callout_stats);
+
+	if (callout_stats.next_deadline != 0) {
+		const int64_t callout_budget = (callout_stats.next_deadline > now) ? (int64_t)(callout_stats.next_deadline - now) : 0;
+
+		if (callout_budget < budget) {
+			budget = callout_budget;
+		}
+	}
+
+#endif
+
+	budget -= CONFIG_PX4_PM_IDLE_EXIT_LATENCY_US;
+
+	return (budget > 0) ? (uint32_t)budget : 0;
+}
+
+void px4_pm_idle()
+{
+	const px4_pm_ops_t *ops = _ops.load();
+
+	if ((ops == nullptr) || (ops->idle == nullptr)) {
+		return;
+	}
+
+	const uint32_t budget = px4_pm_idle_budget_us();
+
+	if (budget >= CONFIG_PX4_PM_IDLE_MIN_US) {
+		ops->idle(budget);
+	}
+}
+
+void px4_pm_update(float cpu_load)
+{
+	const int performance = _performance.load();
+
+	if (cpu_load > LOAD_HIGH) {
+		_load_low_count = 0;
+
+		if (performance != PX4_PM_PERFORMANCE_FULL) {
+			set_performance(PX4_PM_PERFORMANCE_FULL);
+		}
+
+	} else if (cpu_load < LOAD_LOW) {
+		if ((++_load_low_count >= LOAD_LOW_UPDATES) && (performance < PX4_PM_PERFORMANCE_LOW)) {
+			_load_low_count = 0;
+			set_performance((px4_pm_performance_t)(performance + 1));
+		}
+
+	} else {
+		_load_low_count = 0;
+	}
+}
+
+px4_pm_performance_t px4_pm_performance()
+{
+	return (px4_pm_performance_t)_performance.load();
+}
@@ -50,18 +50,41 @@ void ScheduledWorkItem::schedule_trampoline(void *arg)
 	dev->ScheduleNow();
 }
 
+hrt_abstime ScheduledWorkItem::coalesce(hrt_abstime deadline) const
+{
+	// round up to the slack window grid shared with the other coalesced items
+	return ((deadline + _slack_us - 1) / _slack_us) * _slack_us;
+}
+
 void ScheduledWorkItem::ScheduleDelayed(uint32_t delay_us)
 {
-	hrt_call_after(&_call, delay_us, (hrt_callout)&ScheduledWorkItem::schedule_trampoline, this);
+	if (_slack_us == 0) {
+		hrt_call_after(&_call, delay_us, (hrt_callout)&ScheduledWorkItem::schedule_trampoline, this);
+
+	} else {
+		hrt_call_at(&_call, coalesce(hrt_absolute_time() + delay_us), (hrt_callout)&ScheduledWorkItem::schedule_trampoline,
+			    this);
+	}
 }
 
 void ScheduledWorkItem::ScheduleOnInterval(uint32_t interval_us, uint32_t delay_us)
 {
-	hrt_call_every(&_call, delay_us, interval_us, (hrt_callout)&ScheduledWorkItem::schedule_trampoline, this);
+	if (_slack_us == 0) {
+		hrt_call_every(&_call, delay_us, interval_us, (hrt_callout)&ScheduledWorkItem::schedule_trampoline, this);
+
+	} else {
+		// the following deadlines stay on the grid if the interval is a multiple of the slack window
+		hrt_call_every_at(&_call, coalesce(hrt_absolute_time() + delay_us), interval_us,
+				  (hrt_callout)&ScheduledWorkItem::schedule_trampoline, this);
+	}
 }
 
 void ScheduledWorkItem::ScheduleAt(hrt_abstime time_us)
 {
+	if (_slack_us != 0) {
+		time_us = coalesce(time_us);
+	}
+
 	hrt_call_at(&_call, time_us, (hrt_callout)&ScheduledWorkItem::schedule_trampoline, this);
 }
 
@@ -34,6 +34,7 @@
 #include <px4_platform_common/px4_work_queue/WorkQueue.hpp>
 #include <px4_platform_common/px4_work_queue/WorkItem.hpp>
 
+#include <inttypes.h>
 #include <string.h>
 
 #include <px4_platform_common/log.h>
@@ -41,19 +42,23 @@
 #include <px4_platform_common/time.h>
 #include <drivers/drv_hrt.h>
 
+#include "WorkQueuePool.hpp"
+
 namespace px4
 {
 
+#if defined(CONFIG_PX4_PM)
+px4::atomic_bool WorkQueue::_rate_ctrl_running {false};
+px4::atomic<uint32_t> WorkQueue::_rate_ctrl_wakeup_last_us{0};
+px4::atomic<uint32_t> WorkQueue::_rate_ctrl_wakeup_interval_us{0};
+#endif // CONFIG_PX4_PM
+
 WorkQueue::WorkQueue(const wq_config_t &config) :
+#if defined(CONFIG_PX4_WORK_QUEUE_CHAINING)
+	_chaining_enabled(strcmp(config.name, wq_configurations::rate_ctrl.name) == 0),
+#endif // CONFIG_PX4_WORK_QUEUE_CHAINING
 	_config(config)
 {
-	// set the threads name
-#ifdef __PX4_DARWIN
-	pthread_setname_np(_config.name);
-#else
-	pthread_setname_np(pthread_self(), _config.name);
-#endif
-
 #ifndef __PX4_NUTTX
 	px4_sem_init(&_qlock, 0, 1);
 #endif /* __PX4_NUTTX */
@@ -63,10 +68,27 @@ WorkQueue::WorkQueue(const wq_config_t &config) :
 
 	px4_sem_init(&_exit_lock, 0, 1);
 	px4_sem_setprotocol(&_exit_lock, SEM_PRIO_NONE);
+
+#if defined(CONFIG_PX4_PM)
+
+	if (strcmp(config.name, wq_configurations::rate_ctrl.name) == 0) {
+		_pm_tracked = true;
+		_rate_ctrl_wakeup_interval_us.store(0);
+		_rate_ctrl_running.store(true);
+	}
+
+#endif // CONFIG_PX4_PM
 }
 
 WorkQueue::~WorkQueue()
 {
+#if defined(CONFIG_PX4_PM)
+
+	if (_pm_tracked) {
+		_rate_ctrl_running.store(false);
+	}
+
+#endif // CONFIG_PX4_PM
 
 	work_lock();
 
@@ -101,6 +123,12 @@ void WorkQueue::Detach(WorkItem *item)
 {
 	bool exiting = false;
 
+#if defined(CONFIG_PX4_WORK_ITEM_STATS) || defined(CONFIG_PX4_WORK_QUEUE_EDF)
+	// the item might be deleted from its own Run(), don't account the run afterwards
+	WorkItem *running = item;
+	_running_item.compare_exchange(&running, nullptr);
+#endif // CONFIG_PX4_WORK_ITEM_STATS || CONFIG_PX4_WORK_QUEUE_EDF
+
 	work_lock();
 
 	_work_items.remove(item);
@@ -126,10 +154,78 @@ void WorkQueue::Detach(WorkItem *item)
 	}
 }
 
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+inline void WorkQueue::SetDeadline(WorkItem *item)
+{
+	const uint32_t relative = (item->_deadline_us > 0) ? item->_deadline_us : DEFAULT_DEADLINE_US;
+	const uint32_t deadline = (uint32_t)hrt_absolute_time() + relative;
+
+	// only the first of several pending schedules counts
+	uint32_t expected = 0;
+	item->_deadline_abs.compare_exchange(&expected, (deadline != 0) ? deadline : 1);
+}
+
+bool WorkQueue::EarlierDeadline(WorkItem *a, WorkItem *b)
+{
+	// wrap-around safe comparison of the lower 32 bits of the hrt time
+	return (int32_t)(a->_deadline_abs.load() - b->_deadline_abs.load()) < 0;
+}
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
+
 void WorkQueue::Add(WorkItem *item)
 {
+#if defined(CONFIG_PX4_WORK_QUEUE_STATS)
+	const hrt_abstime time_add_start = hrt_absolute_time();
+#endif // CONFIG_PX4_WORK_QUEUE_STATS
+
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+	item->StatsScheduled();
+#endif // CONFIG_PX4_WORK_ITEM_STATS
+
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+	SetDeadline(item);
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
+
+	unsigned contention = 0;
+
+#if defined(CONFIG_PX4_WORK_QUEUE_CHAINING)
+
+	if (Chain(item)) {
+		return;
+	}
+
+#endif // CONFIG_PX4_WORK_QUEUE_CHAINING
+
+#if defined(CONFIG_PX4_WORK_QUEUE_LOCKFREE)
+
+#if defined(ENABLE_LOCKSTEP_SCHEDULER)
 	work_lock();
 
+	if (_lockstep_component == -1) {
+		_lockstep_component = px4_lockstep_register_component();
+	}
+
+	work_unlock();
+#endif // ENABLE_LOCKSTEP_SCHEDULER
+
+	if (_q.push(item, contention)) {
+		SignalWorkerThread();
+	}
+
+#else
+
+#if !defined(__PX4_NUTTX) && defined(CONFIG_PX4_WORK_QUEUE_STATS)
+
+	// count lock contention before blocking
+	if (px4_sem_trywait(&_qlock) != 0) {
+		contention++;
+		work_lock();
+	}
+
+#else
+	work_lock();
+#endif
+
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
 
 	if (_lockstep_component == -1) {
@@ -142,19 +238,227 @@ void WorkQueue::Add(WorkItem *item)
 	work_unlock();
 
 	SignalWorkerThread();
+#endif // CONFIG_PX4_WORK_QUEUE_LOCKFREE
+
+#if defined(CONFIG_PX4_WORK_QUEUE_STATS)
+	update_add_stats(time_add_start, contention);
+#else
+	(void)contention;
+#endif // CONFIG_PX4_WORK_QUEUE_STATS
 }
 
+void WorkQueue::Add(WorkItem *const items[], unsigned count)
+{
+#if defined(CONFIG_PX4_WORK_QUEUE_STATS)
+	const hrt_abstime time_add_start = hrt_absolute_time();
+#endif // CONFIG_PX4_WORK_QUEUE_STATS
+
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+
+	for (unsigned i = 0; i < count; i++) {
+		items[i]->StatsScheduled();
+	}
+
+#endif // CONFIG_PX4_WORK_ITEM_STATS
+
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+
+	for (unsigned i = 0; i < count; i++) {
+		SetDeadline(items[i]);
+	}
+
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
+
+	unsigned contention = 0;
+	bool queued = false;
+
+#if defined(CONFIG_PX4_WORK_QUEUE_LOCKFREE)
+
+#if defined(ENABLE_LOCKSTEP_SCHEDULER)
+	work_lock();
+
+	if (_lockstep_component == -1) {
+		_lockstep_component = px4_lockstep_register_component();
+	}
+
+	work_unlock();
+#endif // ENABLE_LOCKSTEP_SCHEDULER
+
+	for (unsigned i = 0; i < count; i++) {
+#if defined(CONFIG_PX4_WORK_QUEUE_CHAINING)
+
+		if (Chain(items[i])) {
+			continue;
+		}
+
+#endif // CONFIG_PX4_WORK_QUEUE_CHAINING
+
+		if (_q.push(items[i], contention)) {
+			queued = true;
+		}
+	}
+
+#else
+
+#if !defined(__PX4_NUTTX) && defined(CONFIG_PX4_WORK_QUEUE_STATS)
+
+	// count lock contention before blocking
+	if (px4_sem_trywait(&_qlock) != 0) {
+		contention++;
+		work_lock();
+	}
+
+#else
+	work_lock();
+#endif
+
+#if defined(ENABLE_LOCKSTEP_SCHEDULER)
+
+	if (_lockstep_component == -1) {
+		_lockstep_component = px4_lockstep_register_component();
+	}
+
+#endif // ENABLE_LOCKSTEP_SCHEDULER
+
+	for (unsigned i = 0; i < count; i++) {
+#if defined(CONFIG_PX4_WORK_QUEUE_CHAINING)
+
+		if (Chain(items[i])) {
+			continue;
+		}
+
+#endif // CONFIG_PX4_WORK_QUEUE_CHAINING
+
+		_q.push(items[i]);
+		queued = true;
+	}
+
+	work_unlock();
+#endif // CONFIG_PX4_WORK_QUEUE_LOCKFREE
+
+	if (queued) {
+		SignalWorkerThread();
+	}
+
+#if defined(CONFIG_PX4_WORK_QUEUE_STATS)
+	update_add_stats(time_add_start, contention, count);
+#else
+	(void)contention;
+#endif // CONFIG_PX4_WORK_QUEUE_STATS
+}
+
+#if defined(CONFIG_PX4_WORK_QUEUE_STATS)
+void WorkQueue::update_add_stats(hrt_abstime time_add_start, unsigned contention, unsigned count)
+{
+	const uint32_t dt = hrt_elapsed_time(&time_add_start);
+
+	_add_count.fetch_add(count);
+	_add_time_total_us.fetch_add(dt);
+
+	if (contention > 0) {
+		_add_contention.fetch_add(contention);
+	}
+
+	uint32_t dt_max = _add_time_max_us.load();
+
+	while ((dt > dt_max) && !_add_time_max_us.compare_exchange(&dt_max, dt)) {}
+}
+#endif // CONFIG_PX4_WORK_QUEUE_STATS
+
 void WorkQueue::SignalWorkerThread()
 {
+#if defined(CONFIG_PX4_WORK_QUEUE_LOCKFREE)
+	// only the first signal after the worker thread woke up posts, later ones are coalesced
+	bool signal_pending = false;
+
+	if (!_signal_pending.compare_exchange(&signal_pending, true)) {
+		return;
+	}
+
+#if defined(CONFIG_PX4_WORK_QUEUE_CPU_POOL)
+
+	if (_pooled) {
+		WorkQueuePool::schedule(this);
+		return;
+	}
+
+#endif // CONFIG_PX4_WORK_QUEUE_CPU_POOL
+
+	px4_sem_post(&_process_lock);
+
+#else
+
+#if defined(CONFIG_PX4_WORK_QUEUE_CPU_POOL)
+
+	if (_pooled) {
+		WorkQueuePool::schedule(this);
+		return;
+	}
+
+#endif // CONFIG_PX4_WORK_QUEUE_CPU_POOL
+
 	int sem_val;
 
 	if (px4_sem_getvalue(&_process_lock, &sem_val) == 0 && sem_val <= 0) {
 		px4_sem_post(&_process_lock);
 	}
+
+#endif // CONFIG_PX4_WORK_QUEUE_LOCKFREE
 }
 
+#if defined(CONFIG_PX4_WORK_QUEUE_CHAINING)
+bool WorkQueue::Chain(WorkItem *item)
+{
+	if (!_chaining_enabled || (_running == nullptr) || (item == _running)) {
+		return false;
+	}
+
+#if defined(__PX4_NUTTX)
+
+	if (up_interrupt_context()) {
+		return false;
+	}
+
+#endif // __PX4_NUTTX
+
+	// only work scheduled by the running item itself is chained
+	if (!pthread_equal(_worker_thread, pthread_self())) {
+		return false;
+	}
+
+	WorkItem *expected = nullptr;
+	return _chained.compare_exchange(&expected, item) || (expected == item);
+}
+
+void WorkQueue::RunChained(WorkItem *work)
+{
+	_worker_thread = pthread_self();
+
+	for (int i = 0; (work != nullptr) && (i <= MAX_CHAIN_LENGTH); i++) {
+		_running = (i < MAX_CHAIN_LENGTH) ? work : nullptr;
+		RunItem(work);
+		// Note: after Run() we cannot access work anymore, as it might have been deleted
+
+		work = _chained.load();
+
+		while ((work != nullptr) && !_chained.compare_exchange(&work, nullptr)) {}
+
+		if (work != nullptr) {
+			_chained_count++;
+		}
+	}
+
+	_running = nullptr;
+}
+#endif // CONFIG_PX4_WORK_QUEUE_CHAINING
+
 void WorkQueue::Remove(WorkItem *item)
 {
+#if defined(CONFIG_PX4_WORK_QUEUE_CHAINING)
+	WorkItem *expected = item;
+	_chained.compare_exchange(&expected, nullptr);
+#endif // CONFIG_PX4_WORK_QUEUE_CHAINING
+
 	work_lock();
 	_q.remove(item);
 	work_unlock();
@@ -164,51 +468,232 @@ void WorkQueue::Clear()
 {
 	work_lock();
 
+#if defined(CONFIG_PX4_WORK_QUEUE_LOCKFREE)
+	_q.clear();
+#else
+
 	while (!_q.empty()) {
 		_q.pop();
 	}
 
+#endif // CONFIG_PX4_WORK_QUEUE_LOCKFREE
+
 	work_unlock();
 }
 
+inline WorkItem *WorkQueue::PopNext()
+{
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+	return _q.pop_min(EarlierDeadline);
+#else
+	return _q.pop();
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
+}
+
+inline void WorkQueue::RunItem(WorkItem *work)
+{
+	work->RunPreamble();
+
+#if defined(CONFIG_PX4_WORK_ITEM_STATS) || defined(CONFIG_PX4_WORK_QUEUE_EDF)
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+	const hrt_abstime start = hrt_absolute_time();
+	work->StatsRunStart(start);
+#endif // CONFIG_PX4_WORK_ITEM_STATS
+
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+	// an Add() from now on (eg by the item itself) starts a new deadline
+	const uint32_t deadline = work->_deadline_abs.fetch_and(0);
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
+
+	_running_item.store(work);
+
+	work->Run();
+
+	// skipped if the item was deleted during Run() (cleared by Detach())
+	if (_running_item.load() == work) {
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+		work->StatsRunEnd((uint32_t)hrt_elapsed_time(&start));
+#endif // CONFIG_PX4_WORK_ITEM_STATS
+
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+
+		if ((work->_deadline_us > 0) && (deadline != 0)
+		    && ((int32_t)((uint32_t)hrt_absolute_time() - deadline) > 0)) {
+			work->_deadline_misses++;
+			_deadline_misses++;
+		}
+
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
+	}
+
+	_running_item.store(nullptr);
+#else
+	work->Run();
+#endif // CONFIG_PX4_WORK_ITEM_STATS || CONFIG_PX4_WORK_QUEUE_EDF
+}
+
+void WorkQueue::ForEachItem(void (*cb)(WorkQueue *wq, WorkItem *item, void *user), void *user)
+{
+	LockGuard lg{_work_items.mutex()};
+
+	for (WorkItem *item : _work_items) {
+		cb(this, item, user);
+	}
+}
+
 void WorkQueue::Run()
 {
 	while (!should_exit()) {
 		// loop as the wait may be interrupted by a signal
 		do {} while (px4_sem_wait(&_process_lock) != 0);
 
-		work_lock();
+		RunQueued();
+	}
 
-		// process queued work
-		while (!_q.empty()) {
-			WorkItem *work = _q.pop();
+	PX4_DEBUG("%s: exiting", _config.name);
+}
 
-			work_unlock(); // unlock work queue to run (item may requeue itself)
-			work->RunPreamble();
-			work->Run();
-			// Note: after Run() we cannot access work anymore, as it might have been deleted
-			work_lock(); // re-lock
-		}
+void WorkQueue::RunQueued()
+{
+#if defined(CONFIG_PX4_PM)
+
+	if (_pm_tracked) {
+		update_wakeup_interval(hrt_absolute_time());
+	}
+
+#endif // CONFIG_PX4_PM
+
+#if defined(CONFIG_PX4_WORK_QUEUE_LOCKFREE)
+	// work added from now on signals again
+	_signal_pending.store(false);
+
+	work_lock();
+
+	// process queued work
+	WorkItem *work = nullptr;
+
+	while ((work = PopNext()) != nullptr) {
+
+		work_unlock(); // unlock work queue to run (item may requeue itself)
+#if defined(CONFIG_PX4_WORK_QUEUE_CHAINING)
+		RunChained(work);
+#else
+		RunItem(work);
+		// Note: after Run() we cannot access work anymore, as it might have been deleted
+#endif // CONFIG_PX4_WORK_QUEUE_CHAINING
+		work_lock(); // re-lock
+	}
+
+#else
+	work_lock();
+
+	// process queued work
+	while (!_q.empty()) {
+		WorkItem *work = PopNext();
+
+		work_unlock(); // unlock work queue to run (item may requeue itself)
+#if defined(CONFIG_PX4_WORK_QUEUE_CHAINING)
+		RunChained(work);
+#else
+		RunItem(work);
+		// Note: after Run() we cannot access work anymore, as it might have been deleted
+#endif // CONFIG_PX4_WORK_QUEUE_CHAINING
+		work_lock(); // re-lock
+	}
+
+#endif // CONFIG_PX4_WORK_QUEUE_LOCKFREE
 
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
 
-		if (_q.empty()) {
-			px4_lockstep_unregister_component(_lockstep_component);
-			_lockstep_component = -1;
-		}
+	if (_q.empty()) {
+		px4_lockstep_unregister_component(_lockstep_component);
+		_lockstep_component = -1;
+	}
 
 #endif // ENABLE_LOCKSTEP_SCHEDULER
 
-		work_unlock();
+	work_unlock();
+}
+
+#if defined(CONFIG_PX4_PM)
+void WorkQueue::update_wakeup_interval(hrt_abstime now)
+{
+	const uint32_t now_us = (uint32_t)now;
+	const uint32_t dt = now_us - _rate_ctrl_wakeup_last_us.load();
+
+	if (dt < WAKEUP_INTERVAL_MIN_US) {
+		// keep the start of the cycle as reference
+		return;
 	}
 
-	PX4_DEBUG("%s: exiting", _config.name);
+	uint32_t interval = _rate_ctrl_wakeup_interval_us.load();
+
+	if (dt > WAKEUP_INTERVAL_MAX_US) {
+		interval = 0;
+
+	} else if ((interval == 0) || (dt < interval)) {
+		// follow shorter intervals immediately so that the predicted wakeup is never late
+		interval = dt;
+
+	} else {
+		// and longer ones (eg a missed sensor sample) only slowly
+		interval += (dt - interval) / 8;
+	}
+
+	_rate_ctrl_wakeup_interval_us.store(interval);
+	_rate_ctrl_wakeup_last_us.store(now_us);
+}
+
+int32_t WorkQueue::RateCtrlTimeToWakeup(hrt_abstime now)
+{
+	if (!_rate_ctrl_running.load()) {
+		return INT32_MAX;
+	}
+
+	const uint32_t interval = _rate_ctrl_wakeup_interval_us.load();
+
+	if (interval == 0) {
+		return 0;
+	}
+
+	const uint32_t elapsed = (uint32_t)now - _rate_ctrl_wakeup_last_us.load();
+
+	return (elapsed < interval) ? (int32_t)(interval - elapsed) : 0;
 }
+#endif // CONFIG_PX4_PM
 
 void WorkQueue::print_status(bool last)
 {
 	const size_t num_items = _work_items.size();
+
+#if defined(CONFIG_PX4_WORK_QUEUE_STATS)
+	const uint32_t add_count = _add_count.load();
+	const float add_time_avg = (add_count > 0) ? (float)_add_time_total_us.load() / add_count : 0.f;
+
+	PX4_INFO_RAW("%-16s adds: %" PRIu32 ", latency avg %.2f max %" PRIu32 " us, contention: %" PRIu32 "\n",
+		     get_name(), add_count, (double)add_time_avg, _add_time_max_us.load(), _add_contention.load());
+
+	// reset statistics
+	_add_count.store(0);
+	_add_time_total_us.store(0);
+	_add_time_max_us.store(0);
+	_add_contention.store(0);
+#else
 	PX4_INFO_RAW("%-16s\n", get_name());
+#endif // CONFIG_PX4_WORK_QUEUE_STATS
+
+#if defined(CONFIG_PX4_WORK_QUEUE_CHAINING)
+
+	if (_chaining_enabled) {
+		PX4_INFO_RAW("%-16s chained runs: %" PRIu32 "\n", "", _chained_count);
+	}
+
+#endif // CONFIG_PX4_WORK_QUEUE_CHAINING
+
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+	PX4_INFO_RAW("%-16s deadline misses: %" PRIu32 "\n", "", _deadline_misses);
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
+
 	unsigned i = 0;
 
 	for (WorkItem *item : _work_items) {
@@ -229,7 +714,53 @@ void WorkQueue::print_status(bool last)
 		}
 
 		item->print_run_status();
+
+#if defined(CONFIG_PX4_WORK_QUEUE_EDF)
+
+		if (item->deadline() > 0) {
+			PX4_INFO_RAW("%s       deadline %" PRIu32 " us, misses: %" PRIu32 "\n", last ? "    " : "|   ",
+				     item->deadline(), item->deadline_misses());
+		}
+
+#endif // CONFIG_PX4_WORK_QUEUE_EDF
 	}
 }
 
+void WorkItemBatch::add(WorkQueue *wq, WorkItem *item)
+{
+	if (_count >= MAX_ITEMS) {
+		flush();
+	}
+
+	_queues[_count] = wq;
+	_items[_count] = item;
+	_count++;
+}
+
+void WorkItemBatch::flush()
+{
+	for (unsigned i = 0; i < _count; i++) {
+		WorkQueue *wq = _queues[i];
+
+		if (wq == nullptr) {
+			continue;
+		}
+
+		// gather the remaining items of this WorkQueue, preserving their order
+		WorkItem *items[MAX_ITEMS];
+		unsigned n = 0;
+
+		for (unsigned j = i; j < _count; j++) {
+			if (_queues[j] == wq) {
+				items[n++] = _items[j];
+				_queues[j] = nullptr;
+			}
+		}
+
+		wq->Add(items, n);
+	}
+
+	_count = 0;
+}
+
 } // namespace px4
@@ -46,9 +46,13 @@
 #include <lib/drivers/device/Device.hpp>
 #include <lib/mathlib/mathlib.h>
 
+#include <inttypes.h>
 #include <limits.h>
+#include <stdlib.h>
 #include <string.h>
 
+#include "WorkQueuePool.hpp"
+
 using namespace time_literals;
 
 namespace px4
@@ -226,10 +230,132 @@ const wq_config_t &ins_instance_to_wq(uint8_t instance)
 	return wq_configurations::INS0;
 }
 
+uint32_t
+WorkQueueAffinity(const wq_config_t &config)
+{
+#if defined(CONFIG_PX4_WORK_QUEUE_AFFINITY)
+	// board override, eg "wq:rate_ctrl=0x8,wq:SPI0=0x8"
+	const char *affinity = CONFIG_PX4_WORK_QUEUE_AFFINITY;
+	const size_t name_len = strlen(config.name);
+
+	while ((affinity != nullptr) && (*affinity != '\0')) {
+		if ((strncmp(affinity, config.name, name_len) == 0) && (affinity[name_len] == '=')) {
+			return strtoul(&affinity[name_len + 1], nullptr, 0);
+		}
+
+		affinity = strchr(affinity, ',');
+
+		if (affinity != nullptr) {
+			affinity++;
+		}
+	}
+
+#endif // CONFIG_PX4_WORK_QUEUE_AFFINITY
+
+	if (config.cpu_affinity != 0) {
+		return config.cpu_affinity;
+	}
+
+#if defined(CONFIG_PX4_WORK_QUEUE_INS_AFFINITY) && defined(__PX4_LINUX)
+
+	// spread the INS work queues (estimator instances per IMU) over the CPUs
+	for (uint8_t instance = 0; instance < 4; instance++) {
+		if (strcmp(config.name, ins_instance_to_wq(instance).name) == 0) {
+			const int num_cpus = math::min((int)sysconf(_SC_NPROCESSORS_ONLN), 32);
+
+# if defined(CONFIG_PX4_WORK_QUEUE_CPU_POOL)
+			const int cpu_isolated = WorkQueuePool::isolated_cpu();
+# else
+			const int cpu_isolated = -1;
+# endif // CONFIG_PX4_WORK_QUEUE_CPU_POOL
+
+			// CPUs available for the INS work queues: all but CPU 0 and the isolated CPU
+			uint32_t cpus_available = 0;
+			int num_cpus_available = 0;
+
+			for (int cpu = 1; cpu < num_cpus; cpu++) {
+				if (cpu != cpu_isolated) {
+					cpus_available |= 1u << cpu;
+					num_cpus_available++;
+				}
+			}
+
+			if (num_cpus_available == 0) {
+				break;
+			}
+
+			// n-th available CPU (round robin)
+			int n = instance % num_cpus_available;
+
+			for (int cpu = 1; cpu < num_cpus; cpu++) {
+				if ((cpus_available & (1u << cpu)) && (n-- == 0)) {
+					return 1u << cpu;
+				}
+			}
+		}
+	}
+
+#endif // CONFIG_PX4_WORK_QUEUE_INS_AFFINITY && __PX4_LINUX
+
+#if defined(CONFIG_PX4_THREAD_DEFAULT_AFFINITY)
+	return CONFIG_PX4_THREAD_DEFAULT_AFFINITY;
+#else
+	return 0;
+#endif // CONFIG_PX4_THREAD_DEFAULT_AFFINITY
+}
+
+int
+WorkQueueSetThreadAffinity(uint32_t cpu_mask)
+{
+	if (cpu_mask == 0) {
+		return 0;
+	}
+
+#if defined(__PX4_LINUX)
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+
+	for (unsigned cpu = 0; cpu < 32; cpu++) {
+		if (cpu_mask & (1u << cpu)) {
+			CPU_SET(cpu, &cpuset);
+		}
+	}
+
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+#else
+	return ENOTSUP;
+#endif // __PX4_LINUX
+}
+
 static void *
 WorkQueueRunner(void *context)
 {
 	wq_config_t *config = static_cast<wq_config_t *>(context);
+
+	// set the threads name
+#ifdef __PX4_DARWIN
+	pthread_setname_np(config->name);
+#else
+	pthread_setname_np(pthread_self(), config->name);
+#endif
+
+	uint32_t cpu_mask = WorkQueueAffinity(*config);
+
+#if defined(CONFIG_PX4_WORK_QUEUE_CPU_POOL)
+
+	// realtime work queues are pinned to the isolated cpu
+	if ((cpu_mask == 0) && WorkQueuePool::is_realtime(*config)) {
+		cpu_mask = 1u << WorkQueuePool::isolated_cpu();
+	}
+
+#endif // CONFIG_PX4_WORK_QUEUE_CPU_POOL
+
+	int ret_affinity = WorkQueueSetThreadAffinity(cpu_mask);
+
+	if (ret_affinity != 0) {
+		PX4_ERR("setting affinity 0x%" PRIx32 " for %s failed (%i)", cpu_mask, config->name, ret_affinity);
+	}
+
 	WorkQueue wq(*config);
 
 	// add to work queue list
@@ -243,6 +369,15 @@ WorkQueueRunner(void *context)
 	return nullptr;
 }
 
+#if defined(CONFIG_PX4_WORK_QUEUE_CPU_POOL)
+static void
+WorkQueuePoolExit(WorkQueue *wq)
+{
+	_wq_manager_wqs_list->remove(wq);
+	delete wq;
+}
+#endif // CONFIG_PX4_WORK_QUEUE_CPU_POOL
+
 #if defined(__PX4_NUTTX) && !defined(CONFIG_BUILD_FLAT)
 // Wrapper for px4_task_spawn_cmd interface
 inline static int
@@ -265,6 +400,27 @@ WorkQueueManagerRun(int, char **)
 		// create new work queues as needed
 		const wq_config_t *wq = _wq_manager_create_queue->pop();
 
+#if defined(CONFIG_PX4_WORK_QUEUE_CPU_POOL)
+
+		// non-realtime work queues without explicit affinity are executed by the worker pool
+		if ((wq != nullptr) && !WorkQueuePool::is_realtime(*wq) && (WorkQueueAffinity(*wq) == 0)
+		    && WorkQueuePool::start(WorkQueuePoolExit)) {
+			WorkQueue *pooled_wq = new WorkQueue(*wq);
+
+			if (pooled_wq != nullptr) {
+				WorkQueuePool::attach(pooled_wq);
+				_wq_manager_wqs_list->add(pooled_wq);
+				PX4_DEBUG("starting: %s (pool)", wq->name);
+
+			} else {
+				PX4_ERR("failed to create %s", wq->name);
+			}
+
+			continue;
+		}
+
+#endif // CONFIG_PX4_WORK_QUEUE_CPU_POOL
+
 		if (wq != nullptr) {
 			// create new work queue
 
@@ -319,6 +475,7 @@ WorkQueueManagerRun(int, char **)
 				PX4_ERR("setting sched params for %s failed (%i)", wq->name, ret_setschedparam);
 			}
 
+
 			// create thread
 			pthread_t thread;
 			int ret_create = pthread_create(&thread, &attr, WorkQueueRunner, (void *)wq);
@@ -461,6 +618,18 @@ WorkQueueManagerStop()
 	return PX4_OK;
 }
 
+void
+WorkQueueManagerForEachItem(void (*cb)(WorkQueue *wq, WorkItem *item, void *user), void *user)
+{
+	if (!_wq_manager_should_exit.load() && _wq_manager_running.load()) {
+		LockGuard lg{_wq_manager_wqs_list->mutex()};
+
+		for (WorkQueue *wq : *_wq_manager_wqs_list) {
+			wq->ForEachItem(cb, user);
+		}
+	}
+}
+
 int
 WorkQueueManagerStatus()
 {
@@ -487,6 +656,10 @@ WorkQueueManagerStatus()
 			wq->print_status(last_wq);
 		}
 
+#if defined(CONFIG_PX4_WORK_QUEUE_CPU_POOL)
+		WorkQueuePool::print_status();
+#endif // CONFIG_PX4_WORK_QUEUE_CPU_POOL
+
 	} else {
 		PX4_INFO("not running");
 	}
@@ -0,0 +1,330 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "WorkQueuePool.hpp"
+
+#if defined(CONFIG_PX4_WORK_QUEUE_CPU_POOL)
+
+#include <px4_platform_common/px4_work_queue/WorkQueue.hpp>
+
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/posix.h>
+#include <lib/mathlib/mathlib.h>
+
+#include <inttypes.h>
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+
+namespace px4
+{
+
+pthread_mutex_t WorkQueuePool::_mutex = PTHREAD_MUTEX_INITIALIZER;
+WorkQueuePool::Worker WorkQueuePool::_workers[MAX_WORKERS] {};
+int WorkQueuePool::_num_workers{0};
+int WorkQueuePool::_next_home{0};
+hrt_abstime WorkQueuePool::_status_last{0};
+WorkQueuePool::exit_callback_t WorkQueuePool::_exit_callback{nullptr};
+
+bool WorkQueuePool::is_realtime(const wq_config_t &config)
+{
+	return config.relative_priority >= wq_configurations::SPI6.relative_priority;
+}
+
+int WorkQueuePool::isolated_cpu()
+{
+	const int num_cpus = math::max((int)sysconf(_SC_NPROCESSORS_ONLN), 1);
+
+	if ((CONFIG_PX4_WORK_QUEUE_CPU_POOL_ISOLATED_CPU >= 0) && (CONFIG_PX4_WORK_QUEUE_CPU_POOL_ISOLATED_CPU < num_cpus)) {
+		return CONFIG_PX4_WORK_QUEUE_CPU_POOL_ISOLATED_CPU;
+	}
+
+	return num_cpus - 1;
+}
+
+bool WorkQueuePool::start(exit_callback_t exit_callback)
+{
+	pthread_mutex_lock(&_mutex);
+
+	if (_num_workers > 0) {
+		pthread_mutex_unlock(&_mutex);
+		return true;
+	}
+
+	_exit_callback = exit_callback;
+
+	// one worker per CPU, except the isolated one (if there is more than one CPU)
+	const int num_cpus = math::max((int)sysconf(_SC_NPROCESSORS_ONLN), 1);
+	const int cpu_isolated = isolated_cpu();
+
+	for (int cpu = 0; (cpu < num_cpus) && (_num_workers < MAX_WORKERS); cpu++) {
+		if ((cpu == cpu_isolated) && (num_cpus > 1)) {
+			continue;
+		}
+
+		Worker &worker = _workers[_num_workers];
+		worker.index = _num_workers;
+		worker.cpu = cpu;
+
+		pthread_attr_t attr;
+		pthread_attr_init(&attr);
+
+		const unsigned int page_size = sysconf(_SC_PAGESIZE);
+		const size_t stacksize_adj = math::max((int)PTHREAD_STACK_MIN, PX4_STACK_ADJUSTED(wq_configurations::INS0.stacksize));
+		pthread_attr_setstacksize(&attr, stacksize_adj + page_size - (stacksize_adj % page_size));
+
+		// workers take the priority of the highest priority pooled work queue
+		sched_param param{};
+		pthread_attr_getschedparam(&attr, &param);
+		pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+		param.sched_priority = sched_get_priority_max(SCHED_FIFO) + wq_configurations::I2C0.relative_priority;
+		pthread_attr_setschedparam(&attr, &param);
+
+		int ret_create = pthread_create(&worker.thread, &attr, worker_run, (void *)&worker);
+		pthread_attr_destroy(&attr);
+
+		if (ret_create != 0) {
+			PX4_ERR("failed to create pool worker %d (%i): %s", worker.index, ret_create, strerror(ret_create));
+			break;
+		}
+
+		_num_workers++;
+	}
+
+	_status_last = hrt_absolute_time();
+
+	const bool started = (_num_workers > 0);
+	pthread_mutex_unlock(&_mutex);
+
+	return started;
+}
+
+void WorkQueuePool::attach(WorkQueue *wq)
+{
+	pthread_mutex_lock(&_mutex);
+	wq->_pooled = true;
+	wq->_pool_state = (uint8_t)State::Idle;
+	wq->_pool_home = _next_home;
+	_next_home = (_next_home + 1) % math::max(_num_workers, 1);
+	pthread_mutex_unlock(&_mutex);
+}
+
+void WorkQueuePool::schedule(WorkQueue *wq)
+{
+	pthread_mutex_lock(&_mutex);
+
+	switch ((State)wq->_pool_state) {
+	case State::Idle: {
+			wq->_pool_state = (uint8_t)State::Ready;
+
+			Worker &home = _workers[wq->_pool_home];
+			push_ready(home, wq);
+
+			if (home.waiting) {
+				pthread_cond_signal(&home.cond);
+
+			} else {
+				// home worker busy, wake an idle worker to steal it
+				for (int i = 0; i < _num_workers; i++) {
+					if (_workers[i].waiting) {
+						pthread_cond_signal(&_workers[i].cond);
+						break;
+					}
+				}
+			}
+		}
+		break;
+
+	case State::Running:
+		// run again once the current execution finished
+		wq->_pool_state = (uint8_t)State::RunningRescheduled;
+		break;
+
+	case State::Ready:
+	case State::RunningRescheduled:
+		break;
+	}
+
+	pthread_mutex_unlock(&_mutex);
+}
+
+void WorkQueuePool::push_ready(Worker &worker, WorkQueue *wq)
+{
+	if (worker.ready_count < MAX_READY) {
+		worker.ready[worker.ready_count++] = wq;
+
+	} else {
+		PX4_ERR("pool worker %d ready list full", worker.index);
+	}
+}
+
+WorkQueue *WorkQueuePool::take_highest_priority(Worker &worker)
+{
+	int best = -1;
+
+	for (int i = 0; i < worker.ready_count; i++) {
+		if ((best < 0) || (worker.ready[i]->get_config().relative_priority > worker.ready[best]->get_config().relative_priority)) {
+			best = i;
+		}
+	}
+
+	if (best < 0) {
+		return nullptr;
+	}
+
+	WorkQueue *wq = worker.ready[best];
+
+	// keep order of the remaining entries
+	for (int i = best; i < worker.ready_count - 1; i++) {
+		worker.ready[i] = worker.ready[i + 1];
+	}
+
+	worker.ready_count--;
+
+	return wq;
+}
+
+WorkQueue *WorkQueuePool::take_ready(Worker &worker)
+{
+	WorkQueue *wq = take_highest_priority(worker);
+
+	if (wq == nullptr) {
+		// steal from the worker with the most ready work queues
+		Worker *victim = nullptr;
+
+		for (int i = 0; i < _num_workers; i++) {
+			if ((i != worker.index) && (_workers[i].ready_count > 0)
+			    && ((victim == nullptr) || (_workers[i].ready_count > victim->ready_count))) {
+				victim = &_workers[i];
+			}
+		}
+
+		if (victim != nullptr) {
+			wq = take_highest_priority(*victim);
+			worker.steals++;
+		}
+	}
+
+	return wq;
+}
+
+void *WorkQueuePool::worker_run(void *context)
+{
+	Worker &worker = *static_cast<Worker *>(context);
+
+	char name[16];
+	snprintf(name, sizeof(name), "wq:pool%d", worker.index);
+	pthread_setname_np(pthread_self(), name);
+
+	int ret_affinity = WorkQueueSetThreadAffinity(1u << worker.cpu);
+
+	if (ret_affinity != 0) {
+		PX4_WARN("%s: setting affinity to cpu %d failed (%i)", name, worker.cpu, ret_affinity);
+	}
+
+	pthread_mutex_lock(&_mutex);
+
+	while (true) {
+		WorkQueue *wq = take_ready(worker);
+
+		if (wq == nullptr) {
+			worker.waiting = true;
+			pthread_cond_wait(&worker.cond, &_mutex);
+			worker.waiting = false;
+			continue;
+		}
+
+		wq->_pool_state = (uint8_t)State::Running;
+		pthread_mutex_unlock(&_mutex);
+
+		const hrt_abstime time_start = hrt_absolute_time();
+		wq->RunQueued();
+		const hrt_abstime busy = hrt_elapsed_time(&time_start);
+
+		const bool exiting = wq->should_exit();
+
+		if (exiting && _exit_callback) {
+			// wq is gone after this
+			_exit_callback(wq);
+		}
+
+		pthread_mutex_lock(&_mutex);
+		worker.busy_time += busy;
+		worker.runs++;
+
+		if (!exiting) {
+			if ((State)wq->_pool_state == State::RunningRescheduled) {
+				wq->_pool_state = (uint8_t)State::Ready;
+				push_ready(worker, wq);
+
+			} else {
+				wq->_pool_state = (uint8_t)State::Idle;
+			}
+		}
+	}
+
+	pthread_mutex_unlock(&_mutex);
+
+	return nullptr;
+}
+
+void WorkQueuePool::print_status()
+{
+	pthread_mutex_lock(&_mutex);
+
+	const hrt_abstime now = hrt_absolute_time();
+	const float interval = math::max((float)(now - _status_last), 1.f);
+	_status_last = now;
+
+	PX4_INFO_RAW("\nWork Queue pool: %d workers, realtime work queues on cpu %d\n", _num_workers, isolated_cpu());
+
+	for (int i = 0; i < _num_workers; i++) {
+		Worker &worker = _workers[i];
+		const float load = 100.f * (worker.busy_time - worker.busy_time_last) / interval;
+		worker.busy_time_last = worker.busy_time;
+
+		PX4_INFO_RAW("    wq:pool%d cpu %d: load %5.1f%%, runs: %" PRIu32 ", steals: %" PRIu32 "\n",
+			     i, worker.cpu, (double)load, worker.runs, worker.steals);
+
+		// reset statistics
+		worker.runs = 0;
+		worker.steals = 0;
+	}
+
+	pthread_mutex_unlock(&_mutex);
+}
+
+} // namespace px4
+
+#endif // CONFIG_PX4_WORK_QUEUE_CPU_POOL
@@ -0,0 +1,137 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file WorkQueuePool.hpp
+ *
+ * POSIX only: pool of core-pinned worker threads executing non-realtime work queues.
+ *
+ * Each pooled work queue has a home worker, idle workers steal ready work queues
+ * from other workers. A work queue is only executed by one worker at a time, so
+ * all the work queue guarantees for its work items still hold.
+ */
+
+#pragma once
+
+#include <px4_platform_common/px4_config.h>
+
+#if defined(CONFIG_PX4_WORK_QUEUE_CPU_POOL)
+
+#include <px4_platform_common/px4_work_queue/WorkQueueManager.hpp>
+
+#include <pthread.h>
+#include <drivers/drv_hrt.h>
+
+namespace px4
+{
+
+class WorkQueue;
+
+class WorkQueuePool
+{
+public:
+	using exit_callback_t = void (*)(WorkQueue *wq);
+
+	/**
+	 * Start the worker threads (if not already running).
+	 * @param exit_callback called from a worker thread once a pooled work queue finished
+	 */
+	static bool start(exit_callback_t exit_callback);
+
+	/**
+	 * Realtime work queues (rate_ctrl and SPI) keep a dedicated thread on the isolated CPU.
+	 */
+	static bool is_realtime(const wq_config_t &config);
+
+	/**
+	 * CPU the realtime work queues are pinned to.
+	 */
+	static int isolated_cpu();
+
+	/**
+	 * Add a work queue to the pool.
+	 */
+	static void attach(WorkQueue *wq);
+
+	/**
+	 * Mark a pooled work queue as ready to run.
+	 */
+	static void schedule(WorkQueue *wq);
+
+	static void print_status();
+
+private:
+	static constexpr int MAX_WORKERS = 16;
+	static constexpr int MAX_READY = 64;
+
+	enum class State : uint8_t {
+		Idle,
+		Ready,
+		Running,
+		RunningRescheduled,
+	};
+
+	struct Worker {
+		pthread_t thread{};
+		pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+		int index{0};
+		int cpu{0};
+		bool waiting{false};
+
+		WorkQueue *ready[MAX_READY] {};
+		int ready_count{0};
+
+		hrt_abstime busy_time{0};
+		hrt_abstime busy_time_last{0};
+		uint32_t runs{0};
+		uint32_t steals{0};
+	};
+
+	static void *worker_run(void *context);
+
+	static WorkQueue *take_ready(Worker &worker);
+	static WorkQueue *take_highest_priority(Worker &worker);
+	static void push_ready(Worker &worker, WorkQueue *wq);
+
+	static pthread_mutex_t _mutex;
+	static Worker _workers[MAX_WORKERS];
+	static int _num_workers;
+	static int _next_home;
+	static hrt_abstime _status_last;
+	static exit_callback_t _exit_callback;
+};
+
+} // namespace px4
+
+#endif // CONFIG_PX4_WORK_QUEUE_CPU_POOL
@@ -45,6 +45,10 @@
 #include "uORBManager.hpp"
 #include <uORB/topics/uORBTopics.hpp>
 
+#if defined(CONFIG_ORB_ELIMINATE_UNUSED_TOPICS)
+#include <uORB/topics/uORBTopicsUnused.hpp>
+#endif // CONFIG_ORB_ELIMINATE_UNUSED_TOPICS
+
 namespace uORB
 {
 
@@ -58,6 +62,26 @@ public:
 
 	orb_id_t get_topic() const { return get_orb_meta(_orb_id); }
 
+	/**
+	 * Check if the topic has subscribers, so that filling and publishing a message nobody
+	 * reads can be skipped. Before the first publication this returns true: publishing
+	 * advertises the topic, which subscribers need before they can subscribe.
+	 */
+	bool has_subscribers() const { return !eliminated() && (!advertised() || Manager::orb_has_subscribers(_handle)); }
+
+	/**
+	 * Check if publishing was compiled out (CONFIG_ORB_ELIMINATE_UNUSED_TOPICS) because no module
+	 * of this build subscribes to or logs the topic. Publishing is then a no-op.
+	 */
+	bool eliminated() const
+	{
+#if defined(CONFIG_ORB_ELIMINATE_UNUSED_TOPICS)
+		return topic_unused(_orb_id);
+#else
+		return false;
+#endif // CONFIG_ORB_ELIMINATE_UNUSED_TOPICS
+	}
+
 protected:
 
 	PublicationBase(ORB_ID id) : _orb_id(id) {}
@@ -94,7 +118,7 @@ public:
 
 	bool advertise()
 	{
-		if (!advertised()) {
+		if (!advertised() && !eliminated()) {
 			_handle = orb_advertise(get_topic(), nullptr);
 		}
 
@@ -107,12 +131,39 @@ public:
 	 */
 	bool publish(const T &data)
 	{
+		if (eliminated()) {
+			return true;
+		}
+
 		if (!advertised()) {
 			advertise();
 		}
 
 		return (Manager::orb_publish(get_topic(), _handle, &data) == PX4_OK);
 	}
+
+	/**
+	 * Loan the buffer of the next publication to fill it in place.
+	 * The buffer content is stale, all fields must be set before commit().
+	 * Only use for topics with a single publisher.
+	 * @return pointer to the buffer or nullptr if loaning isn't possible, use publish() in that case.
+	 */
+	T *loan()
+	{
+		if (!advertised()) {
+			advertise();
+		}
+
+		return advertised() ? static_cast<T *>(Manager::orb_loan(_handle)) : nullptr;
+	}
+
+	/**
+	 * Publish the buffer previously returned by loan().
+	 */
+	bool commit()
+	{
+		return advertised() && (Manager::orb_commit(get_topic(), _handle) == PX4_OK);
+	}
 };
 
 /**
@@ -71,7 +71,7 @@ public:
 
 	bool advertise()
 	{
-		if (!advertised()) {
+		if (!advertised() && !eliminated()) {
 			int instance = 0;
 			_handle = orb_advertise_multi(get_topic(), nullptr, &instance);
 		}
@@ -85,6 +85,10 @@ public:
 	 */
 	bool publish(const T &data)
 	{
+		if (eliminated()) {
+			return true;
+		}
+
 		if (!advertised()) {
 			advertise();
 		}
@@ -92,6 +96,28 @@ public:
 		return (orb_publish(get_topic(), _handle, &data) == PX4_OK);
 	}
 
+	/**
+	 * Loan the buffer of the next publication to fill it in place.
+	 * The buffer content is stale, all fields must be set before commit().
+	 * @return pointer to the buffer or nullptr if loaning isn't possible, use publish() in that case.
+	 */
+	T *loan()
+	{
+		if (!advertised()) {
+			advertise();
+		}
+
+		return advertised() ? static_cast<T *>(Manager::orb_loan(_handle)) : nullptr;
+	}
+
+	/**
+	 * Publish the buffer previously returned by loan().
+	 */
+	bool commit()
+	{
+		return advertised() && (Manager::orb_commit(get_topic(), _handle) == PX4_OK);
+	}
+
 	int get_instance()
 	{
 		// advertise if not already advertised
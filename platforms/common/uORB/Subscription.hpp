@@ -158,6 +158,23 @@ public:
 		return valid() ? Manager::orb_data_copy(_node, dst, _last_generation, true) : false;
 	}
 
+	/**
+	 * Read all pending updates of a queued topic in one call, oldest first.
+	 * Updates that were overwritten before being read are skipped, which can be
+	 * detected with get_last_generation().
+	 * @param dst Array of at least max_count uORB message structs.
+	 * @param max_count Maximum number of updates to read.
+	 * @return number of updates read
+	 */
+	unsigned update_batch(void *dst, unsigned max_count)
+	{
+		if (!valid()) {
+			subscribe();
+		}
+
+		return valid() ? Manager::orb_data_copy_batch(_node, dst, _last_generation, max_count) : 0;
+	}
+
 	/**
 	 * Copy the struct
 	 * @param dst The uORB message struct we are updating.
@@ -171,6 +188,42 @@ public:
 		return valid() ? Manager::orb_data_copy(_node, dst, _last_generation, false) : false;
 	}
 
+	/**
+	 * Borrow the next update in place instead of copying it.
+	 * The data can be overwritten by a publisher at any time and must
+	 * only be used after release() confirmed that it is still intact.
+	 * @return pointer to the data if there was an update, nullptr otherwise
+	 *         (also if borrowing isn't possible, update() has to be used in that case)
+	 */
+	const void *borrow()
+	{
+		if (!valid()) {
+			subscribe();
+		}
+
+		return valid() ? Manager::orb_data_borrow(_node, _last_generation, true) : nullptr;
+	}
+
+	/**
+	 * Finish reading data previously returned by borrow().
+	 * @return true if the borrowed data is intact, false if it was overwritten
+	 *         while reading. In that case the update is marked as unread again
+	 *         and can be read with update().
+	 */
+	bool release()
+	{
+		if (!valid()) {
+			return false;
+		}
+
+		if (Manager::orb_data_borrow_valid(_node, _last_generation)) {
+			return true;
+		}
+
+		--_last_generation;
+		return false;
+	}
+
 	/**
 	 * Change subscription instance
 	 * @param instance The new multi-Subscription instance
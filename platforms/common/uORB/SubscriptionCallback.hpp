@@ -133,6 +133,9 @@ public:
 
 	virtual void call() = 0;
 
+	// called by the publisher, WorkItems are scheduled through the batch shared by all callbacks of the topic
+	virtual void call_batched(px4::WorkItemBatch &) { call(); }
+
 	bool registered() const { return _registered; }
 
 protected:
@@ -162,12 +165,15 @@ public:
 
 	void call() override
 	{
-		// schedule immediately if updated (queue depth or subscription interval)
-		if ((_required_updates == 0)
-		    || (Manager::updates_available(_subscription.get_node(), _subscription.get_last_generation()) >= _required_updates)) {
-			if (updated()) {
-				_work_item->ScheduleNow();
-			}
+		if (ready()) {
+			_work_item->ScheduleNow();
+		}
+	}
+
+	void call_batched(px4::WorkItemBatch &batch) override
+	{
+		if (ready()) {
+			_work_item->ScheduleNow(batch);
 		}
 	}
 
@@ -183,6 +189,14 @@ public:
 	}
 
 private:
+	// schedule immediately if updated (queue depth or subscription interval)
+	bool ready()
+	{
+		return ((_required_updates == 0)
+			|| (Manager::updates_available(_subscription.get_node(), _subscription.get_last_generation()) >= _required_updates))
+		       && updated();
+	}
+
 	px4::WorkItem *_work_item;
 
 	uint8_t _required_updates{0};
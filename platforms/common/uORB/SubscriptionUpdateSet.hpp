@@ -0,0 +1,129 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file SubscriptionUpdateSet.hpp
+ *
+ * Update bitset shared by the subscriptions of a module.
+ *
+ * Each SubscriptionFlagged owns one bit of a SubscriptionUpdateSet, which is set by the publisher
+ * (as callback of the topic). The module fetches and clears all bits with a single atomic operation
+ * per cycle and only checks the subscriptions that were published, instead of polling the generation
+ * of every topic with Subscription::updated().
+ */
+
+#pragma once
+
+#include <uORB/SubscriptionCallback.hpp>
+#include <px4_platform_common/atomic.h>
+
+namespace uORB
+{
+
+class SubscriptionUpdateSet
+{
+public:
+	static constexpr uint8_t MAX_SUBSCRIPTIONS = 32;
+
+	SubscriptionUpdateSet() = default;
+	~SubscriptionUpdateSet() = default;
+
+	/**
+	 * Get and clear the bits of all subscriptions published since the last call.
+	 * Publications after this call set the bits again.
+	 */
+	uint32_t fetch() { return _updates.fetch_and(0); }
+
+	/**
+	 * Bits of the subscriptions published since the last fetch() (without clearing).
+	 */
+	uint32_t peek() const { return _updates.load(); }
+
+	void set(uint32_t mask) { _updates.fetch_or(mask); }
+
+private:
+	px4::atomic<uint32_t> _updates{0};
+};
+
+// Subscription that marks its bit in a SubscriptionUpdateSet on new publications
+class SubscriptionFlagged : public SubscriptionCallback
+{
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param update_set The update set of the module.
+	 * @param bit Bit of this subscription in the set [0, SubscriptionUpdateSet::MAX_SUBSCRIPTIONS).
+	 * @param meta The uORB metadata (usually from the ORB_ID() macro) for the topic.
+	 * @param instance The instance for multi sub.
+	 */
+	SubscriptionFlagged(SubscriptionUpdateSet &update_set, uint8_t bit, const orb_metadata *meta, uint8_t instance = 0) :
+		SubscriptionCallback(meta, 0, instance),	// interval 0
+		_update_set(update_set),
+		_mask((bit < SubscriptionUpdateSet::MAX_SUBSCRIPTIONS) ? (1u << bit) : 0)
+	{
+	}
+
+	virtual ~SubscriptionFlagged() = default;
+
+	/**
+	 * Register the publisher callback. Data published before is reported as update as well.
+	 */
+	bool registerCallback()
+	{
+		const bool registered = SubscriptionCallback::registerCallback();
+
+		if (registered && updated()) {
+			_update_set.set(_mask);
+		}
+
+		return registered;
+	}
+
+	void call() override { _update_set.set(_mask); }
+
+	uint32_t mask() const { return _mask; }
+
+	/**
+	 * Copy the data if the bit is set in updates (from SubscriptionUpdateSet::fetch()) and the topic was updated.
+	 */
+	bool update(uint32_t updates, void *dst) { return (updates & _mask) && SubscriptionCallback::update(dst); }
+
+	using SubscriptionCallback::update;
+
+private:
+	SubscriptionUpdateSet &_update_set;
+	const uint32_t _mask;
+};
+
+} // namespace uORB
@@ -36,6 +36,10 @@
 #include "uORBManager.hpp"
 #include "uORBUtils.hpp"
 
+#if defined(CONFIG_ORB_PREALLOC)
+#include "uORBPrealloc.hpp"
+#endif /* CONFIG_ORB_PREALLOC */
+
 #include <px4_platform_common/sem.hpp>
 #include <systemlib/px4_macros.h>
 
@@ -150,7 +154,13 @@ int uORB::DeviceMaster::advertise(const struct orb_metadata *meta, bool is_adver
 
 			// add to the node map.
 			_node_list.add(node);
-			_node_exists[node->get_instance()].set((orb_id_size_t)node->id(), true);
+
+			// publish the node in the table before marking it as existing
+			const orb_id_size_t id = (orb_id_size_t)node->id();
+			node->set_next_instance(_node_table[id].load());
+			_node_table[id].store(node);
+
+			_node_exists[node->get_instance()].set(id, true);
 		}
 
 		group_tries++;
@@ -192,6 +202,12 @@ void uORB::DeviceMaster::printStatistics()
 		cur_node = cur_node->next;
 		delete prev;
 	}
+
+#if defined(CONFIG_ORB_PREALLOC)
+	PX4_INFO_RAW("\npreallocated buffers: %" PRIu32 " / %zu bytes used, allocated at runtime: %" PRIu32 " (%" PRIu32
+		     " bytes)\n", Prealloc::usage.claimed_bytes.load(), Prealloc::region_size,
+		     Prealloc::usage.runtime_buffers.load(), Prealloc::usage.runtime_bytes.load());
+#endif /* CONFIG_ORB_PREALLOC */
 }
 
 int uORB::DeviceMaster::addNewDeviceNodes(DeviceNodeStatisticsData **first_node, int &num_topics,
@@ -258,6 +274,13 @@ int uORB::DeviceMaster::addNewDeviceNodes(DeviceNodeStatisticsData **first_node,
 
 		// Pass in 0 to get the index of the latest published data
 		last_node->last_pub_msg_count = last_node->node->updates_available(0);
+
+		DeviceNode::ProfilingData profile;
+
+		if (last_node->node->get_profiling_data(profile, true)) {
+			last_node->last_reads = profile.reads;
+			last_node->last_lost = profile.lost;
+		}
 	}
 
 	return 0;
@@ -269,20 +292,29 @@ void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 {
 	bool print_active_only = true;
 	bool only_once = false; // if true, run only once, then exit
+	bool show_bandwidth = false; // if true, show bandwidth and subscriber statistics
 
 	if (topic_filter && num_filters > 0) {
 		bool show_all = false;
+		int num_options = 0;
 
 		for (int i = 0; i < num_filters; ++i) {
 			if (!strcmp("-a", topic_filter[i])) {
 				show_all = true;
+				++num_options;
 
 			} else if (!strcmp("-1", topic_filter[i])) {
 				only_once = true;
+				++num_options;
+
+			} else if (!strcmp("-b", topic_filter[i])) {
+				show_bandwidth = true;
+				++num_options;
 			}
 		}
 
-		print_active_only = only_once ? (num_filters == 1) : false; // print non-active if -a or some filter given
+		// print non-active if -a or some filter given
+		print_active_only = !show_all && (num_options == num_filters);
 
 		if (show_all || print_active_only) {
 			num_filters = 0;
@@ -312,6 +344,12 @@ void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 		PX4_ERR("addNewDeviceNodes failed (%i)", ret);
 	}
 
+#ifdef CONFIG_ORB_PROFILING
+	const bool profiling_enabled = true;
+#else
+	const bool profiling_enabled = false;
+#endif /* CONFIG_ORB_PROFILING */
+
 #ifdef __PX4_QURT // QuRT has no poll()
 	only_once = true;
 #else
@@ -372,6 +410,18 @@ void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 				total_size += cur_node->pub_msg_delta * cur_node->node->get_meta()->o_size;
 				total_msgs += cur_node->pub_msg_delta;
 
+				DeviceNode::ProfilingData profile;
+
+				if (show_bandwidth && profiling_enabled) {
+					if (cur_node->node->get_profiling_data(profile, true)) {
+						cur_node->read_delta = roundf((profile.reads - cur_node->last_reads) / dt);
+						cur_node->lost_delta = profile.lost - cur_node->last_lost;
+						cur_node->last_reads = profile.reads;
+						cur_node->last_lost = profile.lost;
+						cur_node->max_lag = profile.max_lag;
+					}
+				}
+
 				cur_node = cur_node->next;
 			}
 
@@ -384,16 +434,38 @@ void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 
 			PX4_INFO_RAW(CLEAR_LINE "update: 1s, topics: %i, total publications: %i, %.1f kB/s\n",
 				     num_topics, total_msgs, (double)(total_size / 1000.f));
-			PX4_INFO_RAW(CLEAR_LINE "%-*s INST #SUB RATE #Q SIZE\n", (int)max_topic_name_length - 2, "TOPIC NAME");
+
+			if (show_bandwidth && !profiling_enabled) {
+				PX4_INFO_RAW(CLEAR_LINE "READ/s, LOST and LAG require CONFIG_ORB_PROFILING\n");
+			}
+
+			if (show_bandwidth) {
+				PX4_INFO_RAW(CLEAR_LINE "%-*s INST #SUB RATE #Q SIZE    B/s READ/s LOST  LAG\n", (int)max_topic_name_length - 2,
+					     "TOPIC NAME");
+
+			} else {
+				PX4_INFO_RAW(CLEAR_LINE "%-*s INST #SUB RATE #Q SIZE\n", (int)max_topic_name_length - 2, "TOPIC NAME");
+			}
+
 			cur_node = first_node;
 
 			while (cur_node) {
 
 				if (!print_active_only || (cur_node->pub_msg_delta > 0 && cur_node->node->subscriber_count() > 0)) {
-					PX4_INFO_RAW(CLEAR_LINE "%-*s %2i %4i %4i %2i %4i \n", (int)max_topic_name_length,
-						     cur_node->node->get_meta()->o_name, (int)cur_node->node->get_instance(),
-						     (int)cur_node->node->subscriber_count(), cur_node->pub_msg_delta,
-						     cur_node->node->get_queue_size(), cur_node->node->get_meta()->o_size);
+					if (show_bandwidth) {
+						PX4_INFO_RAW(CLEAR_LINE "%-*s %2i %4i %4i %2i %4i %6u %6u %4u %4u \n", (int)max_topic_name_length,
+							     cur_node->node->get_meta()->o_name, (int)cur_node->node->get_instance(),
+							     (int)cur_node->node->subscriber_count(), cur_node->pub_msg_delta,
+							     cur_node->node->get_queue_size(), cur_node->node->get_meta()->o_size,
+							     cur_node->pub_msg_delta * cur_node->node->get_meta()->o_size,
+							     cur_node->read_delta, cur_node->lost_delta, cur_node->max_lag);
+
+					} else {
+						PX4_INFO_RAW(CLEAR_LINE "%-*s %2i %4i %4i %2i %4i \n", (int)max_topic_name_length,
+							     cur_node->node->get_meta()->o_name, (int)cur_node->node->get_instance(),
+							     (int)cur_node->node->subscriber_count(), cur_node->pub_msg_delta,
+							     cur_node->node->get_queue_size(), cur_node->node->get_meta()->o_size);
+					}
 				}
 
 				cur_node = cur_node->next;
@@ -449,8 +521,12 @@ uORB::DeviceNode *uORB::DeviceMaster::getDeviceNode(const char *nodepath)
 
 uORB::DeviceNode *uORB::DeviceMaster::getDeviceNodeLocked(const struct orb_metadata *meta, const uint8_t instance)
 {
-	for (uORB::DeviceNode *node : _node_list) {
-		if ((strcmp(node->get_name(), meta->o_name) == 0) && (node->get_instance() == instance)) {
+	if (meta->o_id >= ORB_TOPICS_COUNT) {
+		return nullptr;
+	}
+
+	for (uORB::DeviceNode *node = _node_table[meta->o_id].load(); node != nullptr; node = node->next_instance()) {
+		if (node->get_instance() == instance) {
 			return node;
 		}
 	}
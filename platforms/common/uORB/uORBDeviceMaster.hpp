@@ -51,6 +51,7 @@ class Manager;
 #include <stdlib.h>
 
 #include <containers/IntrusiveSortedList.hpp>
+#include <px4_platform_common/atomic.h>
 #include <px4_platform_common/atomic_bitset.h>
 
 using px4::AtomicBitset;
@@ -68,10 +69,15 @@ public:
 	int advertise(const struct orb_metadata *meta, bool is_advertiser, int *instance);
 
 	/**
-	 * Public interface for getDeviceNodeLocked(). Takes care of synchronization.
+	 * Find a node given its path. Takes care of synchronization.
 	 * @return node if exists, nullptr otherwise
 	 */
 	uORB::DeviceNode *getDeviceNode(const char *node_name);
+
+	/**
+	 * Find a node given its topic and instance. This is lock-free.
+	 * @return node if exists, nullptr otherwise
+	 */
 	uORB::DeviceNode *getDeviceNode(const struct orb_metadata *meta, const uint8_t instance)
 	{
 		if (meta == nullptr) {
@@ -82,14 +88,9 @@ public:
 			return nullptr;
 		}
 
-		lock();
-		uORB::DeviceNode *node = getDeviceNodeLocked(meta, instance);
-		unlock();
-
 		//We can safely return the node that can be used by any thread, because
 		//a DeviceNode never gets deleted.
-		return node;
-
+		return getDeviceNodeLocked(meta, instance);
 	}
 
 	bool deviceNodeExists(ORB_ID id, const uint8_t instance)
@@ -124,6 +125,11 @@ private:
 		DeviceNode *node;
 		unsigned int last_pub_msg_count;
 		unsigned int pub_msg_delta;
+		unsigned int last_reads;
+		unsigned int last_lost;
+		unsigned int max_lag;
+		unsigned int read_delta;
+		unsigned int lost_delta;
 		DeviceNodeStatisticsData *next = nullptr;
 	};
 
@@ -133,8 +139,8 @@ private:
 	friend class uORB::Manager;
 
 	/**
-	 * Find a node give its name.
-	 * _lock must already be held when calling this.
+	 * Find a node given its topic and instance.
+	 * This does not need _lock, the name is kept for the callers within advertise().
 	 * @return node if exists, nullptr otherwise
 	 */
 	uORB::DeviceNode *getDeviceNodeLocked(const struct orb_metadata *meta, const uint8_t instance);
@@ -142,6 +148,13 @@ private:
 	IntrusiveSortedList<uORB::DeviceNode *> _node_list;
 	AtomicBitset<ORB_TOPICS_COUNT> _node_exists[ORB_MULTI_MAX_INSTANCES];
 
+	/**
+	 * Nodes indexed by ORB_ID, each entry is the head of the list of instances of the topic
+	 * (linked with DeviceNode::next_instance()). Entries are only added with _lock held and
+	 * nodes are never removed, so readers can walk it without locking.
+	 */
+	px4::atomic<uORB::DeviceNode *> _node_table[ORB_TOPICS_COUNT] {};
+
 	px4_sem_t	_lock; /**< lock to protect access to all class members (also for derived classes) */
 
 	void		lock() { do {} while (px4_sem_wait(&_lock) != 0); }
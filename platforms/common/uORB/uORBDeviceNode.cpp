@@ -38,6 +38,12 @@
 
 #include "SubscriptionCallback.hpp"
 
+#include <px4_platform_common/arena.h>
+
+#if defined(CONFIG_ORB_PREALLOC)
+#include "uORBPrealloc.hpp"
+#endif /* CONFIG_ORB_PREALLOC */
+
 #ifdef CONFIG_ORB_COMMUNICATOR
 #include "uORBCommunicator.hpp"
 #endif /* CONFIG_ORB_COMMUNICATOR */
@@ -57,7 +63,20 @@ uORB::DeviceNode::DeviceNode(const struct orb_metadata *meta, const uint8_t inst
 
 uORB::DeviceNode::~DeviceNode()
 {
+#if defined(CONFIG_ORB_PREALLOC)
+
+	if (Prealloc::contains(_data)) {
+		Prealloc::release(_meta);
+		_data = nullptr;
+	}
+
+#endif /* CONFIG_ORB_PREALLOC */
+
+#if defined(CONFIG_PX4_ARENA)
+	px4_arena_free(_data);
+#else
 	free(_data);
+#endif // CONFIG_PX4_ARENA
 
 	const char *devname = get_devname();
 
@@ -136,18 +155,9 @@ uORB::DeviceNode::read(cdev::file_t *filp, char *buffer, size_t buflen)
 	return filp_to_subscription(filp)->copy(buffer) ? _meta->o_size : 0;
 }
 
-ssize_t
-uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
+bool
+uORB::DeviceNode::allocate_data()
 {
-	/*
-	 * Writes are legal from interrupt context as long as the
-	 * object has already been initialised from thread context.
-	 *
-	 * Writes outside interrupt context will allocate the object
-	 * if it has not yet been allocated.
-	 *
-	 * Note that filp will usually be NULL.
-	 */
 	if (nullptr == _data) {
 
 #ifdef __PX4_NUTTX
@@ -160,7 +170,24 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 			/* re-check size */
 			if (nullptr == _data) {
 				const size_t data_size = _meta->o_size * _meta->o_queue;
-				_data = (uint8_t *) px4_cache_aligned_alloc(data_size);
+#if defined(CONFIG_ORB_PREALLOC)
+				_data = Prealloc::claim(_meta, _instance);
+
+				if (_data == nullptr) {
+					Prealloc::usage.runtime_buffers.fetch_add(1);
+					Prealloc::usage.runtime_bytes.fetch_add(data_size);
+				}
+
+#endif /* CONFIG_ORB_PREALLOC */
+
+				if (_data == nullptr) {
+#if defined(CONFIG_PX4_ARENA)
+					// topic buffers live until shutdown, keep them out of the heap
+					_data = (uint8_t *) px4_arena_alloc(data_size);
+#else
+					_data = (uint8_t *) px4_cache_aligned_alloc(data_size);
+#endif // CONFIG_PX4_ARENA
+				}
 
 				if (_data) {
 					memset(_data, 0, data_size);
@@ -173,11 +200,26 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 		}
 
 #endif /* __PX4_NUTTX */
+	}
 
-		/* failed or could not allocate */
-		if (nullptr == _data) {
-			return -ENOMEM;
-		}
+	/* failed or could not allocate */
+	return (nullptr != _data);
+}
+
+ssize_t
+uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
+{
+	/*
+	 * Writes are legal from interrupt context as long as the
+	 * object has already been initialised from thread context.
+	 *
+	 * Writes outside interrupt context will allocate the object
+	 * if it has not yet been allocated.
+	 *
+	 * Note that filp will usually be NULL.
+	 */
+	if (!allocate_data()) {
+		return -ENOMEM;
 	}
 
 	/* If write size does not match, that is an error */
@@ -189,14 +231,67 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 	ATOMIC_ENTER;
 	/* wrap-around happens after ~49 days, assuming a publisher rate of 1 kHz */
 	unsigned generation = _generation.fetch_add(1);
+	_write_sequence.store(generation + 1);
 
 	memcpy(_data + (_meta->o_size * (generation % _meta->o_queue)), buffer, _meta->o_size);
 
-	// callbacks
+	// callbacks, WorkItems sharing a WorkQueue are added with a single lock and wakeup
+	px4::WorkItemBatch batch;
+
 	for (auto item : _callbacks) {
-		item->call();
+		item->call_batched(batch);
 	}
 
+	batch.flush();
+
+	/* Mark at least one data has been published */
+	_data_valid = true;
+
+	ATOMIC_LEAVE;
+
+	/* notify any poll waiters */
+	poll_notify(POLLIN);
+
+	return _meta->o_size;
+}
+
+void *
+uORB::DeviceNode::loan()
+{
+	/* the loaned slot is the one the next write would use */
+	if (!allocate_data()) {
+		return nullptr;
+	}
+
+	ATOMIC_ENTER;
+	const unsigned generation = _generation.load();
+
+	/* invalidate any readers that currently borrow this slot */
+	_write_sequence.store(generation + 1);
+	ATOMIC_LEAVE;
+
+	return _data + (_meta->o_size * (generation % _meta->o_queue));
+}
+
+ssize_t
+uORB::DeviceNode::commit()
+{
+	if (nullptr == _data) {
+		return -ENOMEM;
+	}
+
+	ATOMIC_ENTER;
+	_generation.fetch_add(1);
+
+	// callbacks, WorkItems sharing a WorkQueue are added with a single lock and wakeup
+	px4::WorkItemBatch batch;
+
+	for (auto item : _callbacks) {
+		item->call_batched(batch);
+	}
+
+	batch.flush();
+
 	/* Mark at least one data has been published */
 	_data_valid = true;
 
@@ -291,6 +386,46 @@ uORB::DeviceNode::publish(const orb_metadata *meta, orb_advert_t handle, const v
 	return PX4_OK;
 }
 
+ssize_t
+uORB::DeviceNode::publish_loaned(const orb_metadata *meta, orb_advert_t handle)
+{
+	uORB::DeviceNode *devnode = (uORB::DeviceNode *)handle;
+
+	if ((devnode == nullptr) || (meta == nullptr)) {
+		errno = EFAULT;
+		return PX4_ERROR;
+	}
+
+	if (devnode->_meta->o_id != meta->o_id) {
+		errno = EINVAL;
+		return PX4_ERROR;
+	}
+
+	const ssize_t ret = devnode->commit();
+
+	if (ret < 0) {
+		errno = -ret;
+		return PX4_ERROR;
+	}
+
+#ifdef CONFIG_ORB_COMMUNICATOR
+	uORBCommunicator::IChannel *ch = uORB::Manager::get_instance()->get_uorb_communicator();
+
+	if (ch != nullptr) {
+		const unsigned generation = devnode->_generation.load() - 1;
+		uint8_t *data = devnode->_data + (meta->o_size * (generation % meta->o_queue));
+
+		if (ch->send_message(meta->o_name, meta->o_size, data) != 0) {
+			PX4_ERR("Error Sending [%s] topic data over comm_channel", meta->o_name);
+			return PX4_ERROR;
+		}
+	}
+
+#endif /* CONFIG_ORB_COMMUNICATOR */
+
+	return PX4_OK;
+}
+
 int uORB::DeviceNode::unadvertise(orb_advert_t handle)
 {
 	if (handle == nullptr) {
@@ -364,6 +499,75 @@ uORB::DeviceNode::print_statistics(int max_topic_length)
 	return true;
 }
 
+unsigned
+uORB::DeviceNode::copy_batch(void *dst, unsigned &generation, unsigned max_count)
+{
+	if ((dst == nullptr) || (_data == nullptr) || (max_count == 0)) {
+		return 0;
+	}
+
+	const unsigned queue_size = _meta->o_queue;
+	uint8_t *dst_bytes = static_cast<uint8_t *>(dst);
+
+	ATOMIC_ENTER;
+	const unsigned current_generation = _generation.load();
+	profile_read(current_generation, generation);
+
+	if (current_generation == generation) {
+		ATOMIC_LEAVE;
+		return 0;
+	}
+
+	if (current_generation - generation > queue_size) {
+		// Reader is too far behind: some messages are lost
+		generation = current_generation - queue_size;
+	}
+
+	unsigned count = current_generation - generation;
+
+	if (count > max_count) {
+		count = max_count;
+	}
+
+	// copy in at most two contiguous chunks: up to the end of the queue, then from its start
+	const unsigned first_index = generation % queue_size;
+	const unsigned first_count = (first_index + count <= queue_size) ? count : queue_size - first_index;
+
+	memcpy(dst_bytes, _data + (_meta->o_size * first_index), _meta->o_size * first_count);
+
+	if (count > first_count) {
+		memcpy(dst_bytes + (_meta->o_size * first_count), _data, _meta->o_size * (count - first_count));
+	}
+
+	ATOMIC_LEAVE;
+
+	generation += count;
+
+	return count;
+}
+
+bool
+uORB::DeviceNode::get_profiling_data(ProfilingData &data, bool reset_max_lag)
+{
+#ifdef CONFIG_ORB_PROFILING
+	ATOMIC_ENTER;
+	data.reads = _profile_reads;
+	data.lost = _profile_lost;
+	data.max_lag = _profile_max_lag;
+
+	if (reset_max_lag) {
+		_profile_max_lag = 0;
+	}
+
+	ATOMIC_LEAVE;
+	return true;
+#else
+	data = {};
+	(void)reset_max_lag;
+	return false;
+#endif /* CONFIG_ORB_PROFILING */
+}
+
 void uORB::DeviceNode::add_internal_subscriber()
 {
 	lock();
@@ -406,6 +610,8 @@ void uORB::DeviceNode::remove_internal_subscriber()
 #ifdef CONFIG_ORB_COMMUNICATOR
 int16_t uORB::DeviceNode::process_add_subscription()
 {
+	_has_remote_subscription = true;
+
 	// if there is already data in the node, send this out to
 	// the remote entity.
 	// send the data to the remote entity.
@@ -423,6 +629,8 @@ int16_t uORB::DeviceNode::process_add_subscription()
 
 int16_t uORB::DeviceNode::process_remove_subscription()
 {
+	_has_remote_subscription = false;
+
 	return PX4_OK;
 }
 
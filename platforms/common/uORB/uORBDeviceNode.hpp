@@ -121,6 +121,11 @@ public:
 	 */
 	static ssize_t    publish(const orb_metadata *meta, orb_advert_t handle, const void *data);
 
+	/**
+	 * Method to publish the data previously loaned from this node.
+	 */
+	static ssize_t    publish_loaned(const orb_metadata *meta, orb_advert_t handle);
+
 	static int        unadvertise(orb_advert_t handle);
 
 #ifdef CONFIG_ORB_COMMUNICATOR
@@ -190,6 +195,15 @@ public:
 
 	int8_t subscriber_count() const { return _subscriber_count; }
 
+	bool has_subscribers() const
+	{
+#ifdef CONFIG_ORB_COMMUNICATOR
+		return (_subscriber_count > 0) || _has_remote_subscription;
+#else
+		return _subscriber_count > 0;
+#endif /* CONFIG_ORB_COMMUNICATOR */
+	}
+
 	/**
 	 * Returns the number of updated data relative to the parameter 'generation'
 	 * We can get the correct value regardless of wrap-around or not.
@@ -211,6 +225,13 @@ public:
 
 	uint8_t get_instance() const { return _instance; }
 
+	/**
+	 * Next node of the same topic (other instance), used by the DeviceMaster lookup table.
+	 * Set once before the node is added to the table and never changed afterwards.
+	 */
+	DeviceNode *next_instance() const { return _next_instance; }
+	void set_next_instance(DeviceNode *node) { _next_instance = node; }
+
 	/**
 	 * Copies data and the corresponding generation
 	 * from a node to the buffer provided.
@@ -228,6 +249,7 @@ public:
 			if (_meta->o_queue == 1) {
 				ATOMIC_ENTER;
 				memcpy(dst, _data, _meta->o_size);
+				profile_read(_generation.load(), generation);
 				generation = _generation.load();
 				ATOMIC_LEAVE;
 				return true;
@@ -235,6 +257,7 @@ public:
 			} else {
 				ATOMIC_ENTER;
 				const unsigned current_generation = _generation.load();
+				profile_read(current_generation, generation);
 
 				if (current_generation == generation) {
 					/* The subscriber already read the latest message, but nothing new was published yet.
@@ -262,6 +285,107 @@ public:
 
 	}
 
+	/**
+	 * Copies all pending updates (at most max_count) to the buffer provided,
+	 * oldest first. Updates that were already overwritten in the queue are skipped.
+	 *
+	 * @param dst
+	 *   The buffer into which the data is copied, must hold max_count messages.
+	 * @param generation
+	 *   The generation of the subscriber, advanced by the number of copied
+	 *   (and skipped) updates.
+	 * @param max_count
+	 *   Maximum number of messages to copy.
+	 * @return
+	 *   Number of messages copied.
+	 */
+	unsigned copy_batch(void *dst, unsigned &generation, unsigned max_count);
+
+	/**
+	 * Loan the slot that the next publication will occupy, so that the
+	 * publisher can fill it in place instead of copying into the node.
+	 * Only valid for topics with a single publisher, and the slot content
+	 * is stale: the publisher has to fill in the complete message.
+	 *
+	 * @return pointer to the slot or nullptr on failure. Must be followed by commit().
+	 */
+	void *loan();
+
+	/**
+	 * Publish the slot previously returned by loan().
+	 */
+	ssize_t commit();
+
+	/**
+	 * Borrow the data of a node in place, with the same generation handling as copy().
+	 * The returned data may be overwritten by a publisher at any time, callers
+	 * must check borrow_valid() after reading it and discard the data otherwise.
+	 *
+	 * @param generation
+	 *   The generation that was borrowed (advanced as with copy()).
+	 * @return
+	 *   Pointer to the data or nullptr if no data is available.
+	 */
+	const void *borrow(unsigned &generation)
+	{
+		if (_data != nullptr) {
+			ATOMIC_ENTER;
+			const unsigned current_generation = _generation.load();
+			profile_read(current_generation, generation);
+
+			if (_meta->o_queue == 1) {
+				generation = current_generation;
+				ATOMIC_LEAVE;
+				return borrow_valid(generation) ? _data : nullptr;
+			}
+
+			if (current_generation == generation) {
+				--generation;
+			}
+
+			if (!is_in_range(current_generation - _meta->o_queue, generation, current_generation - 1)) {
+				generation = current_generation - _meta->o_queue;
+			}
+
+			const uint8_t *data = _data + (_meta->o_size * (generation % _meta->o_queue));
+			ATOMIC_LEAVE;
+
+			++generation;
+
+			return borrow_valid(generation) ? data : nullptr;
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Check if the slot borrowed for a generation (as returned by borrow())
+	 * has not been touched by a publisher since.
+	 */
+	bool borrow_valid(unsigned generation) const
+	{
+		// the slot of (generation - 1) is reused by the write of (generation - 1 + o_queue)
+		return (_write_sequence.load() - (generation - 1)) <= _meta->o_queue;
+	}
+
+	/**
+	 * Read statistics, only collected with CONFIG_ORB_PROFILING.
+	 * The counters wrap around, callers should use differences.
+	 */
+	struct ProfilingData {
+		unsigned reads;   /**< number of copies/borrows done by subscribers */
+		unsigned lost;    /**< number of queue entries overwritten before a subscriber read them */
+		unsigned max_lag; /**< maximum number of pending updates seen by a subscriber since the last reset */
+	};
+
+	/**
+	 * Get the read statistics of this node.
+	 * @param data filled in with the current counters
+	 * @param reset_max_lag reset the maximum lag after reading it
+	 * @return false if profiling is not enabled
+	 */
+	bool get_profiling_data(ProfilingData &data, bool reset_max_lag);
+
 	// add item to list of work items to schedule on node update
 	bool register_callback(SubscriptionCallback *callback_sub);
 
@@ -282,6 +406,7 @@ private:
 	uint8_t *_data{nullptr};   /**< allocated object buffer */
 	bool _data_valid{false}; /**< At least one valid data */
 	px4::atomic<unsigned>  _generation{0};  /**< object generation count */
+	px4::atomic<unsigned>  _write_sequence{0};  /**< number of slot writes started (including loans) */
 	List<uORB::SubscriptionCallback *>	_callbacks;
 
 	const uint8_t _instance; /**< orb multi instance identifier */
@@ -289,6 +414,46 @@ private:
 
 	int8_t _subscriber_count{0};
 
+#ifdef CONFIG_ORB_COMMUNICATOR
+	bool _has_remote_subscription{false};
+#endif /* CONFIG_ORB_COMMUNICATOR */
+
+	DeviceNode *_next_instance{nullptr};
+
+#ifdef CONFIG_ORB_PROFILING
+	unsigned _profile_reads{0};
+	unsigned _profile_lost{0};
+	unsigned _profile_max_lag{0};
+#endif /* CONFIG_ORB_PROFILING */
+
+	bool allocate_data();
+
+	/**
+	 * Account a subscriber read, called with ATOMIC_ENTER held.
+	 * @param current_generation generation of the node
+	 * @param generation generation of the subscriber before the read
+	 */
+	inline void profile_read(unsigned current_generation, unsigned generation)
+	{
+#ifdef CONFIG_ORB_PROFILING
+		const unsigned lag = current_generation - generation;
+
+		++_profile_reads;
+
+		if (lag > _meta->o_queue) {
+			_profile_lost += lag - _meta->o_queue;
+		}
+
+		if (lag > _profile_max_lag) {
+			_profile_max_lag = lag;
+		}
+
+#else
+		(void)current_generation;
+		(void)generation;
+#endif /* CONFIG_ORB_PROFILING */
+	}
+
 
 // Determine the data range
 	static inline bool is_in_range(unsigned left, unsigned value, unsigned right)
@@ -185,6 +185,12 @@ int	uORB::Manager::orb_ioctl(unsigned int cmd, unsigned long arg)
 		}
 		break;
 
+	case ORBIOCDEVDATACOPYBATCH: {
+			orbiocdevdatacopybatch_t *data = (orbiocdevdatacopybatch_t *)arg;
+			data->ret = uORB::Manager::orb_data_copy_batch(data->handle, data->dst, data->generation, data->max_count);
+		}
+		break;
+
 	case ORBIOCDEVREGCALLBACK: {
 			orbiocdevregcallback_t *data = (orbiocdevregcallback_t *)arg;
 			data->registered = uORB::Manager::register_callback(data->handle, data->callback_sub);
@@ -229,6 +235,12 @@ int	uORB::Manager::orb_ioctl(unsigned int cmd, unsigned long arg)
 		}
 		break;
 
+	case ORBIOCDEVHASSUBSCRIBERS: {
+			orbiocdevhassubscribers_t *data = (orbiocdevhassubscribers_t *)arg;
+			data->ret = orb_has_subscribers((orb_advert_t)data->handle);
+		}
+		break;
+
 	default:
 		ret = -ENOTTY;
 	}
@@ -375,6 +387,53 @@ int uORB::Manager::orb_publish(const struct orb_metadata *meta, orb_advert_t han
 	return uORB::DeviceNode::publish(meta, handle, data);
 }
 
+void *uORB::Manager::orb_loan(orb_advert_t handle)
+{
+#ifdef ORB_USE_PUBLISHER_RULES
+
+	if (handle == _Instance) {
+		return nullptr;
+	}
+
+#endif /* ORB_USE_PUBLISHER_RULES */
+
+	if (handle == nullptr) {
+		return nullptr;
+	}
+
+	return static_cast<uORB::DeviceNode *>(handle)->loan();
+}
+
+int uORB::Manager::orb_commit(const struct orb_metadata *meta, orb_advert_t handle)
+{
+#ifdef ORB_USE_PUBLISHER_RULES
+
+	if (handle == _Instance) {
+		return PX4_OK; //pretend success
+	}
+
+#endif /* ORB_USE_PUBLISHER_RULES */
+
+	return uORB::DeviceNode::publish_loaned(meta, handle);
+}
+
+bool uORB::Manager::orb_has_subscribers(orb_advert_t handle)
+{
+#ifdef ORB_USE_PUBLISHER_RULES
+
+	if (handle == _Instance) {
+		return false;
+	}
+
+#endif /* ORB_USE_PUBLISHER_RULES */
+
+	if (handle == nullptr) {
+		return false;
+	}
+
+	return static_cast<const uORB::DeviceNode *>(handle)->has_subscribers();
+}
+
 int uORB::Manager::orb_copy(const struct orb_metadata *meta, int handle, void *buffer)
 {
 	int ret;
@@ -445,6 +504,24 @@ void uORB::Manager::orb_remove_internal_subscriber(void *node_handle)
 
 uint8_t uORB::Manager::orb_get_queue_size(const void *node_handle) { return static_cast<const DeviceNode *>(node_handle)->get_queue_size(); }
 
+const void *uORB::Manager::orb_data_borrow(void *node_handle, unsigned &generation, bool only_if_updated)
+{
+	if (!is_advertised(node_handle)) {
+		return nullptr;
+	}
+
+	if (only_if_updated && !static_cast<const uORB::DeviceNode *>(node_handle)->updates_available(generation)) {
+		return nullptr;
+	}
+
+	return static_cast<DeviceNode *>(node_handle)->borrow(generation);
+}
+
+bool uORB::Manager::orb_data_borrow_valid(const void *node_handle, unsigned generation)
+{
+	return static_cast<const uORB::DeviceNode *>(node_handle)->borrow_valid(generation);
+}
+
 bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &generation, bool only_if_updated)
 {
 	if (!is_advertised(node_handle)) {
@@ -458,6 +535,15 @@ bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &genera
 	return static_cast<DeviceNode *>(node_handle)->copy(dst, generation);
 }
 
+unsigned uORB::Manager::orb_data_copy_batch(void *node_handle, void *dst, unsigned &generation, unsigned max_count)
+{
+	if (!is_advertised(node_handle)) {
+		return 0;
+	}
+
+	return static_cast<DeviceNode *>(node_handle)->copy_batch(dst, generation, max_count);
+}
+
 // add item to list of work items to schedule on node update
 bool uORB::Manager::register_callback(void *node_handle, SubscriptionCallback *callback_sub)
 {
@@ -153,6 +153,21 @@ typedef enum {
 } orbiocdevmastercmd_t;
 #define ORBIOCDEVMASTERCMD	_ORBIOCDEV(45)
 
+#define ORBIOCDEVDATACOPYBATCH	_ORBIOCDEV(46)
+typedef struct {
+	void *handle;
+	void *dst;
+	unsigned generation;
+	unsigned max_count;
+	unsigned ret;
+} orbiocdevdatacopybatch_t;
+
+#define ORBIOCDEVHASSUBSCRIBERS	_ORBIOCDEV(47)
+typedef struct {
+	const void *handle;
+	bool ret;
+} orbiocdevhassubscribers_t;
+
 
 /**
  * This is implemented as a singleton.  This class manages creating the
@@ -279,6 +294,38 @@ public:
 	 */
 	static int  orb_publish(const struct orb_metadata *meta, orb_advert_t handle, const void *data);
 
+	/**
+	 * Loan the buffer of the next publication of a topic, so that it can be
+	 * filled in place without an additional copy. The loaned buffer holds
+	 * stale data and must be completely filled before calling orb_commit().
+	 * Only valid for topics with a single publisher.
+	 *
+	 * @handle    The handle returned from orb_advertise.
+	 * @return    Pointer to the buffer, nullptr if loaning is not possible
+	 *      (eg. in the protected build), in which case orb_publish() has to be used.
+	 */
+	static void *orb_loan(orb_advert_t handle);
+
+	/**
+	 * Publish the buffer previously loaned with orb_loan().
+	 *
+	 * @param meta    The uORB metadata (usually from the ORB_ID() macro)
+	 *      for the topic.
+	 * @handle    The handle returned from orb_advertise.
+	 * @return    OK on success, PX4_ERROR otherwise with errno set accordingly.
+	 */
+	static int  orb_commit(const struct orb_metadata *meta, orb_advert_t handle);
+
+	/**
+	 * Check if a topic currently has subscribers, local or (with the uORB
+	 * communicator) remote. Allows a publisher to skip filling and publishing
+	 * a message nobody reads.
+	 *
+	 * @handle    The handle returned from orb_advertise.
+	 * @return    true if there is at least one subscriber.
+	 */
+	static bool orb_has_subscribers(orb_advert_t handle);
+
 	/**
 	 * Subscribe to a topic.
 	 *
@@ -442,6 +489,12 @@ public:
 
 	static bool orb_data_copy(void *node_handle, void *dst, unsigned &generation, bool only_if_updated);
 
+	static unsigned orb_data_copy_batch(void *node_handle, void *dst, unsigned &generation, unsigned max_count);
+
+	static const void *orb_data_borrow(void *node_handle, unsigned &generation, bool only_if_updated);
+
+	static bool orb_data_borrow_valid(const void *node_handle, unsigned generation);
+
 	static bool register_callback(void *node_handle, SubscriptionCallback *callback_sub);
 
 	static void unregister_callback(void *node_handle, SubscriptionCallback *callback_sub);
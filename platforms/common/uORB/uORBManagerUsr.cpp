@@ -155,6 +155,26 @@ int uORB::Manager::orb_publish(const struct orb_metadata *meta, orb_advert_t han
 	return d.ret;
 }
 
+void *uORB::Manager::orb_loan(orb_advert_t handle)
+{
+	// node data lives in kernel space and can't be filled in place
+	return nullptr;
+}
+
+int uORB::Manager::orb_commit(const struct orb_metadata *meta, orb_advert_t handle)
+{
+	errno = ENOTSUP;
+	return PX4_ERROR;
+}
+
+bool uORB::Manager::orb_has_subscribers(orb_advert_t handle)
+{
+	orbiocdevhassubscribers_t data = {handle, false};
+	boardctl(ORBIOCDEVHASSUBSCRIBERS, reinterpret_cast<unsigned long>(&data));
+
+	return data.ret;
+}
+
 int uORB::Manager::orb_copy(const struct orb_metadata *meta, int handle, void *buffer)
 {
 	int ret;
@@ -293,6 +313,17 @@ uint8_t uORB::Manager::orb_get_queue_size(const void *node_handle)
 	return data.size;
 }
 
+const void *uORB::Manager::orb_data_borrow(void *node_handle, unsigned &generation, bool only_if_updated)
+{
+	// node data lives in kernel space and can't be accessed in place
+	return nullptr;
+}
+
+bool uORB::Manager::orb_data_borrow_valid(const void *node_handle, unsigned generation)
+{
+	return false;
+}
+
 bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &generation, bool only_if_updated)
 {
 	orbiocdevdatacopy_t data = {node_handle, dst, generation, only_if_updated, false};
@@ -302,6 +333,15 @@ bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &genera
 	return data.ret;
 }
 
+unsigned uORB::Manager::orb_data_copy_batch(void *node_handle, void *dst, unsigned &generation, unsigned max_count)
+{
+	orbiocdevdatacopybatch_t data = {node_handle, dst, generation, max_count, 0};
+	boardctl(ORBIOCDEVDATACOPYBATCH, reinterpret_cast<unsigned long>(&data));
+	generation = data.generation;
+
+	return data.ret;
+}
+
 bool uORB::Manager::register_callback(void *node_handle, SubscriptionCallback *callback_sub)
 {
 	orbiocdevregcallback_t data = {node_handle, callback_sub, false};
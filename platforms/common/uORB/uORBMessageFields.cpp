@@ -52,9 +52,10 @@ MessageFormatReader::State MessageFormatReader::readMore()
 	}
 
 	const uint8_t *compressed_formats = orb_compressed_message_formats();
-	const unsigned compressed_formats_size = orb_compressed_message_formats_size();
+	const uint16_t *block_offsets = orb_compressed_message_formats_block_offsets();
+	const unsigned compressed_formats_end = block_offsets[_end_block];
 
-	if (_buffer_length == 0 && _compressed_formats_idx == compressed_formats_size) {
+	if (_buffer_length == 0 && _compressed_formats_idx == compressed_formats_end) {
 		_state = State::Complete;
 		return _state;
 	}
@@ -140,18 +141,19 @@ MessageFormatReader::State MessageFormatReader::readMore()
 			return _state;
 		}
 
-		// Decompress more data
+		// Decompress more data of the current block
+		const unsigned block_end = block_offsets[_block + 1];
 		size_t count = 0;
 
 		if (heatshrink_decoder_sink(&_hsd, &compressed_formats[_compressed_formats_idx],
-					    compressed_formats_size - _compressed_formats_idx, &count) < 0) {
+					    block_end - _compressed_formats_idx, &count) < 0) {
 			_state = State::Failure;
 			return _state;
 		}
 
 		_compressed_formats_idx += count;
 
-		if (_compressed_formats_idx == compressed_formats_size) {
+		if (_compressed_formats_idx == block_end) {
 			const HSD_finish_res fres = heatshrink_decoder_finish(&_hsd);
 
 			if (fres != HSDR_FINISH_MORE && fres != HSDR_FINISH_DONE) {
@@ -169,13 +171,19 @@ MessageFormatReader::State MessageFormatReader::readMore()
 			return _state;
 		}
 
-		if (_compressed_formats_idx == compressed_formats_size) {
+		if (_compressed_formats_idx == block_end) {
 			const HSD_finish_res fres = heatshrink_decoder_finish(&_hsd);
 
 			if (HSDR_FINISH_DONE != fres && HSDR_FINISH_MORE != fres) {
 				_state = State::Failure;
 				return _state;
 			}
+
+			// Block fully decompressed: blocks are compressed independently, restart the decoder for the next one
+			if (HSDR_POLL_EMPTY == pres && _block + 1 < _end_block) {
+				heatshrink_decoder_reset(&_hsd);
+				++_block;
+			}
 		}
 
 	}
@@ -246,6 +254,23 @@ int MessageFormatReader::expandMessageFormat(char *format, unsigned len, unsigne
 
 bool MessageFormatReader::readUntilFormat(orb_id_size_t orb_id)
 {
+	const int block = orb_compressed_message_formats_block(orb_id);
+
+	if (block < 0) {
+		return false;
+	}
+
+	// Restart at the block containing the format, only that block needs to be decompressed
+	_state = State::ReadOrbIDs;
+	_orb_ids.clear();
+	_orb_ids_dependencies.clear();
+	_buffer_length = 0;
+	_format_length = 0;
+	_block = block;
+	_end_block = block + 1;
+	_compressed_formats_idx = orb_compressed_message_formats_block_offsets()[block];
+	heatshrink_decoder_reset(&_hsd);
+
 	bool done = false;
 	bool found_format = false;
 
@@ -73,7 +73,9 @@ public:
 	State readMore();
 
 	/**
-	 * Read until the start of a format given an ORB ID
+	 * Read until the start of a format given an ORB ID.
+	 * This restarts the reader at the compressed block containing the format (without decompressing the
+	 * preceding ones), reading then stops at the end of that block.
 	 * @return true on success
 	 */
 	bool readUntilFormat(orb_id_size_t orb_id);
@@ -145,6 +147,8 @@ private:
 	px4::Array<orb_id_size_t, orb_compressed_max_num_orb_id_dependencies> _orb_ids_dependencies;
 
 	unsigned _compressed_formats_idx{0};
+	unsigned _block{0};		///< block currently being decompressed
+	unsigned _end_block{orb_compressed_message_formats_num_blocks()}; ///< stop at the start of this block
 	char *_buffer{nullptr};
 	const unsigned _buffer_capacity;
 	uint32_t _buffer_length{0};
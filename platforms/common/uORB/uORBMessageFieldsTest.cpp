@@ -235,3 +235,57 @@ TEST_F(uORBMessageFieldsTest, decompress_specific_format)
 	const std::string expected_format = "uint64_t timestamp;int32_t val;uint8_t[4] _padding0;";
 	ASSERT_EQ(expected_format, format);
 }
+
+TEST_F(uORBMessageFieldsTest, random_access_matches_sequential)
+{
+	char buffer[1600];
+	std::string formats[ORB_TOPICS_COUNT];
+
+	// Sequential read through all blocks
+	{
+		uORB::MessageFormatReader format_reader(buffer, sizeof(buffer));
+		bool done = false;
+
+		while (!done) {
+			switch (format_reader.readMore()) {
+			case uORB::MessageFormatReader::State::FormatComplete: {
+					const std::string format(buffer, format_reader.formatLength());
+
+					for (const orb_id_size_t orb_id : format_reader.orbIDs()) {
+						formats[orb_id] = format;
+					}
+
+					format_reader.clearFormatFromBuffer();
+					break;
+				}
+
+			case uORB::MessageFormatReader::State::Failure:
+				done = true;
+				ASSERT_FALSE(true);
+				break;
+
+			case uORB::MessageFormatReader::State::Complete:
+				done = true;
+				break;
+
+			default:
+				break;
+			}
+		}
+	}
+
+	// Lookup of each format, only decompressing its block
+	for (size_t orb_id = 0; orb_id < ORB_TOPICS_COUNT; ++orb_id) {
+		uORB::MessageFormatReader format_reader(buffer, sizeof(buffer));
+		ASSERT_TRUE(format_reader.readUntilFormat((orb_id_size_t)orb_id));
+
+		std::string format;
+		int field_length = 0;
+
+		while (format_reader.readNextField(field_length)) {
+			format += std::string(buffer, field_length) + ";";
+		}
+
+		EXPECT_EQ(format, formats[orb_id]) << get_orb_meta((ORB_ID)orb_id)->o_name;
+	}
+}
@@ -0,0 +1,74 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "uORBPrealloc.hpp"
+
+namespace uORB
+{
+namespace Prealloc
+{
+
+Usage usage;
+
+static uint32_t buffer_size(const orb_metadata *meta)
+{
+	return ((size_t)meta->o_size * meta->o_queue + (ALIGNMENT - 1)) & ~(ALIGNMENT - 1);
+}
+
+uint8_t *claim(const orb_metadata *meta, uint8_t instance)
+{
+	size_t offset = 0;
+
+	for (const Entry *entry = entries; entry->instances > 0; ++entry) {
+		if (static_cast<orb_id_size_t>(entry->id) == meta->o_id) {
+			if ((instance < entry->instances) && (entry->buffer_size >= buffer_size(meta))) {
+				usage.claimed_bytes.fetch_add(buffer_size(meta));
+				return &region[offset + (size_t)instance * entry->buffer_size];
+			}
+
+			return nullptr;
+		}
+
+		offset += (size_t)entry->instances * entry->buffer_size;
+	}
+
+	return nullptr;
+}
+
+void release(const orb_metadata *meta)
+{
+	usage.claimed_bytes.fetch_sub(buffer_size(meta));
+}
+
+} // namespace Prealloc
+} // namespace uORB
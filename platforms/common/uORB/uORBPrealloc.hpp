@@ -0,0 +1,97 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file uORBPrealloc.hpp
+ * Topic buffers preallocated at boot (CONFIG_ORB_PREALLOC)
+ *
+ * The list of topics and instances is generated at build time from the topic
+ * manifest (msg/uorb_prealloc.txt or the board's uorb_prealloc.txt) by
+ * Tools/msg/px_generate_uorb_prealloc.py. All buffers are placed in a single
+ * static region, so the memory of the listed topics is fixed at link time
+ * instead of being allocated from the heap on the first advertise.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <px4_platform_common/atomic.h>
+#include <uORB/topics/uORBTopics.hpp>
+#include <uORB/uORB.h>
+
+namespace uORB
+{
+namespace Prealloc
+{
+
+static constexpr size_t ALIGNMENT = 8;
+
+struct Entry {
+	ORB_ID id;
+	uint8_t instances;
+	uint32_t buffer_size;	///< per instance (o_size * o_queue, aligned)
+};
+
+// generated, terminated by an entry with 0 instances
+extern const Entry entries[];
+extern uint8_t region[];
+extern const size_t region_size;
+
+/**
+ * Claim the preallocated buffer of a topic instance.
+ * @return buffer, or nullptr if the instance is not in the manifest
+ */
+uint8_t *claim(const orb_metadata *meta, uint8_t instance);
+
+/**
+ * Release a buffer from claim().
+ */
+void release(const orb_metadata *meta);
+
+/**
+ * @return true if the buffer is part of the preallocated region (must not be freed)
+ */
+inline bool contains(const uint8_t *buffer) { return (buffer >= region) && (buffer < region + region_size); }
+
+struct Usage {
+	px4::atomic<uint32_t> claimed_bytes{0};		///< preallocated bytes in use
+	px4::atomic<uint32_t> runtime_buffers{0};	///< topic buffers allocated at runtime instead
+	px4::atomic<uint32_t> runtime_bytes{0};
+};
+
+extern Usage usage;
+
+} // namespace Prealloc
+} // namespace uORB
@@ -41,6 +41,7 @@
 #include <lib/cdev/CDev.hpp>
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/SubscriptionMultiArray.hpp>
+#include <uORB/SubscriptionUpdateSet.hpp>
 
 uORBTest::UnitTest &uORBTest::UnitTest::instance()
 {
@@ -194,6 +195,18 @@ int uORBTest::UnitTest::test()
 		return ret;
 	}
 
+	ret = test_has_subscribers();
+
+	if (ret != OK) {
+		return ret;
+	}
+
+	ret = test_update_set();
+
+	if (ret != OK) {
+		return ret;
+	}
+
 	ret = test_wrap_around();
 
 	if (ret != OK) {
@@ -206,6 +219,12 @@ int uORBTest::UnitTest::test()
 		return ret;
 	}
 
+	ret = test_queue_batch();
+
+	if (ret != OK) {
+		return ret;
+	}
+
 	return test_queue_poll_notify();
 }
 
@@ -242,6 +261,96 @@ int uORBTest::UnitTest::test_unadvertise()
 }
 
 
+int uORBTest::UnitTest::test_has_subscribers()
+{
+	test_note("Testing has_subscribers");
+
+	uORB::PublicationMulti<orb_test_large_s> pub{ORB_ID::orb_test_large};
+
+	// not advertised yet: report subscribers so that the first publication creates the topic
+	if (!pub.has_subscribers()) {
+		return test_fail("has_subscribers() false before advertising");
+	}
+
+	orb_test_large_s t{};
+	pub.publish(t);
+
+	if (pub.has_subscribers()) {
+		return test_fail("has_subscribers() true without subscription");
+	}
+
+	{
+		uORB::Subscription sub{ORB_ID::orb_test_large, static_cast<uint8_t>(pub.get_instance())};
+		sub.subscribe();
+
+		if (!pub.has_subscribers()) {
+			return test_fail("has_subscribers() false with subscription");
+		}
+	}
+
+	if (pub.has_subscribers()) {
+		return test_fail("has_subscribers() true after unsubscribing");
+	}
+
+	return test_note("PASS has_subscribers");
+}
+
+int uORBTest::UnitTest::test_update_set()
+{
+	test_note("Testing SubscriptionUpdateSet");
+
+	uORB::PublicationMulti<orb_test_medium_s> pub{ORB_ID::orb_test_medium};
+	orb_test_medium_s t{};
+	t.val = 1;
+	pub.publish(t);
+
+	const uint8_t instance = static_cast<uint8_t>(pub.get_instance());
+
+	uORB::SubscriptionUpdateSet update_set;
+	uORB::SubscriptionFlagged sub_published{update_set, 0, ORB_ID(orb_test_medium), instance};
+	uORB::SubscriptionFlagged sub_other{update_set, 5, ORB_ID(orb_test_large)};
+
+	if (!sub_published.registerCallback() || !sub_other.registerCallback()) {
+		return test_fail("registerCallback failed");
+	}
+
+	// data published before registering is reported
+	uint32_t updates = update_set.fetch();
+
+	if (!(updates & sub_published.mask())) {
+		return test_fail("initial update missing");
+	}
+
+	orb_test_medium_s data{};
+
+	if (!sub_published.update(updates, &data) || data.val != 1) {
+		return test_fail("update with set bit failed");
+	}
+
+	if (update_set.fetch() != 0) {
+		return test_fail("updates not cleared");
+	}
+
+	t.val = 2;
+	pub.publish(t);
+
+	updates = update_set.fetch();
+
+	if (updates != sub_published.mask()) {
+		return test_fail("updates 0x%" PRIx32 ", expected 0x%" PRIx32, updates, sub_published.mask());
+	}
+
+	if (sub_other.update(updates, &data)) {
+		return test_fail("update without set bit");
+	}
+
+	if (!sub_published.update(updates, &data) || data.val != 2) {
+		return test_fail("update after publish failed");
+	}
+
+	return test_note("PASS SubscriptionUpdateSet");
+}
+
 int uORBTest::UnitTest::info()
 {
 	return OK;
@@ -924,6 +1033,91 @@ int uORBTest::UnitTest::test_queue()
 	return test_note("PASS orb queuing");
 }
 
+int uORBTest::UnitTest::test_queue_batch()
+{
+	test_note("Testing orb batch reads");
+
+	orb_test_medium_s t{};
+	orb_advert_t ptopic = orb_advertise(ORB_ID(orb_test_medium_queue), &t);
+
+	if (ptopic == nullptr) {
+		return test_fail("advertise failed: %d", errno);
+	}
+
+	uORB::Subscription sub{ORB_ID(orb_test_medium_queue)};
+	const int queue_size = orb_get_queue_size(ORB_ID(orb_test_medium_queue));
+	orb_test_medium_s u[orb_test_medium_s::ORB_QUEUE_LENGTH] {};
+
+	if (queue_size > orb_test_medium_s::ORB_QUEUE_LENGTH) {
+		return test_fail("queue too large: %d", queue_size);
+	}
+
+	// consume the advertised message
+	sub.update_batch(u, queue_size);
+
+	if (sub.update_batch(u, queue_size) != 0) {
+		return test_fail("spurious batch update");
+	}
+
+	test_note("  Testing partial reads...");
+
+	for (int i = 0; i < queue_size - 1; ++i) {
+		t.val = i;
+		orb_publish(ORB_ID(orb_test_medium_queue), ptopic, &t);
+	}
+
+	unsigned count = sub.update_batch(u, 2);
+
+	if ((count != 2) || (u[0].val != 0) || (u[1].val != 1)) {
+		return test_fail("batch(2) got %u elements (%d, %d)", count, u[0].val, u[1].val);
+	}
+
+	count = sub.update_batch(u, queue_size);
+
+	if ((int)count != queue_size - 3) {
+		return test_fail("batch got %u elements, expected %d", count, queue_size - 3);
+	}
+
+	for (unsigned i = 0; i < count; ++i) {
+		if (u[i].val != (int)i + 2) {
+			return test_fail("batch element %u is %d, expected %d", i, u[i].val, i + 2);
+		}
+	}
+
+	test_note("  Testing overflow and wrap...");
+	const int overflow_by = 3;
+
+	for (int i = 0; i < queue_size + overflow_by; ++i) {
+		t.val = 100 + i;
+		orb_publish(ORB_ID(orb_test_medium_queue), ptopic, &t);
+	}
+
+	const unsigned last_generation = sub.get_last_generation();
+	count = sub.update_batch(u, queue_size);
+
+	if ((int)count != queue_size) {
+		return test_fail("batch got %u elements, expected %d", count, queue_size);
+	}
+
+	if (sub.get_last_generation() - last_generation != (unsigned)(queue_size + overflow_by)) {
+		return test_fail("lost elements not skipped in generation");
+	}
+
+	for (int i = 0; i < queue_size; ++i) {
+		if (u[i].val != 100 + overflow_by + i) {
+			return test_fail("batch element %d is %d, expected %d", i, u[i].val, 100 + overflow_by + i);
+		}
+	}
+
+	if (sub.update_batch(u, queue_size) != 0) {
+		return test_fail("spurious batch update after overflow");
+	}
+
+	orb_unadvertise(ptopic);
+
+	return test_note("PASS orb batch reads");
+}
+
 
 int uORBTest::UnitTest::pub_test_queue_entry(int argc, char *argv[])
 {
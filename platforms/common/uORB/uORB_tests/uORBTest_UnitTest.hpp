@@ -108,8 +108,13 @@ private:
 
 	int test_SubscriptionMulti();
 
+	int test_has_subscribers();
+
+	int test_update_set();
+
 	/* queuing tests */
 	int test_queue();
+	int test_queue_batch();
 	static int pub_test_queue_entry(int argc, char *argv[]);
 	int pub_test_queue_main();
 	int test_queue_poll_notify();
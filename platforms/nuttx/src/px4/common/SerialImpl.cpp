@@ -39,6 +39,7 @@
 #include <errno.h>
 #include <poll.h>
 #include <drivers/drv_hrt.h>
+#include <mathlib/mathlib.h>
 
 #define MODULE_NAME "SerialImpl"
 
@@ -306,6 +307,69 @@ ssize_t SerialImpl::readAtLeast(uint8_t *buffer, size_t buffer_size, size_t char
 	return total_bytes_read;
 }
 
+ssize_t SerialImpl::readFrame(uint8_t *buffer, size_t buffer_size, uint32_t timeout_us, uint64_t *timestamp)
+{
+	if (!_open) {
+		PX4_ERR("Cannot readFrame from serial device until it has been opened");
+		return -1;
+	}
+
+	const uint32_t character_time_us = SerialConfig::characterTime(_baudrate, _bytesize, _parity, _stopbits);
+
+	// poll() has a resolution of 1 ms
+	const int frame_gap_ms = math::max((int)((SerialConfig::FRAME_GAP_CHARACTERS * character_time_us + 999) / 1000), 1);
+
+	pollfd fds[1];
+	fds[0].fd = _serial_fd;
+	fds[0].events = POLLIN;
+
+	int ret = poll(fds, sizeof(fds) / sizeof(fds[0]), (timeout_us + 999) / 1000);
+
+	if (ret <= 0) {
+		return ret;
+	}
+
+	if (!(fds[0].revents & POLLIN)) {
+		PX4_ERR("Got a poll error");
+		return -1;
+	}
+
+	const hrt_abstime wakeup_time = hrt_absolute_time();
+
+	// everything already received at the wakeup was in transfer before it
+	int bytes_available = 0;
+
+	if (::ioctl(_serial_fd, FIONREAD, (unsigned long)&bytes_available) != 0) {
+		bytes_available = 1;
+	}
+
+	size_t total_bytes_read = 0;
+
+	while (total_bytes_read < buffer_size) {
+		ret = read(&buffer[total_bytes_read], buffer_size - total_bytes_read);
+
+		if (ret > 0) {
+			total_bytes_read += ret;
+		}
+
+		if (total_bytes_read >= buffer_size) {
+			break;
+		}
+
+		// the frame is complete once no more data arrives within the gap
+		if ((poll(fds, sizeof(fds) / sizeof(fds[0]), frame_gap_ms) <= 0) || !(fds[0].revents & POLLIN)) {
+			break;
+		}
+	}
+
+	if (timestamp != nullptr) {
+		const hrt_abstime transfer_time = math::min((hrt_abstime)bytes_available * character_time_us, wakeup_time);
+		*timestamp = wakeup_time - transfer_time;
+	}
+
+	return total_bytes_read;
+}
+
 ssize_t SerialImpl::write(const void *buffer, size_t buffer_size)
 {
 	if (!_open) {
@@ -144,6 +144,10 @@ hrt_ioctl(unsigned int cmd, unsigned long arg)
 		hrt_call_every(h->entry, h->time, h->interval, (hrt_callout)hrt_usr_call, h->entry);
 		break;
 
+	case HRT_CALL_EVERY_AT:
+		hrt_call_every_at(h->entry, h->time, h->interval, (hrt_callout)hrt_usr_call, h->entry);
+		break;
+
 	case HRT_CANCEL:
 		if (h && h->entry) {
 			hrt_cancel(h->entry);
@@ -43,6 +43,7 @@
 #include <stdio.h>
 
 #include <px4_platform/cpuload.h>
+#include <px4_platform_common/arena.h>
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/printload.h>
 #include <drivers/drv_hrt.h>
@@ -356,6 +357,21 @@ void print_load_buffer(char *buffer, int buffer_length, print_load_callback_f cb
 		cb(user);
 	}
 
+#endif
+#if defined(CONFIG_PX4_ARENA)
+	px4_arena_usage_s arena_usage;
+
+	if (px4_arena_get_usage(&arena_usage) == 0) {
+		snprintf(buffer, buffer_length, "Arena Memory: %" PRIu32 " total, %" PRIu32 " used %" PRIu32 " peak, %" PRIu32
+			 " free list, %" PRIu32 " to heap",
+			 arena_usage.total,
+			 arena_usage.used,
+			 arena_usage.peak,
+			 arena_usage.free_list,
+			 arena_usage.fallbacks);
+		cb(user);
+	}
+
 #endif
 	snprintf(buffer, buffer_length, "Uptime: %.3fs total, %.3fs idle",
 		 (double)print_state->new_time / 1e6, (double)total_runtime[0] / 1e6);
@@ -31,6 +31,7 @@
  *
  ****************************************************************************/
 
+#include <px4_platform_common/boot_trace.h>
 #include <px4_platform_common/init.h>
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/px4_config.h>
@@ -153,6 +154,8 @@ int px4_platform_init()
 
 	hrt_init();
 
+	const int trace = px4_boot_trace_begin("px4_platform_init");
+
 #if !defined(CONFIG_BUILD_FLAT)
 	hrt_ioctl_init();
 	events_ioctl_init();
@@ -194,6 +197,8 @@ int px4_platform_init()
 
 	px4_log_initialize();
 
+	px4_boot_trace_end(trace);
+
 	return PX4_OK;
 }
 
@@ -178,6 +178,24 @@ hrt_call_every(struct hrt_call *entry, hrt_abstime delay, hrt_abstime interval,
 	boardctl(HRT_CALL_EVERY, (uintptr_t)&ioc_parm);
 }
 
+/**
+ * Call callout(arg) at calltime, and then every period.
+ */
+void
+hrt_call_every_at(struct hrt_call *entry, hrt_abstime calltime, hrt_abstime interval, hrt_callout callout, void *arg)
+{
+	hrt_boardctl_t ioc_parm;
+	ioc_parm.entry = entry;
+	ioc_parm.time = calltime;
+	ioc_parm.interval = interval;
+	ioc_parm.callout = callout;
+	ioc_parm.arg = arg;
+	entry->usr_callout = callout;
+	entry->usr_arg = arg;
+
+	boardctl(HRT_CALL_EVERY_AT, (uintptr_t)&ioc_parm);
+}
+
 /**
  * Remove the entry from the callout list.
  */
@@ -57,11 +57,14 @@
 #define IOMUX_PULL_UP IOMUX_PULL_UP_47K
 #endif
 
-static const uint32_t gcr_decode[32] = {
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x9, 0xA, 0xB, 0x0, 0xD, 0xE, 0xF,
-	0x0, 0x0, 0x2, 0x3, 0x0, 0x5, 0x6, 0x7,
-	0x0, 0x0, 0x8, 0x1, 0x0, 0x4, 0xC, 0x0
+// GCR 5 bit symbol to nibble, GCR_INVALID for symbols that are not part of the code
+#define GCR_INVALID 0x10U
+
+static const uint8_t gcr_decode[32] = {
+	GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID,
+	GCR_INVALID, 0x9, 0xA, 0xB, GCR_INVALID, 0xD, 0xE, 0xF,
+	GCR_INVALID, GCR_INVALID, 0x2, 0x3, GCR_INVALID, 0x5, 0x6, 0x7,
+	GCR_INVALID, GCR_INVALID, 0x8, 0x1, GCR_INVALID, 0x4, 0xC, GCR_INVALID
 };
 
 uint32_t erpms[DSHOT_TIMERS];
@@ -85,6 +88,7 @@ typedef struct dshot_handler_t {
 	uint16_t                erpm;
 	uint32_t		crc_error_cnt;
 	uint32_t		frame_error_cnt;
+	uint32_t		gcr_error_cnt;
 	uint32_t		no_response_cnt;
 	uint32_t		last_no_response_cnt;
 } dshot_handler_t;
@@ -366,54 +370,63 @@ void up_bdshot_erpm(void)
 	uint8_t exponent;
 	uint16_t period;
 	uint16_t erpm;
+	uint32_t pending = bdshot_recv_mask;
 
 	bdshot_parsed_recv_mask = 0;
 
-	// Decode each individual channel
-	for (uint8_t channel = 0; (channel < DSHOT_TIMERS); channel++) {
-		if (bdshot_recv_mask & (1 << channel)) {
-			value = ~dshot_inst[channel].raw_response & 0xFFFFF;
+	// Decode all channels with a response received in this cycle
+	while (pending) {
+		const uint8_t channel = __builtin_ctz(pending);
+		pending &= pending - 1;
 
-			/* if lowest significant isn't 1 we've got a framing error */
-			if (value & 0x1) {
-				/* Decode RLL */
-				value = (value ^ (value >> 1));
+		value = ~dshot_inst[channel].raw_response & 0xFFFFF;
 
-				/* Decode GCR */
-				data = gcr_decode[value & 0x1fU];
-				data |= gcr_decode[(value >> 5U) & 0x1fU] << 4U;
-				data |= gcr_decode[(value >> 10U) & 0x1fU] << 8U;
-				data |= gcr_decode[(value >> 15U) & 0x1fU] << 12U;
+		/* if lowest significant isn't 1 we've got a framing error */
+		if (value & 0x1) {
+			/* Decode RLL */
+			value = (value ^ (value >> 1));
 
-				/* Calculate checksum */
-				csum_data = data;
-				csum_data = csum_data ^ (csum_data >> 8U);
-				csum_data = csum_data ^ (csum_data >> NIBBLES_SIZE);
+			/* Decode GCR, an invalid symbol sets a bit above its nibble */
+			const uint32_t gcr0 = gcr_decode[value & 0x1fU];
+			const uint32_t gcr1 = gcr_decode[(value >> 5U) & 0x1fU];
+			const uint32_t gcr2 = gcr_decode[(value >> 10U) & 0x1fU];
+			const uint32_t gcr3 = gcr_decode[(value >> 15U) & 0x1fU];
 
-				if ((csum_data & 0xFU) != 0xFU) {
-					dshot_inst[channel].crc_error_cnt++;
+			if ((gcr0 | gcr1 | gcr2 | gcr3) & GCR_INVALID) {
+				dshot_inst[channel].gcr_error_cnt++;
+				continue;
+			}
 
-				} else {
-					data = (data >> 4) & 0xFFF;
+			data = gcr0 | (gcr1 << 4U) | (gcr2 << 8U) | (gcr3 << 12U);
 
-					if (data == 0xFFF) {
-						erpm = 0;
+			/* Calculate checksum */
+			csum_data = data;
+			csum_data = csum_data ^ (csum_data >> 8U);
+			csum_data = csum_data ^ (csum_data >> NIBBLES_SIZE);
+
+			if ((csum_data & 0xFU) != 0xFU) {
+				dshot_inst[channel].crc_error_cnt++;
+
+			} else {
+				data = (data >> 4) & 0xFFF;
 
-					} else {
-						exponent = ((data >> 9U) & 0x7U); /* 3 bit: exponent */
-						period = (data & 0x1ffU); /* 9 bit: period base */
-						period = period << exponent; /* Period in usec */
-						erpm = ((1000000U * 60U / 100U + period / 2U) / period);
-					}
+				if (data == 0xFFF) {
+					erpm = 0;
 
-					dshot_inst[channel].erpm = erpm;
-					bdshot_parsed_recv_mask |= (1 << channel);
-					dshot_inst[channel].last_no_response_cnt = dshot_inst[channel].no_response_cnt;
+				} else {
+					exponent = ((data >> 9U) & 0x7U); /* 3 bit: exponent */
+					period = (data & 0x1ffU); /* 9 bit: period base */
+					period = period << exponent; /* Period in usec */
+					erpm = ((1000000U * 60U / 100U + period / 2U) / period);
 				}
 
-			} else {
-				dshot_inst[channel].frame_error_cnt++;
+				dshot_inst[channel].erpm = erpm;
+				bdshot_parsed_recv_mask |= (1 << channel);
+				dshot_inst[channel].last_no_response_cnt = dshot_inst[channel].no_response_cnt;
 			}
+
+		} else {
+			dshot_inst[channel].frame_error_cnt++;
 		}
 	}
 }
@@ -430,6 +443,31 @@ int up_bdshot_get_erpm(uint8_t channel, int *erpm)
 	return -1;
 }
 
+uint32_t up_bdshot_get_erpms(int *erpm, unsigned num_channels)
+{
+	uint32_t mask = bdshot_parsed_recv_mask;
+
+	if (num_channels < 32) {
+		mask &= (1U << num_channels) - 1U;
+	}
+
+	for (uint32_t pending = mask; pending != 0; pending &= pending - 1) {
+		const unsigned channel = __builtin_ctz(pending);
+		erpm[channel] = (int)dshot_inst[channel].erpm;
+	}
+
+	return mask;
+}
+
+uint32_t up_bdshot_get_error_count(uint8_t channel)
+{
+	if (channel < DSHOT_TIMERS) {
+		return dshot_inst[channel].crc_error_cnt + dshot_inst[channel].frame_error_cnt + dshot_inst[channel].gcr_error_cnt;
+	}
+
+	return 0;
+}
+
 int up_bdshot_channel_status(uint8_t channel)
 {
 	if (channel < DSHOT_TIMERS) {
@@ -447,9 +485,9 @@ void up_bdshot_status(void)
 		if (dshot_inst[channel].init) {
 			PX4_INFO("Channel %i %s Last erpm %i value", channel, up_bdshot_channel_status(channel) ? "online" : "offline",
 				 dshot_inst[channel].erpm);
-			PX4_INFO("CRC errors Frame error No response");
-			PX4_INFO("%10lu %11lu %11lu", dshot_inst[channel].crc_error_cnt, dshot_inst[channel].frame_error_cnt,
-				 dshot_inst[channel].no_response_cnt);
+			PX4_INFO("CRC errors Frame error GCR error No response");
+			PX4_INFO("%10lu %11lu %9lu %11lu", dshot_inst[channel].crc_error_cnt, dshot_inst[channel].frame_error_cnt,
+				 dshot_inst[channel].gcr_error_cnt, dshot_inst[channel].no_response_cnt);
 		}
 	}
 }
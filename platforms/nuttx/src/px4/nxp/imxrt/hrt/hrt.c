@@ -63,6 +63,7 @@
 
 #include <board_config.h>
 #include <drivers/drv_hrt.h>
+#include <px4_platform_common/hrt_callout_queue.h>
 
 
 #include "chip.h"
@@ -188,7 +189,10 @@
 /*
  * Queue of callout entries.
  */
-static struct sq_queue_s  callout_queue;
+static hrt_callout_queue_t	callout_queue;
+
+/* worst-case time spent entering a callout into the queue */
+static uint32_t			callout_enter_time_max;
 
 /* latency baseline (last compare value applied) */
 static uint32_t           latency_baseline;
@@ -594,7 +598,7 @@ hrt_store_absolute_time(volatile hrt_abstime *t)
 void
 hrt_init(void)
 {
-	sq_init(&callout_queue);
+	hrt_callout_queue_init(&callout_queue);
 	hrt_tim_init();
 
 #ifdef HRT_PPM_CHANNEL
@@ -638,21 +642,23 @@ hrt_call_every(struct hrt_call *entry, hrt_abstime delay, hrt_abstime interval,
 			  arg);
 }
 
+/**
+ * Call callout(arg) at calltime, and then every period.
+ */
+void
+hrt_call_every_at(struct hrt_call *entry, hrt_abstime calltime, hrt_abstime interval, hrt_callout callout, void *arg)
+{
+	hrt_call_internal(entry, calltime, interval, callout, arg);
+}
+
 static void
 hrt_call_internal(struct hrt_call *entry, hrt_abstime deadline, hrt_abstime interval, hrt_callout callout, void *arg)
 {
 	irqstate_t flags = px4_enter_critical_section();
 
 	/* if the entry is currently queued, remove it */
-	/* note that we are using a potentially uninitialized
-	   entry->link here, but it is safe as sq_rem() doesn't
-	   dereference the passed node unless it is found in the
-	   list. So we potentially waste a bit of time searching the
-	   queue for the uninitialized entry->link but we don't do
-	   anything actually unsafe.
-	*/
 	if (entry->deadline != 0) {
-		sq_rem(&entry->link, &callout_queue);
+		hrt_callout_queue_remove(&callout_queue, entry);
 	}
 
 	entry->deadline = deadline;
@@ -684,7 +690,7 @@ hrt_cancel(struct hrt_call *entry)
 {
 	irqstate_t flags = px4_enter_critical_section();
 
-	sq_rem(&entry->link, &callout_queue);
+	hrt_callout_queue_remove(&callout_queue, entry);
 	entry->deadline = 0;
 
 	/* if this is a periodic call being removed by the callout, prevent it from
@@ -695,29 +701,40 @@ hrt_cancel(struct hrt_call *entry)
 	px4_leave_critical_section(flags);
 }
 
+/**
+ * Get the callout queue statistics.
+ */
+void
+hrt_callout_stats(hrt_callout_stats_t *stats)
+{
+	irqstate_t flags = px4_enter_critical_section();
+
+	stats->count = callout_queue.count;
+	stats->count_max = callout_queue.count_max;
+	stats->enter_time_max = callout_enter_time_max;
+
+	struct hrt_call *next = hrt_callout_queue_peek(&callout_queue);
+	stats->next_deadline = (next != NULL) ? next->deadline : 0;
+
+	px4_leave_critical_section(flags);
+}
+
 static void
 hrt_call_enter(struct hrt_call *entry)
 {
-	struct hrt_call	*call, *next;
+	const hrt_abstime enter_start = hrt_absolute_time();
 
-	call = (struct hrt_call *)(void *)sq_peek(&callout_queue);
+	hrt_callout_queue_insert(&callout_queue, entry);
 
-	if ((call == NULL) || (entry->deadline < call->deadline)) {
-		sq_addfirst(&entry->link, &callout_queue);
-		hrtinfo("call enter at head, reschedule\n");
-		/* we changed the next deadline, reschedule the timer event */
-		hrt_call_reschedule();
+	const uint32_t enter_time = (uint32_t)(hrt_absolute_time() - enter_start);
 
-	} else {
-		do {
-			next = (struct hrt_call *)(void *)sq_next(&call->link);
+	if (enter_time > callout_enter_time_max) {
+		callout_enter_time_max = enter_time;
+	}
 
-			if ((next == NULL) || (entry->deadline < next->deadline)) {
-				hrtinfo("call enter after head\n");
-				sq_addafter(&call->link, &entry->link, &callout_queue);
-				break;
-			}
-		} while ((call = next) != NULL);
+	if (hrt_callout_queue_peek(&callout_queue) == entry) {
+		/* we changed the next deadline, reschedule the timer event */
+		hrt_call_reschedule();
 	}
 
 	hrtinfo("scheduled\n");
@@ -733,7 +750,7 @@ hrt_call_invoke(void)
 		/* get the current time */
 		hrt_abstime now = hrt_absolute_time();
 
-		call = (struct hrt_call *)(void *)sq_peek(&callout_queue);
+		call = hrt_callout_queue_peek(&callout_queue);
 
 		if (call == NULL) {
 			break;
@@ -743,7 +760,7 @@ hrt_call_invoke(void)
 			break;
 		}
 
-		sq_rem(&call->link, &callout_queue);
+		hrt_callout_queue_pop(&callout_queue);
 		hrtinfo("call pop\n");
 
 		/* save the intended deadline for periodic calls */
@@ -781,7 +798,7 @@ static void
 hrt_call_reschedule()
 {
 	hrt_abstime	now = hrt_absolute_time();
-	struct hrt_call	*next = (struct hrt_call *)(void *)sq_peek(&callout_queue);
+	struct hrt_call	*next = hrt_callout_queue_peek(&callout_queue);
 	hrt_abstime	deadline = now + HRT_INTERVAL_MAX;
 
 	/*
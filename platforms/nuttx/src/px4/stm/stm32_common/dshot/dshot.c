@@ -158,6 +158,18 @@ int up_bdshot_get_erpm(uint8_t channel, int *erpm)
 	return -1;
 }
 
+uint32_t up_bdshot_get_erpms(int *erpm, unsigned num_channels)
+{
+	// Not implemented
+	return 0;
+}
+
+uint32_t up_bdshot_get_error_count(uint8_t channel)
+{
+	// Not implemented
+	return 0;
+}
+
 int up_bdshot_channel_status(uint8_t channel)
 {
 	// Not implemented
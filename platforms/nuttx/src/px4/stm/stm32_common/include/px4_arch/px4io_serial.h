@@ -58,6 +58,13 @@ public:
 	virtual int	read(unsigned offset, void *data, unsigned count = 1);
 	virtual int	write(unsigned address, void *data, unsigned count = 1);
 
+	/**
+	 * Write registers and receive the registers the IO replies with in the same transaction.
+	 *
+	 * @return		Number of registers received, or -errno.
+	 */
+	int		exchange(unsigned address, const void *out, unsigned out_count, void *in, unsigned in_count);
+
 protected:
 	/**
 	 * Does the PX4IO_serial instance initialization.
@@ -0,0 +1,278 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file crypto_accel.c
+ *
+ * AES-CTR on the STM32H7 CRYP engine, with the data transferred by DMA.
+ */
+
+#include <px4_platform_common/px4_config.h>
+#include <px4_arch/crypto_accel.h>
+
+#include <board_config.h>
+#include <arch/board/board.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <nuttx/cache.h>
+#include <nuttx/semaphore.h>
+#include <arm_internal.h>
+
+#include "stm32_dma.h"
+#include "hardware/stm32_rcc.h"
+
+#if !defined(DMAMAP_CRYP_IN) || !defined(DMAMAP_CRYP_OUT)
+#  error "board.h needs to define DMAMAP_CRYP_IN and DMAMAP_CRYP_OUT (DMAMUX1 requests 78 and 79)"
+#endif
+
+#define CRYP_BASE		0x48021000
+#define CRYP_REG(_x)		(CRYP_BASE + (_x))
+#define CRYP_CR			CRYP_REG(0x00)
+#define CRYP_SR			CRYP_REG(0x04)
+#define CRYP_DIN		CRYP_REG(0x08)
+#define CRYP_DOUT		CRYP_REG(0x0c)
+#define CRYP_DMACR		CRYP_REG(0x10)
+#define CRYP_K0LR		CRYP_REG(0x20) ///< key registers K0LR..K3RR are consecutive
+#define CRYP_IV0LR		CRYP_REG(0x40) ///< IV registers IV0LR..IV1RR are consecutive
+
+#define CRYP_CR_ALGOMODE_AES_CTR	(6 << 3)
+#define CRYP_CR_DATATYPE_8BIT		(2 << 6)
+#define CRYP_CR_KEYSIZE_SHIFT		8
+#define CRYP_CR_FFLUSH			(1 << 14)
+#define CRYP_CR_CRYPEN			(1 << 15)
+
+#define CRYP_SR_BUSY			(1 << 4)
+
+#define CRYP_DMACR_DIEN			(1 << 0)
+#define CRYP_DMACR_DOEN			(1 << 1)
+
+#define RCC_AHB2ENR_CRYP		(1 << 4)
+
+/* the data is copied through DMA capable, cache line aligned buffers */
+#define CHUNK_SIZE			512
+#define CHUNK_TIMEOUT_MS		10
+
+static uint8_t g_in_buf[CHUNK_SIZE] __attribute__((aligned(ARMV7M_DCACHE_LINESIZE)));
+static uint8_t g_out_buf[CHUNK_SIZE] __attribute__((aligned(ARMV7M_DCACHE_LINESIZE)));
+
+static DMA_HANDLE g_dma_in;
+static DMA_HANDLE g_dma_out;
+static sem_t g_lock;		///< serializes the users of the engine
+static sem_t g_done;		///< posted by the output DMA callback
+static volatile uint8_t g_dma_status;
+static bool g_initialized;
+
+static inline uint32_t load_be32(const uint8_t *p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static void dma_out_callback(DMA_HANDLE handle, uint8_t status, void *arg)
+{
+	g_dma_status = status;
+	nxsem_post(&g_done);
+}
+
+int crypto_accel_init(void)
+{
+	if (g_initialized) {
+		return 0;
+	}
+
+	g_dma_in = stm32_dmachannel(DMAMAP_CRYP_IN);
+	g_dma_out = stm32_dmachannel(DMAMAP_CRYP_OUT);
+
+	if (g_dma_in == NULL || g_dma_out == NULL) {
+		if (g_dma_in) {
+			stm32_dmafree(g_dma_in);
+		}
+
+		if (g_dma_out) {
+			stm32_dmafree(g_dma_out);
+		}
+
+		return -EBUSY;
+	}
+
+	nxsem_init(&g_lock, 0, 1);
+	nxsem_init(&g_done, 0, 0);
+	nxsem_set_protocol(&g_done, SEM_PRIO_NONE);
+
+	modifyreg32(STM32_RCC_AHB2ENR, 0, RCC_AHB2ENR_CRYP);
+	putreg32(0, CRYP_CR);
+
+	g_initialized = true;
+	return 0;
+}
+
+/** process one chunk from g_in_buf to g_out_buf, the engine is set up already */
+static int process_chunk(size_t len)
+{
+	const size_t words = len / 4;
+
+	up_clean_dcache((uintptr_t)g_in_buf, (uintptr_t)g_in_buf + len);
+	up_invalidate_dcache((uintptr_t)g_out_buf, (uintptr_t)g_out_buf + len);
+
+	stm32_dmacfg_t outcfg;
+	outcfg.paddr = CRYP_DOUT;
+	outcfg.maddr = (uint32_t)g_out_buf;
+	outcfg.ndata = words;
+	outcfg.cfg1  = (DMA_SCR_DIR_P2M       |
+			DMA_SCR_MINC          |
+			DMA_SCR_PSIZE_32BITS  |
+			DMA_SCR_MSIZE_32BITS  |
+			DMA_SCR_PBURST_SINGLE |
+			DMA_SCR_MBURST_SINGLE);
+	outcfg.cfg2  = 0;
+
+	stm32_dmacfg_t incfg;
+	incfg.paddr = CRYP_DIN;
+	incfg.maddr = (uint32_t)g_in_buf;
+	incfg.ndata = words;
+	incfg.cfg1  = (DMA_SCR_DIR_M2P       |
+		       DMA_SCR_MINC          |
+		       DMA_SCR_PSIZE_32BITS  |
+		       DMA_SCR_MSIZE_32BITS  |
+		       DMA_SCR_PBURST_SINGLE |
+		       DMA_SCR_MBURST_SINGLE);
+	incfg.cfg2  = 0;
+
+	g_dma_status = 0;
+
+	/* output first, so that no output word is missed */
+	stm32_dmasetup(g_dma_out, &outcfg);
+	stm32_dmastart(g_dma_out, dma_out_callback, NULL, false);
+	stm32_dmasetup(g_dma_in, &incfg);
+	stm32_dmastart(g_dma_in, NULL, NULL, false);
+
+	putreg32(CRYP_DMACR_DIEN | CRYP_DMACR_DOEN, CRYP_DMACR);
+
+	int ret = nxsem_tickwait_uninterruptible(&g_done, MSEC2TICK(CHUNK_TIMEOUT_MS));
+
+	putreg32(0, CRYP_DMACR);
+
+	if (ret < 0) {
+		stm32_dmastop(g_dma_in);
+		stm32_dmastop(g_dma_out);
+		return ret;
+	}
+
+	if (g_dma_status & DMA_STATUS_TEIF) {
+		stm32_dmastop(g_dma_in);
+		stm32_dmastop(g_dma_out);
+		return -EIO;
+	}
+
+	up_invalidate_dcache((uintptr_t)g_out_buf, (uintptr_t)g_out_buf + len);
+	return 0;
+}
+
+int crypto_accel_aes_ctr(const uint8_t *key, size_t key_size, const uint8_t *nonce, uint32_t counter,
+			 const uint8_t *in, uint8_t *out, size_t len)
+{
+	uint32_t keysize_bits;
+
+	switch (key_size) {
+	case 16:
+		keysize_bits = 0;
+		break;
+
+	case 24:
+		keysize_bits = 1;
+		break;
+
+	case 32:
+		keysize_bits = 2;
+		break;
+
+	default:
+		return -EINVAL;
+	}
+
+	if (!g_initialized) {
+		return -ENODEV;
+	}
+
+	nxsem_wait_uninterruptible(&g_lock);
+
+	/* configure the engine with the key right-aligned in K0LR..K3RR and the counter block */
+	putreg32(0, CRYP_CR);
+	putreg32(CRYP_CR_ALGOMODE_AES_CTR | CRYP_CR_DATATYPE_8BIT | (keysize_bits << CRYP_CR_KEYSIZE_SHIFT), CRYP_CR);
+
+	const size_t key_words = key_size / 4;
+
+	for (size_t i = 0; i < key_words; i++) {
+		putreg32(load_be32(&key[i * 4]), CRYP_K0LR + (8 - key_words + i) * 4);
+	}
+
+	putreg32(load_be32(&nonce[0]), CRYP_IV0LR);
+	putreg32(load_be32(&nonce[4]), CRYP_IV0LR + 4);
+	putreg32(load_be32(&nonce[8]), CRYP_IV0LR + 8);
+	putreg32(counter, CRYP_IV0LR + 12);
+
+	modifyreg32(CRYP_CR, 0, CRYP_CR_FFLUSH);
+	modifyreg32(CRYP_CR, 0, CRYP_CR_CRYPEN);
+
+	int ret = 0;
+	size_t offset = 0;
+
+	/* the engine keeps incrementing the counter across chunks */
+	while (offset < len && ret == 0) {
+		const size_t remaining = len - offset;
+		const size_t size = remaining < CHUNK_SIZE ? remaining : CHUNK_SIZE;
+		const size_t padded = (size + CRYPTO_ACCEL_AES_BLOCK_SIZE - 1) & ~(size_t)(CRYPTO_ACCEL_AES_BLOCK_SIZE - 1);
+
+		memcpy(g_in_buf, &in[offset], size);
+		memset(&g_in_buf[size], 0, padded - size);
+
+		ret = process_chunk(padded);
+
+		if (ret == 0) {
+			memcpy(&out[offset], g_out_buf, size);
+		}
+
+		offset += size;
+	}
+
+	while (getreg32(CRYP_SR) & CRYP_SR_BUSY) {
+	}
+
+	putreg32(0, CRYP_CR);
+
+	nxsem_post(&g_lock);
+
+	return ret;
+}
@@ -0,0 +1,80 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file crypto_accel.h
+ *
+ * Interface to the STM32H7 CRYP engine, used by the crypto backend for AES.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#define CRYPTO_ACCEL_AES_BLOCK_SIZE 16
+#define CRYPTO_ACCEL_AES_NONCE_SIZE 12
+
+/**
+ * Enable the CRYP clock and allocate the DMA streams. The board needs to define
+ * DMAMAP_CRYP_IN and DMAMAP_CRYP_OUT in board.h.
+ * @return 0 on success, <0 errno otherwise
+ */
+int crypto_accel_init(void);
+
+/**
+ * AES-CTR en-/decryption. The counter block is the nonce followed by a big-endian 32 bit
+ * block counter, which the hardware increments per block (same as NIST SP 800-38A with a
+ * 96 bit nonce). The data is transferred by DMA; the calling thread sleeps until the
+ * transfer is done, so the CPU is free for other tasks in the meantime.
+ *
+ * @param key AES key
+ * @param key_size 16, 24 or 32
+ * @param nonce CRYPTO_ACCEL_AES_NONCE_SIZE bytes
+ * @param counter block counter of the first block in the data
+ * @param in input data
+ * @param out output data, can be the same as in
+ * @param len number of bytes. If this is not a multiple of the block size, the last block
+ *            is zero padded and the keystream of the remaining bytes is discarded.
+ * @return 0 on success, <0 errno otherwise
+ */
+int crypto_accel_aes_ctr(const uint8_t *key, size_t key_size, const uint8_t *nonce, uint32_t counter,
+			 const uint8_t *in, uint8_t *out, size_t len);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
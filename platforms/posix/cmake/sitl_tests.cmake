@@ -4,6 +4,7 @@
 
 # tests command arguments
 set(tests
+	AtomicIntrusiveQueue
 	atomic_bitset
 	bezier
 	bitset
@@ -23,6 +24,8 @@ set(tests
 	perf
 	search_min
 	sleep
+	SPSCQueue
+	TripleBuffer
 	versioning
 )
 
@@ -87,6 +90,20 @@ set_tests_properties(sitl-mavlink PROPERTIES PASS_REGULAR_EXPRESSION "ALL TESTS
 sanitizer_fail_test_on_error(sitl-mavlink)
 
 
+# Middleware microbenchmarks (results are informational, only failures are checked)
+add_test(NAME sitl-microbench
+	COMMAND $<TARGET_FILE:px4>
+		-s ${PX4_SOURCE_DIR}/posix-configs/SITL/init/test/test_microbench
+		-t ${PX4_SOURCE_DIR}/test_data
+		${PX4_SOURCE_DIR}/ROMFS/px4fmu_test
+	WORKING_DIRECTORY ${SITL_WORKING_DIR}
+)
+
+set_tests_properties(sitl-microbench PROPERTIES FAIL_REGULAR_EXPRESSION "FAIL")
+set_tests_properties(sitl-microbench PROPERTIES PASS_REGULAR_EXPRESSION "all PASSED")
+sanitizer_fail_test_on_error(sitl-microbench)
+
+
 # IMU filtering
 add_test(NAME sitl-imu_filtering
 	COMMAND $<TARGET_FILE:px4>
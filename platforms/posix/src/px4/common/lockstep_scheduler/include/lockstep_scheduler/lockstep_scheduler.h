@@ -100,4 +100,8 @@ private:
 	TimedWait *_timed_waits{nullptr}; ///< head of linked list
 	std::mutex _timed_waits_mutex;
 	std::atomic<bool> _setting_time{false}; ///< true if set_absolute_time() is currently being executed
+
+	// set_absolute_time() only walks the linked list once a timeout is due or there are entries to clean up
+	std::atomic<uint64_t> _next_timeout_us{UINT64_MAX}; ///< earliest pending timeout
+	std::atomic<bool> _cleanup_pending{false}; ///< true if a wait finished without timing out
 };
@@ -55,16 +55,47 @@ void LockstepScheduler::set_absolute_time(uint64_t time_us)
 
 	_time_us = time_us;
 
+	// Nothing to do until the earliest timeout. Waiters publish their timeout before checking the
+	// time (both sequentially consistent), so either we see it here or they see the new time.
+	if (time_us < _next_timeout_us && !_cleanup_pending) {
+		return;
+	}
+
 	{
 		std::unique_lock<std::mutex> lock_timed_waits(_timed_waits_mutex);
 		_setting_time = true;
+		_cleanup_pending = false;
+
+		uint64_t next_timeout_us = UINT64_MAX;
 
 		TimedWait *timed_wait = _timed_waits;
 		TimedWait *timed_wait_prev = nullptr;
 
 		while (timed_wait) {
-			// Clean up the ones that are already done from last iteration.
+			bool erase = false;
+
 			if (timed_wait->done) {
+				// Clean up the ones that are already done from last iteration.
+				erase = true;
+
+			} else if (timed_wait->time_us <= time_us &&
+				   !timed_wait->timeout) {
+				// We are abusing the condition here to signal that the time
+				// has passed.
+				pthread_mutex_lock(timed_wait->passed_lock);
+				timed_wait->timeout = true;
+				pthread_cond_broadcast(timed_wait->passed_cond);
+				pthread_mutex_unlock(timed_wait->passed_lock);
+
+				// Nothing is accessed through the list entry anymore once timed out,
+				// so it does not need to wait for another iteration to be erased.
+				erase = true;
+
+			} else if (!timed_wait->timeout && timed_wait->time_us < next_timeout_us) {
+				next_timeout_us = timed_wait->time_us;
+			}
+
+			if (erase) {
 				// Erase from the linked list
 				if (timed_wait_prev) {
 					timed_wait_prev->next = timed_wait->next;
@@ -79,20 +110,11 @@ void LockstepScheduler::set_absolute_time(uint64_t time_us)
 				continue;
 			}
 
-			if (timed_wait->time_us <= time_us &&
-			    !timed_wait->timeout) {
-				// We are abusing the condition here to signal that the time
-				// has passed.
-				pthread_mutex_lock(timed_wait->passed_lock);
-				timed_wait->timeout = true;
-				pthread_cond_broadcast(timed_wait->passed_cond);
-				pthread_mutex_unlock(timed_wait->passed_lock);
-			}
-
 			timed_wait_prev = timed_wait;
 			timed_wait = timed_wait->next;
 		}
 
+		_next_timeout_us = next_timeout_us;
 		_setting_time = false;
 	}
 }
@@ -110,6 +132,15 @@ int LockstepScheduler::cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *loc
 			return ETIMEDOUT;
 		}
 
+		if (time_us < _next_timeout_us) {
+			_next_timeout_us = time_us;
+		}
+
+		// The time might have been set in the meantime without seeing the new timeout.
+		if (time_us <= _time_us) {
+			return ETIMEDOUT;
+		}
+
 		timed_wait.time_us = time_us;
 		timed_wait.passed_cond = cond;
 		timed_wait.passed_lock = lock;
@@ -134,6 +165,11 @@ int LockstepScheduler::cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *loc
 
 	timed_wait.done = true;
 
+	if (!timeout) {
+		// still in the linked list, have it cleaned up with the next time update
+		_cleanup_pending = true;
+	}
+
 	if (!timeout && _setting_time) {
 		// This is where it gets tricky: the timeout has not been triggered yet,
 		// and another thread is in set_absolute_time().
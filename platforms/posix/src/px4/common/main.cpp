@@ -78,6 +78,7 @@
 #include "px4_daemon/client.h"
 #include "px4_daemon/server.h"
 #include "px4_daemon/pxh.h"
+#include "px4_daemon/snapshot.h"
 
 #define MODULE_NAME "px4"
 
@@ -108,6 +109,7 @@ static void wait_to_exit();
 static int get_server_running(int instance, bool *is_running);
 static int set_server_running(int instance);
 static void print_usage();
+static int run_monitoring_client(int argc, char **argv);
 static bool dir_exists(const std::string &path);
 static bool file_exists(const std::string &name);
 static std::string file_basename(std::string const &pathname);
@@ -150,6 +152,10 @@ int main(int argc, char **argv)
 		absolute_binary_path = get_absolute_binary_path(full_binary_name);
 	}
 
+	if (argc >= 2 && (strcmp(argv[1], "--session") == 0 || strcmp(argv[1], "--snapshot") == 0)) {
+		return run_monitoring_client(argc, argv);
+	}
+
 	if (is_client) {
 		if (argc >= 3 && strcmp(argv[1], "--instance") == 0) {
 			instance = strtoul(argv[2], nullptr, 10);
@@ -633,6 +639,61 @@ void print_usage()
 	printf("\n");
 	printf("    px4-MODULE [--instance <instance>] command using symlink.\n");
 	printf("        e.g.: px4-commander status\n");
+	printf("\n");
+	printf("    px4 --session [-i <instance>]\n");
+	printf("        run the commands read from stdin (one per line) over a single connection,\n");
+	printf("        each command's output is followed by a line '%s <return value>'\n", px4_daemon::Client::SESSION_END_MARKER);
+	printf("    px4 --snapshot <perf|top|work_queue> [-i <instance>]\n");
+	printf("        print the latest status snapshot (requires 'status_snapshot start' in the server)\n");
+}
+
+int run_monitoring_client(int argc, char **argv)
+{
+	const bool session = strcmp(argv[1], "--session") == 0;
+	const char *snapshot_name = nullptr;
+	int instance = 0;
+
+	for (int i = 2; i < argc; ++i) {
+		if ((strcmp(argv[i], "-i") == 0 || strcmp(argv[i], "--instance") == 0) && i + 1 < argc) {
+			instance = strtoul(argv[++i], nullptr, 10);
+
+		} else if (!session && snapshot_name == nullptr) {
+			snapshot_name = argv[i];
+
+		} else {
+			print_usage();
+			return PX4_ERROR;
+		}
+	}
+
+	if (!session) {
+		if (snapshot_name == nullptr) {
+			print_usage();
+			return PX4_ERROR;
+		}
+
+		std::string output;
+		uint32_t age_ms = 0;
+
+		if (px4_daemon::StatusSnapshot::read(instance, snapshot_name, output, age_ms) != 0) {
+			PX4_ERR("no '%s' snapshot available for instance %i", snapshot_name, instance);
+			return PX4_ERROR;
+		}
+
+		fwrite(output.data(), output.size(), 1, stdout);
+		printf("(snapshot age: %u ms)\n", (unsigned)age_ms);
+		return PX4_OK;
+	}
+
+	bool server_is_running = false;
+
+	if (get_server_running(instance, &server_is_running) != PX4_OK || !server_is_running) {
+		PX4_ERR("PX4 server not running");
+		return PX4_ERROR;
+	}
+
+	px4_daemon::Client client(instance);
+	return client.run_session(stdin);
 }
 
 int get_server_running(int instance, bool *is_server_running)
@@ -48,6 +48,7 @@
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <string>
 
 #include <px4_platform_common/log.h>
@@ -63,6 +64,67 @@ Client::Client(int instance_id) :
 
 int
 Client::process_args(const int argc, const char **argv)
+{
+	if (_connect() != 0) {
+		return -1;
+	}
+
+	int ret = _send_cmds(argc, argv);
+
+	if (ret != 0) {
+		PX4_ERR("Could not send commands");
+		return -3;
+	}
+
+	return _listen();
+}
+
+int
+Client::run_session(FILE *in)
+{
+	if (_connect() != 0) {
+		return -1;
+	}
+
+	const uint8_t flags = CMD_FLAG_SESSION | (isatty(STDOUT_FILENO) ? CMD_FLAG_ISATTY : 0);
+	char *line = nullptr;
+	size_t line_size = 0;
+	ssize_t line_length;
+	int ret = 0;
+
+	while ((line_length = getline(&line, &line_size, in)) >= 0) {
+		std::string cmd_buf(line, line_length);
+
+		// strip the line end and anything that would be taken as command flags
+		cmd_buf.erase(std::remove_if(cmd_buf.begin(), cmd_buf.end(), [](char c) {
+			return (uint8_t)c <= CMD_FLAGS_MAX || c == '\n' || c == '\r';
+		}), cmd_buf.end());
+
+		cmd_buf.push_back(flags);
+
+		if (_send(cmd_buf) != 0) {
+			ret = -1;
+			break;
+		}
+
+		const int retval = _listen_reply();
+
+		if (retval < -128) {
+			// connection lost
+			ret = -1;
+			break;
+		}
+
+		printf("%s %d\n", SESSION_END_MARKER, retval);
+		fflush(stdout);
+	}
+
+	free(line);
+	return ret;
+}
+
+int
+Client::_connect()
 {
 	std::string sock_path = get_socket_path(_instance_id);
 
@@ -82,14 +144,7 @@ Client::process_args(const int argc, const char **argv)
 		return -1;
 	}
 
-	int ret = _send_cmds(argc, argv);
-
-	if (ret != 0) {
-		PX4_ERR("Could not send commands");
-		return -3;
-	}
-
-	return _listen();
+	return 0;
 }
 
 int
@@ -108,8 +163,14 @@ Client::_send_cmds(const int argc, const char **argv)
 	}
 
 	// Last byte is 'isatty'.
-	cmd_buf.push_back(isatty(STDOUT_FILENO));
+	cmd_buf.push_back(isatty(STDOUT_FILENO) ? CMD_FLAG_ISATTY : 0);
+
+	return _send(cmd_buf);
+}
 
+int
+Client::_send(const std::string &cmd_buf)
+{
 	size_t n = cmd_buf.size();
 	const char *buf = cmd_buf.data();
 
@@ -177,6 +238,43 @@ Client::_listen()
 	}
 }
 
+int
+Client::_listen_reply()
+{
+	// In a session the stream doesn't end after a command: the reply ends at {0, retval}.
+	char buffer[1024];
+	bool end = false;
+
+	while (true) {
+		int n_read = read(_fd, buffer, sizeof buffer);
+
+		if (n_read <= 0) {
+			PX4_ERR("connection lost");
+			return -129;
+		}
+
+		for (int i = 0; i < n_read; i++) {
+			if (end) {
+				// the server doesn't send anything after the return value before the next command
+				return (int8_t)buffer[i];
+			}
+
+			if (buffer[i] == 0) {
+				fwrite(buffer, i, 1, stdout);
+				end = true;
+
+				if (i + 1 < n_read) {
+					return (int8_t)buffer[i + 1];
+				}
+			}
+		}
+
+		if (!end) {
+			fwrite(buffer, n_read, 1, stdout);
+		}
+	}
+}
+
 Client::~Client()
 {
 	if (_fd >= 0) {
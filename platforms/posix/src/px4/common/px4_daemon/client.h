@@ -40,6 +40,10 @@
  * It the client dies, the connection gets closed automatically and the corresponding
  * thread in the server gets cancelled.
  *
+ * In session mode the connection stays open, and commands are read line by line
+ * from stdin and executed one after the other. This avoids starting a process and
+ * a server thread for every command of monitoring scripts.
+ *
  * @author Julian Oes <julian@oes.ch>
  * @author Beat Küng <beat-kueng@gmx.net>
  * @author Mara Bos <m-ou.se@m-ou.se>
@@ -47,6 +51,8 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdio.h>
+#include <string>
 
 #include "sock_protocol.h"
 
@@ -76,9 +82,23 @@ public:
 	 */
 	int process_args(const int argc, const char **argv);
 
+	/**
+	 * Run a session: execute each line of the input as a command over one connection.
+	 * After the output of each command a line with SESSION_END_MARKER and the return value is printed.
+	 *
+	 * @param in: commands, one per line
+	 * @return 0 on success, -1 if the connection failed
+	 */
+	int run_session(FILE *in);
+
+	static constexpr const char *SESSION_END_MARKER = "px4-session-end";
+
 private:
+	int _connect();
 	int _send_cmds(const int argc, const char **argv);
+	int _send(const std::string &cmd_buf);
 	int _listen();
+	int _listen_reply();
 
 	int _fd;
 	int _instance_id; ///< instance ID for running multiple instances of the px4 server
@@ -46,11 +46,16 @@
 #include <vector>
 #include <algorithm>
 #include <stdio.h>
+#include <stdlib.h>
 #include <poll.h>
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <px4_platform_common/log.h>
+
 #include "pxh.h"
+#include "server.h"
+#include "snapshot.h"
 
 namespace px4_daemon
 {
@@ -124,6 +129,9 @@ int Pxh::process_line(const std::string &line, bool silently_fail)
 		list_builtins(_apps);
 		return 0;
 
+	} else if (command == "status_snapshot") {
+		return _status_snapshot_command(words);
+
 	} else if (command.length() == 0 || command[0] == '#') {
 		// Do nothing
 		return 0;
@@ -138,6 +146,33 @@ int Pxh::process_line(const std::string &line, bool silently_fail)
 	}
 }
 
+int Pxh::_status_snapshot_command(const std::vector<std::string> &words)
+{
+	if (words.size() >= 2 && words[1] == "start") {
+		const uint32_t interval_ms = (words.size() >= 3) ? strtoul(words[2].c_str(), nullptr, 10) : 1000;
+
+		if (interval_ms < 100) {
+			PX4_INFO_RAW("interval must be at least 100 ms\n");
+			return -1;
+		}
+
+		return StatusSnapshot::start(Server::is_running() ? Server::get_instance_id() : 0, interval_ms);
+
+	} else if (words.size() >= 2 && words[1] == "stop") {
+		StatusSnapshot::stop();
+		return 0;
+
+	} else if (words.size() >= 2 && words[1] == "status") {
+		PX4_INFO_RAW("status snapshot %s\n", StatusSnapshot::is_running() ? "running" : "not running");
+		return 0;
+	}
+
+	PX4_INFO_RAW("usage: status_snapshot {start [interval_ms]|stop|status}\n");
+	PX4_INFO_RAW("  periodically store the output of perf, top and work_queue in shared memory,\n");
+	PX4_INFO_RAW("  read with 'px4 --snapshot <perf|top|work_queue>'\n");
+	return 1;
+}
+
 void Pxh::_check_remote_uorb_command(std::string &line)
 {
 
@@ -88,6 +88,8 @@ private:
 	void _tab_completion(std::string &prefix);
 	void _check_remote_uorb_command(std::string &line);
 
+	static int _status_snapshot_command(const std::vector<std::string> &words);
+
 	void _setup_term();
 	static void _restore_term();
 
@@ -51,6 +51,7 @@
 #include <sys/types.h>
 #include <sys/un.h>
 #include <vector>
+#include <algorithm>
 
 #include <px4_platform_common/log.h>
 
@@ -238,60 +239,72 @@ void
 	FILE *out = (FILE *)arg;
 	int fd = fileno(out);
 
-	// Read until the end of the incoming stream.
-	std::string cmd;
+	std::string received;
+	bool session = true;
 
-	while (true) {
-		size_t n = cmd.size();
-		cmd.resize(n + 1024);
-		ssize_t n_read = read(fd, &cmd[n], cmd.size() - n);
+	// A session client sends further commands after each reply, otherwise there is only one command.
+	while (session) {
+		size_t cmd_end = std::string::npos;
 
-		if (n_read <= 0) {
-			_cleanup(fd);
-			return nullptr;
+		// Read until the end of the command: a byte with the command flags.
+		while (true) {
+			cmd_end = std::find_if(received.begin(), received.end(), [](char c) {
+				return (uint8_t)c <= CMD_FLAGS_MAX;
+			}) - received.begin();
+
+			if (cmd_end < received.size()) {
+				break;
+			}
+
+			size_t n = received.size();
+			received.resize(n + 1024);
+			ssize_t n_read = read(fd, &received[n], received.size() - n);
+
+			if (n_read <= 0) {
+				_cleanup(fd);
+				return nullptr;
+			}
+
+			received.resize(n + n_read);
 		}
 
-		cmd.resize(n + n_read);
+		std::string cmd = received.substr(0, cmd_end);
+		const uint8_t flags = received[cmd_end];
+		received.erase(0, cmd_end + 1);
 
-		// Command ends in 0x00 (no tty) or 0x01 (tty).
-		if (!cmd.empty() && cmd.back() < 2) {
-			break;
+		session = (flags & CMD_FLAG_SESSION);
+
+		if (cmd.empty() && !session) {
+			_cleanup(fd);
+			return nullptr;
 		}
-	}
 
-	if (cmd.size() < 2) {
-		_cleanup(fd);
-		return nullptr;
-	}
+		// We register thread specific data. This is used for PX4_INFO (etc.) log calls.
+		CmdThreadSpecificData *thread_data_ptr;
 
-	// Last byte is 'isatty'.
-	uint8_t isatty = cmd.back();
-	cmd.pop_back();
+		if ((thread_data_ptr = (CmdThreadSpecificData *)pthread_getspecific(_instance->_key)) == nullptr) {
+			thread_data_ptr = new CmdThreadSpecificData;
+			thread_data_ptr->thread_stdout = out;
 
-	// We register thread specific data. This is used for PX4_INFO (etc.) log calls.
-	CmdThreadSpecificData *thread_data_ptr;
+			(void)pthread_setspecific(_instance->_key, (void *)thread_data_ptr);
+		}
 
-	if ((thread_data_ptr = (CmdThreadSpecificData *)pthread_getspecific(_instance->_key)) == nullptr) {
-		thread_data_ptr = new CmdThreadSpecificData;
-		thread_data_ptr->thread_stdout = out;
-		thread_data_ptr->is_atty = isatty;
+		thread_data_ptr->is_atty = (flags & CMD_FLAG_ISATTY);
 
-		(void)pthread_setspecific(_instance->_key, (void *)thread_data_ptr);
-	}
+		// Run the actual command.
+		int retval = Pxh::process_line(cmd, true);
 
-	// Run the actual command.
-	int retval = Pxh::process_line(cmd, true);
+		// Report return value.
+		char buf[2] = {0, (char)retval};
 
-	// Report return value.
-	char buf[2] = {0, (char)retval};
+		if (fwrite(buf, sizeof buf, 1, out) != 1) {
+			// Don't care it went wrong, as we're cleaning up anyway.
+		}
 
-	if (fwrite(buf, sizeof buf, 1, out) != 1) {
-		// Don't care it went wrong, as we're cleaning up anyway.
+		// Flush the FILE*'s buffer before we shut down the connection or wait for the next command.
+		fflush(out);
 	}
 
-	// Flush the FILE*'s buffer before we shut down the connection.
-	fflush(out);
-
 	_cleanup(fd);
 	return nullptr;
 }
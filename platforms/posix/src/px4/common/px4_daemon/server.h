@@ -89,6 +89,11 @@ public:
 	{
 		return _instance->_key;
 	}
+
+	static int get_instance_id()
+	{
+		return _instance->_instance_id;
+	}
 private:
 	static void *_server_main_trampoline(void *arg);
 	void _server_main();
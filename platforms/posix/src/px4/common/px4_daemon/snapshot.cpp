@@ -0,0 +1,331 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file snapshot.cpp
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include <px4_platform_common/log.h>
+
+#include "pxh.h"
+#include "server.h"
+#include "snapshot.h"
+
+namespace px4_daemon
+{
+
+StatusSnapshot *StatusSnapshot::_instance = nullptr;
+
+// snapshot entries and the commands producing them
+static constexpr struct {
+	const char *name;
+	const char *command;
+} snapshot_commands[] = {
+	{"perf", "perf"},
+	{"top", "top once"},
+	{"work_queue", "work_queue status"},
+};
+
+static_assert(sizeof(snapshot_commands) / sizeof(snapshot_commands[0]) <= StatusSnapshot::MAX_ENTRIES,
+	      "too many snapshot commands");
+
+// real time, also in lockstep simulation, and comparable between processes
+static uint64_t monotonic_us()
+{
+	struct timespec ts {};
+	::clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+std::string StatusSnapshot::get_shm_name(int instance_id)
+{
+	return "/px4-status-" + std::to_string(instance_id);
+}
+
+int StatusSnapshot::start(int instance_id, uint32_t interval_ms)
+{
+	if (_instance) {
+		PX4_INFO("already running");
+		return 0;
+	}
+
+	if (!Server::is_running()) {
+		PX4_ERR("server not running");
+		return -1;
+	}
+
+	StatusSnapshot *snapshot = new StatusSnapshot(instance_id, interval_ms);
+
+	if (snapshot->_open() != 0) {
+		delete snapshot;
+		return -1;
+	}
+
+	if (pthread_create(&snapshot->_thread, nullptr, _thread_trampoline, snapshot) != 0) {
+		PX4_ERR("error creating snapshot thread");
+		delete snapshot;
+		return -1;
+	}
+
+	_instance = snapshot;
+	return 0;
+}
+
+void StatusSnapshot::stop()
+{
+	if (_instance) {
+		_instance->_should_exit.store(true);
+		pthread_join(_instance->_thread, nullptr);
+		delete _instance;
+		_instance = nullptr;
+	}
+}
+
+StatusSnapshot::~StatusSnapshot()
+{
+	if (_segment) {
+		munmap(_segment, sizeof(Segment));
+	}
+
+	if (_fd >= 0) {
+		close(_fd);
+		shm_unlink(get_shm_name(_instance_id).c_str());
+	}
+}
+
+int StatusSnapshot::_open()
+{
+	const std::string shm_name = get_shm_name(_instance_id);
+
+	// a previous instance may have crashed
+	shm_unlink(shm_name.c_str());
+
+	_fd = shm_open(shm_name.c_str(), O_CREAT | O_RDWR, 0644);
+
+	if (_fd < 0) {
+		PX4_ERR("shm_open %s failed: %s", shm_name.c_str(), strerror(errno));
+		return -1;
+	}
+
+	if (ftruncate(_fd, sizeof(Segment)) != 0) {
+		PX4_ERR("ftruncate failed: %s", strerror(errno));
+		return -1;
+	}
+
+	void *addr = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+
+	if (addr == MAP_FAILED) {
+		PX4_ERR("mmap failed: %s", strerror(errno));
+		return -1;
+	}
+
+	_segment = (Segment *)addr;
+	_segment->sequence.store(0);
+	_segment->count = 0;
+	_segment->timestamp_us = 0;
+	_segment->interval_ms = _interval_ms;
+	_segment->version = VERSION;
+	_segment->magic = MAGIC;
+
+	return 0;
+}
+
+void *StatusSnapshot::_thread_trampoline(void *arg)
+{
+	((StatusSnapshot *)arg)->_thread_main();
+	return nullptr;
+}
+
+void StatusSnapshot::_thread_main()
+{
+	// the command output goes to a memory stream instead of a client socket (see get_stdout())
+	Server::CmdThreadSpecificData *thread_data = new Server::CmdThreadSpecificData{nullptr, false};
+	pthread_setspecific(Server::get_pthread_key(), thread_data);
+
+	while (!_should_exit.load()) {
+		const uint64_t start_us = monotonic_us();
+
+		_update();
+
+		// sleep in short steps to stop quickly
+		while (!_should_exit.load() && (monotonic_us() - start_us < _interval_ms * 1000ull)) {
+			poll(nullptr, 0, 50);
+		}
+	}
+
+	pthread_setspecific(Server::get_pthread_key(), nullptr);
+	delete thread_data;
+}
+
+void StatusSnapshot::_update()
+{
+	Server::CmdThreadSpecificData *thread_data = (Server::CmdThreadSpecificData *)pthread_getspecific(
+				Server::get_pthread_key());
+
+	std::string outputs[MAX_ENTRIES];
+	int count = 0;
+
+	// run the commands outside of the write section, readers only wait for the copy
+	for (const auto &snapshot_command : snapshot_commands) {
+		char *buffer = nullptr;
+		size_t length = 0;
+		FILE *stream = open_memstream(&buffer, &length);
+
+		if (stream == nullptr) {
+			return;
+		}
+
+		thread_data->thread_stdout = stream;
+		Pxh::process_line(snapshot_command.command, true);
+		thread_data->thread_stdout = nullptr;
+
+		fclose(stream);
+		outputs[count++].assign(buffer, length);
+		free(buffer);
+	}
+
+	const uint32_t sequence = _segment->sequence.load(std::memory_order_relaxed);
+	_segment->sequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	size_t offset = 0;
+
+	for (int i = 0; i < count; i++) {
+		Entry &entry = _segment->entries[i];
+		const size_t length = std::min(outputs[i].size(), DATA_SIZE - offset);
+
+		strncpy(entry.name, snapshot_commands[i].name, NAME_LENGTH - 1);
+		entry.name[NAME_LENGTH - 1] = '\0';
+		entry.offset = offset;
+		entry.length = length;
+		memcpy(&_segment->data[offset], outputs[i].data(), length);
+		offset += length;
+	}
+
+	_segment->count = count;
+	_segment->timestamp_us = monotonic_us();
+
+	_segment->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+int StatusSnapshot::read(int instance_id, const std::string &name, std::string &output, uint32_t &age_ms)
+{
+	const std::string shm_name = get_shm_name(instance_id);
+	int fd = shm_open(shm_name.c_str(), O_RDONLY, 0);
+
+	if (fd < 0) {
+		PX4_ERR("no status snapshot (%s), run 'status_snapshot start' in px4", shm_name.c_str());
+		return -1;
+	}
+
+	void *addr = mmap(nullptr, sizeof(Segment), PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (addr == MAP_FAILED) {
+		PX4_ERR("mmap failed: %s", strerror(errno));
+		return -1;
+	}
+
+	const Segment *segment = (const Segment *)addr;
+	int ret = -1;
+
+	if ((segment->magic != MAGIC) || (segment->version != VERSION)) {
+		PX4_ERR("snapshot version mismatch");
+		munmap(addr, sizeof(Segment));
+		return -1;
+	}
+
+	for (int attempt = 0; attempt < 100; attempt++) {
+		const uint32_t sequence = segment->sequence.load(std::memory_order_acquire);
+
+		if ((sequence & 1) || (sequence == 0)) {
+			// being written or not written yet
+			poll(nullptr, 0, 10);
+			continue;
+		}
+
+		const uint32_t count = std::min(segment->count, (uint32_t)MAX_ENTRIES);
+		const uint64_t timestamp_us = segment->timestamp_us;
+		output.clear();
+		ret = -ENOENT;
+
+		for (uint32_t i = 0; i < count; i++) {
+			const Entry &entry = segment->entries[i];
+			const std::string entry_name(entry.name, strnlen(entry.name, NAME_LENGTH));
+
+			if (name.empty()) {
+				output += entry_name + "\n";
+				ret = 0;
+
+			} else if ((entry_name == name) && (entry.offset + entry.length <= DATA_SIZE)) {
+				output.assign(&segment->data[entry.offset], entry.length);
+				ret = 0;
+			}
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if (segment->sequence.load(std::memory_order_relaxed) == sequence) {
+			age_ms = (monotonic_us() - timestamp_us) / 1000;
+			break;
+		}
+
+		ret = -1;
+	}
+
+	munmap(addr, sizeof(Segment));
+
+	if (ret == -ENOENT) {
+		PX4_ERR("no snapshot entry '%s'", name.c_str());
+
+	} else if (ret != 0) {
+		PX4_ERR("snapshot not ready");
+	}
+
+	return ret;
+}
+
+} // namespace px4_daemon
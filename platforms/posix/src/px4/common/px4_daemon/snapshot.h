@@ -0,0 +1,127 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file snapshot.h
+ *
+ * Status snapshots in shared memory.
+ *
+ * The server periodically runs a fixed set of status commands (perf, top, work_queue)
+ * in a low priority thread and stores their output in a POSIX shared memory segment.
+ * Monitoring clients read the last snapshot without connecting to the server, so the
+ * number of monitoring requests does not add load to the running system.
+ *
+ * The segment is guarded by a sequence counter (odd while being written), readers
+ * retry until they got a consistent copy.
+ */
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <pthread.h>
+#include <string>
+
+namespace px4_daemon
+{
+
+class StatusSnapshot
+{
+public:
+	static constexpr uint32_t MAGIC = 0x50583453; // "PX4S"
+	static constexpr uint32_t VERSION = 1;
+	static constexpr int MAX_ENTRIES = 4;
+	static constexpr size_t NAME_LENGTH = 32;
+	static constexpr size_t DATA_SIZE = 192 * 1024;
+
+	struct Entry {
+		char name[NAME_LENGTH];
+		uint32_t offset;
+		uint32_t length;
+	};
+
+	struct Segment {
+		uint32_t magic;
+		uint32_t version;
+		std::atomic<uint32_t> sequence;
+		uint32_t count;
+		uint64_t timestamp_us; ///< hrt time of the last update
+		uint32_t interval_ms;
+		Entry entries[MAX_ENTRIES];
+		char data[DATA_SIZE];
+	};
+
+	/**
+	 * Start updating the snapshot of this server instance.
+	 * @param interval_ms: update interval
+	 * @return 0 on success
+	 */
+	static int start(int instance_id, uint32_t interval_ms);
+
+	static void stop();
+
+	static bool is_running() { return _instance != nullptr; }
+
+	/**
+	 * Read a snapshot entry (client side, read-only mapping).
+	 * @param name: entry name (perf, top, work_queue), or empty to list the entries
+	 * @param output: entry text
+	 * @param age_ms: age of the snapshot
+	 * @return 0 on success
+	 */
+	static int read(int instance_id, const std::string &name, std::string &output, uint32_t &age_ms);
+
+	static std::string get_shm_name(int instance_id);
+
+private:
+	StatusSnapshot(int instance_id, uint32_t interval_ms) : _instance_id(instance_id), _interval_ms(interval_ms) {}
+	~StatusSnapshot();
+
+	int _open();
+	void _update();
+
+	static void *_thread_trampoline(void *arg);
+	void _thread_main();
+
+	int _instance_id;
+	uint32_t _interval_ms;
+
+	int _fd{-1};
+	Segment *_segment{nullptr};
+
+	pthread_t _thread{};
+	std::atomic<bool> _should_exit{false};
+
+	static StatusSnapshot *_instance;
+};
+
+} // namespace px4_daemon
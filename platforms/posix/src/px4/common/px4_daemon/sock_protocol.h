@@ -37,6 +37,7 @@
  */
 #pragma once
 
+#include <stdint.h>
 #include <string>
 
 namespace px4_daemon
@@ -44,5 +45,10 @@ namespace px4_daemon
 
 std::string get_socket_path(int instance_id);
 
+// The last byte of a command holds these flags
+static constexpr uint8_t CMD_FLAG_ISATTY = 1; ///< client stdout is a terminal
+static constexpr uint8_t CMD_FLAG_SESSION = 2; ///< keep the connection open for further commands
+static constexpr uint8_t CMD_FLAGS_MAX = CMD_FLAG_ISATTY | CMD_FLAG_SESSION;
+
 } // namespace px4_daemon
 
@@ -31,6 +31,7 @@
  *
  ****************************************************************************/
 
+#include <px4_platform_common/boot_trace.h>
 #include <px4_platform_common/init.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/defines.h>
@@ -48,6 +49,8 @@ int px4_platform_init(void)
 {
 	hrt_init();
 
+	const int trace = px4_boot_trace_begin("px4_platform_init");
+
 	px4::WorkQueueManagerStart();
 
 // MUORB has slightly different startup requirements
@@ -71,5 +74,7 @@ int px4_platform_init(void)
 
 	px4_log_initialize();
 
+	px4_boot_trace_end(trace);
+
 	return PX4_OK;
 }
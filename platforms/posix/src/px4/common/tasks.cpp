@@ -221,6 +221,27 @@ px4_task_t px4_task_spawn_cmd(const char *name, int scheduler, int priority, int
 		return (rv < 0) ? rv : -rv;
 	}
 
+#if defined(__PX4_LINUX) && defined(CONFIG_PX4_THREAD_DEFAULT_AFFINITY)
+
+	if (CONFIG_PX4_THREAD_DEFAULT_AFFINITY != 0) {
+		cpu_set_t cpuset;
+		CPU_ZERO(&cpuset);
+
+		for (unsigned cpu = 0; cpu < 32; cpu++) {
+			if (CONFIG_PX4_THREAD_DEFAULT_AFFINITY & (1u << cpu)) {
+				CPU_SET(cpu, &cpuset);
+			}
+		}
+
+		rv = pthread_attr_setaffinity_np(&attr, sizeof(cpuset), &cpuset);
+
+		if (rv != 0) {
+			PX4_WARN("px4_task_spawn_cmd: failed to set affinity for %s (%i)", name, rv);
+		}
+	}
+
+#endif // __PX4_LINUX && CONFIG_PX4_THREAD_DEFAULT_AFFINITY
+
 	pthread_mutex_lock(&task_mutex);
 
 	px4_task_t taskid = 0;
@@ -36,6 +36,7 @@
 #include <px4_log.h>
 #include <drivers/device/qurt/uart.h>
 #include <drivers/drv_hrt.h>
+#include <mathlib/mathlib.h>
 
 namespace device
 {
@@ -238,6 +239,55 @@ ssize_t SerialImpl::readAtLeast(uint8_t *buffer, size_t buffer_size, size_t char
 	return -1;
 }
 
+ssize_t SerialImpl::readFrame(uint8_t *buffer, size_t buffer_size, uint32_t timeout_us, uint64_t *timestamp)
+{
+	if (!_open) {
+		PX4_ERR("Cannot readFrame from serial device until it has been opened");
+		return -1;
+	}
+
+	const uint32_t character_time_us = SerialConfig::characterTime(_baudrate, _bytesize, _parity, _stopbits);
+	const uint32_t frame_gap_us = math::max(SerialConfig::FRAME_GAP_CHARACTERS * character_time_us, (uint32_t)1000);
+
+	const hrt_abstime start_time_us = hrt_absolute_time();
+	hrt_abstime last_receive_time_us = 0;
+	size_t total_bytes_read = 0;
+
+	// there is no poll(), so the port is read periodically
+	while (total_bytes_read < buffer_size) {
+		const int current_bytes_read = read(&buffer[total_bytes_read], buffer_size - total_bytes_read);
+		const hrt_abstime now = hrt_absolute_time();
+
+		if (current_bytes_read < 0) {
+			PX4_ERR("%s failed to read uart", __FUNCTION__);
+			return -1;
+		}
+
+		if (current_bytes_read > 0) {
+			if ((total_bytes_read == 0) && (timestamp != nullptr)) {
+				*timestamp = now - math::min((hrt_abstime)current_bytes_read * character_time_us, now);
+			}
+
+			total_bytes_read += current_bytes_read;
+			last_receive_time_us = now;
+			continue;
+		}
+
+		if (total_bytes_read > 0) {
+			if (now - last_receive_time_us >= frame_gap_us) {
+				break;
+			}
+
+		} else if (now - start_time_us >= timeout_us) {
+			break;
+		}
+
+		px4_usleep(frame_gap_us);
+	}
+
+	return total_bytes_read;
+}
+
 ssize_t SerialImpl::write(const void *buffer, size_t buffer_size)
 {
 	if (!_open) {
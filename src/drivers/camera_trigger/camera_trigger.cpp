@@ -817,8 +817,9 @@ CameraTrigger::engage(void *arg)
 		return;
 	}
 
-	// Trigger the camera
+	// Trigger the camera, timestamp the edge right when the output is set (this runs in the HRT callback)
 	trig->_camera_interface->trigger(true);
+	const hrt_abstime edge_time = hrt_absolute_time();
 	// set last timestamp
 	trig->_last_trigger_timestamp = now;
 
@@ -840,18 +841,18 @@ CameraTrigger::engage(void *arg)
 
 	if (trig->_pps_hrt_timestamp > 0) {
 		// Current RTC time (RTC time captured by the PPS module + elapsed time since capture)
-		trigger.timestamp_utc = trig->_pps_rtc_timestamp + hrt_elapsed_time(&trig->_pps_hrt_timestamp);
+		trigger.timestamp_utc = trig->_pps_rtc_timestamp + (edge_time - trig->_pps_hrt_timestamp);
 
 	} else {
 		// No PPS capture received, use RTC clock as fallback
 		timespec tv{};
 		px4_clock_gettime(CLOCK_REALTIME, &tv);
-		trigger.timestamp_utc = ts_to_abstime(&tv);
+		trigger.timestamp_utc = ts_to_abstime(&tv) - hrt_elapsed_time(&edge_time);
 	}
 
 	trigger.seq = trig->_trigger_seq;
 	trigger.feedback = false;
-	trigger.timestamp = hrt_absolute_time();
+	trigger.timestamp = edge_time;
 
 	orb_publish(ORB_ID(camera_trigger), trig->_trigger_pub, &trigger);
 
@@ -39,7 +39,7 @@
 
 #include <px4_platform_common/log.h>
 
-#include "o1heap/o1heap.h"
+#include <lib/o1heap/o1heap.h>
 
 #include "Subscribers/BaseSubscriber.hpp"
 
@@ -73,23 +73,28 @@ CanardHandle::CanardHandle(uint32_t node_id, const size_t capacity, const size_t
 
 	_canard_instance.node_id = node_id; // Defaults to anonymous; can be set up later at any point.
 
-	_queue = canardTxInit(capacity, mtu_bytes);
+	for (uint8_t i = 0; i < NumIfaces; i++) {
+		_ifaces[i].queue = canardTxInit(capacity, mtu_bytes);
 
 #if defined(__PX4_NUTTX)
 # if defined(CONFIG_NET_CAN)
-	_can_interface = new CanardSocketCAN();
+		_ifaces[i].interface = new CanardSocketCAN(i);
 # elif defined(CONFIG_CAN)
-	_can_interface = new CanardNuttXCDev();
+		_ifaces[i].interface = new CanardNuttXCDev(i);
 # endif // CONFIG_CAN
 #endif // NuttX
-
+	}
 }
 
 CanardHandle::~CanardHandle()
 {
-	_can_interface->close();
-	delete _can_interface;
-	_can_interface = nullptr;
+	for (auto &iface : _ifaces) {
+		if (iface.interface) {
+			iface.interface->close();
+			delete iface.interface;
+			iface.interface = nullptr;
+		}
+	}
 
 	delete static_cast<uint8_t *>(_cyphal_heap);
 	_cyphal_heap = nullptr;
@@ -99,13 +104,19 @@ CanardHandle::~CanardHandle()
 
 bool CanardHandle::init()
 {
-	if (_can_interface) {
-		if (_can_interface->init() == PX4_OK) {
-			return true;
+	// usable as long as one interface comes up, redundancy is lost otherwise
+	bool ret = false;
+
+	for (uint8_t i = 0; i < NumIfaces; i++) {
+		if (_ifaces[i].interface && (_ifaces[i].interface->init() == PX4_OK)) {
+			ret = true;
+
+		} else {
+			PX4_ERR("CAN%u init failed", i + 1);
 		}
 	}
 
-	return false;
+	return ret;
 }
 
 void CanardHandle::receive()
@@ -116,11 +127,23 @@ void CanardHandle::receive()
 	CanardRxFrame received_frame{};
 	received_frame.frame.payload = &data;
 
-	while (_can_interface->receive(&received_frame) > 0) {
+	for (uint8_t i = 0; i < NumIfaces; i++) {
+		if (_ifaces[i].interface) {
+			receive(i, received_frame);
+		}
+	}
+}
+
+void CanardHandle::receive(uint8_t iface_index, CanardRxFrame &received_frame)
+{
+	while (_ifaces[iface_index].interface->receive(&received_frame) > 0) {
+		_ifaces[iface_index].rx_frames++;
+
+		// libcanard accepts each transfer once, from whichever interface delivers it first
 		CanardRxTransfer receive{};
 		CanardRxSubscription *subscription = nullptr;
-		int32_t result = canardRxAccept(&_canard_instance, received_frame.timestamp_usec, &received_frame.frame, 0, &receive,
-						&subscription);
+		int32_t result = canardRxAccept(&_canard_instance, received_frame.timestamp_usec, &received_frame.frame, iface_index,
+						&receive, &subscription);
 
 		if (result < 0) {
 			// An error has occurred: either an argument is invalid or we've ran out of memory.
@@ -153,24 +176,36 @@ void CanardHandle::receive()
 
 void CanardHandle::transmit()
 {
-	// Look at the top of the TX queue.
-	for (const CanardTxQueueItem *ti = NULL; (ti = canardTxPeek(&_queue)) != NULL;) { // Peek at the top of the queue.
-		if ((0U == ti->tx_deadline_usec) || (ti->tx_deadline_usec > hrt_absolute_time())) { // Check the deadline.
-			// Send the frame. Redundant interfaces may be used here.
-			const int tx_res = _can_interface->transmit(*ti);
-
-			if (tx_res < 0) {
-				PX4_ERR("Transmit error %d, frame dropped, errno '%s'", tx_res, strerror(errno));
-
-			} else if (tx_res == 0) {
-				// Timeout - just exit and try again later
-				break;
+	for (auto &iface : _ifaces) {
+		if (iface.interface == nullptr) {
+			continue;
+		}
+
+		// Look at the top of the TX queue.
+		for (const CanardTxQueueItem *ti = NULL; (ti = canardTxPeek(&iface.queue)) != NULL;) { // Peek at the top of the queue.
+			if ((0U == ti->tx_deadline_usec) || (ti->tx_deadline_usec > hrt_absolute_time())) { // Check the deadline.
+				// Send the frame.
+				const int tx_res = iface.interface->transmit(*ti);
+
+				if (tx_res < 0) {
+					PX4_ERR("Transmit error %d, frame dropped, errno '%s'", tx_res, strerror(errno));
+					iface.tx_dropped++;
+
+				} else if (tx_res == 0) {
+					// Timeout - just exit and try again later
+					break;
+
+				} else {
+					iface.tx_frames++;
+				}
+
+			} else {
+				iface.tx_dropped++;
 			}
 
+			// After the frame is transmitted or if it has timed out while waiting, pop it from the queue and deallocate:
+			_canard_instance.memory_free(&_canard_instance, canardTxPop(&iface.queue, ti));
 		}
-
-		// After the frame is transmitted or if it has timed out while waiting, pop it from the queue and deallocate:
-		_canard_instance.memory_free(&_canard_instance, canardTxPop(&_queue, ti));
 	}
 }
 
@@ -179,7 +214,33 @@ int32_t CanardHandle::TxPush(const CanardMicrosecond             tx_deadline_use
 			     const size_t                        payload_size,
 			     const void *const                   payload)
 {
-	return canardTxPush(&_queue, &_canard_instance, tx_deadline_usec, metadata, payload_size, payload);
+	if ((NumIfaces == 1) || (metadata->priority <= RedundantPriority)) {
+		// critical transfers are sent on every interface
+		int32_t result = -CANARD_ERROR_INVALID_ARGUMENT;
+
+		for (auto &iface : _ifaces) {
+			if (iface.interface) {
+				const int32_t res = canardTxPush(&iface.queue, &_canard_instance, tx_deadline_usec, metadata, payload_size, payload);
+
+				// succeed if any interface accepted the transfer
+				if ((res >= 0) || (result < 0)) {
+					result = res;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	// Other transfers are distributed by port ID. Each subject always uses the same interface,
+	// receivers switch interfaces only after the transfer-ID timeout.
+	Iface &iface = _ifaces[metadata->port_id % NumIfaces];
+
+	if (iface.interface == nullptr) {
+		return -CANARD_ERROR_INVALID_ARGUMENT;
+	}
+
+	return canardTxPush(&iface.queue, &_canard_instance, tx_deadline_usec, metadata, payload_size, payload);
 }
 
 int8_t CanardHandle::RxSubscribe(const CanardTransferKind    transfer_kind,
@@ -207,9 +268,17 @@ O1HeapDiagnostics CanardHandle::getO1HeapDiagnostics()
 	return o1heapGetDiagnostics(cyphal_allocator);
 }
 
+void CanardHandle::printInterfaceStatus()
+{
+	for (uint8_t i = 0; i < NumIfaces; i++) {
+		PX4_INFO("CAN%u: TX %" PRIu32 " frames, %" PRIu32 " dropped, queued %zu; RX %" PRIu32 " frames",
+			 i + 1, _ifaces[i].tx_frames, _ifaces[i].tx_dropped, _ifaces[i].queue.size, _ifaces[i].rx_frames);
+	}
+}
+
 int32_t CanardHandle::mtu()
 {
-	return _queue.mtu_bytes;
+	return _ifaces[0].queue.mtu_bytes;
 }
 
 CanardNodeID CanardHandle::node_id()
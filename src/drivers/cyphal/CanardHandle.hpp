@@ -34,7 +34,7 @@
 #pragma once
 
 #include <canard.h>
-#include "o1heap/o1heap.h"
+#include <lib/o1heap/o1heap.h>
 #include "CanardInterface.hpp"
 
 class CanardHandle
@@ -47,6 +47,15 @@ class CanardHandle
 	*/
 	static constexpr unsigned HeapSize = 8192;
 
+#if defined(CONFIG_CYPHAL_NUM_IFACES)
+	static constexpr uint8_t NumIfaces = CONFIG_CYPHAL_NUM_IFACES;
+#else
+	static constexpr uint8_t NumIfaces = 1;
+#endif
+
+	// transfers of this or a higher priority are sent on all interfaces
+	static constexpr CanardPriority RedundantPriority = CanardPriorityHigh;
+
 public:
 	CanardHandle(uint32_t node_id, const size_t capacity, const size_t mtu_bytes);
 	~CanardHandle();
@@ -71,16 +80,26 @@ public:
 	CanardTreeNode *getRxSubscriptions(CanardTransferKind kind);
 	O1HeapDiagnostics getO1HeapDiagnostics();
 
+	void printInterfaceStatus();
+
 	int32_t mtu();
 	CanardNodeID node_id();
 	void set_node_id(CanardNodeID id);
 
 private:
-	CanardInterface *_can_interface;
+	struct Iface {
+		CanardInterface *interface{nullptr};
+		CanardTxQueue queue{};
+		uint32_t tx_frames{0};
+		uint32_t tx_dropped{0};
+		uint32_t rx_frames{0};
+	};
 
-	CanardInstance _canard_instance;
+	Iface _ifaces[NumIfaces] {};
+
+	void receive(uint8_t iface_index, CanardRxFrame &received_frame);
 
-	CanardTxQueue _queue;
+	CanardInstance _canard_instance;
 
 	void *_cyphal_heap{nullptr};
 
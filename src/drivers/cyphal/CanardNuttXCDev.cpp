@@ -35,6 +35,7 @@
 
 #include <fcntl.h>
 #include <poll.h>
+#include <stdio.h>
 
 #include <nuttx/can/can.h>
 #include <arch/board/board.h>
@@ -45,20 +46,23 @@
 
 int CanardNuttXCDev::init()
 {
-	struct can_dev_s *can = stm32_caninitialize(1);
+	struct can_dev_s *can = stm32_caninitialize(_iface_index + 1);
 
 	if (can == nullptr) {
 		PX4_ERR("Failed to get CAN interface");
 
 	} else {
-		/* Register the CAN driver at "/dev/can0" */
-		int ret = can_register("/dev/can0", can);
+		/* Register the CAN driver at "/dev/canN" */
+		char dev_path[16] {};
+		snprintf(dev_path, sizeof(dev_path), "/dev/can%u", _iface_index);
+
+		int ret = can_register(dev_path, can);
 
 		if (ret < 0) {
 			PX4_ERR("can_register failed: %d", ret);
 
 		} else {
-			_fd = ::open("/dev/can0", O_RDWR | O_NONBLOCK);
+			_fd = ::open(dev_path, O_RDWR | O_NONBLOCK);
 		}
 	}
 
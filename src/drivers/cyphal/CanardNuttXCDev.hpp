@@ -42,7 +42,7 @@
 class CanardNuttXCDev : public CanardInterface
 {
 public:
-	CanardNuttXCDev() = default;
+	explicit CanardNuttXCDev(uint8_t iface_index = 0) : _iface_index(iface_index) {}
 	~CanardNuttXCDev() override = default;
 
 	/// Creates a SocketCAN socket for corresponding iface can_iface_name
@@ -62,6 +62,7 @@ public:
 	int16_t receive(CanardRxFrame *rxf);
 
 private:
+	const uint8_t _iface_index;
 	int _fd{-1};
 	bool _can_fd{false};
 };
@@ -35,6 +35,7 @@
 
 #include <net/if.h>
 #include <sys/ioctl.h>
+#include <stdio.h>
 #include <string.h>
 
 #include <px4_platform_common/log.h>
@@ -50,7 +51,8 @@ uint64_t getMonotonicTimestampUSec(void)
 
 int CanardSocketCAN::init()
 {
-	const char *const can_iface_name = "can0";
+	char can_iface_name[IFNAMSIZ] {};
+	snprintf(can_iface_name, sizeof(can_iface_name), "can%u", _iface_index);
 
 	struct sockaddr_can addr;
 	struct ifreq ifr;
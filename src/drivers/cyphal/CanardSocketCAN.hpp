@@ -53,7 +53,7 @@
 class CanardSocketCAN : public CanardInterface
 {
 public:
-	CanardSocketCAN() = default;
+	explicit CanardSocketCAN(uint8_t iface_index = 0) : _iface_index(iface_index) {}
 	~CanardSocketCAN() override = default;
 
 	/// Creates a SocketCAN socket for corresponding iface can_iface_name
@@ -83,6 +83,8 @@ public:
 
 private:
 
+	const uint8_t     _iface_index;
+
 	int               _fd{-1};
 	bool              _can_fd{false};
 
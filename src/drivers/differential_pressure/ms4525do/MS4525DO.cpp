@@ -114,20 +114,12 @@ void MS4525DO::print_status()
 void MS4525DO::RunImpl()
 {
 	switch (_state) {
-	case STATE::MEASURE: {
-			// Send the command to begin a measurement (Read_MR)
-			uint8_t cmd = ADDR_READ_MR;
+	case STATE::MEASURE:
+		// Send the command to begin a measurement (Read_MR), completed in MeasureCallback()
+		_cmd = ADDR_READ_MR;
 
-			if (transfer(&cmd, 1, nullptr, 0) == OK) {
-				_timestamp_sample = hrt_absolute_time();
-				_state = STATE::READ;
-				ScheduleDelayed(2_ms);
-
-			} else {
-				perf_count(_comms_errors);
-				_state = STATE::MEASURE;
-				ScheduleDelayed(10_ms); // try again in 10 ms
-			}
+		if (transfer_queued(&_cmd, 1, nullptr, 0, &MS4525DO::MeasureCallback, this) != PX4_OK) {
+			MeasureCallback(this, PX4_ERROR);
 		}
 
 		break;
@@ -137,85 +129,123 @@ void MS4525DO::RunImpl()
 		//  1st read: require status = Normal Operation. Good Data Packet
 		//  2nd read: require status = Stale Data, data should match first read
 		perf_begin(_sample_perf);
-		uint8_t data_1[4] {};
-		int ret1 = transfer(nullptr, 0, &data_1[0], sizeof(data_1));
 
-		uint8_t data_2[4] {};
-		int ret2 = transfer(nullptr, 0, &data_2[0], sizeof(data_2));
-		perf_end(_sample_perf);
+		if (transfer_queued(nullptr, 0, &_data_1[0], sizeof(_data_1), &MS4525DO::DataFetch1Callback, this) != PX4_OK) {
+			DataFetch1Callback(this, PX4_ERROR);
+		}
+
+		break;
+	}
+}
 
-		if (ret1 != PX4_OK || ret2 != PX4_OK) {
-			perf_count(_comms_errors);
+void MS4525DO::MeasureCallback(void *arg, int result)
+{
+	MS4525DO *dev = static_cast<MS4525DO *>(arg);
 
-		} else {
-			// Status bits
-			const uint8_t status_1 = (data_1[0] & 0b1100'0000) >> 6;
-			const uint8_t status_2 = (data_2[0] & 0b1100'0000) >> 6;
+	if (result == PX4_OK) {
+		dev->_timestamp_sample = hrt_absolute_time();
+		dev->_state = STATE::READ;
+		dev->ScheduleDelayed(2_ms);
+
+	} else {
+		perf_count(dev->_comms_errors);
+		dev->_state = STATE::MEASURE;
+		dev->ScheduleDelayed(10_ms); // try again in 10 ms
+	}
+}
 
-			const uint8_t bridge_data_1_msb = (data_1[0] & 0b0011'1111);
-			const uint8_t bridge_data_2_msb = (data_2[0] & 0b0011'1111);
+void MS4525DO::DataFetch1Callback(void *arg, int result)
+{
+	MS4525DO *dev = static_cast<MS4525DO *>(arg);
 
-			const uint8_t bridge_data_1_lsb = data_1[1];
-			const uint8_t bridge_data_2_lsb = data_2[1];
+	if ((result != PX4_OK)
+	    || (dev->transfer_queued(nullptr, 0, &dev->_data_2[0], sizeof(dev->_data_2), &MS4525DO::DataFetch2Callback,
+				     dev) != PX4_OK)) {
 
-			// Bridge Data [13:8] + Bridge Data [7:0]
-			int16_t bridge_data_1 = (bridge_data_1_msb << 8) + bridge_data_1_lsb;
-			int16_t bridge_data_2 = (bridge_data_2_msb << 8) + bridge_data_2_lsb;
+		DataFetch2Callback(arg, PX4_ERROR);
+	}
+}
 
-			// 11-bit temperature data
-			//  Temperature Data [10:3] + Temperature Data [2:0]
-			int16_t temperature_1 = ((data_1[2] << 8) + (0b1110'0000 & data_1[3])) / (1 << 5);
-			int16_t temperature_2 = ((data_2[2] << 8) + (0b1110'0000 & data_2[3])) / (1 << 5);
+void MS4525DO::DataFetch2Callback(void *arg, int result)
+{
+	MS4525DO *dev = static_cast<MS4525DO *>(arg);
+	perf_end(dev->_sample_perf);
 
-			if ((status_1 == (uint8_t)STATUS::Fault_Detected) || (status_2 == (uint8_t)STATUS::Fault_Detected)) {
-				// Fault Detected
-				perf_count(_fault_perf);
+	dev->ProcessData(result == PX4_OK);
 
-			} else if ((status_1 == (uint8_t)STATUS::Normal_Operation) && (status_2 == (uint8_t)STATUS::Stale_Data)
-				   && (bridge_data_1_msb == bridge_data_2_msb) && (temperature_1 == temperature_2)) {
+	dev->_state = STATE::MEASURE;
+	dev->ScheduleDelayed(10_ms);
+}
 
-				float temperature_c = ((200.f * temperature_1) / 2047) - 50.f;
+void MS4525DO::ProcessData(bool success)
+{
+	if (!success) {
+		perf_count(_comms_errors);
 
-				// Output is proportional to the difference between Port 1 and Port 2. Output swings
-				// positive when Port 1> Port 2. Output is 50% of supply voltage when Port 1=Port 2.
+	} else {
+		// Status bits
+		const uint8_t status_1 = (_data_1[0] & 0b1100'0000) >> 6;
+		const uint8_t status_2 = (_data_2[0] & 0b1100'0000) >> 6;
 
-				// Calculate differential pressure. As its centered around 8000
-				// and can go positive or negative
-				static constexpr float P_min = -1.f; // -1 PSI
-				static constexpr float P_max = 1.f;  // +1 PSI
+		const uint8_t bridge_data_1_msb = (_data_1[0] & 0b0011'1111);
+		const uint8_t bridge_data_2_msb = (_data_2[0] & 0b0011'1111);
 
-				// this equation is an inversion of the equation in the
-				// pressure transfer function figure on page 4 of the datasheet
+		const uint8_t bridge_data_1_lsb = _data_1[1];
+		const uint8_t bridge_data_2_lsb = _data_2[1];
 
-				// We negate the result so that positive differential pressures
-				// are generated when the bottom port is used as the static
-				// port on the pitot and top port is used as the dynamic port
-				const float diff_press_PSI = -((bridge_data_1 - 0.1f * 16383.f) * (P_max - P_min) / (0.8f * 16383.f) + P_min);
+		// Bridge Data [13:8] + Bridge Data [7:0]
+		int16_t bridge_data_1 = (bridge_data_1_msb << 8) + bridge_data_1_lsb;
+		int16_t bridge_data_2 = (bridge_data_2_msb << 8) + bridge_data_2_lsb;
 
-				static constexpr float PSI_to_Pa = 6894.757f;
-				float diff_press_pa = diff_press_PSI * PSI_to_Pa;
+		// 11-bit temperature data
+		//  Temperature Data [10:3] + Temperature Data [2:0]
+		int16_t temperature_1 = ((_data_1[2] << 8) + (0b1110'0000 & _data_1[3])) / (1 << 5);
+		int16_t temperature_2 = ((_data_2[2] << 8) + (0b1110'0000 & _data_2[3])) / (1 << 5);
 
-				if (hrt_elapsed_time(&_timestamp_sample) < 20_ms) {
-					differential_pressure_s differential_pressure{};
-					differential_pressure.timestamp_sample = _timestamp_sample;
-					differential_pressure.device_id = get_device_id();
-					differential_pressure.differential_pressure_pa = diff_press_pa;
-					differential_pressure.temperature = temperature_c;
-					differential_pressure.error_count = perf_event_count(_comms_errors);
-					differential_pressure.timestamp = hrt_absolute_time();
-					_differential_pressure_pub.publish(differential_pressure);
+		if ((status_1 == (uint8_t)STATUS::Fault_Detected) || (status_2 == (uint8_t)STATUS::Fault_Detected)) {
+			// Fault Detected
+			perf_count(_fault_perf);
 
-					_timestamp_sample = 0;
-				}
+		} else if ((status_1 == (uint8_t)STATUS::Normal_Operation) && (status_2 == (uint8_t)STATUS::Stale_Data)
+			   && (bridge_data_1_msb == bridge_data_2_msb) && (temperature_1 == temperature_2)) {
 
-			} else {
-				PX4_DEBUG("status:%X|%X, B:%X|%X, T:%X|%X", status_1, status_2, bridge_data_1, bridge_data_2, temperature_1,
-					  temperature_2);
+			float temperature_c = ((200.f * temperature_1) / 2047) - 50.f;
+
+			// Output is proportional to the difference between Port 1 and Port 2. Output swings
+			// positive when Port 1> Port 2. Output is 50% of supply voltage when Port 1=Port 2.
+
+			// Calculate differential pressure. As its centered around 8000
+			// and can go positive or negative
+			static constexpr float P_min = -1.f; // -1 PSI
+			static constexpr float P_max = 1.f;  // +1 PSI
+
+			// this equation is an inversion of the equation in the
+			// pressure transfer function figure on page 4 of the datasheet
+
+			// We negate the result so that positive differential pressures
+			// are generated when the bottom port is used as the static
+			// port on the pitot and top port is used as the dynamic port
+			const float diff_press_PSI = -((bridge_data_1 - 0.1f * 16383.f) * (P_max - P_min) / (0.8f * 16383.f) + P_min);
+
+			static constexpr float PSI_to_Pa = 6894.757f;
+			float diff_press_pa = diff_press_PSI * PSI_to_Pa;
+
+			if (hrt_elapsed_time(&_timestamp_sample) < 20_ms) {
+				differential_pressure_s differential_pressure{};
+				differential_pressure.timestamp_sample = _timestamp_sample;
+				differential_pressure.device_id = get_device_id();
+				differential_pressure.differential_pressure_pa = diff_press_pa;
+				differential_pressure.temperature = temperature_c;
+				differential_pressure.error_count = perf_event_count(_comms_errors);
+				differential_pressure.timestamp = hrt_absolute_time();
+				_differential_pressure_pub.publish(differential_pressure);
+
+				_timestamp_sample = 0;
 			}
-		}
 
-		_state = STATE::MEASURE;
-		ScheduleDelayed(10_ms);
-		break;
+		} else {
+			PX4_DEBUG("status:%X|%X, B:%X|%X, T:%X|%X", status_1, status_2, bridge_data_1, bridge_data_2, temperature_1,
+				  temperature_2);
+		}
 	}
 }
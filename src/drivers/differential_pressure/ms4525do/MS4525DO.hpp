@@ -75,6 +75,11 @@ public:
 private:
 	int probe() override;
 
+	static void MeasureCallback(void *arg, int result);
+	static void DataFetch1Callback(void *arg, int result);
+	static void DataFetch2Callback(void *arg, int result);
+	void ProcessData(bool success);
+
 	enum class STATE : uint8_t {
 		MEASURE,
 		READ,
@@ -89,6 +94,11 @@ private:
 
 	hrt_abstime _timestamp_sample{0};
 
+	// buffers of the transfers queued on the bus
+	uint8_t _cmd{ADDR_READ_MR};
+	uint8_t _data_1[4] {};
+	uint8_t _data_2[4] {};
+
 	uORB::PublicationMulti<differential_pressure_s> _differential_pressure_pub{ORB_ID(differential_pressure)};
 
 	perf_counter_t _sample_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": read")};
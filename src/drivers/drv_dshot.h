@@ -152,6 +152,23 @@ __EXPORT extern void up_bdshot_status(void);
 __EXPORT extern int up_bdshot_get_erpm(uint8_t channel, int *erpm);
 
 
+/**
+ * Get the bidrectional dshot erpm of all channels at once
+ * @param erpm		array to write the erpm values to, only written for channels with a new value
+ * @param num_channels	size of the erpm array
+ * @return bitmask of the channels with a new erpm value
+ */
+__EXPORT extern uint32_t up_bdshot_get_erpms(int *erpm, unsigned num_channels);
+
+/**
+ * Get the number of bidrectional dshot responses of a channel that failed to decode
+ * (framing, invalid GCR symbol or CRC error)
+ * @param channel	Dshot channel
+ * @return number of errors since boot
+ */
+__EXPORT extern uint32_t up_bdshot_get_error_count(uint8_t channel);
+
+
 /**
  * Get bidrectional dshot status for a channel
  * @param channel	Dshot channel
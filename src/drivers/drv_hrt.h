@@ -74,7 +74,9 @@ typedef void	(* hrt_callout)(void *arg);
  * Callout record.
  */
 typedef struct hrt_call {
-	struct sq_entry_s	link;
+	struct hrt_call		*parent;	/**< callout queue links, see px4_platform_common/hrt_callout_queue.h */
+	struct hrt_call		*left;
+	struct hrt_call		*right;
 
 	hrt_abstime		deadline;
 	hrt_abstime		period;
@@ -97,6 +99,16 @@ typedef struct latency_info {
 	uint32_t                counter;
 } latency_info_t;
 
+/**
+ * Callout queue statistics.
+ */
+typedef struct hrt_callout_stats {
+	uint32_t		count;		/**< number of queued callouts */
+	uint32_t		count_max;	/**< maximum number of queued callouts */
+	uint32_t		enter_time_max;	/**< worst-case time to enter a callout into the queue [us] */
+	hrt_abstime		next_deadline;	/**< deadline of the next callout, 0 if none is queued */
+} hrt_callout_stats_t;
+
 #if defined(__PX4_NUTTX) && !defined(CONFIG_BUILD_FLAT)
 
 typedef struct hrt_boardctl {
@@ -123,6 +135,7 @@ typedef struct latency_boardctl {
 #define HRT_CANCEL		_HRTIOC(6)
 #define HRT_GET_LATENCY		_HRTIOC(7)
 #define HRT_RESET_LATENCY	_HRTIOC(8)
+#define HRT_CALL_EVERY_AT	_HRTIOC(9)
 
 #endif
 
@@ -212,6 +225,15 @@ __EXPORT extern void	hrt_call_at(struct hrt_call *entry, hrt_abstime calltime, h
 __EXPORT extern void	hrt_call_every(struct hrt_call *entry, hrt_abstime delay, hrt_abstime interval,
 				       hrt_callout callout, void *arg);
 
+/**
+ * Call callout(arg) at absolute time calltime, and then after every interval.
+ *
+ * Like hrt_call_every(), but with an absolute first deadline, so that callers can align
+ * the deadlines of several periodic calls.
+ */
+__EXPORT extern void	hrt_call_every_at(struct hrt_call *entry, hrt_abstime calltime, hrt_abstime interval,
+					  hrt_callout callout, void *arg);
+
 /**
  * If this returns true, the entry has been invoked and removed from the callout list,
  * or it has never been entered.
@@ -225,6 +247,11 @@ __EXPORT extern bool	hrt_called(struct hrt_call *entry);
  */
 __EXPORT extern void	hrt_cancel(struct hrt_call *entry);
 
+/**
+ * Get the callout queue statistics.
+ */
+__EXPORT extern void	hrt_callout_stats(hrt_callout_stats_t *stats);
+
 /**
  * Initialise a hrt_call structure
  */
@@ -198,6 +198,7 @@ void DShot::update_telemetry_num_motors()
 	}
 
 	_telemetry->handler.setNumMotors(motor_count);
+	_telemetry->esc_status.setEscCount(motor_count);
 }
 
 void DShot::init_telemetry(const char *device)
@@ -211,7 +212,7 @@ void DShot::init_telemetry(const char *device)
 		}
 	}
 
-	_telemetry->esc_status_pub.advertise();
+	_telemetry->esc_status.advertise();
 
 	if (device != NULL) {
 		int ret = _telemetry->handler.init(device);
@@ -224,108 +225,51 @@ void DShot::init_telemetry(const char *device)
 	update_telemetry_num_motors();
 }
 
-int DShot::handle_new_telemetry_data(const int telemetry_index, const DShotTelemetry::EscData &data)
+void DShot::handle_new_telemetry_data(const int telemetry_index, const DShotTelemetry::EscData &data)
 {
-	int ret = 0;
-	// fill in new motor data
-	esc_status_s &esc_status = _telemetry->esc_status_pub.get();
-
+	// fill in new motor data, published with the next complete round
 	if (telemetry_index < esc_status_s::CONNECTED_ESC_MAX) {
-		esc_status.esc_online_flags |= 1 << telemetry_index;
-
-		esc_status.esc[telemetry_index].actuator_function = _telemetry->actuator_functions[telemetry_index];
-		esc_status.esc[telemetry_index].timestamp       = data.time;
-		esc_status.esc[telemetry_index].esc_rpm         = (static_cast<int>(data.erpm) * 100) /
-				(_param_mot_pole_count.get() / 2);
-		esc_status.esc[telemetry_index].esc_voltage     = static_cast<float>(data.voltage) * 0.01f;
-		esc_status.esc[telemetry_index].esc_current     = static_cast<float>(data.current) * 0.01f;
-		esc_status.esc[telemetry_index].esc_temperature = static_cast<float>(data.temperature);
-		// TODO: accumulate consumption and use for battery estimation
-	}
+		esc_report_s &esc = _telemetry->esc_status.esc(telemetry_index);
 
-	// publish when motor index wraps (which is robust against motor timeouts)
-	if (telemetry_index <= _telemetry->last_telemetry_index) {
-		esc_status.timestamp = hrt_absolute_time();
-		esc_status.esc_connectiontype = esc_status_s::ESC_CONNECTION_TYPE_DSHOT;
-		esc_status.esc_count = _telemetry->handler.numMotors();
-		++esc_status.counter;
+		esc.actuator_function = _telemetry->actuator_functions[telemetry_index];
+		esc.esc_rpm         = (static_cast<int>(data.erpm) * 100) / (_param_mot_pole_count.get() / 2);
+		esc.esc_voltage     = static_cast<float>(data.voltage) * 0.01f;
+		esc.esc_current     = static_cast<float>(data.current) * 0.01f;
+		esc.esc_temperature = static_cast<float>(data.temperature);
+		// TODO: accumulate consumption and use for battery estimation
 
-		ret = 1; // Indicate we wrapped, so we publish data
+		_telemetry->esc_status.updated(telemetry_index, data.time);
 	}
-
-	_telemetry->last_telemetry_index = telemetry_index;
-
-	return ret;
 }
 
-void DShot::publish_esc_status(void)
+void DShot::handle_new_bdshot_erpm(void)
 {
-	esc_status_s &esc_status = _telemetry->esc_status_pub.get();
 	int telemetry_index = 0;
+	int erpm[_num_outputs] {};
 
-	// clear data of the esc that are offline
-	for (int index = 0; (index < _telemetry->last_telemetry_index); index++) {
-		if ((esc_status.esc_online_flags & (1 << index)) == 0) {
-			memset(&esc_status.esc[index], 0, sizeof(struct esc_report_s));
-		}
-	}
+	// all channels decoded in this cycle at once
+	const uint32_t erpm_mask = up_bdshot_get_erpms(erpm, _num_outputs);
 
-	// FIXME: mark all UART Telemetry ESC's as online, otherwise commander complains even for a single dropout
-	esc_status.esc_count = _telemetry->handler.numMotors();
-	esc_status.esc_online_flags = (1 << esc_status.esc_count) - 1;
-	esc_status.esc_armed_flags = (1 << esc_status.esc_count) - 1;
-
-	if (_bidirectional_dshot_enabled) {
-		for (unsigned i = 0; i < _num_outputs; i++) {
-			if (_mixing_output.isFunctionSet(i)) {
-				if (up_bdshot_channel_status(i)) {
-					esc_status.esc_online_flags |= 1 << i;
-
-				} else {
-					esc_status.esc_online_flags &= ~(1 << i);
-				}
-
-				++telemetry_index;
-			}
-		}
-	}
-
-	// ESC telem wrap around or bdshot update
-	_telemetry->esc_status_pub.update();
-
-	// reset esc online flags
-	esc_status.esc_online_flags = 0;
-}
-
-int DShot::handle_new_bdshot_erpm(void)
-{
-	int num_erpms = 0;
-	int telemetry_index = 0;
-	int erpm;
-	esc_status_s &esc_status = _telemetry->esc_status_pub.get();
-
-	esc_status.timestamp = hrt_absolute_time();
-	esc_status.counter = _esc_status_counter++;
-	esc_status.esc_connectiontype = esc_status_s::ESC_CONNECTION_TYPE_DSHOT;
-	esc_status.esc_armed_flags = _outputs_on;
+	const hrt_abstime now = hrt_absolute_time();
+	const int pole_pairs = _param_mot_pole_count.get() / 2;
 
 	for (unsigned i = 0; i < _num_outputs; i++) {
 		if (_mixing_output.isFunctionSet(i)) {
-			if (up_bdshot_get_erpm(i, &erpm) == 0) {
-				num_erpms++;
-				esc_status.esc_online_flags |= 1 << telemetry_index;
-				esc_status.esc[telemetry_index].timestamp = hrt_absolute_time();
-				esc_status.esc[telemetry_index].esc_rpm = (erpm * 100) / (_param_mot_pole_count.get() / 2);
-				esc_status.esc[telemetry_index].actuator_function = _telemetry->actuator_functions[telemetry_index];
+			if (telemetry_index < esc_status_s::CONNECTED_ESC_MAX) {
+				esc_report_s &esc = _telemetry->esc_status.esc(telemetry_index);
+				esc.esc_errorcount = up_bdshot_get_error_count(i);
+
+				// channels without valid eRPM (bdshot_channel_status) time out and are reported offline
+				if (erpm_mask & (1u << i)) {
+					esc.esc_rpm = (erpm[i] * 100) / pole_pairs;
+					esc.actuator_function = _telemetry->actuator_functions[telemetry_index];
+					_telemetry->esc_status.updated(telemetry_index, now);
+				}
 			}
 
 			++telemetry_index;
 		}
-
-
 	}
-
-	return num_erpms;
 }
 
 int DShot::send_command_thread_safe(const dshot_command_t command, const int num_repetitions, const int motor_index)
@@ -538,7 +482,6 @@ void DShot::Run()
 
 	if (_telemetry) {
 		int telem_update = _telemetry->handler.update();
-		int need_to_publish = 0;
 
 		// Are we waiting for ESC info?
 		if (_waiting_for_esc_info) {
@@ -548,18 +491,16 @@ void DShot::Run()
 			}
 
 		} else if (telem_update >= 0) {
-			need_to_publish = handle_new_telemetry_data(telem_update, _telemetry->handler.latestESCData());
+			handle_new_telemetry_data(telem_update, _telemetry->handler.latestESCData());
 		}
 
 		if (_bidirectional_dshot_enabled) {
 			// Add bdshot data to esc status
-			need_to_publish += handle_new_bdshot_erpm();
+			handle_new_bdshot_erpm();
 		}
 
-		if (need_to_publish > 0) {
-			// ESC telem wrap around or bdshot update
-			publish_esc_status();
-		}
+		// merged serial and bdshot telemetry, at most once per output cycle
+		_telemetry->esc_status.publish(hrt_absolute_time(), (1 << _telemetry->esc_status.escCount()) - 1);
 	}
 
 
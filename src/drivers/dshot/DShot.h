@@ -33,6 +33,7 @@
 #pragma once
 
 #include <drivers/drv_dshot.h>
+#include <lib/mixer_module/esc_status_aggregator.hpp>
 #include <lib/mixer_module/mixer_module.hpp>
 #include <px4_platform_common/getopt.h>
 #include <px4_platform_common/module.h>
@@ -122,8 +123,7 @@ private:
 
 	struct Telemetry {
 		DShotTelemetry handler{};
-		uORB::PublicationMultiData<esc_status_s> esc_status_pub{ORB_ID(esc_status)};
-		int last_telemetry_index{-1};
+		EscStatusAggregator esc_status{esc_status_s::ESC_CONNECTION_TYPE_DSHOT};
 		uint8_t actuator_functions[esc_status_s::CONNECTED_ESC_MAX] {};
 	};
 
@@ -131,11 +131,9 @@ private:
 
 	void init_telemetry(const char *device);
 
-	int handle_new_telemetry_data(const int telemetry_index, const DShotTelemetry::EscData &data);
+	void handle_new_telemetry_data(const int telemetry_index, const DShotTelemetry::EscData &data);
 
-	void publish_esc_status(void);
-
-	int handle_new_bdshot_erpm(void);
+	void handle_new_bdshot_erpm(void);
 
 	int request_esc_info();
 
@@ -174,7 +172,6 @@ private:
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 	uORB::Subscription _vehicle_command_sub{ORB_ID(vehicle_command)};
 	uORB::Publication<vehicle_command_ack_s> _command_ack_pub{ORB_ID(vehicle_command_ack)};
-	uint16_t _esc_status_counter{0};
 
 	DEFINE_PARAMETERS(
 		(ParamFloat<px4::params::DSHOT_MIN>)    _param_dshot_min,
@@ -47,6 +47,8 @@
 
 #include <cstring>
 
+#include <containers/LockGuard.hpp>
+
 #include <drivers/drv_sensor.h>
 #include <lib/drivers/device/Device.hpp>
 #include <lib/parameters/param.h>
@@ -58,6 +60,7 @@
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/time.h>
 #include <px4_platform_common/Serial.hpp>
+#include <lib/rtcm_stream/RtcmStream.hpp>
 #include <uORB/Publication.hpp>
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/Subscription.hpp>
@@ -170,6 +173,13 @@ public:
 	 */
 	void reset_if_scheduled();
 
+	/**
+	 * Write RTCM corrections of the moving base directly to this (rover) device.
+	 * Called from the secondary instance thread.
+	 * @return false if the device is currently not ready to receive corrections
+	 */
+	bool injectMovingBaseData(uint8_t *data, size_t len);
+
 private:
 #ifdef __PX4_LINUX
 	int				_spi_fd {-1};					///< SPI interface to GPS
@@ -207,8 +217,17 @@ private:
 	hrt_abstime			_last_rtcm_injection_time{0};			///< time of last rtcm injection
 	uint8_t				_selected_rtcm_instance{0};			///< uorb instance that is being used for RTCM corrections
 
+	RtcmStream::Reader		_rtcm_stream_reader{};				///< RTCM corrections from the links
+	hrt_abstime			_last_rtcm_stream_injection_time{0};		///< time of last injection from the RTCM stream
+	uint8_t				_selected_rtcm_stream_source{0};		///< link that is being used for RTCM corrections
+
 	const Instance 			_instance;
 
+	pthread_mutex_t			_device_write_mutex{};				///< serializes writes to the device from the moving base instance
+	bool				_moving_base_injection_ready{false};		///< rover accepts direct moving base corrections (protected by _device_write_mutex)
+	bool				_moving_base_direct{false};			///< moving base passes its corrections directly to the rover
+	px4::atomic<unsigned>		_moving_base_injection_count{0};		///< number of direct moving base injections
+
 	uORB::SubscriptionMultiArray<gps_inject_data_s, gps_inject_data_s::MAX_INSTANCES> _orb_inject_data_sub{ORB_ID::gps_inject_data};
 	uORB::Publication<gps_inject_data_s> _gps_inject_data_pub{ORB_ID(gps_inject_data)};
 	uORB::Publication<gps_dump_s>	     _dump_communication_pub{ORB_ID(gps_dump)};
@@ -267,6 +286,11 @@ private:
 	 */
 	inline bool injectData(uint8_t *data, size_t len);
 
+	/**
+	 * same as injectData(), but the caller must hold _device_write_mutex
+	 */
+	bool writeInjectData(uint8_t *data, size_t len);
+
 	/**
 	 * set the Baudrate
 	 * @param baud
@@ -318,6 +342,8 @@ GPS::GPS(const char *path, gps_driver_mode_t mode, GPSHelper::Interface interfac
 	_report_gps_pos.heading = NAN;
 	_report_gps_pos.heading_offset = NAN;
 
+	pthread_mutex_init(&_device_write_mutex, nullptr);
+
 	int32_t enable_sat_info = 0;
 	param_get(param_find("GPS_SAT_INFO"), &enable_sat_info);
 
@@ -390,6 +416,8 @@ GPS::~GPS()
 	delete _dump_to_device;
 	delete _dump_from_device;
 	delete _helper;
+
+	pthread_mutex_destroy(&_device_write_mutex);
 }
 
 int GPS::callback(GPSCallbackType type, void *data1, int data2, void *user)
@@ -412,6 +440,7 @@ int GPS::callback(GPSCallbackType type, void *data1, int data2, void *user)
 		}
 
 	case GPSCallbackType::writeDeviceData: {
+			LockGuard lg{gps->_device_write_mutex};
 			gps->dumpGpsData((uint8_t *)data1, (size_t)data2, gps_dump_comm_mode_t::Full, true);
 
 			int ret = 0;
@@ -471,14 +500,14 @@ int GPS::callback(GPSCallbackType type, void *data1, int data2, void *user)
 int GPS::pollOrRead(uint8_t *buf, size_t buf_length, int timeout)
 {
 	int ret = 0;
-	const size_t character_count = 32; // minimum bytes that we want to read
 	const int max_timeout = 50;
 	int timeout_adjusted = math::min(max_timeout, timeout);
 
 	handleInjectDataTopic();
 
 	if (_interface == GPSHelper::Interface::UART) {
-		ret = _uart.readAtLeast(buf, buf_length, math::min(character_count, buf_length), timeout_adjusted);
+		// wake up once per burst of messages instead of every few bytes
+		ret = _uart.readFrame(buf, buf_length, timeout_adjusted * 1000);
 
 // SPI is only supported on LInux
 #if defined(__PX4_LINUX)
@@ -508,6 +537,7 @@ int GPS::pollOrRead(uint8_t *buf, size_t buf_length, int timeout)
 				 * If we have all requested data available, read it without waiting.
 				 * If more bytes are available, we'll go back to poll() again.
 				 */
+				const size_t character_count = 32; // minimum bytes that we want to read
 				unsigned baudrate = _baudrate == 0 ? 115200 : _baudrate;
 				const unsigned sleeptime = character_count * 1000000 / (baudrate / 10);
 
@@ -536,10 +566,43 @@ void GPS::handleInjectDataTopic()
 		return;
 	}
 
+	gps_inject_data_s msg;
+
+	// RTCM corrections from the links, read directly from the shared stream
+	RtcmStream *rtcm_stream = RtcmStream::instance();
+
+	if (rtcm_stream != nullptr) {
+		if (!_rtcm_stream_reader.attached) {
+			rtcm_stream->attach(_rtcm_stream_reader);
+		}
+
+		uint8_t source = 0;
+		size_t len = 0;
+
+		while ((len = rtcm_stream->read(_rtcm_stream_reader, msg.data, sizeof(msg.data), source)) > 0) {
+			// stay on one link (base station) as long as it is sending
+			if (source != _selected_rtcm_stream_source) {
+				if (hrt_elapsed_time(&_last_rtcm_stream_injection_time) < 5_s) {
+					continue;
+				}
+
+				_selected_rtcm_stream_source = source;
+			}
+
+			// fragments of one link are in order, so they can be written as they come
+			injectData(msg.data, len);
+
+			++_last_rate_rtcm_injection_count;
+			_last_rtcm_stream_injection_time = hrt_absolute_time();
+			_last_rtcm_injection_time = _last_rtcm_stream_injection_time;
+		}
+	}
+
+	// RTCM corrections published on uORB, eg by a moving base GPS
+
 	// We don't want to call copy again further down if we have already done a
 	// copy in the selection process.
 	bool already_copied = false;
-	gps_inject_data_s msg;
 
 	// If there has not been a valid RTCM message for a while, try to switch to a different RTCM link
 	if ((hrt_absolute_time() - _last_rtcm_injection_time) > 5_s) {
@@ -593,6 +656,12 @@ void GPS::handleInjectDataTopic()
 }
 
 bool GPS::injectData(uint8_t *data, size_t len)
+{
+	LockGuard lg{_device_write_mutex};
+	return writeInjectData(data, len);
+}
+
+bool GPS::writeInjectData(uint8_t *data, size_t len)
 {
 	dumpGpsData(data, len, gps_dump_comm_mode_t::Full, true);
 
@@ -612,6 +681,22 @@ bool GPS::injectData(uint8_t *data, size_t len)
 	return written == len;
 }
 
+bool GPS::injectMovingBaseData(uint8_t *data, size_t len)
+{
+	LockGuard lg{_device_write_mutex};
+
+	// the rover thread clears this under the lock before it closes or reconfigures the device
+	if (!_moving_base_injection_ready) {
+		return false;
+	}
+
+	if (writeInjectData(data, len)) {
+		_moving_base_injection_count.fetch_add(1);
+	}
+
+	return true;
+}
+
 int GPS::setBaudrate(unsigned baud)
 {
 	if (_interface == GPSHelper::Interface::UART) {
@@ -765,6 +850,12 @@ GPS::run()
 			break;
 
 		}
+
+		if ((gps_ubx_mode == 3) && (_instance == Instance::Secondary)) {
+			int32_t moving_base_direct = 0;
+			param_get(param_find("GPS_UBX_MB_DIR"), &moving_base_direct);
+			_moving_base_direct = (moving_base_direct != 0);
+		}
 	}
 
 	handle = param_find("GPS_UBX_BAUD2");
@@ -972,6 +1063,11 @@ GPS::run()
 				receive_timeout = TIMEOUT_1HZ;
 			}
 
+			if ((ubx_mode == GPSDriverUBX::UBXMode::RoverWithMovingBaseUART1) && _helper->shouldInjectRTCM()) {
+				LockGuard lg{_device_write_mutex};
+				_moving_base_injection_ready = true;
+			}
+
 			while ((helper_ret = _helper->receive(receive_timeout)) > 0 && !should_exit()) {
 
 				if (helper_ret & 1) {
@@ -990,6 +1086,7 @@ GPS::run()
 				if (hrt_absolute_time() - last_rate_measurement > RATE_MEASUREMENT_PERIOD) {
 					float dt = (float)((hrt_absolute_time() - last_rate_measurement)) / 1000000.0f;
 					_rate = last_rate_count / dt;
+					_last_rate_rtcm_injection_count += _moving_base_injection_count.fetch_and(0);
 					_rate_rtcm_injection = _last_rate_rtcm_injection_count / dt;
 					_rate_reading = _num_bytes_read / dt;
 					last_rate_measurement = hrt_absolute_time();
@@ -1037,6 +1134,11 @@ GPS::run()
 			}
 		}
 
+		if (_moving_base_injection_ready) {
+			LockGuard lg{_device_write_mutex};
+			_moving_base_injection_ready = false;
+		}
+
 		if (_interface == GPSHelper::Interface::UART) {
 			(void) _uart.close();
 
@@ -1155,6 +1257,10 @@ GPS::print_status()
 		PX4_INFO("rate publication:\t\t%6.2f Hz", (double)_rate);
 		PX4_INFO("rate RTCM injection:\t%6.2f Hz", (double)_rate_rtcm_injection);
 
+		if (_rtcm_stream_reader.attached) {
+			PX4_INFO("RTCM link %u, dropped:\t%" PRIu32, _selected_rtcm_stream_source, _rtcm_stream_reader.dropped);
+		}
+
 		print_message(ORB_ID(sensor_gps), _report_gps_pos);
 	}
 
@@ -1250,6 +1356,16 @@ GPS::publishSatelliteInfo()
 void
 GPS::publishRTCMCorrections(uint8_t *data, size_t len)
 {
+	if (_moving_base_direct) {
+		// skip the uORB round trip and write straight to the rover, so that it
+		// gets the corrections as soon as the moving base has them
+		GPS *rover = _object.load();
+
+		if (rover && rover->injectMovingBaseData(data, len)) {
+			return;
+		}
+	}
+
 	gps_inject_data_s gps_inject_data{};
 
 	gps_inject_data.timestamp = hrt_absolute_time();
@@ -109,6 +109,21 @@ PARAM_DEFINE_INT32(GPS_SAT_INFO, 0);
  */
 PARAM_DEFINE_INT32(GPS_UBX_MODE, 0);
 
+/**
+ * u-blox moving base corrections directly to the rover
+ *
+ * Only used with GPS_UBX_MODE 3, where both F9P units are connected to the autopilot.
+ * If enabled, the RTCM output of the moving base (secondary GPS) is written straight
+ * to the rover (main GPS) from the moving base driver thread instead of going through
+ * the gps_inject_data topic. This removes up to one rover poll interval of latency
+ * from the heading solution. The corrections are then no longer published on uORB.
+ *
+ * @boolean
+ * @reboot_required true
+ * @group GPS
+ */
+PARAM_DEFINE_INT32(GPS_UBX_MB_DIR, 0);
+
 
 /**
  * u-blox F9P UART2 Baudrate
@@ -43,7 +43,6 @@ static constexpr int16_t combine(uint8_t msb, uint8_t lsb)
 ICM40609D::ICM40609D(const I2CSPIDriverConfig &config) :
 	SPI(config),
 	I2CSPIDriver(config),
-	_drdy_gpio(config.drdy_gpio),
 	_px4_accel(get_device_id(), config.rotation),
 	_px4_gyro(get_device_id(), config.rotation)
 {
@@ -173,16 +172,8 @@ void ICM40609D::RunImpl()
 			// if configure succeeded then start reading from FIFO
 			_state = STATE::FIFO_READ;
 
-			if (DataReadyInterruptConfigure()) {
-				_data_ready_interrupt_enabled = true;
-
-				// backup schedule as a watchdog timeout
-				ScheduleDelayed(100_ms);
-
-			} else {
-				_data_ready_interrupt_enabled = false;
-				ScheduleOnInterval(_fifo_empty_interval_us, _fifo_empty_interval_us);
-			}
+			// data ready interrupt driven with a watchdog, or polling if there is no interrupt
+			DataReadyScheduleStart(_fifo_empty_interval_us);
 
 			FIFOReset();
 
@@ -205,11 +196,11 @@ void ICM40609D::RunImpl()
 			hrt_abstime timestamp_sample = now;
 			uint8_t samples = 0;
 
-			if (_data_ready_interrupt_enabled) {
-				// scheduled from interrupt if _drdy_timestamp_sample was set as expected
-				const hrt_abstime drdy_timestamp_sample = _drdy_timestamp_sample.fetch_and(0);
+			if (DataReadyInterruptEnabled()) {
+				// scheduled from interrupt if the data ready timestamp was captured as expected
+				const hrt_abstime drdy_timestamp_sample = DataReadyTimestampSample(now, _fifo_empty_interval_us);
 
-				if ((now - drdy_timestamp_sample) < _fifo_empty_interval_us) {
+				if (drdy_timestamp_sample != 0) {
 					timestamp_sample = drdy_timestamp_sample;
 					samples = _fifo_gyro_samples;
 
@@ -424,37 +415,6 @@ bool ICM40609D::Configure()
 	return success;
 }
 
-int ICM40609D::DataReadyInterruptCallback(int irq, void *context, void *arg)
-{
-	static_cast<ICM40609D *>(arg)->DataReady();
-	return 0;
-}
-
-void ICM40609D::DataReady()
-{
-	_drdy_timestamp_sample.store(hrt_absolute_time());
-	ScheduleNow();
-}
-
-bool ICM40609D::DataReadyInterruptConfigure()
-{
-	if (_drdy_gpio == 0) {
-		return false;
-	}
-
-	// Setup data ready on falling edge
-	return px4_arch_gpiosetevent(_drdy_gpio, false, true, true, &DataReadyInterruptCallback, this) == 0;
-}
-
-bool ICM40609D::DataReadyInterruptDisable()
-{
-	if (_drdy_gpio == 0) {
-		return false;
-	}
-
-	return px4_arch_gpiosetevent(_drdy_gpio, false, false, false, nullptr, nullptr) == 0;
-}
-
 template <typename T>
 bool ICM40609D::RegisterCheck(const T &reg_cfg)
 {
@@ -600,7 +560,7 @@ void ICM40609D::FIFOReset()
 	RegisterSetBits(Register::BANK_0::SIGNAL_PATH_RESET, SIGNAL_PATH_RESET_BIT::FIFO_FLUSH);
 
 	// reset while FIFO is disabled
-	_drdy_timestamp_sample.store(0);
+	DataReadyTimestampReset();
 }
 
 void ICM40609D::ProcessAccel(const hrt_abstime &timestamp_sample, const FIFO::DATA fifo[], const uint8_t samples)
@@ -43,7 +43,6 @@ static constexpr int16_t combine(uint8_t msb, uint8_t lsb)
 ICM42605::ICM42605(const I2CSPIDriverConfig &config) :
 	SPI(config),
 	I2CSPIDriver(config),
-	_drdy_gpio(config.drdy_gpio),
 	_px4_accel(get_device_id(), config.rotation),
 	_px4_gyro(get_device_id(), config.rotation)
 {
@@ -174,16 +173,8 @@ void ICM42605::RunImpl()
 			// if configure succeeded then start reading from FIFO
 			_state = STATE::FIFO_READ;
 
-			if (DataReadyInterruptConfigure()) {
-				_data_ready_interrupt_enabled = true;
-
-				// backup schedule as a watchdog timeout
-				ScheduleDelayed(100_ms);
-
-			} else {
-				_data_ready_interrupt_enabled = false;
-				ScheduleOnInterval(_fifo_empty_interval_us, _fifo_empty_interval_us);
-			}
+			// data ready interrupt driven with a watchdog, or polling if there is no interrupt
+			DataReadyScheduleStart(_fifo_empty_interval_us);
 
 			FIFOReset();
 
@@ -206,11 +197,11 @@ void ICM42605::RunImpl()
 			hrt_abstime timestamp_sample = now;
 			uint8_t samples = 0;
 
-			if (_data_ready_interrupt_enabled) {
-				// scheduled from interrupt if _drdy_timestamp_sample was set as expected
-				const hrt_abstime drdy_timestamp_sample = _drdy_timestamp_sample.fetch_and(0);
+			if (DataReadyInterruptEnabled()) {
+				// scheduled from interrupt if the data ready timestamp was captured as expected
+				const hrt_abstime drdy_timestamp_sample = DataReadyTimestampSample(now, _fifo_empty_interval_us);
 
-				if ((now - drdy_timestamp_sample) < _fifo_empty_interval_us) {
+				if (drdy_timestamp_sample != 0) {
 					timestamp_sample = drdy_timestamp_sample;
 					samples = _fifo_gyro_samples;
 
@@ -425,37 +416,6 @@ bool ICM42605::Configure()
 	return success;
 }
 
-int ICM42605::DataReadyInterruptCallback(int irq, void *context, void *arg)
-{
-	static_cast<ICM42605 *>(arg)->DataReady();
-	return 0;
-}
-
-void ICM42605::DataReady()
-{
-	_drdy_timestamp_sample.store(hrt_absolute_time());
-	ScheduleNow();
-}
-
-bool ICM42605::DataReadyInterruptConfigure()
-{
-	if (_drdy_gpio == 0) {
-		return false;
-	}
-
-	// Setup data ready on falling edge
-	return px4_arch_gpiosetevent(_drdy_gpio, false, true, true, &DataReadyInterruptCallback, this) == 0;
-}
-
-bool ICM42605::DataReadyInterruptDisable()
-{
-	if (_drdy_gpio == 0) {
-		return false;
-	}
-
-	return px4_arch_gpiosetevent(_drdy_gpio, false, false, false, nullptr, nullptr) == 0;
-}
-
 template <typename T>
 bool ICM42605::RegisterCheck(const T &reg_cfg)
 {
@@ -601,7 +561,7 @@ void ICM42605::FIFOReset()
 	RegisterSetBits(Register::BANK_0::SIGNAL_PATH_RESET, SIGNAL_PATH_RESET_BIT::FIFO_FLUSH);
 
 	// reset while FIFO is disabled
-	_drdy_timestamp_sample.store(0);
+	DataReadyTimestampReset();
 }
 
 void ICM42605::ProcessAccel(const hrt_abstime &timestamp_sample, const FIFO::DATA fifo[], const uint8_t samples)
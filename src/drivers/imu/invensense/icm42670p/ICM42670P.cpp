@@ -43,7 +43,6 @@ static constexpr int16_t combine(uint8_t msb, uint8_t lsb)
 ICM42670P::ICM42670P(const I2CSPIDriverConfig &config):
 	SPI(config),
 	I2CSPIDriver(config),
-	_drdy_gpio(config.drdy_gpio),
 	_px4_accel(get_device_id(), config.rotation),
 	_px4_gyro(get_device_id(), config.rotation)
 {
@@ -161,16 +160,8 @@ void ICM42670P::RunImpl()
 			// if configure succeeded then start reading from FIFO
 			_state = STATE::FIFO_READ;
 
-			if (DataReadyInterruptConfigure()) {
-				_data_ready_interrupt_enabled = true;
-
-				// backup schedule as a watchdog timeout
-				ScheduleDelayed(100_ms);
-
-			} else {
-				_data_ready_interrupt_enabled = false;
-				ScheduleOnInterval(_fifo_empty_interval_us, _fifo_empty_interval_us);
-			}
+			// data ready interrupt driven with a watchdog, or polling if there is no interrupt
+			DataReadyScheduleStart(_fifo_empty_interval_us);
 
 			FIFOReset();
 
@@ -193,11 +184,11 @@ void ICM42670P::RunImpl()
 			hrt_abstime timestamp_sample = now;
 			uint8_t samples = 0;
 
-			if (_data_ready_interrupt_enabled) {
-				// scheduled from interrupt if _drdy_timestamp_sample was set as expected
-				const hrt_abstime drdy_timestamp_sample = _drdy_timestamp_sample.fetch_and(0);
+			if (DataReadyInterruptEnabled()) {
+				// scheduled from interrupt if the data ready timestamp was captured as expected
+				const hrt_abstime drdy_timestamp_sample = DataReadyTimestampSample(now, _fifo_empty_interval_us);
 
-				if ((now - drdy_timestamp_sample) < _fifo_empty_interval_us) {
+				if (drdy_timestamp_sample != 0) {
 					timestamp_sample = drdy_timestamp_sample;
 					samples = _fifo_gyro_samples;
 
@@ -355,37 +346,6 @@ bool ICM42670P::Configure()
 	return success;
 }
 
-int ICM42670P::DataReadyInterruptCallback(int irq, void *context, void *arg)
-{
-	static_cast<ICM42670P *>(arg)->DataReady();
-	return 0;
-}
-
-void ICM42670P::DataReady()
-{
-	_drdy_timestamp_sample.store(hrt_absolute_time());
-	ScheduleNow();
-}
-
-bool ICM42670P::DataReadyInterruptConfigure()
-{
-	if (_drdy_gpio == 0) {
-		return false;
-	}
-
-	// Setup data ready on falling edge
-	return px4_arch_gpiosetevent(_drdy_gpio, false, true, true, &DataReadyInterruptCallback, this) == 0;
-}
-
-bool ICM42670P::DataReadyInterruptDisable()
-{
-	if (_drdy_gpio == 0) {
-		return false;
-	}
-
-	return px4_arch_gpiosetevent(_drdy_gpio, false, false, false, nullptr, nullptr) == 0;
-}
-
 template <typename T>
 bool ICM42670P::RegisterCheck(const T &reg_cfg)
 {
@@ -457,7 +417,6 @@ void ICM42670P::RegisterWrite(Register::MREG1 reg, uint8_t value)
 	px4_udelay(10);
 }
 
-
 template <typename T>
 void ICM42670P::RegisterSetAndClearBits(T reg, uint8_t setbits, uint8_t clearbits)
 {
@@ -587,7 +546,7 @@ void ICM42670P::FIFOReset()
 	}
 
 	// reset while FIFO is disabled
-	_drdy_timestamp_sample.store(0);
+	DataReadyTimestampReset();
 }
 
 void ICM42670P::ProcessAccel(const hrt_abstime &timestamp_sample, const FIFO::DATA fifo[], const uint8_t samples)
@@ -48,7 +48,6 @@ static constexpr uint16_t combine_uint(uint8_t msb, uint8_t lsb)
 ICM42688P::ICM42688P(const I2CSPIDriverConfig &config) :
 	SPI(config),
 	I2CSPIDriver(config),
-	_drdy_gpio(config.drdy_gpio),
 	_px4_accel(get_device_id(), config.rotation),
 	_px4_gyro(get_device_id(), config.rotation)
 {
@@ -214,28 +213,25 @@ void ICM42688P::RunImpl()
 		_state = STATE::FIFO_READ;
 		FIFOReset();
 
-		if (DataReadyInterruptConfigure()) {
-			_data_ready_interrupt_enabled = true;
-
-			// backup schedule as a watchdog timeout
-			ScheduleDelayed(100_ms);
-
-		} else {
-			_data_ready_interrupt_enabled = false;
-			ScheduleOnInterval(_fifo_empty_interval_us, _fifo_empty_interval_us);
-		}
+		// data ready interrupt driven with a watchdog, or polling if there is no interrupt
+		DataReadyScheduleStart(_fifo_empty_interval_us);
 
 		break;
 
 	case STATE::FIFO_READ: {
+			if (_fifo_read_pending) {
+				// previous FIFO read still queued on the bus
+				break;
+			}
+
 			hrt_abstime timestamp_sample = now;
 			uint8_t samples = 0;
 
-			if (_data_ready_interrupt_enabled) {
-				// scheduled from interrupt if _drdy_timestamp_sample was set as expected
-				const hrt_abstime drdy_timestamp_sample = _drdy_timestamp_sample.fetch_and(0);
+			if (DataReadyInterruptEnabled()) {
+				// scheduled from interrupt if the data ready timestamp was captured as expected
+				const hrt_abstime drdy_timestamp_sample = DataReadyTimestampSample(now, _fifo_empty_interval_us);
 
-				if ((now - drdy_timestamp_sample) < _fifo_empty_interval_us) {
+				if (drdy_timestamp_sample != 0) {
 					timestamp_sample = drdy_timestamp_sample;
 					samples = _fifo_gyro_samples;
 
@@ -277,45 +273,12 @@ void ICM42688P::RunImpl()
 				}
 			}
 
-			bool success = false;
-
-			if (samples >= 1) {
-				if (FIFORead(timestamp_sample, samples)) {
-					success = true;
-
-					if (_failure_count > 0) {
-						_failure_count--;
-					}
-				}
-			}
-
-			if (!success) {
-				_failure_count++;
-
-				// full reset if things are failing consistently
-				if (_failure_count > 10) {
-					Reset();
-					return;
-				}
+			if ((samples >= 1) && FIFORead(timestamp_sample, samples)) {
+				// finished in FIFOReadComplete() once the bus transfer is done
+				break;
 			}
 
-			if (!success || hrt_elapsed_time(&_last_config_check_timestamp) > 100_ms) {
-				// check configuration registers periodically or immediately following any failure
-				if (RegisterCheck(_register_bank0_cfg[_checked_register_bank0])
-				    && RegisterCheck(_register_bank1_cfg[_checked_register_bank1])
-				    && RegisterCheck(_register_bank2_cfg[_checked_register_bank2])
-				   ) {
-					_last_config_check_timestamp = now;
-					_checked_register_bank0 = (_checked_register_bank0 + 1) % size_register_bank0_cfg;
-					_checked_register_bank1 = (_checked_register_bank1 + 1) % size_register_bank1_cfg;
-					_checked_register_bank2 = (_checked_register_bank2 + 1) % size_register_bank2_cfg;
-
-				} else {
-					// register check failed, force reset
-					perf_count(_bad_register_perf);
-					Reset();
-				}
-			}
+			FIFOReadDone(false);
 		}
 
 		break;
@@ -434,37 +397,6 @@ bool ICM42688P::Configure()
 	return success;
 }
 
-int ICM42688P::DataReadyInterruptCallback(int irq, void *context, void *arg)
-{
-	static_cast<ICM42688P *>(arg)->DataReady();
-	return 0;
-}
-
-void ICM42688P::DataReady()
-{
-	_drdy_timestamp_sample.store(hrt_absolute_time());
-	ScheduleNow();
-}
-
-bool ICM42688P::DataReadyInterruptConfigure()
-{
-	if (_drdy_gpio == 0) {
-		return false;
-	}
-
-	// Setup data ready on falling edge
-	return px4_arch_gpiosetevent(_drdy_gpio, false, true, true, &DataReadyInterruptCallback, this) == 0;
-}
-
-bool ICM42688P::DataReadyInterruptDisable()
-{
-	if (_drdy_gpio == 0) {
-		return false;
-	}
-
-	return px4_arch_gpiosetevent(_drdy_gpio, false, false, false, nullptr, nullptr) == 0;
-}
-
 template <typename T>
 bool ICM42688P::RegisterCheck(const T &reg_cfg)
 {
@@ -532,15 +464,90 @@ uint16_t ICM42688P::FIFOReadCount()
 
 bool ICM42688P::FIFORead(const hrt_abstime &timestamp_sample, uint8_t samples)
 {
-	FIFOTransferBuffer buffer{};
+	_fifo_buffer = FIFOTransferBuffer{};
+	_fifo_timestamp_sample = timestamp_sample;
+	_fifo_samples = samples;
+
 	const size_t transfer_size = math::min(samples * sizeof(FIFO::DATA) + 4, FIFO::SIZE);
 	SelectRegisterBank(REG_BANK_SEL_BIT::BANK_SEL_0);
 
-	if (transfer((uint8_t *)&buffer, (uint8_t *)&buffer, transfer_size) != PX4_OK) {
+	// drained together with the FIFOs of all other devices on the bus, the callback may run immediately
+	_fifo_read_pending = true;
+
+	if (transfer_queued((uint8_t *)&_fifo_buffer, (uint8_t *)&_fifo_buffer, transfer_size,
+			    &FIFOReadCallback, this) != PX4_OK) {
+		_fifo_read_pending = false;
 		perf_count(_bad_transfer_perf);
 		return false;
 	}
 
+	return true;
+}
+
+void ICM42688P::FIFOReadCallback(void *arg, int result)
+{
+	static_cast<ICM42688P *>(arg)->FIFOReadComplete(result);
+}
+
+void ICM42688P::FIFOReadComplete(int result)
+{
+	_fifo_read_pending = false;
+
+	if (_state != STATE::FIFO_READ) {
+		// reset while the transfer was queued
+		return;
+	}
+
+	bool success = false;
+
+	if (result != PX4_OK) {
+		perf_count(_bad_transfer_perf);
+
+	} else {
+		success = FIFOProcess(_fifo_buffer, _fifo_timestamp_sample, _fifo_samples);
+	}
+
+	FIFOReadDone(success);
+}
+
+void ICM42688P::FIFOReadDone(bool success)
+{
+	if (success) {
+		if (_failure_count > 0) {
+			_failure_count--;
+		}
+
+	} else {
+		_failure_count++;
+
+		// full reset if things are failing consistently
+		if (_failure_count > 10) {
+			Reset();
+			return;
+		}
+	}
+
+	if (!success || hrt_elapsed_time(&_last_config_check_timestamp) > 100_ms) {
+		// check configuration registers periodically or immediately following any failure
+		if (RegisterCheck(_register_bank0_cfg[_checked_register_bank0])
+		    && RegisterCheck(_register_bank1_cfg[_checked_register_bank1])
+		    && RegisterCheck(_register_bank2_cfg[_checked_register_bank2])
+		   ) {
+			_last_config_check_timestamp = hrt_absolute_time();
+			_checked_register_bank0 = (_checked_register_bank0 + 1) % size_register_bank0_cfg;
+			_checked_register_bank1 = (_checked_register_bank1 + 1) % size_register_bank1_cfg;
+			_checked_register_bank2 = (_checked_register_bank2 + 1) % size_register_bank2_cfg;
+
+		} else {
+			// register check failed, force reset
+			perf_count(_bad_register_perf);
+			Reset();
+		}
+	}
+}
+
+bool ICM42688P::FIFOProcess(const FIFOTransferBuffer &buffer, const hrt_abstime &timestamp_sample, uint8_t samples)
+{
 	if (buffer.INT_STATUS & INT_STATUS_BIT::FIFO_FULL_INT) {
 		perf_count(_fifo_overflow_perf);
 		FIFOReset();
@@ -628,7 +635,7 @@ void ICM42688P::FIFOReset()
 	RegisterSetBits(Register::BANK_0::SIGNAL_PATH_RESET, SIGNAL_PATH_RESET_BIT::FIFO_FLUSH);
 
 	// reset while FIFO is disabled
-	_drdy_timestamp_sample.store(0);
+	DataReadyTimestampReset();
 }
 
 static constexpr int32_t reassemble_20bit(const uint32_t a, const uint32_t b, const uint32_t c)
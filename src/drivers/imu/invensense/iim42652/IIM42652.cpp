@@ -48,7 +48,6 @@ static constexpr uint16_t combine_uint(uint8_t msb, uint8_t lsb)
 IIM42652::IIM42652(const I2CSPIDriverConfig &config) :
 	SPI(config),
 	I2CSPIDriver(config),
-	_drdy_gpio(config.drdy_gpio),
 	_px4_accel(get_device_id(), config.rotation),
 	_px4_gyro(get_device_id(), config.rotation)
 {
@@ -210,16 +209,8 @@ void IIM42652::RunImpl()
 		_state = STATE::FIFO_READ;
 		FIFOReset();
 
-		if (DataReadyInterruptConfigure()) {
-			_data_ready_interrupt_enabled = true;
-
-			// backup schedule as a watchdog timeout
-			ScheduleDelayed(100_ms);
-
-		} else {
-			_data_ready_interrupt_enabled = false;
-			ScheduleOnInterval(_fifo_empty_interval_us, _fifo_empty_interval_us);
-		}
+		// data ready interrupt driven with a watchdog, or polling if there is no interrupt
+		DataReadyScheduleStart(_fifo_empty_interval_us);
 
 		break;
 
@@ -227,11 +218,11 @@ void IIM42652::RunImpl()
 			hrt_abstime timestamp_sample = now;
 			uint8_t samples = 0;
 
-			if (_data_ready_interrupt_enabled) {
-				// scheduled from interrupt if _drdy_timestamp_sample was set as expected
-				const hrt_abstime drdy_timestamp_sample = _drdy_timestamp_sample.fetch_and(0);
+			if (DataReadyInterruptEnabled()) {
+				// scheduled from interrupt if the data ready timestamp was captured as expected
+				const hrt_abstime drdy_timestamp_sample = DataReadyTimestampSample(now, _fifo_empty_interval_us);
 
-				if ((now - drdy_timestamp_sample) < _fifo_empty_interval_us) {
+				if (drdy_timestamp_sample != 0) {
 					timestamp_sample = drdy_timestamp_sample;
 					samples = _fifo_gyro_samples;
 
@@ -422,37 +413,6 @@ bool IIM42652::Configure()
 	return success;
 }
 
-int IIM42652::DataReadyInterruptCallback(int irq, void *context, void *arg)
-{
-	static_cast<IIM42652 *>(arg)->DataReady();
-	return 0;
-}
-
-void IIM42652::DataReady()
-{
-	_drdy_timestamp_sample.store(hrt_absolute_time());
-	ScheduleNow();
-}
-
-bool IIM42652::DataReadyInterruptConfigure()
-{
-	if (_drdy_gpio == 0) {
-		return false;
-	}
-
-	// Setup data ready on falling edge
-	return px4_arch_gpiosetevent(_drdy_gpio, false, true, true, &DataReadyInterruptCallback, this) == 0;
-}
-
-bool IIM42652::DataReadyInterruptDisable()
-{
-	if (_drdy_gpio == 0) {
-		return false;
-	}
-
-	return px4_arch_gpiosetevent(_drdy_gpio, false, false, false, nullptr, nullptr) == 0;
-}
-
 template <typename T>
 bool IIM42652::RegisterCheck(const T &reg_cfg)
 {
@@ -616,7 +576,7 @@ void IIM42652::FIFOReset()
 	RegisterSetBits(Register::BANK_0::SIGNAL_PATH_RESET, SIGNAL_PATH_RESET_BIT::FIFO_FLUSH);
 
 	// reset while FIFO is disabled
-	_drdy_timestamp_sample.store(0);
+	DataReadyTimestampReset();
 }
 
 static constexpr int32_t reassemble_20bit(const uint32_t a, const uint32_t b, const uint32_t c)
@@ -43,7 +43,8 @@ using namespace pwm_out;
 LinuxPWMOut::LinuxPWMOut() :
 	OutputModuleInterface(MODULE_NAME, px4::wq_configurations::hp_default),
 	_cycle_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")),
-	_interval_perf(perf_alloc(PC_INTERVAL, MODULE_NAME": interval"))
+	_interval_perf(perf_alloc(PC_INTERVAL, MODULE_NAME": interval")),
+	_output_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": output"))
 {
 }
 
@@ -51,6 +52,7 @@ LinuxPWMOut::~LinuxPWMOut()
 {
 	perf_free(_cycle_perf);
 	perf_free(_interval_perf);
+	perf_free(_output_perf);
 	delete _pwm_out;
 }
 
@@ -98,7 +100,9 @@ int LinuxPWMOut::task_spawn(int argc, char *argv[])
 bool LinuxPWMOut::updateOutputs(bool stop_motors, uint16_t outputs[MAX_ACTUATORS],
 				unsigned num_outputs, unsigned num_control_groups_updated)
 {
+	perf_begin(_output_perf);
 	_pwm_out->send_output_pwm(outputs, num_outputs);
+	perf_end(_output_perf);
 	return true;
 }
 
@@ -141,6 +145,7 @@ int LinuxPWMOut::print_status()
 {
 	perf_print_counter(_cycle_perf);
 	perf_print_counter(_interval_perf);
+	perf_print_counter(_output_perf);
 	_mixing_output.printStatus();
 	return 0;
 }
@@ -85,4 +85,5 @@ private:
 
 	perf_counter_t	_cycle_perf;
 	perf_counter_t	_interval_perf;
+	perf_counter_t	_output_perf;
 };
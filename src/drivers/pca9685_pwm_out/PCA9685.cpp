@@ -61,6 +61,8 @@ int PCA9685::init()
 
 	if (ret != PX4_OK) { return ret; }
 
+	invalidateOutputs();
+
 	uint8_t buf[2] = {};
 
 	buf[0] = PCA9685_REG_MODE1;
@@ -146,6 +148,7 @@ int PCA9685::setAllPWM(uint16_t output)
 		(uint8_t)(val & (uint8_t)0xFF),
 		val != 0 ? (uint8_t)(val >> 8) : (uint8_t)PCA9685_LED_ON_FULL_ON_OFF_MASK
 	};
+	invalidateOutputs();
 	return transfer(buf, sizeof(buf), nullptr, 0);
 }
 
@@ -173,6 +176,7 @@ int PCA9685::doRestart()
 		PCA9685_REG_MODE1,
 		PCA9685_DEFAULT_MODE1_CFG | PCA9685_MODE1_RESTART_MASK
 	};
+	invalidateOutputs();
 	return transfer(buf, 2, nullptr, 0);
 }
 
@@ -188,30 +192,69 @@ int PCA9685::probe()
 
 int PCA9685::writePWM(uint8_t idx, const uint16_t *value, uint8_t num)
 {
-	uint8_t buf[PCA9685_PWM_CHANNEL_COUNT * PCA9685_REG_LED_INCREMENT + 1] = {};
-	buf[0] = PCA9685_REG_LED0 + PCA9685_REG_LED_INCREMENT * idx;
+	if (idx + num > PCA9685_PWM_CHANNEL_COUNT) {
+		return PX4_ERROR;
+	}
+
+	// find the span of channels that changed
+	int first = -1;
+	int last = -1;
 
 	for (int i = 0; i < num; ++i) {
-		buf[1 + i * PCA9685_REG_LED_INCREMENT] = 0x00;
+		const int channel = idx + i;
+
+		if (!(_outputs_valid & (1 << channel)) || (_outputs[channel] != value[i])) {
+			if (first < 0) {
+				first = i;
+			}
+
+			last = i;
+		}
+	}
+
+	if (first < 0) {
+		// nothing changed
+		return PX4_OK;
+	}
+
+	// the register address auto increments, the whole span is a single block write
+	uint8_t buf[PCA9685_PWM_CHANNEL_COUNT * PCA9685_REG_LED_INCREMENT + 1] = {};
+	buf[0] = PCA9685_REG_LED0 + PCA9685_REG_LED_INCREMENT * (idx + first);
+
+	for (int i = first; i <= last; ++i) {
+		uint8_t *reg = &buf[1 + (i - first) * PCA9685_REG_LED_INCREMENT];
+		reg[0] = 0x00;
 
 		if (value[i] == 0) {
-			buf[2 + i * PCA9685_REG_LED_INCREMENT] = 0x00;
-			buf[3 + i * PCA9685_REG_LED_INCREMENT] = 0x00;
-			buf[4 + i * PCA9685_REG_LED_INCREMENT] = PCA9685_LED_ON_FULL_ON_OFF_MASK;
+			reg[1] = 0x00;
+			reg[2] = 0x00;
+			reg[3] = PCA9685_LED_ON_FULL_ON_OFF_MASK;
 
 		} else if (value[i] == 4096) {
-			buf[2 + i * PCA9685_REG_LED_INCREMENT] = PCA9685_LED_ON_FULL_ON_OFF_MASK;
-			buf[3 + i * PCA9685_REG_LED_INCREMENT] = 0x00;
-			buf[4 + i * PCA9685_REG_LED_INCREMENT] = 0x00;
+			reg[1] = PCA9685_LED_ON_FULL_ON_OFF_MASK;
+			reg[2] = 0x00;
+			reg[3] = 0x00;
 
 		} else {
-			buf[2 + i * PCA9685_REG_LED_INCREMENT] = 0x00;
-			buf[3 + i * PCA9685_REG_LED_INCREMENT] = (uint8_t)(value[i] & 0xFF);
-			buf[4 + i * PCA9685_REG_LED_INCREMENT] = (uint8_t)(value[i] >> 8);
+			reg[1] = 0x00;
+			reg[2] = (uint8_t)(value[i] & 0xFF);
+			reg[3] = (uint8_t)(value[i] >> 8);
 		}
 	}
 
-	return transfer(buf, num * PCA9685_REG_LED_INCREMENT + 1, nullptr, 0);
+	const int ret = transfer(buf, (last - first + 1) * PCA9685_REG_LED_INCREMENT + 1, nullptr, 0);
+
+	if (ret == PX4_OK) {
+		for (int i = first; i <= last; ++i) {
+			_outputs[idx + i] = value[i];
+			_outputs_valid |= (1 << (idx + i));
+		}
+
+	} else {
+		invalidateOutputs();
+	}
+
+	return ret;
 }
 
 int PCA9685::setDivider(uint8_t value)
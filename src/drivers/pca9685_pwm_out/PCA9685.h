@@ -166,11 +166,21 @@ protected:
 
 	/*
 	 * Write PWM value to PCA9685
+	 *
+	 * Only the span of channels that changed since the last write is sent, in a single auto-increment block write.
 	 */
 	int writePWM(uint8_t idx, const uint16_t *value, uint8_t num);
 
 private:
 	float currentFreq;
+
+	/*
+	 * Forget the last written channel values, forcing the next write to send all channels
+	 */
+	void invalidateOutputs() { _outputs_valid = 0; }
+
+	uint16_t _outputs[PCA9685_PWM_CHANNEL_COUNT] {};	// last raw value written per channel
+	uint16_t _outputs_valid{0};				// bitmask of channels with a known register value
 };
 
 }
@@ -80,6 +80,7 @@ protected:
 
 private:
 	perf_counter_t	_cycle_perf;
+	perf_counter_t	_write_perf;
 
 	enum class STATE : uint8_t {
 		INIT,
@@ -106,7 +107,8 @@ private:
 
 PCA9685Wrapper::PCA9685Wrapper() :
 	OutputModuleInterface(MODULE_NAME, px4::wq_configurations::hp_default),
-	_cycle_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": cycle"))
+	_cycle_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")),
+	_write_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": write"))
 {
 }
 
@@ -119,6 +121,7 @@ PCA9685Wrapper::~PCA9685Wrapper()
 	}
 
 	perf_free(_cycle_perf);
+	perf_free(_write_perf);
 }
 
 int PCA9685Wrapper::init()
@@ -153,7 +156,11 @@ bool PCA9685Wrapper::updateOutputs(bool stop_motors, uint16_t *outputs, unsigned
 		}
 	}
 
-	if (pca9685->updateRAW(low_level_outputs, num_outputs) != PX4_OK) {
+	perf_begin(_write_perf);
+	const int ret = pca9685->updateRAW(low_level_outputs, num_outputs);
+	perf_end(_write_perf);
+
+	if (ret != PX4_OK) {
 		PX4_ERR("Failed to write PWM to PCA9685");
 		return false;
 	}
@@ -277,6 +284,8 @@ int PCA9685Wrapper::print_status() {
             pca9685->get_device_bus(),
             pca9685->get_device_address(),
              (double)(pca9685->getFreq()));
+    perf_print_counter(_cycle_perf);
+    perf_print_counter(_write_perf);
 
     return ret;
 }
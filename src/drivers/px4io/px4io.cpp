@@ -108,7 +108,7 @@ public:
 	 * Initialize all class variables.
 	 */
 	PX4IO() = delete;
-	explicit PX4IO(device::Device *interface);
+	explicit PX4IO(PX4IO_serial *interface);
 
 	~PX4IO() override;
 
@@ -168,13 +168,14 @@ private:
 
 	static constexpr int PX4IO_MAX_ACTUATORS = 8;
 
-	device::Device *const _interface;
+	PX4IO_serial *const _interface;
 
 	unsigned		_hardware{0};		///< Hardware revision
 	unsigned		_max_actuators{0};		///< Maximum # of actuators supported by PX4IO
 	unsigned		_max_controls{0};		///< Maximum # of controls supported by PX4IO
 	unsigned		_max_rc_input{0};		///< Maximum receiver channels supported by PX4IO
 	unsigned		_max_transfer{16};		///< Maximum number of I2C transfers supported by PX4IO
+	unsigned		_protocol_version{0};		///< Protocol version reported by PX4IO
 
 	bool			_first_update_cycle{true};
 	uint32_t    		_group_channels[PX4IO_P_SETUP_PWM_RATE_GROUP3 - PX4IO_P_SETUP_PWM_RATE_GROUP0 + 1] {};
@@ -187,6 +188,7 @@ private:
 	perf_counter_t	_interval_perf{perf_alloc(PC_INTERVAL, MODULE_NAME": interval")};
 	perf_counter_t	_interface_read_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": interface read")};
 	perf_counter_t	_interface_write_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": interface write")};
+	perf_counter_t	_interface_cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": interface cycle")};
 
 	/* cached IO state */
 	uint16_t		_status{0};		///< Various IO status flags
@@ -244,6 +246,12 @@ private:
 	 */
 	int			io_get_status();
 
+	/**
+	 * Handle the status, alarms and arming state read from IO.
+	 */
+	void			io_process_status(uint16_t status_flags, uint16_t status_alarms, uint16_t vservo, uint16_t vrssi,
+						  uint16_t setup_arming);
+
 	/**
 	 * Fetch RC inputs from IO.
 	 *
@@ -252,6 +260,21 @@ private:
 	 */
 	int			io_publish_raw_rc();
 
+	/**
+	 * Publish the RC inputs read from IO if there is a new frame.
+	 *
+	 * @param regs		PX4IO_PAGE_RAW_RC_INPUT registers from PX4IO_P_RAW_RC_COUNT on.
+	 * @param available	Number of channel registers following the prolog.
+	 */
+	void			io_process_raw_rc(const uint16_t *regs, unsigned available);
+
+	/**
+	 * Write the outputs and read status and RC input in a single transaction (PX4IO_PAGE_CYCLE).
+	 *
+	 * @return		OK if the exchange succeeded.
+	 */
+	int			io_cycle(const uint16_t *outputs, unsigned num_outputs);
+
 	/**
 	 * write register(s)
 	 *
@@ -341,7 +364,7 @@ private:
 
 #define PX4IO_DEVICE_PATH	"/dev/px4io"
 
-PX4IO::PX4IO(device::Device *interface) :
+PX4IO::PX4IO(PX4IO_serial *interface) :
 	CDev(PX4IO_DEVICE_PATH),
 	OutputModuleInterface(MODULE_NAME, px4::serial_port_to_wq(PX4IO_SERIAL_DEVICE)),
 	_interface(interface)
@@ -358,6 +381,7 @@ PX4IO::~PX4IO()
 	perf_free(_interval_perf);
 	perf_free(_interface_read_perf);
 	perf_free(_interface_write_perf);
+	perf_free(_interface_cycle_perf);
 }
 
 bool PX4IO::updateOutputs(bool stop_motors, uint16_t outputs[MAX_ACTUATORS],
@@ -371,8 +395,14 @@ bool PX4IO::updateOutputs(bool stop_motors, uint16_t outputs[MAX_ACTUATORS],
 	}
 
 	if (!_test_fmu_fail) {
-		/* output to the servos */
-		io_reg_set(PX4IO_PAGE_DIRECT_PWM, 0, outputs, num_outputs);
+		if (_protocol_version >= PX4IO_PROTOCOL_VERSION_CYCLE) {
+			/* output to the servos and get status and R/C input back */
+			io_cycle(outputs, num_outputs);
+
+		} else {
+			/* output to the servos */
+			io_reg_set(PX4IO_PAGE_DIRECT_PWM, 0, outputs, num_outputs);
+		}
 	}
 
 	return true;
@@ -407,13 +437,14 @@ int PX4IO::init()
 		return -1;
 	}
 
-	if (protocol != PX4IO_PROTOCOL_VERSION) {
+	if ((protocol < PX4IO_PROTOCOL_VERSION_MIN) || (protocol > PX4IO_PROTOCOL_VERSION)) {
 		mavlink_log_emergency(&_mavlink_log_pub, "IO protocol/firmware mismatch, abort.\t");
 		events::send(events::ID("px4io_proto_fw_mismatch"), events::Log::Emergency,
 			     "IO protocol/firmware mismatch, aborting initialization");
 		return -1;
 	}
 
+	_protocol_version = protocol;
 	_hardware      = io_reg_get(PX4IO_PAGE_CONFIG, PX4IO_P_CONFIG_HARDWARE_VERSION);
 	_max_actuators = io_reg_get(PX4IO_PAGE_CONFIG, PX4IO_P_CONFIG_ACTUATOR_COUNT);
 	_max_controls  = io_reg_get(PX4IO_PAGE_CONFIG, PX4IO_P_CONFIG_CONTROL_COUNT);
@@ -525,7 +556,7 @@ void PX4IO::Run()
 	_mixing_output.update();
 
 	if (hrt_elapsed_time(&_poll_last) >= 20_ms) {
-		/* run at 50 */
+		/* run at 50, unless already handled by io_cycle() */
 		_poll_last = hrt_absolute_time();
 
 		/* pull status and alarms from IO */
@@ -928,11 +959,16 @@ int PX4IO::io_get_status()
 		return ret;
 	}
 
-	const uint16_t STATUS_FLAGS  = regs[0];
-	const uint16_t STATUS_ALARMS = regs[1];
-	const uint16_t STATUS_VSERVO = regs[4];
-	const uint16_t STATUS_VRSSI  = regs[5];
+	const uint16_t SETUP_ARMING = io_reg_get(PX4IO_PAGE_SETUP, PX4IO_P_SETUP_ARMING);
+
+	io_process_status(regs[0], regs[1], regs[4], regs[5], SETUP_ARMING);
 
+	return ret;
+}
+
+void PX4IO::io_process_status(uint16_t STATUS_FLAGS, uint16_t STATUS_ALARMS, uint16_t STATUS_VSERVO,
+			      uint16_t STATUS_VRSSI, uint16_t SETUP_ARMING)
+{
 	io_handle_status(STATUS_FLAGS);
 
 	const float rssi_v = STATUS_VRSSI * 0.001f; // voltage is scaled to mV
@@ -947,7 +983,6 @@ int PX4IO::io_get_status()
 		_analog_rc_rssi_stable = true;
 	}
 
-	const uint16_t SETUP_ARMING = io_reg_get(PX4IO_PAGE_SETUP, PX4IO_P_SETUP_ARMING);
 
 	if ((hrt_elapsed_time(&_last_status_publish) >= 1_s)
 	    || (_status != STATUS_FLAGS)
@@ -1020,29 +1055,16 @@ int PX4IO::io_get_status()
 
 	_alarms = STATUS_ALARMS;
 	_setup_arming = SETUP_ARMING;
-
-	return ret;
 }
 
 int PX4IO::io_publish_raw_rc()
 {
 	const uint16_t rc_valid_update_count = io_reg_get(PX4IO_PAGE_RAW_RC_INPUT, PX4IO_P_RAW_FRAME_COUNT);
-	const bool rc_updated = (rc_valid_update_count != _rc_valid_update_count);
-	_rc_valid_update_count = rc_valid_update_count;
 
-	if (!rc_updated) {
+	if (rc_valid_update_count == _rc_valid_update_count) {
 		return 0;
 	}
 
-	input_rc_s input_rc{};
-	input_rc.timestamp_last_signal = hrt_absolute_time();
-
-	/* set the RC status flag ORDER MATTERS! */
-	input_rc.rc_lost = !(_status & PX4IO_P_STATUS_FLAGS_RC_OK);
-
-	/* we don't have the status bits, so input_source has to be set elsewhere */
-	input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_UNKNOWN;
-
 	const unsigned prolog = (PX4IO_P_RAW_RC_BASE - PX4IO_P_RAW_RC_COUNT);
 	uint16_t regs[input_rc_s::RC_INPUT_MAX_CHANNELS + prolog];
 
@@ -1061,9 +1083,45 @@ int PX4IO::io_publish_raw_rc()
 	 * Get the channel count any any extra channels. This is no more expensive than reading the
 	 * channel count once.
 	 */
-	uint32_t channel_count = regs[PX4IO_P_RAW_RC_COUNT];
+	unsigned channel_count = math::min((unsigned)regs[PX4IO_P_RAW_RC_COUNT], (unsigned)input_rc_s::RC_INPUT_MAX_CHANNELS);
+
+	if (channel_count > 9) {
+		ret = io_reg_get(PX4IO_PAGE_RAW_RC_INPUT, PX4IO_P_RAW_RC_BASE + 9, &regs[prolog + 9], channel_count - 9);
+
+		if (ret != OK) {
+			return ret;
+		}
+	}
+
+	io_process_raw_rc(regs, math::max(channel_count, 9u));
+
+	return ret;
+}
+
+void PX4IO::io_process_raw_rc(const uint16_t *regs, unsigned available)
+{
+	const uint16_t rc_valid_update_count = regs[PX4IO_P_RAW_FRAME_COUNT];
+	const bool rc_updated = (rc_valid_update_count != _rc_valid_update_count);
+	_rc_valid_update_count = rc_valid_update_count;
+
+	if (!rc_updated) {
+		return;
+	}
+
+	input_rc_s input_rc{};
+	input_rc.timestamp_last_signal = hrt_absolute_time();
+
+	/* set the RC status flag ORDER MATTERS! */
+	input_rc.rc_lost = !(_status & PX4IO_P_STATUS_FLAGS_RC_OK);
+
+	/* we don't have the status bits, so input_source has to be set elsewhere */
+	input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_UNKNOWN;
+
+	const unsigned prolog = (PX4IO_P_RAW_RC_BASE - PX4IO_P_RAW_RC_COUNT);
 
 	/* limit the channel count */
+	uint32_t channel_count = math::min((unsigned)regs[PX4IO_P_RAW_RC_COUNT], available);
+
 	if (channel_count > input_rc_s::RC_INPUT_MAX_CHANNELS) {
 		channel_count = input_rc_s::RC_INPUT_MAX_CHANNELS;
 	}
@@ -1099,14 +1157,6 @@ int PX4IO::io_publish_raw_rc()
 	/* FIELDS NOT SET HERE */
 	/* input_rc.input_source is set after this call XXX we might want to mirror the flags in the RC struct */
 
-	if (channel_count > 9) {
-		ret = io_reg_get(PX4IO_PAGE_RAW_RC_INPUT, PX4IO_P_RAW_RC_BASE + 9, &regs[prolog + 9], channel_count - 9);
-
-		if (ret != OK) {
-			return ret;
-		}
-	}
-
 	/* last thing set are the actual channel values as 16 bit values */
 	for (unsigned i = 0; i < channel_count; i++) {
 		input_rc.values[i] = regs[prolog + i];
@@ -1149,10 +1199,38 @@ int PX4IO::io_publish_raw_rc()
 
 		_input_rc_pub.publish(input_rc);
 	}
+}
 
-	return ret;
+int PX4IO::io_cycle(const uint16_t *outputs, unsigned num_outputs)
+{
+	uint16_t regs[PKT_MAX_REGS];
+
+	perf_begin(_interface_cycle_perf);
+	int ret = _interface->exchange(PX4IO_PAGE_CYCLE << 8, outputs, num_outputs, regs, PKT_MAX_REGS);
+	perf_end(_interface_cycle_perf);
+
+	static constexpr int prolog = PX4IO_P_CYCLE_RAW_RC + (PX4IO_P_RAW_RC_BASE - PX4IO_P_RAW_RC_COUNT);
+
+	if (ret < prolog) {
+		PX4_DEBUG("io_cycle(%u): error %d", num_outputs, ret);
+		return -1;
+	}
+
+	/* status at the regular polling rate */
+	if (hrt_elapsed_time(&_poll_last) >= 20_ms) {
+		_poll_last = hrt_absolute_time();
+
+		io_process_status(regs[PX4IO_P_CYCLE_STATUS_FLAGS], regs[PX4IO_P_CYCLE_STATUS_ALARMS], regs[PX4IO_P_CYCLE_VSERVO],
+				  regs[PX4IO_P_CYCLE_VRSSI], regs[PX4IO_P_CYCLE_SETUP_ARMING]);
+	}
+
+	/* R/C input with every output update */
+	io_process_raw_rc(&regs[PX4IO_P_CYCLE_RAW_RC], ret - prolog);
+
+	return OK;
 }
 
+
 int PX4IO::io_reg_set(uint8_t page, uint8_t offset, const uint16_t *values, unsigned num_values)
 {
 	/* range check the transfer */
@@ -1401,7 +1479,7 @@ int PX4IO::ioctl(file *filep, int cmd, unsigned long arg)
 
 static device::Device *get_interface()
 {
-	device::Device *interface = PX4IO_serial_interface();
+	PX4IO_serial *interface = PX4IO_serial_interface();
 
 	if (interface != nullptr) {
 		if (interface->init() != OK) {
@@ -1424,7 +1502,7 @@ int PX4IO::checkcrc(int argc, char *argv[])
 		return 1;
 	}
 
-	device::Device *interface = get_interface();
+	PX4IO_serial *interface = get_interface();
 
 	if (interface == nullptr) {
 		PX4_ERR("interface allocation failed");
@@ -1516,7 +1594,7 @@ int PX4IO::bind(int argc, char *argv[])
 
 int PX4IO::task_spawn(int argc, char *argv[])
 {
-	device::Device *interface = get_interface();
+	PX4IO_serial *interface = get_interface();
 
 	if (interface == nullptr) {
 		PX4_ERR("Failed to create interface");
@@ -1574,7 +1652,7 @@ int PX4IO::custom_command(int argc, char *argv[])
 
 		while (ret != OK && retries < MAX_RETRIES) {
 
-			device::Device *interface = get_interface();
+			PX4IO_serial *interface = get_interface();
 
 			if (interface == nullptr) {
 				PX4_ERR("interface allocation failed");
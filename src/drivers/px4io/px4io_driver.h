@@ -42,7 +42,7 @@
 #include <board_config.h>
 
 #ifdef PX4IO_SERIAL_BASE
-#include <drivers/device/device.h>
+#include <px4_arch/px4io_serial.h>
 
-device::Device	*PX4IO_serial_interface();
+PX4IO_serial	*PX4IO_serial_interface();
 #endif
@@ -41,6 +41,7 @@
 using namespace time_literals;
 
 constexpr char const *RCInput::RC_SCAN_STRING[];
+constexpr RCInput::RcScanGroup RCInput::RC_SCAN_GROUPS[];
 
 RCInput::RCInput(const char *device) :
 	ModuleParams(nullptr),
@@ -323,6 +324,263 @@ void  RCInput::swap_rx_tx()
 #endif // RC_SERIAL_SWAP_USING_SINGLEWIRE
 }
 
+int RCInput::rc_scan_group(RC_SCAN protocol)
+{
+	for (int group = 0; group < RC_SCAN_GROUP_COUNT; group++) {
+		for (RC_SCAN group_protocol : RC_SCAN_GROUPS[group].protocols) {
+			if (group_protocol == protocol) {
+				return group;
+			}
+		}
+	}
+
+	return 0;
+}
+
+void RCInput::rc_scan_configure(RC_SCAN protocol)
+{
+	switch (protocol) {
+	case RC_SCAN_SBUS:
+		// Configure serial port for SBUS
+		sbus_config(_rcs_fd, board_rc_singlewire(_device));
+		rc_io_invert(true);
+		break;
+
+	case RC_SCAN_DSM:
+	case RC_SCAN_ST24:
+	case RC_SCAN_SUMD:
+		// Configure serial port for DSM (ST24 and SUMD use the same settings)
+		dsm_config(_rcs_fd);
+		swap_rx_tx();
+		break;
+
+	case RC_SCAN_PPM:
+#ifdef HRT_PPM_CHANNEL
+		// Configure timer input pin for CPPM
+		px4_arch_configgpio(GPIO_PPM_IN);
+#endif // HRT_PPM_CHANNEL
+		return;
+
+	case RC_SCAN_CRSF:
+	case RC_SCAN_GHST:
+		// Configure serial port for GHST, CRSF uses the same settings
+		ghst_config(_rcs_fd);
+		swap_rx_tx();
+		break;
+
+	case RC_SCAN_NONE:
+		return;
+	}
+
+	// flush serial buffer and any existing buffered data
+	tcflush(_rcs_fd, TCIOFLUSH);
+	memset(_rcs_buf, 0, sizeof(_rcs_buf));
+}
+
+void RCInput::rc_scan_release(RC_SCAN protocol)
+{
+	switch (protocol) {
+	case RC_SCAN_SBUS:
+		rc_io_invert(false);
+		break;
+
+	case RC_SCAN_PPM:
+#ifdef HRT_PPM_CHANNEL
+		// disable CPPM input by mapping it away from the timer capture input
+		px4_arch_unconfiggpio(GPIO_PPM_IN);
+#endif // HRT_PPM_CHANNEL
+		break;
+
+	default:
+		break;
+	}
+}
+
+bool RCInput::rc_parse(RC_SCAN protocol, hrt_abstime cycle_timestamp, int new_bytes, bool &valid)
+{
+	bool rc_updated = false;
+	unsigned frame_drops = 0;
+
+	switch (protocol) {
+	case RC_SCAN_NONE:
+		break;
+
+	case RC_SCAN_SBUS:
+
+		// parse new data
+		if (new_bytes > 0) {
+			bool sbus_failsafe = false;
+			bool sbus_frame_drop = false;
+
+			rc_updated = sbus_parse(cycle_timestamp, &_rcs_buf[0], new_bytes, &_raw_rc_values[0], &_raw_rc_count, &sbus_failsafe,
+						&sbus_frame_drop, &frame_drops, input_rc_s::RC_INPUT_MAX_CHANNELS);
+
+			if (rc_updated) {
+				// we have a new SBUS frame. Publish it.
+				_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_SBUS;
+				valid = fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp,
+						   sbus_frame_drop, sbus_failsafe, frame_drops) > 0;
+			}
+		}
+
+		break;
+
+	case RC_SCAN_DSM:
+		if (new_bytes > 0) {
+			int8_t dsm_rssi = 0;
+			bool dsm_11_bit = false;
+
+			// parse new data
+			rc_updated = dsm_parse(cycle_timestamp, &_rcs_buf[0], new_bytes, &_raw_rc_values[0], &_raw_rc_count,
+					       &dsm_11_bit, &frame_drops, &dsm_rssi, input_rc_s::RC_INPUT_MAX_CHANNELS);
+
+			if (rc_updated) {
+				// we have a new DSM frame. Publish it.
+				_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_DSM;
+				valid = fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp,
+						   false, false, frame_drops, dsm_rssi) > 0;
+			}
+		}
+
+		break;
+
+	case RC_SCAN_ST24:
+		if (new_bytes > 0) {
+			// parse new data
+			uint8_t st24_rssi, lost_count;
+
+			for (unsigned i = 0; i < (unsigned)new_bytes; i++) {
+				/* set updated flag if one complete packet was parsed */
+				st24_rssi = input_rc_s::RSSI_MAX;
+				rc_updated = (OK == st24_decode(_rcs_buf[i], &st24_rssi, &lost_count,
+								&_raw_rc_count, _raw_rc_values, input_rc_s::RC_INPUT_MAX_CHANNELS));
+			}
+
+			// The st24 will keep outputting RC channels and RSSI even if RC has been lost.
+			// The only way to detect RC loss is therefore to look at the lost_count.
+
+			if (rc_updated) {
+				if (lost_count == 0) {
+					// we have a new ST24 frame. Publish it.
+					_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_ST24;
+					valid = fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp,
+							   false, false, frame_drops, st24_rssi) > 0;
+
+				} else {
+					// if the lost count > 0 means that there is an RC loss
+					_input_rc.rc_lost = true;
+				}
+			}
+		}
+
+		break;
+
+	case RC_SCAN_SUMD:
+		if (new_bytes > 0) {
+			// parse new data
+			uint8_t sumd_rssi, rx_count;
+			bool sumd_failsafe;
+
+			for (unsigned i = 0; i < (unsigned)new_bytes; i++) {
+				/* set updated flag if one complete packet was parsed */
+				sumd_rssi = input_rc_s::RSSI_MAX;
+				rc_updated = (OK == sumd_decode(_rcs_buf[i], &sumd_rssi, &rx_count,
+								&_raw_rc_count, _raw_rc_values, input_rc_s::RC_INPUT_MAX_CHANNELS, &sumd_failsafe));
+			}
+
+			if (rc_updated) {
+				// we have a new SUMD frame. Publish it.
+				_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_SUMD;
+				valid = fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp,
+						   false, sumd_failsafe, frame_drops, sumd_rssi) > 0;
+			}
+		}
+
+		break;
+
+	case RC_SCAN_PPM:
+#ifdef HRT_PPM_CHANNEL
+
+		// see if we have new PPM input data
+		if ((ppm_last_valid_decode != _input_rc.timestamp_last_signal) && ppm_decoded_channels > 3) {
+			// we have a new PPM frame. Publish it.
+			rc_updated = true;
+			_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_PPM;
+			valid = fill_rc_in(ppm_decoded_channels, ppm_buffer, cycle_timestamp, false, false, 0) > 0;
+
+			_input_rc.rc_ppm_frame_length = ppm_frame_length;
+			_input_rc.timestamp_last_signal = ppm_last_valid_decode;
+		}
+
+#endif // HRT_PPM_CHANNEL
+		break;
+
+	case RC_SCAN_CRSF:
+
+		// parse new data
+		if (new_bytes > 0) {
+			rc_updated = crsf_parse(cycle_timestamp, &_rcs_buf[0], new_bytes, &_raw_rc_values[0], &_raw_rc_count,
+						input_rc_s::RC_INPUT_MAX_CHANNELS);
+
+			if (rc_updated) {
+				// we have a new CRSF frame. Publish it.
+				_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_CRSF;
+				valid = fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp, false, false, 0) > 0;
+
+				// on Pixhawk (-related) boards we cannot write to the RC UART
+				// another option is to use a different UART port
+#ifdef BOARD_SUPPORTS_RC_SERIAL_PORT_OUTPUT
+
+				if (!_rc_scan_locked && !_crsf_telemetry) {
+					_crsf_telemetry = new CRSFTelemetry(_rcs_fd);
+				}
+
+#endif /* BOARD_SUPPORTS_RC_SERIAL_PORT_OUTPUT */
+
+				if (_crsf_telemetry) {
+					_crsf_telemetry->update(cycle_timestamp);
+				}
+			}
+		}
+
+		break;
+
+	case RC_SCAN_GHST:
+
+		// parse new data
+		if (new_bytes > 0) {
+			int8_t ghst_rssi = -1;
+			rc_updated = ghst_parse(cycle_timestamp, &_rcs_buf[0], new_bytes, &_raw_rc_values[0], &ghst_rssi,
+						&_raw_rc_count, input_rc_s::RC_INPUT_MAX_CHANNELS);
+
+			if (rc_updated) {
+				// we have a new GHST frame. Publish it.
+				_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_GHST;
+				valid = fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp, false, false, 0, ghst_rssi) > 0;
+
+				// ghst telemetry works on fmu-v5
+				// on other Pixhawk (-related) boards we cannot write to the RC UART
+				// another option is to use a different UART port
+#ifdef BOARD_SUPPORTS_RC_SERIAL_PORT_OUTPUT
+
+				if (!_rc_scan_locked && !_ghst_telemetry) {
+					_ghst_telemetry = new GHSTTelemetry(_rcs_fd);
+				}
+
+#endif /* BOARD_SUPPORTS_RC_SERIAL_PORT_OUTPUT */
+
+				if (_ghst_telemetry) {
+					_ghst_telemetry->update(cycle_timestamp);
+				}
+			}
+		}
+
+		break;
+	}
+
+	return rc_updated;
+}
+
 void RCInput::Run()
 {
 	if (should_exit()) {
@@ -450,8 +708,6 @@ void RCInput::Run()
 		// Scan for 500 msec, then switch protocol
 		constexpr hrt_abstime rc_scan_max = 500_ms;
 
-		unsigned frame_drops = 0;
-
 		// TODO: needs work (poll _rcs_fd)
 		// int ret = poll(fds, sizeof(fds) / sizeof(fds[0]), 100);
 		// then update priority to SCHED_PRIORITY_FAST_DRIVER
@@ -466,338 +722,46 @@ void RCInput::Run()
 
 		const bool rc_scan_locked = _rc_scan_locked;
 
-		switch (_rc_scan_state) {
-		case RC_SCAN_NONE:
+		if (_rc_scan_state == RC_SCAN_NONE) {
 			// do nothing
-			break;
-
-		case RC_SCAN_SBUS:
-			if (_rc_scan_begin == 0) {
-				_rc_scan_begin = cycle_timestamp;
-				// Configure serial port for SBUS
-				sbus_config(_rcs_fd, board_rc_singlewire(_device));
-				rc_io_invert(true);
-
-				// flush serial buffer and any existing buffered data
-				tcflush(_rcs_fd, TCIOFLUSH);
-				memset(_rcs_buf, 0, sizeof(_rcs_buf));
-
-			} else if (_rc_scan_locked
-				   || cycle_timestamp - _rc_scan_begin < rc_scan_max) {
-
-				// parse new data
-				if (newBytes > 0) {
-					bool sbus_failsafe = false;
-					bool sbus_frame_drop = false;
-
-					rc_updated = sbus_parse(cycle_timestamp, &_rcs_buf[0], newBytes, &_raw_rc_values[0], &_raw_rc_count, &sbus_failsafe,
-								&sbus_frame_drop, &frame_drops, input_rc_s::RC_INPUT_MAX_CHANNELS);
-
-					if (rc_updated) {
-						// we have a new SBUS frame. Publish it.
-						_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_SBUS;
-						int32_t valid_chans = fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp,
-										 sbus_frame_drop, sbus_failsafe, frame_drops);
-
-						if (valid_chans > 0) {
-							_rc_scan_locked = true;
-						}
-					}
-				}
-
-			} else {
-				// Scan the next protocol
-				rc_io_invert(false);
-				set_rc_scan_state(RC_SCAN_DSM);
-			}
-
-			break;
-
-		case RC_SCAN_DSM:
-			if (_rc_scan_begin == 0) {
-				_rc_scan_begin = cycle_timestamp;
-				// Configure serial port for DSM
-				dsm_config(_rcs_fd);
-				swap_rx_tx();
-
-				// flush serial buffer and any existing buffered data
-				tcflush(_rcs_fd, TCIOFLUSH);
-				memset(_rcs_buf, 0, sizeof(_rcs_buf));
-
-			} else if (_rc_scan_locked
-				   || cycle_timestamp - _rc_scan_begin < rc_scan_max) {
-
-				if (newBytes > 0) {
-					int8_t dsm_rssi = 0;
-					bool dsm_11_bit = false;
-
-					// parse new data
-					rc_updated = dsm_parse(cycle_timestamp, &_rcs_buf[0], newBytes, &_raw_rc_values[0], &_raw_rc_count,
-							       &dsm_11_bit, &frame_drops, &dsm_rssi, input_rc_s::RC_INPUT_MAX_CHANNELS);
-
-					if (rc_updated) {
-						// we have a new DSM frame. Publish it.
-						_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_DSM;
-						int32_t valid_chans = fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp,
-										 false, false, frame_drops, dsm_rssi);
-
-						if (valid_chans > 0) {
-							_rc_scan_locked = true;
-						}
-					}
-				}
 
-			} else {
-				// Scan the next protocol
-				set_rc_scan_state(RC_SCAN_ST24);
-			}
-
-			break;
-
-		case RC_SCAN_ST24:
-			if (_rc_scan_begin == 0) {
-				_rc_scan_begin = cycle_timestamp;
-				// Configure serial port for DSM
-				dsm_config(_rcs_fd);
-				swap_rx_tx();
-
-				// flush serial buffer and any existing buffered data
-				tcflush(_rcs_fd, TCIOFLUSH);
-				memset(_rcs_buf, 0, sizeof(_rcs_buf));
-
-			} else if (_rc_scan_locked
-				   || cycle_timestamp - _rc_scan_begin < rc_scan_max) {
-
-				if (newBytes > 0) {
-					// parse new data
-					uint8_t st24_rssi, lost_count;
-
-					rc_updated = false;
-
-					for (unsigned i = 0; i < (unsigned)newBytes; i++) {
-						/* set updated flag if one complete packet was parsed */
-						st24_rssi = input_rc_s::RSSI_MAX;
-						rc_updated = (OK == st24_decode(_rcs_buf[i], &st24_rssi, &lost_count,
-										&_raw_rc_count, _raw_rc_values, input_rc_s::RC_INPUT_MAX_CHANNELS));
-					}
+		} else if (_rc_scan_begin == 0) {
+			_rc_scan_begin = cycle_timestamp;
+			rc_scan_configure(_rc_scan_state);
 
-					// The st24 will keep outputting RC channels and RSSI even if RC has been lost.
-					// The only way to detect RC loss is therefore to look at the lost_count.
+		} else if (_rc_scan_locked
+			   || cycle_timestamp - _rc_scan_begin < rc_scan_max) {
 
-					if (rc_updated) {
-						if (lost_count == 0) {
-							// we have a new ST24 frame. Publish it.
-							_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_ST24;
-							int32_t valid_chans = fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp,
-											 false, false, frame_drops, st24_rssi);
-
-							if (valid_chans > 0) {
-								_rc_scan_locked = true;
-							}
-
-						} else {
-							// if the lost count > 0 means that there is an RC loss
-							_input_rc.rc_lost = true;
-						}
-					}
-				}
+			// while scanning, all protocols sharing the port configuration parse the data in parallel
+			RC_SCAN protocols[RC_SCAN_GROUP_SIZE] {_rc_scan_state};
 
-			} else {
-				// Scan the next protocol
-				set_rc_scan_state(RC_SCAN_SUMD);
+			if (!_rc_scan_locked && (_param_rc_input_proto.get() < 0)) {
+				memcpy(protocols, RC_SCAN_GROUPS[rc_scan_group(_rc_scan_state)].protocols, sizeof(protocols));
 			}
 
-			break;
-
-		case RC_SCAN_SUMD:
-			if (_rc_scan_begin == 0) {
-				_rc_scan_begin = cycle_timestamp;
-				// Configure serial port for DSM
-				dsm_config(_rcs_fd);
-				swap_rx_tx();
-
-				// flush serial buffer and any existing buffered data
-				tcflush(_rcs_fd, TCIOFLUSH);
-				memset(_rcs_buf, 0, sizeof(_rcs_buf));
-
-			} else if (_rc_scan_locked
-				   || cycle_timestamp - _rc_scan_begin < rc_scan_max) {
-
-				if (newBytes > 0) {
-					// parse new data
-					uint8_t sumd_rssi, rx_count;
-					bool sumd_failsafe;
-
-					rc_updated = false;
-
-					for (unsigned i = 0; i < (unsigned)newBytes; i++) {
-						/* set updated flag if one complete packet was parsed */
-						sumd_rssi = input_rc_s::RSSI_MAX;
-						rc_updated = (OK == sumd_decode(_rcs_buf[i], &sumd_rssi, &rx_count,
-										&_raw_rc_count, _raw_rc_values, input_rc_s::RC_INPUT_MAX_CHANNELS, &sumd_failsafe));
-					}
-
-					if (rc_updated) {
-						// we have a new SUMD frame. Publish it.
-						_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_SUMD;
-						int32_t valid_chans = fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp,
-										 false, sumd_failsafe, frame_drops, sumd_rssi);
-
-						if (valid_chans > 0) {
-							_rc_scan_locked = true;
-						}
-					}
+			for (RC_SCAN protocol : protocols) {
+				if (protocol == RC_SCAN_NONE) {
+					break;
 				}
 
-			} else {
-				// Scan the next protocol
-				set_rc_scan_state(RC_SCAN_PPM);
-			}
-
-			break;
+				bool valid = false;
 
-		case RC_SCAN_PPM:
-			// skip PPM if it's not supported
-#ifdef HRT_PPM_CHANNEL
-			if (_rc_scan_begin == 0) {
-				_rc_scan_begin = cycle_timestamp;
-				// Configure timer input pin for CPPM
-				px4_arch_configgpio(GPIO_PPM_IN);
-
-			} else if (_rc_scan_locked || cycle_timestamp - _rc_scan_begin < rc_scan_max) {
-
-				// see if we have new PPM input data
-				if ((ppm_last_valid_decode != _input_rc.timestamp_last_signal) && ppm_decoded_channels > 3) {
-					// we have a new PPM frame. Publish it.
+				if (rc_parse(protocol, cycle_timestamp, newBytes, valid)) {
 					rc_updated = true;
-					_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_PPM;
-					int32_t valid_chans = fill_rc_in(ppm_decoded_channels, ppm_buffer, cycle_timestamp, false, false, 0);
 
-					if (valid_chans > 0) {
+					if (valid) {
+						// lock onto the first protocol with a valid stream
+						_rc_scan_state = protocol;
 						_rc_scan_locked = true;
+						break;
 					}
-
-					_input_rc.rc_ppm_frame_length = ppm_frame_length;
-					_input_rc.timestamp_last_signal = ppm_last_valid_decode;
 				}
-
-			} else {
-				// disable CPPM input by mapping it away from the timer capture input
-				px4_arch_unconfiggpio(GPIO_PPM_IN);
-				// Scan the next protocol
-				set_rc_scan_state(RC_SCAN_CRSF);
 			}
 
-#else   // skip PPM if it's not supported
-			set_rc_scan_state(RC_SCAN_CRSF);
-
-#endif  // HRT_PPM_CHANNEL
-
-			break;
-
-		case RC_SCAN_CRSF:
-			if (_rc_scan_begin == 0) {
-				_rc_scan_begin = cycle_timestamp;
-				// Configure serial port for CRSF
-				crsf_config(_rcs_fd);
-				swap_rx_tx();
-
-				// flush serial buffer and any existing buffered data
-				tcflush(_rcs_fd, TCIOFLUSH);
-				memset(_rcs_buf, 0, sizeof(_rcs_buf));
-
-			} else if (_rc_scan_locked
-				   || cycle_timestamp - _rc_scan_begin < rc_scan_max) {
-
-				// parse new data
-				if (newBytes > 0) {
-					rc_updated = crsf_parse(cycle_timestamp, &_rcs_buf[0], newBytes, &_raw_rc_values[0], &_raw_rc_count,
-								input_rc_s::RC_INPUT_MAX_CHANNELS);
-
-					if (rc_updated) {
-						// we have a new CRSF frame. Publish it.
-						_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_CRSF;
-						int32_t valid_chans = fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp, false, false, 0);
-
-						// on Pixhawk (-related) boards we cannot write to the RC UART
-						// another option is to use a different UART port
-#ifdef BOARD_SUPPORTS_RC_SERIAL_PORT_OUTPUT
-
-						if (!_rc_scan_locked && !_crsf_telemetry) {
-							_crsf_telemetry = new CRSFTelemetry(_rcs_fd);
-						}
-
-#endif /* BOARD_SUPPORTS_RC_SERIAL_PORT_OUTPUT */
-
-						if (valid_chans > 0) {
-							_rc_scan_locked = true;
-						}
-
-						if (_crsf_telemetry) {
-							_crsf_telemetry->update(cycle_timestamp);
-						}
-					}
-				}
-
-			} else {
-				// Scan the next protocol
-				set_rc_scan_state(RC_SCAN_GHST);
-			}
-
-			break;
-
-		case RC_SCAN_GHST:
-			if (_rc_scan_begin == 0) {
-				_rc_scan_begin = cycle_timestamp;
-				// Configure serial port for GHST
-				ghst_config(_rcs_fd);
-				swap_rx_tx();
-
-				// flush serial buffer and any existing buffered data
-				tcflush(_rcs_fd, TCIOFLUSH);
-				memset(_rcs_buf, 0, sizeof(_rcs_buf));
-
-			} else if (_rc_scan_locked
-				   || cycle_timestamp - _rc_scan_begin < rc_scan_max) {
-
-				// parse new data
-				if (newBytes > 0) {
-					int8_t ghst_rssi = -1;
-					rc_updated = ghst_parse(cycle_timestamp, &_rcs_buf[0], newBytes, &_raw_rc_values[0], &ghst_rssi,
-								&_raw_rc_count, input_rc_s::RC_INPUT_MAX_CHANNELS);
-
-					if (rc_updated) {
-						// we have a new GHST frame. Publish it.
-						_input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_PX4FMU_GHST;
-						int32_t valid_chans = fill_rc_in(_raw_rc_count, _raw_rc_values, cycle_timestamp, false, false, 0, ghst_rssi);
-
-						// ghst telemetry works on fmu-v5
-						// on other Pixhawk (-related) boards we cannot write to the RC UART
-						// another option is to use a different UART port
-#ifdef BOARD_SUPPORTS_RC_SERIAL_PORT_OUTPUT
-
-						if (!_rc_scan_locked && !_ghst_telemetry) {
-							_ghst_telemetry = new GHSTTelemetry(_rcs_fd);
-						}
-
-#endif /* BOARD_SUPPORTS_RC_SERIAL_PORT_OUTPUT */
-
-						if (valid_chans > 0) {
-							_rc_scan_locked = true;
-						}
-
-						if (_ghst_telemetry) {
-							_ghst_telemetry->update(cycle_timestamp);
-						}
-					}
-				}
-
-			} else {
-				// Scan the next protocol
-				set_rc_scan_state(RC_SCAN_SBUS);
-			}
-
-			break;
+		} else {
+			// Scan the next protocol group
+			rc_scan_release(_rc_scan_state);
+			set_rc_scan_state(RC_SCAN_GROUPS[(rc_scan_group(_rc_scan_state) + 1) % RC_SCAN_GROUP_COUNT].protocols[0]);
 		}
 
 		perf_end(_cycle_perf);
@@ -810,8 +774,10 @@ void RCInput::Run()
 
 			_input_rc_pub.publish(_input_rc);
 
-		} else if (!rc_updated && !_armed && (hrt_elapsed_time(&_input_rc.timestamp_last_signal) > 1_s)) {
+		} else if (!rc_updated && !_armed && _rc_scan_locked && (hrt_elapsed_time(&_input_rc.timestamp_last_signal) > 1_s)) {
+			// retry the lost protocol (eg after a receiver brownout) for a full scan interval before moving on
 			_rc_scan_locked = false;
+			_rc_scan_begin = cycle_timestamp;
 		}
 
 		if (!rc_scan_locked && _rc_scan_locked) {
@@ -984,6 +950,9 @@ This module does the RC input parsing and auto-selecting the method. Supported m
 - ST24
 - TBS Crossfire (CRSF)
 
+Protocols using the same serial port settings (DSM, SUMD and ST24, as well as CRSF and GHST)
+are scanned in parallel, the driver locks onto the first one with a valid stream.
+
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("rc_input", "driver");
@@ -112,8 +112,46 @@ private:
 		"GHST"
 	};
 
+	static constexpr int RC_SCAN_GROUP_SIZE = 3;
+
+	/**
+	 * Protocols sharing one serial port configuration. While scanning they parse the
+	 * received data in parallel, ordered so that protocols with a checksum lock first.
+	 * The port is configured for the first protocol.
+	 */
+	struct RcScanGroup {
+		RC_SCAN protocols[RC_SCAN_GROUP_SIZE];
+	};
+
+	static constexpr RcScanGroup RC_SCAN_GROUPS[] {
+		{{RC_SCAN_SBUS}},
+		{{RC_SCAN_ST24, RC_SCAN_SUMD, RC_SCAN_DSM}},
+#ifdef HRT_PPM_CHANNEL
+		{{RC_SCAN_PPM}}, // the PPM input pin can be shared with the RC UART
+#endif // HRT_PPM_CHANNEL
+		{{RC_SCAN_CRSF, RC_SCAN_GHST}},
+	};
+
+	static constexpr int RC_SCAN_GROUP_COUNT = sizeof(RC_SCAN_GROUPS) / sizeof(RC_SCAN_GROUPS[0]);
+
 	void Run() override;
 
+	/** @return index of the scan group containing the protocol */
+	static int rc_scan_group(RC_SCAN protocol);
+
+	/** Configure the serial port (or PPM input) for a protocol and flush it */
+	void rc_scan_configure(RC_SCAN protocol);
+
+	/** Undo the protocol specific configuration before scanning the next group */
+	void rc_scan_release(RC_SCAN protocol);
+
+	/**
+	 * Parse the newly received data (or PPM input) as a protocol and fill _input_rc on a new frame.
+	 * @param valid set to true if the frame has valid channels
+	 * @return true if a new frame was decoded
+	 */
+	bool rc_parse(RC_SCAN protocol, hrt_abstime cycle_timestamp, int new_bytes, bool &valid);
+
 #if defined(SPEKTRUM_POWER)
 	bool bind_spektrum(int arg = DSMX8_BIND_PULSES) const;
 #endif // SPEKTRUM_POWER
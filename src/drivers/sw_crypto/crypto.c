@@ -46,6 +46,10 @@
 #include <lib/crypto/monocypher/src/optional/monocypher-ed25519.h>
 #include <tomcrypt.h>
 
+#if defined(CONFIG_DRIVERS_SW_CRYPTO_HW_AES)
+#include <px4_arch/crypto_accel.h>
+#endif
+
 extern void libtomcrypt_init(void);
 
 /* room for 16 keys */
@@ -86,6 +90,13 @@ typedef struct {
 	uint64_t ctr;
 } chacha20_context_t;
 
+#if defined(CONFIG_DRIVERS_SW_CRYPTO_HW_AES)
+typedef struct {
+	uint8_t nonce[CRYPTO_ACCEL_AES_NONCE_SIZE];
+	uint32_t ctr;
+} aes_ctr_context_t;
+#endif
+
 static inline void initialize_tomcrypt(void)
 {
 	if (!tomcrypt_initialized) {
@@ -153,6 +164,10 @@ void crypto_init()
 {
 	keystore_init();
 	clear_key_cache();
+
+#if defined(CONFIG_DRIVERS_SW_CRYPTO_HW_AES)
+	crypto_accel_init();
+#endif
 }
 
 void crypto_deinit()
@@ -191,6 +206,29 @@ crypto_session_handle_t crypto_open(px4_crypto_algorithm_t algorithm)
 		}
 		break;
 
+	case CRYPTO_AES: {
+			/* AES-CTR is only supported with the hardware engine */
+			void *context = NULL;
+#if defined(CONFIG_DRIVERS_SW_CRYPTO_HW_AES)
+			context = XMALLOC(sizeof(aes_ctr_context_t));
+
+			if (context) {
+				aes_ctr_context_t *aes_context = context;
+				px4_get_secure_random(aes_context->nonce, sizeof(aes_context->nonce));
+				aes_context->ctr = 0;
+			}
+
+#endif
+
+			if (!context) {
+				ret.handle = 0;
+				crypto_open_count--;
+			}
+
+			ret.context = context;
+		}
+		break;
+
 	default:
 		ret.context = NULL;
 	}
@@ -284,6 +322,23 @@ bool crypto_encrypt_data(crypto_session_handle_t handle,
 		}
 		break;
 
+#if defined(CONFIG_DRIVERS_SW_CRYPTO_HW_AES)
+
+	case CRYPTO_AES: {
+			size_t key_sz;
+			uint8_t *key = (uint8_t *)crypto_get_key_ptr(handle.keystore_handle, key_idx, &key_sz);
+			aes_ctr_context_t *context = handle.context;
+
+			if (key_sz == 32 && *cipher_size >= message_size &&
+			    crypto_accel_aes_ctr(key, key_sz, context->nonce, context->ctr, message, cipher, message_size) == 0) {
+				context->ctr += (message_size + CRYPTO_ACCEL_AES_BLOCK_SIZE - 1) / CRYPTO_ACCEL_AES_BLOCK_SIZE;
+				*cipher_size = message_size;
+				ret = true;
+			}
+		}
+		break;
+#endif
+
 	case CRYPTO_RSA_OAEP: {
 			rsa_key key;
 			size_t key_sz;
@@ -331,6 +386,7 @@ bool crypto_generate_key(crypto_session_handle_t handle,
 
 	switch (handle.algorithm) {
 	case CRYPTO_XCHACHA20:
+	case CRYPTO_AES:
 		if (key_cache[idx].key_size < 32) {
 			if (key_cache[idx].key_size > 0) {
 				SECMEM_FREE(key_cache[idx].key);
@@ -426,6 +482,20 @@ bool crypto_get_nonce(crypto_session_handle_t handle,
 		}
 		break;
 
+#if defined(CONFIG_DRIVERS_SW_CRYPTO_HW_AES)
+
+	case CRYPTO_AES: {
+			aes_ctr_context_t *context = handle.context;
+
+			if (nonce != NULL && context != NULL) {
+				memcpy(nonce, context->nonce, sizeof(context->nonce));
+			}
+
+			*nonce_len = sizeof(context->nonce);
+		}
+		break;
+#endif
+
 	default:
 		*nonce_len = 0;
 	}
@@ -442,6 +512,10 @@ size_t crypto_get_min_blocksize(crypto_session_handle_t handle, uint8_t key_idx)
 		ret = 64;
 		break;
 
+	case CRYPTO_AES:
+		ret = 16;
+		break;
+
 	default:
 		ret = 1;
 	}
@@ -40,6 +40,7 @@
 #include "esc.hpp"
 #include <systemlib/err.h>
 #include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
 
 #define MOTOR_BIT(x) (1<<(x))
 
@@ -51,6 +52,8 @@ UavcanEscController::UavcanEscController(uavcan::INode &node) :
 	_uavcan_sub_status(node)
 {
 	_uavcan_pub_raw_cmd.setPriority(uavcan::TransferPriority::NumericallyMin); // Highest priority
+
+	set_rate(DEFAULT_RATE_HZ);
 }
 
 int
@@ -64,7 +67,7 @@ UavcanEscController::init()
 		return res;
 	}
 
-	_esc_status_pub.advertise();
+	_esc_status.advertise();
 
 	return res;
 }
@@ -72,12 +75,15 @@ UavcanEscController::init()
 void
 UavcanEscController::update_outputs(bool stop_motors, uint16_t outputs[MAX_ACTUATORS], unsigned num_outputs)
 {
+	// ESC status received since the last output cycle
+	_esc_status.publish(hrt_absolute_time(), (1 << _rotor_count) - 1);
+
 	/*
 	 * Rate limiting - we don't want to congest the bus
 	 */
 	const auto timestamp = _node.getMonotonicTime();
 
-	if ((timestamp - _prev_cmd_pub).toUSec() < (1000000 / MAX_RATE_HZ)) {
+	if ((timestamp - _prev_cmd_pub).toUSec() < _cmd_interval_us) {
 		return;
 	}
 
@@ -121,22 +127,46 @@ UavcanEscController::update_outputs(bool stop_motors, uint16_t outputs[MAX_ACTUA
 	 * Publish the command message to the bus
 	 * Note that for a quadrotor it takes one CAN frame
 	 */
-	_uavcan_pub_raw_cmd.broadcast(msg);
+	if (_uavcan_pub_raw_cmd.broadcast(msg) < 0) {
+		_tx_failures++;
+
+	} else {
+		// 14 bit per setpoint, multi-frame transfers add a 2 byte CRC and carry 7 bytes per frame
+		const unsigned payload_bytes = (msg.cmd.size() * 14 + 7) / 8;
+		_tx_frames += (payload_bytes <= 7) ? 1 : (payload_bytes + 2 + 6) / 7;
+		_tx_transfers++;
+	}
+}
+
+void
+UavcanEscController::print_status() const
+{
+	printf("\tRawCommand: %u Hz, %" PRIu32 " transfers, %" PRIu32 " frames, %" PRIu32 " failed\n",
+	       rate_hz(), _tx_transfers, _tx_frames, _tx_failures);
 }
 
 void
 UavcanEscController::set_rotor_count(uint8_t count)
 {
 	_rotor_count = count;
+	_esc_status.setEscCount(count);
+}
+
+void
+UavcanEscController::set_rate(unsigned rate_hz)
+{
+	_cmd_interval_us = 1000000 / math::constrain(rate_hz, 1u, MAX_RATE_HZ);
+
+	// a command that could not be sent within one period is stale, drop it instead of delaying the next one
+	_uavcan_pub_raw_cmd.setTxTimeout(uavcan::MonotonicDuration::fromUSec(_cmd_interval_us));
 }
 
 void
 UavcanEscController::esc_status_sub_cb(const uavcan::ReceivedDataStructure<uavcan::equipment::esc::Status> &msg)
 {
 	if (msg.esc_index < esc_status_s::CONNECTED_ESC_MAX) {
-		auto &ref = _esc_status.esc[msg.esc_index];
+		auto &ref = _esc_status.esc(msg.esc_index);
 
-		ref.timestamp       = hrt_absolute_time();
 		ref.esc_address = msg.getSrcNodeID().get();
 		ref.esc_voltage     = msg.voltage;
 		ref.esc_current     = msg.current;
@@ -144,29 +174,7 @@ UavcanEscController::esc_status_sub_cb(const uavcan::ReceivedDataStructure<uavca
 		ref.esc_rpm         = msg.rpm;
 		ref.esc_errorcount  = msg.error_count;
 
-		_esc_status.esc_count = _rotor_count;
-		_esc_status.counter += 1;
-		_esc_status.esc_connectiontype = esc_status_s::ESC_CONNECTION_TYPE_CAN;
-		_esc_status.esc_online_flags = check_escs_status();
-		_esc_status.esc_armed_flags = (1 << _rotor_count) - 1;
-		_esc_status.timestamp = hrt_absolute_time();
-		_esc_status_pub.publish(_esc_status);
-	}
-}
-
-uint8_t
-UavcanEscController::check_escs_status()
-{
-	int esc_status_flags = 0;
-	const hrt_abstime now = hrt_absolute_time();
-
-	for (int index = 0; index < esc_status_s::CONNECTED_ESC_MAX; index++) {
-
-		if (_esc_status.esc[index].timestamp > 0 && now - _esc_status.esc[index].timestamp < 1200_ms) {
-			esc_status_flags |= (1 << index);
-		}
-
+		// published once per round of status messages from update_outputs()
+		_esc_status.updated(msg.esc_index, hrt_absolute_time());
 	}
-
-	return esc_status_flags;
 }
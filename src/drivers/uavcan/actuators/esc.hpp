@@ -52,13 +52,15 @@
 #include <uORB/topics/actuator_outputs.h>
 #include <uORB/topics/esc_status.h>
 #include <drivers/drv_hrt.h>
+#include <lib/mixer_module/esc_status_aggregator.hpp>
 #include <lib/mixer_module/mixer_module.hpp>
 
 class UavcanEscController
 {
 public:
 	static constexpr int MAX_ACTUATORS = esc_status_s::CONNECTED_ESC_MAX;
-	static constexpr unsigned MAX_RATE_HZ = 400;
+	static constexpr unsigned DEFAULT_RATE_HZ = 400;
+	static constexpr unsigned MAX_RATE_HZ = 1000;
 	static constexpr uint16_t DISARMED_OUTPUT_VALUE = UINT16_MAX;
 
 	static_assert(uavcan::equipment::esc::RawCommand::FieldTypes::cmd::MaxSize >= MAX_ACTUATORS, "Too many actuators");
@@ -76,9 +78,18 @@ public:
 	 */
 	void set_rotor_count(uint8_t count);
 
+	/**
+	 * Sets the maximum command rate, stale commands are dropped after one period
+	 */
+	void set_rate(unsigned rate_hz);
+
+	unsigned rate_hz() const { return 1000000 / _cmd_interval_us; }
+
 	static int max_output_value() { return uavcan::equipment::esc::RawCommand::FieldTypes::cmd::RawValueType::max(); }
 
-	esc_status_s &esc_status() { return _esc_status; }
+	EscStatusAggregator &esc_status() { return _esc_status; }
+
+	void print_status() const;
 
 private:
 	/**
@@ -86,20 +97,14 @@ private:
 	 */
 	void esc_status_sub_cb(const uavcan::ReceivedDataStructure<uavcan::equipment::esc::Status> &msg);
 
-	/**
-	 * Checks all the ESCs freshness based on timestamp, if an ESC exceeds the timeout then is flagged offline.
-	 */
-	uint8_t check_escs_status();
-
 	typedef uavcan::MethodBinder<UavcanEscController *,
 		void (UavcanEscController::*)(const uavcan::ReceivedDataStructure<uavcan::equipment::esc::Status>&)> StatusCbBinder;
 
 	typedef uavcan::MethodBinder<UavcanEscController *,
 		void (UavcanEscController::*)(const uavcan::TimerEvent &)> TimerCbBinder;
 
-	esc_status_s	_esc_status{};
-
-	uORB::PublicationMulti<esc_status_s> _esc_status_pub{ORB_ID(esc_status)};
+	// status messages of all ESCs merged and published from the output cycle, ESCs time out after 1.2 s
+	EscStatusAggregator _esc_status{esc_status_s::ESC_CONNECTION_TYPE_CAN, 1200_ms};
 
 	uint8_t		_rotor_count{0};
 
@@ -107,6 +112,7 @@ private:
 	 * libuavcan related things
 	 */
 	uavcan::MonotonicTime							_prev_cmd_pub;   ///< rate limiting
+	uint32_t								_cmd_interval_us{1000000 / DEFAULT_RATE_HZ};
 	uavcan::INode								&_node;
 	uavcan::Publisher<uavcan::equipment::esc::RawCommand>			_uavcan_pub_raw_cmd;
 	uavcan::Subscriber<uavcan::equipment::esc::Status, StatusCbBinder>	_uavcan_sub_status;
@@ -115,4 +121,11 @@ private:
 	 * ESC states
 	 */
 	uint8_t				_max_number_of_nonzero_outputs{0};
+
+	/*
+	 * TX accounting
+	 */
+	uint32_t			_tx_transfers{0};
+	uint32_t			_tx_frames{0};
+	uint32_t			_tx_failures{0};
 };
@@ -42,6 +42,7 @@ UavcanServoController::UavcanServoController(uavcan::INode &node) :
 	_uavcan_pub_array_cmd(node)
 {
 	_uavcan_pub_array_cmd.setPriority(UAVCAN_COMMAND_TRANSFER_PRIORITY);
+	_uavcan_pub_array_cmd.setTxTimeout(uavcan::MonotonicDuration::fromUSec(1000000 / MAX_RATE_HZ));
 }
 
 void
@@ -58,5 +59,20 @@ UavcanServoController::update_outputs(bool stop_motors, uint16_t outputs[MAX_ACT
 		msg.commands.push_back(cmd);
 	}
 
-	_uavcan_pub_array_cmd.broadcast(msg);
+	if (_uavcan_pub_array_cmd.broadcast(msg) < 0) {
+		_tx_failures++;
+
+	} else {
+		// 4 bytes per command, multi-frame transfers add a 2 byte CRC and carry 7 bytes per frame
+		const unsigned payload_bytes = msg.commands.size() * 4;
+		_tx_frames += (payload_bytes <= 7) ? 1 : (payload_bytes + 2 + 6) / 7;
+		_tx_transfers++;
+	}
+}
+
+void
+UavcanServoController::print_status() const
+{
+	printf("\tArrayCommand: %" PRIu32 " transfers, %" PRIu32 " frames, %" PRIu32 " failed\n",
+	       _tx_transfers, _tx_frames, _tx_failures);
 }
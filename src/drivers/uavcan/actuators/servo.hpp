@@ -54,7 +54,13 @@ public:
 
 	void update_outputs(bool stop_motors, uint16_t outputs[MAX_ACTUATORS], unsigned num_outputs);
 
+	void print_status() const;
+
 private:
 	uavcan::INode								&_node;
 	uavcan::Publisher<uavcan::equipment::actuator::ArrayCommand> _uavcan_pub_array_cmd;
+
+	uint32_t _tx_transfers{0};
+	uint32_t _tx_frames{0};
+	uint32_t _tx_failures{0};
 };
@@ -41,10 +41,109 @@
 #include <uavcan/uavcan.hpp>
 #include <uavcan/helpers/heap_based_pool_allocator.hpp>
 
+#if defined(CONFIG_UAVCAN_ALLOCATOR_O1HEAP)
+#include <lib/o1heap/o1heap.h>
+#include <parameters/param.h>
+#include <malloc.h>
+#endif
+
 // TODO: Entire UAVCAN application should be moved into a namespace later; this is the first step.
 namespace uavcan_node
 {
 
+#if defined(CONFIG_UAVCAN_ALLOCATOR_O1HEAP)
+
+/**
+ * libuavcan allocator backed by an o1heap arena, sized at startup by UAVCAN_HEAP_SIZE.
+ * Allocation and deallocation are constant time.
+ */
+class Allocator : public uavcan::IPoolAllocator
+{
+public:
+	static constexpr int32_t DefaultHeapSize = 32768;
+
+	Allocator()
+	{
+		int32_t heap_size = DefaultHeapSize;
+		param_get(param_find("UAVCAN_HEAP_SIZE"), &heap_size);
+
+		_arena = memalign(O1HEAP_ALIGNMENT, heap_size);
+
+		if (_arena != nullptr) {
+			_heap = o1heapInit(_arena, heap_size, &criticalSectionEnter, &criticalSectionLeave);
+		}
+
+		if (_heap == nullptr) {
+			PX4_ERR("o1heap init failed with size %" PRId32, heap_size);
+		}
+	}
+
+	~Allocator()
+	{
+		if (getNumAllocatedBlocks() > 0) {
+			PX4_ERR("UAVCAN LEAKS MEMORY: %u BLOCKS (%u BYTES) LOST",
+				getNumAllocatedBlocks(), getNumAllocatedBlocks() * uavcan::MemPoolBlockSize);
+		}
+
+		free(_arena);
+	}
+
+	void *allocate(std::size_t size) override
+	{
+		return (_heap != nullptr) ? o1heapAllocate(_heap, size) : nullptr;
+	}
+
+	void deallocate(const void *ptr) override
+	{
+		if (_heap != nullptr) {
+			o1heapFree(_heap, const_cast<void *>(ptr));
+		}
+	}
+
+	uavcan::uint16_t getBlockCapacity() const override
+	{
+		return (_heap != nullptr) ? o1heapGetDiagnostics(_heap).capacity / FragmentSize : 0;
+	}
+
+	uavcan::uint16_t getNumAllocatedBlocks() const
+	{
+		return (_heap != nullptr) ? o1heapGetDiagnostics(_heap).allocated / FragmentSize : 0;
+	}
+
+	// the arena is allocated once at startup
+	void shrink() {}
+
+	void printStatus() const
+	{
+		if (_heap == nullptr) {
+			printf("\tNot initialized\n");
+			return;
+		}
+
+		const O1HeapDiagnostics diag = o1heapGetDiagnostics(_heap);
+		printf("\tArena:     %zu bytes, %u blocks\n", diag.capacity, unsigned(diag.capacity / FragmentSize));
+		printf("\tAllocated: %u blocks, peak %u blocks\n",
+		       unsigned(diag.allocated / FragmentSize), unsigned(diag.peak_allocated / FragmentSize));
+		printf("\tOOM count: %" PRIu64 "\n", diag.oom_count);
+	}
+
+private:
+	static constexpr std::size_t pow2ceil(std::size_t x, std::size_t p = 1) { return (p >= x) ? p : pow2ceil(x, p * 2); }
+
+	// o1heap fragments are powers of two including the fragment header
+	static constexpr std::size_t FragmentSize = pow2ceil(uavcan::MemPoolBlockSize + O1HEAP_ALIGNMENT);
+
+	// o1heap never enters the critical section recursively
+	static ::irqstate_t &irqState() { static ::irqstate_t state; return state; }
+	static void criticalSectionEnter() { irqState() = ::enter_critical_section(); }
+	static void criticalSectionLeave() { ::leave_critical_section(irqState()); }
+
+	void *_arena{nullptr};
+	O1HeapInstance *_heap{nullptr};
+};
+
+#else
+
 struct AllocatorSynchronizer {
 	const ::irqstate_t state = ::enter_critical_section();
 	~AllocatorSynchronizer() { ::leave_critical_section(state); }
@@ -65,6 +164,15 @@ struct Allocator : public uavcan::HeapBasedPoolAllocator<uavcan::MemPoolBlockSiz
 				getNumAllocatedBlocks(), getNumAllocatedBlocks() * uavcan::MemPoolBlockSize);
 		}
 	}
+
+	void printStatus() const
+	{
+		printf("\tCapacity hard/soft: %" PRIu16 "/%" PRIu16 " blocks\n", getBlockCapacityHardLimit(), getBlockCapacity());
+		printf("\tReserved:  %" PRIu16 " blocks\n", getNumReservedBlocks());
+		printf("\tAllocated: %" PRIu16 " blocks\n", getNumAllocatedBlocks());
+	}
 };
 
+#endif // CONFIG_UAVCAN_ALLOCATOR_O1HEAP
+
 }
@@ -235,7 +235,10 @@ UavcanBatteryBridge::filterData(const uavcan::ReceivedDataStructure<uavcan::equi
 	_battery[instance]->setConnected(true);
 	_battery[instance]->updateVoltage(msg.voltage);
 	_battery[instance]->updateCurrent(msg.current);
-	_battery[instance]->updateBatteryStatus(hrt_absolute_time());
+
+	// packs report asynchronously, share the vehicle state polling between them
+	_battery_vehicle_state.update();
+	_battery[instance]->updateBatteryStatus(hrt_absolute_time(), _battery_vehicle_state);
 
 	/* Override data that is expected to arrive from UAVCAN msg*/
 	_battery_status[instance] = _battery[instance]->getBatteryStatus();
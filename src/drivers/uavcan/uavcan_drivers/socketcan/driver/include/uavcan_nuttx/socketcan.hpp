@@ -47,9 +47,23 @@
 namespace uavcan_socketcan
 {
 
+#if defined(SO_TIMESTAMPING)
+// software, deprecated and raw hardware timestamp
+typedef struct timespec RxTimestamp[3];
+#else
+typedef struct timeval RxTimestamp;
+#endif
+
 class CanIface : public uavcan::ICanIface
 	, uavcan::Noncopyable
 {
+	static constexpr unsigned RxBatchSize = 8;	///< frames drained from the socket per read
+
+	struct RxItem {
+		uavcan::CanFrame frame;
+		uavcan::MonotonicTime ts;
+	};
+
 	int               _fd{-1};
 	bool              _can_fd{false};
 
@@ -61,15 +75,29 @@ class CanIface : public uavcan::ICanIface
 	struct timeval     *_send_tv {};  /* TX deadline timestamp */
 	uint8_t            _send_control[sizeof(struct cmsghdr) + sizeof(struct timeval)] {};
 
-	//// Receive msg structure
-	struct iovec       _recv_iov {};
-	struct canfd_frame _recv_frame {};
-	struct msghdr      _recv_msg {};
-	struct cmsghdr     *_recv_cmsg {};
-	uint8_t            _recv_control[sizeof(struct cmsghdr) + sizeof(struct timeval)] {};
+	//// Receive msg structures, one per frame of a batch
+	struct iovec       _recv_iov[RxBatchSize] {};
+	struct canfd_frame _recv_frame[RxBatchSize] {};
+#if defined(MSG_WAITFORONE)
+	// recvmmsg() available, a batch is read with a single call
+	struct mmsghdr     _recv_msg[RxBatchSize] {};
+	struct msghdr &recvHeader(unsigned index) { return _recv_msg[index].msg_hdr; }
+#else
+	struct msghdr      _recv_msg[RxBatchSize] {};
+	struct msghdr &recvHeader(unsigned index) { return _recv_msg[index]; }
+#endif
+	uint8_t            _recv_control[RxBatchSize][CMSG_SPACE(sizeof(RxTimestamp))] {};
+
+	//// Frames read from the socket but not yet passed to libuavcan
+	RxItem             _rx_items[RxBatchSize] {};
+	unsigned           _rx_count{0};
+	unsigned           _rx_pos{0};
 
 	SystemClock clock;
 
+	int readBatch();
+	bool parseFrame(unsigned index, RxItem &item);
+
 public:
 	uavcan::uint32_t socketInit(uint32_t index);
 
@@ -90,6 +118,9 @@ public:
 	uavcan::uint16_t getNumFilters() const override;
 
 	int getFD();
+
+	/// Frames already read from the socket are pending, poll() will not report them
+	bool hasPendingRx() const { return _rx_pos < _rx_count; }
 };
 
 /**
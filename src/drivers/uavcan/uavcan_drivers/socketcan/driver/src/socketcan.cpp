@@ -46,6 +46,7 @@
 
 #include <net/if.h>
 #include <sys/ioctl.h>
+#include <errno.h>
 #include <string.h>
 
 #include <nuttx/can.h>
@@ -102,11 +103,25 @@ uavcan::uint32_t CanIface::socketInit(uint32_t index)
 	const int on = 1;
 	/* RX Timestamping */
 
+#if defined(SO_TIMESTAMPING)
+	/* Prefer the controller timestamp, the software timestamp is the fallback */
+	const int timestamping = SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE |
+				 SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+
+	if (setsockopt(_fd, SOL_SOCKET, SO_TIMESTAMPING, &timestamping, sizeof(timestamping)) < 0) {
+		PX4_ERR("SO_TIMESTAMPING is disabled");
+		return -1;
+	}
+
+#else
+
 	if (setsockopt(_fd, SOL_SOCKET, SO_TIMESTAMP, &on, sizeof(on)) < 0) {
 		PX4_ERR("SO_TIMESTAMP is disabled");
 		return -1;
 	}
 
+#endif
+
 	/* NuttX Feature: Enable TX deadline when sending CAN frames
 	 * When a deadline occurs the driver will remove the CAN frame
 	 */
@@ -151,23 +166,21 @@ uavcan::uint32_t CanIface::socketInit(uint32_t index)
 	_send_cmsg->cmsg_len = sizeof(struct timeval);
 	_send_tv = (struct timeval *)CMSG_DATA(_send_cmsg);
 
-	// Setup RX msg
-	_recv_iov.iov_base = &_recv_frame;
+	// Setup RX msgs
+	for (unsigned i = 0; i < RxBatchSize; i++) {
+		_recv_iov[i].iov_base = &_recv_frame[i];
 
-	if (can_fd) {
-		_recv_iov.iov_len = sizeof(struct canfd_frame);
+		if (can_fd) {
+			_recv_iov[i].iov_len = sizeof(struct canfd_frame);
 
-	} else {
-		_recv_iov.iov_len = sizeof(struct can_frame);
-	}
-
-	memset(_recv_control, 0x00, sizeof(_recv_control));
+		} else {
+			_recv_iov[i].iov_len = sizeof(struct can_frame);
+		}
 
-	_recv_msg.msg_iov = &_recv_iov;
-	_recv_msg.msg_iovlen = 1;
-	_recv_msg.msg_control = &_recv_control;
-	_recv_msg.msg_controllen = sizeof(_recv_control);
-	_recv_cmsg = CMSG_FIRSTHDR(&_recv_msg);
+		struct msghdr &msg = recvHeader(i);
+		msg.msg_iov = &_recv_iov[i];
+		msg.msg_iovlen = 1;
+	}
 
 	return 0;
 }
@@ -204,48 +217,119 @@ uavcan::int16_t CanIface::send(const uavcan::CanFrame &frame, uavcan::MonotonicT
 	}
 }
 
-uavcan::int16_t CanIface::receive(uavcan::CanFrame &out_frame, uavcan::MonotonicTime &out_ts_monotonic,
-				  uavcan::UtcTime &out_ts_utc, uavcan::CanIOFlags &out_flags)
+int CanIface::readBatch()
 {
-	int32_t result = recvmsg(_fd, &_recv_msg, MSG_DONTWAIT);
+	// the control buffers are updated by every read
+	for (unsigned i = 0; i < RxBatchSize; i++) {
+		struct msghdr &msg = recvHeader(i);
+		msg.msg_control = _recv_control[i];
+		msg.msg_controllen = sizeof(_recv_control[i]);
+	}
+
+#if defined(MSG_WAITFORONE)
+	return recvmmsg(_fd, _recv_msg, RxBatchSize, MSG_DONTWAIT, nullptr);
+#else
+	int count = 0;
+
+	while (count < (int)RxBatchSize) {
+		const int result = recvmsg(_fd, &_recv_msg[count], MSG_DONTWAIT);
+
+		if (result < 0) {
+			return (count > 0) ? count : result;
+		}
 
-	if (result < 0) {
-		return result;
+		count++;
 	}
 
+	return count;
+#endif
+}
+
+bool CanIface::parseFrame(unsigned index, RxItem &item)
+{
 	/* Copy SocketCAN frame to CanardFrame */
 
 	if (_can_fd) {
-		struct canfd_frame *recv_frame = (struct canfd_frame *)&_recv_frame;
-		out_frame.id = recv_frame->can_id;
+		struct canfd_frame *recv_frame = &_recv_frame[index];
+		item.frame.id = recv_frame->can_id;
 
 		if (recv_frame->len > CANFD_MAX_DLEN) {
-			return -EFAULT;
+			return false;
 		}
 
-		out_frame.dlc = recv_frame->len;
-		memcpy(out_frame.data, &recv_frame->data, recv_frame->len);
+		item.frame.dlc = recv_frame->len;
+		memcpy(item.frame.data, &recv_frame->data, recv_frame->len);
 
 	} else {
-		struct can_frame *recv_frame = (struct can_frame *)&_recv_frame;
-		out_frame.id = recv_frame->can_id;
+		struct can_frame *recv_frame = (struct can_frame *)&_recv_frame[index];
+		item.frame.id = recv_frame->can_id;
 
 		if (recv_frame->can_dlc > CAN_MAX_DLEN) {
-			return -EFAULT;
+			return false;
+		}
+
+		item.frame.dlc = recv_frame->can_dlc;
+		memcpy(item.frame.data, &recv_frame->data, recv_frame->can_dlc);
+	}
+
+	/* Read the RX timestamp */
+	item.ts = uavcan::MonotonicTime();
+
+	struct msghdr &msg = recvHeader(index);
+
+	for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+#if defined(SO_TIMESTAMPING)
+
+		if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPING) {
+			const struct timespec *ts = (const struct timespec *)CMSG_DATA(cmsg);
+			const struct timespec &rx = (ts[2].tv_sec != 0 || ts[2].tv_nsec != 0) ? ts[2] : ts[0];
+			item.ts = uavcan::MonotonicTime::fromUSec(rx.tv_sec * 1000000ULL + rx.tv_nsec / 1000);
+		}
+
+#else
+
+		if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_TIMESTAMP) {
+			const struct timeval *tv = (const struct timeval *)CMSG_DATA(cmsg);
+			item.ts = uavcan::MonotonicTime::fromUSec(tv->tv_sec * 1000000ULL + tv->tv_usec);
 		}
 
-		out_frame.dlc = recv_frame->can_dlc;
-		memcpy(out_frame.data, &recv_frame->data, recv_frame->can_dlc);
+#endif
 	}
 
-	/* Read SO_TIMESTAMP value */
+	return true;
+}
+
+uavcan::int16_t CanIface::receive(uavcan::CanFrame &out_frame, uavcan::MonotonicTime &out_ts_monotonic,
+				  uavcan::UtcTime &out_ts_utc, uavcan::CanIOFlags &out_flags)
+{
+	if (!hasPendingRx()) {
+		// drain the socket, later calls are served without a syscall
+		const int result = readBatch();
 
-	if (_recv_cmsg->cmsg_level == SOL_SOCKET && _recv_cmsg->cmsg_type == SO_TIMESTAMP) {
-		struct timeval *tv = (struct timeval *)CMSG_DATA(_recv_cmsg);
-		out_ts_monotonic = uavcan::MonotonicTime::fromUSec(tv->tv_sec * 1000000ULL + tv->tv_usec);
+		if (result < 0) {
+			return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : result;
+		}
+
+		_rx_count = 0;
+		_rx_pos = 0;
+
+		for (int i = 0; i < result; i++) {
+			if (parseFrame(i, _rx_items[_rx_count])) {
+				_rx_count++;
+			}
+		}
+
+		if (_rx_count == 0) {
+			return (result > 0) ? -EFAULT : 0;
+		}
 	}
 
-	return result;
+	const RxItem &item = _rx_items[_rx_pos++];
+	out_frame = item.frame;
+	out_ts_monotonic = item.ts.isZero() ? clock.getMonotonic() : item.ts;
+	out_flags = 0;
+
+	return 1;
 }
 
 
@@ -318,6 +402,14 @@ uavcan::int16_t CanDriver::select(uavcan::CanSelectMasks &inout_masks,
 	inout_masks.read = 0;
 	inout_masks.write = 0;
 
+	// frames of an earlier batch are still buffered, return them without blocking
+	for (int i = 0; i < UAVCAN_SOCKETCAN_NUM_IFACES; i++) {
+		if (if_[i].hasPendingRx()) {
+			inout_masks.read |= 1U << i;
+			timeout_usec = 0;
+		}
+	}
+
 	if (poll(pfds, UAVCAN_SOCKETCAN_NUM_IFACES, timeout_usec / 1000) > 0) {
 		for (int i = 0; i < UAVCAN_SOCKETCAN_NUM_IFACES; i++) {
 			if (pfds[i].revents & POLLIN) {
@@ -58,6 +58,7 @@
 #include <uORB/topics/esc_status.h>
 
 #include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
 
 #include "uavcan_module.hpp"
 #include "uavcan_main.hpp"
@@ -116,7 +117,11 @@ UavcanNode::UavcanNode(uavcan::ICanDriver &can_driver, uavcan::ISystemClock &sys
 	}
 
 #if defined(CONFIG_UAVCAN_OUTPUTS_CONTROLLER)
-	_mixing_interface_esc.mixingOutput().setMaxTopicUpdateRate(1000000 / UavcanEscController::MAX_RATE_HZ);
+	int32_t esc_rate = UavcanEscController::DEFAULT_RATE_HZ;
+	(void)param_get(param_find("UAVCAN_ESC_RATE"), &esc_rate);
+	_esc_controller.set_rate(esc_rate > 0 ? esc_rate : UavcanEscController::DEFAULT_RATE_HZ);
+
+	_mixing_interface_esc.mixingOutput().setMaxTopicUpdateRate(1000000 / _esc_controller.rate_hz());
 	_mixing_interface_servo.mixingOutput().setMaxTopicUpdateRate(1000000 / UavcanServoController::MAX_RATE_HZ);
 #endif
 }
@@ -690,6 +695,10 @@ UavcanNode::Run()
 		 */
 		const int can_init_res = can->init(bitrate);
 
+		if (bitrate > 0) {
+			_bitrate = bitrate;
+		}
+
 		if (can_init_res < 0) {
 			PX4_ERR("CAN driver init failed %i", can_init_res);
 		}
@@ -748,10 +757,11 @@ UavcanNode::Run()
 	constexpr hrt_abstime status_pub_interval = 100_ms;
 
 	if (hrt_absolute_time() - _last_can_status_pub >= status_pub_interval) {
+		const float status_dt = (hrt_absolute_time() - _last_can_status_pub) * 1e-6f;
 		_last_can_status_pub = hrt_absolute_time();
 
 		for (int i = 0; i < _node.getDispatcher().getCanIOManager().getCanDriver().getNumIfaces(); i++) {
-			if (i > UAVCAN_NUM_IFACES) {
+			if (i >= UAVCAN_NUM_IFACES) {
 				break;
 			}
 
@@ -762,11 +772,19 @@ UavcanNode::Run()
 			}
 
 			auto iface_perf_cnt = _node.getDispatcher().getCanIOManager().getIfacePerfCounters(i);
+
+			// bus load estimated from the frame rate, assuming full extended frames with bit stuffing
+			const uint64_t frames = iface_perf_cnt.frames_tx + iface_perf_cnt.frames_rx;
+			const float frames_per_second = (frames - _bus_load_frames[i]) / status_dt;
+			_bus_load[i] = math::min(frames_per_second * bitPerFrame / _bitrate, 1.f);
+			_bus_load_frames[i] = frames;
+
 			can_interface_status_s status{
 				.timestamp = hrt_absolute_time(),
 				.io_errors = iface_perf_cnt.errors,
 				.frames_tx = iface_perf_cnt.frames_tx,
 				.frames_rx = iface_perf_cnt.frames_rx,
+				.bus_load = _bus_load[i],
 				.interface = static_cast<uint8_t>(i),
 			};
 
@@ -1033,7 +1051,7 @@ void UavcanMixingInterfaceESC::mixerChanged()
 		rotor_count += _mixing_output.isFunctionSet(i);
 
 		if (i < esc_status_s::CONNECTED_ESC_MAX) {
-			_esc_controller.esc_status().esc[i].actuator_function = (uint8_t)_mixing_output.outputFunction(i);
+			_esc_controller.esc_status().esc(i).actuator_function = (uint8_t)_mixing_output.outputFunction(i);
 		}
 	}
 
@@ -1063,10 +1081,7 @@ UavcanNode::print_info()
 
 	// Memory status
 	printf("Pool allocator status:\n");
-	printf("\tCapacity hard/soft: %" PRIu16 "/%" PRIu16 " blocks\n",
-	       _pool_allocator.getBlockCapacityHardLimit(), _pool_allocator.getBlockCapacity());
-	printf("\tReserved:  %" PRIu16 " blocks\n", _pool_allocator.getNumReservedBlocks());
-	printf("\tAllocated: %" PRIu16 " blocks\n", _pool_allocator.getNumAllocatedBlocks());
+	_pool_allocator.printStatus();
 
 	printf("\n");
 
@@ -1092,6 +1107,10 @@ UavcanNode::print_info()
 			printf("\tIO errors: %" PRIu64 "\n", iface_perf_cnt.errors);
 			printf("\tRX frames: %" PRIu64 "\n", iface_perf_cnt.frames_rx);
 			printf("\tTX frames: %" PRIu64 "\n", iface_perf_cnt.frames_tx);
+
+			if (i < UAVCAN_NUM_IFACES) {
+				printf("\tBus load:  %.1f %%\n", (double)(_bus_load[i] * 100.f));
+			}
 		}
 	}
 
@@ -1100,9 +1119,11 @@ UavcanNode::print_info()
 #if defined(CONFIG_UAVCAN_OUTPUTS_CONTROLLER)
 	printf("ESC outputs:\n");
 	_mixing_interface_esc.mixingOutput().printStatus();
+	_esc_controller.print_status();
 
 	printf("Servo outputs:\n");
 	_mixing_interface_servo.mixingOutput().printStatus();
+	_servo_controller.print_status();
 #endif
 
 	printf("\n");
@@ -315,6 +315,10 @@ private:
 	hrt_abstime _last_can_status_pub{0};
 	orb_advert_t _can_status_pub_handles[UAVCAN_NUM_IFACES] = {nullptr};
 
+	uint32_t _bitrate{MaxBitRatePerSec};
+	uint64_t _bus_load_frames[UAVCAN_NUM_IFACES] {};	///< TX + RX frames at the last status publication
+	float _bus_load[UAVCAN_NUM_IFACES] {};
+
 	/*
 	 * The MAVLink parameter bridge needs to know the maximum parameter index
 	 * of each node so that clients can determine when parameter listings have
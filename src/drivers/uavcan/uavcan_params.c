@@ -185,6 +185,36 @@ PARAM_DEFINE_INT32(UAVCAN_LGT_NAV, 3);
  */
 PARAM_DEFINE_INT32(UAVCAN_LGT_LAND, 0);
 
+/**
+ * UAVCAN memory arena size
+ *
+ * Size of the o1heap arena used for libuavcan memory blocks.
+ * Only used if the driver is built with CONFIG_UAVCAN_ALLOCATOR_O1HEAP.
+ * Each block uses 64 bytes of the arena, check the peak usage in 'uavcan status'.
+ *
+ * @unit B
+ * @min 4096
+ * @max 262144
+ * @reboot_required true
+ * @group UAVCAN
+ */
+PARAM_DEFINE_INT32(UAVCAN_HEAP_SIZE, 32768);
+
+/**
+ * UAVCAN ESC command rate
+ *
+ * Maximum rate at which uavcan::equipment::esc::RawCommand is broadcast.
+ * Each RawCommand of more than 4 ESCs is a multi-frame transfer (3 frames for 8 ESCs),
+ * check the bus load in 'uavcan status' when increasing it.
+ *
+ * @unit Hz
+ * @min 50
+ * @max 1000
+ * @reboot_required true
+ * @group UAVCAN
+ */
+PARAM_DEFINE_INT32(UAVCAN_ESC_RATE, 400);
+
 /**
  * publish Arming Status stream
  *
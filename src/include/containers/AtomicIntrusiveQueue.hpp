@@ -0,0 +1,241 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file AtomicIntrusiveQueue.hpp
+ *
+ * Intrusive multi-producer single-consumer FIFO.
+ *
+ * Producers push lock-free (safe from any thread or ISR) onto an atomic LIFO,
+ * the consumer moves the pushed nodes into its private FIFO in push order.
+ * All consumer side methods (pop, remove, clear, empty) must be serialized
+ * by the caller.
+ */
+
+#pragma once
+
+#include <px4_platform_common/atomic.h>
+
+template<class T>
+class AtomicIntrusiveQueue
+{
+public:
+
+	/**
+	 * Push a node, can be called concurrently from multiple producers.
+	 * @param retries incremented for every failed attempt due to contention
+	 * @return false if the node is already queued
+	 */
+	bool push(T newNode, unsigned &retries)
+	{
+		bool queued = false;
+
+		if (!newNode->_atomic_intrusive_queue_queued.compare_exchange(&queued, true)) {
+			// node already queued
+			return false;
+		}
+
+		T head = _pushed.load();
+
+		do {
+			newNode->_next_atomic_intrusive_queue_node = head;
+
+			if (_pushed.compare_exchange(&head, newNode)) {
+				break;
+			}
+
+			retries++;
+
+		} while (true);
+
+		return true;
+	}
+
+	bool push(T newNode)
+	{
+		unsigned retries = 0;
+		return push(newNode, retries);
+	}
+
+	/**
+	 * Consumer only: check if there are nodes queued.
+	 */
+	bool empty() const { return (_head == nullptr) && (_pushed.load() == nullptr); }
+
+	/**
+	 * Consumer only: take the oldest node.
+	 * The node can be pushed again after it was popped.
+	 */
+	T pop()
+	{
+		if (_head == nullptr) {
+			collect();
+		}
+
+		T ret = _head;
+
+		if (ret != nullptr) {
+			_head = ret->_next_atomic_intrusive_queue_node;
+
+			if (_head == nullptr) {
+				_tail = nullptr;
+			}
+
+			ret->_next_atomic_intrusive_queue_node = nullptr;
+			ret->_atomic_intrusive_queue_queued.store(false);
+		}
+
+		return ret;
+	}
+
+	/**
+	 * Consumer only: take the first node for which no other node compares less
+	 * (stable, FIFO among equal nodes).
+	 * @param less strict weak ordering, eg an earlier deadline
+	 */
+	template<typename Less>
+	T pop_min(Less less)
+	{
+		collect();
+
+		T min = _head;
+
+		for (T node = _head; node != nullptr; node = node->_next_atomic_intrusive_queue_node) {
+			if (less(node, min)) {
+				min = node;
+			}
+		}
+
+		if (min == _head) {
+			return pop();
+		}
+
+		remove(min);
+		return min;
+	}
+
+	/**
+	 * Consumer only: remove a node.
+	 * A node that is concurrently being pushed might not be found yet.
+	 * @return true if the node was removed
+	 */
+	bool remove(T removeNode)
+	{
+		collect();
+
+		T prev = nullptr;
+
+		for (T node = _head; node != nullptr; node = node->_next_atomic_intrusive_queue_node) {
+			if (node == removeNode) {
+				if (prev == nullptr) {
+					_head = node->_next_atomic_intrusive_queue_node;
+
+				} else {
+					prev->_next_atomic_intrusive_queue_node = node->_next_atomic_intrusive_queue_node;
+				}
+
+				if (node == _tail) {
+					_tail = prev;
+				}
+
+				node->_next_atomic_intrusive_queue_node = nullptr;
+				node->_atomic_intrusive_queue_queued.store(false);
+				return true;
+			}
+
+			prev = node;
+		}
+
+		return false;
+	}
+
+	/**
+	 * Consumer only: remove all nodes.
+	 */
+	void clear()
+	{
+		while (pop() != nullptr) {}
+	}
+
+private:
+
+	/**
+	 * Move all pushed nodes to the end of the consumer FIFO, restoring the push order.
+	 */
+	void collect()
+	{
+		T pushed = _pushed.load();
+
+		while (pushed != nullptr && !_pushed.compare_exchange(&pushed, nullptr)) {}
+
+		if (pushed == nullptr) {
+			return;
+		}
+
+		// reverse LIFO order
+		T first = nullptr;
+		T const last = pushed;
+
+		while (pushed != nullptr) {
+			T next = pushed->_next_atomic_intrusive_queue_node;
+			pushed->_next_atomic_intrusive_queue_node = first;
+			first = pushed;
+			pushed = next;
+		}
+
+		if (_tail == nullptr) {
+			_head = first;
+
+		} else {
+			_tail->_next_atomic_intrusive_queue_node = first;
+		}
+
+		_tail = last;
+	}
+
+	px4::atomic<T> _pushed{nullptr};
+
+	T _head{nullptr};
+	T _tail{nullptr};
+};
+
+template<class T>
+class AtomicIntrusiveQueueNode
+{
+private:
+	friend AtomicIntrusiveQueue<T>;
+
+	T _next_atomic_intrusive_queue_node{nullptr};
+	px4::atomic_bool _atomic_intrusive_queue_queued{false};
+};
@@ -95,6 +95,29 @@ public:
 		return ret;
 	}
 
+	/**
+	 * Take the first node for which no other node compares less (stable, FIFO among equal nodes).
+	 * @param less strict weak ordering, eg an earlier deadline
+	 */
+	template<typename Less>
+	T pop_min(Less less)
+	{
+		T min = _head;
+
+		for (T node = _head; node != nullptr; node = node->next_intrusive_queue_node()) {
+			if (less(node, min)) {
+				min = node;
+			}
+		}
+
+		if (min == _head) {
+			return pop();
+		}
+
+		remove(min);
+		return min;
+	}
+
 	bool remove(T removeNode)
 	{
 		// base case
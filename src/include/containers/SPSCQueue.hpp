@@ -0,0 +1,96 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file SPSCQueue.hpp
+ *
+ * Lock-free single-producer single-consumer bounded FIFO.
+ *
+ * Items are copied into a fixed ring, the producer only writes the head index and the
+ * consumer only writes the tail index, so neither side ever waits on the other. Pushing
+ * to a full queue fails and leaves the queue unchanged.
+ */
+
+#pragma once
+
+#include <px4_platform_common/atomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+template<class T, size_t N>
+class SPSCQueue
+{
+	static_assert((N > 0) && ((N & (N - 1)) == 0), "N must be a power of 2");
+
+public:
+	SPSCQueue() = default;
+	~SPSCQueue() = default;
+
+	// producer: @return false if the queue is full
+	bool push(const T &item)
+	{
+		const uint32_t head = _head.load();
+
+		if (head - _tail.load() >= N) {
+			return false;
+		}
+
+		_items[head & (N - 1)] = item;
+		_head.store(head + 1);
+		return true;
+	}
+
+	// consumer: @return false if the queue is empty
+	bool pop(T &item)
+	{
+		const uint32_t tail = _tail.load();
+
+		if (tail == _head.load()) {
+			return false;
+		}
+
+		item = _items[tail & (N - 1)];
+		_tail.store(tail + 1);
+		return true;
+	}
+
+	size_t size() const { return _head.load() - _tail.load(); }
+	bool empty() const { return size() == 0; }
+
+private:
+	T _items[N] {};
+
+	px4::atomic<uint32_t> _head{0}; ///< written by the producer only
+	px4::atomic<uint32_t> _tail{0}; ///< written by the consumer only
+};
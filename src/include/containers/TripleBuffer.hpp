@@ -0,0 +1,100 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file TripleBuffer.hpp
+ *
+ * Lock-free single-producer single-consumer triple buffer.
+ *
+ * The producer writes into its private back buffer and publishes it, the consumer
+ * takes the latest published buffer as its private front buffer. Neither side ever
+ * waits or copies under a lock, the buffers are exchanged with a single atomic
+ * operation. Intermediate publications that the consumer did not take are dropped.
+ */
+
+#pragma once
+
+#include <px4_platform_common/atomic.h>
+#include <stdint.h>
+
+template<class T>
+class TripleBuffer
+{
+public:
+	TripleBuffer() = default;
+	~TripleBuffer() = default;
+
+	// producer: buffer to write the next publication to
+	T &back() { return _buffers[_back]; }
+
+	// producer: publish the back buffer, the previous middle buffer becomes the new back buffer
+	void publish()
+	{
+		_back = exchange(_back | NEW_DATA) & INDEX_MASK;
+	}
+
+	// consumer: take the latest publication if there is a new one
+	// @return true if front() changed
+	bool update()
+	{
+		if ((_middle.load() & NEW_DATA) == 0) {
+			return false;
+		}
+
+		_front = exchange(_front) & INDEX_MASK;
+		return true;
+	}
+
+	// consumer: latest publication taken with update()
+	const T &front() const { return _buffers[_front]; }
+
+private:
+	static constexpr uint8_t INDEX_MASK = 0x3;
+	static constexpr uint8_t NEW_DATA = 0x4;
+
+	uint8_t exchange(uint8_t desired)
+	{
+		uint8_t expected = _middle.load();
+
+		while (!_middle.compare_exchange(&expected, desired)) {}
+
+		return expected;
+	}
+
+	T _buffers[3] {};
+
+	uint8_t _back{0};  ///< producer only
+	uint8_t _front{1}; ///< consumer only
+	px4::atomic<uint8_t> _middle{2}; ///< shared, index and new data flag
+};
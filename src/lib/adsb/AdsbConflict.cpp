@@ -170,6 +170,182 @@ void AdsbConflict::remove_expired_conflicts()
 	}
 }
 
+bool AdsbConflict::add_traffic(const transponder_report_s &transponder_report)
+{
+	int traffic_slot = find_traffic(transponder_report.icao_address);
+
+	if (traffic_slot < 0) {
+		if (_traffic_table.size >= NAVIGATOR_MAX_TRAFFIC_TABLE) {
+			return false;
+		}
+
+		traffic_slot = traffic_hash(transponder_report.icao_address);
+
+		while (_traffic_table.occupied[traffic_slot]) {
+			traffic_slot = (traffic_slot + 1) & (NAVIGATOR_MAX_TRAFFIC_TABLE - 1);
+		}
+
+		_traffic_table.occupied[traffic_slot] = true;
+		_traffic_table.icao_address[traffic_slot] = transponder_report.icao_address;
+		_traffic_table.size++;
+	}
+
+	_traffic_table.timestamp[traffic_slot] = hrt_absolute_time();
+	_traffic_table.lat[traffic_slot] = transponder_report.lat;
+	_traffic_table.lon[traffic_slot] = transponder_report.lon;
+	_traffic_table.altitude[traffic_slot] = transponder_report.altitude;
+	_traffic_table.heading[traffic_slot] = transponder_report.heading;
+	_traffic_table.hor_velocity[traffic_slot] = transponder_report.hor_velocity;
+	_traffic_table.ver_velocity[traffic_slot] = transponder_report.ver_velocity;
+	_traffic_table.flags[traffic_slot] = transponder_report.flags;
+	memcpy(_traffic_table.callsign[traffic_slot], transponder_report.callsign, UTM_CALLSIGN_LENGTH);
+	_traffic_table.pending[traffic_slot] = true;
+
+	return true;
+}
+
+int AdsbConflict::find_traffic(uint32_t icao_address) const
+{
+	uint16_t traffic_slot = traffic_hash(icao_address);
+
+	for (uint16_t probe = 0; probe < NAVIGATOR_MAX_TRAFFIC_TABLE; probe++) {
+		if (!_traffic_table.occupied[traffic_slot]) {
+			return -1;
+		}
+
+		if (_traffic_table.icao_address[traffic_slot] == icao_address) {
+			return traffic_slot;
+		}
+
+		traffic_slot = (traffic_slot + 1) & (NAVIGATOR_MAX_TRAFFIC_TABLE - 1);
+	}
+
+	return -1;
+}
+
+void AdsbConflict::remove_traffic(int traffic_slot)
+{
+	// backward shift deletion: move following entries of the probe sequence into the hole so that lookups
+	// never stop early at an empty slot, without needing tombstones
+	uint16_t hole = traffic_slot;
+	uint16_t next = (hole + 1) & (NAVIGATOR_MAX_TRAFFIC_TABLE - 1);
+
+	_traffic_table.occupied[hole] = false;
+	_traffic_table.pending[hole] = false;
+
+	while (_traffic_table.occupied[next]) {
+		const uint16_t home = traffic_hash(_traffic_table.icao_address[next]);
+
+		// the entry can only move back if the hole lies between its home slot and its current slot
+		if (((next - home) & (NAVIGATOR_MAX_TRAFFIC_TABLE - 1)) >= ((next - hole) & (NAVIGATOR_MAX_TRAFFIC_TABLE - 1))) {
+			_traffic_table.icao_address[hole] = _traffic_table.icao_address[next];
+			_traffic_table.timestamp[hole] = _traffic_table.timestamp[next];
+			_traffic_table.lat[hole] = _traffic_table.lat[next];
+			_traffic_table.lon[hole] = _traffic_table.lon[next];
+			_traffic_table.altitude[hole] = _traffic_table.altitude[next];
+			_traffic_table.heading[hole] = _traffic_table.heading[next];
+			_traffic_table.hor_velocity[hole] = _traffic_table.hor_velocity[next];
+			_traffic_table.ver_velocity[hole] = _traffic_table.ver_velocity[next];
+			_traffic_table.flags[hole] = _traffic_table.flags[next];
+			memcpy(_traffic_table.callsign[hole], _traffic_table.callsign[next], UTM_CALLSIGN_LENGTH);
+			_traffic_table.pending[hole] = _traffic_table.pending[next];
+			_traffic_table.occupied[hole] = true;
+
+			_traffic_table.occupied[next] = false;
+			_traffic_table.pending[next] = false;
+			hole = next;
+		}
+
+		next = (next + 1) & (NAVIGATOR_MAX_TRAFFIC_TABLE - 1);
+	}
+
+	_traffic_table.size--;
+}
+
+bool AdsbConflict::handle_traffic_conflicts(double lat_now, double lon_now, float alt_now, float vx_now,
+		float vy_now, float vz_now)
+{
+	const hrt_abstime now = hrt_absolute_time();
+
+	const float xyz_uav_speed = sqrtf(vx_now * vx_now + vy_now * vy_now + vz_now * vz_now);
+
+	const float north_per_deg = static_cast<float>(CONSTANTS_RADIUS_OF_EARTH) * math::radians(1.f);
+	const float east_per_deg = north_per_deg * cosf(math::radians(static_cast<float>(lat_now)));
+
+	bool take_action = false;
+
+	for (int traffic_slot = 0; traffic_slot < NAVIGATOR_MAX_TRAFFIC_TABLE;) {
+		if (!_traffic_table.occupied[traffic_slot]) {
+			traffic_slot++;
+			continue;
+		}
+
+		if (now > _traffic_table.timestamp[traffic_slot] + TRAFFIC_TABLE_TIMEOUT) {
+			// a following entry may have been shifted into this slot, check it again
+			remove_traffic(traffic_slot);
+			continue;
+		}
+
+		if (!_traffic_table.pending[traffic_slot]) {
+			traffic_slot++;
+			continue;
+		}
+
+		_traffic_table.pending[traffic_slot] = false;
+
+		// Pre-filter: a target can only be in conflict if it is within the vertical separation and can close the
+		// horizontal distance within the collision time threshold, see detect_traffic_conflict()
+		double delta_lon = _traffic_table.lon[traffic_slot] - lon_now;
+
+		if (delta_lon > 180.0) {
+			delta_lon -= 360.0;
+
+		} else if (delta_lon < -180.0) {
+			delta_lon += 360.0;
+		}
+
+		const float delta_north = static_cast<float>(_traffic_table.lat[traffic_slot] - lat_now) * north_per_deg;
+		const float delta_east = static_cast<float>(delta_lon) * east_per_deg;
+
+		const float xyz_traffic_speed = sqrtf(_traffic_table.hor_velocity[traffic_slot] *
+						      _traffic_table.hor_velocity[traffic_slot]
+						      + _traffic_table.ver_velocity[traffic_slot] * _traffic_table.ver_velocity[traffic_slot]);
+
+		const float reach = TRAFFIC_PREFILTER_MARGIN * (xyz_traffic_speed + xyz_uav_speed)
+				    * _conflict_detection_params.collision_time_threshold;
+
+		const bool may_conflict = (fabsf(alt_now - _traffic_table.altitude[traffic_slot]) <
+					   _conflict_detection_params.crosstrack_separation)
+					  && (delta_north * delta_north + delta_east * delta_east < reach * reach);
+
+		_transponder_report.icao_address = _traffic_table.icao_address[traffic_slot];
+		_transponder_report.lat = _traffic_table.lat[traffic_slot];
+		_transponder_report.lon = _traffic_table.lon[traffic_slot];
+		_transponder_report.altitude = _traffic_table.altitude[traffic_slot];
+		_transponder_report.heading = _traffic_table.heading[traffic_slot];
+		_transponder_report.hor_velocity = _traffic_table.hor_velocity[traffic_slot];
+		_transponder_report.ver_velocity = _traffic_table.ver_velocity[traffic_slot];
+		_transponder_report.flags = _traffic_table.flags[traffic_slot];
+		memcpy(_transponder_report.callsign, _traffic_table.callsign[traffic_slot], UTM_CALLSIGN_LENGTH);
+
+		if (may_conflict) {
+			detect_traffic_conflict(lat_now, lon_now, alt_now, vx_now, vy_now, vz_now);
+
+		} else {
+			_conflict_detected = false;
+		}
+
+		// handled for every target so that resolved conflicts are removed from the conflict buffer
+		if (handle_traffic_conflict()) {
+			take_action = true;
+		}
+
+		traffic_slot++;
+	}
+
+	return take_action;
+}
+
 bool AdsbConflict::handle_traffic_conflict()
 {
 
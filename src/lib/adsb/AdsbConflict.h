@@ -66,6 +66,12 @@ static constexpr uint64_t TRAFFIC_WARNING_TIMESTEP{60_s}; //limits the max warni
 
 static constexpr uint64_t TRAFFIC_CONFLICT_LIFETIME{120_s}; //limits the time a conflict can be in the buffer without being seen (as a conflict)
 
+static constexpr uint16_t NAVIGATOR_MAX_TRAFFIC_TABLE{128}; //number of tracked targets, must be a power of two
+
+static constexpr uint64_t TRAFFIC_TABLE_TIMEOUT{10_s}; //targets not heard from for this long are dropped from the traffic table
+
+static constexpr float TRAFFIC_PREFILTER_MARGIN{1.1f}; //covers the flat earth approximation of the conflict pre-filter
+
 struct traffic_data_s {
 	double lat_traffic;
 	double lon_traffic;
@@ -81,6 +87,24 @@ struct traffic_buffer_s {
 	px4::Array<hrt_abstime, NAVIGATOR_MAX_TRAFFIC> timestamp {};
 };
 
+// Latest state of every tracked target, stored as arrays so the conflict pre-filter runs over contiguous data.
+// Slots are found by hashing the ICAO address with linear probing.
+struct traffic_table_s {
+	uint32_t icao_address[NAVIGATOR_MAX_TRAFFIC_TABLE];
+	hrt_abstime timestamp[NAVIGATOR_MAX_TRAFFIC_TABLE];
+	double lat[NAVIGATOR_MAX_TRAFFIC_TABLE];
+	double lon[NAVIGATOR_MAX_TRAFFIC_TABLE];
+	float altitude[NAVIGATOR_MAX_TRAFFIC_TABLE];
+	float heading[NAVIGATOR_MAX_TRAFFIC_TABLE];
+	float hor_velocity[NAVIGATOR_MAX_TRAFFIC_TABLE];
+	float ver_velocity[NAVIGATOR_MAX_TRAFFIC_TABLE];
+	uint16_t flags[NAVIGATOR_MAX_TRAFFIC_TABLE];
+	char callsign[NAVIGATOR_MAX_TRAFFIC_TABLE][UTM_CALLSIGN_LENGTH];
+	bool occupied[NAVIGATOR_MAX_TRAFFIC_TABLE];
+	bool pending[NAVIGATOR_MAX_TRAFFIC_TABLE]; // updated since the last conflict evaluation
+	uint16_t size;
+};
+
 struct conflict_detection_params_s {
 	float crosstrack_separation;
 	float vertical_separation;
@@ -113,6 +137,26 @@ public:
 
 	void get_traffic_state();
 
+	/**
+	 * Store the latest report of a target in the traffic table, to be evaluated by the next handle_traffic_conflicts().
+	 * @return false if the target is new and the table is full
+	 */
+	bool add_traffic(const transponder_report_s &transponder_report);
+
+	int find_traffic(uint32_t icao_address) const;
+
+	void remove_traffic(int traffic_slot);
+
+	int traffic_table_size() const { return _traffic_table.size; }
+
+	/**
+	 * Run conflict detection and handling for all targets updated since the last call. Targets that cannot reach the
+	 * vehicle within the collision time threshold are rejected by a flat earth pre-filter before the geodesic checks.
+	 * Targets that timed out are removed from the table.
+	 * @return true if any of the targets requires an avoidance action
+	 */
+	bool handle_traffic_conflicts(double lat_now, double lon_now, float alt_now, float vx_now, float vy_now, float vz_now);
+
 	void set_conflict_detection_params(float crosstrack_separation, float vertical_separation,
 					   int collision_time_threshold, uint8_t traffic_avoidance_mode);
 
@@ -146,6 +190,17 @@ protected:
 
 private:
 
+	static uint16_t traffic_hash(uint32_t icao_address)
+	{
+		// Fibonacci hashing, ICAO addresses are often assigned in contiguous blocks
+		return (uint16_t)((icao_address * 2654435761u) >> 16) & (NAVIGATOR_MAX_TRAFFIC_TABLE - 1);
+	}
+
+	static_assert((NAVIGATOR_MAX_TRAFFIC_TABLE & (NAVIGATOR_MAX_TRAFFIC_TABLE - 1)) == 0,
+		      "NAVIGATOR_MAX_TRAFFIC_TABLE must be a power of two");
+
+	traffic_table_s _traffic_table{};
+
 	crosstrack_error_s _crosstrack_error{};
 
 	transponder_report_s tr{};
@@ -285,3 +285,88 @@ TEST_F(AdsbConflictTest, trafficReminder)
 	EXPECT_TRUE(adsb_conflict._traffic_state == TRAFFIC_STATE::ADD_CONFLICT);
 
 }
+
+TEST_F(AdsbConflictTest, trafficTable)
+{
+	TestAdsbConflict 	adsb_conflict;
+
+	transponder_report_s transponder_report{};
+
+	const uint32_t traffic_count = 120;
+
+	for (uint32_t i = 0; i < traffic_count; i++) {
+		transponder_report.icao_address = 0x400000 + i;
+		EXPECT_TRUE(adsb_conflict.add_traffic(transponder_report));
+	}
+
+	// updating known targets does not use new slots
+	transponder_report.icao_address = 0x400000;
+	EXPECT_TRUE(adsb_conflict.add_traffic(transponder_report));
+	EXPECT_EQ(adsb_conflict.traffic_table_size(), (int)traffic_count);
+
+	for (uint32_t i = 0; i < traffic_count; i += 3) {
+		adsb_conflict.remove_traffic(adsb_conflict.find_traffic(0x400000 + i));
+	}
+
+	for (uint32_t i = 0; i < traffic_count; i++) {
+		if (i % 3 == 0) {
+			EXPECT_EQ(adsb_conflict.find_traffic(0x400000 + i), -1);
+
+		} else {
+			EXPECT_GE(adsb_conflict.find_traffic(0x400000 + i), 0);
+		}
+	}
+
+	EXPECT_EQ(adsb_conflict.traffic_table_size(), (int)(traffic_count - traffic_count / 3));
+
+	for (uint32_t i = 0; adsb_conflict.traffic_table_size() < NAVIGATOR_MAX_TRAFFIC_TABLE; i++) {
+		transponder_report.icao_address = 0x500000 + i;
+		EXPECT_TRUE(adsb_conflict.add_traffic(transponder_report));
+	}
+
+	transponder_report.icao_address = 0x600000;
+	EXPECT_FALSE(adsb_conflict.add_traffic(transponder_report));
+}
+
+TEST_F(AdsbConflictTest, handleTrafficConflicts)
+{
+	double lat_now = 32.617013;
+	double lon_now = -96.490564;
+	float alt_now = 1000.0f;
+
+	TestAdsbConflict 	adsb_conflict;
+
+	adsb_conflict.set_conflict_detection_params(500.0f, 500.0f, 60, 0);
+
+	const uint32_t traffic_dataset_size = sizeof(traffic_dataset) / sizeof(traffic_dataset[0]);
+
+	transponder_report_s transponder_report{};
+	uint32_t conflicts = 0;
+	uint32_t i = 0;
+
+	// a batch of targets with no more conflicts than the conflict buffer holds
+	for (; (i < traffic_dataset_size) && (adsb_conflict.traffic_table_size() < NAVIGATOR_MAX_TRAFFIC_TABLE); i++) {
+		const traffic_data_s &traffic = traffic_dataset[i];
+
+		if (traffic.in_conflict && (conflicts == NAVIGATOR_MAX_TRAFFIC)) {
+			break;
+		}
+
+		conflicts += traffic.in_conflict ? 1 : 0;
+
+		transponder_report.icao_address = i;
+		transponder_report.lat = traffic.lat_traffic;
+		transponder_report.lon = traffic.lon_traffic;
+		transponder_report.altitude = traffic.alt_traffic;
+		transponder_report.heading = traffic.heading_traffic;
+		transponder_report.hor_velocity = traffic.vxy_traffic;
+		transponder_report.ver_velocity = traffic.vz_traffic;
+		EXPECT_TRUE(adsb_conflict.add_traffic(transponder_report));
+	}
+
+	adsb_conflict.handle_traffic_conflicts(lat_now, lon_now, alt_now, 0.f, 0.f, 0.f);
+
+	for (uint32_t j = 0; j < i; j++) {
+		EXPECT_EQ(adsb_conflict.find_icao_address_in_conflict_list(j) >= 0, traffic_dataset[j].in_conflict);
+	}
+}
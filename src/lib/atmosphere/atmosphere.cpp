@@ -38,9 +38,49 @@
 
 #include <geo/geo.h>
 #include "atmosphere.h"
+#include "pressure_ratio_table.hpp"
+
 namespace atmosphere
 {
 
+static inline float getAltitudeFromPressureRatio(float pressure_ratio)
+{
+	static constexpr float kExponent = -(kTempGradient * kAirGasConstant) / CONSTANTS_ONE_G;
+
+	// cubic Hermite interpolation of pressure_ratio^kExponent - 1 between the table samples
+	const float index = (pressure_ratio - kPressureRatioMin) * kPressureRatioStepsPerUnit;
+	float power_minus_one;
+
+	if ((index >= 0.f) && (index < kPressureRatioCount - 1)) {
+		const int i = static_cast<int>(index);
+		const float t = index - i;
+		const float t2 = t * t;
+		const float t3 = t2 * t;
+
+		const float h = 1.f / kPressureRatioStepsPerUnit;
+
+		power_minus_one = (2.f * t3 - 3.f * t2 + 1.f) * kPressureRatioPower[i][0]
+			+ (t3 - 2.f * t2 + t) * h * kPressureRatioPower[i][1]
+			+ (-2.f * t3 + 3.f * t2) * kPressureRatioPower[i + 1][0]
+			+ (t3 - t2) * h * kPressureRatioPower[i + 1][1];
+
+	} else {
+		// outside of the table (above ~12 km or below ~-1.4 km)
+		power_minus_one = powf(pressure_ratio, kExponent) - 1.f;
+	}
+
+	/*
+	 * Solve:
+	 *
+	 *     /        -(aR / g)     \
+	 *    | (p / p1)          . T1 | - T1
+	 *     \                      /
+	 * h = -------------------------------  + h1
+	 *                   a
+	 */
+	return power_minus_one * (kTempRefKelvin / kTempGradient);
+}
+
 
 float getDensityFromPressureAndTemp(const float pressure_pa, const float temperature_celsius)
 {
@@ -55,21 +95,15 @@ float getPressureFromAltitude(const float altitude_m)
 float getAltitudeFromPressure(float pressure_pa, float pressure_sealevel_pa)
 {
 	// calculate altitude using the hypsometric equation
+	return getAltitudeFromPressureRatio(pressure_pa / pressure_sealevel_pa);
+}
+void getAltitudeFromPressure(const float pressure_pa[], float altitude_m[], int count, float pressure_sealevel_pa)
+{
+	const float pressure_sealevel_inv = 1.f / pressure_sealevel_pa;
 
-	const float pressure_ratio = pressure_pa / pressure_sealevel_pa;
-
-	/*
-	 * Solve:
-	 *
-	 *     /        -(aR / g)     \
-	 *    | (p / p1)          . T1 | - T1
-	 *     \                      /
-	 * h = -------------------------------  + h1
-	 *                   a
-	 */
-	return (((powf(pressure_ratio, (-(kTempGradient * kAirGasConstant) / CONSTANTS_ONE_G))) * kTempRefKelvin) -
-		kTempRefKelvin) / kTempGradient;
-
+	for (int i = 0; i < count; i++) {
+		altitude_m[i] = getAltitudeFromPressureRatio(pressure_pa[i] * pressure_sealevel_inv);
+	}
 }
 float getStandardTemperatureAtAltitude(float altitude_m)
 {
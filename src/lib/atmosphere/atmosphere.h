@@ -73,12 +73,24 @@ float getPressureFromAltitude(const float altitude_m);
 
 /**
 * Calculate altitude from air pressure and temperature.
+* Interpolates a table of the standard atmosphere instead of powf, the error is below 1 cm
+* up to 12 km.
 *
 * @param pressure_pa ambient pressure in Pa
 * @param pressure_sealevel_pa sea level pressure in Pa
 */
 float getAltitudeFromPressure(float pressure_pa, float pressure_sealevel_pa);
 
+/**
+* Calculate the altitudes of several air pressures at once.
+*
+* @param pressure_pa ambient pressures in Pa
+* @param altitude_m resulting altitudes in m
+* @param count number of pressures
+* @param pressure_sealevel_pa sea level pressure in Pa
+*/
+void getAltitudeFromPressure(const float pressure_pa[], float altitude_m[], int count, float pressure_sealevel_pa);
+
 /**
 * Get standard temperature at altitude.
 *
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+############################################################################
+#
+#   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+# 3. Neither the name PX4 nor the names of its contributors may be
+#    used to endorse or promote products derived from this software
+#    without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+# OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+# AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+############################################################################
+
+"""
+Generate pressure_ratio_table.hpp: (p / p_sealevel)^(-aR/g) - 1 of the standard atmosphere
+(minus 1 to keep the precision of float near sea level) and its derivative, sampled for cubic Hermite interpolation in getAltitudeFromPressure().
+The constants must match atmosphere.h and CONSTANTS_ONE_G.
+"""
+
+AIR_GAS_CONSTANT = 287.1 # J/(kg * K)
+TEMP_GRADIENT = -6.5 / 1000. # K/m
+ONE_G = 9.80665 # m/s^2
+
+# 1.0 is a sample point, so sea level pressure gives exactly 0 m
+RATIO_MIN = 12. / 64.
+RATIO_STEPS_PER_UNIT = 64
+RATIO_COUNT = 64 + 1 # [0.1875, 1.1875]
+
+exponent = -(TEMP_GRADIENT * AIR_GAS_CONSTANT) / ONE_G
+
+print('// generated by generate_pressure_table.py, do not edit')
+print('')
+print('#pragma once')
+print('')
+print('static constexpr float kPressureRatioMin = {:.6f}f;'.format(RATIO_MIN))
+print('static constexpr float kPressureRatioStepsPerUnit = {:d}.f;'.format(RATIO_STEPS_PER_UNIT))
+print('static constexpr int kPressureRatioCount = {:d};'.format(RATIO_COUNT))
+print('')
+print('// (p / p_sealevel)^{:.8f} - 1 and its derivative'.format(exponent))
+print('static constexpr float kPressureRatioPower[kPressureRatioCount][2] {')
+
+for i in range(RATIO_COUNT):
+    ratio = RATIO_MIN + i / RATIO_STEPS_PER_UNIT
+    value = ratio ** exponent - 1.
+    derivative = exponent * ratio ** (exponent - 1.)
+    print('\t{{{:.9f}f, {:.9f}f}}, // {:.6f}'.format(value, derivative, ratio))
+
+print('};')
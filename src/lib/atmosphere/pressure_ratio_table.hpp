@@ -0,0 +1,76 @@
+// generated by generate_pressure_table.py, do not edit
+
+#pragma once
+
+static constexpr float kPressureRatioMin = 0.187500f;
+static constexpr float kPressureRatioStepsPerUnit = 64.f;
+static constexpr int kPressureRatioCount = 65;
+
+// (p / p_sealevel)^0.19029434 - 1 and its derivative
+static constexpr float kPressureRatioPower[kPressureRatioCount][2] {
+	{-0.272796005f, 0.738041627f}, // 0.187500
+	{-0.261634684f, 0.691725496f}, // 0.203125
+	{-0.251148246f, 0.651438862f}, // 0.218750
+	{-0.241251784f, 0.616044765f}, // 0.234375
+	{-0.231875901f, 0.584678677f}, // 0.250000
+	{-0.222963108f, 0.556670959f}, // 0.265625
+	{-0.214465206f, 0.531494493f}, // 0.281250
+	{-0.206341365f, 0.508728411f}, // 0.296875
+	{-0.198556672f, 0.488032416f}, // 0.312500
+	{-0.191081028f, 0.469128237f}, // 0.328125
+	{-0.183888286f, 0.451786010f}, // 0.343750
+	{-0.176955583f, 0.435814108f}, // 0.359375
+	{-0.170262801f, 0.421051449f}, // 0.375000
+	{-0.163792141f, 0.407361596f}, // 0.390625
+	{-0.157527773f, 0.394628178f}, // 0.406250
+	{-0.151455552f, 0.382751305f}, // 0.421875
+	{-0.145562785f, 0.371644724f}, // 0.437500
+	{-0.139838034f, 0.361233555f}, // 0.453125
+	{-0.134270956f, 0.351452454f}, // 0.468750
+	{-0.128852163f, 0.342244137f}, // 0.484375
+	{-0.123573107f, 0.333558156f}, // 0.500000
+	{-0.118425983f, 0.325349909f}, // 0.515625
+	{-0.113403641f, 0.317579802f}, // 0.531250
+	{-0.108499516f, 0.310212566f}, // 0.546875
+	{-0.103707565f, 0.303216673f}, // 0.562500
+	{-0.099022209f, 0.296563849f}, // 0.578125
+	{-0.094438291f, 0.290228663f}, // 0.593750
+	{-0.089951029f, 0.284188175f}, // 0.609375
+	{-0.085555984f, 0.278421634f}, // 0.625000
+	{-0.081249024f, 0.272910223f}, // 0.640625
+	{-0.077026300f, 0.267636834f}, // 0.656250
+	{-0.072884215f, 0.262585879f}, // 0.671875
+	{-0.068819407f, 0.257743123f}, // 0.687500
+	{-0.064828726f, 0.253095540f}, // 0.703125
+	{-0.060909217f, 0.248631182f}, // 0.718750
+	{-0.057058105f, 0.244339073f}, // 0.734375
+	{-0.053272777f, 0.240209111f}, // 0.750000
+	{-0.049550774f, 0.236231979f}, // 0.765625
+	{-0.045889776f, 0.232399074f}, // 0.781250
+	{-0.042287593f, 0.228702433f}, // 0.796875
+	{-0.038742154f, 0.225134681f}, // 0.812500
+	{-0.035251499f, 0.221688972f}, // 0.828125
+	{-0.031813771f, 0.218358946f}, // 0.843750
+	{-0.028427210f, 0.215138681f}, // 0.859375
+	{-0.025090145f, 0.212022661f}, // 0.875000
+	{-0.021800986f, 0.209005740f}, // 0.890625
+	{-0.018558224f, 0.206083107f}, // 0.906250
+	{-0.015360421f, 0.203250267f}, // 0.921875
+	{-0.012206208f, 0.200503007f}, // 0.937500
+	{-0.009094277f, 0.197837379f}, // 0.953125
+	{-0.006023384f, 0.195249678f}, // 0.968750
+	{-0.002992337f, 0.192736423f}, // 0.984375
+	{0.000000000f, 0.190294341f}, // 1.000000
+	{0.002954716f, 0.187920351f}, // 1.015625
+	{0.005872850f, 0.185611550f}, // 1.031250
+	{0.008755402f, 0.183365201f}, // 1.046875
+	{0.011603325f, 0.181178718f}, // 1.062500
+	{0.014417536f, 0.179049662f}, // 1.078125
+	{0.017198914f, 0.176975723f}, // 1.093750
+	{0.019948303f, 0.174954718f}, // 1.109375
+	{0.022666514f, 0.172984578f}, // 1.125000
+	{0.025354326f, 0.171063343f}, // 1.140625
+	{0.028012488f, 0.169189154f}, // 1.156250
+	{0.030641722f, 0.167360245f}, // 1.171875
+	{0.033242723f, 0.165574942f}, // 1.187500
+};
@@ -36,7 +36,9 @@
  */
 
 #include <gtest/gtest.h>
+#include <math.h>
 #include <lib/atmosphere/atmosphere.h>
+#include <lib/geo/geo.h>
 using namespace atmosphere;
 
 TEST(TestAtmosphere, pressureFromAltitude)
@@ -81,6 +83,40 @@ TEST(TestAtmosphere, altitudeFromPressure)
 	EXPECT_NEAR(altitude, 3000.0f, 0.5f);
 }
 
+TEST(TestAtmosphere, altitudeFromPressureTable)
+{
+	// GIVEN the hypsometric equation evaluated with powf in double precision
+	const float pressure_sealevel = 102000.f;
+	const double exponent = -((double)kTempGradient * (double)kAirGasConstant) / (double)CONSTANTS_ONE_G;
+
+	for (float pressure = 15000.f; pressure < 125000.f; pressure += 7.3f) {
+		const double expected = (pow((double)pressure / (double)pressure_sealevel, exponent) - 1.0)
+					* (double)kTempRefKelvin / (double)kTempGradient;
+
+		// WHEN we calculate the altitude from the table (or powf outside of it)
+		const float altitude = getAltitudeFromPressure(pressure, pressure_sealevel);
+
+		// THEN expect an error below 1 cm
+		EXPECT_NEAR(altitude, expected, 0.01) << pressure;
+	}
+}
+
+TEST(TestAtmosphere, altitudeFromPressureBatch)
+{
+	// GIVEN several baro pressures
+	const float pressure_sealevel = 99500.f;
+	const float pressures[4] {101000.f, 95000.f, 70109.f, 20000.f};
+	float altitudes[4] {};
+
+	// WHEN we calculate the altitudes at once
+	getAltitudeFromPressure(pressures, altitudes, 4, pressure_sealevel);
+
+	// THEN expect the same altitudes as from the single conversion
+	for (int i = 0; i < 4; i++) {
+		EXPECT_NEAR(altitudes[i], getAltitudeFromPressure(pressures[i], pressure_sealevel), 0.001f);
+	}
+}
+
 TEST(TestAtmosphere, DensityFromPressure)
 {
 // GIVEN standard atmosphere at sea level
@@ -95,14 +95,37 @@ Battery::Battery(int index, ModuleParams *parent, const int sample_interval_us,
 	_param_handles.emergen_thr = param_find("BAT_EMERGEN_THR");
 
 	_param_handles.bat_avrg_current = param_find("BAT_AVRG_CURRENT");
+	_param_handles.r_est = param_find("BAT_R_EST");
 
 	updateParams();
 }
 
+void BatteryVehicleState::update()
+{
+	vehicle_thrust_setpoint_s vehicle_thrust_setpoint;
+
+	if (_vehicle_thrust_setpoint_0_sub.update(&vehicle_thrust_setpoint)) {
+		_throttle = matrix::Vector3f(vehicle_thrust_setpoint.xyz).length();
+	}
+
+	vehicle_status_s vehicle_status;
+
+	if (_vehicle_status_sub.update(&vehicle_status)) {
+		_armed = (vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED);
+		_fixed_wing = (vehicle_status.vehicle_type == vehicle_status_s::VEHICLE_TYPE_FIXED_WING);
+	}
+
+	_flight_phase_estimation_sub.update();
+
+	_level_flight = ((hrt_absolute_time() - _flight_phase_estimation_sub.get().timestamp) < 2_s)
+			&& (_flight_phase_estimation_sub.get().flight_phase == flight_phase_estimation_s::FLIGHT_PHASE_LEVEL);
+}
+
 void Battery::updateVoltage(const float voltage_v)
 {
 	_voltage_v = voltage_v;
 	_voltage_filter_v.update(voltage_v);
+	_measurement_updated = true;
 }
 
 void Battery::updateCurrent(const float current_a)
@@ -113,6 +136,14 @@ void Battery::updateCurrent(const float current_a)
 
 void Battery::updateBatteryStatus(const hrt_abstime &timestamp)
 {
+	_vehicle_state.update();
+	updateBatteryStatus(timestamp, _vehicle_state);
+}
+
+void Battery::updateBatteryStatus(const hrt_abstime &timestamp, const BatteryVehicleState &vehicle_state)
+{
+	_measurement_updated = false;
+
 	if (!_battery_initialized) {
 		_voltage_filter_v.reset(_voltage_v);
 		_current_filter_a.reset(_current_a);
@@ -131,8 +162,17 @@ void Battery::updateBatteryStatus(const hrt_abstime &timestamp)
 	_battery_initialized = _connected && (timestamp > _last_unconnected_timestamp + 2_s);
 
 	sumDischarged(timestamp, _current_a);
+
+	if (_params.r_est && _battery_initialized) {
+		estimateInternalResistance(_voltage_v, _current_a);
+
+	} else {
+		_r_est_initialized = false;
+	}
+
 	_state_of_charge_volt_based =
-		calculateStateOfChargeVoltageBased(_voltage_filter_v.getState(), _current_filter_a.getState());
+		calculateStateOfChargeVoltageBased(_voltage_filter_v.getState(), _current_filter_a.getState(),
+						   vehicle_state.throttle());
 
 	if (!_external_state_of_charge) {
 		estimateStateOfCharge();
@@ -143,6 +183,8 @@ void Battery::updateBatteryStatus(const hrt_abstime &timestamp)
 	if (_connected && _battery_initialized) {
 		_warning = determineWarning(_state_of_charge);
 	}
+
+	_time_remaining_s = computeRemainingTime(_current_a, vehicle_state);
 }
 
 battery_status_s Battery::getBatteryStatus()
@@ -156,7 +198,7 @@ battery_status_s Battery::getBatteryStatus()
 	battery_status.discharged_mah = _discharged_mah;
 	battery_status.remaining = _state_of_charge;
 	battery_status.scale = _scale;
-	battery_status.time_remaining_s = computeRemainingTime(_current_a);
+	battery_status.time_remaining_s = _time_remaining_s;
 	battery_status.temperature = NAN;
 	battery_status.cell_count = _params.n_cells;
 	battery_status.connected = _connected;
@@ -167,6 +209,7 @@ battery_status_s Battery::getBatteryStatus()
 	battery_status.warning = _warning;
 	battery_status.timestamp = hrt_absolute_time();
 	battery_status.faults = determineFaults();
+	battery_status.internal_resistance_estimate = _r_est_initialized ? _internal_resistance_estimate : NAN;
 	return battery_status;
 }
 
@@ -204,7 +247,7 @@ void Battery::sumDischarged(const hrt_abstime &timestamp, float current_a)
 	_last_timestamp = timestamp;
 }
 
-float Battery::calculateStateOfChargeVoltageBased(const float voltage_v, const float current_a)
+float Battery::calculateStateOfChargeVoltageBased(const float voltage_v, const float current_a, const float throttle)
 {
 	if (_params.n_cells == 0) {
 		return -1.0f;
@@ -213,16 +256,13 @@ float Battery::calculateStateOfChargeVoltageBased(const float voltage_v, const f
 	// remaining battery capacity based on voltage
 	float cell_voltage = voltage_v / _params.n_cells;
 
+	const float r_internal = _r_est_initialized ? _internal_resistance_estimate : _params.r_internal;
+
 	// correct battery voltage locally for load drop to avoid estimation fluctuations
-	if (_params.r_internal >= 0.f && current_a > FLT_EPSILON) {
-		cell_voltage += _params.r_internal * current_a;
+	if (r_internal >= 0.f && current_a > FLT_EPSILON) {
+		cell_voltage += r_internal * current_a;
 
 	} else {
-		vehicle_thrust_setpoint_s vehicle_thrust_setpoint{};
-		_vehicle_thrust_setpoint_0_sub.copy(&vehicle_thrust_setpoint);
-		const matrix::Vector3f thrust_setpoint = matrix::Vector3f(vehicle_thrust_setpoint.xyz);
-		const float throttle = thrust_setpoint.length();
-
 		_throttle_filter.update(throttle);
 
 		if (!_battery_initialized) {
@@ -236,6 +276,48 @@ float Battery::calculateStateOfChargeVoltageBased(const float voltage_v, const f
 	return math::interpolate(cell_voltage, _params.v_empty, _params.v_charged, 0.f, 1.f);
 }
 
+void Battery::estimateInternalResistance(const float voltage_v, const float current_a)
+{
+	if ((_params.n_cells <= 0) || (current_a < 0.f)) {
+		return;
+	}
+
+	const float cell_voltage = voltage_v / _params.n_cells;
+
+	if (!_r_est_initialized) {
+		const float r_init = (_params.r_internal >= 0.f) ? _params.r_internal : R_EST_DEFAULT;
+		_r_est_state = matrix::Vector2f(cell_voltage + r_init * current_a, r_init);
+		_r_est_covariance.setZero();
+		_r_est_covariance(0, 0) = R_EST_OCV_VARIANCE_INIT;
+		_r_est_covariance(1, 1) = R_EST_R_VARIANCE_INIT;
+		_internal_resistance_estimate = r_init;
+		_r_est_initialized = true;
+		return;
+	}
+
+	// regressor of v = ocv - r * i, the 2x2 update has a fixed cost per sample
+	const matrix::Vector2f regressor(1.f, -current_a);
+	const matrix::Vector2f covariance_regressor = _r_est_covariance * regressor;
+	const float innovation_variance = R_EST_FORGETTING_FACTOR + regressor.dot(covariance_regressor);
+
+	if (innovation_variance < FLT_EPSILON) {
+		return;
+	}
+
+	const matrix::Matrix<float, 2, 1> gain = covariance_regressor / innovation_variance;
+	const float innovation = cell_voltage - regressor.dot(_r_est_state);
+
+	_r_est_state += gain * innovation;
+	_r_est_covariance -= gain * covariance_regressor.transpose();
+
+	// without current changes the covariance would grow unbounded through the forgetting
+	if (_r_est_covariance.trace() < R_EST_COVARIANCE_TRACE_MAX) {
+		_r_est_covariance /= R_EST_FORGETTING_FACTOR;
+	}
+
+	_internal_resistance_estimate = math::constrain(_r_est_state(1), 0.f, R_EST_MAX);
+}
+
 void Battery::estimateStateOfCharge()
 {
 	// choose which quantity we're using for final reporting
@@ -302,26 +384,12 @@ void Battery::computeScale()
 	}
 }
 
-float Battery::computeRemainingTime(float current_a)
+float Battery::computeRemainingTime(float current_a, const BatteryVehicleState &vehicle_state)
 {
 	float time_remaining_s = NAN;
-	bool reset_current_avg_filter = false;
-
-	if (_vehicle_status_sub.updated()) {
-		vehicle_status_s vehicle_status;
 
-		if (_vehicle_status_sub.copy(&vehicle_status)) {
-			_armed = (vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED);
-
-			if (vehicle_status.vehicle_type == vehicle_status_s::VEHICLE_TYPE_FIXED_WING && !_vehicle_status_is_fw) {
-				reset_current_avg_filter = true;
-			}
-
-			_vehicle_status_is_fw = (vehicle_status.vehicle_type == vehicle_status_s::VEHICLE_TYPE_FIXED_WING);
-		}
-	}
-
-	_flight_phase_estimation_sub.update();
+	const bool reset_current_avg_filter = vehicle_state.fixedWing() && !_vehicle_status_is_fw;
+	_vehicle_status_is_fw = vehicle_state.fixedWing();
 
 	// reset filter if not feasible, negative or we did a VTOL transition to FW mode
 	if (!PX4_ISFINITE(_current_average_filter_a.getState()) || _current_average_filter_a.getState() < FLT_EPSILON
@@ -329,10 +397,9 @@ float Battery::computeRemainingTime(float current_a)
 		_current_average_filter_a.reset(_params.bat_avrg_current);
 	}
 
-	if (_armed && PX4_ISFINITE(current_a)) {
+	if (vehicle_state.armed() && PX4_ISFINITE(current_a)) {
 		// For FW only update when we are in level flight
-		if (!_vehicle_status_is_fw || ((hrt_absolute_time() - _flight_phase_estimation_sub.get().timestamp) < 2_s
-					       && _flight_phase_estimation_sub.get().flight_phase == flight_phase_estimation_s::FLIGHT_PHASE_LEVEL)) {
+		if (!_vehicle_status_is_fw || vehicle_state.levelFlight()) {
 			// only update with positive numbers
 			_current_average_filter_a.update(fmaxf(current_a, 0.f));
 		}
@@ -361,6 +428,7 @@ void Battery::updateParams()
 	param_get(_param_handles.crit_thr, &_params.crit_thr);
 	param_get(_param_handles.emergen_thr, &_params.emergen_thr);
 	param_get(_param_handles.bat_avrg_current, &_params.bat_avrg_current);
+	param_get(_param_handles.r_est, &_params.r_est);
 
 	ModuleParams::updateParams();
 
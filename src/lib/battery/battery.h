@@ -60,6 +60,31 @@
 #include <uORB/topics/vehicle_status.h>
 #include <uORB/topics/vehicle_thrust_setpoint.h>
 
+/**
+ * Vehicle state the battery estimation depends on. It is polled once per update, a BatteryBank
+ * shares a single instance between all of its batteries.
+ */
+class BatteryVehicleState
+{
+public:
+	void update();
+
+	float throttle() const { return _throttle; }
+	bool armed() const { return _armed; }
+	bool fixedWing() const { return _fixed_wing; }
+	bool levelFlight() const { return _level_flight; }
+
+private:
+	uORB::Subscription _vehicle_thrust_setpoint_0_sub{ORB_ID(vehicle_thrust_setpoint)};
+	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
+	uORB::SubscriptionData<flight_phase_estimation_s> _flight_phase_estimation_sub{ORB_ID(flight_phase_estimation)};
+
+	float _throttle{0.f};
+	bool _armed{false};
+	bool _fixed_wing{false};
+	bool _level_flight{false};
+};
+
 /**
  * BatteryBase is a base class for any type of battery.
  *
@@ -93,6 +118,11 @@ public:
 	void updateVoltage(const float voltage_v);
 	void updateCurrent(const float current_a);
 
+	/**
+	 * Whether a voltage sample was set since the last updateBatteryStatus()
+	 */
+	bool measurementUpdated() const { return _measurement_updated; }
+
 	/**
 	 * Update state of charge calculations
 	 *
@@ -100,6 +130,12 @@ public:
 	 */
 	void updateBatteryStatus(const hrt_abstime &timestamp);
 
+	/**
+	 * Update state of charge calculations with a vehicle state shared between batteries
+	 * @see updateBatteryStatus()
+	 */
+	void updateBatteryStatus(const hrt_abstime &timestamp, const BatteryVehicleState &vehicle_state);
+
 	battery_status_s getBatteryStatus();
 	void publishBatteryStatus(const battery_status_s &battery_status);
 
@@ -113,6 +149,13 @@ public:
 protected:
 	static constexpr float LITHIUM_BATTERY_RECOGNITION_VOLTAGE = 2.1f;
 
+	static constexpr float R_EST_FORGETTING_FACTOR = 0.999f; ///< internal resistance RLS, ~10 s memory at 100 Hz
+	static constexpr float R_EST_DEFAULT = 0.005f; ///< [Ohm] initial cell internal resistance if not configured
+	static constexpr float R_EST_MAX = 0.2f; ///< [Ohm]
+	static constexpr float R_EST_OCV_VARIANCE_INIT = 0.01f; ///< [V^2]
+	static constexpr float R_EST_R_VARIANCE_INIT = 1e-4f; ///< [Ohm^2]
+	static constexpr float R_EST_COVARIANCE_TRACE_MAX = 1.f; ///< stops the forgetting without current excitation
+
 	struct {
 		param_t v_empty;
 		param_t v_charged;
@@ -125,6 +168,7 @@ protected:
 		param_t emergen_thr;
 		param_t source;
 		param_t bat_avrg_current;
+		param_t r_est;
 	} _param_handles{};
 
 	struct {
@@ -139,6 +183,7 @@ protected:
 		float emergen_thr;
 		int32_t source;
 		float bat_avrg_current;
+		int32_t r_est;
 	} _params{};
 
 	const int _index;
@@ -148,16 +193,15 @@ protected:
 
 private:
 	void sumDischarged(const hrt_abstime &timestamp, float current_a);
-	float calculateStateOfChargeVoltageBased(const float voltage_v, const float current_a);
+	float calculateStateOfChargeVoltageBased(const float voltage_v, const float current_a, const float throttle);
+	void estimateInternalResistance(const float voltage_v, const float current_a);
 	void estimateStateOfCharge();
 	uint8_t determineWarning(float state_of_charge);
 	uint16_t determineFaults();
 	void computeScale();
-	float computeRemainingTime(float current_a);
+	float computeRemainingTime(float current_a, const BatteryVehicleState &vehicle_state);
 
-	uORB::Subscription _vehicle_thrust_setpoint_0_sub{ORB_ID(vehicle_thrust_setpoint)};
-	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
-	uORB::SubscriptionData<flight_phase_estimation_s> _flight_phase_estimation_sub{ORB_ID(flight_phase_estimation)};
+	BatteryVehicleState _vehicle_state{}; ///< only used if the battery is not updated through a BatteryBank
 	uORB::PublicationMulti<battery_status_s> _battery_status_pub{ORB_ID(battery_status)};
 
 	bool _external_state_of_charge{false}; ///< inticates that the soc is injected and not updated by this library
@@ -169,6 +213,7 @@ private:
 	float _voltage_v{0.f};
 	AlphaFilter<float> _voltage_filter_v;
 	float _current_a{-1};
+	bool _measurement_updated{false};
 	AlphaFilter<float> _current_filter_a;
 	AlphaFilter<float>
 	_current_average_filter_a; ///< averaging filter for current. For FW, it is the current in level flight.
@@ -178,9 +223,15 @@ private:
 	float _state_of_charge_volt_based{-1.f}; // [0,1]
 	float _state_of_charge{-1.f}; // [0,1]
 	float _scale{1.f};
+	float _time_remaining_s{NAN};
 	uint8_t _warning{battery_status_s::BATTERY_WARNING_NONE};
 	hrt_abstime _last_timestamp{0};
-	bool _armed{false};
 	bool _vehicle_status_is_fw{false};
+
+	// recursive least squares fit of the cell model v = ocv - r * i
+	bool _r_est_initialized{false};
+	matrix::Vector2f _r_est_state{}; ///< open circuit voltage [V], internal resistance [Ohm]
+	matrix::SquareMatrix<float, 2> _r_est_covariance{};
+	float _internal_resistance_estimate{NAN}; ///< [Ohm] constrained estimate per cell
 	hrt_abstime _last_unconnected_timestamp{0};
 };
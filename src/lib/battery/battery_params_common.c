@@ -99,3 +99,15 @@ PARAM_DEFINE_FLOAT(BAT_EMERGEN_THR, 0.05f);
  * @increment 0.1
  */
 PARAM_DEFINE_FLOAT(BAT_AVRG_CURRENT, 15.0f);
+
+/**
+ * Online internal resistance estimation
+ *
+ * If enabled, the per cell internal resistance is estimated online from the
+ * measured voltage and current and used in place of BATx_R_INTERNAL, which
+ * then only initializes the estimate. Requires a current measurement.
+ *
+ * @group Battery Calibration
+ * @boolean
+ */
+PARAM_DEFINE_INT32(BAT_R_EST, 0);
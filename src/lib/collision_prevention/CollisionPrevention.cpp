@@ -87,6 +87,10 @@ CollisionPrevention::CollisionPrevention(ModuleParams *parent) :
 		_data_maxranges[i] = 0;
 		_data_fov[i] = 0;
 		_obstacle_map_body_frame.distances[i] = UINT16_MAX;
+
+		const float angle = math::radians((float)i * INTERNAL_MAP_INCREMENT_DEG + _obstacle_map_body_frame.angle_offset);
+		_bin_cos[i] = cosf(angle);
+		_bin_sin[i] = sinf(angle);
 	}
 }
 
@@ -419,6 +423,15 @@ CollisionPrevention::_calculateConstrainedSetpoint(Vector2f &setpoint, const Vec
 			// change setpoint direction slightly (max by _param_cp_guide_ang degrees) to help guide through narrow gaps
 			_adaptSetpointDirection(setpoint_dir, sp_index, vehicle_yaw_angle_rad);
 
+			// rotate setpoint direction and velocity into the body frame once, so that the bins can use the
+			// precomputed body frame directions instead of evaluating trig functions per bin
+			const float cos_yaw = cosf(vehicle_yaw_angle_rad);
+			const float sin_yaw = sinf(vehicle_yaw_angle_rad);
+			const Vector2f setpoint_dir_body{cos_yaw * setpoint_dir(0) + sin_yaw * setpoint_dir(1),
+							 -sin_yaw * setpoint_dir(0) + cos_yaw * setpoint_dir(1)};
+			const Vector2f curr_vel_body{cos_yaw * curr_vel(0) + sin_yaw * curr_vel(1),
+						     -sin_yaw * curr_vel(0) + cos_yaw * curr_vel(1)};
+
 			// limit speed for safe flight
 			for (int i = 0; i < INTERNAL_MAP_USED_BINS; i++) { // disregard unused bins at the end of the message
 
@@ -431,13 +444,9 @@ CollisionPrevention::_calculateConstrainedSetpoint(Vector2f &setpoint, const Vec
 
 				const float distance = _obstacle_map_body_frame.distances[i] * 0.01f; // convert to meters
 				const float max_range = _data_maxranges[i] * 0.01f; // convert to meters
-				float angle = math::radians((float)i * INTERNAL_MAP_INCREMENT_DEG + _obstacle_map_body_frame.angle_offset);
-
-				// convert from body to local frame in the range [0, 2*pi]
-				angle = wrap_2pi(vehicle_yaw_angle_rad + angle);
 
-				// get direction of current bin
-				const Vector2f bin_direction = {cosf(angle), sinf(angle)};
+				// get direction of current bin in body frame
+				const Vector2f bin_direction = {_bin_cos[i], _bin_sin[i]};
 
 				//count number of bins in the field of valid_new
 				if (_obstacle_map_body_frame.distances[i] < UINT16_MAX) {
@@ -447,9 +456,9 @@ CollisionPrevention::_calculateConstrainedSetpoint(Vector2f &setpoint, const Vec
 				if (_obstacle_map_body_frame.distances[i] > _obstacle_map_body_frame.min_distance
 				    && _obstacle_map_body_frame.distances[i] < UINT16_MAX) {
 
-					if (setpoint_dir.dot(bin_direction) > 0) {
+					if (setpoint_dir_body.dot(bin_direction) > 0) {
 						// calculate max allowed velocity with a P-controller (same gain as in the position controller)
-						const float curr_vel_parallel = math::max(0.f, curr_vel.dot(bin_direction));
+						const float curr_vel_parallel = math::max(0.f, curr_vel_body.dot(bin_direction));
 						float delay_distance = curr_vel_parallel * col_prev_dly;
 
 						if (distance < max_range) {
@@ -460,7 +469,7 @@ CollisionPrevention::_calculateConstrainedSetpoint(Vector2f &setpoint, const Vec
 						const float vel_max_posctrl = xy_p * stop_distance;
 
 						const float vel_max_smooth = math::trajectory::computeMaxSpeedFromDistance(max_jerk, max_accel, stop_distance, 0.f);
-						const float projection = bin_direction.dot(setpoint_dir);
+						const float projection = bin_direction.dot(setpoint_dir_body);
 						float vel_max_bin = vel_max;
 
 						if (projection > 0.01f) {
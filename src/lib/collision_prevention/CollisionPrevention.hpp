@@ -90,6 +90,11 @@ protected:
 	uint16_t _data_maxranges[sizeof(_obstacle_map_body_frame.distances) / sizeof(
 										    _obstacle_map_body_frame.distances[0])]; /**< in cm */
 
+	float _bin_cos[sizeof(_obstacle_map_body_frame.distances) / sizeof(
+									 _obstacle_map_body_frame.distances[0])]; /**< body frame bin direction x */
+	float _bin_sin[sizeof(_obstacle_map_body_frame.distances) / sizeof(
+									 _obstacle_map_body_frame.distances[0])]; /**< body frame bin direction y */
+
 	void _addDistanceSensorData(distance_sensor_s &distance_sensor, const matrix::Quatf &vehicle_attitude);
 
 	/**
@@ -37,6 +37,8 @@
 
 #include <dataman_client/DatamanClient.hpp>
 
+px4::atomic<DatamanClient::direct_read_t> DatamanClient::_direct_read{nullptr};
+
 DatamanClient::DatamanClient()
 {
 	_sync_perf = perf_alloc(PC_ELAPSED, "DatamanClient: sync");
@@ -146,6 +148,19 @@ bool DatamanClient::syncHandler(const dataman_request_s &request, dataman_respon
 	return response_received;
 }
 
+bool DatamanClient::readDirect(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length)
+{
+	const direct_read_t direct_read = _direct_read.load();
+
+	if (direct_read == nullptr) {
+		return false;
+	}
+
+	// same as the response data of a request
+	memset(buffer, 0, length);
+	return direct_read(item, index, buffer, length) >= 0;
+}
+
 bool DatamanClient::readSync(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length, hrt_abstime timeout)
 {
 	if (length > g_per_item_size[item]) {
@@ -153,6 +168,10 @@ bool DatamanClient::readSync(dm_item_t item, uint32_t index, uint8_t *buffer, ui
 		return false;
 	}
 
+	if (readDirect(item, index, buffer, length)) {
+		return true;
+	}
+
 	bool success = false;
 	hrt_abstime timestamp = hrt_absolute_time();
 
@@ -219,6 +238,73 @@ bool DatamanClient::writeSync(dm_item_t item, uint32_t index, uint8_t *buffer, u
 	return success;
 }
 
+bool DatamanClient::batchSync(dm_function_t request_type, dm_item_t item, uint32_t index, uint32_t count,
+			      uint8_t *buffer, uint32_t length, hrt_abstime timeout)
+{
+	if (length > g_per_item_size[item]) {
+		PX4_ERR("Length  %" PRIu32 " can't fit in data size for item  %" PRIi8, length, static_cast<uint8_t>(item));
+		return false;
+	}
+
+	if (count == 0) {
+		return true;
+	}
+
+	bool success = false;
+	hrt_abstime timestamp = hrt_absolute_time();
+
+	dataman_request_s request{};
+	request.timestamp = timestamp;
+	request.index = index;
+	request.data_length = length;
+	request.client_id = _client_id;
+	request.request_type = request_type;
+	request.item = static_cast<uint8_t>(item);
+	request.count = count;
+	request.buffer = reinterpret_cast<uintptr_t>(buffer);
+	// dataman must not touch the buffer anymore once we stop waiting for the response
+	request.deadline = timestamp + timeout;
+
+	dataman_response_s response{};
+	success = syncHandler(request, response, timestamp, timeout);
+
+	if (success) {
+
+		if ((response.status != dataman_response_s::STATUS_SUCCESS) || (response.count != count)) {
+
+			success = false;
+			PX4_ERR("batch request type %" PRIu8 " failed! status=%" PRIu8 ", item=%" PRIu8 ", index=%" PRIu32 ", count=%" PRIu32,
+				request.request_type, response.status, static_cast<uint8_t>(item), index, count);
+		}
+	}
+
+	return success;
+}
+
+bool DatamanClient::readBatchSync(dm_item_t item, uint32_t index, uint32_t count, uint8_t *buffer, uint32_t length,
+				  hrt_abstime timeout)
+{
+	if ((_direct_read.load() != nullptr) && (length <= g_per_item_size[item])) {
+		bool success = true;
+
+		for (uint32_t i = 0; (i < count) && success; i++) {
+			success = readDirect(item, index + i, &buffer[i * length], length);
+		}
+
+		if (success) {
+			return true;
+		}
+	}
+
+	return batchSync(DM_READ_BATCH, item, index, count, buffer, length, timeout);
+}
+
+bool DatamanClient::writeBatchSync(dm_item_t item, uint32_t index, uint32_t count, uint8_t *buffer, uint32_t length,
+				   hrt_abstime timeout)
+{
+	return batchSync(DM_WRITE_BATCH, item, index, count, buffer, length, timeout);
+}
+
 bool DatamanClient::clearSync(dm_item_t item, hrt_abstime timeout)
 {
 	bool success = false;
@@ -255,7 +341,12 @@ bool DatamanClient::readAsync(dm_item_t item, uint32_t index, uint8_t *buffer, u
 
 	bool success = false;
 
-	if (_state == State::Idle) {
+	if (_state == State::Idle && readDirect(item, index, buffer, length)) {
+		_response_status = dataman_response_s::STATUS_SUCCESS;
+		_state = State::ResponseReceived;
+		success = true;
+
+	} else if (_state == State::Idle) {
 
 		hrt_abstime timestamp = hrt_absolute_time();
 
@@ -443,77 +534,200 @@ void DatamanClient::abortCurrentOperation()
 DatamanCache::DatamanCache(const char *cache_miss_perf_counter_name, uint32_t num_items)
 	: _cache_miss_perf(perf_alloc(PC_COUNT, cache_miss_perf_counter_name))
 {
-	_items = new Item[num_items] {};
-
-	if (_items != nullptr) {
-		_num_items = num_items;
-
-	} else {
-		PX4_ERR("alloc failed");
-	}
+	resize(num_items);
 }
 
 DatamanCache::~DatamanCache()
 {
-	delete[] _items;
+	delete[] _pages;
 	perf_free(_cache_miss_perf);
 }
 
 void DatamanCache::resize(uint32_t num_items)
 {
-	Item *new_items = new Item[num_items] {};
+	// num_items consecutive indexes span at most one page more than they fill, plus the page loaded ahead
+	const uint32_t num_pages = (num_items > 0) ? ((num_items + PAGE_SIZE - 1) / PAGE_SIZE + 2) : 0;
+
+	Page *new_pages = nullptr;
 
-	if (new_items != nullptr) {
-		uint32_t num_min = num_items < _num_items ? num_items : _num_items;
+	if (num_pages > 0) {
+		new_pages = new Page[num_pages] {};
 
-		for (uint32_t i = 0; i < num_min; ++i) {
-			new_items[i] = _items[i];
+		if (new_pages == nullptr) {
+			PX4_ERR("alloc failed");
+			return;
 		}
+	}
 
-		delete[] _items;
-		_items = new_items;
-		_num_items = num_items;
+	// the buffer of the request in progress is moved, request it again
+	_client.abortCurrentOperation();
+	_request_in_progress = false;
+	_item_counter = 0;
 
-	} else {
-		PX4_ERR("alloc failed");
+	const uint32_t num_min = num_pages < _num_pages ? num_pages : _num_pages;
+
+	for (uint32_t i = 0; i < num_min; ++i) {
+		new_pages[i] = _pages[i];
+
+		for (Item &entry : new_pages[i].items) {
+			if (entry.cache_state == State::RequestSent) {
+				entry.cache_state = State::RequestPrepared;
+			}
+
+			if (entry.cache_state == State::RequestPrepared) {
+				++_item_counter;
+			}
+		}
 	}
+
+	delete[] _pages;
+	_pages = new_pages;
+	_num_pages = num_pages;
+	_num_items = num_items;
 }
 
-bool DatamanCache::load(dm_item_t item, uint32_t index)
+DatamanCache::Page *DatamanCache::findPage(dm_item_t item, uint32_t index)
 {
-	if (!_items) {
-		return false;
+	const uint32_t first_index = index - (index % PAGE_SIZE);
+
+	for (uint32_t i = 0; i < _num_pages; ++i) {
+		if (_pages[i].valid && (_pages[i].item == item) && (_pages[i].first_index == first_index)) {
+			return &_pages[i];
+		}
 	}
 
-	bool success = false;
-	bool duplicate = false;
+	return nullptr;
+}
+
+DatamanCache::Page *DatamanCache::allocatePage(dm_item_t item, uint32_t index)
+{
+	Page *page = findPage(item, index);
+
+	if (page) {
+		return page;
+	}
 
-	//Prevent duplicates
-	for (uint32_t i = 0; i < _num_items; ++i) {
+	// use a free page, or replace the least recently used one without pending requests
+	for (uint32_t i = 0; i < _num_pages; ++i) {
+		Page &candidate = _pages[i];
 
-		if (_items[i].cache_state != State::Idle &&
-		    _items[i].cache_state != State::Error &&
-		    _items[i].response.item == item &&
-		    _items[i].response.index == index) {
-			duplicate = true;
+		if (!candidate.valid) {
+			page = &candidate;
 			break;
 		}
+
+		bool pending = false;
+
+		for (const Item &entry : candidate.items) {
+			pending |= (entry.cache_state == State::RequestPrepared) || (entry.cache_state == State::RequestSent);
+		}
+
+		if (!pending && (!page || (candidate.last_used < page->last_used))) {
+			page = &candidate;
+		}
 	}
 
-	if (!duplicate && (_item_counter < _num_items)) {
+	if (page) {
+		page->valid = true;
+		page->item = item;
+		page->first_index = index - (index % PAGE_SIZE);
 
-		_items[_load_index].cache_state = State::RequestPrepared;
-		_items[_load_index].response.item = item;
-		_items[_load_index].response.index = index;
+		for (Item &entry : page->items) {
+			entry.cache_state = State::Idle;
+		}
 
-		_load_index = (_load_index + 1) % _num_items;
+		touch(*page);
+	}
 
-		++_item_counter;
+	return page;
+}
 
-		success = true;
+void DatamanCache::loadPage(Page &page)
+{
+	for (uint32_t slot = 0; slot < PAGE_SIZE; ++slot) {
+
+		// the last page of an item can be incomplete
+		if (page.first_index + slot >= g_per_item_max_index[page.item]) {
+			break;
+		}
+
+		Item &entry = page.items[slot];
+
+		if ((entry.cache_state == State::Idle) || (entry.cache_state == State::Error)) {
+			entry.cache_state = State::RequestPrepared;
+			++_item_counter;
+		}
 	}
+}
 
-	return success;
+void DatamanCache::prefetch(dm_item_t item, uint32_t index)
+{
+	if (item == _last_item) {
+		if (index > _last_index) {
+			_access_forward = true;
+
+		} else if (index < _last_index) {
+			_access_forward = false;
+		}
+	}
+
+	_last_item = item;
+	_last_index = index;
+
+	const uint32_t slot = index % PAGE_SIZE;
+
+	// load the neighboring page once the accesses passed the middle of the current one
+	if (_access_forward && (slot >= PAGE_SIZE / 2)) {
+		const uint32_t next_index = index - slot + PAGE_SIZE;
+
+		if (next_index < g_per_item_max_index[item]) {
+			load(item, next_index);
+		}
+
+	} else if (!_access_forward && (slot < PAGE_SIZE / 2) && (index >= PAGE_SIZE)) {
+		load(item, index - slot - 1);
+	}
+}
+
+bool DatamanCache::nextPendingItem(uint32_t &page_index, uint32_t &slot)
+{
+	bool found = false;
+
+	// most recently used pages first, pages loaded ahead are needed later
+	for (uint32_t i = 0; i < _num_pages; ++i) {
+		if (!_pages[i].valid || (found && (_pages[i].last_used < _pages[page_index].last_used))) {
+			continue;
+		}
+
+		for (uint32_t j = 0; j < PAGE_SIZE; ++j) {
+			if (_pages[i].items[j].cache_state == State::RequestPrepared) {
+				page_index = i;
+				slot = j;
+				found = true;
+				break;
+			}
+		}
+	}
+
+	return found;
+}
+
+bool DatamanCache::load(dm_item_t item, uint32_t index)
+{
+	if (!_pages || (item >= DM_KEY_NUM_KEYS) || (index >= g_per_item_max_index[item])) {
+		return false;
+	}
+
+	Page *page = allocatePage(item, index);
+
+	if (!page) {
+		return false;
+	}
+
+	touch(*page);
+	loadPage(*page);
+
+	return true;
 }
 
 bool DatamanCache::loadWait(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length, hrt_abstime timeout)
@@ -523,43 +737,48 @@ bool DatamanCache::loadWait(dm_item_t item, uint32_t index, uint8_t *buffer, uin
 		return false;
 	}
 
-	if (!_items) {
+	if (!_pages) {
 		return false;
 	}
 
 	bool success = false;
-	bool item_found = false;
-
-	for (uint32_t i = 0; i < _num_items; ++i) {
-		if ((_items[i].response.item == item) &&
-		    (_items[i].response.index == index)) {
-			item_found = true;
+	Page *page = findPage(item, index);
 
-			if (_items[i].cache_state == State::ResponseReceived) {
-				memcpy(buffer, _items[i].response.data, length);
-				success = true;
-				break;
-			}
-		}
-	}
+	if (page && (page->items[index - page->first_index].cache_state == State::ResponseReceived)) {
+		memcpy(buffer, page->items[index - page->first_index].data, length);
+		touch(*page);
+		success = true;
 
-	if (!success && (timeout > 0)) {
+	} else if (timeout > 0) {
 		perf_count(_cache_miss_perf);
 		success = _client.readSync(item, index, buffer, length, timeout);
 
-		// Cache the item if not found already (it could be in the process of being loaded)
-		if (success && !item_found && _item_counter < _num_items) {
-			_items[_load_index].cache_state = State::ResponseReceived;
-			_items[_load_index].response.item = item;
-			_items[_load_index].response.index = index;
-			memcpy(_items[_load_index].response.data, buffer, length);
+		// Cache the item and load the rest of its page
+		if (success) {
+			page = allocatePage(item, index);
+
+			if (page) {
+				Item &entry = page->items[index - page->first_index];
+
+				if (entry.cache_state != State::RequestSent) {
+					if (entry.cache_state == State::RequestPrepared) {
+						--_item_counter;
+					}
 
-			_load_index = (_load_index + 1) % _num_items;
+					memset(entry.data, 0, sizeof(entry.data));
+					memcpy(entry.data, buffer, length);
+					entry.cache_state = State::ResponseReceived;
+				}
 
-			++_item_counter; // Still increase the counter here
+				loadPage(*page);
+			}
 		}
 	}
 
+	if (success) {
+		prefetch(item, index);
+	}
+
 	return success;
 }
 
@@ -572,17 +791,19 @@ bool DatamanCache::writeWait(dm_item_t item, uint32_t index, uint8_t *buffer, ui
 
 	bool success = _client.writeSync(item, index, buffer, length, timeout);
 
-	if (success && _items) {
-		for (uint32_t i = 0; i < _num_items; ++i) {
-			if ((_items[i].response.item == item) &&
-			    (_items[i].response.index == index) &&
-			    ((_items[i].cache_state == State::ResponseReceived) ||
-			     (_items[i].cache_state == State::RequestPrepared))) {
+	Page *page = _pages ? findPage(item, index) : nullptr;
 
-				memcpy(_items[i].response.data, buffer, length);
-				_items[i].cache_state = State::ResponseReceived;
-				break;
+	if (success && page) {
+		Item &entry = page->items[index - page->first_index];
+
+		if ((entry.cache_state == State::ResponseReceived) || (entry.cache_state == State::RequestPrepared)) {
+
+			if (entry.cache_state == State::RequestPrepared) {
+				--_item_counter;
 			}
+
+			memcpy(entry.data, buffer, length);
+			entry.cache_state = State::ResponseReceived;
 		}
 	}
 
@@ -595,83 +816,66 @@ void DatamanCache::update()
 
 		_client.update();
 
-		bool success = false;
-		bool response_success = false;
+		// direct reads complete immediately, process up to a page of them at once
+		for (uint32_t i = 0; (i < PAGE_SIZE) && (_item_counter > 0); ++i) {
 
-		switch (_items[_update_index].cache_state) {
-		case State::Idle:
-			break;
-
-		case State::ResponseReceived:
-			// Skip it
-			changeUpdateIndex();
-			break;
+			if (!_request_in_progress) {
 
-		case State::RequestPrepared:
-
-			success = _client.readAsync(static_cast<dm_item_t>(_items[_update_index].response.item),
-						    _items[_update_index].response.index,
-						    _items[_update_index].response.data,
-						    g_per_item_size[_items[_update_index].response.item]);
-
-			if (success) {
-				_items[_update_index].cache_state = State::RequestSent;
-
-			} else {
-				_items[_update_index].cache_state = State::Error;
-			}
-
-			break;
-
-		case State::RequestSent:
-
-			if (_client.lastOperationCompleted(response_success)) {
+				if (!nextPendingItem(_pending_page, _pending_slot)) {
+					_item_counter = 0;
+					break;
+				}
 
-				if (response_success) {
+				Page &page = _pages[_pending_page];
 
-					_items[_update_index].cache_state = State::ResponseReceived;
-					changeUpdateIndex();
+				if (_client.readAsync(page.item, page.first_index + _pending_slot, page.items[_pending_slot].data,
+						      g_per_item_size[page.item])) {
+					page.items[_pending_slot].cache_state = State::RequestSent;
+					_request_in_progress = true;
 
 				} else {
-					_items[_update_index].cache_state = State::Error;
+					page.items[_pending_slot].cache_state = State::Error;
+					--_item_counter;
+					PX4_ERR("Caching: item %" PRIu8 ", index %" PRIu32 " request failed", static_cast<uint8_t>(page.item),
+						page.first_index + _pending_slot);
+					continue;
 				}
 			}
 
-			break;
+			bool response_success = false;
 
-		case State::Error:
-			// Handled below
-			break;
-		}
+			if (!_client.lastOperationCompleted(response_success)) {
+				break;
+			}
 
-		if (_items[_update_index].cache_state == State::Error) {
-			PX4_ERR("Caching: item %" PRIu8 ", index %" PRIu32", status %" PRIu8,
-				_items[_update_index].response.item, _items[_update_index].response.index,
-				_items[_update_index].response.status);
+			Page &page = _pages[_pending_page];
+			_request_in_progress = false;
+			--_item_counter;
 
-			changeUpdateIndex();
-		}
+			if (response_success) {
+				page.items[_pending_slot].cache_state = State::ResponseReceived;
 
+			} else {
+				page.items[_pending_slot].cache_state = State::Error;
+				PX4_ERR("Caching: item %" PRIu8 ", index %" PRIu32, static_cast<uint8_t>(page.item),
+					page.first_index + _pending_slot);
+			}
+		}
 	}
 }
 
 void DatamanCache::invalidate()
 {
-	for (uint32_t i = 0; i < _num_items; ++i) {
-		_items[i].cache_state = State::Idle;
+	for (uint32_t i = 0; i < _num_pages; ++i) {
+		_pages[i].valid = false;
+
+		for (Item &entry : _pages[i].items) {
+			entry.cache_state = State::Idle;
+		}
 	}
 
-	_update_index = 0;
 	_item_counter = 0;
-	_load_index = 0;
+	_request_in_progress = false;
+	_last_item = DM_KEY_NUM_KEYS;
 	_client.abortCurrentOperation();
 }
-
-inline void DatamanCache::changeUpdateIndex()
-{
-	_update_index = (_update_index + 1) % _num_items;
-
-	if (_item_counter > 0) {
-		--_item_counter;
-	}
-}
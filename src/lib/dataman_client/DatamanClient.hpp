@@ -32,6 +32,7 @@
  ****************************************************************************/
 #pragma once
 
+#include <px4_platform_common/atomic.h>
 #include <uORB/uORB.h>
 #include <uORB/Publication.hpp>
 #include <uORB/Subscription.hpp>
@@ -77,6 +78,36 @@ public:
 	 */
 	bool writeSync(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length, hrt_abstime timeout = 5000_ms);
 
+	/**
+	 * @brief Reads a range of consecutive indexes of an item synchronously, with a single request.
+	 *
+	 * @param[in] item The item to read data from.
+	 * @param[in] index The first index to read.
+	 * @param[in] count The number of indexes to read.
+	 * @param[out] buffer Pointer to the buffer to store the read data, count items of length bytes each.
+	 * @param[in] length The length of the data of each index.
+	 * @param[in] timeout The timeout in microseconds for waiting for the response.
+	 *
+	 * @return true if all items were read successfully within the timeout, false otherwise.
+	 */
+	bool readBatchSync(dm_item_t item, uint32_t index, uint32_t count, uint8_t *buffer, uint32_t length,
+			   hrt_abstime timeout = 5000_ms);
+
+	/**
+	 * @brief Writes a range of consecutive indexes of an item synchronously, with a single request.
+	 *
+	 * @param[in] item The data item type to write.
+	 * @param[in] index The first index to write.
+	 * @param[in] count The number of indexes to write.
+	 * @param[in] buffer The buffer that contains the data to write, count items of length bytes each.
+	 * @param[in] length The length of the data of each index.
+	 * @param[in] timeout The maximum time in microseconds to wait for the response.
+	 *
+	 * @return True if all items were written successfully, false otherwise.
+	 */
+	bool writeBatchSync(dm_item_t item, uint32_t index, uint32_t count, uint8_t *buffer, uint32_t length,
+			    hrt_abstime timeout = 5000_ms);
+
 	/**
 	 * @brief Clears the data in the specified dataman item.
 	 *
@@ -153,6 +184,21 @@ public:
 	 */
 	void abortCurrentOperation();
 
+	/**
+	 * Read function of a dataman backend that can be called from any thread (memory mapped storage on POSIX).
+	 * @return number of bytes read, < 0 on error
+	 */
+	typedef ssize_t (*direct_read_t)(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length);
+
+	/**
+	 * @brief Let the clients read directly from the dataman backend instead of sending a request to the dataman task.
+	 *
+	 * @param[in] direct_read backend read function, nullptr to disable
+	 *
+	 * @note Direct reads don't wait for async writes that were not completed yet.
+	 */
+	static void setDirectRead(direct_read_t direct_read) { _direct_read.store(direct_read); }
+
 private:
 
 	enum class State {
@@ -170,6 +216,13 @@ private:
 		uint32_t length;
 	};
 
+	/* Read using the direct read function of the backend, if there is one */
+	bool readDirect(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length);
+
+	/* Send a batch request, dataman accesses the client buffer directly */
+	bool batchSync(dm_function_t request_type, dm_item_t item, uint32_t index, uint32_t count, uint8_t *buffer,
+		       uint32_t length, hrt_abstime timeout);
+
 	/* Synchronous response/request handler */
 	bool syncHandler(const dataman_request_s &request, dataman_response_s &response,
 			 const hrt_abstime &start_time, hrt_abstime timeout);
@@ -188,9 +241,18 @@ private:
 	perf_counter_t _sync_perf{nullptr};
 
 	static constexpr uint8_t CLIENT_ID_NOT_SET{0};
+
+	static px4::atomic<direct_read_t> _direct_read;
 };
 
 
+/**
+ * Cache of dataman items, loaded asynchronously.
+ *
+ * The cache is organized in pages of PAGE_SIZE consecutive indexes of an item. Loading an index loads its whole
+ * page, and accessing the items moving through a page loads the next page in the same direction ahead (for example
+ * along the mission sequence). When all pages are in use, the least recently used page is replaced.
+ */
 class DatamanCache
 {
 public:
@@ -200,6 +262,8 @@ public:
 	/**
 	 * @brief Resizes the cache to hold the specified number of items.
 	 *
+	 * The cache allocates enough pages to hold any num_items consecutive indexes, the page ahead included.
+	 *
 	 * @param[in] num_items The number of items the cache should hold.
 	 */
 	void resize(uint32_t num_items);
@@ -218,7 +282,7 @@ public:
 	 * @param[in] item The item to load.
 	 * @param[in] index The index of the item to load.
 	 *
-	 * @return true if the item was added to be cached, false otherwise if the size of the cache is reached.
+	 * @return true if the item was added to be cached, false if all pages have pending requests.
 	 */
 	bool load(dm_item_t item, uint32_t index);
 
@@ -279,6 +343,13 @@ public:
 
 private:
 
+	/* Number of consecutive indexes of an item that are cached and replaced together */
+#if defined(MEMORY_CONSTRAINED_SYSTEM)
+	static constexpr uint32_t PAGE_SIZE = 4;
+#else
+	static constexpr uint32_t PAGE_SIZE = 8;
+#endif
+
 	enum class State {
 		Idle,
 		RequestPrepared,
@@ -288,17 +359,48 @@ private:
 	};
 
 	struct Item {
-		dataman_response_s response;
+		uint8_t data[sizeof(dataman_response_s::data)];
 		State cache_state;
 	};
 
-	inline void changeUpdateIndex();
+	struct Page {
+		Item items[PAGE_SIZE];
+		dm_item_t item;
+		uint32_t first_index;	///< index of items[0], a multiple of PAGE_SIZE
+		uint32_t last_used;	///< access counter value of the last access, for LRU replacement
+		bool valid;
+	};
+
+	/* Find the cached page containing an index, nullptr if not cached */
+	Page *findPage(dm_item_t item, uint32_t index);
+
+	/* Get a page for an index, replacing the least recently used page without pending requests if needed */
+	Page *allocatePage(dm_item_t item, uint32_t index);
+
+	/* Prepare the requests for all entries of a page that are not cached yet */
+	void loadPage(Page &page);
+
+	/* Load the neighboring page in the direction the items are accessed */
+	void prefetch(dm_item_t item, uint32_t index);
 
-	Item *_items{nullptr};
-	uint32_t _load_index{0};	///< index for tracking last index used by load function
-	uint32_t _update_index{0};	///< index for tracking last index used by update function
+	void touch(Page &page) { page.last_used = ++_access_counter; }
+
+	/* Entry with the request in progress, or the next request to send */
+	bool nextPendingItem(uint32_t &page_index, uint32_t &slot);
+
+	Page *_pages{nullptr};
+	uint32_t _num_pages{0};
 	uint32_t _item_counter{0};	///< number of items to process with update function
 	uint32_t _num_items{0};		///< number of items that cache can store
+	uint32_t _access_counter{0};
+
+	uint32_t _pending_page{0};	///< page and slot of the request in progress
+	uint32_t _pending_slot{0};
+	bool _request_in_progress{false};
+
+	dm_item_t _last_item{DM_KEY_NUM_KEYS};	///< last accessed item and index, to detect the access direction
+	uint32_t _last_index{0};
+	bool _access_forward{true};
 
 	DatamanClient _client{};
 
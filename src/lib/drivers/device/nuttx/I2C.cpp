@@ -45,10 +45,180 @@
 #if defined(CONFIG_I2C)
 
 #include <px4_platform_common/i2c_spi_buses.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+#include <px4_platform_common/px4_work_queue/WorkQueueManager.hpp>
+#include <nuttx/arch.h>
 #include <nuttx/i2c/i2c_master.h>
 
 namespace device
 {
+
+/**
+ * Transactions queued by all devices on one bus, executed in order from the bus work queue.
+ */
+class I2CBusScheduler : public px4::WorkItem
+{
+public:
+	I2CBusScheduler(int bus, uint32_t device_id) :
+		px4::WorkItem("i2c_bus_scheduler", px4::device_bus_to_wq(device_id)),
+		_bus(bus)
+	{}
+
+	~I2CBusScheduler() override = default;
+
+	/**
+	 * Get the scheduler of the bus a device is on, allocated on first use.
+	 */
+	static I2CBusScheduler *get(I2C &i2c);
+
+	bool queue(I2C *i2c, const uint8_t *send, unsigned send_len, uint8_t *recv, unsigned recv_len,
+		   I2C::transfer_callback_t callback, void *arg);
+
+	// remove all pending transfers of a device
+	void cancel(const I2C *i2c);
+
+private:
+	void Run() override;
+
+	static constexpr int MAX_QUEUED_TRANSFERS{8};
+
+	struct Transfer {
+		I2C *i2c;
+		const uint8_t *send;
+		unsigned send_len;
+		uint8_t *recv;
+		unsigned recv_len;
+		I2C::transfer_callback_t callback;
+		void *arg;
+		uint8_t attempt;
+	};
+
+	bool push(const Transfer &transfer);
+
+	const int _bus;
+
+	Transfer _queue[MAX_QUEUED_TRANSFERS] {};
+	int _queued{0};
+
+	static I2CBusScheduler *_schedulers[I2C_BUS_MAX_BUS_ITEMS];
+};
+
+I2CBusScheduler *I2CBusScheduler::_schedulers[I2C_BUS_MAX_BUS_ITEMS] {};
+
+I2CBusScheduler *I2CBusScheduler::get(I2C &i2c)
+{
+	const int bus = i2c.get_device_bus();
+
+	for (int i = 0; i < I2C_BUS_MAX_BUS_ITEMS; i++) {
+		if (_schedulers[i] && (_schedulers[i]->_bus == bus)) {
+			return _schedulers[i];
+		}
+	}
+
+	I2CBusScheduler *scheduler = new I2CBusScheduler(bus, i2c.get_device_id());
+
+	if (scheduler == nullptr) {
+		return nullptr;
+	}
+
+	// the devices on a bus share a work queue, but others may still race for a free slot
+	irqstate_t flags = px4_enter_critical_section();
+
+	for (int i = 0; i < I2C_BUS_MAX_BUS_ITEMS; i++) {
+		if (_schedulers[i] && (_schedulers[i]->_bus == bus)) {
+			px4_leave_critical_section(flags);
+			delete scheduler;
+			return _schedulers[i];
+		}
+
+		if (_schedulers[i] == nullptr) {
+			_schedulers[i] = scheduler;
+			px4_leave_critical_section(flags);
+			return scheduler;
+		}
+	}
+
+	px4_leave_critical_section(flags);
+
+	delete scheduler;
+	return nullptr;
+}
+
+bool I2CBusScheduler::push(const Transfer &transfer)
+{
+	irqstate_t flags = px4_enter_critical_section();
+
+	if (_queued >= MAX_QUEUED_TRANSFERS) {
+		px4_leave_critical_section(flags);
+		return false;
+	}
+
+	_queue[_queued++] = transfer;
+
+	px4_leave_critical_section(flags);
+
+	ScheduleNow();
+
+	return true;
+}
+
+bool I2CBusScheduler::queue(I2C *i2c, const uint8_t *send, unsigned send_len, uint8_t *recv, unsigned recv_len,
+			    I2C::transfer_callback_t callback, void *arg)
+{
+	return push(Transfer{i2c, send, send_len, recv, recv_len, callback, arg, 0});
+}
+
+void I2CBusScheduler::cancel(const I2C *i2c)
+{
+	irqstate_t flags = px4_enter_critical_section();
+
+	int queued = 0;
+
+	for (int i = 0; i < _queued; i++) {
+		if (_queue[i].i2c != i2c) {
+			_queue[queued++] = _queue[i];
+		}
+	}
+
+	_queued = queued;
+
+	px4_leave_critical_section(flags);
+}
+
+void I2CBusScheduler::Run()
+{
+	Transfer transfers[MAX_QUEUED_TRANSFERS];
+
+	irqstate_t flags = px4_enter_critical_section();
+	const int count = _queued;
+
+	for (int i = 0; i < count; i++) {
+		transfers[i] = _queue[i];
+	}
+
+	_queued = 0;
+	px4_leave_critical_section(flags);
+
+	for (int i = 0; i < count; i++) {
+		Transfer &transfer = transfers[i];
+		I2C *i2c = transfer.i2c;
+
+		// a single attempt per pass, retries go to the back of the queue behind the other devices
+		const int ret = i2c->_transfer(transfer.send, transfer.send_len, transfer.recv, transfer.recv_len);
+
+		if ((ret != PX4_OK) && (transfer.attempt < i2c->_retries)) {
+			i2c->_reset_bus(transfer.attempt);
+			transfer.attempt++;
+
+			if (push(transfer)) {
+				continue;
+			}
+		}
+
+		// the bus is free again, the callback may queue the next transfer of the device
+		transfer.callback(transfer.arg, ret);
+	}
+}
 /*
  *  N.B. By defaulting the value of _bus_clocks to non Zero
  *  All calls to init() will NOT set the buss frequency
@@ -74,6 +244,10 @@ I2C::I2C(const I2CSPIDriverConfig &config)
 
 I2C::~I2C()
 {
+	if (_scheduler) {
+		_scheduler->cancel(this);
+	}
+
 	if (_dev) {
 		px4_i2cbus_uninitialize(_dev);
 		_dev = nullptr;
@@ -186,57 +360,97 @@ I2C::transfer(const uint8_t *send, const unsigned send_len, uint8_t *recv, const
 	}
 
 	do {
-		DEVICE_DEBUG("transfer out %p/%u  in %p/%u", send, send_len, recv, recv_len);
-
-		i2c_msg_s msgv[2] {};
-		unsigned msgs = 0;
-
-		if (send_len > 0) {
-			msgv[msgs].frequency = _bus_clocks[get_device_bus() - 1];
-			msgv[msgs].addr = get_device_address();
-			msgv[msgs].flags = 0;
-			msgv[msgs].buffer = const_cast<uint8_t *>(send);
-			msgv[msgs].length = send_len;
-			msgs++;
-		}
+		ret = _transfer(send, send_len, recv, recv_len);
 
-		if (recv_len > 0) {
-			msgv[msgs].frequency = _bus_clocks[get_device_bus() - 1];
-			msgv[msgs].addr = get_device_address();
-			msgv[msgs].flags = I2C_M_READ;
-			msgv[msgs].buffer = recv;
-			msgv[msgs].length = recv_len;
-			msgs++;
+		if ((ret == PX4_OK) || (ret == -EINVAL)) {
+			break;
 		}
 
-		if (msgs == 0) {
-			return -EINVAL;
-		}
+		_reset_bus(retry_count);
 
-		int ret_transfer = I2C_TRANSFER(_dev, &msgv[0], msgs);
+	} while (retry_count++ < _retries);
 
-		if (ret_transfer != 0) {
-			DEVICE_DEBUG("I2C transfer failed, result %d", ret_transfer);
-			ret = PX4_ERROR;
+	return ret;
+}
 
-		} else {
-			// success
-			ret = PX4_OK;
-			break;
-		}
+int
+I2C::transfer_queued(const uint8_t *send, const unsigned send_len, uint8_t *recv, const unsigned recv_len,
+		     transfer_callback_t callback, void *arg)
+{
+	if (((send_len == 0) && (recv_len == 0)) || (callback == nullptr) || up_interrupt_context()) {
+		return -EINVAL;
+	}
 
-		// if we have already retried once, and we aren't going to give up, then reset the bus
-		if ((_retries > 0) && (retry_count < _retries)) {
-#if defined(CONFIG_I2C_RESET)
-			DEVICE_DEBUG("I2C bus: %d, Addr: %X, I2C_RESET %d/%d",
-				     get_device_bus(), get_device_address(), retry_count + 1, _retries);
-			I2C_RESET(_dev);
-#endif // CONFIG_I2C_RESET
-		}
+	if (_dev == nullptr) {
+		PX4_ERR("I2C device not opened");
+		return PX4_ERROR;
+	}
 
-	} while (retry_count++ < _retries);
+	if (_scheduler == nullptr) {
+		_scheduler = I2CBusScheduler::get(*this);
+	}
 
-	return ret;
+	if (_scheduler && _scheduler->queue(this, send, send_len, recv, recv_len, callback, arg)) {
+		return PX4_OK;
+	}
+
+	// no scheduler or bus queue full, transfer immediately
+	callback(arg, transfer(send, send_len, recv, recv_len));
+
+	return PX4_OK;
+}
+
+int
+I2C::_transfer(const uint8_t *send, const unsigned send_len, uint8_t *recv, const unsigned recv_len)
+{
+	DEVICE_DEBUG("transfer out %p/%u  in %p/%u", send, send_len, recv, recv_len);
+
+	i2c_msg_s msgv[2] {};
+	unsigned msgs = 0;
+
+	if (send_len > 0) {
+		msgv[msgs].frequency = _bus_clocks[get_device_bus() - 1];
+		msgv[msgs].addr = get_device_address();
+		msgv[msgs].flags = 0;
+		msgv[msgs].buffer = const_cast<uint8_t *>(send);
+		msgv[msgs].length = send_len;
+		msgs++;
+	}
+
+	if (recv_len > 0) {
+		msgv[msgs].frequency = _bus_clocks[get_device_bus() - 1];
+		msgv[msgs].addr = get_device_address();
+		msgv[msgs].flags = I2C_M_READ;
+		msgv[msgs].buffer = recv;
+		msgv[msgs].length = recv_len;
+		msgs++;
+	}
+
+	if (msgs == 0) {
+		return -EINVAL;
+	}
+
+	int ret_transfer = I2C_TRANSFER(_dev, &msgv[0], msgs);
+
+	if (ret_transfer != 0) {
+		DEVICE_DEBUG("I2C transfer failed, result %d", ret_transfer);
+		return PX4_ERROR;
+	}
+
+	return PX4_OK;
+}
+
+void
+I2C::_reset_bus(unsigned attempt)
+{
+	// if we have already retried once, and we aren't going to give up, then reset the bus
+	if ((_retries > 0) && (attempt < _retries)) {
+#if defined(CONFIG_I2C_RESET)
+		DEVICE_DEBUG("I2C bus: %d, Addr: %X, I2C_RESET %d/%d",
+			     get_device_bus(), get_device_address(), attempt + 1, _retries);
+		I2C_RESET(_dev);
+#endif // CONFIG_I2C_RESET
+	}
 }
 
 } // namespace device
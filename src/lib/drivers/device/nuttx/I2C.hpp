@@ -51,6 +51,8 @@ struct I2CSPIDriverConfig;
 namespace device __EXPORT
 {
 
+class I2CBusScheduler;
+
 /**
  * Abstract class for character device on I2C
  */
@@ -108,6 +110,39 @@ protected:
 	 */
 	int		transfer(const uint8_t *send, const unsigned send_len, uint8_t *recv, const unsigned recv_len);
 
+	/**
+	 * Completion callback of a queued transfer.
+	 *
+	 * @param arg		Argument given to transfer_queued().
+	 * @param result	OK if the transfer was successful, -errno otherwise.
+	 */
+	typedef void (*transfer_callback_t)(void *arg, int result);
+
+	/**
+	 * Queue an I2C transaction on the bus without blocking.
+	 *
+	 * Pending transactions of all devices on the same bus are executed in
+	 * order from a per bus work item on the bus work queue. A failed attempt
+	 * is put back at the end of the queue, so the retries of a slow or NAK-ing
+	 * device are interleaved with the transfers of the other devices instead
+	 * of holding the bus queue for all of them.
+	 *
+	 * The buffers must stay valid until the callback is called. The callback
+	 * is called exactly once from the bus work queue, or immediately if the
+	 * bus queue is full. Must not be called from interrupt context.
+	 *
+	 * @param send		Pointer to bytes to send.
+	 * @param send_len	Number of bytes to send.
+	 * @param recv		Pointer to buffer for bytes received.
+	 * @param recv_len	Number of bytes to receive.
+	 * @param callback	Called once the transfer completed.
+	 * @param arg		Argument passed to the callback.
+	 * @return		OK if the transfer was queued, -errno otherwise
+	 *			(the callback is not called).
+	 */
+	int		transfer_queued(const uint8_t *send, const unsigned send_len, uint8_t *recv, const unsigned recv_len,
+					transfer_callback_t callback, void *arg);
+
 	bool	external() const override { return px4_i2c_device_external(_device_id.devid); }
 
 private:
@@ -116,6 +151,13 @@ private:
 	const uint32_t		_frequency;
 	i2c_master_s		*_dev{nullptr};
 
+	I2CBusScheduler		*_scheduler{nullptr};		/**< bus transfer queue, allocated on first use */
+
+	friend class I2CBusScheduler;
+
+	int	_transfer(const uint8_t *send, const unsigned send_len, uint8_t *recv, const unsigned recv_len);
+	void	_reset_bus(unsigned attempt);
+
 };
 
 } // namespace device
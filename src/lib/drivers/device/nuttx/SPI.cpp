@@ -44,6 +44,8 @@
 
 #include <px4_platform_common/i2c_spi_buses.h>
 #include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+#include <px4_platform_common/px4_work_queue/WorkQueueManager.hpp>
 #include <nuttx/arch.h>
 
 #ifndef CONFIG_SPI_EXCHANGE
@@ -53,6 +55,191 @@
 namespace device
 {
 
+/**
+ * Transfers queued by all devices on one bus, executed back to back from the bus work queue.
+ */
+class SPIBusScheduler : public px4::WorkItem
+{
+public:
+	SPIBusScheduler(int bus, struct spi_dev_s *dev, uint32_t device_id) :
+		px4::WorkItem("spi_bus_scheduler", px4::device_bus_to_wq(device_id)),
+		_bus(bus),
+		_dev(dev)
+	{}
+
+	~SPIBusScheduler() override = default;
+
+	/**
+	 * Get the scheduler of the bus a device is on, allocated on first use.
+	 */
+	static SPIBusScheduler *get(SPI &spi);
+
+	bool queue(SPI *spi, uint8_t *send, uint8_t *recv, unsigned len, SPI::transfer_callback_t callback, void *arg);
+
+	// remove all pending transfers of a device
+	void cancel(const SPI *spi);
+
+private:
+	void Run() override;
+
+	static constexpr int MAX_QUEUED_TRANSFERS{8};
+
+	struct Transfer {
+		SPI *spi;
+		uint8_t *send;
+		uint8_t *recv;
+		unsigned len;
+		SPI::transfer_callback_t callback;
+		void *arg;
+	};
+
+	const int _bus;
+	struct spi_dev_s *const _dev;
+
+	Transfer _queue[MAX_QUEUED_TRANSFERS] {};
+	int _queued{0};
+
+	static SPIBusScheduler *_schedulers[SPI_BUS_MAX_BUS_ITEMS];
+};
+
+SPIBusScheduler *SPIBusScheduler::_schedulers[SPI_BUS_MAX_BUS_ITEMS] {};
+
+SPIBusScheduler *SPIBusScheduler::get(SPI &spi)
+{
+	const int bus = spi.get_device_bus();
+
+	for (int i = 0; i < SPI_BUS_MAX_BUS_ITEMS; i++) {
+		if (_schedulers[i] && (_schedulers[i]->_bus == bus)) {
+			return _schedulers[i];
+		}
+	}
+
+	SPIBusScheduler *scheduler = new SPIBusScheduler(bus, spi._dev, spi.get_device_id());
+
+	if (scheduler == nullptr) {
+		return nullptr;
+	}
+
+	// the devices on a bus share a work queue, but others may still race for a free slot
+	irqstate_t flags = px4_enter_critical_section();
+
+	for (int i = 0; i < SPI_BUS_MAX_BUS_ITEMS; i++) {
+		if (_schedulers[i] && (_schedulers[i]->_bus == bus)) {
+			px4_leave_critical_section(flags);
+			delete scheduler;
+			return _schedulers[i];
+		}
+
+		if (_schedulers[i] == nullptr) {
+			_schedulers[i] = scheduler;
+			px4_leave_critical_section(flags);
+			return scheduler;
+		}
+	}
+
+	px4_leave_critical_section(flags);
+
+	delete scheduler;
+	return nullptr;
+}
+
+bool SPIBusScheduler::queue(SPI *spi, uint8_t *send, uint8_t *recv, unsigned len, SPI::transfer_callback_t callback,
+			    void *arg)
+{
+	irqstate_t flags = px4_enter_critical_section();
+
+	if (_queued >= MAX_QUEUED_TRANSFERS) {
+		px4_leave_critical_section(flags);
+		return false;
+	}
+
+	_queue[_queued++] = Transfer{spi, send, recv, len, callback, arg};
+
+	px4_leave_critical_section(flags);
+
+	// the transfers of all devices already scheduled on the work queue are queued before this runs
+	ScheduleNow();
+
+	return true;
+}
+
+void SPIBusScheduler::cancel(const SPI *spi)
+{
+	irqstate_t flags = px4_enter_critical_section();
+
+	int queued = 0;
+
+	for (int i = 0; i < _queued; i++) {
+		if (_queue[i].spi != spi) {
+			_queue[queued++] = _queue[i];
+		}
+	}
+
+	_queued = queued;
+
+	px4_leave_critical_section(flags);
+}
+
+void SPIBusScheduler::Run()
+{
+	Transfer transfers[MAX_QUEUED_TRANSFERS];
+	int results[MAX_QUEUED_TRANSFERS];
+
+	irqstate_t flags = px4_enter_critical_section();
+	const int count = _queued;
+
+	for (int i = 0; i < count; i++) {
+		transfers[i] = _queue[i];
+	}
+
+	_queued = 0;
+	px4_leave_critical_section(flags);
+
+	if (count == 0) {
+		return;
+	}
+
+	bool lock = false;
+
+	for (int i = 0; i < count; i++) {
+		if (transfers[i].spi->_locking_mode != SPI::LOCK_NONE) {
+			lock = true;
+		}
+	}
+
+	// lock the bus once for the whole batch
+	if (lock) {
+		SPI_LOCK(_dev, true);
+	}
+
+	const SPI *configured = nullptr;
+
+	for (int i = 0; i < count; i++) {
+		SPI *spi = transfers[i].spi;
+
+		// only reconfigure the bus if the settings differ from the previous transfer
+		if ((configured == nullptr) || (configured->_frequency != spi->_frequency) || (configured->_mode != spi->_mode)) {
+			spi->_configure(8);
+			configured = spi;
+		}
+
+		SPI_SELECT(_dev, spi->_device, true);
+		SPI_EXCHANGE(_dev, transfers[i].send, transfers[i].recv, transfers[i].len);
+		SPI_SELECT(_dev, spi->_device, false);
+
+		results[i] = PX4_OK;
+	}
+
+	if (lock) {
+		SPI_LOCK(_dev, false);
+	}
+
+	// notify after releasing the bus, callbacks are free to transfer again
+	for (int i = 0; i < count; i++) {
+		transfers[i].callback(transfers[i].arg, results[i]);
+	}
+}
+
 SPI::SPI(uint8_t device_type, const char *name, int bus, uint32_t device, enum spi_mode_e mode, uint32_t frequency) :
 	CDev(name, nullptr),
 	_device(device),
@@ -79,6 +266,10 @@ SPI::SPI(const I2CSPIDriverConfig &config)
 
 SPI::~SPI()
 {
+	if (_scheduler) {
+		_scheduler->cancel(this);
+	}
+
 	// XXX no way to let go of the bus...
 }
 
@@ -163,11 +354,41 @@ SPI::transfer(uint8_t *send, uint8_t *recv, unsigned len)
 }
 
 int
-SPI::_transfer(uint8_t *send, uint8_t *recv, unsigned len)
+SPI::transfer_queued(uint8_t *send, uint8_t *recv, unsigned len, transfer_callback_t callback, void *arg)
+{
+	if (((send == nullptr) && (recv == nullptr)) || (callback == nullptr) || up_interrupt_context()) {
+		return -EINVAL;
+	}
+
+	// batches are only locked against other threads
+	if (_locking_mode != LOCK_PREEMPTION) {
+		if (_scheduler == nullptr) {
+			_scheduler = SPIBusScheduler::get(*this);
+		}
+
+		if (_scheduler && _scheduler->queue(this, send, recv, len, callback, arg)) {
+			return PX4_OK;
+		}
+	}
+
+	// no scheduler or bus queue full, transfer immediately
+	callback(arg, transfer(send, recv, len));
+
+	return PX4_OK;
+}
+
+void
+SPI::_configure(unsigned nbits)
 {
 	SPI_SETFREQUENCY(_dev, _frequency);
 	SPI_SETMODE(_dev, _mode);
-	SPI_SETBITS(_dev, 8);
+	SPI_SETBITS(_dev, nbits);
+}
+
+int
+SPI::_transfer(uint8_t *send, uint8_t *recv, unsigned len)
+{
+	_configure(8);
 	SPI_SELECT(_dev, _device, true);
 
 	/* do the transfer */
@@ -217,9 +438,7 @@ SPI::transferhword(uint16_t *send, uint16_t *recv, unsigned len)
 int
 SPI::_transferhword(uint16_t *send, uint16_t *recv, unsigned len)
 {
-	SPI_SETFREQUENCY(_dev, _frequency);
-	SPI_SETMODE(_dev, _mode);
-	SPI_SETBITS(_dev, 16);			/* 16 bit transfer */
+	_configure(16);				/* 16 bit transfer */
 	SPI_SELECT(_dev, _device, true);
 
 	/* do the transfer */
@@ -52,6 +52,8 @@ struct I2CSPIDriverConfig;
 namespace device __EXPORT
 {
 
+class SPIBusScheduler;
+
 /**
  * Abstract class for character device on SPI
  */
@@ -139,6 +141,39 @@ protected:
 	 */
 	int		transferhword(uint16_t *send, uint16_t *recv, unsigned len);
 
+	/**
+	 * Completion callback of a queued transfer.
+	 *
+	 * @param arg		Argument given to transfer_queued().
+	 * @param result	OK if the exchange was successful, -errno otherwise.
+	 */
+	typedef void (*transfer_callback_t)(void *arg, int result);
+
+	/**
+	 * Queue a SPI transfer on the bus.
+	 *
+	 * Pending transfers of all devices on the same bus are executed back to
+	 * back from the bus work queue, under a single bus lock and only
+	 * reconfiguring the bus when the frequency or mode changes. Devices on a
+	 * bus share a work queue, so transfers queued by drivers that run in the
+	 * same cycle (e.g. FIFO reads of several IMUs) complete in one batch.
+	 *
+	 * The buffers must stay valid until the callback is called. The callback
+	 * is called exactly once from the bus work queue, or immediately if the
+	 * bus queue is full. Must not be called from interrupt context.
+	 *
+	 * @param send		Bytes to send to the device, or nullptr if
+	 *			no data is to be sent.
+	 * @param recv		Buffer for receiving bytes from the device,
+	 *			or nullptr if no bytes are to be received.
+	 * @param len		Number of bytes to transfer.
+	 * @param callback	Called once the transfer completed.
+	 * @param arg		Argument passed to the callback.
+	 * @return		OK if the transfer was queued, -errno otherwise
+	 *			(the callback is not called).
+	 */
+	int		transfer_queued(uint8_t *send, uint8_t *recv, unsigned len, transfer_callback_t callback, void *arg);
+
 	/**
 	 * Set the SPI bus frequency
 	 * This is used to change frequency on the fly. Some sensors
@@ -169,6 +204,12 @@ private:
 
 	LockMode		_locking_mode{LOCK_THREADS};	/**< selected locking mode */
 
+	SPIBusScheduler		*_scheduler{nullptr};		/**< bus transfer queue, allocated on first use */
+
+	friend class SPIBusScheduler;
+
+	void	_configure(unsigned nbits);
+
 protected:
 	int	_transfer(uint8_t *send, uint8_t *recv, unsigned len);
 
@@ -104,6 +104,32 @@ protected:
 	 */
 	int		transfer(const uint8_t *send, const unsigned send_len, uint8_t *recv, const unsigned recv_len);
 
+	/**
+	 * Completion callback of a queued transfer.
+	 *
+	 * @param arg		Argument given to transfer_queued().
+	 * @param result	OK if the transfer was successful, -errno otherwise.
+	 */
+	typedef void (*transfer_callback_t)(void *arg, int result);
+
+	/**
+	 * Queue an I2C transaction on the bus without blocking.
+	 *
+	 * There is no bus level queue on this platform, the transfer is
+	 * executed immediately and the callback called before returning.
+	 *
+	 * @param send		Pointer to bytes to send.
+	 * @param send_len	Number of bytes to send.
+	 * @param recv		Pointer to buffer for bytes received.
+	 * @param recv_len	Number of bytes to receive.
+	 * @param callback	Called once the transfer completed.
+	 * @param arg		Argument passed to the callback.
+	 * @return		OK if the transfer was executed, -errno otherwise
+	 *			(the callback is not called).
+	 */
+	int		transfer_queued(const uint8_t *send, const unsigned send_len, uint8_t *recv, const unsigned recv_len,
+					transfer_callback_t callback, void *arg);
+
 	virtual bool	external() const override { return px4_i2c_device_external(_device_id.devid); }
 
 private:
@@ -151,6 +151,32 @@ protected:
 	 */
 	int		transferhword(uint16_t *send, uint16_t *recv, unsigned len);
 
+	/**
+	 * Completion callback of a queued transfer.
+	 *
+	 * @param arg		Argument given to transfer_queued().
+	 * @param result	OK if the exchange was successful, -errno otherwise.
+	 */
+	typedef void (*transfer_callback_t)(void *arg, int result);
+
+	/**
+	 * Queue a SPI transfer on the bus.
+	 *
+	 * There is no bus level batching on this platform, the transfer is
+	 * executed immediately and the callback called before returning.
+	 *
+	 * @param send		Bytes to send to the device, or nullptr if
+	 *			no data is to be sent.
+	 * @param recv		Buffer for receiving bytes from the device,
+	 *			or nullptr if no bytes are to be received.
+	 * @param len		Number of bytes to transfer.
+	 * @param callback	Called once the transfer completed.
+	 * @param arg		Argument passed to the callback.
+	 * @return		OK if the transfer was executed, -errno otherwise
+	 *			(the callback is not called).
+	 */
+	int		transfer_queued(uint8_t *send, uint8_t *recv, unsigned len, transfer_callback_t callback, void *arg);
+
 	/**
 	 * Set the SPI bus frequency
 	 * This is used to change frequency on the fly. Some sensors
@@ -164,6 +164,19 @@ I2C::transfer(const uint8_t *send, const unsigned send_len, uint8_t *recv, const
 	return ret;
 }
 
+int
+I2C::transfer_queued(const uint8_t *send, const unsigned send_len, uint8_t *recv, const unsigned recv_len,
+		     transfer_callback_t callback, void *arg)
+{
+	if (((send_len == 0) && (recv_len == 0)) || (callback == nullptr)) {
+		return -EINVAL;
+	}
+
+	callback(arg, transfer(send, send_len, recv, recv_len));
+
+	return PX4_OK;
+}
+
 } // namespace device
 
 #endif
@@ -172,6 +172,18 @@ SPI::transfer(uint8_t *send, uint8_t *recv, unsigned len)
 	return ret;
 }
 
+int
+SPI::transfer_queued(uint8_t *send, uint8_t *recv, unsigned len, transfer_callback_t callback, void *arg)
+{
+	if (((send == nullptr) && (recv == nullptr)) || (callback == nullptr)) {
+		return -EINVAL;
+	}
+
+	callback(arg, transfer(send, recv, len));
+
+	return PX4_OK;
+}
+
 int
 SPI::transferhword(uint16_t *send, uint16_t *recv, unsigned len)
 {
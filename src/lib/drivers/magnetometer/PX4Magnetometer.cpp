@@ -45,6 +45,7 @@ PX4Magnetometer::PX4Magnetometer(uint32_t device_id, enum Rotation rotation) :
 PX4Magnetometer::~PX4Magnetometer()
 {
 	_sensor_pub.unadvertise();
+	_sensor_fifo_pub.unadvertise();
 }
 
 void PX4Magnetometer::set_device_type(uint8_t devtype)
@@ -78,3 +79,47 @@ void PX4Magnetometer::update(const hrt_abstime &timestamp_sample, float x, float
 	report.timestamp = hrt_absolute_time();
 	_sensor_pub.publish(report);
 }
+
+void PX4Magnetometer::updateFIFO(sensor_mag_fifo_s &sample)
+{
+	const uint8_t N = math::min(sample.samples, static_cast<uint8_t>(sizeof(sample.x) / sizeof(sample.x[0])));
+
+	if (N == 0) {
+		return;
+	}
+
+	// rotate all raw samples and publish fifo
+	int32_t sum[3] {};
+
+	for (int n = 0; n < N; n++) {
+		rotate_3i(_rotation, sample.x[n], sample.y[n], sample.z[n]);
+
+		sum[0] += sample.x[n];
+		sum[1] += sample.y[n];
+		sum[2] += sample.z[n];
+	}
+
+	sample.device_id = _device_id;
+	sample.scale = _scale;
+	sample.temperature = _temperature;
+	sample.error_count = _error_count;
+	sample.samples = N;
+	sample.timestamp = hrt_absolute_time();
+	_sensor_fifo_pub.publish(sample);
+
+
+	// publish average of the burst, timestamped at its center
+	sensor_mag_s report;
+	report.timestamp_sample = sample.timestamp_sample - static_cast<hrt_abstime>(0.5f * (N - 1) * sample.dt);
+	report.device_id = _device_id;
+	report.temperature = _temperature;
+	report.error_count = _error_count;
+
+	const float scale = _scale / (float)N;
+	report.x = sum[0] * scale;
+	report.y = sum[1] * scale;
+	report.z = sum[2] * scale;
+
+	report.timestamp = hrt_absolute_time();
+	_sensor_pub.publish(report);
+}
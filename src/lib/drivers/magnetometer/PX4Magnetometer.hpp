@@ -37,6 +37,7 @@
 #include <lib/conversion/rotation.h>
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/topics/sensor_mag.h>
+#include <uORB/topics/sensor_mag_fifo.h>
 
 class PX4Magnetometer
 {
@@ -52,10 +53,17 @@ public:
 
 	void update(const hrt_abstime &timestamp_sample, float x, float y, float z);
 
+	/**
+	 * Publish a burst of raw samples read at once from the sensor FIFO (or data registers at a high output data rate).
+	 * The samples are rotated in place and published as sensor_mag_fifo, sensor_mag gets the average of the burst.
+	 */
+	void updateFIFO(sensor_mag_fifo_s &sample);
+
 	int get_instance() { return _sensor_pub.get_instance(); };
 
 private:
 	uORB::PublicationMulti<sensor_mag_s> _sensor_pub{ORB_ID(sensor_mag)};
+	uORB::PublicationMulti<sensor_mag_fifo_s> _sensor_fifo_pub{ORB_ID(sensor_mag_fifo)};
 
 	uint32_t		_device_id{0};
 	const enum Rotation	_rotation;
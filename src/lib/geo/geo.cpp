@@ -64,6 +64,20 @@ void MapProjection::initReference(double lat_0, double lon_0, uint64_t timestamp
 	_ref_init_done = true;
 }
 
+void MapProjection::project(const double lat[], const double lon[], matrix::Vector2f local[], size_t count) const
+{
+	for (size_t i = 0; i < count; i++) {
+		project(lat[i], lon[i], local[i](0), local[i](1));
+	}
+}
+
+void MapProjection::reproject(const matrix::Vector2f local[], double lat[], double lon[], size_t count) const
+{
+	for (size_t i = 0; i < count; i++) {
+		reproject(local[i](0), local[i](1), lat[i], lon[i]);
+	}
+}
+
 void MapProjection::project(double lat, double lon, float &x, float &y) const
 {
 	const double lat_rad = math::radians(lat);
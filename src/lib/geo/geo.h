@@ -46,6 +46,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include <drivers/drv_hrt.h>
@@ -261,4 +262,26 @@ public:
 	 * @param lon in degrees (8.1234567°, not 81234567°)
 	 */
 	void reproject(float x, float y, double &lat, double &lon) const;
+
+	/**
+	 * Transform an array of points in the geographic coordinate system to the local
+	 * azimuthal equidistant plane, e.g. all vertices of a geofence polygon
+	 *
+	 * @param lat array of latitudes in degrees
+	 * @param lon array of longitudes in degrees
+	 * @param local output array of points in local coordinates as north / east
+	 * @param count number of points
+	 */
+	void project(const double lat[], const double lon[], matrix::Vector2f local[], size_t count) const;
+
+	/**
+	 * Transform an array of points in the local azimuthal equidistant plane to the
+	 * geographic coordinate system
+	 *
+	 * @param local array of points in local coordinates as north / east
+	 * @param lat output array of latitudes in degrees
+	 * @param lon output array of longitudes in degrees
+	 * @param count number of points
+	 */
+	void reproject(const matrix::Vector2f local[], double lat[], double lon[], size_t count) const;
 };
@@ -92,6 +92,36 @@ TEST_F(GeoTest, projectReproject)
 	EXPECT_FLOAT_EQ(lon, lon_new);
 }
 
+TEST_F(GeoTest, projectReprojectBatch)
+{
+	// GIVEN: a set of points in the geographic coordinate system
+	static constexpr size_t count = 5;
+	const double lat[count] = {47.356616973876953, 47.3566094, 47.36, 47.35, 47.4};
+	const double lon[count] = {8.5190505981445313, 8.5190237, 8.52, 8.51, 8.6};
+
+	// WHEN: projecting and reprojecting them as a batch
+	matrix::Vector2f local[count];
+	proj.project(lat, lon, local, count);
+	double lat_new[count];
+	double lon_new[count];
+	proj.reproject(local, lat_new, lon_new, count);
+
+	// THEN: the results should match the single point mapping
+	for (size_t i = 0; i < count; i++) {
+		float x;
+		float y;
+		proj.project(lat[i], lon[i], x, y);
+		EXPECT_EQ(x, local[i](0));
+		EXPECT_EQ(y, local[i](1));
+
+		double lat_single;
+		double lon_single;
+		proj.reproject(x, y, lat_single, lon_single);
+		EXPECT_EQ(lat_single, lat_new[i]);
+		EXPECT_EQ(lon_single, lon_new[i]);
+	}
+}
+
 TEST_F(GeoTest, waypoint_from_heading_and_zero_distance)
 {
 	// GIVEN: a starting waypoint, a heading and a distance of 0
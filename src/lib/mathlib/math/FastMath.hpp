@@ -0,0 +1,223 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file FastMath.hpp
+ *
+ * Bounded error approximations of the trigonometric functions used in the
+ * fixed-wing guidance loops.
+ *
+ * The *_approx() functions are always approximated, the *_fast() functions
+ * only if MATHLIB_FAST_MATH is defined (Kconfig LIB_MATHLIB_FAST_MATH) and
+ * fall back to the C library otherwise, so callers can use them unconditionally.
+ *
+ * Maximum absolute errors (see FastMathTest.cpp):
+ * - sin_approx(), cos_approx(), sincos_approx(): 2e-7 for |x| < 1000
+ * - atan_approx(), atan2_approx(): 2e-6 rad
+ *
+ * There is no sqrt approximation: targets with an FPU execute sqrtf() as a
+ * single instruction, which no approximation beats.
+ */
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+#include <px4_platform_common/defines.h>
+
+namespace math
+{
+
+/**
+ * Sine and cosine of an angle
+ *
+ * Reduces the angle to [-pi/4, pi/4] and evaluates the Taylor polynomials of
+ * degree 9 (sine) and 8 (cosine). Falls back to sinf() and cosf() for
+ * |x| >= 8192 and non-finite x.
+ *
+ * @param x angle [rad]
+ * @param sin_x sine of x
+ * @param cos_x cosine of x
+ */
+inline void sincos_approx(float x, float &sin_x, float &cos_x)
+{
+	if (!(fabsf(x) < 8192.f)) {
+		sin_x = sinf(x);
+		cos_x = cosf(x);
+		return;
+	}
+
+	// pi/2 split into three parts with few significant bits each, so that the products
+	// with the quadrant number are exact and the reduction does not lose precision
+	static constexpr float PI_2_A = 1.5703125f;
+	static constexpr float PI_2_B = 4.837512969970703125e-4f;
+	static constexpr float PI_2_C = 7.54978995489188216e-8f;
+
+	const int32_t quadrant = static_cast<int32_t>(x * M_2_PI_F + ((x < 0.f) ? -0.5f : 0.5f));
+	const float q = static_cast<float>(quadrant);
+	const float r = ((x - q * PI_2_A) - q * PI_2_B) - q * PI_2_C;
+	const float r2 = r * r;
+
+	const float s = r + r * r2 * (-1.f / 6.f + r2 * (1.f / 120.f + r2 * (-1.f / 5040.f + r2 * (1.f / 362880.f))));
+	const float c = 1.f + r2 * (-0.5f + r2 * (1.f / 24.f + r2 * (-1.f / 720.f + r2 * (1.f / 40320.f))));
+
+	switch (quadrant & 3) {
+	case 0:
+		sin_x = s;
+		cos_x = c;
+		break;
+
+	case 1:
+		sin_x = c;
+		cos_x = -s;
+		break;
+
+	case 2:
+		sin_x = -s;
+		cos_x = -c;
+		break;
+
+	default:
+		sin_x = -c;
+		cos_x = s;
+		break;
+	}
+}
+
+inline float sin_approx(float x)
+{
+	float sin_x;
+	float cos_x;
+	sincos_approx(x, sin_x, cos_x);
+	return sin_x;
+}
+
+inline float cos_approx(float x)
+{
+	float sin_x;
+	float cos_x;
+	sincos_approx(x, sin_x, cos_x);
+	return cos_x;
+}
+
+/**
+ * Arc tangent of t in [0, 1]
+ *
+ * Minimax polynomial of degree 11 (Abramowitz & Stegun 4.4.49 form).
+ */
+inline float atan_unit_approx(float t)
+{
+	const float t2 = t * t;
+	return t * (0.99997726f + t2 * (-0.33262347f + t2 * (0.19354346f + t2 * (-0.11643287f + t2 *
+			(0.05265332f + t2 * -0.01172120f)))));
+}
+
+/**
+ * Arc tangent
+ *
+ * @param x argument
+ * @return atan(x) in [-pi/2, pi/2]
+ */
+inline float atan_approx(float x)
+{
+	const float abs_x = fabsf(x);
+	float a;
+
+	if (abs_x > 1.f) {
+		a = M_PI_2_F - atan_unit_approx(1.f / abs_x);
+
+	} else {
+		a = atan_unit_approx(abs_x);
+	}
+
+	return copysignf(a, x);
+}
+
+/**
+ * Four-quadrant arc tangent
+ *
+ * Falls back to atan2f() if both arguments are zero, or either is infinite or NaN.
+ *
+ * @param y ordinate
+ * @param x abscissa
+ * @return atan2(y, x) in [-pi, pi]
+ */
+inline float atan2_approx(float y, float x)
+{
+	const float abs_x = fabsf(x);
+	const float abs_y = fabsf(y);
+	const float abs_max = (abs_x > abs_y) ? abs_x : abs_y;
+	const float abs_min = (abs_x > abs_y) ? abs_y : abs_x;
+
+	if (!(abs_max > 0.f) || !(abs_max < INFINITY)) {
+		return atan2f(y, x);
+	}
+
+	float a = atan_unit_approx(abs_min / abs_max);
+
+	if (abs_y > abs_x) {
+		a = M_PI_2_F - a;
+	}
+
+	if (x < 0.f) {
+		a = M_PI_F - a;
+	}
+
+	return copysignf(a, y);
+}
+
+#if defined(MATHLIB_FAST_MATH)
+
+inline void sincos_fast(float x, float &sin_x, float &cos_x) { sincos_approx(x, sin_x, cos_x); }
+inline float sin_fast(float x) { return sin_approx(x); }
+inline float cos_fast(float x) { return cos_approx(x); }
+inline float atan_fast(float x) { return atan_approx(x); }
+inline float atan2_fast(float y, float x) { return atan2_approx(y, x); }
+
+#else
+
+inline void sincos_fast(float x, float &sin_x, float &cos_x)
+{
+	sin_x = sinf(x);
+	cos_x = cosf(x);
+}
+
+inline float sin_fast(float x) { return sinf(x); }
+inline float cos_fast(float x) { return cosf(x); }
+inline float atan_fast(float x) { return atanf(x); }
+inline float atan2_fast(float y, float x) { return atan2f(y, x); }
+
+#endif // MATHLIB_FAST_MATH
+
+} // namespace math
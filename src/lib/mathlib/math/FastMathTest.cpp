@@ -0,0 +1,109 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "FastMath.hpp"
+
+using namespace math;
+
+TEST(FastMathTest, sincos)
+{
+	float max_error = 0.f;
+
+	for (float x = -1000.f; x < 1000.f; x += 0.0123f) {
+		float sin_x;
+		float cos_x;
+		sincos_approx(x, sin_x, cos_x);
+		max_error = fmaxf(max_error, fabsf(sin_x - static_cast<float>(sin(static_cast<double>(x)))));
+		max_error = fmaxf(max_error, fabsf(cos_x - static_cast<float>(cos(static_cast<double>(x)))));
+	}
+
+	EXPECT_LT(max_error, 2e-7f);
+
+	// exact at the quadrant boundaries that matter for setpoints
+	EXPECT_FLOAT_EQ(sin_approx(0.f), 0.f);
+	EXPECT_FLOAT_EQ(cos_approx(0.f), 1.f);
+	EXPECT_NEAR(sin_approx(M_PI_2_F), 1.f, 1e-7f);
+	EXPECT_NEAR(cos_approx(M_PI_F), -1.f, 1e-7f);
+
+	// fallback outside the reduction range
+	EXPECT_FLOAT_EQ(sin_approx(1e6f), sinf(1e6f));
+	EXPECT_TRUE(std::isnan(sin_approx(NAN)));
+	EXPECT_TRUE(std::isnan(cos_approx(INFINITY)));
+}
+
+TEST(FastMathTest, atan)
+{
+	float max_error = 0.f;
+
+	for (float x = -100.f; x < 100.f; x += 0.00731f) {
+		max_error = fmaxf(max_error, fabsf(atan_approx(x) - static_cast<float>(atan(static_cast<double>(x)))));
+	}
+
+	EXPECT_LT(max_error, 2e-6f);
+
+	EXPECT_FLOAT_EQ(atan_approx(0.f), 0.f);
+	EXPECT_NEAR(atan_approx(INFINITY), M_PI_2_F, 1e-7f);
+	EXPECT_NEAR(atan_approx(-INFINITY), -M_PI_2_F, 1e-7f);
+	EXPECT_TRUE(std::isnan(atan_approx(NAN)));
+}
+
+TEST(FastMathTest, atan2)
+{
+	float max_error = 0.f;
+
+	for (float y = -10.f; y < 10.f; y += 0.0371f) {
+		for (float x = -10.f; x < 10.f; x += 0.0293f) {
+			const float expected = static_cast<float>(atan2(static_cast<double>(y), static_cast<double>(x)));
+			max_error = fmaxf(max_error, fabsf(atan2_approx(y, x) - expected));
+		}
+	}
+
+	EXPECT_LT(max_error, 2e-6f);
+
+	// quadrants and axes
+	EXPECT_NEAR(atan2_approx(1.f, 1.f), M_PI_4_F, 2e-6f);
+	EXPECT_NEAR(atan2_approx(1.f, -1.f), 3.f * M_PI_4_F, 2e-6f);
+	EXPECT_NEAR(atan2_approx(-1.f, -1.f), -3.f * M_PI_4_F, 2e-6f);
+	EXPECT_NEAR(atan2_approx(-1.f, 1.f), -M_PI_4_F, 2e-6f);
+	EXPECT_NEAR(atan2_approx(0.f, -1.f), M_PI_F, 2e-6f);
+	EXPECT_NEAR(atan2_approx(-0.f, -1.f), -M_PI_F, 2e-6f);
+	EXPECT_NEAR(atan2_approx(2.f, 0.f), M_PI_2_F, 2e-6f);
+
+	// same as the C library where the approximation does not apply
+	EXPECT_FLOAT_EQ(atan2_approx(0.f, 0.f), atan2f(0.f, 0.f));
+	EXPECT_FLOAT_EQ(atan2_approx(0.f, -0.f), atan2f(0.f, -0.f));
+	EXPECT_FLOAT_EQ(atan2_approx(INFINITY, 1.f), atan2f(INFINITY, 1.f));
+	EXPECT_TRUE(std::isnan(atan2_approx(NAN, 1.f)));
+}
@@ -0,0 +1,203 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file FixedPoint.hpp
+ *
+ * Q15 (int16_t) and Q31 (int32_t) fixed-point arithmetic with saturation for
+ * targets without FPU (px4io, CAN nodes on Cortex-M0/M3).
+ *
+ * A Q15/Q31 value x represents x / 2^15 or x / 2^31, i.e. [-1, 1). Products
+ * are computed in the double width accumulator type (int32_t/int64_t) and
+ * rounded back. Conversions from float are only meant for configuration,
+ * not for the per-sample path.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace math
+{
+
+using q15_t = int16_t;
+using q31_t = int32_t;
+
+template<typename Q>
+struct FixedPointTraits;
+
+template<>
+struct FixedPointTraits<int16_t> {
+	using acc_t = int32_t;
+	static constexpr int FRAC_BITS = 15;
+	static constexpr int16_t MAX = INT16_MAX;
+	static constexpr int16_t MIN = INT16_MIN;
+};
+
+template<>
+struct FixedPointTraits<int32_t> {
+	using acc_t = int64_t;
+	static constexpr int FRAC_BITS = 31;
+	static constexpr int32_t MAX = INT32_MAX;
+	static constexpr int32_t MIN = INT32_MIN;
+};
+
+template<typename Q>
+using fixed_acc_t = typename FixedPointTraits<Q>::acc_t;
+
+/**
+ * Clamp an accumulator value to the range of Q.
+ */
+template<typename Q>
+inline constexpr Q saturate(fixed_acc_t<Q> x)
+{
+	return (x > FixedPointTraits<Q>::MAX) ? FixedPointTraits<Q>::MAX :
+	       ((x < FixedPointTraits<Q>::MIN) ? FixedPointTraits<Q>::MIN : static_cast<Q>(x));
+}
+
+/**
+ * Arithmetic shift right with rounding to nearest.
+ */
+template<typename T>
+inline constexpr T shiftRightRound(T x, int shift)
+{
+	return (shift > 0) ? ((x + (static_cast<T>(1) << (shift - 1))) >> shift) : x;
+}
+
+template<typename Q>
+inline constexpr Q addSat(Q a, Q b)
+{
+	return saturate<Q>(static_cast<fixed_acc_t<Q>>(a) + b);
+}
+
+template<typename Q>
+inline constexpr Q subSat(Q a, Q b)
+{
+	return saturate<Q>(static_cast<fixed_acc_t<Q>>(a) - b);
+}
+
+template<typename Q>
+inline constexpr Q mulSat(Q a, Q b)
+{
+	return saturate<Q>(shiftRightRound<fixed_acc_t<Q>>(static_cast<fixed_acc_t<Q>>(a) * b, FixedPointTraits<Q>::FRAC_BITS));
+}
+
+/**
+ * Convert a float to fixed-point with frac_bits fractional bits, rounded and saturated.
+ */
+template<typename Q>
+inline Q toFixed(float x, int frac_bits = FixedPointTraits<Q>::FRAC_BITS)
+{
+	const float scaled = x * static_cast<float>(static_cast<fixed_acc_t<Q>>(1) << frac_bits);
+
+	if (!(scaled == scaled)) {
+		// NaN
+		return 0;
+
+	} else if (scaled >= static_cast<float>(FixedPointTraits<Q>::MAX)) {
+		return FixedPointTraits<Q>::MAX;
+
+	} else if (scaled <= static_cast<float>(FixedPointTraits<Q>::MIN)) {
+		return FixedPointTraits<Q>::MIN;
+	}
+
+	return static_cast<Q>(scaled + ((scaled >= 0.f) ? 0.5f : -0.5f));
+}
+
+template<typename Q>
+inline float toFloat(Q x, int frac_bits = FixedPointTraits<Q>::FRAC_BITS)
+{
+	return static_cast<float>(x) / static_cast<float>(static_cast<fixed_acc_t<Q>>(1) << frac_bits);
+}
+
+/**
+ * Gain of arbitrary magnitude as Q mantissa and binary exponent (gain = mantissa / 2^shift),
+ * so small and large gains keep the full relative precision of Q.
+ */
+template<typename Q>
+struct FixedGain {
+	Q mantissa{0};
+	int8_t shift{0};
+
+	/**
+	 * @param gain the gain, |gain| < 2^(FRAC_BITS - min_shift)
+	 * @param min_shift lower bound of shift, limits the range of the gain (saturated)
+	 */
+	static FixedGain fromFloat(float gain, int min_shift = 0)
+	{
+		constexpr int FRAC_BITS = FixedPointTraits<Q>::FRAC_BITS;
+
+		FixedGain g{};
+		g.shift = static_cast<int8_t>(min_shift);
+
+		const float magnitude = (gain >= 0.f) ? gain : -gain;
+
+		if (!(magnitude > 0.f)) {
+			// zero or NaN
+			return g;
+		}
+
+		float scale = 1.f; // 2^shift
+
+		for (int i = 0; i < min_shift; i++) {
+			scale *= 2.f;
+		}
+
+		const float limit = static_cast<float>(FixedPointTraits<Q>::MAX);
+
+		// largest shift for which the mantissa still fits, at most 2 * FRAC_BITS (smaller gains round to zero)
+		while ((g.shift < 2 * FRAC_BITS) && (magnitude * scale * 2.f < limit)) {
+			scale *= 2.f;
+			g.shift++;
+		}
+
+		g.mantissa = toFixed<Q>(gain, g.shift);
+		return g;
+	}
+
+	bool zero() const { return mantissa == 0; }
+
+	/**
+	 * gain * x, with the result not saturated and out_frac_bits fractional bits
+	 * (out_frac_bits <= FRAC_BITS + shift).
+	 */
+	fixed_acc_t<Q> apply(Q x, int out_frac_bits = FixedPointTraits<Q>::FRAC_BITS) const
+	{
+		return shiftRightRound<fixed_acc_t<Q>>(static_cast<fixed_acc_t<Q>>(mantissa) * x,
+						       FixedPointTraits<Q>::FRAC_BITS + shift - out_frac_bits);
+	}
+
+	float toFloat() const { return math::toFloat<Q>(mantissa, shift); }
+};
+
+} // namespace math
@@ -0,0 +1,130 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file SlidingWindow.hpp
+ *
+ * Mean and variance over the last N samples in constant time per sample.
+ */
+
+#pragma once
+
+#include <lib/mathlib/mathlib.h>
+
+namespace math
+{
+
+template <typename Type, size_t N>
+class SlidingWindow
+{
+	static_assert(N > 1, "window needs at least two samples");
+
+public:
+	void update(const Type &new_value)
+	{
+		if (_count == 0) {
+			_shift = new_value;
+		}
+
+		if (full()) {
+			const Type oldest = _buffer[_index] - _shift;
+			_sum -= oldest;
+			_sum_sq -= oldest * oldest;
+
+		} else {
+			_count++;
+		}
+
+		_buffer[_index] = new_value;
+
+		const Type newest = new_value - _shift;
+		_sum += newest;
+		_sum_sq += newest * newest;
+
+		_index++;
+
+		if (_index == N) {
+			_index = 0;
+
+			// Recompute the sums around the current mean once per window. This keeps the running sums from
+			// drifting and the shifted sums small, which avoids cancellation in the variance. It is O(N)
+			// every N samples and therefore still constant time per sample.
+			_shift = mean();
+			_sum = 0;
+			_sum_sq = 0;
+
+			for (size_t i = 0; i < N; i++) {
+				const Type value = _buffer[i] - _shift;
+				_sum += value;
+				_sum_sq += value * value;
+			}
+		}
+	}
+
+	void reset()
+	{
+		_index = 0;
+		_count = 0;
+		_shift = 0;
+		_sum = 0;
+		_sum_sq = 0;
+	}
+
+	bool full() const { return _count == N; }
+	size_t count() const { return _count; }
+
+	Type mean() const { return (_count > 0) ? _shift + _sum / _count : Type{0}; }
+
+	Type variance() const
+	{
+		if (_count < 2) {
+			return Type{0};
+		}
+
+		// protect against floating point precision causing negative variances
+		return math::max((_sum_sq - _sum * _sum / _count) / (_count - 1), Type{0});
+	}
+
+	Type standard_deviation() const { return std::sqrt(variance()); }
+
+private:
+	Type _buffer[N] {};
+	Type _shift{0};		///< samples are accumulated relative to this value
+	Type _sum{0};
+	Type _sum_sq{0};
+
+	size_t _index{0};
+	size_t _count{0};
+};
+
+} // namespace math
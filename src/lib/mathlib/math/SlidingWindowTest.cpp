@@ -0,0 +1,101 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <random>
+#include "SlidingWindow.hpp"
+
+using namespace math;
+
+TEST(SlidingWindowTest, Empty)
+{
+	SlidingWindow<float, 8> window{};
+	EXPECT_FALSE(window.full());
+	EXPECT_EQ(window.count(), 0u);
+	EXPECT_FLOAT_EQ(window.mean(), 0.f);
+	EXPECT_FLOAT_EQ(window.variance(), 0.f);
+}
+
+TEST(SlidingWindowTest, PartiallyFilled)
+{
+	SlidingWindow<float, 8> window{};
+	window.update(1.f);
+	window.update(2.f);
+	window.update(3.f);
+
+	EXPECT_FALSE(window.full());
+	EXPECT_EQ(window.count(), 3u);
+	EXPECT_FLOAT_EQ(window.mean(), 2.f);
+	EXPECT_FLOAT_EQ(window.variance(), 1.f);
+}
+
+TEST(SlidingWindowTest, OldSamplesDropOut)
+{
+	SlidingWindow<float, 4> window{};
+
+	for (int i = 0; i < 10; i++) {
+		window.update(100.f);
+	}
+
+	// only the last 4 samples are in the window
+	for (int i = 0; i < 4; i++) {
+		window.update(static_cast<float>(i));
+	}
+
+	EXPECT_TRUE(window.full());
+	EXPECT_EQ(window.count(), 4u);
+	EXPECT_FLOAT_EQ(window.mean(), 1.5f);
+	EXPECT_NEAR(window.variance(), 5.f / 3.f, 1e-5f);
+
+	window.reset();
+	EXPECT_EQ(window.count(), 0u);
+	EXPECT_FLOAT_EQ(window.mean(), 0.f);
+}
+
+TEST(SlidingWindowTest, NoisySignalWithOffset)
+{
+	const float offset = 1000.f;
+	const float std_dev = 0.5f;
+	std::normal_distribution<float> standard_normal_distribution{0.f, std_dev};
+	std::default_random_engine random_generator{}; // Pseudo-random generator with constant seed
+	random_generator.seed(42);
+	SlidingWindow<float, 256> window{};
+
+	// long run to check that the running sums do not drift
+	for (int i = 0; i < 100000; i++) {
+		window.update(offset + standard_normal_distribution(random_generator));
+	}
+
+	EXPECT_NEAR(window.mean(), offset, 0.1f);
+	EXPECT_NEAR(window.standard_deviation(), std_dev, 0.1f);
+}
@@ -0,0 +1,313 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/*
+ * @file BiquadFilterBank.hpp
+ *
+ * @brief Cascade of 3 axis biquad filters (NotchFilter, LowPassFilter2p) processed
+ * for all axes at once.
+ *
+ * The samples of the 3 axes are interleaved (structure of arrays, one lane per axis)
+ * so that every filter stage runs as a single 4 lane operation, using SIMD when the
+ * matrix library kernels are enabled (MATRIX_SIMD). The filters themselves keep their
+ * parameters and state, each stage loads them, filters all samples and stores them back.
+ * Results are the same as calling applyArray() of every filter on every axis.
+ */
+
+#pragma once
+
+#include "LowPassFilter2p.hpp"
+#include "NotchFilter.hpp"
+
+#include <matrix/simd.hpp>
+
+namespace math
+{
+
+template<int MAX_SAMPLES>
+class BiquadFilterBank
+{
+public:
+	BiquadFilterBank() = default;
+	~BiquadFilterBank() = default;
+
+	// load (interleave) the samples of all axes
+	void load(const float *const samples[3], int num_samples)
+	{
+		_num_samples = math::min(num_samples, MAX_SAMPLES);
+
+		for (int n = 0; n < _num_samples; n++) {
+			for (int axis = 0; axis < 3; axis++) {
+				_buffer[n][axis] = samples[axis][n];
+			}
+
+			_buffer[n][3] = 0.f;
+		}
+	}
+
+	// store (deinterleave) the filtered samples of all axes
+	void store(float *const samples[3]) const
+	{
+		for (int n = 0; n < _num_samples; n++) {
+			for (int axis = 0; axis < 3; axis++) {
+				samples[axis][n] = _buffer[n][axis];
+			}
+		}
+	}
+
+	// last filtered sample of an axis
+	float newest(int axis) const { return (_num_samples > 0) ? _buffer[_num_samples - 1][axis] : 0.f; }
+
+	/**
+	 * Apply one notch filter per axis to all loaded samples (Direct Form I)
+	 *
+	 * @param filters notch filter per axis, nullptr to leave an axis unfiltered
+	 */
+	void apply(NotchFilter<float> *const filters[3])
+	{
+		if (_num_samples <= 0) {
+			return;
+		}
+
+		Coefficients c{};
+		float x1[4] {}, x2[4] {}, y1[4] {}, y2[4] {};
+
+		for (int axis = 0; axis < 3; axis++) {
+			NotchFilter<float> *f = filters[axis];
+
+			if (f) {
+				if (!f->_initialized) {
+					f->reset(_buffer[0][axis]);
+				}
+
+				c.b0[axis] = f->_b0;
+				c.b1[axis] = f->_b1;
+				c.b2[axis] = f->_b2;
+				c.a1[axis] = f->_a1;
+				c.a2[axis] = f->_a2;
+
+				x1[axis] = f->_delay_element_1;
+				x2[axis] = f->_delay_element_2;
+				y1[axis] = f->_delay_element_output_1;
+				y2[axis] = f->_delay_element_output_2;
+			}
+		}
+
+		applyDirectFormI(c, x1, x2, y1, y2);
+
+		for (int axis = 0; axis < 3; axis++) {
+			NotchFilter<float> *f = filters[axis];
+
+			if (f) {
+				f->_delay_element_1 = x1[axis];
+				f->_delay_element_2 = x2[axis];
+				f->_delay_element_output_1 = y1[axis];
+				f->_delay_element_output_2 = y2[axis];
+			}
+		}
+	}
+
+	// Apply a notch filter per axis, disabled filters (notch frequency 0) leave their axis unfiltered
+	void apply(NotchFilter<float> &x, NotchFilter<float> &y, NotchFilter<float> &z)
+	{
+		NotchFilter<float> *const filters[3] {
+			(x.getNotchFreq() > 0.f) ? &x : nullptr,
+			(y.getNotchFreq() > 0.f) ? &y : nullptr,
+			(z.getNotchFreq() > 0.f) ? &z : nullptr,
+		};
+
+		if (filters[0] || filters[1] || filters[2]) {
+			apply(filters);
+		}
+	}
+
+	/**
+	 * Apply one low-pass filter per axis to all loaded samples (Direct Form II)
+	 *
+	 * @param filters low-pass filter per axis, nullptr to leave an axis unfiltered
+	 */
+	void apply(LowPassFilter2p<float> *const filters[3])
+	{
+		if (_num_samples <= 0) {
+			return;
+		}
+
+		Coefficients c{};
+		float d1[4] {}, d2[4] {};
+
+		for (int axis = 0; axis < 3; axis++) {
+			LowPassFilter2p<float> *f = filters[axis];
+
+			if (f) {
+				c.b0[axis] = f->_b0;
+				c.b1[axis] = f->_b1;
+				c.b2[axis] = f->_b2;
+				c.a1[axis] = f->_a1;
+				c.a2[axis] = f->_a2;
+
+				d1[axis] = f->_delay_element_1;
+				d2[axis] = f->_delay_element_2;
+			}
+		}
+
+		applyDirectFormII(c, d1, d2);
+
+		for (int axis = 0; axis < 3; axis++) {
+			LowPassFilter2p<float> *f = filters[axis];
+
+			if (f) {
+				f->_delay_element_1 = d1[axis];
+				f->_delay_element_2 = d2[axis];
+			}
+		}
+	}
+
+private:
+
+	// unused lanes pass the samples through unchanged (b0 = 1)
+	struct Coefficients {
+		float b0[4] {1.f, 1.f, 1.f, 1.f};
+		float b1[4] {};
+		float b2[4] {};
+		float a1[4] {};
+		float a2[4] {};
+	};
+
+#if defined(MATRIX_SIMD_ARM) || defined(MATRIX_SIMD_SSE)
+
+	void applyDirectFormI(const Coefficients &c, float x1_[4], float x2_[4], float y1_[4], float y2_[4])
+	{
+		using matrix::simd::float4;
+		using matrix::simd::add;
+		using matrix::simd::sub;
+		using matrix::simd::mul;
+
+		const float4 b0 = matrix::simd::load(c.b0);
+		const float4 b1 = matrix::simd::load(c.b1);
+		const float4 b2 = matrix::simd::load(c.b2);
+		const float4 a1 = matrix::simd::load(c.a1);
+		const float4 a2 = matrix::simd::load(c.a2);
+
+		float4 x1 = matrix::simd::load(x1_);
+		float4 x2 = matrix::simd::load(x2_);
+		float4 y1 = matrix::simd::load(y1_);
+		float4 y2 = matrix::simd::load(y2_);
+
+		for (int n = 0; n < _num_samples; n++) {
+			const float4 x = matrix::simd::load(_buffer[n]);
+			const float4 y = sub(sub(add(add(mul(b0, x), mul(b1, x1)), mul(b2, x2)), mul(a1, y1)), mul(a2, y2));
+
+			x2 = x1;
+			x1 = x;
+			y2 = y1;
+			y1 = y;
+
+			matrix::simd::store(_buffer[n], y);
+		}
+
+		matrix::simd::store(x1_, x1);
+		matrix::simd::store(x2_, x2);
+		matrix::simd::store(y1_, y1);
+		matrix::simd::store(y2_, y2);
+	}
+
+	void applyDirectFormII(const Coefficients &c, float d1_[4], float d2_[4])
+	{
+		using matrix::simd::float4;
+		using matrix::simd::add;
+		using matrix::simd::sub;
+		using matrix::simd::mul;
+
+		const float4 b0 = matrix::simd::load(c.b0);
+		const float4 b1 = matrix::simd::load(c.b1);
+		const float4 b2 = matrix::simd::load(c.b2);
+		const float4 a1 = matrix::simd::load(c.a1);
+		const float4 a2 = matrix::simd::load(c.a2);
+
+		float4 d1 = matrix::simd::load(d1_);
+		float4 d2 = matrix::simd::load(d2_);
+
+		for (int n = 0; n < _num_samples; n++) {
+			const float4 d0 = sub(sub(matrix::simd::load(_buffer[n]), mul(d1, a1)), mul(d2, a2));
+			const float4 y = add(add(mul(d0, b0), mul(d1, b1)), mul(d2, b2));
+
+			d2 = d1;
+			d1 = d0;
+
+			matrix::simd::store(_buffer[n], y);
+		}
+
+		matrix::simd::store(d1_, d1);
+		matrix::simd::store(d2_, d2);
+	}
+
+#else
+
+	void applyDirectFormI(const Coefficients &c, float x1[4], float x2[4], float y1[4], float y2[4])
+	{
+		for (int n = 0; n < _num_samples; n++) {
+			for (int i = 0; i < 4; i++) {
+				const float x = _buffer[n][i];
+				const float y = c.b0[i] * x + c.b1[i] * x1[i] + c.b2[i] * x2[i] - c.a1[i] * y1[i] - c.a2[i] * y2[i];
+
+				x2[i] = x1[i];
+				x1[i] = x;
+				y2[i] = y1[i];
+				y1[i] = y;
+
+				_buffer[n][i] = y;
+			}
+		}
+	}
+
+	void applyDirectFormII(const Coefficients &c, float d1[4], float d2[4])
+	{
+		for (int n = 0; n < _num_samples; n++) {
+			for (int i = 0; i < 4; i++) {
+				const float d0 = _buffer[n][i] - d1[i] * c.a1[i] - d2[i] * c.a2[i];
+
+				_buffer[n][i] = d0 * c.b0[i] + d1[i] * c.b1[i] + d2[i] * c.b2[i];
+
+				d2[i] = d1[i];
+				d1[i] = d0;
+			}
+		}
+	}
+
+#endif
+
+	alignas(16) float _buffer[MAX_SAMPLES][4] {};
+	int _num_samples{0};
+};
+
+} // namespace math
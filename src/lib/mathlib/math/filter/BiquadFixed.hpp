@@ -0,0 +1,181 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file BiquadFixed.hpp
+ *
+ * Second order IIR filter in Q15/Q31 fixed-point (Direct Form I) for targets without FPU.
+ * Coefficients are computed in float when the filter is configured and stored with
+ * 2 integer bits, samples and states are Q15/Q31. The rounding error of the output
+ * is fed back to the next sample, which keeps filters with a low cutoff frequency
+ * relative to the sample rate accurate.
+ */
+
+#pragma once
+
+#include <float.h>
+#include <math.h>
+
+#include <mathlib/math/FixedPoint.hpp>
+
+namespace math
+{
+
+template<typename Q>
+class BiquadFixed
+{
+public:
+	using acc_t = fixed_acc_t<Q>;
+
+	// coefficients are in [-4, 4)
+	static constexpr int COEFF_FRAC_BITS = FixedPointTraits<Q>::FRAC_BITS - 2;
+
+	/**
+	 * Set the coefficients (normalized by a0). They must describe a stable filter with
+	 * |a1| < 2, |a2| < 1 and |b0| + |b1| + |b2| <= 4 so that the accumulator cannot overflow.
+	 *
+	 * @return false if the coefficients are out of range, the filter is disabled then
+	 */
+	bool setCoefficients(float a1, float a2, float b0, float b1, float b2)
+	{
+		const float b_sum = fabsf(b0) + fabsf(b1) + fabsf(b2);
+
+		if (!(fabsf(a1) < 2.f) || !(fabsf(a2) < 1.f) || !(b_sum <= 4.f)) {
+			disable();
+			return false;
+		}
+
+		_a1 = toFixed<Q>(a1, COEFF_FRAC_BITS);
+		_a2 = toFixed<Q>(a2, COEFF_FRAC_BITS);
+		_b0 = toFixed<Q>(b0, COEFF_FRAC_BITS);
+		_b1 = toFixed<Q>(b1, COEFF_FRAC_BITS);
+		_b2 = toFixed<Q>(b2, COEFF_FRAC_BITS);
+
+		const float a_sum = 1.f + a1 + a2;
+
+		if (fabsf(a_sum) > FLT_EPSILON) {
+			const float dc_gain = (b0 + b1 + b2) / a_sum;
+			_dc_gain = toFixed<Q>(dc_gain, COEFF_FRAC_BITS);
+
+			// adjust b1 so that the rounded coefficients keep the DC gain, otherwise a low
+			// cutoff low pass filter has a constant offset of up to a few percent
+			const acc_t a_sum_fixed = (static_cast<acc_t>(1) << COEFF_FRAC_BITS) + _a1 + _a2;
+			const acc_t b_sum_fixed = static_cast<acc_t>(dc_gain * static_cast<float>(a_sum_fixed) + 0.5f);
+			_b1 = saturate<Q>(b_sum_fixed - _b0 - _b2);
+
+		} else {
+			_dc_gain = 0;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Add a new raw value to the filter
+	 *
+	 * @return retrieve the filtered result
+	 */
+	inline Q apply(Q sample)
+	{
+		const acc_t acc = static_cast<acc_t>(_b0) * sample + static_cast<acc_t>(_b1) * _x1 + static_cast<acc_t>(_b2) * _x2
+				  - static_cast<acc_t>(_a1) * _y1 - static_cast<acc_t>(_a2) * _y2 + _error;
+
+		// floor, the remainder is added to the next sample
+		const acc_t shifted = acc >> COEFF_FRAC_BITS;
+		const Q output = saturate<Q>(shifted);
+
+		_error = (output == shifted) ? (acc - shifted * (static_cast<acc_t>(1) << COEFF_FRAC_BITS)) : 0;
+
+		_x2 = _x1;
+		_x1 = sample;
+
+		_y2 = _y1;
+		_y1 = output;
+
+		return output;
+	}
+
+	// Filter array of samples in place
+	inline void applyArray(Q samples[], int num_samples)
+	{
+		for (int n = 0; n < num_samples; n++) {
+			samples[n] = apply(samples[n]);
+		}
+	}
+
+	// Reset the filter state to the steady state of this input value
+	void reset(Q sample)
+	{
+		_x1 = _x2 = sample;
+		_y1 = _y2 = saturate<Q>(shiftRightRound<acc_t>(static_cast<acc_t>(_dc_gain) * sample, COEFF_FRAC_BITS));
+		_error = 0;
+	}
+
+	void disable()
+	{
+		// no filtering
+		_a1 = 0;
+		_a2 = 0;
+		_b0 = toFixed<Q>(1.f, COEFF_FRAC_BITS);
+		_b1 = 0;
+		_b2 = 0;
+		_dc_gain = _b0;
+
+		reset(0);
+	}
+
+	float getA1() const { return toFloat<Q>(_a1, COEFF_FRAC_BITS); }
+	float getA2() const { return toFloat<Q>(_a2, COEFF_FRAC_BITS); }
+	float getB0() const { return toFloat<Q>(_b0, COEFF_FRAC_BITS); }
+	float getB1() const { return toFloat<Q>(_b1, COEFF_FRAC_BITS); }
+	float getB2() const { return toFloat<Q>(_b2, COEFF_FRAC_BITS); }
+
+protected:
+	Q _x1{0}; // input sample -1
+	Q _x2{0}; // input sample -2
+	Q _y1{0}; // output sample -1
+	Q _y2{0}; // output sample -2
+	acc_t _error{0}; // rounding error of the last output
+
+	// All the coefficients are normalized by a0, so a0 becomes 1 here
+	Q _a1{0};
+	Q _a2{0};
+
+	Q _b0{static_cast<Q>(static_cast<acc_t>(1) << COEFF_FRAC_BITS)};
+	Q _b1{0};
+	Q _b2{0};
+
+	Q _dc_gain{static_cast<Q>(static_cast<acc_t>(1) << COEFF_FRAC_BITS)};
+};
+
+} // namespace math
@@ -45,6 +45,9 @@
 namespace math
 {
 
+template<int MAX_SAMPLES>
+class BiquadFilterBank;
+
 template<typename T>
 class LowPassFilter2p
 {
@@ -161,6 +164,9 @@ public:
 	}
 
 protected:
+	// runs the filter on several axes at once
+	template<int MAX_SAMPLES> friend class BiquadFilterBank;
+
 	T _delay_element_1{}; // buffered sample -1
 	T _delay_element_2{}; // buffered sample -2
 
@@ -0,0 +1,124 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file LowPassFilter2pFixed.hpp
+ *
+ * Second order Butterworth low pass filter (see LowPassFilter2p) on Q15/Q31 samples
+ * for targets without FPU. Only configuring the filter uses float.
+ * Q15 follows the float filter within 0.2% down to a cutoff of 2% of the sample
+ * frequency, use Q31 for lower cutoff frequencies.
+ */
+
+#pragma once
+
+#include <mathlib/math/Functions.hpp>
+
+#include "BiquadFixed.hpp"
+
+namespace math
+{
+
+template<typename Q>
+class LowPassFilter2pFixed : public BiquadFixed<Q>
+{
+public:
+	LowPassFilter2pFixed() = default;
+
+	LowPassFilter2pFixed(float sample_freq, float cutoff_freq)
+	{
+		// set initial parameters
+		set_cutoff_frequency(sample_freq, cutoff_freq);
+	}
+
+	// Change filter parameters
+	void set_cutoff_frequency(float sample_freq, float cutoff_freq)
+	{
+		if ((sample_freq <= 0.f) || (cutoff_freq <= 0.f) || (cutoff_freq >= sample_freq / 2)
+		    || !isFinite(sample_freq) || !isFinite(cutoff_freq)) {
+
+			disable();
+			return;
+		}
+
+		_cutoff_freq = math::max(cutoff_freq, sample_freq * 0.001f);
+		_sample_freq = sample_freq;
+
+		const float fr = _sample_freq / _cutoff_freq;
+		const float ohm = tanf(M_PI_F / fr);
+		const float c = 1.f + 2.f * cosf(M_PI_F / 4.f) * ohm + ohm * ohm;
+
+		const float b0 = ohm * ohm / c;
+		const float a1 = 2.f * (ohm * ohm - 1.f) / c;
+		const float a2 = (1.f - 2.f * cosf(M_PI_F / 4.f) * ohm + ohm * ohm) / c;
+
+		if (!BiquadFixed<Q>::setCoefficients(a1, a2, b0, 2.f * b0, b0)) {
+			disable();
+			return;
+		}
+
+		// reset delay elements on filter change
+		BiquadFixed<Q>::reset(0);
+	}
+
+	// Return the cutoff frequency
+	float get_cutoff_freq() const { return _cutoff_freq; }
+
+	// Return the sample frequency
+	float get_sample_freq() const { return _sample_freq; }
+
+	// Reset the filter state to this value
+	Q reset(Q sample)
+	{
+		BiquadFixed<Q>::reset(sample);
+		return BiquadFixed<Q>::apply(sample);
+	}
+
+	void disable()
+	{
+		// no filtering
+		_sample_freq = 0.f;
+		_cutoff_freq = 0.f;
+
+		BiquadFixed<Q>::disable();
+	}
+
+private:
+	float _cutoff_freq{0.f};
+	float _sample_freq{0.f};
+};
+
+using LowPassFilter2pQ15 = LowPassFilter2pFixed<q15_t>;
+using LowPassFilter2pQ31 = LowPassFilter2pFixed<q31_t>;
+
+} // namespace math
@@ -50,6 +50,9 @@
 namespace math
 {
 
+template<int MAX_SAMPLES>
+class BiquadFilterBank;
+
 template<typename T>
 class NotchFilter
 {
@@ -164,6 +167,8 @@ public:
 	}
 
 protected:
+	// runs the filter on several axes at once
+	template<int MAX_SAMPLES> friend class BiquadFilterBank;
 
 	/**
 	 * Add a new raw value to the filter using the Direct Form I
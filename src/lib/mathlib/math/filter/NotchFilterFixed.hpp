@@ -0,0 +1,143 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file NotchFilterFixed.hpp
+ *
+ * Notch filter (see NotchFilter) on Q15/Q31 samples for targets without FPU.
+ * Only configuring the filter uses float.
+ */
+
+#pragma once
+
+#include <mathlib/math/Functions.hpp>
+
+#include "BiquadFixed.hpp"
+
+namespace math
+{
+
+template<typename Q>
+class NotchFilterFixed : public BiquadFixed<Q>
+{
+public:
+	NotchFilterFixed() = default;
+
+	bool setParameters(float sample_freq, float notch_freq, float bandwidth)
+	{
+		if ((sample_freq <= 0.f) || (notch_freq <= 0.f) || (bandwidth <= 0.f) || (notch_freq >= sample_freq / 2)
+		    || !isFinite(sample_freq) || !isFinite(notch_freq) || !isFinite(bandwidth)) {
+
+			disable();
+			return false;
+		}
+
+		const float freq_min = sample_freq * 0.001f;
+
+		_sample_freq = sample_freq;
+		_notch_freq = math::max(notch_freq, freq_min);
+		_bandwidth = math::max(bandwidth, freq_min);
+
+		const float alpha = tanf(M_PI_F * _bandwidth / _sample_freq);
+		const float beta = -cosf(2.f * M_PI_F * _notch_freq / _sample_freq);
+		const float a0_inv = 1.f / (alpha + 1.f);
+
+		if (!BiquadFixed<Q>::setCoefficients(2.f * beta * a0_inv, (1.f - alpha) * a0_inv,
+						      a0_inv, 2.f * beta * a0_inv, a0_inv)) {
+			disable();
+			return false;
+		}
+
+		_initialized = false;
+		return true;
+	}
+
+	/**
+	 * Add a new raw value to the filter
+	 *
+	 * @return retrieve the filtered result
+	 */
+	inline Q apply(Q sample)
+	{
+		if (!_initialized) {
+			BiquadFixed<Q>::reset(sample);
+			_initialized = true;
+		}
+
+		return BiquadFixed<Q>::apply(sample);
+	}
+
+	// Filter array of samples in place
+	inline void applyArray(Q samples[], int num_samples)
+	{
+		for (int n = 0; n < num_samples; n++) {
+			samples[n] = apply(samples[n]);
+		}
+	}
+
+	float getNotchFreq() const { return _notch_freq; }
+	float getBandwidth() const { return _bandwidth; }
+
+	bool initialized() const { return _initialized; }
+
+	void reset() { _initialized = false; }
+
+	void reset(Q sample)
+	{
+		BiquadFixed<Q>::reset(sample);
+		_initialized = true;
+	}
+
+	void disable()
+	{
+		// no filtering
+		_notch_freq = 0.f;
+		_bandwidth = 0.f;
+		_sample_freq = 0.f;
+
+		BiquadFixed<Q>::disable();
+		_initialized = false;
+	}
+
+private:
+	float _notch_freq{0.f};
+	float _bandwidth{0.f};
+	float _sample_freq{0.f};
+
+	bool _initialized{false};
+};
+
+using NotchFilterQ15 = NotchFilterFixed<q15_t>;
+using NotchFilterQ31 = NotchFilterFixed<q31_t>;
+
+} // namespace math
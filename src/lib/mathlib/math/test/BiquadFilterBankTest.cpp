@@ -0,0 +1,149 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <matrix/matrix/math.hpp>
+
+#include <lib/mathlib/math/filter/BiquadFilterBank.hpp>
+
+using namespace math;
+
+static constexpr int NUM_SAMPLES = 32;
+static constexpr int NUM_NOTCHES = 4;
+
+class BiquadFilterBankTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		for (int axis = 0; axis < 3; axis++) {
+			for (int i = 0; i < NUM_NOTCHES; i++) {
+				// different frequency per axis, as for the FFT notches
+				_notch[i][axis].setParameters(_sample_freq, 50.f + 70.f * i + 5.f * axis, 20.f);
+				_notch_ref[i][axis].setParameters(_sample_freq, 50.f + 70.f * i + 5.f * axis, 20.f);
+			}
+
+			_lpf[axis].set_cutoff_frequency(_sample_freq, 120.f);
+			_lpf_ref[axis].set_cutoff_frequency(_sample_freq, 120.f);
+		}
+	}
+
+	void fill(float data[3][NUM_SAMPLES], int offset)
+	{
+		for (int axis = 0; axis < 3; axis++) {
+			for (int n = 0; n < NUM_SAMPLES; n++) {
+				const float t = (offset + n) / _sample_freq;
+				data[axis][n] = 0.3f * axis + sinf(2.f * M_PI_F * 120.f * t) + 0.5f * sinf(2.f * M_PI_F * (190.f + axis) * t);
+			}
+		}
+	}
+
+	const float _sample_freq = 2000.f;
+
+	NotchFilter<float> _notch[NUM_NOTCHES][3];
+	NotchFilter<float> _notch_ref[NUM_NOTCHES][3];
+	LowPassFilter2p<float> _lpf[3];
+	LowPassFilter2p<float> _lpf_ref[3];
+
+	BiquadFilterBank<NUM_SAMPLES> _bank;
+};
+
+TEST_F(BiquadFilterBankTest, matchesScalarFilters)
+{
+	float data[3][NUM_SAMPLES];
+	float data_ref[3][NUM_SAMPLES];
+
+	for (int fifo = 0; fifo < 20; fifo++) {
+		fill(data, fifo * NUM_SAMPLES);
+		fill(data_ref, fifo * NUM_SAMPLES);
+
+		// reference: every filter on every axis
+		for (int axis = 0; axis < 3; axis++) {
+			for (int i = 0; i < NUM_NOTCHES; i++) {
+				// notch 1 isn't applied on the y axis
+				if (!((i == 1) && (axis == 1))) {
+					_notch_ref[i][axis].applyArray(data_ref[axis], NUM_SAMPLES);
+				}
+			}
+
+			_lpf_ref[axis].applyArray(data_ref[axis], NUM_SAMPLES);
+		}
+
+		float *samples[3] {data[0], data[1], data[2]};
+		_bank.load(samples, NUM_SAMPLES);
+
+		for (int i = 0; i < NUM_NOTCHES; i++) {
+			NotchFilter<float> *notches[3] {&_notch[i][0], (i == 1) ? nullptr : &_notch[i][1], &_notch[i][2]};
+			_bank.apply(notches);
+		}
+
+		LowPassFilter2p<float> *lpfs[3] {&_lpf[0], &_lpf[1], &_lpf[2]};
+		_bank.apply(lpfs);
+
+		_bank.store(samples);
+
+		for (int axis = 0; axis < 3; axis++) {
+			for (int n = 0; n < NUM_SAMPLES; n++) {
+				EXPECT_NEAR(data[axis][n], data_ref[axis][n], 1e-6f);
+			}
+
+			EXPECT_FLOAT_EQ(_bank.newest(axis), data[axis][NUM_SAMPLES - 1]);
+		}
+	}
+}
+
+TEST_F(BiquadFilterBankTest, reinitialization)
+{
+	float data[3][NUM_SAMPLES];
+	float *samples[3] {data[0], data[1], data[2]};
+
+	for (int axis = 0; axis < 3; axis++) {
+		for (int n = 0; n < NUM_SAMPLES; n++) {
+			data[axis][n] = 1.f + axis;
+		}
+	}
+
+	// GIVEN: notch filters that are not initialized yet
+	NotchFilter<float> *notches[3] {&_notch[0][0], &_notch[0][1], &_notch[0][2]};
+
+	_bank.load(samples, NUM_SAMPLES);
+	_bank.apply(notches);
+	_bank.store(samples);
+
+	// THEN: they are reset to the first sample, a constant input passes through
+	for (int axis = 0; axis < 3; axis++) {
+		EXPECT_TRUE(_notch[0][axis].initialized());
+		EXPECT_NEAR(data[axis][NUM_SAMPLES - 1], 1.f + axis, 1e-4f);
+	}
+}
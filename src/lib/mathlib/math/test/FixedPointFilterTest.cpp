@@ -0,0 +1,217 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * Test code for the Q15/Q31 fixed-point filters against their float versions
+ * Run this test only using make tests TESTFILTER=FixedPointFilter
+ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <px4_platform_common/defines.h>
+
+#include <lib/mathlib/math/FixedPoint.hpp>
+#include <lib/mathlib/math/filter/LowPassFilter2p.hpp>
+#include <lib/mathlib/math/filter/LowPassFilter2pFixed.hpp>
+#include <lib/mathlib/math/filter/NotchFilter.hpp>
+#include <lib/mathlib/math/filter/NotchFilterFixed.hpp>
+
+using namespace math;
+
+namespace
+{
+// sum of a step and two sines, within [-0.9, 0.9]
+float testSignal(int i, float sample_freq)
+{
+	const float t = i / sample_freq;
+	return ((i > 100) ? 0.3f : 0.f) + 0.4f * sinf(2.f * M_PI_F * 7.f * t) + 0.2f * sinf(2.f * M_PI_F * 130.f * t);
+}
+
+// maximum absolute difference of a fixed-point filter to the float reference
+template<typename Q, typename FixedFilter, typename FloatFilter>
+float maxError(FixedFilter &fixed, FloatFilter &reference, float sample_freq)
+{
+	float max_error = 0.f;
+
+	for (int i = 0; i < 4000; i++) {
+		const float x = testSignal(i, sample_freq);
+		const float expected = reference.apply(x);
+		const float out = toFloat<Q>(fixed.apply(toFixed<Q>(x)));
+		max_error = fmaxf(max_error, fabsf(out - expected));
+	}
+
+	return max_error;
+}
+}
+
+TEST(FixedPointTest, arithmetic)
+{
+	EXPECT_EQ(saturate<q15_t>(40000), INT16_MAX);
+	EXPECT_EQ(saturate<q15_t>(-40000), INT16_MIN);
+	EXPECT_EQ(saturate<q31_t>(INT64_C(1) << 40), INT32_MAX);
+
+	EXPECT_EQ(addSat<q15_t>(30000, 30000), INT16_MAX);
+	EXPECT_EQ(subSat<q15_t>(-30000, 30000), INT16_MIN);
+	EXPECT_EQ(mulSat<q15_t>(INT16_MIN, INT16_MIN), INT16_MAX); // -1 * -1
+	EXPECT_EQ(mulSat<q15_t>(toFixed<q15_t>(0.5f), toFixed<q15_t>(-0.5f)), toFixed<q15_t>(-0.25f));
+	EXPECT_EQ(mulSat<q31_t>(toFixed<q31_t>(0.5f), toFixed<q31_t>(0.5f)), toFixed<q31_t>(0.25f));
+
+	EXPECT_EQ(toFixed<q15_t>(1.f), INT16_MAX);
+	EXPECT_EQ(toFixed<q15_t>(-1.f), INT16_MIN);
+	EXPECT_EQ(toFixed<q31_t>(2.f), INT32_MAX);
+	EXPECT_EQ(toFixed<q15_t>(NAN), 0);
+	EXPECT_EQ(toFixed<q15_t>(0.25f, 13), 2048);
+	EXPECT_FLOAT_EQ(toFloat<q31_t>(toFixed<q31_t>(-0.125f)), -0.125f);
+}
+
+TEST(FixedPointTest, gain)
+{
+	const float gains[] = {0.f, 1.5e-4f, -0.37f, 1.f, 12.5f, 3000.f};
+
+	for (float gain : gains) {
+		const FixedGain<q15_t> g15 = FixedGain<q15_t>::fromFloat(gain);
+		const FixedGain<q31_t> g31 = FixedGain<q31_t>::fromFloat(gain);
+
+		// relative precision of the mantissa
+		EXPECT_NEAR(g15.toFloat(), gain, fabsf(gain) * 1e-4f);
+		EXPECT_NEAR(g31.toFloat(), gain, fabsf(gain) * 1e-6f);
+
+		const q15_t x = toFixed<q15_t>(0.01f);
+		EXPECT_NEAR(toFloat<q15_t>(saturate<q15_t>(g15.apply(x))), math::constrain(gain * toFloat<q15_t>(x), -1.f, 1.f), 1e-4f);
+	}
+
+	// limited range: saturated mantissa
+	EXPECT_NEAR(FixedGain<q15_t>::fromFloat(3.f, 15).toFloat(), 1.f, 1e-4f);
+}
+
+TEST(FixedPointFilterTest, lowPassMatchesFloat)
+{
+	const float sample_freq = 1000.f;
+	const float cutoff_freqs[] = {2.f, 10.f, 20.f, 30.f, 100.f, 300.f};
+
+	for (float cutoff_freq : cutoff_freqs) {
+		LowPassFilter2p<float> reference15{sample_freq, cutoff_freq};
+		LowPassFilter2p<float> reference31{sample_freq, cutoff_freq};
+		LowPassFilter2pQ15 lpf15{sample_freq, cutoff_freq};
+		LowPassFilter2pQ31 lpf31{sample_freq, cutoff_freq};
+
+		EXPECT_FLOAT_EQ(lpf15.get_cutoff_freq(), cutoff_freq);
+		EXPECT_FLOAT_EQ(lpf31.get_sample_freq(), sample_freq);
+
+		if (cutoff_freq >= 0.02f * sample_freq) {
+			// Q15 coefficients are too coarse for lower cutoff frequencies
+			EXPECT_LT((maxError<q15_t>(lpf15, reference15, sample_freq)), 2e-3f) << cutoff_freq;
+		}
+
+		EXPECT_LT((maxError<q31_t>(lpf31, reference31, sample_freq)), 5e-5f) << cutoff_freq;
+	}
+}
+
+TEST(FixedPointFilterTest, lowPassReset)
+{
+	LowPassFilter2pQ15 lpf{1000.f, 20.f};
+	const q15_t value = toFixed<q15_t>(-0.6f);
+
+	EXPECT_NEAR(lpf.reset(value), value, 2);
+
+	for (int i = 0; i < 100; i++) {
+		EXPECT_NEAR(lpf.apply(value), value, 2);
+	}
+}
+
+TEST(FixedPointFilterTest, lowPassDisabled)
+{
+	LowPassFilter2pQ31 lpf{1000.f, 600.f}; // invalid cutoff: disabled
+	EXPECT_EQ(lpf.get_cutoff_freq(), 0.f);
+
+	for (int i = 0; i < 10; i++) {
+		const q31_t x = toFixed<q31_t>(testSignal(i, 1000.f));
+		EXPECT_EQ(lpf.apply(x), x);
+	}
+}
+
+TEST(FixedPointFilterTest, lowPassSaturates)
+{
+	// full scale square wave: the overshoot saturates instead of wrapping around
+	LowPassFilter2pQ15 lpf{1000.f, 100.f};
+
+	for (int i = 0; i < 200; i++) {
+		const q15_t x = ((i / 20) % 2) ? INT16_MIN : INT16_MAX;
+		const q15_t out = lpf.apply(x);
+
+		if ((i % 20) > 15) {
+			// settled to the sign of the input
+			EXPECT_EQ(out > 0, x > 0) << i;
+		}
+	}
+}
+
+TEST(FixedPointFilterTest, notchMatchesFloat)
+{
+	const float sample_freq = 1000.f;
+
+	NotchFilter<float> reference15;
+	NotchFilter<float> reference31;
+	NotchFilterQ15 notch15;
+	NotchFilterQ31 notch31;
+
+	EXPECT_TRUE(reference15.setParameters(sample_freq, 130.f, 20.f));
+	EXPECT_TRUE(reference31.setParameters(sample_freq, 130.f, 20.f));
+	EXPECT_TRUE(notch15.setParameters(sample_freq, 130.f, 20.f));
+	EXPECT_TRUE(notch31.setParameters(sample_freq, 130.f, 20.f));
+
+	EXPECT_FLOAT_EQ(notch15.getNotchFreq(), 130.f);
+	EXPECT_FLOAT_EQ(notch31.getBandwidth(), 20.f);
+
+	EXPECT_LT((maxError<q15_t>(notch15, reference15, sample_freq)), 1e-3f);
+	EXPECT_LT((maxError<q31_t>(notch31, reference31, sample_freq)), 1e-5f);
+}
+
+TEST(FixedPointFilterTest, notchAttenuates)
+{
+	const float sample_freq = 1000.f;
+	NotchFilterQ15 notch;
+	notch.setParameters(sample_freq, 50.f, 10.f);
+
+	float max_out = 0.f;
+
+	for (int i = 0; i < 2000; i++) {
+		const q15_t out = notch.apply(toFixed<q15_t>(0.9f * sinf(2.f * M_PI_F * 50.f * i / sample_freq)));
+
+		if (i > 1000) {
+			max_out = fmaxf(max_out, fabsf(toFloat<q15_t>(out)));
+		}
+	}
+
+	EXPECT_LT(max_out, 0.01f);
+}
@@ -42,6 +42,7 @@
 #ifdef __cplusplus
 
 #include "math/Limits.hpp"
+#include "math/FastMath.hpp"
 #include "math/Functions.hpp"
 #include "math/SearchMin.hpp"
 #include "math/TrajMath.hpp"
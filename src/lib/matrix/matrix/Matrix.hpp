@@ -13,6 +13,7 @@
 #include <cstring>
 
 #include "helper_functions.hpp"
+#include "simd.hpp"
 #include "Slice.hpp"
 
 namespace matrix
@@ -151,6 +152,10 @@ public:
 		const Matrix<Type, M, N> &self = *this;
 		Matrix<Type, M, P> res{};
 
+		if (simd::Multiply<Type, M, N, P>::run(&self(0, 0), &other(0, 0), &res(0, 0))) {
+			return res;
+		}
+
 		for (size_t i = 0; i < M; i++) {
 			for (size_t k = 0; k < P; k++) {
 				for (size_t j = 0; j < N; j++) {
@@ -164,7 +169,7 @@ public:
 
 	// Using this function reduces the number of temporary variables needed to compute A * B.T
 	template<size_t P>
-	Matrix<Type, M, M> multiplyByTranspose(const Matrix<Type, P, N> &other) const
+	Matrix<Type, M, P> multiplyByTranspose(const Matrix<Type, P, N> &other) const
 	{
 		Matrix<Type, M, P> res;
 		const Matrix<Type, M, N> &self = *this;
@@ -180,6 +185,25 @@ public:
 		return res;
 	}
 
+	// Using this function reduces the number of temporary variables needed to compute A.T * B
+	template<size_t P>
+	Matrix<Type, N, P> transposeMultiply(const Matrix<Type, M, P> &other) const
+	{
+		Matrix<Type, N, P> res;
+		const Matrix<Type, M, N> &self = *this;
+
+		// accumulate row by row so that both operands are read in memory order
+		for (size_t j = 0; j < M; j++) {
+			for (size_t i = 0; i < N; i++) {
+				for (size_t k = 0; k < P; k++) {
+					res(i, k) += self(j, i) * other(j, k);
+				}
+			}
+		}
+
+		return res;
+	}
+
 	// Element-wise multiplication
 	Matrix<Type, M, N> emult(const Matrix<Type, M, N> &other) const
 	{
@@ -215,6 +239,10 @@ public:
 		Matrix<Type, M, N> res;
 		const Matrix<Type, M, N> &self = *this;
 
+		if (simd::Elementwise<Type, M * N>::add(&self(0, 0), &other(0, 0), &res(0, 0))) {
+			return res;
+		}
+
 		for (size_t i = 0; i < M; i++) {
 			for (size_t j = 0; j < N; j++) {
 				res(i, j) = self(i, j) + other(i, j);
@@ -229,6 +257,10 @@ public:
 		Matrix<Type, M, N> res;
 		const Matrix<Type, M, N> &self = *this;
 
+		if (simd::Elementwise<Type, M * N>::sub(&self(0, 0), &other(0, 0), &res(0, 0))) {
+			return res;
+		}
+
 		for (size_t i = 0; i < M; i++) {
 			for (size_t j = 0; j < N; j++) {
 				res(i, j) = self(i, j) - other(i, j);
@@ -257,6 +289,10 @@ public:
 	{
 		Matrix<Type, M, N> &self = *this;
 
+		if (simd::Elementwise<Type, M * N>::add(&self(0, 0), &other(0, 0), &self(0, 0))) {
+			return;
+		}
+
 		for (size_t i = 0; i < M; i++) {
 			for (size_t j = 0; j < N; j++) {
 				self(i, j) += other(i, j);
@@ -268,6 +304,10 @@ public:
 	{
 		Matrix<Type, M, N> &self = *this;
 
+		if (simd::Elementwise<Type, M * N>::sub(&self(0, 0), &other(0, 0), &self(0, 0))) {
+			return;
+		}
+
 		for (size_t i = 0; i < M; i++) {
 			for (size_t j = 0; j < N; j++) {
 				self(i, j) -= other(i, j);
@@ -438,6 +478,22 @@ public:
 		}
 	}
 
+	// element-wise conversion to another scalar type
+	template<typename OtherType>
+	Matrix<OtherType, M, N> cast() const
+	{
+		Matrix<OtherType, M, N> res;
+		const Matrix<Type, M, N> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = 0; j < N; j++) {
+				res(i, j) = static_cast<OtherType>(self(i, j));
+			}
+		}
+
+		return res;
+	}
+
 	Matrix<Type, N, M> transpose() const
 	{
 		Matrix<Type, N, M> res;
@@ -27,10 +27,10 @@ bool geninv(const Matrix<Type, M, N> &G, Matrix<Type, N, M> &res)
 	size_t rank;
 
 	if (M <= N) {
-		SquareMatrix<Type, M> A = G * G.transpose();
+		SquareMatrix<Type, M> A = G.multiplyByTranspose(G);
 		SquareMatrix<Type, M> L = fullRankCholesky(A, rank);
 
-		A = L.transpose() * L;
+		A = L.transposeMultiply(L);
 		SquareMatrix<Type, M> X;
 
 		if (!inv(A, X, rank)) {
@@ -38,15 +38,15 @@ bool geninv(const Matrix<Type, M, N> &G, Matrix<Type, N, M> &res)
 			return false; // LCOV_EXCL_LINE -- this can only be hit from numerical issues
 		}
 
-		// doing an intermediate assignment reduces stack usage
-		A = X * X * L.transpose();
-		res = G.transpose() * (L * A);
+		// doing an intermediate assignment and avoiding transposed copies reduces stack usage
+		A = (X * X).multiplyByTranspose(L);
+		res = G.transposeMultiply(L * A);
 
 	} else {
-		SquareMatrix<Type, N> A = G.transpose() * G;
+		SquareMatrix<Type, N> A = G.transposeMultiply(G);
 		SquareMatrix<Type, N> L = fullRankCholesky(A, rank);
 
-		A = L.transpose() * L;
+		A = L.transposeMultiply(L);
 		SquareMatrix<Type, N> X;
 
 		if (!inv(A, X, rank)) {
@@ -54,9 +54,9 @@ bool geninv(const Matrix<Type, M, N> &G, Matrix<Type, N, M> &res)
 			return false; // LCOV_EXCL_LINE -- this can only be hit from numerical issues
 		}
 
-		// doing an intermediate assignment reduces stack usage
-		A = X * X * L.transpose();
-		res = (L * A) * G.transpose();
+		// doing an intermediate assignment and avoiding transposed copies reduces stack usage
+		A = (X * X).multiplyByTranspose(L);
+		res = (L * A).multiplyByTranspose(G);
 	}
 
 	return true;
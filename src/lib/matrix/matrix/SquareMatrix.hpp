@@ -315,6 +315,52 @@ public:
 			}
 		}
 	}
+
+	// Joseph stabilized covariance update of a symmetric matrix P for a scalar measurement
+	//   P = (I - K * H) * P * (I - K * H)^T + K * R * K^T
+	//     = P - K * PH^T - PH * K^T + (H^T * P * H + R) * K * K^T
+	// with PH = P * H and HPH_R = H^T * P * H + R. The result is symmetric for any gain K,
+	// only the upper triangle is computed and then mirrored.
+	void josephUpdate(const Vector<Type, M> &K, const Vector<Type, M> &PH, const Type HPH_R)
+	{
+		SquareMatrix<Type, M> &self = *this;
+
+		for (size_t row_idx = 0; row_idx < M; row_idx++) {
+			const Type k = K(row_idx);
+			const Type c = HPH_R * k - PH(row_idx);
+
+			for (size_t col_idx = row_idx; col_idx < M; col_idx++) {
+				self(row_idx, col_idx) += c * K(col_idx) - k * PH(col_idx);
+			}
+		}
+
+		copyUpperToLowerTriangle();
+	}
+
+	// Joseph stabilized covariance update for N observations fused jointly
+	//   P = P - K * PH^T - PH * K^T + K * S * K^T
+	// with the observation jacobians as the columns of H, PH = P * H and S = H^T * P * H + R
+	template <size_t N>
+	void josephUpdate(const Matrix<Type, M, N> &K, const Matrix<Type, M, N> &PH, const SquareMatrix<Type, N> &S)
+	{
+		SquareMatrix<Type, M> &self = *this;
+
+		const Matrix<Type, M, N> C = K * S - PH;
+
+		for (size_t row_idx = 0; row_idx < M; row_idx++) {
+			for (size_t col_idx = row_idx; col_idx < M; col_idx++) {
+				Type accum(0);
+
+				for (size_t n = 0; n < N; n++) {
+					accum += C(row_idx, n) * K(col_idx, n) - K(row_idx, n) * PH(col_idx, n);
+				}
+
+				self(row_idx, col_idx) += accum;
+			}
+		}
+
+		copyUpperToLowerTriangle();
+	}
 };
 
 using SquareMatrix3f = SquareMatrix<float, 3>;
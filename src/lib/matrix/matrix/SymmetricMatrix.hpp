@@ -0,0 +1,290 @@
+/**
+ * @file SymmetricMatrix.hpp
+ *
+ * A symmetric matrix, only the upper triangle is stored (packed, row-major)
+ *
+ * Uses M * (M + 1) / 2 instead of M * M elements and can not become asymmetric.
+ * Meant for covariance matrices.
+ */
+
+#pragma once
+
+#include "SparseVector.hpp"
+#include "SquareMatrix.hpp"
+
+namespace matrix
+{
+
+template <typename Type, size_t M>
+class SymmetricMatrix
+{
+public:
+	static constexpr size_t N = M * (M + 1) / 2;
+
+	SymmetricMatrix() = default;
+
+	// takes the upper triangle of a square matrix
+	explicit SymmetricMatrix(const Matrix<Type, M, M> &other)
+	{
+		size_t idx = 0;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = i; j < M; j++) {
+				_data[idx++] = other(i, j);
+			}
+		}
+	}
+
+	// get packed index of element (i, j)
+	static constexpr size_t index(size_t i, size_t j)
+	{
+		return (i <= j) ? (i * (2 * M - i - 1) / 2 + j) : (j * (2 * M - j - 1) / 2 + i);
+	}
+
+	inline const Type &operator()(size_t i, size_t j) const
+	{
+		assert(i < M);
+		assert(j < M);
+
+		return _data[index(i, j)];
+	}
+
+	inline Type &operator()(size_t i, size_t j)
+	{
+		assert(i < M);
+		assert(j < M);
+
+		return _data[index(i, j)];
+	}
+
+	SquareMatrix<Type, M> square() const
+	{
+		SquareMatrix<Type, M> res;
+		size_t idx = 0;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = i; j < M; j++) {
+				res(i, j) = res(j, i) = _data[idx++];
+			}
+		}
+
+		return res;
+	}
+
+	// packed upper triangle (row-major), same format as SquareMatrix::upper_right_triangle()
+	Vector<Type, N> upper_right_triangle() const
+	{
+		return Vector<Type, N>(_data);
+	}
+
+	Vector<Type, M> row(size_t i) const
+	{
+		Vector<Type, M> res;
+		const SymmetricMatrix<Type, M> &self = *this;
+
+		for (size_t j = 0; j < M; j++) {
+			res(j) = self(i, j);
+		}
+
+		return res;
+	}
+
+	Vector<Type, M> col(size_t j) const
+	{
+		return row(j);
+	}
+
+	Vector<Type, M> diag() const
+	{
+		Vector<Type, M> res;
+
+		for (size_t i = 0; i < M; i++) {
+			res(i) = _data[index(i, i)];
+		}
+
+		return res;
+	}
+
+	template <size_t Width>
+	Type trace(size_t first) const
+	{
+		static_assert(Width <= M, "Width bigger than matrix");
+		assert(first + Width <= M);
+
+		Type res = 0;
+
+		for (size_t i = first; i < (first + Width); i++) {
+			res += _data[index(i, i)];
+		}
+
+		return res;
+	}
+
+	Type trace() const
+	{
+		return trace<M>(0);
+	}
+
+	void setZero()
+	{
+		for (size_t i = 0; i < N; i++) {
+			_data[i] = Type(0);
+		}
+	}
+
+	void setIdentity()
+	{
+		setZero();
+
+		for (size_t i = 0; i < M; i++) {
+			_data[index(i, i)] = Type(1);
+		}
+	}
+
+	SymmetricMatrix<Type, M> &operator+=(const SymmetricMatrix<Type, M> &other)
+	{
+		for (size_t i = 0; i < N; i++) {
+			_data[i] += other._data[i];
+		}
+
+		return *this;
+	}
+
+	SymmetricMatrix<Type, M> &operator-=(const SymmetricMatrix<Type, M> &other)
+	{
+		for (size_t i = 0; i < N; i++) {
+			_data[i] -= other._data[i];
+		}
+
+		return *this;
+	}
+
+	SymmetricMatrix<Type, M> &operator*=(Type scalar)
+	{
+		for (size_t i = 0; i < N; i++) {
+			_data[i] *= scalar;
+		}
+
+		return *this;
+	}
+
+	Vector<Type, M> operator*(const Vector<Type, M> &vec) const
+	{
+		Vector<Type, M> res;
+		size_t idx = 0;
+
+		// each stored off-diagonal element contributes to two rows
+		for (size_t i = 0; i < M; i++) {
+			res(i) += _data[idx++] * vec(i);
+
+			for (size_t j = i + 1; j < M; j++) {
+				res(i) += _data[idx] * vec(j);
+				res(j) += _data[idx] * vec(i);
+				idx++;
+			}
+		}
+
+		return res;
+	}
+
+	template <size_t... Idxs>
+	Vector<Type, M> operator*(const SparseVector<Type, M, Idxs...> &vec) const
+	{
+		Vector<Type, M> res;
+		const SymmetricMatrix<Type, M> &self = *this;
+
+		for (size_t i = 0; i < M; i++) {
+			Type accum(0);
+
+			for (size_t k = 0; k < vec.non_zeros(); k++) {
+				accum += self(i, vec.index(k)) * vec.atCompressedIndex(k);
+			}
+
+			res(i) = accum;
+		}
+
+		return res;
+	}
+
+	// zero all covariance elements of the given states, keep the variances
+	template <size_t Width>
+	void uncorrelateCovariance(size_t first)
+	{
+		static_assert(Width <= M, "Width bigger than matrix");
+		assert(first + Width <= M);
+
+		uncorrelateCovarianceSetVariance<Width>(first, diag().template slice<Width, 1>(first, 0));
+	}
+
+	template <size_t Width>
+	void uncorrelateCovarianceSetVariance(size_t first, const Vector<Type, Width> &vec)
+	{
+		static_assert(Width <= M, "Width bigger than matrix");
+		assert(first + Width <= M);
+
+		SymmetricMatrix<Type, M> &self = *this;
+
+		for (size_t i = first; i < first + Width; i++) {
+			for (size_t j = 0; j < M; j++) {
+				self(i, j) = Type(0);
+			}
+
+			self(i, i) = vec(i - first);
+		}
+	}
+
+	template <size_t Width>
+	void uncorrelateCovarianceSetVariance(size_t first, Type val)
+	{
+		uncorrelateCovarianceSetVariance<Width>(first, Vector<Type, Width>() + val);
+	}
+
+	// Joseph stabilized covariance update for a scalar measurement, see SquareMatrix::josephUpdate()
+	//   P = P - K * PH^T - PH * K^T + (H^T * P * H + R) * K * K^T
+	void josephUpdate(const Vector<Type, M> &K, const Vector<Type, M> &PH, const Type HPH_R)
+	{
+		size_t idx = 0;
+
+		for (size_t i = 0; i < M; i++) {
+			const Type k = K(i);
+			const Type c = HPH_R * k - PH(i);
+
+			for (size_t j = i; j < M; j++) {
+				_data[idx++] += c * K(j) - k * PH(j);
+			}
+		}
+	}
+
+private:
+	Type _data[N] {};
+};
+
+// returns x.T * A * x
+template<typename Type, size_t M, size_t ... Idxs>
+Type quadraticForm(const SymmetricMatrix<Type, M> &A, const SparseVector<Type, M, Idxs...> &x)
+{
+	Type res = Type(0);
+
+	for (size_t i = 0; i < x.non_zeros(); i++) {
+		Type tmp = Type(0);
+
+		for (size_t j = 0; j < x.non_zeros(); j++) {
+			tmp += A(x.index(i), x.index(j)) * x.atCompressedIndex(j);
+		}
+
+		res += x.atCompressedIndex(i) * tmp;
+	}
+
+	return res;
+}
+
+template<typename Type, size_t M>
+bool isEqual(const SymmetricMatrix<Type, M> &x, const SquareMatrix<Type, M> &y, const Type eps = Type(1e-4f))
+{
+	return isEqual(x.square(), y, eps);
+}
+
+template<size_t M>
+using SymmetricMatrixf = SymmetricMatrix<float, M>;
+
+} // namespace matrix
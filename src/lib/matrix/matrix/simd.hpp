@@ -0,0 +1,153 @@
+/**
+ * @file simd.hpp
+ *
+ * Optional SIMD kernels for single precision matrix operations.
+ *
+ * Enabled with MATRIX_SIMD (Kconfig LIB_MATRIX_SIMD) on targets with ARM NEON,
+ * ARM Helium (MVE) or SSE, otherwise the scalar loops in Matrix.hpp are used.
+ * Products are accumulated in the same order as the scalar path and without
+ * fused multiply-add, so both paths give the same results.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(MATRIX_SIMD)
+# if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 2)
+#  include <arm_mve.h>
+#  define MATRIX_SIMD_ARM
+# elif defined(__ARM_NEON)
+#  include <arm_neon.h>
+#  define MATRIX_SIMD_ARM
+# elif defined(__SSE__)
+#  include <xmmintrin.h>
+#  define MATRIX_SIMD_SSE
+# endif
+#endif
+
+namespace matrix
+{
+
+namespace simd
+{
+
+#if defined(MATRIX_SIMD_ARM)
+
+static constexpr bool available = true;
+
+// NEON and Helium share the intrinsic names used here
+using float4 = float32x4_t;
+inline float4 load(const float *p) { return vld1q_f32(p); }
+inline void store(float *p, float4 v) { vst1q_f32(p, v); }
+inline float4 set1(float x) { return vdupq_n_f32(x); }
+inline float4 add(float4 a, float4 b) { return vaddq_f32(a, b); }
+inline float4 sub(float4 a, float4 b) { return vsubq_f32(a, b); }
+inline float4 mul(float4 a, float4 b) { return vmulq_f32(a, b); }
+
+#elif defined(MATRIX_SIMD_SSE)
+
+static constexpr bool available = true;
+
+using float4 = __m128;
+inline float4 load(const float *p) { return _mm_loadu_ps(p); }
+inline void store(float *p, float4 v) { _mm_storeu_ps(p, v); }
+inline float4 set1(float x) { return _mm_set1_ps(x); }
+inline float4 add(float4 a, float4 b) { return _mm_add_ps(a, b); }
+inline float4 sub(float4 a, float4 b) { return _mm_sub_ps(a, b); }
+inline float4 mul(float4 a, float4 b) { return _mm_mul_ps(a, b); }
+
+#else
+
+static constexpr bool available = false;
+
+#endif
+
+// res (M x P) = a (M x N) * b (N x P), all row-major
+// run() returns false if there is no kernel for the type/size and the caller has to compute the result itself
+template<typename Type, size_t M, size_t N, size_t P, bool Enable = (available && (P >= 4))>
+struct Multiply {
+	static bool run(const Type *, const Type *, Type *) { return false; }
+};
+
+// res = a + b or res = a - b, element-wise over Size elements
+template<typename Type, size_t Size, bool Enable = (available && (Size >= 4))>
+struct Elementwise {
+	static bool add(const Type *, const Type *, Type *) { return false; }
+	static bool sub(const Type *, const Type *, Type *) { return false; }
+};
+
+#if defined(MATRIX_SIMD_ARM) || defined(MATRIX_SIMD_SSE)
+
+template<size_t M, size_t N, size_t P>
+struct Multiply<float, M, N, P, true> {
+	static bool run(const float *a, const float *b, float *res)
+	{
+		for (size_t i = 0; i < M; i++) {
+			size_t k = 0;
+
+			// 4 columns of the result row at once
+			for (; k + 4 <= P; k += 4) {
+				float4 acc = set1(0.f);
+
+				for (size_t j = 0; j < N; j++) {
+					acc = add(acc, mul(set1(a[i * N + j]), load(&b[j * P + k])));
+				}
+
+				store(&res[i * P + k], acc);
+			}
+
+			// remaining columns
+			for (; k < P; k++) {
+				float acc = 0.f;
+
+				for (size_t j = 0; j < N; j++) {
+					acc += a[i * N + j] * b[j * P + k];
+				}
+
+				res[i * P + k] = acc;
+			}
+		}
+
+		return true;
+	}
+};
+
+template<size_t Size>
+struct Elementwise<float, Size, true> {
+	static bool add(const float *a, const float *b, float *res)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= Size; i += 4) {
+			store(&res[i], simd::add(load(&a[i]), load(&b[i])));
+		}
+
+		for (; i < Size; i++) {
+			res[i] = a[i] + b[i];
+		}
+
+		return true;
+	}
+
+	static bool sub(const float *a, const float *b, float *res)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= Size; i += 4) {
+			store(&res[i], simd::sub(load(&a[i]), load(&b[i])));
+		}
+
+		for (; i < Size; i++) {
+			res[i] = a[i] - b[i];
+		}
+
+		return true;
+	}
+};
+
+#endif
+
+} // namespace simd
+
+} // namespace matrix
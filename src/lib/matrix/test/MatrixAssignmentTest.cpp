@@ -306,3 +306,19 @@ TEST(MatrixAssignmentTest, Assignment)
 
 	EXPECT_FALSE(fclose(fp));
 }
+
+TEST(MatrixAssignmentTest, Cast)
+{
+	float data[6] = {1.f, 2.f, 3.f, 4.f, 5.f, 0.1f};
+	const Matrix<float, 2, 3> m(data);
+
+	const Matrix<double, 2, 3> m_double = m.cast<double>();
+
+	for (size_t i = 0; i < 2; i++) {
+		for (size_t j = 0; j < 3; j++) {
+			EXPECT_EQ(m_double(i, j), static_cast<double>(m(i, j)));
+		}
+	}
+
+	EXPECT_EQ(m_double.cast<float>(), m);
+}
@@ -98,3 +98,32 @@ TEST(MatrixMultiplicationTest, Multiplication)
 	Matrix<float, 4, 2> m42_plus2 = m42 - (-2);
 	EXPECT_EQ(m42_plus2, m42_plus2_check);
 }
+
+TEST(MatrixMultiplicationTest, FusedTranspose)
+{
+	float data_a[6] = {1, 2, 3,
+			   4, 5, 6
+			  };
+	float data_b[8] = {1, -1, 0, 2,
+			   3, 0.5f, -2, 1
+			  };
+	float data_c[12] = {2, 0, 1,
+			    -1, 1, 0,
+			    0, 3, -2,
+			    1, 1, 1
+			   };
+	const Matrix<float, 2, 3> A(data_a);
+	const Matrix<float, 2, 4> B(data_b);
+	const Matrix<float, 4, 3> C(data_c);
+
+	// A.T * B without the transposed copy
+	const Matrix<float, 3, 4> AtB = A.transposeMultiply(B);
+	EXPECT_EQ(AtB, A.transpose() * B);
+
+	// A * C.T for non square results
+	const Matrix<float, 2, 4> ACt = A.multiplyByTranspose(C);
+	EXPECT_EQ(ACt, A * C.transpose());
+
+	EXPECT_EQ(A.multiplyByTranspose(A), A * A.transpose());
+	EXPECT_EQ(A.transposeMultiply(A), A.transpose() * A);
+}
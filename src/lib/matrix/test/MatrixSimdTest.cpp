@@ -0,0 +1,134 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+// compare the SIMD kernels against the scalar reference, independently of the board configuration
+#ifndef MATRIX_SIMD
+#define MATRIX_SIMD
+#endif
+
+#include <gtest/gtest.h>
+#include <matrix/math.hpp>
+
+using namespace matrix;
+
+template<size_t M, size_t N>
+static Matrix<float, M, N> testMatrix(float offset)
+{
+	Matrix<float, M, N> A;
+
+	for (size_t i = 0; i < M; i++) {
+		for (size_t j = 0; j < N; j++) {
+			A(i, j) = sinf(offset + 0.37f * i + 1.91f * j) * (1.f + i);
+		}
+	}
+
+	return A;
+}
+
+template<size_t M, size_t N, size_t P>
+static void checkMultiplication()
+{
+	const Matrix<float, M, N> A = testMatrix<M, N>(0.1f);
+	const Matrix<float, N, P> B = testMatrix<N, P>(2.3f);
+
+	Matrix<float, M, P> res_ref;
+
+	for (size_t i = 0; i < M; i++) {
+		for (size_t k = 0; k < P; k++) {
+			for (size_t j = 0; j < N; j++) {
+				res_ref(i, k) += A(i, j) * B(j, k);
+			}
+		}
+	}
+
+	EXPECT_TRUE(isEqual(A * B, res_ref, 1e-6f));
+}
+
+template<size_t M, size_t N>
+static void checkAddition()
+{
+	const Matrix<float, M, N> A = testMatrix<M, N>(0.4f);
+	const Matrix<float, M, N> B = testMatrix<M, N>(1.7f);
+
+	Matrix<float, M, N> sum_ref;
+	Matrix<float, M, N> diff_ref;
+
+	for (size_t i = 0; i < M; i++) {
+		for (size_t j = 0; j < N; j++) {
+			sum_ref(i, j) = A(i, j) + B(i, j);
+			diff_ref(i, j) = A(i, j) - B(i, j);
+		}
+	}
+
+	EXPECT_TRUE(isEqual(A + B, sum_ref, 1e-6f));
+	EXPECT_TRUE(isEqual(A - B, diff_ref, 1e-6f));
+
+	Matrix<float, M, N> C = A;
+	C += B;
+	EXPECT_TRUE(isEqual(C, sum_ref, 1e-6f));
+
+	C = A;
+	C -= B;
+	EXPECT_TRUE(isEqual(C, diff_ref, 1e-6f));
+}
+
+TEST(MatrixSimdTest, Multiplication)
+{
+	checkMultiplication<3, 3, 3>();
+	checkMultiplication<4, 4, 4>();
+	checkMultiplication<3, 4, 1>();
+	checkMultiplication<23, 23, 23>();
+	checkMultiplication<23, 23, 1>();
+
+	// control allocation effectiveness and its pseudo inverse
+	checkMultiplication<6, 16, 6>();
+	checkMultiplication<16, 6, 16>();
+}
+
+TEST(MatrixSimdTest, Addition)
+{
+	checkAddition<3, 3>();
+	checkAddition<4, 4>();
+	checkAddition<23, 23>();
+	checkAddition<6, 16>();
+	checkAddition<5, 1>();
+}
+
+TEST(MatrixSimdTest, DoubleUnchanged)
+{
+	// double always uses the scalar path
+	const Matrix<double, 4, 4> A = testMatrix<4, 4>(0.f).cast<double>();
+	const Matrix<double, 4, 4> I = eye<double, 4>();
+	EXPECT_TRUE(isEqual(A * I, A));
+	EXPECT_TRUE(isEqual((A + A) - A, A));
+}
@@ -210,3 +210,81 @@ TEST(MatrixSquareTest, Square)
 	M.copyUpperToLowerTriangle();
 	EXPECT_EQ(M, L_check);
 }
+
+TEST(MatrixSquareTest, JosephUpdate)
+{
+	float data_P[16] = {4, 1, 0.5, 0,
+			    1, 3, 0.2, 0.1,
+			    0.5, 0.2, 2, 0.3,
+			    0, 0.1, 0.3, 1
+			   };
+	const SquareMatrix<float, 4> P(data_P);
+	float data_H[4] = {0, 1, 0, -0.5};
+	const Vector<float, 4> H(data_H);
+	const float R = 0.5f;
+
+	// optimal and non-optimal (zeroed) gains
+	const Vector<float, 4> PH = P * H;
+	Vector<float, 4> K = PH / (H.dot(PH) + R);
+
+	for (int i = 0; i < 2; i++) {
+		// reference: full matrix implementation
+		SquareMatrix<float, 4> A = eye<float, 4>();
+		A -= K.multiplyByTranspose(H);
+		SquareMatrix<float, 4> P_check = A * P * A.transpose();
+		P_check += (K * R).multiplyByTranspose(K);
+
+		SquareMatrix<float, 4> P_update = P;
+		P_update.josephUpdate(K, PH, H.dot(PH) + R);
+		EXPECT_TRUE(isEqual(P_update, P_check, 1e-6f));
+		EXPECT_TRUE(P_update.isBlockSymmetric<4>(0, 0.f));
+
+		K(1) = 0.f;
+	}
+}
+
+TEST(MatrixSquareTest, JosephUpdateJoint)
+{
+	float data_P[16] = {4, 1, 0.5, 0,
+			    1, 3, 0.2, 0.1,
+			    0.5, 0.2, 2, 0.3,
+			    0, 0.1, 0.3, 1
+			   };
+	const SquareMatrix<float, 4> P(data_P);
+
+	// two observations, jacobians as columns
+	float data_H[8] = {0, 1,
+			   1, 0,
+			   0, 0.5,
+			   -0.5, 0
+			  };
+	const Matrix<float, 4, 2> H(data_H);
+	SquareMatrix<float, 2> R;
+	R(0, 0) = 0.5f;
+	R(1, 1) = 0.2f;
+
+	const Matrix<float, 4, 2> PH = P * H;
+	const SquareMatrix<float, 2> S = H.transpose() * PH + R;
+	const Matrix<float, 4, 2> K = PH * inv(S);
+
+	// reference: full matrix implementation
+	SquareMatrix<float, 4> A = eye<float, 4>();
+	A -= K * H.transpose();
+	SquareMatrix<float, 4> P_check = A * P * A.transpose();
+	P_check += K * R * K.transpose();
+
+	SquareMatrix<float, 4> P_update = P;
+	P_update.josephUpdate(K, PH, S);
+	EXPECT_TRUE(isEqual(P_update, P_check, 1e-6f));
+
+	// a single observation gives the same result as the vector version
+	SquareMatrix<float, 4> P_vector = P;
+	SquareMatrix<float, 4> P_matrix = P;
+	const Vector<float, 4> K0(K.col(0));
+	const Vector<float, 4> PH0(PH.col(0));
+	SquareMatrix<float, 1> S0;
+	S0(0, 0) = S(0, 0);
+	P_vector.josephUpdate(K0, PH0, S(0, 0));
+	P_matrix.josephUpdate<1>(K0, PH0, S0);
+	EXPECT_TRUE(isEqual(P_vector, P_matrix, 1e-6f));
+}
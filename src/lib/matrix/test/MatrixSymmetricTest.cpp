@@ -0,0 +1,122 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2022 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <matrix/math.hpp>
+
+using namespace matrix;
+
+static SquareMatrix<float, 4> symmetricTestMatrix()
+{
+	float data[16] = {4, 1, 0.5, 0,
+			  1, 3, 0.2, 0.1,
+			  0.5, 0.2, 2, 0.3,
+			  0, 0.1, 0.3, 1
+			 };
+	return SquareMatrix<float, 4>(data);
+}
+
+TEST(MatrixSymmetricTest, Storage)
+{
+	static_assert(sizeof(SymmetricMatrixf<23>) == 23 * 24 / 2 * sizeof(float), "packed storage");
+
+	const SquareMatrix<float, 4> A = symmetricTestMatrix();
+	SymmetricMatrixf<4> S(A);
+	EXPECT_TRUE(isEqual(S, A));
+	EXPECT_TRUE(isEqual(S.upper_right_triangle(), A.upper_right_triangle()));
+	EXPECT_TRUE(isEqual(S.diag(), A.diag()));
+	EXPECT_TRUE(isEqual(S.row(1), Vector<float, 4>(A.col(1))));
+	EXPECT_FLOAT_EQ(S.trace(), A.trace());
+	EXPECT_FLOAT_EQ(S.trace<2>(1), 5.f);
+
+	// writing either triangle updates both
+	S(3, 0) = 7.f;
+	EXPECT_FLOAT_EQ(S(0, 3), 7.f);
+
+	S.setIdentity();
+	EXPECT_TRUE(isEqual(S, eye<float, 4>()));
+}
+
+TEST(MatrixSymmetricTest, Arithmetic)
+{
+	const SquareMatrix<float, 4> A = symmetricTestMatrix();
+	SymmetricMatrixf<4> S(A);
+
+	const Vector4f v(1.f, -2.f, 3.f, 0.5f);
+	EXPECT_TRUE(isEqual(S * v, Vector4f(A * v)));
+
+	const SparseVectorf<4, 1, 3> sparse(v);
+	const Vector4f v_sparse(0.f, -2.f, 0.f, 0.5f);
+	EXPECT_TRUE(isEqual(S * sparse, Vector4f(A * v_sparse)));
+	EXPECT_FLOAT_EQ(quadraticForm(S, sparse), quadraticForm(A, sparse));
+
+	S += S;
+	EXPECT_TRUE(isEqual(S, SquareMatrix<float, 4>(A * 2.f)));
+	S *= 0.5f;
+	EXPECT_TRUE(isEqual(S, A));
+	S -= S;
+	EXPECT_TRUE(isEqual(S, SquareMatrix<float, 4>()));
+}
+
+TEST(MatrixSymmetricTest, Uncorrelate)
+{
+	const SquareMatrix<float, 4> A = symmetricTestMatrix();
+	SymmetricMatrixf<4> S(A);
+	SquareMatrix<float, 4> A_check = A;
+
+	S.uncorrelateCovariance<2>(1);
+	A_check.uncorrelateCovariance<2>(1);
+	EXPECT_TRUE(isEqual(S, A_check));
+
+	S.uncorrelateCovarianceSetVariance<1>(3, 5.f);
+	A_check.uncorrelateCovarianceSetVariance<1>(3, 5.f);
+	EXPECT_TRUE(isEqual(S, A_check));
+}
+
+TEST(MatrixSymmetricTest, JosephUpdate)
+{
+	const SquareMatrix<float, 4> P = symmetricTestMatrix();
+	SymmetricMatrixf<4> S(P);
+	SquareMatrix<float, 4> P_check = P;
+
+	float data_H[4] = {0, 1, 0, -0.5};
+	const Vector<float, 4> H(data_H);
+	const Vector<float, 4> PH = S * H;
+	const float HPH_R = H.dot(PH) + 0.5f;
+	const Vector<float, 4> K = PH / HPH_R;
+
+	S.josephUpdate(K, PH, HPH_R);
+	P_check.josephUpdate(K, PH, HPH_R);
+	EXPECT_TRUE(isEqual(S, P_check, 1e-6f));
+}
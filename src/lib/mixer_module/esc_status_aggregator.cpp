@@ -0,0 +1,105 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "esc_status_aggregator.hpp"
+
+EscStatusAggregator::EscStatusAggregator(uint8_t connection_type, hrt_abstime timeout, hrt_abstime max_interval) :
+	_timeout(timeout),
+	_max_interval(max_interval)
+{
+	_esc_status.esc_connectiontype = connection_type;
+}
+
+void EscStatusAggregator::updated(int index, hrt_abstime timestamp_sample)
+{
+	if (index >= 0 && index < MAX_ESCS) {
+		const uint8_t esc_bit = 1 << index;
+
+		if (_updated_mask & esc_bit) {
+			_round_complete = true;
+		}
+
+		_updated_mask |= esc_bit;
+		_esc_status.esc[index].timestamp = timestamp_sample;
+	}
+}
+
+uint8_t EscStatusAggregator::onlineFlags(const hrt_abstime now) const
+{
+	uint8_t online_flags = 0;
+
+	for (int index = 0; index < _esc_status.esc_count; index++) {
+		const hrt_abstime timestamp = _esc_status.esc[index].timestamp;
+
+		if ((timestamp > 0) && (now < timestamp + _timeout)) {
+			online_flags |= 1 << index;
+		}
+	}
+
+	return online_flags;
+}
+
+bool EscStatusAggregator::publish(const hrt_abstime now, uint8_t armed_flags)
+{
+	if (_updated_mask == 0) {
+		return false;
+	}
+
+	const uint8_t online_flags = onlineFlags(now);
+
+	// wait for the round of all online ESCs, unless telemetry became irregular
+	if (!_round_complete && ((_updated_mask & online_flags) != online_flags) && (now < _last_publish + _max_interval)) {
+		return false;
+	}
+
+	// clear the data of ESCs that went offline
+	for (int index = 0; index < MAX_ESCS; index++) {
+		if (!(online_flags & (1 << index)) && (_esc_status.esc[index].timestamp != 0)) {
+			const uint8_t actuator_function = _esc_status.esc[index].actuator_function;
+			_esc_status.esc[index] = esc_report_s{};
+			_esc_status.esc[index].actuator_function = actuator_function;
+		}
+	}
+
+	_esc_status.esc_online_flags = online_flags;
+	_esc_status.esc_armed_flags = armed_flags;
+	_esc_status.counter++;
+	_esc_status.timestamp = hrt_absolute_time();
+	_esc_status_pub.publish(_esc_status);
+
+	_last_publish = now;
+	_updated_mask = 0;
+	_round_complete = false;
+
+	return true;
+}
@@ -0,0 +1,104 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <uORB/PublicationMulti.hpp>
+#include <uORB/topics/esc_status.h>
+
+using namespace time_literals;
+
+/**
+ * Merges partial per-ESC telemetry of an output driver into one coherent esc_status.
+ *
+ * Drivers update the reports of single ESCs whenever telemetry arrives (serial round robin,
+ * bidirectional DShot, CAN status messages, ...) and call publish() once per output cycle.
+ * A message is published once all online ESCs reported since the last publication (a round),
+ * when an ESC reports again before the round is complete, or after the maximum interval.
+ * ESCs are online while their last report is more recent than the timeout.
+ */
+class EscStatusAggregator
+{
+public:
+	static constexpr int MAX_ESCS = esc_status_s::CONNECTED_ESC_MAX;
+
+	EscStatusAggregator(uint8_t connection_type, hrt_abstime timeout = 1200_ms, hrt_abstime max_interval = 100_ms);
+	~EscStatusAggregator() = default;
+
+	void advertise() { _esc_status_pub.advertise(); }
+
+	void setEscCount(uint8_t count) { _esc_status.esc_count = (count < MAX_ESCS) ? count : MAX_ESCS; }
+	uint8_t escCount() const { return _esc_status.esc_count; }
+
+	/**
+	 * Report of one ESC to update, followed by updated() once the new fields are set.
+	 * Fields not set keep the value of previous updates (e.g. RPM and voltage from different sources).
+	 */
+	esc_report_s &esc(int index) { return _esc_status.esc[(index < MAX_ESCS) ? index : 0]; }
+
+	/**
+	 * Mark an ESC as updated
+	 * @param index ESC index
+	 * @param timestamp_sample time of the telemetry sample, stored as ESC timestamp
+	 */
+	void updated(int index, hrt_abstime timestamp_sample);
+
+	/**
+	 * Publish the merged esc_status if due. Call once per output cycle.
+	 * @param now current time
+	 * @param armed_flags bitmask of armed ESCs
+	 * @return true if published
+	 */
+	bool publish(const hrt_abstime now, uint8_t armed_flags);
+
+	/**
+	 * Online ESCs: reported within the timeout
+	 */
+	uint8_t onlineFlags(const hrt_abstime now) const;
+
+	const esc_status_s &get() const { return _esc_status; }
+
+private:
+	uORB::PublicationMulti<esc_status_s> _esc_status_pub{ORB_ID(esc_status)};
+
+	esc_status_s _esc_status{};
+
+	const hrt_abstime _timeout;
+	const hrt_abstime _max_interval;
+
+	hrt_abstime _last_publish{0};
+
+	uint8_t _updated_mask{0};	///< ESCs updated since the last publication
+	bool _round_complete{false};	///< an ESC reported twice since the last publication
+};
@@ -0,0 +1,101 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <uORB/Subscription.hpp>
+
+#include "esc_status_aggregator.hpp"
+
+TEST(EscStatusAggregatorTest, PublishOncePerRound)
+{
+	EscStatusAggregator aggregator{esc_status_s::ESC_CONNECTION_TYPE_DSHOT, 100_ms, 50_ms};
+	aggregator.setEscCount(4);
+
+	hrt_abstime now = 1_s;
+
+	// first round: nothing online yet, publish with the first updates
+	for (int i = 0; i < 4; i++) {
+		aggregator.esc(i).esc_rpm = 1000 + i;
+		aggregator.updated(i, now);
+	}
+
+	EXPECT_TRUE(aggregator.publish(now, 0xf));
+	EXPECT_EQ(aggregator.get().esc_online_flags, 0xf);
+
+	// nothing new
+	EXPECT_FALSE(aggregator.publish(now + 1_ms, 0xf));
+
+	// partial round is held back
+	now += 2_ms;
+	aggregator.updated(0, now);
+	aggregator.updated(1, now);
+	EXPECT_FALSE(aggregator.publish(now, 0xf));
+
+	// completed round
+	aggregator.updated(2, now);
+	aggregator.updated(3, now);
+	EXPECT_TRUE(aggregator.publish(now, 0xf));
+
+	// an ESC reporting twice ends the round (others are silent)
+	now += 2_ms;
+	aggregator.updated(0, now);
+	aggregator.updated(0, now + 1_ms);
+	EXPECT_TRUE(aggregator.publish(now + 1_ms, 0xf));
+}
+
+TEST(EscStatusAggregatorTest, OfflineTimeout)
+{
+	EscStatusAggregator aggregator{esc_status_s::ESC_CONNECTION_TYPE_CAN, 100_ms, 50_ms};
+	aggregator.setEscCount(2);
+
+	hrt_abstime now = 1_s;
+	aggregator.esc(0).esc_rpm = 1200;
+	aggregator.esc(1).esc_rpm = 1300;
+	aggregator.updated(0, now);
+	aggregator.updated(1, now);
+	EXPECT_TRUE(aggregator.publish(now, 0x3));
+
+	// ESC 1 stops reporting: published after the maximum interval, offline after the timeout
+	now += 60_ms;
+	aggregator.updated(0, now);
+	EXPECT_TRUE(aggregator.publish(now, 0x3));
+	EXPECT_EQ(aggregator.get().esc_online_flags, 0x3);
+
+	now += 60_ms;
+	aggregator.updated(0, now);
+	EXPECT_TRUE(aggregator.publish(now, 0x3));
+	EXPECT_EQ(aggregator.get().esc_online_flags, 0x1);
+	EXPECT_EQ(aggregator.get().esc[1].esc_rpm, 0);
+	EXPECT_EQ(aggregator.get().esc[0].esc_rpm, 1200);
+}
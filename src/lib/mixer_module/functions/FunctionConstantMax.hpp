@@ -43,8 +43,12 @@ class FunctionConstantMax : public FunctionProviderBase
 public:
 	static FunctionProviderBase *allocate(const Context &context) { return new FunctionConstantMax(); }
 
-	float value(OutputFunction func) override { return 1.f; }
+	float value(OutputFunction func) override { return _value; }
+	const float *valueSource(OutputFunction func) const override { return &_value; }
 	void update() override { }
 
 	float defaultFailsafeValue(OutputFunction func) const override { return 1.f; }
+
+private:
+	const float _value{1.f};
 };
@@ -58,6 +58,7 @@ public:
 	}
 
 	float value(OutputFunction func) override { return _data[(int)func - (int)OutputFunction::Gimbal_Roll]; }
+	const float *valueSource(OutputFunction func) const override { return &_data[(int)func - (int)OutputFunction::Gimbal_Roll]; }
 
 private:
 	uORB::Subscription _topic{ORB_ID(gimbal_controls)};
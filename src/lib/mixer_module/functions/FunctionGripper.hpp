@@ -62,6 +62,7 @@ public:
 	}
 
 	float value(OutputFunction func) override { return _data; }
+	const float *valueSource(OutputFunction func) const override { return &_data; }
 
 private:
 	uORB::Subscription _gripper_sub{ORB_ID(gripper)};
@@ -56,6 +56,7 @@ public:
 	}
 
 	float value(OutputFunction func) override { return _data; }
+	const float *valueSource(OutputFunction func) const override { return &_data; }
 
 private:
 	uORB::Subscription _topic{ORB_ID(landing_gear_wheel)};
@@ -67,6 +67,7 @@ public:
 	}
 
 	float value(OutputFunction func) override { return _data.control[(int)func - (int)OutputFunction::Motor1]; }
+	const float *valueSource(OutputFunction func) const override { return &_data.control[(int)func - (int)OutputFunction::Motor1]; }
 
 	bool allowPrearmControl() const override { return false; }
 
@@ -115,6 +116,7 @@ public:
 	}
 
 	bool reversible(OutputFunction func) const override { return _data.reversible_flags & (1u << ((int)func - (int)OutputFunction::Motor1)); }
+	const uint16_t *reversibleFlagsSource() const override { return &_data.reversible_flags; }
 
 private:
 	uORB::SubscriptionCallbackWorkItem _topic;
@@ -45,6 +45,10 @@ public:
 	static FunctionProviderBase *allocate(const Context &context) { return new FunctionParachute(); }
 
 	void update() override {}
-	float value(OutputFunction func) override { return -1.f; }
+	float value(OutputFunction func) override { return _value; }
+	const float *valueSource(OutputFunction func) const override { return &_value; }
 	float defaultFailsafeValue(OutputFunction func) const override { return 1.f; }
+
+private:
+	const float _value{-1.f};
 };
@@ -61,6 +61,13 @@ public:
 	 */
 	virtual float value(OutputFunction func) = 0;
 
+	/**
+	 * Get the memory location value() reads from, so the output can be read without a virtual call.
+	 * It must remain valid for the lifetime of the provider.
+	 * @return pointer to the value or nullptr if value() has to be called
+	 */
+	virtual const float *valueSource(OutputFunction func) const { return nullptr; }
+
 	virtual float defaultFailsafeValue(OutputFunction func) const { return NAN; }
 	virtual bool allowPrearmControl() const { return true; }
 
@@ -72,4 +79,10 @@ public:
 	 * Check whether the output (motor) is configured to be reversible
 	 */
 	virtual bool reversible(OutputFunction func) const { return false; }
+
+	/**
+	 * Get the flags reversible() reads from, bit i corresponds to function func_min + i
+	 * @return pointer to the flags or nullptr if no output is reversible
+	 */
+	virtual const uint16_t *reversibleFlagsSource() const { return nullptr; }
 };
@@ -58,6 +58,7 @@ public:
 
 	void update() override { _topic.update(&_data); }
 	float value(OutputFunction func) override { return _data.control[(int)func - (int)OutputFunction::Servo1]; }
+	const float *valueSource(OutputFunction func) const override { return &_data.control[(int)func - (int)OutputFunction::Servo1]; }
 
 	uORB::SubscriptionCallbackWorkItem *subscriptionCallback() override { return &_topic; }
 
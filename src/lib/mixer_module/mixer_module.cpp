@@ -74,7 +74,7 @@ MixingOutput::MixingOutput(const char *param_prefix, uint8_t max_num_outputs, Ou
 	_support_esc_calibration(support_esc_calibration),
 	_max_num_outputs(max_num_outputs < MAX_ACTUATORS ? max_num_outputs : MAX_ACTUATORS),
 	_interface(interface),
-	_control_latency_perf(perf_alloc(PC_ELAPSED, "control latency")),
+	_control_latency_perf(perf_alloc(PC_HISTOGRAM, PERF_LATENCY_PREFIX "4 actuator_outputs")),
 	_param_prefix(param_prefix)
 {
 	/* Safely initialize armed flags */
@@ -138,6 +138,8 @@ void MixingOutput::printStatus() const
 		PX4_INFO("Switched to rate_ctrl work queue");
 	}
 
+	PX4_INFO("Output mapping: %s", _compiled_outputs_valid ? "compiled" : "dynamic");
+
 	PX4_INFO_RAW("Channel Configuration:\n");
 
 	for (unsigned i = 0; i < _max_num_outputs; i++) {
@@ -210,7 +212,10 @@ void MixingOutput::cleanupFunctions()
 		delete _function_allocated[i];
 		_function_allocated[i] = nullptr;
 		_functions[i] = nullptr;
+		_compiled_outputs[i] = {};
 	}
+
+	_compiled_outputs_valid = false;
 }
 
 bool MixingOutput::updateSubscriptions(bool allow_wq_switch)
@@ -264,6 +269,7 @@ bool MixingOutput::updateSubscriptions(bool allow_wq_switch)
 	int next_provider = 0;
 	int subscription_callback_provider_index = INT_MAX;
 	bool all_disabled = true;
+	bool all_compiled = true;
 
 	for (int i = 0; i < _max_num_outputs; ++i) {
 		int32_t val;
@@ -309,6 +315,15 @@ bool MixingOutput::updateSubscriptions(bool allow_wq_switch)
 					}
 				}
 
+				if (_functions[i]) {
+					CompiledOutput &output = _compiled_outputs[i];
+					output.value = _functions[i]->valueSource(_function_assignment[i]);
+					output.reversible_flags = _functions[i]->reversibleFlagsSource();
+					output.reversible_bit = (int)_function_assignment[i] - (int)all_function_providers[p].min_func;
+					output.allow_prearm_control = _functions[i]->allowPrearmControl();
+					all_compiled = all_compiled && output.value;
+				}
+
 				break;
 			}
 		}
@@ -342,6 +357,9 @@ bool MixingOutput::updateSubscriptions(bool allow_wq_switch)
 		}
 	}
 
+	// the compiled outputs are used as long as the function assignment does not change
+	_compiled_outputs_valid = all_compiled;
+
 	setMaxTopicUpdateRate(_max_topic_update_interval_us);
 	_need_function_update = false;
 
@@ -437,22 +455,28 @@ bool MixingOutput::update()
 	bool all_disabled = true;
 	_reversible_mask = 0;
 
-	for (int i = 0; i < _max_num_outputs; ++i) {
-		if (_functions[i]) {
-			all_disabled = false;
+	if (_compiled_outputs_valid) {
+		const bool armed = _armed.armed;
+		const bool prearmed = _armed.prearmed;
 
-			if (_armed.armed || (_armed.prearmed && _functions[i]->allowPrearmControl())) {
-				outputs[i] = _functions[i]->value(_function_assignment[i]);
+		for (int i = 0; i < _max_num_outputs; ++i) {
+			const CompiledOutput &output = _compiled_outputs[i];
+
+			if (output.value) {
+				all_disabled = false;
+				outputs[i] = (armed || (prearmed && output.allow_prearm_control)) ? *output.value : NAN;
+
+				if (output.reversible_flags) {
+					_reversible_mask |= (uint32_t)((*output.reversible_flags >> output.reversible_bit) & 1u) << i;
+				}
 
 			} else {
 				outputs[i] = NAN;
 			}
-
-			_reversible_mask |= (uint32_t)_functions[i]->reversible(_function_assignment[i]) << i;
-
-		} else {
-			outputs[i] = NAN;
 		}
+
+	} else {
+		updateOutputValues(outputs, all_disabled);
 	}
 
 	// Send output if any function mapped or one last disabling sample
@@ -469,6 +493,28 @@ bool MixingOutput::update()
 	return true;
 }
 
+void
+MixingOutput::updateOutputValues(float outputs[MAX_ACTUATORS], bool &all_disabled)
+{
+	for (int i = 0; i < _max_num_outputs; ++i) {
+		if (_functions[i]) {
+			all_disabled = false;
+
+			if (_armed.armed || (_armed.prearmed && _functions[i]->allowPrearmControl())) {
+				outputs[i] = _functions[i]->value(_function_assignment[i]);
+
+			} else {
+				outputs[i] = NAN;
+			}
+
+			_reversible_mask |= (uint32_t)_functions[i]->reversible(_function_assignment[i]) << i;
+
+		} else {
+			outputs[i] = NAN;
+		}
+	}
+}
+
 void
 MixingOutput::limitAndUpdateOutputs(float outputs[MAX_ACTUATORS], bool has_updates)
 {
@@ -636,19 +682,28 @@ MixingOutput::setAndPublishActuatorOutputs(unsigned num_outputs, actuator_output
 	}
 
 	actuator_outputs.timestamp = hrt_absolute_time();
+	actuator_outputs.timestamp_sample = latestSampleTimestamp();
 	_outputs_pub.publish(actuator_outputs);
 }
 
-void
-MixingOutput::updateLatencyPerfCounter(const actuator_outputs_s &actuator_outputs)
+hrt_abstime
+MixingOutput::latestSampleTimestamp() const
 {
 	// Just check the first function. It means we only get the latency if motors are assigned first, which is the default
-	if (_function_allocated[0]) {
-		hrt_abstime timestamp_sample;
+	hrt_abstime timestamp_sample;
 
-		if (_function_allocated[0]->getLatestSampleTimestamp(timestamp_sample)) {
-			perf_set_elapsed(_control_latency_perf, actuator_outputs.timestamp - timestamp_sample);
-		}
+	if (_function_allocated[0] && _function_allocated[0]->getLatestSampleTimestamp(timestamp_sample)) {
+		return timestamp_sample;
+	}
+
+	return 0;
+}
+
+void
+MixingOutput::updateLatencyPerfCounter(const actuator_outputs_s &actuator_outputs)
+{
+	if (actuator_outputs.timestamp_sample != 0) {
+		perf_set_elapsed(_control_latency_perf, actuator_outputs.timestamp - actuator_outputs.timestamp_sample);
 	}
 }
 
@@ -218,15 +218,32 @@ private:
 	void setAndPublishActuatorOutputs(unsigned num_outputs, actuator_outputs_s &actuator_outputs);
 	void publishMixerStatus(const actuator_outputs_s &actuator_outputs);
 	void updateLatencyPerfCounter(const actuator_outputs_s &actuator_outputs);
+	hrt_abstime latestSampleTimestamp() const;
 
 	void cleanupFunctions();
 
 	void initParamHandles();
 
+	/**
+	 * Get the output values through the assigned function providers (dynamic path)
+	 */
+	void updateOutputValues(float outputs[MAX_ACTUATORS], bool &all_disabled);
+
 	void limitAndUpdateOutputs(float outputs[MAX_ACTUATORS], bool has_updates);
 
 	void output_limit_calc(const bool armed, const int num_channels, const float outputs[MAX_ACTUATORS]);
 
+	/**
+	 * Output channel mapping resolved once the function assignment is known, so that the outputs
+	 * can be read directly from the providers without virtual calls.
+	 */
+	struct CompiledOutput {
+		const float *value{nullptr}; ///< nullptr if no function is assigned
+		const uint16_t *reversible_flags{nullptr};
+		uint8_t reversible_bit{0};
+		bool allow_prearm_control{false};
+	};
+
 	struct ParamHandles {
 		param_t function{PARAM_INVALID};
 		param_t disarmed{PARAM_INVALID};
@@ -275,11 +292,13 @@ private:
 
 	OutputModuleInterface &_interface;
 
-	perf_counter_t _control_latency_perf;
+	perf_counter_t _control_latency_perf; ///< sensor sample to actuator_outputs latency
 
 	FunctionProviderBase *_function_allocated[MAX_ACTUATORS] {}; ///< unique allocated functions
 	FunctionProviderBase *_functions[MAX_ACTUATORS] {}; ///< currently assigned functions
 	OutputFunction _function_assignment[MAX_ACTUATORS] {};
+	CompiledOutput _compiled_outputs[MAX_ACTUATORS] {};
+	bool _compiled_outputs_valid{false}; ///< false if a provider does not support direct access (dynamic path)
 	bool _need_function_update{true};
 	bool _has_backup_schedule{false};
 	const char *const _param_prefix;
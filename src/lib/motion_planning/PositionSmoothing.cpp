@@ -36,6 +36,8 @@
 #include <mathlib/mathlib.h>
 #include <matrix/matrix/math.hpp>
 
+#include <string.h>
+
 void PositionSmoothing::_generateSetpoints(
 	const Vector3f &position,
 	const Vector3f(&waypoints)[3],
@@ -82,7 +84,7 @@ bool PositionSmoothing::_isTurning(const Vector3f &target) const
 		&& pos_to_target.longerThan(_target_acceptance_radius));
 }
 
-float PositionSmoothing::_getMaxXYSpeed(const Vector3f(&waypoints)[3]) const
+float PositionSmoothing::_getMaxXYSpeed(const Vector3f(&waypoints)[3])
 {
 	Vector3f pos_traj(_trajectory[0].getCurrentPosition(),
 			  _trajectory[1].getCurrentPosition(),
@@ -99,9 +101,21 @@ float PositionSmoothing::_getMaxXYSpeed(const Vector3f(&waypoints)[3]) const
 	// constrain velocity to go to the position setpoint first if the position setpoint has been modified by an external source
 	// (eg. Obstacle Avoidance)
 
-	Vector3f pos_to_waypoints[3] = {pos_traj, waypoints[1], waypoints[2]};
+	// Same as computeXYSpeedFromWaypoints<3>({pos_traj, waypoints[1], waypoints[2]}), with the segment
+	// from the target to the next waypoint cached as it does not depend on the current position
+	if (!_exit_speed_valid
+	    || (memcmp(&config, &_exit_speed_limits, sizeof(config)) != 0)
+	    || (memcmp(&waypoints[1], _exit_speed_waypoints, sizeof(_exit_speed_waypoints)) != 0)) {
+
+		_exit_speed = math::trajectory::computeStartXYSpeedFromWaypoints(waypoints[1], waypoints[2], waypoints[2], 0.f,
+				config);
+		_exit_speed_limits = config;
+		_exit_speed_waypoints[0] = waypoints[1];
+		_exit_speed_waypoints[1] = waypoints[2];
+		_exit_speed_valid = true;
+	}
 
-	return math::trajectory::computeXYSpeedFromWaypoints<3>(pos_to_waypoints, config);
+	return math::trajectory::computeStartXYSpeedFromWaypoints(pos_traj, waypoints[1], waypoints[2], _exit_speed, config);
 }
 
 float PositionSmoothing::_getMaxZSpeed(const Vector3f(&waypoints)[3]) const
@@ -123,11 +137,12 @@ float PositionSmoothing::_getMaxZSpeed(const Vector3f(&waypoints)[3]) const
 	return max_speed;
 }
 
-const Vector3f PositionSmoothing::_getCrossingPoint(const Vector3f &position, const Vector3f(&waypoints)[3]) const
+const Vector3f PositionSmoothing::_getCrossingPoint(const Vector3f &position, const Vector3f(&waypoints)[3],
+		bool is_turning) const
 {
 	const auto &target = waypoints[1];
 
-	if (!_isTurning(target)) {
+	if (!is_turning) {
 		return target;
 	}
 
@@ -173,18 +188,21 @@ const Vector3f PositionSmoothing::_generateVelocitySetpoint(const Vector3f &posi
 
 	Vector3f velocity_setpoint = feedforward_velocity_setpoint;
 
+	// the trajectory state does not change while generating the velocity setpoint, evaluate it once
+	const bool is_turning = xy_target_valid && _isTurning(target);
+
 	if (xy_target_valid && z_target_valid) {
 		// Use 3D position setpoint to generate a 3D velocity setpoint
 		Vector3f pos_traj(_trajectory[0].getCurrentPosition(),
 				  _trajectory[1].getCurrentPosition(),
 				  _trajectory[2].getCurrentPosition());
-		const Vector3f crossing_point = is_single_waypoint ? target : _getCrossingPoint(position, waypoints);
+		const Vector3f crossing_point = is_single_waypoint ? target : _getCrossingPoint(position, waypoints, is_turning);
 		const Vector3f u_pos_traj_to_dest{(crossing_point - pos_traj).unit_or_zero()};
 
 		float xy_speed = _getMaxXYSpeed(waypoints);
 		const float z_speed = _getMaxZSpeed(waypoints);
 
-		if (!is_single_waypoint && _isTurning(target)) {
+		if (!is_single_waypoint && is_turning) {
 			// Limit speed during a turn
 			xy_speed = math::min(_max_speed_previous, xy_speed);
 
@@ -212,13 +230,14 @@ const Vector3f PositionSmoothing::_generateVelocitySetpoint(const Vector3f &posi
 
 		// Get various path specific vectors
 		Vector2f pos_traj(_trajectory[0].getCurrentPosition(), _trajectory[1].getCurrentPosition());
-		Vector2f crossing_point = is_single_waypoint ? Vector2f(target) : Vector2f(_getCrossingPoint(position, waypoints));
+		Vector2f crossing_point = is_single_waypoint ? Vector2f(target) : Vector2f(_getCrossingPoint(position, waypoints,
+					  is_turning));
 		Vector2f pos_traj_to_dest_xy = crossing_point - pos_traj;
 		Vector2f u_pos_traj_to_dest_xy(pos_traj_to_dest_xy.unit_or_zero());
 
 		float xy_speed = _getMaxXYSpeed(waypoints);
 
-		if (_isTurning(target)) {
+		if (is_turning) {
 			// Lock speed during turn
 			xy_speed = math::min(_max_speed_previous, xy_speed);
 
@@ -34,6 +34,7 @@
 #pragma once
 
 #include <cmath>
+#include <motion_planning/TrajectoryConstraints.hpp>
 #include <motion_planning/VelocitySmoothing.hpp>
 
 #include <matrix/matrix/math.hpp>
@@ -422,6 +423,13 @@ private:
 	VelocitySmoothing _trajectory[3]; ///< Trajectories in x, y and z directions
 	float _max_speed_previous{0.f};
 
+	/* Maximum speed at the target for the segment to the next waypoint, only depends on the waypoints
+	 * and the limits so it is only recomputed when one of them changes */
+	Vector3f _exit_speed_waypoints[2] {};
+	math::trajectory::VehicleDynamicLimits _exit_speed_limits{};
+	float _exit_speed{0.f};
+	bool _exit_speed_valid{false};
+
 	/* Internal functions */
 	bool _isTurning(const Vector3f &target) const;
 
@@ -439,8 +447,8 @@ private:
 			bool is_single_waypoint,
 			const Vector3f &feedforward_velocity_setpoint);
 	const Vector3f _getL1Point(const Vector3f &position, const Vector3f(&waypoints)[3]) const;
-	const Vector3f _getCrossingPoint(const Vector3f &position, const Vector3f(&waypoints)[3]) const;
-	float _getMaxXYSpeed(const Vector3f(&waypoints)[3]) const;
+	const Vector3f _getCrossingPoint(const Vector3f &position, const Vector3f(&waypoints)[3], bool is_turning) const;
+	float _getMaxXYSpeed(const Vector3f(&waypoints)[3]);
 	float _getMaxZSpeed(const Vector3f(&waypoints)[3]) const;
 
 	void _generateTrajectory(
@@ -189,3 +189,40 @@ TEST_F(PositionSmoothingTest, reachesTargetInitialVelocity)
 	EXPECT_EQ(TARGET, position);
 	EXPECT_LT(iteration, N_ITER) << "Took too long to converge\n";
 }
+
+TEST_F(PositionSmoothingTest, changingNextWaypointUpdatesSpeedLimit)
+{
+	const float DELTA_T = 0.02f;
+	const Vector3f FF_VELOCITY{0.f, 0.f, 0.f};
+
+	math::trajectory::VehicleDynamicLimits config;
+	config.z_accept_rad = VERTICAL_ACCEPTANCE_RADIUS;
+	config.xy_accept_rad = TARGET_ACCEPTANCE_RADIUS;
+	config.max_acc_xy = MAX_ACCELERATION;
+	config.max_jerk = MAX_JERK;
+	config.max_speed_xy = CRUISE_SPEED;
+	config.max_acc_xy_radius_scale = HORIZONTAL_TRAJECTORY_GAIN;
+
+	// GIVEN: a straight line through the target
+	Vector3f waypoints[3] = {{0.f, 0.f, 0.f}, {12.f, 0.f, 0.f}, {30.f, 0.f, 0.f}};
+	Vector3f position{0.f, 0.f, 0.f};
+	PositionSmoothing::PositionSmoothingSetpoints out;
+
+	for (int i = 0; i < 3; i++) {
+		for (int iteration = 0; iteration < 50; iteration++) {
+			const Vector3f position_trajectory = _position_smoothing.getCurrentPosition();
+			_position_smoothing.generateSetpoints(position, waypoints, FF_VELOCITY, DELTA_T, false, out);
+			position = out.position;
+
+			// THEN: the velocity target matches the speed allowed by all waypoints
+			const Vector3f speed_waypoints[3] = {position_trajectory, waypoints[1], waypoints[2]};
+			EXPECT_NEAR(Vector2f(out.unsmoothed_velocity).norm(),
+				    math::trajectory::computeXYSpeedFromWaypoints<3>(speed_waypoints, config), 1e-5f);
+		}
+
+		// WHEN: the next segment gets shorter, then the vehicle needs to stop at the target
+		waypoints[2] = (i == 0) ? Vector3f(12.6f, 0.f, 0.f) : waypoints[1];
+	}
+
+	EXPECT_LT(position(0), waypoints[1](0));
+}
@@ -35,6 +35,7 @@
 
 #include <cstdio>
 #include <float.h>
+#include <string.h>
 #include <mathlib/mathlib.h>
 #include <matrix/matrix/math.hpp>
 
@@ -166,9 +167,29 @@ void VelocitySmoothing::updateDurations(float vel_setpoint)
 	_local_time = 0.f;
 	_state_init = _state;
 
+	// The minimum-time solution only depends on the target, the jerk and acceleration limits
+	// and the current acceleration and velocity; reuse it while none of them changed
+	// (e.g.: hover or cruise, where the state stays exactly on the setpoint)
+	const DurationsInputs inputs{_vel_sp, _max_jerk, _max_accel, _state.a, _state.v};
+
+	if (_durations_cache_valid && (memcmp(&inputs, &_durations_cache_inputs, sizeof(inputs)) == 0)) {
+		_direction = _durations_cache_direction;
+		_T1 = _durations_cache_T1;
+		_T2 = _durations_cache_T2;
+		_T3 = _durations_cache_T3;
+		return;
+	}
+
 	_direction = computeDirection();
 
 	updateDurationsMinimizeTotalTime();
+
+	_durations_cache_inputs = inputs;
+	_durations_cache_direction = _direction;
+	_durations_cache_T1 = _T1;
+	_durations_cache_T2 = _T2;
+	_durations_cache_T3 = _T3;
+	_durations_cache_valid = true;
 }
 
 int VelocitySmoothing::computeDirection() const
@@ -74,7 +74,8 @@ public:
 
 	/**
 	 * Compute T1, T2, T3 depending on the current state and velocity setpoint. This should be called on every cycle
-	 * and before updateTraj().
+	 * and before updateTraj(). The solution is reused as long as the setpoint, the constraints and the
+	 * current acceleration and velocity are unchanged.
 	 * @param vel_setpoint velocity setpoint input
 	 */
 	void updateDurations(float vel_setpoint);
@@ -210,4 +211,21 @@ private:
 	float _T3{0.f}; ///< Decreasing acceleration [s]
 
 	float _local_time{0.f}; ///< Current local time
+
+	/* Inputs of the minimum-time solution, compared bitwise to detect a change */
+	struct DurationsInputs {
+		float vel_sp;
+		float max_jerk;
+		float max_accel;
+		float a;
+		float v;
+	};
+
+	/* Last minimum-time solution (before time synchronization) */
+	DurationsInputs _durations_cache_inputs{};
+	int _durations_cache_direction{0};
+	float _durations_cache_T1{0.f};
+	float _durations_cache_T2{0.f};
+	float _durations_cache_T3{0.f};
+	bool _durations_cache_valid{false};
 };
@@ -102,6 +102,54 @@ TEST(VelocitySmoothingBasicTest, DivisionByZeroSaturateT1ForAccel)
 	EXPECT_FLOAT_EQ(trajectory.getCurrentPosition(), 0.f);
 }
 
+TEST(VelocitySmoothingBasicTest, CachedDurationsFollowInputs)
+{
+	// GIVEN: A configured trajectory at rest
+	VelocitySmoothing trajectory;
+	trajectory.setMaxJerk(10.f);
+	trajectory.setMaxAccel(3.f);
+	trajectory.setMaxVel(5.f);
+
+	// WHEN: The durations are computed twice with identical inputs
+	trajectory.updateDurations(2.f);
+	const float total_time = trajectory.getTotalTime();
+	const float T1 = trajectory.getT1();
+	trajectory.updateDurations(2.f);
+
+	// THEN: The same solution is returned
+	EXPECT_GT(total_time, 0.f);
+	EXPECT_FLOAT_EQ(trajectory.getTotalTime(), total_time);
+	EXPECT_FLOAT_EQ(trajectory.getT1(), T1);
+
+	// WHEN: Only a constraint changes
+	trajectory.setMaxJerk(5.f);
+	trajectory.updateDurations(2.f);
+
+	// THEN: The solution is recomputed
+	EXPECT_GT(trajectory.getT1(), T1);
+	EXPECT_GT(trajectory.getTotalTime(), total_time);
+
+	// WHEN: Only the current velocity changes
+	const float total_time_slow_jerk = trajectory.getTotalTime();
+	trajectory.setCurrentVelocity(1.f);
+	trajectory.updateDurations(2.f);
+
+	// THEN: The solution is recomputed as well
+	EXPECT_LT(trajectory.getTotalTime(), total_time_slow_jerk);
+
+	// WHEN: The trajectory reaches the setpoint
+	for (int i = 0; i < 100; i++) {
+		trajectory.updateDurations(2.f);
+		trajectory.updateTraj(0.02f);
+	}
+
+	// THEN: It stays there
+	trajectory.updateDurations(2.f);
+	EXPECT_FLOAT_EQ(trajectory.getTotalTime(), 0.f);
+	EXPECT_FLOAT_EQ(trajectory.getCurrentVelocity(), 2.f);
+	EXPECT_FLOAT_EQ(trajectory.getCurrentAcceleration(), 0.f);
+}
+
 class VelocitySmoothingTest : public ::testing::Test
 {
 public:
@@ -171,6 +219,26 @@ TEST_F(VelocitySmoothingTest, testTimeSynchronization)
 	EXPECT_LE(fabsf(_trajectories[0].getTotalTime() - _trajectories[1].getTotalTime()), 0.0001);
 }
 
+TEST_F(VelocitySmoothingTest, testCachedDurationsAfterTimeSynchronization)
+{
+	// GIVEN: Two trajectories where the shorter one gets stretched by the time synchronization
+	setConstraints(10.f, 3.f, 5.f);
+	setInitialConditions(Vector3f(), Vector3f(), Vector3f());
+	const Vector3f velocity_setpoints(4.f, 1.f, 0.f);
+
+	_trajectories[1].updateDurations(velocity_setpoints(1));
+	const float min_total_time = _trajectories[1].getTotalTime();
+
+	updateTrajectories(0.f, velocity_setpoints);
+	EXPECT_GT(_trajectories[1].getTotalTime(), min_total_time);
+
+	// WHEN: The durations are updated again with the same inputs
+	_trajectories[1].updateDurations(velocity_setpoints(1));
+
+	// THEN: The minimum-time solution is returned, not the synchronized one
+	EXPECT_FLOAT_EQ(_trajectories[1].getTotalTime(), min_total_time);
+}
+
 TEST_F(VelocitySmoothingTest, testTimeSynchronizationSameDelta)
 {
 	// GIVEN: a set of initial conditions
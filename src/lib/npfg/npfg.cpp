@@ -259,7 +259,7 @@ float NPFG::periodLowerBound(const float air_turn_rate, const float wind_factor,
 
 float NPFG::trackProximity(const float look_ahead_ang) const
 {
-	const float sin_look_ahead_ang = sinf(look_ahead_ang);
+	const float sin_look_ahead_ang = math::sin_fast(look_ahead_ang);
 	return sin_look_ahead_ang * sin_look_ahead_ang;
 } // trackProximity
 
@@ -293,8 +293,9 @@ float NPFG::lookAheadAngle(const float normalized_track_error) const
 Vector2f NPFG::bearingVec(const Vector2f &unit_path_tangent, const float look_ahead_ang,
 			  const float signed_track_error) const
 {
-	const float cos_look_ahead_ang = cosf(look_ahead_ang);
-	const float sin_look_ahead_ang = sinf(look_ahead_ang);
+	float sin_look_ahead_ang;
+	float cos_look_ahead_ang;
+	math::sincos_fast(look_ahead_ang, sin_look_ahead_ang, cos_look_ahead_ang);
 
 	Vector2f unit_path_normal(-unit_path_tangent(1), unit_path_tangent(0)); // right handed 90 deg (clockwise) turn
 	Vector2f unit_track_error = -((signed_track_error < 0.0f) ? -1.0f : 1.0f) * unit_path_normal;
@@ -438,7 +439,7 @@ float NPFG::bearingFeasibility(float wind_cross_bearing, const float wind_dot_be
 		wind_cross_bearing = fabsf(wind_cross_bearing);
 	}
 
-	float sin_arg = sinf(M_PI_F * 0.5f * math::constrain((airspeed - wind_cross_bearing) / AIRSPEED_BUFFER, 0.0f, 1.0f));
+	float sin_arg = math::sin_fast(M_PI_F * 0.5f * math::constrain((airspeed - wind_cross_bearing) / AIRSPEED_BUFFER, 0.0f, 1.0f));
 	return sin_arg * sin_arg;
 } // bearingFeasibility
 
@@ -499,7 +500,7 @@ float NPFG::switchDistance(float wp_radius) const
 
 void NPFG::updateRollSetpoint()
 {
-	float roll_new = atanf(lateral_accel_ * 1.0f / CONSTANTS_ONE_G);
+	float roll_new = math::atan_fast(lateral_accel_ * 1.0f / CONSTANTS_ONE_G);
 	roll_new = math::constrain(roll_new, -roll_lim_rad_, roll_lim_rad_);
 
 	if (PX4_ISFINITE(roll_new)) {
@@ -0,0 +1,380 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file OccupancyMap.cpp
+ */
+
+#include "OccupancyMap.hpp"
+
+#include <float.h>
+#include <string.h>
+
+#include <mathlib/mathlib.h>
+#include <px4_platform_common/defines.h>
+
+using namespace matrix;
+
+template<typename Visitor>
+bool OccupancyMap::traverse(const Vector3f &start, const Vector3f &end, Visitor &&visitor) const
+{
+	const Vector3f start_scaled = start / _resolution;
+	const Vector3f delta = (end - start) / _resolution;
+
+	Cell cell = toCell(start);
+	const Cell end_cell = toCell(end);
+
+	int step[3];
+	float t_max[3]; // ray parameter at which the next cell boundary is crossed
+	float t_delta[3]; // ray parameter increment to cross one cell
+
+	for (int i = 0; i < 3; i++) {
+		if (delta(i) > FLT_EPSILON) {
+			step[i] = 1;
+			t_delta[i] = 1.f / delta(i);
+			t_max[i] = (cell.xyz[i] + 1 - start_scaled(i)) / delta(i);
+
+		} else if (delta(i) < -FLT_EPSILON) {
+			step[i] = -1;
+			t_delta[i] = -1.f / delta(i);
+			t_max[i] = (cell.xyz[i] - start_scaled(i)) / delta(i);
+
+		} else {
+			step[i] = 0;
+			t_delta[i] = INFINITY;
+			t_max[i] = INFINITY;
+		}
+	}
+
+	float t = 0.f;
+
+	for (int n = 0; n < MAX_RAY_STEPS; n++) {
+		if (!visitor(cell, t)) {
+			return false;
+		}
+
+		if (equal(cell, end_cell)) {
+			return true;
+		}
+
+		int axis = 0;
+
+		if (t_max[1] < t_max[axis]) { axis = 1; }
+
+		if (t_max[2] < t_max[axis]) { axis = 2; }
+
+		if (t_max[axis] > 1.f) {
+			// rounding, the end is within the current cell
+			return true;
+		}
+
+		t = t_max[axis];
+		cell.xyz[axis] += step[axis];
+		t_max[axis] += t_delta[axis];
+	}
+
+	return false;
+}
+
+void OccupancyMap::setResolution(float resolution)
+{
+	if (PX4_ISFINITE(resolution) && (resolution > FLT_EPSILON) && (fabsf(resolution - _resolution) > FLT_EPSILON)) {
+		_resolution = resolution;
+		reset();
+	}
+}
+
+void OccupancyMap::reset()
+{
+	memset(_cells, 0, sizeof(_cells));
+}
+
+void OccupancyMap::setCenter(const Vector3f &position)
+{
+	if (!position.isAllFinite()) {
+		return;
+	}
+
+	const Cell center = toCell(position);
+
+	for (int axis = 0; axis < 3; axis++) {
+		const int size = (axis < 2) ? SIZE_XY : SIZE_Z;
+		const int32_t new_origin = center.xyz[axis] - size / 2;
+		const int32_t shift = new_origin - _origin.xyz[axis];
+
+		if ((shift >= size) || (shift <= -size)) {
+			reset();
+
+		} else if (shift > 0) {
+			// the cells at the low end leave the map, their memory is reused at the high end
+			for (int32_t coordinate = _origin.xyz[axis]; coordinate < new_origin; coordinate++) {
+				clearSlice(axis, coordinate);
+			}
+
+		} else if (shift < 0) {
+			for (int32_t coordinate = new_origin; coordinate < _origin.xyz[axis]; coordinate++) {
+				clearSlice(axis, coordinate);
+			}
+		}
+
+		_origin.xyz[axis] = new_origin;
+	}
+}
+
+void OccupancyMap::insertRay(const Vector3f &origin, const Vector3f &end, bool hit)
+{
+	if (!origin.isAllFinite() || !end.isAllFinite()) {
+		return;
+	}
+
+	const Cell end_cell = toCell(end);
+
+	const bool reached_end = traverse(origin, end, [this, &end_cell, hit](const Cell & cell, float) {
+		if (!inMap(cell)) {
+			return false;
+		}
+
+		if (!hit || !equal(cell, end_cell)) {
+			markFree(cell);
+		}
+
+		return true;
+	});
+
+	if (reached_end && hit && inMap(end_cell)) {
+		markOccupied(end_cell);
+	}
+}
+
+void OccupancyMap::insertDistanceSensor(const distance_sensor_s &distance_sensor, const Vector3f &position,
+					const Quatf &attitude)
+{
+	const float distance = distance_sensor.current_distance;
+
+	if ((distance_sensor.signal_quality == 0) || !PX4_ISFINITE(distance) || (distance < distance_sensor.min_distance)
+	    || (distance_sensor.max_distance <= FLT_EPSILON)) {
+		return;
+	}
+
+	Vector3f direction_body;
+
+	switch (distance_sensor.orientation) {
+	case distance_sensor_s::ROTATION_YAW_0:
+	case distance_sensor_s::ROTATION_YAW_45:
+	case distance_sensor_s::ROTATION_YAW_90:
+	case distance_sensor_s::ROTATION_YAW_135:
+	case distance_sensor_s::ROTATION_YAW_180:
+	case distance_sensor_s::ROTATION_YAW_225:
+	case distance_sensor_s::ROTATION_YAW_270:
+	case distance_sensor_s::ROTATION_YAW_315: {
+			const float yaw = distance_sensor.orientation * M_PI_F / 4.f;
+			direction_body = Vector3f(cosf(yaw), sinf(yaw), 0.f);
+			break;
+		}
+
+	case distance_sensor_s::ROTATION_UPWARD_FACING:
+		direction_body = Vector3f(0.f, 0.f, -1.f);
+		break;
+
+	case distance_sensor_s::ROTATION_DOWNWARD_FACING:
+		direction_body = Vector3f(0.f, 0.f, 1.f);
+		break;
+
+	case distance_sensor_s::ROTATION_CUSTOM:
+		direction_body = Quatf(distance_sensor.q).rotateVector(Vector3f(1.f, 0.f, 0.f));
+		break;
+
+	default:
+		return;
+	}
+
+	const bool hit = distance < distance_sensor.max_distance;
+	const float ray_length = math::min(distance, distance_sensor.max_distance);
+
+	insertRay(position, position + attitude.rotateVector(direction_body) * ray_length, hit);
+}
+
+void OccupancyMap::insertObstacleDistance(const obstacle_distance_s &obstacle, const Vector3f &position,
+		const Quatf &attitude)
+{
+	if (!(obstacle.increment > FLT_EPSILON) || (obstacle.max_distance == 0)) {
+		return;
+	}
+
+	float yaw_offset = 0.f;
+
+	if (obstacle.frame == obstacle_distance_s::MAV_FRAME_BODY_FRD) {
+		yaw_offset = Eulerf(attitude).psi();
+
+	} else if ((obstacle.frame != obstacle_distance_s::MAV_FRAME_GLOBAL)
+		   && (obstacle.frame != obstacle_distance_s::MAV_FRAME_LOCAL_NED)) {
+		return;
+	}
+
+	static constexpr int BIN_COUNT = sizeof(obstacle.distances) / sizeof(obstacle.distances[0]);
+	const int num_bins = math::min(BIN_COUNT, static_cast<int>(360.f / obstacle.increment));
+
+	for (int i = 0; i < num_bins; i++) {
+		const uint16_t distance = obstacle.distances[i];
+
+		if ((distance == UINT16_MAX) || (distance < obstacle.min_distance)) {
+			continue;
+		}
+
+		const float angle = math::radians(obstacle.angle_offset + i * obstacle.increment) + yaw_offset;
+		const Vector3f direction(cosf(angle), sinf(angle), 0.f);
+
+		const bool hit = distance < obstacle.max_distance;
+		const float ray_length = math::min(distance, obstacle.max_distance) * 0.01f; // cm to m
+
+		insertRay(position, position + direction * ray_length, hit);
+	}
+}
+
+OccupancyMap::CellState OccupancyMap::getState(const Vector3f &position) const
+{
+	if (!position.isAllFinite()) {
+		return CellState::Unknown;
+	}
+
+	const Cell cell = toCell(position);
+
+	if (!inMap(cell)) {
+		return CellState::Unknown;
+	}
+
+	return getCell(index(cell));
+}
+
+float OccupancyMap::getClearance(const Vector3f &position, const Vector3f &direction, float max_distance) const
+{
+	if (!position.isAllFinite() || !direction.isAllFinite() || (direction.norm() < FLT_EPSILON)
+	    || !PX4_ISFINITE(max_distance)) {
+		return max_distance;
+	}
+
+	float clearance = max_distance;
+
+	traverse(position, position + direction.normalized() * max_distance, [this, &clearance, max_distance](const Cell & cell,
+	float t) {
+		if (!inMap(cell)) {
+			return false;
+		}
+
+		if (getCell(index(cell)) >= CellState::Occupied) {
+			clearance = t * max_distance;
+			return false;
+		}
+
+		return true;
+	});
+
+	return clearance;
+}
+
+OccupancyMap::Cell OccupancyMap::toCell(const Vector3f &position) const
+{
+	return Cell{{static_cast<int32_t>(floorf(position(0) / _resolution)),
+		     static_cast<int32_t>(floorf(position(1) / _resolution)),
+		     static_cast<int32_t>(floorf(position(2) / _resolution))}};
+}
+
+bool OccupancyMap::inMap(const Cell &cell) const
+{
+	const int32_t x = cell.xyz[0] - _origin.xyz[0];
+	const int32_t y = cell.xyz[1] - _origin.xyz[1];
+	const int32_t z = cell.xyz[2] - _origin.xyz[2];
+
+	return (x >= 0) && (x < SIZE_XY) && (y >= 0) && (y < SIZE_XY) && (z >= 0) && (z < SIZE_Z);
+}
+
+void OccupancyMap::setCell(int index, CellState state)
+{
+	const int shift = 2 * (index % CELLS_PER_BYTE);
+	uint8_t &byte = _cells[index / CELLS_PER_BYTE];
+	byte = static_cast<uint8_t>((byte & ~(0x3 << shift)) | (static_cast<uint8_t>(state) << shift));
+}
+
+void OccupancyMap::markFree(const Cell &cell)
+{
+	const int i = index(cell);
+
+	switch (getCell(i)) {
+	case CellState::OccupiedConfirmed:
+		setCell(i, CellState::Occupied);
+		break;
+
+	case CellState::Occupied:
+	case CellState::Unknown:
+		setCell(i, CellState::Free);
+		break;
+
+	case CellState::Free:
+		break;
+	}
+}
+
+void OccupancyMap::markOccupied(const Cell &cell)
+{
+	const int i = index(cell);
+
+	switch (getCell(i)) {
+	case CellState::Unknown:
+	case CellState::Free:
+		setCell(i, CellState::Occupied);
+		break;
+
+	case CellState::Occupied:
+		setCell(i, CellState::OccupiedConfirmed);
+		break;
+
+	case CellState::OccupiedConfirmed:
+		break;
+	}
+}
+
+void OccupancyMap::clearSlice(int axis, int32_t coordinate)
+{
+	const int size_x = (axis == 0) ? 1 : SIZE_XY;
+	const int size_y = (axis == 1) ? 1 : SIZE_XY;
+	const int size_z = (axis == 2) ? 1 : SIZE_Z;
+
+	for (int z = 0; z < size_z; z++) {
+		for (int y = 0; y < size_y; y++) {
+			for (int x = 0; x < size_x; x++) {
+				const Cell cell{{(axis == 0) ? coordinate : x, (axis == 1) ? coordinate : y, (axis == 2) ? coordinate : z}};
+				setCell(index(cell), CellState::Unknown);
+			}
+		}
+	}
+}
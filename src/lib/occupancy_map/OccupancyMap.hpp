@@ -0,0 +1,183 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file OccupancyMap.hpp
+ *
+ * Rolling 3D occupancy grid around the vehicle, used to remember obstacles
+ * which left the field of view of the range sensors.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <matrix/math.hpp>
+#include <uORB/topics/distance_sensor.h>
+#include <uORB/topics/obstacle_distance.h>
+
+class OccupancyMap
+{
+public:
+	static constexpr int SIZE_XY = 32; ///< number of cells along north and east
+	static constexpr int SIZE_Z = 8; ///< number of cells along down
+	static constexpr int MAX_RAY_STEPS = 2 * SIZE_XY + SIZE_Z; ///< maximum number of cells visited per ray
+
+	enum class CellState : uint8_t {
+		Unknown = 0,
+		Free = 1,
+		Occupied = 2,
+		OccupiedConfirmed = 3
+	};
+
+	OccupancyMap() = default;
+	~OccupancyMap() = default;
+
+	/**
+	 * Set the edge length of a cell, clears the map
+	 * @param resolution edge length of a cell [m]
+	 */
+	void setResolution(float resolution);
+	float getResolution() const { return _resolution; }
+
+	/**
+	 * Clear all cells to unknown
+	 */
+	void reset();
+
+	/**
+	 * Move the center of the map, the cells leaving the map are cleared
+	 * @param position new center in the local NED frame [m]
+	 */
+	void setCenter(const matrix::Vector3f &position);
+
+	/**
+	 * Update the map with a single range measurement
+	 * The cells along the ray are marked free, the end cell is marked occupied for a hit.
+	 * @param origin sensor position in the local NED frame [m]
+	 * @param end end of the measured ray in the local NED frame [m]
+	 * @param hit true if an obstacle was measured at the end of the ray
+	 */
+	void insertRay(const matrix::Vector3f &origin, const matrix::Vector3f &end, bool hit);
+
+	/**
+	 * Update the map with a distance sensor measurement along the sensor boresight
+	 * @param distance_sensor distance sensor message
+	 * @param position vehicle position in the local NED frame [m]
+	 * @param attitude vehicle attitude
+	 */
+	void insertDistanceSensor(const distance_sensor_s &distance_sensor, const matrix::Vector3f &position,
+				  const matrix::Quatf &attitude);
+
+	/**
+	 * Update the map with the horizontal scan of an obstacle distance message
+	 * @param obstacle obstacle distance message
+	 * @param position vehicle position in the local NED frame [m]
+	 * @param attitude vehicle attitude
+	 */
+	void insertObstacleDistance(const obstacle_distance_s &obstacle, const matrix::Vector3f &position,
+				    const matrix::Quatf &attitude);
+
+	/**
+	 * @param position position in the local NED frame [m]
+	 * @return state of the cell containing the position, Unknown outside of the map
+	 */
+	CellState getState(const matrix::Vector3f &position) const;
+
+	bool isOccupied(const matrix::Vector3f &position) const { return getState(position) >= CellState::Occupied; }
+
+	/**
+	 * Distance along a direction to the first occupied cell
+	 * @param position start position in the local NED frame [m]
+	 * @param direction direction to check, does not need to be normalized
+	 * @param max_distance maximum distance to check [m]
+	 * @return distance to the first occupied cell [m], max_distance if none is found within the map
+	 */
+	float getClearance(const matrix::Vector3f &position, const matrix::Vector3f &direction, float max_distance) const;
+
+private:
+	static constexpr int NUM_CELLS = SIZE_XY * SIZE_XY * SIZE_Z;
+	static constexpr int CELLS_PER_BYTE = 4;
+
+	static_assert((SIZE_XY & (SIZE_XY - 1)) == 0, "SIZE_XY needs to be a power of 2");
+	static_assert((SIZE_Z & (SIZE_Z - 1)) == 0, "SIZE_Z needs to be a power of 2");
+
+	struct Cell {
+		int32_t xyz[3]; ///< world cell coordinates
+	};
+
+	static bool equal(const Cell &a, const Cell &b)
+	{
+		return (a.xyz[0] == b.xyz[0]) && (a.xyz[1] == b.xyz[1]) && (a.xyz[2] == b.xyz[2]);
+	}
+
+	Cell toCell(const matrix::Vector3f &position) const;
+	bool inMap(const Cell &cell) const;
+
+	// cells are stored by their world coordinates modulo the map size, so that the map can scroll
+	static int index(const Cell &cell)
+	{
+		return ((cell.xyz[2] & (SIZE_Z - 1)) * SIZE_XY + (cell.xyz[1] & (SIZE_XY - 1))) * SIZE_XY
+		       + (cell.xyz[0] & (SIZE_XY - 1));
+	}
+
+	CellState getCell(int index) const
+	{
+		return static_cast<CellState>((_cells[index / CELLS_PER_BYTE] >> (2 * (index % CELLS_PER_BYTE))) & 0x3);
+	}
+
+	void setCell(int index, CellState state);
+
+	void markFree(const Cell &cell);
+	void markOccupied(const Cell &cell);
+
+	/**
+	 * Clear the cells of the map at the given world coordinate along one axis
+	 * @param axis 0: x, 1: y, 2: z
+	 * @param coordinate world cell coordinate
+	 */
+	void clearSlice(int axis, int32_t coordinate);
+
+	/**
+	 * Walk the cells from start to end (3D DDA), calling visitor(cell, t) for every cell
+	 * including the end cell, with t the ray parameter [0, 1] at which the cell is entered.
+	 * The walk stops early when the visitor returns false or after MAX_RAY_STEPS cells.
+	 * @return true if the end cell was reached
+	 */
+	template<typename Visitor>
+	bool traverse(const matrix::Vector3f &start, const matrix::Vector3f &end, Visitor &&visitor) const;
+
+	uint8_t _cells[NUM_CELLS / CELLS_PER_BYTE] {};
+	float _resolution{0.5f}; ///< edge length of a cell [m]
+	Cell _origin{{-SIZE_XY / 2, -SIZE_XY / 2, -SIZE_Z / 2}}; ///< world cell coordinates of the minimum corner of the map
+};
@@ -0,0 +1,175 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include "OccupancyMap.hpp"
+
+using namespace matrix;
+
+class OccupancyMapTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		_map.setResolution(0.5f);
+		_map.setCenter(Vector3f(0.f, 0.f, 0.f));
+	}
+
+	OccupancyMap _map;
+};
+
+TEST_F(OccupancyMapTest, emptyMap)
+{
+	EXPECT_EQ(_map.getState(Vector3f(1.f, 2.f, 0.f)), OccupancyMap::CellState::Unknown);
+	EXPECT_FLOAT_EQ(_map.getClearance(Vector3f(0.f, 0.f, 0.f), Vector3f(1.f, 0.f, 0.f), 10.f), 10.f);
+}
+
+TEST_F(OccupancyMapTest, rayHit)
+{
+	// WHEN: a range measurement with an obstacle at 5m north is inserted
+	_map.insertRay(Vector3f(0.1f, 0.1f, 0.1f), Vector3f(5.1f, 0.1f, 0.1f), true);
+
+	// THEN: the cells along the ray are free and the end cell is occupied
+	EXPECT_EQ(_map.getState(Vector3f(0.1f, 0.1f, 0.1f)), OccupancyMap::CellState::Free);
+	EXPECT_EQ(_map.getState(Vector3f(2.6f, 0.1f, 0.1f)), OccupancyMap::CellState::Free);
+	EXPECT_TRUE(_map.isOccupied(Vector3f(5.1f, 0.1f, 0.1f)));
+	EXPECT_EQ(_map.getState(Vector3f(6.1f, 0.1f, 0.1f)), OccupancyMap::CellState::Unknown);
+
+	// AND: the clearance towards the obstacle ends at the occupied cell
+	EXPECT_NEAR(_map.getClearance(Vector3f(0.1f, 0.1f, 0.1f), Vector3f(1.f, 0.f, 0.f), 10.f), 4.9f, 0.01f);
+	EXPECT_FLOAT_EQ(_map.getClearance(Vector3f(0.1f, 0.1f, 0.1f), Vector3f(-1.f, 0.f, 0.f), 10.f), 10.f);
+
+	// WHEN: the same obstacle is measured again
+	_map.insertRay(Vector3f(0.1f, 0.1f, 0.1f), Vector3f(5.1f, 0.1f, 0.1f), true);
+
+	// THEN: it is confirmed
+	EXPECT_EQ(_map.getState(Vector3f(5.1f, 0.1f, 0.1f)), OccupancyMap::CellState::OccupiedConfirmed);
+
+	// WHEN: rays pass through the obstacle cell
+	_map.insertRay(Vector3f(0.1f, 0.1f, 0.1f), Vector3f(7.1f, 0.1f, 0.1f), false);
+	_map.insertRay(Vector3f(0.1f, 0.1f, 0.1f), Vector3f(7.1f, 0.1f, 0.1f), false);
+
+	// THEN: it is cleared
+	EXPECT_EQ(_map.getState(Vector3f(5.1f, 0.1f, 0.1f)), OccupancyMap::CellState::Free);
+}
+
+TEST_F(OccupancyMapTest, diagonalRay)
+{
+	const Vector3f origin(0.1f, 0.2f, 0.15f);
+	const Vector3f direction(-3.f, 4.f, 1.f);
+	_map.insertRay(origin, origin + direction, true);
+
+	EXPECT_TRUE(_map.isOccupied(origin + direction));
+	EXPECT_EQ(_map.getState(origin + direction * 0.4f), OccupancyMap::CellState::Free);
+
+	const float clearance = _map.getClearance(origin, direction, 10.f);
+	EXPECT_GT(clearance, 4.5f);
+	EXPECT_LE(clearance, direction.norm());
+}
+
+TEST_F(OccupancyMapTest, scrolling)
+{
+	_map.insertRay(Vector3f(0.f, 0.f, 0.f), Vector3f(-5.f, 0.f, 0.f), true);
+	ASSERT_TRUE(_map.isOccupied(Vector3f(-5.f, 0.f, 0.f)));
+
+	// WHEN: the map moves a few meters, the obstacle stays within the map
+	_map.setCenter(Vector3f(2.f, 0.f, 0.f));
+	EXPECT_TRUE(_map.isOccupied(Vector3f(-5.f, 0.f, 0.f)));
+
+	// WHEN: the obstacle leaves the map
+	_map.setCenter(Vector3f(10.f, 0.f, 0.f));
+	EXPECT_EQ(_map.getState(Vector3f(-5.f, 0.f, 0.f)), OccupancyMap::CellState::Unknown);
+
+	// THEN: its memory is cleared before being reused on the other side
+	_map.setCenter(Vector3f(0.f, 0.f, 0.f));
+	EXPECT_EQ(_map.getState(Vector3f(-5.f, 0.f, 0.f)), OccupancyMap::CellState::Unknown);
+
+	for (float x = -7.5f; x < 7.5f; x += 0.5f) {
+		EXPECT_EQ(_map.getState(Vector3f(x, 0.f, 0.f)), OccupancyMap::CellState::Unknown) << x;
+	}
+}
+
+TEST_F(OccupancyMapTest, distanceSensor)
+{
+	distance_sensor_s distance_sensor{};
+	distance_sensor.min_distance = 0.2f;
+	distance_sensor.max_distance = 8.f;
+	distance_sensor.current_distance = 3.f;
+	distance_sensor.signal_quality = -1;
+	distance_sensor.orientation = distance_sensor_s::ROTATION_YAW_90;
+
+	const Vector3f position(0.2f, 0.2f, 0.2f);
+
+	// WHEN: the vehicle faces north and the sensor points to the right
+	_map.insertDistanceSensor(distance_sensor, position, Quatf());
+
+	// THEN: the obstacle is east of the vehicle
+	EXPECT_TRUE(_map.isOccupied(position + Vector3f(0.f, 3.f, 0.f)));
+
+	// WHEN: the vehicle is yawed by 90 degrees
+	_map.insertDistanceSensor(distance_sensor, position, Quatf(Eulerf(0.f, 0.f, M_PI_F / 2.f)));
+
+	// THEN: the obstacle is south of the vehicle
+	EXPECT_TRUE(_map.isOccupied(position + Vector3f(-3.f, 0.f, 0.f)));
+
+	// WHEN: the measurement is out of range
+	distance_sensor.current_distance = 10.f;
+	_map.insertDistanceSensor(distance_sensor, position, Quatf());
+
+	// THEN: the ray up to the maximum range is free
+	EXPECT_EQ(_map.getState(position + Vector3f(0.f, 3.f, 0.f)), OccupancyMap::CellState::Free);
+	EXPECT_EQ(_map.getState(position + Vector3f(0.f, 7.5f, 0.f)), OccupancyMap::CellState::Free);
+}
+
+TEST_F(OccupancyMapTest, obstacleDistance)
+{
+	obstacle_distance_s obstacle{};
+	obstacle.frame = obstacle_distance_s::MAV_FRAME_LOCAL_NED;
+	obstacle.increment = 5.f;
+	obstacle.min_distance = 20;
+	obstacle.max_distance = 1000;
+
+	for (auto &distance : obstacle.distances) {
+		distance = UINT16_MAX;
+	}
+
+	obstacle.distances[0] = 400; // north
+	obstacle.distances[18] = 1001; // east, no obstacle
+
+	const Vector3f position(0.2f, 0.2f, 0.2f);
+	_map.insertObstacleDistance(obstacle, position, Quatf());
+
+	EXPECT_TRUE(_map.isOccupied(position + Vector3f(4.f, 0.f, 0.f)));
+	EXPECT_EQ(_map.getState(position + Vector3f(0.f, 5.f, 0.f)), OccupancyMap::CellState::Free);
+	EXPECT_EQ(_map.getState(position + Vector3f(-4.f, 0.f, 0.f)), OccupancyMap::CellState::Unknown);
+}
@@ -37,6 +37,13 @@
 
 #include <px4_platform_common/atomic.h>
 
+/**
+ * Sparse layer of parameter values, sorted by param_t
+ *
+ * Writers are serialized with AtomicTransaction. Readers (get(), contains()) don't lock:
+ * parameters that are not stored are rejected with a bitset indexed by param_t, lookups of stored
+ * ones are validated with a sequence counter (seqlock) and retried if a write was in progress.
+ */
 class DynamicSparseLayer : public ParamLayer
 {
 public:
@@ -63,6 +70,8 @@ public:
 		if (_slots.load()) {
 			free(_slots.load());
 		}
+
+		free(_retired_slots);
 	}
 
 	bool store(param_t param, param_value_u value) override
@@ -73,19 +82,20 @@ public:
 		const int index = _getIndex(param);
 
 		if (index < _next_slot) { // already exists
+			_beginWrite();
 			slots[index].value = value;
-
-		} else if (_next_slot < _n_slots) {
-			slots[_next_slot++] = {param, value};
-			_sort();
+			_endWrite();
 
 		} else {
-			if (!_grow(transaction)) {
+			if ((_next_slot >= _n_slots) && !_grow(transaction)) {
 				return false;
 			}
 
+			_beginWrite();
 			_slots.load()[_next_slot++] = {param, value};
 			_sort();
+			_contained.set(param);
+			_endWrite();
 		}
 
 		return true;
@@ -93,8 +103,7 @@ public:
 
 	bool contains(param_t param) const override
 	{
-		const AtomicTransaction transaction;
-		return _getIndex(param) < _next_slot;
+		return (param < PARAM_COUNT) && _contained[param];
 	}
 
 	px4::AtomicBitset<PARAM_COUNT> containedAsBitset() const override
@@ -112,13 +121,33 @@ public:
 
 	param_value_u get(param_t param) const override
 	{
-		const AtomicTransaction transaction;
-		Slot *slots = _slots.load();
+		if (!contains(param)) {
+			return _parent->get(param);
+		}
+
+		for (int retry = 0; retry < MAX_READ_RETRIES; retry++) {
+			const uint32_t sequence = _sequence.load();
+
+			if (sequence & 1) {
+				// write in progress
+				continue;
+			}
 
+			const int index = _getIndex(param);
+			const bool found = index < _next_slot;
+			const param_value_u value = found ? _slots.load()[index].value : param_value_u{};
+
+			if (_sequence.load() == sequence) {
+				return found ? value : _parent->get(param);
+			}
+		}
+
+		// keep retrying under the lock, so that a preempted writer can finish
+		const AtomicTransaction transaction;
 		const int index = _getIndex(param);
 
-		if (index < _next_slot) { // exists in our data structure
-			return slots[index].value;
+		if (index < _next_slot) {
+			return _slots.load()[index].value;
 		}
 
 		return _parent->get(param);
@@ -131,9 +160,12 @@ public:
 		Slot *slots = _slots.load();
 
 		if (index < _next_slot) {
+			_beginWrite();
+			_contained.set(param, false);
 			slots[index] = {UINT16_MAX, param_value_u{}};
 			_sort();
 			_next_slot--;
+			_endWrite();
 		}
 	}
 
@@ -158,6 +190,12 @@ private:
 		param_value_u value;
 	};
 
+	static constexpr int MAX_READ_RETRIES = 4;
+
+	// the sequence is odd while a write is in progress, must be called with the transaction locked
+	void _beginWrite() { _sequence.fetch_add(1); }
+	void _endWrite() { _sequence.fetch_add(1); }
+
 	static int _slotCompare(const void *a, const void *b)
 	{
 		return ((int)((Slot *)a)->param) - ((int)((Slot *)b)->param);
@@ -220,7 +258,7 @@ private:
 					return false;
 				}
 
-			} while (!_slots.compare_exchange(&previous_slots, new_slots));
+			} while (_slots.load() != previous_slots); // another writer grew the buffer in the meantime
 
 			memcpy(new_slots, previous_slots, sizeof(Slot) * _n_slots);
 
@@ -228,10 +266,17 @@ private:
 				new_slots[i] = {UINT16_MAX, param_value_u{}};
 			}
 
+			_beginWrite();
+			_slots.store(new_slots);
 			_n_slots += _n_grow;
+			_endWrite();
+
+			// lock-free readers might still access the previous buffer, it is only freed with the next grow
+			Slot *retired_slots = _retired_slots;
+			_retired_slots = previous_slots;
 
 			transaction.unlock();
-			free(previous_slots);
+			free(retired_slots);
 			transaction.lock();
 		}
 
@@ -242,4 +287,8 @@ private:
 	int _n_slots = 0;
 	const int _n_grow;
 	px4::atomic<Slot *> _slots{nullptr};
+	Slot *_retired_slots{nullptr};
+
+	px4::atomic<uint32_t> _sequence{0};
+	px4::AtomicBitset<PARAM_COUNT> _contained;
 };
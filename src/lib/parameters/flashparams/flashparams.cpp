@@ -60,6 +60,10 @@
 #include "flashfs.h"
 #include "../param_translation.h"
 
+#if defined(CONFIG_PARAM_JOURNAL)
+#include "../param_journal.h"
+#endif
+
 #if 0
 # define debug(fmt, args...)            do { warnx(fmt, ##args); } while(0)
 #else
@@ -75,6 +79,119 @@ struct param_wbuf_s {
 	param_t                 param;
 };
 
+/**
+ * Write the encoded parameters to flash, unless they did not change
+ */
+static int
+param_commit(const void *data, size_t size)
+{
+	/* Get a buffer from the flash driver with enough space */
+
+	size_t buf_size = size;
+	uint8_t *buffer;
+	int result = parameter_flashfs_alloc(parameters_token, &buffer, &buf_size);
+
+	if (result == OK) {
+
+		/* Check for a write that has no changes */
+
+		uint8_t *was_buffer;
+		size_t was_buf_size;
+		int was_result = parameter_flashfs_read(parameters_token, &was_buffer, &was_buf_size);
+
+		bool commit = was_result < OK || was_buf_size != size || 0 != memcmp(was_buffer, data, was_buf_size);
+
+		if (commit) {
+
+			memcpy(buffer, data, size);
+			result = parameter_flashfs_write(parameters_token, buffer, size);
+			result = result == size ? OK : -EFBIG;
+
+		}
+
+		parameter_flashfs_free();
+	}
+
+	return result;
+}
+
+#if defined(CONFIG_PARAM_JOURNAL)
+/*
+ * flashfs already appends a new entry per save and only erases a sector once it is full,
+ * the parameters are stored as journal records so that the import does not need to decode BSON.
+ */
+static int
+param_journal_export_internal(param_filter_func filter)
+{
+	auto changed_params = user_config.containedAsBitset();
+	size_t count = 0;
+
+	for (param_t param = 0; param < user_config.PARAM_COUNT; param++) {
+		if (changed_params[param] && (!filter || filter(param))) {
+			count++;
+		}
+	}
+
+	uint8_t *data = (uint8_t *)malloc(param_journal::HEADER_SIZE + count * param_journal::MAX_RECORD_SIZE);
+
+	if (data == nullptr) {
+		return -ENOMEM;
+	}
+
+	size_t size = param_journal::encode_header(data);
+
+	for (param_t param = 0; (param < user_config.PARAM_COUNT) && (count > 0); param++) {
+		if (!changed_params[param] || (filter && !filter(param))) {
+			continue;
+		}
+
+		param_journal::Record record;
+		param_journal::make_record(param, user_config.get(param), false, record);
+		size += param_journal::encode(record, &data[size]);
+		count--;
+	}
+
+	int result = param_commit(data, size);
+	free(data);
+	return result;
+}
+
+static int
+param_journal_import_internal(const uint8_t *buffer, size_t buf_size)
+{
+	size_t offset = param_journal::HEADER_SIZE;
+	param_journal::Record record;
+
+	while (size_t record_size = param_journal::decode(&buffer[offset], buf_size - offset, record)) {
+		offset += record_size;
+
+		if (!param_journal::translate(record)) {
+			continue;
+		}
+
+		param_t param = param_find_no_notification(record.name);
+
+		if (param == PARAM_INVALID) {
+			debug("ignoring unrecognised parameter '%s'", record.name);
+			continue;
+		}
+
+		const bool is_float = (record.type == param_journal::RecordType::Float);
+
+		if ((record.type == param_journal::RecordType::Default) || (is_float != (param_type(param) == PARAM_TYPE_FLOAT))) {
+			PX4_WARN("unexpected type for %s", record.name);
+			continue;
+		}
+
+		if (param_set_external(param, &record.value, true, true)) {
+			debug("error setting value for '%s'", record.name);
+		}
+	}
+
+	return (offset == buf_size) ? 0 : -1;
+}
+#endif // CONFIG_PARAM_JOURNAL
+
 static int
 param_export_internal(param_filter_func filter)
 {
@@ -134,38 +251,9 @@ out:
 
 		bson_encoder_fini(&encoder);
 
-		/* Get requiered space */
-
-		size_t buf_size = bson_encoder_buf_size(&encoder);
-
-		/* Get a buffer from the flash driver with enough space */
-
-		uint8_t *buffer;
-		result = parameter_flashfs_alloc(parameters_token, &buffer, &buf_size);
-
-		if (result == OK) {
-
-			/* Check for a write that has no changes */
-
-			uint8_t *was_buffer;
-			size_t was_buf_size;
-			int was_result = parameter_flashfs_read(parameters_token, &was_buffer, &was_buf_size);
-
-			void *enc_buff = bson_encoder_buf_data(&encoder);
-
-			bool commit = was_result < OK || was_buf_size != buf_size || 0 != memcmp(was_buffer, enc_buff, was_buf_size);
-
-			if (commit) {
-
-				memcpy(buffer, enc_buff, buf_size);
-				result = parameter_flashfs_write(parameters_token, buffer, buf_size);
-				result = result == buf_size ? OK : -EFBIG;
-
-			}
-
-			free(enc_buff);
-			parameter_flashfs_free();
-		}
+		void *enc_buff = bson_encoder_buf_data(&encoder);
+		result = param_commit(enc_buff, bson_encoder_buf_size(&encoder));
+		free(enc_buff);
 	}
 
 	return result;
@@ -259,6 +347,14 @@ param_import_internal()
 	size_t buf_size;
 	parameter_flashfs_read(parameters_token, &buffer, &buf_size);
 
+#if defined(CONFIG_PARAM_JOURNAL)
+
+	if (buffer && param_journal::is_journal(buffer, buf_size)) {
+		return param_journal_import_internal(buffer, buf_size);
+	}
+
+#endif
+
 	if (bson_decoder_init_buf(&decoder, buffer, buf_size, param_import_callback)) {
 		debug("decoder init failed");
 		goto out;
@@ -280,7 +376,11 @@ out:
 
 int flash_param_save(param_filter_func filter)
 {
+#if defined(CONFIG_PARAM_JOURNAL)
+	return param_journal_export_internal(filter);
+#else
 	return param_export_internal(filter);
+#endif
 }
 
 int flash_param_load()
@@ -0,0 +1,179 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file param_journal.cpp
+ *
+ * Encoding of the append-only parameter storage records.
+ */
+
+#include "param_journal.h"
+#include "param_translation.h"
+
+#include <crc32.h>
+#include <string.h>
+
+namespace param_journal
+{
+
+static void put_u32(uint8_t *buffer, uint32_t value)
+{
+	buffer[0] = value & 0xff;
+	buffer[1] = (value >> 8) & 0xff;
+	buffer[2] = (value >> 16) & 0xff;
+	buffer[3] = (value >> 24) & 0xff;
+}
+
+static uint32_t get_u32(const uint8_t *buffer)
+{
+	return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+size_t encode_header(uint8_t *buffer)
+{
+	put_u32(buffer, MAGIC);
+	buffer[4] = VERSION & 0xff;
+	buffer[5] = (VERSION >> 8) & 0xff;
+	buffer[6] = 0;
+	buffer[7] = 0;
+	return HEADER_SIZE;
+}
+
+bool is_journal(const uint8_t *buffer, size_t size)
+{
+	return (size >= HEADER_SIZE) && (get_u32(buffer) == MAGIC) && (buffer[4] == (VERSION & 0xff))
+	       && (buffer[5] == ((VERSION >> 8) & 0xff));
+}
+
+void make_record(param_t param, const param_value_u &value, bool is_default, Record &record)
+{
+	if (is_default) {
+		record.type = RecordType::Default;
+
+	} else {
+		record.type = (param_type(param) == PARAM_TYPE_FLOAT) ? RecordType::Float : RecordType::Int32;
+	}
+
+	strncpy(record.name, param_name(param), sizeof(record.name) - 1);
+	record.name[sizeof(record.name) - 1] = '\0';
+	record.value = value;
+}
+
+size_t encode(const Record &record, uint8_t *buffer)
+{
+	const size_t name_length = strnlen(record.name, MAX_NAME_LENGTH);
+	size_t size = 0;
+
+	buffer[size++] = (uint8_t)record.type;
+	buffer[size++] = (uint8_t)name_length;
+	memcpy(&buffer[size], record.name, name_length);
+	size += name_length;
+
+	uint32_t value = 0;
+	memcpy(&value, &record.value, sizeof(value));
+	put_u32(&buffer[size], value);
+	size += 4;
+
+	put_u32(&buffer[size], crc32part(buffer, size, 0));
+	size += 4;
+
+	return size;
+}
+
+size_t decode(const uint8_t *buffer, size_t size, Record &record)
+{
+	if (size < 2) {
+		return 0;
+	}
+
+	const RecordType type = (RecordType)buffer[0];
+	const size_t name_length = buffer[1];
+	const size_t record_size = 2 + name_length + 4 + 4;
+
+	if ((type != RecordType::Int32 && type != RecordType::Float && type != RecordType::Default)
+	    || (name_length == 0) || (name_length > MAX_NAME_LENGTH) || (size < record_size)) {
+		return 0;
+	}
+
+	if (crc32part(buffer, record_size - 4, 0) != get_u32(&buffer[record_size - 4])) {
+		return 0;
+	}
+
+	record.type = type;
+	memcpy(record.name, &buffer[2], name_length);
+	record.name[name_length] = '\0';
+
+	const uint32_t value = get_u32(&buffer[2 + name_length]);
+	memcpy(&record.value, &value, sizeof(value));
+
+	return record_size;
+}
+
+bool translate(Record &record)
+{
+	if (record.type == RecordType::Default) {
+		return true;
+	}
+
+	bson_node_s node{};
+	strncpy(node.name, record.name, sizeof(node.name) - 1);
+
+	if (record.type == RecordType::Float) {
+		node.type = BSON_DOUBLE;
+		node.d = (double)record.value.f;
+
+	} else {
+		node.type = BSON_INT32;
+		node.i32 = record.value.i;
+	}
+
+	if (param_modify_on_import(&node) == param_modify_on_import_ret::PARAM_SKIP_IMPORT) {
+		return false;
+	}
+
+	strncpy(record.name, node.name, sizeof(record.name) - 1);
+	record.name[sizeof(record.name) - 1] = '\0';
+
+	if (node.type == BSON_DOUBLE) {
+		record.type = RecordType::Float;
+		record.value.f = (float)node.d;
+
+	} else {
+		record.type = RecordType::Int32;
+		record.value.i = node.i32;
+	}
+
+	return true;
+}
+
+} // namespace param_journal
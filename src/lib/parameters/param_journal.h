@@ -0,0 +1,113 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file param_journal.h
+ *
+ * Append-only (log structured) parameter storage format.
+ *
+ * The file starts with a header, followed by records in the order the parameters were saved.
+ * Each record stores one parameter value (or that it was reset to default) and a CRC, so a scan
+ * stops at the first torn or corrupt record and the last record of a parameter wins.
+ * Saves only append the parameters changed since the previous save, a compaction rewrites one
+ * record per non-default parameter once the outdated records dominate.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <parameters/param.h>
+
+namespace param_journal
+{
+
+static constexpr uint32_t MAGIC = 0x4e524a50; // "PJRN"
+static constexpr uint16_t VERSION = 1;
+static constexpr size_t HEADER_SIZE = 8;
+
+static constexpr size_t MAX_NAME_LENGTH = 16;
+
+// type, name length, name, value, crc32
+static constexpr size_t MAX_RECORD_SIZE = 1 + 1 + MAX_NAME_LENGTH + 4 + 4;
+
+enum class RecordType : uint8_t {
+	Int32 = 1,
+	Float = 2,
+	Default = 3, // parameter reset to its default value
+};
+
+struct Record {
+	RecordType type;
+	char name[MAX_NAME_LENGTH + 1];
+	param_value_u value;
+};
+
+/**
+ * Write the file header
+ * @return HEADER_SIZE
+ */
+size_t encode_header(uint8_t *buffer);
+
+/**
+ * @return true if the buffer starts with a journal header
+ */
+bool is_journal(const uint8_t *buffer, size_t size);
+
+/**
+ * Fill the record of a parameter
+ * @param is_default store a Default record instead of the value
+ */
+void make_record(param_t param, const param_value_u &value, bool is_default, Record &record);
+
+/**
+ * Encode a record
+ * @param buffer at least MAX_RECORD_SIZE bytes
+ * @return number of bytes written
+ */
+size_t encode(const Record &record, uint8_t *buffer);
+
+/**
+ * Decode the record at the start of buffer
+ * @return number of bytes consumed, 0 if the buffer does not hold a complete valid record
+ */
+size_t decode(const uint8_t *buffer, size_t size, Record &record);
+
+/**
+ * Apply the parameter translations of the BSON import (param_modify_on_import()) to a record
+ * @return false if the record is handled by the translation and must not be imported
+ */
+bool translate(Record &record);
+
+} // namespace param_journal
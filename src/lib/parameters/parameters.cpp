@@ -56,6 +56,7 @@
 #include <lib/perf/perf_counter.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/atomic_bitset.h>
+#include <px4_platform_common/boot_trace.h>
 #include <px4_platform_common/defines.h>
 #include <px4_platform_common/posix.h>
 #include <px4_platform_common/sem.h>
@@ -75,6 +76,10 @@ using namespace time_literals;
 
 #include "atomic_transaction.h"
 
+#if defined(CONFIG_PARAM_JOURNAL)
+#include "param_journal.h"
+#endif
+
 /* Include functions common to user and kernel sides */
 #include "parameters_common.cpp"
 
@@ -108,6 +113,11 @@ DynamicSparseLayer user_config{&runtime_defaults};
 #if not defined(CONFIG_PARAM_REMOTE)
 static orb_advert_t param_topic = nullptr;
 static unsigned int param_instance = 0;
+
+// parameters changed since the last parameter_update notification, protected by AtomicTransaction
+static param_t params_changed[parameter_update_s::CHANGED_PARAMS_MAX];
+static uint8_t params_changed_count = 0;
+static bool params_changed_overflow = false;
 #endif
 
 static perf_counter_t param_export_perf;
@@ -130,7 +140,7 @@ void
 param_init()
 {
 	param_export_perf = perf_alloc(PC_ELAPSED, "param: export");
-	param_find_perf = perf_alloc(PC_COUNT, "param: find");
+	param_find_perf = perf_alloc(PC_ELAPSED, "param: find");
 	param_get_perf = perf_alloc(PC_COUNT, "param: get");
 	param_set_perf = perf_alloc(PC_ELAPSED, "param: set");
 
@@ -167,6 +177,21 @@ param_notify_changes()
 	pup.active = params_active.count();
 	pup.changed = user_config.size();
 	pup.custom_default = runtime_defaults.size();
+
+	{
+		const AtomicTransaction transaction;
+
+		for (int i = 0; i < params_changed_count; i++) {
+			pup.changed_params[i] = params_changed[i];
+		}
+
+		pup.changed_params_count = params_changed_count;
+		pup.changed_params_overflow = params_changed_overflow;
+
+		params_changed_count = 0;
+		params_changed_overflow = false;
+	}
+
 	pup.timestamp = hrt_absolute_time();
 
 	if (param_topic == nullptr) {
@@ -179,41 +204,80 @@ param_notify_changes()
 #endif
 }
 
-static param_t param_find_internal(const char *name, bool notification)
+/**
+ * Remember a changed parameter for the next parameter_update notification.
+ * If more parameters change than fit into the message the overflow flag tells the subscribers to update all.
+ */
+static void
+param_record_change(param_t param)
 {
-	perf_count(param_find_perf);
+#if not defined(CONFIG_PARAM_REMOTE)
+	const AtomicTransaction transaction;
 
-	param_t middle;
-	param_t front = 0;
-	param_t last = param_info_count;
+	for (int i = 0; i < params_changed_count; i++) {
+		if (params_changed[i] == param) {
+			return;
+		}
+	}
 
-	/* perform a binary search of the known parameters */
+	if (params_changed_count < parameter_update_s::CHANGED_PARAMS_MAX) {
+		params_changed[params_changed_count++] = param;
 
-	while (front <= last) {
-		middle = front + (last - front) / 2;
-		int ret = strcmp(name, param_name(middle));
+	} else {
+		params_changed_overflow = true;
+	}
 
-		if (ret == 0) {
-			if (notification) {
-				param_set_used(middle);
-			}
+#endif
+}
 
-			return middle;
+/**
+ * Seeded 32 bit FNV-1a hash with a final mix step, must match param_name_hash() in px_generate_params.py
+ */
+static uint32_t param_name_hash(const char *name, uint32_t seed)
+{
+	uint32_t hash = 0x811c9dc5u ^ seed;
 
-		} else if (middle == front) {
-			/* An end point has been hit, but there has been no match */
-			break;
+	for (const char *c = name; *c != '\0'; c++) {
+		hash ^= static_cast<uint8_t>(*c);
+		hash *= 0x01000193u;
+	}
 
-		} else if (ret < 0) {
-			last = middle;
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bu;
+	hash ^= hash >> 13;
+	return hash;
+}
 
-		} else {
-			front = middle;
+static param_t param_find_internal(const char *name, bool notification)
+{
+	static constexpr uint32_t num_buckets = sizeof(px4::parameters_hash_displacement) / sizeof(
+			px4::parameters_hash_displacement[0]);
+	static_assert(sizeof(px4::parameters_hash_table) / sizeof(px4::parameters_hash_table[0]) >= param_info_count,
+		      "parameter hash table too small");
+
+	perf_begin(param_find_perf);
+
+	param_t param = PARAM_INVALID;
+
+	if (param_info_count > 0) {
+		// minimal perfect hash generated at build time: every name maps to a unique slot,
+		// a single comparison rejects unknown names
+		const uint32_t bucket = param_name_hash(name, 0) % num_buckets;
+		const uint32_t slot = param_name_hash(name, px4::parameters_hash_displacement[bucket]) % param_info_count;
+		const param_t candidate = px4::parameters_hash_table[slot];
+
+		if (strcmp(name, param_name(candidate)) == 0) {
+			if (notification) {
+				param_set_used(candidate);
+			}
+
+			param = candidate;
 		}
 	}
 
-	/* not found */
-	return PARAM_INVALID;
+	perf_end(param_find_perf);
+
+	return param;
 }
 
 param_t param_find(const char *name)
@@ -442,6 +506,10 @@ param_set_internal(param_t param, const void *val, bool mark_saved, bool notify_
 		result = PX4_ERROR;
 	}
 
+	if ((result == PX4_OK) && param_changed) {
+		param_record_change(param);
+	}
+
 	if ((result == PX4_OK) && param_changed && !mark_saved) { // this is false when importing parameters
 		param_autosave();
 	}
@@ -582,6 +650,7 @@ int param_set_default_value(param_t param, const void *val)
 
 		if (runtime_defaults.store(param, new_value)) {
 			user_config.refresh(param);
+			param_record_change(param);
 			result = PX4_OK;
 
 		} else {
@@ -611,6 +680,11 @@ static int param_reset_internal(param_t param, bool notify = true, bool autosave
 		user_config.reset(param);
 	}
 
+	if (param_found) {
+		param_record_change(param);
+		params_unsaved.set(param, true);
+	}
+
 	if (autosave) {
 		param_autosave();
 	}
@@ -771,6 +845,15 @@ const char *param_get_backup_file()
 
 static int param_export_internal(int fd, param_filter_func filter);
 static int param_verify(int fd);
+static int param_import_internal(int fd, int *journal_records);
+
+#if defined(CONFIG_PARAM_JOURNAL)
+static int param_journal_save(const char *filename);
+static int param_journal_import(int fd, int *num_records);
+
+// number of records in the default parameter file, -1 if it is not a valid journal (the next save compacts)
+static int param_journal_records = -1;
+#endif
 
 int param_save_default(bool blocking)
 {
@@ -796,6 +879,25 @@ int param_save_default(bool blocking)
 	int res = PX4_ERROR;
 	const char *filename = param_get_default_file();
 
+#if defined(CONFIG_PARAM_JOURNAL)
+
+	if (filename) {
+		perf_begin(param_export_perf);
+		res = param_journal_save(filename);
+		perf_end(param_export_perf);
+
+		if (res != PX4_OK) {
+			PX4_ERR("parameter journal write to %s failed (%d)", filename, res);
+		}
+
+	} else {
+		perf_begin(param_export_perf);
+		res = flash_param_save(nullptr);
+		perf_end(param_export_perf);
+	}
+
+#else
+
 	if (filename) {
 		static constexpr int MAX_ATTEMPTS = 3;
 
@@ -832,6 +934,8 @@ int param_save_default(bool blocking)
 		perf_end(param_export_perf);
 	}
 
+#endif
+
 	if (res != PX4_OK) {
 		PX4_ERR("param export failed (%d)", res);
 
@@ -874,6 +978,7 @@ int param_save_default(bool blocking)
 int
 param_load_default()
 {
+	px4::BootTraceScope trace{"param load"};
 	int res = 0;
 	const char *filename = param_get_default_file();
 
@@ -893,7 +998,12 @@ param_load_default()
 		return 1;
 	}
 
+#if defined(CONFIG_PARAM_JOURNAL)
+	param_reset_all_internal(false);
+	int result = param_import_internal(fd_load, &param_journal_records);
+#else
 	int result = param_load(fd_load);
+#endif
 	::close(fd_load);
 
 	if (result != 0) {
@@ -1140,6 +1250,293 @@ out:
 	return result;
 }
 
+#if defined(CONFIG_PARAM_JOURNAL)
+
+// compact once the journal holds this many more records than there are non-default parameters
+static constexpr int PARAM_JOURNAL_COMPACT_SLACK = 64;
+
+// true if the current value of a parameter differs from its default and has to be stored
+static bool param_journal_stores_value(param_t param, param_value_u &value)
+{
+	if (!user_config.contains(param)) {
+		return false;
+	}
+
+	value = user_config.get(param);
+	const param_value_u runtime_default_value = runtime_defaults.get(param);
+
+	switch (param_type(param)) {
+	case PARAM_TYPE_INT32:
+		return value.i != runtime_default_value.i;
+
+	case PARAM_TYPE_FLOAT:
+		return fabsf(value.f - runtime_default_value.f) > FLT_EPSILON;
+	}
+
+	return false;
+}
+
+// write the buffered records
+static int param_journal_flush(int fd, const uint8_t *buffer, size_t size)
+{
+	if (size > 0 && ::write(fd, buffer, size) != (ssize_t)size) {
+		PX4_ERR("journal write failed (%d)", errno);
+		return -1;
+	}
+
+	return 0;
+}
+
+// check that the file holds num_records valid records from offset on
+static int param_journal_verify(const char *filename, off_t offset, int num_records)
+{
+	int fd = ::open(filename, O_RDONLY, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		return -1;
+	}
+
+	int records = -1;
+
+	if (lseek(fd, offset, SEEK_SET) == offset) {
+		records = 0;
+		uint8_t buffer[256];
+		size_t size = 0;
+		bool eof = false;
+
+		while (true) {
+			while (!eof && size < param_journal::MAX_RECORD_SIZE) {
+				const ssize_t ret = ::read(fd, &buffer[size], sizeof(buffer) - size);
+				eof = (ret <= 0);
+
+				if (ret > 0) {
+					size += ret;
+				}
+			}
+
+			param_journal::Record record;
+			const size_t record_size = param_journal::decode(buffer, size, record);
+
+			if (record_size == 0) {
+				break;
+			}
+
+			records++;
+			size -= record_size;
+			memmove(buffer, &buffer[record_size], size);
+		}
+
+		if (size > 0) {
+			records = -1;
+		}
+	}
+
+	::close(fd);
+	return (records == num_records) ? PX4_OK : PX4_ERROR;
+}
+
+// rewrite the journal with one record per non-default parameter
+static int param_journal_compact(const char *filename)
+{
+	int fd = ::open(filename, O_WRONLY | O_CREAT | O_TRUNC, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		PX4_ERR("open '%s' for writing failed", filename);
+		return PX4_ERROR;
+	}
+
+	uint8_t buffer[256];
+	size_t size = param_journal::encode_header(buffer);
+	int records = 0;
+	int result = PX4_OK;
+
+	for (param_t param = 0; handle_in_range(param) && (result == PX4_OK); param++) {
+		param_value_u value;
+
+		if (!param_journal_stores_value(param, value)) {
+			continue;
+		}
+
+		if (size + param_journal::MAX_RECORD_SIZE > sizeof(buffer)) {
+			result = param_journal_flush(fd, buffer, size);
+			size = 0;
+		}
+
+		param_journal::Record record;
+		param_journal::make_record(param, value, false, record);
+		size += param_journal::encode(record, &buffer[size]);
+		records++;
+	}
+
+	if (result == PX4_OK) {
+		result = param_journal_flush(fd, buffer, size);
+	}
+
+	fsync(fd);
+	::close(fd);
+
+	if (result == PX4_OK) {
+		result = param_journal_verify(filename, param_journal::HEADER_SIZE, records);
+	}
+
+	param_journal_records = (result == PX4_OK) ? records : -1;
+	PX4_DEBUG("journal compacted to %d records", records);
+	return result;
+}
+
+// append the parameters changed since the last save, compact when most of the journal is outdated
+static int param_journal_save(const char *filename)
+{
+	const int num_unsaved = params_unsaved.count();
+
+	if ((param_journal_records < 0)
+	    || (param_journal_records + num_unsaved > 2 * user_config.size() + PARAM_JOURNAL_COMPACT_SLACK)) {
+		return param_journal_compact(filename);
+	}
+
+	if (num_unsaved == 0) {
+		return PX4_OK;
+	}
+
+	int fd = ::open(filename, O_WRONLY | O_APPEND, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		return param_journal_compact(filename);
+	}
+
+	const off_t offset = lseek(fd, 0, SEEK_END);
+	uint8_t buffer[256];
+	size_t size = 0;
+	int records = 0;
+	int result = (offset >= (off_t)param_journal::HEADER_SIZE) ? PX4_OK : PX4_ERROR;
+
+	for (param_t param = 0; handle_in_range(param) && (result == PX4_OK); param++) {
+		if (!params_unsaved[param]) {
+			continue;
+		}
+
+		if (size + param_journal::MAX_RECORD_SIZE > sizeof(buffer)) {
+			result = param_journal_flush(fd, buffer, size);
+			size = 0;
+		}
+
+		param_value_u value{};
+		const bool is_default = !param_journal_stores_value(param, value);
+
+		param_journal::Record record;
+		param_journal::make_record(param, value, is_default, record);
+		size += param_journal::encode(record, &buffer[size]);
+		records++;
+	}
+
+	if (result == PX4_OK) {
+		result = param_journal_flush(fd, buffer, size);
+	}
+
+	fsync(fd);
+	::close(fd);
+
+	if ((result != PX4_OK) || (param_journal_verify(filename, offset, records) != PX4_OK)) {
+		PX4_WARN("journal append failed, rewriting %s", filename);
+		return param_journal_compact(filename);
+	}
+
+	param_journal_records += records;
+	return PX4_OK;
+}
+
+static void param_journal_apply(param_journal::Record &record)
+{
+	if (!param_journal::translate(record)) {
+		return;
+	}
+
+	param_t param = param_find_no_notification(record.name);
+
+	if (param == PARAM_INVALID) {
+		PX4_WARN("ignoring unrecognised parameter '%s'", record.name);
+		return;
+	}
+
+	switch (record.type) {
+	case param_journal::RecordType::Default:
+		param_reset_internal(param, true, false);
+		params_unsaved.set(param, false);
+		break;
+
+	case param_journal::RecordType::Int32:
+		if (param_type(param) == PARAM_TYPE_INT32) {
+			param_set_internal(param, &record.value.i, true, true);
+
+		} else {
+			PX4_WARN("unexpected type for %s", record.name);
+		}
+
+		break;
+
+	case param_journal::RecordType::Float:
+		if (param_type(param) == PARAM_TYPE_FLOAT) {
+			param_set_internal(param, &record.value.f, true, true);
+
+		} else {
+			PX4_WARN("unexpected type for %s", record.name);
+		}
+
+		break;
+	}
+}
+
+// import the records after the header, a torn or corrupt record ends the journal
+static int param_journal_import(int fd, int *num_records)
+{
+	uint8_t buffer[256];
+	size_t size = 0;
+	bool eof = false;
+	int records = 0;
+
+	while (true) {
+		while (!eof && size < param_journal::MAX_RECORD_SIZE) {
+			const ssize_t ret = ::read(fd, &buffer[size], sizeof(buffer) - size);
+
+			if (ret < 0) {
+				PX4_ERR("journal read failed (%d)", errno);
+				return -1;
+			}
+
+			eof = (ret == 0);
+			size += ret;
+		}
+
+		param_journal::Record record;
+		const size_t record_size = param_journal::decode(buffer, size, record);
+
+		if (record_size == 0) {
+			break;
+		}
+
+		param_journal_apply(record);
+		records++;
+		size -= record_size;
+		memmove(buffer, &buffer[record_size], size);
+	}
+
+	PX4_INFO("parameter journal: %d records", records);
+
+	if (size > 0) {
+		// the next save rewrites the journal without the broken tail
+		PX4_WARN("parameter journal: ignoring corrupt data after record %d", records);
+		records = -1;
+	}
+
+	if (num_records) {
+		*num_records = records;
+	}
+
+	return 0;
+}
+
+#endif // CONFIG_PARAM_JOURNAL
+
 static int
 param_import_callback(bson_decoder_t decoder, bson_node_t node)
 {
@@ -1200,8 +1597,27 @@ param_import_callback(bson_decoder_t decoder, bson_node_t node)
 }
 
 static int
-param_import_internal(int fd)
+param_import_internal(int fd, int *journal_records)
 {
+#if defined(CONFIG_PARAM_JOURNAL)
+	uint8_t header[param_journal::HEADER_SIZE];
+
+	if ((::read(fd, header, sizeof(header)) == sizeof(header)) && param_journal::is_journal(header, sizeof(header))) {
+		return param_journal_import(fd, journal_records);
+	}
+
+	// BSON document, converted into a journal on the next save
+	if (journal_records) {
+		*journal_records = -1;
+	}
+
+	if (lseek(fd, 0, SEEK_SET) != 0) {
+		PX4_ERR("import lseek failed (%d)", errno);
+		return -1;
+	}
+
+#endif
+
 	static constexpr int MAX_ATTEMPTS = 3;
 
 	for (int attempt = 1; attempt <= MAX_ATTEMPTS; attempt++) {
@@ -1262,7 +1678,7 @@ param_import(int fd)
 		return flash_param_import();
 	}
 
-	return param_import_internal(fd);
+	return param_import_internal(fd, nullptr);
 }
 
 int
@@ -1273,7 +1689,7 @@ param_load(int fd)
 	}
 
 	param_reset_all_internal(false);
-	return param_import_internal(fd);
+	return param_import_internal(fd, nullptr);
 }
 
 void
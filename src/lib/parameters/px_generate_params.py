@@ -19,6 +19,57 @@ except ImportError as e:
 
 import os
 
+def param_name_hash(name, seed):
+    """
+    Seeded 32 bit FNV-1a hash with a final mix step.
+    Must match param_name_hash() in parameters.cpp.
+    """
+    h = (0x811c9dc5 ^ seed) & 0xffffffff
+    for c in name.encode():
+        h ^= c
+        h = (h * 0x01000193) & 0xffffffff
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & 0xffffffff
+    h ^= h >> 13
+    return h
+
+def generate_perfect_hash(names):
+    """
+    Minimal perfect hash over the parameter names (hash and displace).
+
+    The names are distributed into buckets (seed 0), afterwards every bucket,
+    largest first, gets the first seed (displacement) that maps all of its names
+    to free slots of the table.
+
+    @return: tuple of the displacement per bucket and the parameter index per slot
+    """
+    num_names = len(names)
+    if num_names == 0:
+        return [0], [0]
+
+    num_buckets = (num_names + 3) // 4
+    buckets = [[] for _ in range(num_buckets)]
+    for index, name in enumerate(names):
+        buckets[param_name_hash(name, 0) % num_buckets].append(index)
+
+    displacements = [0] * num_buckets
+    table = [None] * num_names
+
+    for bucket in sorted(range(num_buckets), key=lambda b: len(buckets[b]), reverse=True):
+        if not buckets[bucket]:
+            continue
+        for seed in range(1, 0x10000):
+            slots = [param_name_hash(names[index], seed) % num_names for index in buckets[bucket]]
+            if len(set(slots)) == len(slots) and all(table[slot] is None for slot in slots):
+                break
+        else:
+            raise RuntimeError("failed to generate the parameter name hash")
+        displacements[bucket] = seed
+        for index, slot in zip(buckets[bucket], slots):
+            table[slot] = index
+
+    return displacements, table
+
 def generate(xml_file, dest='.'):
     """
     Generate px4 param source from xml.
@@ -39,6 +90,8 @@ def generate(xml_file, dest='.'):
 
     params = sorted(params, key=lambda name: name.attrib["name"])
 
+    hash_displacements, hash_table = generate_perfect_hash([param.attrib["name"] for param in params])
+
     script_path = os.path.dirname(os.path.realpath(__file__))
 
     # for jinja docs see: http://jinja.pocoo.org/docs/2.9/api/
@@ -55,7 +108,9 @@ def generate(xml_file, dest='.'):
         template = env.get_template(template_file)
         with open(os.path.join(
                 dest, template_file.replace('.jinja','')), 'w') as fid:
-            fid.write(template.render(params=params))
+            fid.write(template.render(params=params,
+                                      hash_displacements=hash_displacements,
+                                      hash_table=hash_table))
 
 if __name__ == "__main__":
     arg_parser = argparse.ArgumentParser()
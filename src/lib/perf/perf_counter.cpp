@@ -45,6 +45,7 @@
 #include <math.h>
 #include <pthread.h>
 #include <systemlib/err.h>
+#include <px4_platform_common/atomic.h>
 
 #include "perf_counter.h"
 
@@ -91,6 +92,114 @@ struct perf_ctr_interval : public perf_ctr_header {
 	float			M2{0.0f};
 };
 
+/**
+ * PC_HISTOGRAM bucket layout.
+ *
+ * Elapsed times (in us) below PERF_HISTOGRAM_SUB_BUCKETS get one bucket each, larger values
+ * are binned log-scale with PERF_HISTOGRAM_SUB_BUCKETS linear sub-buckets per power of two.
+ * This bounds the relative error of a reported percentile to 1/PERF_HISTOGRAM_SUB_BUCKETS.
+ * The last bucket collects everything above ~29s.
+ */
+#define PERF_HISTOGRAM_SUB_BUCKETS_LOG2	2
+#define PERF_HISTOGRAM_SUB_BUCKETS	(1u << PERF_HISTOGRAM_SUB_BUCKETS_LOG2)
+#define PERF_HISTOGRAM_BUCKETS		96
+
+/**
+ * PC_HISTOGRAM counter.
+ *
+ * Recording only uses atomic operations, so a shared counter can be updated
+ * concurrently from multiple threads without taking a lock.
+ * The sample_* fields hold the state of the previous perf_sample() call and are
+ * only written by the sampling thread (except sample_time_most).
+ */
+struct perf_ctr_histogram : public perf_ctr_header {
+	uint64_t			time_start{0};
+	px4::atomic<uint64_t>		time_total{0};
+	px4::atomic<uint32_t>		event_count{0};
+	px4::atomic<uint32_t>		time_least{0};
+	px4::atomic<uint32_t>		time_most{0};
+	px4::atomic<uint32_t>		buckets[PERF_HISTOGRAM_BUCKETS] {};
+
+	px4::atomic<uint32_t>		sample_time_most{0};
+	uint64_t			sample_time_total{0};
+	uint32_t			sample_buckets[PERF_HISTOGRAM_BUCKETS] {};
+};
+
+static inline unsigned
+perf_histogram_bucket(uint32_t elapsed)
+{
+	if (elapsed < PERF_HISTOGRAM_SUB_BUCKETS) {
+		return elapsed;
+	}
+
+	const unsigned msb = 31 - __builtin_clz(elapsed);
+	const unsigned sub = (elapsed >> (msb - PERF_HISTOGRAM_SUB_BUCKETS_LOG2)) & (PERF_HISTOGRAM_SUB_BUCKETS - 1);
+	const unsigned bucket = (msb - PERF_HISTOGRAM_SUB_BUCKETS_LOG2 + 1) * PERF_HISTOGRAM_SUB_BUCKETS + sub;
+
+	return (bucket < PERF_HISTOGRAM_BUCKETS) ? bucket : PERF_HISTOGRAM_BUCKETS - 1;
+}
+
+/**
+ * Largest elapsed time (in us) falling into a bucket.
+ */
+static inline uint32_t
+perf_histogram_bucket_max(unsigned bucket)
+{
+	if (bucket < PERF_HISTOGRAM_SUB_BUCKETS) {
+		return bucket;
+	}
+
+	if (bucket >= PERF_HISTOGRAM_BUCKETS - 1) {
+		return UINT32_MAX;
+	}
+
+	const unsigned shift = bucket / PERF_HISTOGRAM_SUB_BUCKETS - 1;
+	const uint32_t lower = (PERF_HISTOGRAM_SUB_BUCKETS + bucket % PERF_HISTOGRAM_SUB_BUCKETS) << shift;
+
+	return lower + (1u << shift) - 1;
+}
+
+/**
+ * Rank (1-based) of the sample at a given percentile within total samples.
+ */
+static inline uint64_t
+perf_histogram_rank(uint64_t total, float percentile)
+{
+	if (percentile < 0.f) {
+		percentile = 0.f;
+
+	} else if (percentile > 100.f) {
+		percentile = 100.f;
+	}
+
+	const uint64_t milli_percentile = (uint64_t)(percentile * 1000.f + 0.5f);
+	const uint64_t rank = (total * milli_percentile + 100000 - 1) / 100000;
+
+	return (rank == 0) ? 1 : rank;
+}
+
+static void
+perf_histogram_record(struct perf_ctr_histogram *pch, uint32_t elapsed)
+{
+	pch->buckets[perf_histogram_bucket(elapsed)].fetch_add(1);
+	pch->time_total.fetch_add(elapsed);
+
+	uint32_t least = pch->time_least.load();
+
+	while (((least > elapsed) || (least == 0)) && !pch->time_least.compare_exchange(&least, elapsed)) {}
+
+	uint32_t most = pch->time_most.load();
+
+	while ((most < elapsed) && !pch->time_most.compare_exchange(&most, elapsed)) {}
+
+	uint32_t sample_most = pch->sample_time_most.load();
+
+	while ((sample_most < elapsed) && !pch->sample_time_most.compare_exchange(&sample_most, elapsed)) {}
+
+	// count last, so that a reader never sees more events than bucket entries
+	pch->event_count.fetch_add(1);
+}
+
 /**
  * List of all known counters.
  */
@@ -126,6 +235,10 @@ perf_alloc(enum perf_counter_type type, const char *name)
 		ctr = new perf_ctr_interval();
 		break;
 
+	case PC_HISTOGRAM:
+		ctr = new perf_ctr_histogram();
+		break;
+
 	default:
 		break;
 	}
@@ -194,6 +307,10 @@ perf_free(perf_counter_t handle)
 		delete (struct perf_ctr_interval *)handle;
 		break;
 
+	case PC_HISTOGRAM:
+		delete (struct perf_ctr_histogram *)handle;
+		break;
+
 	default:
 		break;
 	}
@@ -220,6 +337,22 @@ perf_count(perf_counter_t handle)
 	}
 }
 
+/**
+ * Time source of the elapsed counters. With the lockstep scheduler the hrt time does not
+ * advance while a module is running, so the processing time is measured with the system clock.
+ */
+static inline hrt_abstime
+perf_time_now()
+{
+#if defined(ENABLE_LOCKSTEP_SCHEDULER)
+	struct timespec ts;
+	system_clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts_to_abstime(&ts);
+#else
+	return hrt_absolute_time();
+#endif
+}
+
 void
 perf_begin(perf_counter_t handle)
 {
@@ -229,7 +362,11 @@ perf_begin(perf_counter_t handle)
 
 	switch (handle->type) {
 	case PC_ELAPSED:
-		((struct perf_ctr_elapsed *)handle)->time_start = hrt_absolute_time();
+		((struct perf_ctr_elapsed *)handle)->time_start = perf_time_now();
+		break;
+
+	case PC_HISTOGRAM:
+		((struct perf_ctr_histogram *)handle)->time_start = perf_time_now();
 		break;
 
 	default:
@@ -249,7 +386,16 @@ perf_end(perf_counter_t handle)
 			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
 
 			if (pce->time_start != 0) {
-				perf_set_elapsed(handle, hrt_elapsed_time(&pce->time_start));
+				perf_set_elapsed(handle, perf_time_now() - pce->time_start);
+			}
+		}
+		break;
+
+	case PC_HISTOGRAM: {
+			struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+
+			if (pch->time_start != 0) {
+				perf_set_elapsed(handle, perf_time_now() - pch->time_start);
 			}
 		}
 		break;
@@ -294,6 +440,16 @@ perf_set_elapsed(perf_counter_t handle, int64_t elapsed)
 		}
 		break;
 
+	case PC_HISTOGRAM: {
+			struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+
+			if (elapsed >= 0) {
+				perf_histogram_record(pch, (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed);
+				pch->time_start = 0;
+			}
+		}
+		break;
+
 	default:
 		break;
 	}
@@ -387,6 +543,10 @@ perf_cancel(perf_counter_t handle)
 		}
 		break;
 
+	case PC_HISTOGRAM:
+		((struct perf_ctr_histogram *)handle)->time_start = 0;
+		break;
+
 	default:
 		break;
 	}
@@ -424,6 +584,25 @@ perf_reset(perf_counter_t handle)
 			pci->time_most = 0;
 			break;
 		}
+
+	case PC_HISTOGRAM: {
+			struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+			pch->event_count.store(0);
+			pch->time_start = 0;
+			pch->time_total.store(0);
+			pch->time_least.store(0);
+			pch->time_most.store(0);
+
+			pch->sample_time_most.store(0);
+			pch->sample_time_total = 0;
+
+			for (unsigned i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+				pch->buckets[i].store(0);
+				pch->sample_buckets[i] = 0;
+			}
+
+			break;
+		}
 	}
 }
 
@@ -470,6 +649,24 @@ perf_print_counter(perf_counter_t handle)
 			break;
 		}
 
+	case PC_HISTOGRAM: {
+			struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+			const uint32_t event_count = pch->event_count.load();
+
+			PX4_INFO_RAW("%s: %" PRIu32 " events, %.2fus avg, min %" PRIu32 "us max %" PRIu32 "us, p50 %" PRIu32 "us p90 %"
+				     PRIu32 "us p99 %" PRIu32 "us p99.9 %" PRIu32 "us\n",
+				     handle->name,
+				     event_count,
+				     (event_count == 0) ? 0 : (double)pch->time_total.load() / (double)event_count,
+				     pch->time_least.load(),
+				     pch->time_most.load(),
+				     perf_percentile(handle, 50.f),
+				     perf_percentile(handle, 90.f),
+				     perf_percentile(handle, 99.f),
+				     perf_percentile(handle, 99.9f));
+			break;
+		}
+
 	default:
 		break;
 	}
@@ -522,6 +719,25 @@ perf_print_counter_buffer(char *buffer, int length, perf_counter_t handle)
 			break;
 		}
 
+	case PC_HISTOGRAM: {
+			struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+			const uint32_t event_count = pch->event_count.load();
+
+			num_written = snprintf(buffer, length,
+					       "%s: %" PRIu32 " events, %.2fus avg, min %" PRIu32 "us max %" PRIu32 "us, p50 %" PRIu32 "us p90 %"
+					       PRIu32 "us p99 %" PRIu32 "us p99.9 %" PRIu32 "us",
+					       handle->name,
+					       event_count,
+					       (event_count == 0) ? 0 : (double)pch->time_total.load() / (double)event_count,
+					       pch->time_least.load(),
+					       pch->time_most.load(),
+					       perf_percentile(handle, 50.f),
+					       perf_percentile(handle, 90.f),
+					       perf_percentile(handle, 99.f),
+					       perf_percentile(handle, 99.9f));
+			break;
+		}
+
 	default:
 		break;
 	}
@@ -551,6 +767,11 @@ perf_event_count(perf_counter_t handle)
 			return pci->event_count;
 		}
 
+	case PC_HISTOGRAM: {
+			struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+			return pch->event_count.load();
+		}
+
 	default:
 		break;
 	}
@@ -558,6 +779,26 @@ perf_event_count(perf_counter_t handle)
 	return 0;
 }
 
+const char *
+perf_name(perf_counter_t handle)
+{
+	if (handle == nullptr) {
+		return "";
+	}
+
+	return handle->name;
+}
+
+enum perf_counter_type
+perf_type(perf_counter_t handle)
+{
+	if (handle == nullptr) {
+		return PC_COUNT;
+	}
+
+	return handle->type;
+}
+
 float
 perf_mean(perf_counter_t handle)
 {
@@ -576,6 +817,12 @@ perf_mean(perf_counter_t handle)
 			return pci->mean;
 		}
 
+	case PC_HISTOGRAM: {
+			struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+			const uint32_t event_count = pch->event_count.load();
+			return (event_count == 0) ? 0.0f : (float)pch->time_total.load() / (float)event_count / 1e6f;
+		}
+
 	default:
 		break;
 	}
@@ -583,6 +830,99 @@ perf_mean(perf_counter_t handle)
 	return 0.0f;
 }
 
+uint32_t
+perf_percentile(perf_counter_t handle, float percentile)
+{
+	if ((handle == nullptr) || (handle->type != PC_HISTOGRAM)) {
+		return 0;
+	}
+
+	struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+
+	// use the sum of the buckets rather than event_count, which might be updated concurrently
+	uint64_t total = 0;
+
+	for (unsigned i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+		total += pch->buckets[i].load();
+	}
+
+	if (total == 0) {
+		return 0;
+	}
+
+	const uint64_t rank = perf_histogram_rank(total, percentile);
+	uint64_t cumulative = 0;
+	const uint32_t time_most = pch->time_most.load();
+
+	for (unsigned i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+		cumulative += pch->buckets[i].load();
+
+		if (cumulative >= rank) {
+			const uint32_t bucket_max = perf_histogram_bucket_max(i);
+			return ((time_most != 0) && (bucket_max > time_most)) ? time_most : bucket_max;
+		}
+	}
+
+	return time_most;
+}
+
+bool
+perf_sample(perf_counter_t handle, perf_sample_t *sample)
+{
+	if ((handle == nullptr) || (sample == nullptr) || (handle->type != PC_HISTOGRAM)) {
+		return false;
+	}
+
+	struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+
+	*sample = {};
+	sample->name = handle->name;
+
+	uint32_t total = 0;
+
+	for (unsigned i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+		total += pch->buckets[i].load() - pch->sample_buckets[i];
+	}
+
+	// reset the interval maximum, keeping any concurrent update
+	uint32_t time_most = pch->sample_time_most.load();
+
+	while (!pch->sample_time_most.compare_exchange(&time_most, 0)) {}
+
+	const uint64_t time_total = pch->time_total.load();
+	const uint64_t time_total_delta = time_total - pch->sample_time_total;
+	pch->sample_time_total = time_total;
+
+	static constexpr float percentiles[] {50.f, 90.f, 99.f, 99.9f};
+	uint32_t *results[] {&sample->p50_us, &sample->p90_us, &sample->p99_us, &sample->p99_9_us};
+	unsigned next = 0;
+	uint64_t next_rank = perf_histogram_rank(total, percentiles[0]);
+	uint32_t cumulative = 0;
+
+	// single pass over a snapshot of the buckets, which also becomes the new baseline,
+	// so that events recorded concurrently are counted in exactly one sample
+	for (unsigned i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+		const uint32_t count = pch->buckets[i].load();
+		cumulative += count - pch->sample_buckets[i];
+		pch->sample_buckets[i] = count;
+
+		while ((total > 0) && (next < sizeof(percentiles) / sizeof(percentiles[0])) && (cumulative >= next_rank)) {
+			const uint32_t bucket_max = perf_histogram_bucket_max(i);
+			*results[next] = ((time_most != 0) && (bucket_max > time_most)) ? time_most : bucket_max;
+
+			if (++next < sizeof(percentiles) / sizeof(percentiles[0])) {
+				next_rank = perf_histogram_rank(total, percentiles[next]);
+			}
+		}
+	}
+
+	sample->event_count = cumulative;
+	sample->time_avg_us = (cumulative == 0) ? 0.f : (float)time_total_delta / (float)cumulative;
+	sample->time_max_us = time_most;
+
+	return true;
+}
+
 void
 perf_iterate_all(perf_callback cb, void *user)
 {
@@ -625,6 +965,34 @@ perf_print_latency(void)
 	// print the overflow bucket value
 	latency = get_latency(get_latency_bucket_count() - 1, get_latency_bucket_count());
 	PX4_INFO_RAW(" >%4" PRIu16 " : %" PRIu32 "\n", latency.bucket, latency.counter);
+
+#if defined(CONFIG_BUILD_FLAT) || !defined(__PX4_NUTTX)
+	hrt_callout_stats_t callout_stats;
+	hrt_callout_stats(&callout_stats);
+	PX4_INFO_RAW("\nhrt callouts: %" PRIu32 " queued (max %" PRIu32 "), worst-case enter %" PRIu32 " us\n",
+		     callout_stats.count, callout_stats.count_max, callout_stats.enter_time_max);
+#endif
+
+	// control path stages, ordered by the stage digit following the prefix
+	PX4_INFO_RAW("\ncontrol latency since sensor sample:\n");
+
+	static constexpr size_t prefix_length = sizeof(PERF_LATENCY_PREFIX) - 1;
+
+	pthread_mutex_lock(&perf_counters_mutex);
+
+	for (char stage = '0'; stage <= '9'; stage++) {
+		perf_counter_t handle = (perf_counter_t)sq_peek(&perf_counters);
+
+		while (handle != nullptr) {
+			if ((strncmp(handle->name, PERF_LATENCY_PREFIX, prefix_length) == 0) && (handle->name[prefix_length] == stage)) {
+				perf_print_counter(handle);
+			}
+
+			handle = (perf_counter_t)sq_next(&handle->link);
+		}
+	}
+
+	pthread_mutex_unlock(&perf_counters_mutex);
 }
 
 void
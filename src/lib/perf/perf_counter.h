@@ -48,12 +48,27 @@
 enum perf_counter_type {
 	PC_COUNT,		/**< count the number of times an event occurs */
 	PC_ELAPSED,		/**< measure the time elapsed performing an event */
-	PC_INTERVAL		/**< measure the interval between instances of an event */
+	PC_INTERVAL,		/**< measure the interval between instances of an event */
+	PC_HISTOGRAM		/**< measure the time elapsed performing an event, with percentiles */
 };
 
 struct perf_ctr_header;
 typedef struct perf_ctr_header	*perf_counter_t;
 
+/**
+ * Statistics of a counter since the previous call to perf_sample().
+ */
+typedef struct {
+	const char	*name;		/**< counter name */
+	uint32_t	event_count;	/**< number of events in the sample interval */
+	float		time_avg_us;	/**< mean elapsed time */
+	uint32_t	time_max_us;	/**< maximum elapsed time */
+	uint32_t	p50_us;		/**< 50th percentile of the elapsed time */
+	uint32_t	p90_us;		/**< 90th percentile of the elapsed time */
+	uint32_t	p99_us;		/**< 99th percentile of the elapsed time */
+	uint32_t	p99_9_us;	/**< 99.9th percentile of the elapsed time */
+} perf_sample_t;
+
 __BEGIN_DECLS
 
 /**
@@ -205,7 +220,14 @@ typedef void (*perf_callback)(perf_counter_t handle, void *user);
 __EXPORT extern void	perf_iterate_all(perf_callback cb, void *user);
 
 /**
- * Print hrt latency counters.
+ * Prefix of the counters measuring the latency of a control path stage since the sensor sample.
+ * Name them PERF_LATENCY_PREFIX "<stage digit> <topic>", eg "latency: 1 vehicle_angular_velocity",
+ * perf_print_latency() reports them ordered by stage.
+ */
+#define PERF_LATENCY_PREFIX "latency: "
+
+/**
+ * Print hrt latency counters and the control path latency counters (PERF_LATENCY_PREFIX).
  */
 __EXPORT extern void		perf_print_latency(void);
 
@@ -222,6 +244,22 @@ __EXPORT extern void		perf_reset_all(void);
  */
 __EXPORT extern uint64_t	perf_event_count(perf_counter_t handle);
 
+/**
+ * Return the counter type
+ *
+ * @param handle		The handle returned from perf_alloc.
+ * @param return		type the counter was allocated with
+ */
+__EXPORT extern enum perf_counter_type	perf_type(perf_counter_t handle);
+
+/**
+ * Return the counter name
+ *
+ * @param handle		The handle returned from perf_alloc.
+ * @param return		name, empty string for a NULL handle
+ */
+__EXPORT extern const char	*perf_name(perf_counter_t handle);
+
 /**
  * Return current mean
  *
@@ -230,6 +268,32 @@ __EXPORT extern uint64_t	perf_event_count(perf_counter_t handle);
  */
 __EXPORT extern float		perf_mean(perf_counter_t handle);
 
+/**
+ * Return an estimate of a percentile of the recorded elapsed times
+ *
+ * This call applies to counters of type PC_HISTOGRAM. The result is the upper
+ * bound of the log-scale bucket containing the requested percentile, so the
+ * relative error is at most 25%.
+ *
+ * @param handle		The handle returned from perf_alloc.
+ * @param percentile		Percentile in the range [0, 100], e.g. 99.9.
+ * @param return		percentile in microseconds, 0 if no events were recorded
+ */
+__EXPORT extern uint32_t	perf_percentile(perf_counter_t handle, float percentile);
+
+/**
+ * Take a delta sample of a counter
+ *
+ * This call applies to counters of type PC_HISTOGRAM. It returns the statistics of
+ * the events recorded since the previous call (or since perf_reset). It is meant
+ * for a single periodic reader (load_mon) streaming the counters.
+ *
+ * @param handle		The handle returned from perf_alloc.
+ * @param sample		Sample to fill in.
+ * @param return		true if the counter supports sampling and sample was filled in
+ */
+__EXPORT extern bool		perf_sample(perf_counter_t handle, perf_sample_t *sample);
+
 __END_DECLS
 
 #endif
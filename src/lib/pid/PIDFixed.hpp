@@ -0,0 +1,171 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file PIDFixed.hpp
+ *
+ * PID controller (see pid.h) on Q15/Q31 values for targets without FPU.
+ * The loop rate is fixed, ki * dt and kd / dt are precomputed in float when setting
+ * the parameters, the update only uses integer arithmetic with saturation.
+ * Setpoint, value and output are Q15/Q31 in [-1, 1), scale them accordingly.
+ */
+
+#pragma once
+
+#include <px4_platform_common/defines.h>
+#include <mathlib/math/FixedPoint.hpp>
+#include <mathlib/math/Functions.hpp>
+
+#include "pid.h"
+
+template<typename Q>
+class PIDFixed
+{
+public:
+	using acc_t = math::fixed_acc_t<Q>;
+
+	static constexpr int FRAC_BITS = math::FixedPointTraits<Q>::FRAC_BITS;
+
+	// the integral is kept with twice the fractional bits so that small ki * dt still integrate
+	static constexpr int INTEGRAL_FRAC_BITS = 2 * FRAC_BITS;
+
+	/**
+	 * @param mode PID_MODE_DERIVATIV_SET takes the derivative of the value in update()
+	 */
+	explicit PIDFixed(pid_mode_t mode = PID_MODE_DERIVATIV_CALC) : _mode(mode) {}
+
+	/**
+	 * @param kp, ki, kd gains, any magnitude
+	 * @param dt fixed update interval [s]
+	 * @param integral_limit limit of the integral of the error (as in pid.h), at most 1 / ki
+	 * @param output_limit output limit in [0, 1], 0: no limit
+	 * @return false if a parameter is invalid, the previous ones are kept
+	 */
+	bool setParameters(float kp, float ki, float kd, float dt, float integral_limit, float output_limit)
+	{
+		if (!PX4_ISFINITE(kp) || !PX4_ISFINITE(ki) || !PX4_ISFINITE(kd) || !PX4_ISFINITE(integral_limit)
+		    || !PX4_ISFINITE(output_limit) || !(dt > 0.f)) {
+			return false;
+		}
+
+		_kp = math::FixedGain<Q>::fromFloat(kp);
+		// the derivative is given for PID_MODE_DERIVATIV_SET, otherwise the difference to the last update
+		_kd_dt = math::FixedGain<Q>::fromFloat((_mode == PID_MODE_DERIVATIV_SET) ? kd : kd / dt);
+
+		// ki * dt < 1
+		_ki_dt = math::FixedGain<Q>::fromFloat(ki * dt, FRAC_BITS);
+
+		// the integral term ki * integral of the error is limited to +-1
+		const float integral_term_limit = math::constrain(ki * integral_limit, 0.f, 1.f);
+		_integral_limit = math::toFixed<Q>(integral_term_limit) * (static_cast<acc_t>(1) << FRAC_BITS);
+
+		_output_limit = math::toFixed<Q>(math::constrain(output_limit, 0.f, 1.f));
+
+		return true;
+	}
+
+	/**
+	 * Run the controller once, at the interval dt given in setParameters().
+	 *
+	 * @param value_dot derivative of the value, only used with PID_MODE_DERIVATIV_SET
+	 * @return saturated output
+	 */
+	Q update(Q setpoint, Q value, Q value_dot = 0)
+	{
+		const Q error = math::subSat<Q>(setpoint, value);
+
+		acc_t d = 0;
+
+		if (_mode == PID_MODE_DERIVATIV_CALC) {
+			d = _kd_dt.apply(math::subSat<Q>(error, _error_previous));
+			_error_previous = error;
+
+		} else if (_mode == PID_MODE_DERIVATIV_CALC_NO_SP) {
+			const Q minus_value = math::saturate<Q>(-static_cast<acc_t>(value));
+			d = _kd_dt.apply(math::subSat<Q>(minus_value, _error_previous));
+			_error_previous = minus_value;
+
+		} else if (_mode == PID_MODE_DERIVATIV_SET) {
+			d = -_kd_dt.apply(value_dot);
+		}
+
+		// each term saturated to the range of Q, the sum cannot overflow
+		acc_t output = static_cast<acc_t>(math::saturate<Q>(_kp.apply(error))) + math::saturate<Q>(d);
+
+		if (!_ki_dt.zero()) {
+			const acc_t integral = _integral + _ki_dt.apply(error, INTEGRAL_FRAC_BITS);
+			const acc_t integral_term = math::shiftRightRound<acc_t>(integral, FRAC_BITS);
+
+			// only accept the new integral if neither the output nor the integral saturate
+			if (((_output_limit == 0) || (magnitude(output + integral_term) <= _output_limit))
+			    && (magnitude(integral) <= _integral_limit)) {
+				_integral = integral;
+			}
+
+			output += math::shiftRightRound<acc_t>(_integral, FRAC_BITS);
+		}
+
+		if (_output_limit > 0) {
+			output = math::constrain<acc_t>(output, -_output_limit, _output_limit);
+		}
+
+		_last_output = math::saturate<Q>(output);
+		return _last_output;
+	}
+
+	void resetIntegral() { _integral = 0; }
+
+	Q getLastOutput() const { return _last_output; }
+
+	// integral term ki * integral of the error
+	Q getIntegral() const { return math::saturate<Q>(math::shiftRightRound<acc_t>(_integral, FRAC_BITS)); }
+
+private:
+	static acc_t magnitude(acc_t x) { return (x >= 0) ? x : -x; }
+
+	const pid_mode_t _mode;
+
+	math::FixedGain<Q> _kp{};
+	math::FixedGain<Q> _ki_dt{};
+	math::FixedGain<Q> _kd_dt{}; // kd with PID_MODE_DERIVATIV_SET
+
+	acc_t _integral{0};       // ki * integral of the error, INTEGRAL_FRAC_BITS
+	acc_t _integral_limit{0}; // INTEGRAL_FRAC_BITS
+	Q _output_limit{0};
+
+	Q _error_previous{0};
+	Q _last_output{0};
+};
+
+using PIDQ15 = PIDFixed<math::q15_t>;
+using PIDQ31 = PIDFixed<math::q31_t>;
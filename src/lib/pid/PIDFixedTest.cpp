@@ -0,0 +1,130 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * Test code for the Q15/Q31 fixed-point PID against the float implementation
+ * Run this test only using make tests TESTFILTER=PIDFixed
+ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+
+#include "pid.h"
+#include "PIDFixed.hpp"
+
+using math::q15_t;
+using math::q31_t;
+using math::toFixed;
+using math::toFloat;
+
+namespace
+{
+// first order plant driven by the controller output, returns the maximum output difference to the float PID
+template<typename Q>
+float maxErrorToFloat(pid_mode_t mode, float kp, float ki, float kd, float integral_limit, float output_limit)
+{
+	const float dt = 0.0025f;
+
+	PID_t reference;
+	pid_init(&reference, mode, dt);
+	pid_set_parameters(&reference, kp, ki, kd, integral_limit, output_limit);
+
+	PIDFixed<Q> pid{mode};
+	EXPECT_TRUE(pid.setParameters(kp, ki, kd, dt, integral_limit, output_limit));
+
+	float state = 0.f;
+	float max_error = 0.f;
+
+	for (int i = 0; i < 2000; i++) {
+		const float setpoint = (i < 1000) ? 0.5f : -0.2f;
+		const float state_dot = (i > 0) ? -state * 0.5f : 0.f;
+
+		const float expected = pid_calculate(&reference, setpoint, state, state_dot, dt);
+		const float output = toFloat<Q>(pid.update(toFixed<Q>(setpoint), toFixed<Q>(state), toFixed<Q>(state_dot)));
+
+		max_error = fmaxf(max_error, fabsf(output - expected));
+
+		// plant driven by the reference, both controllers see the same inputs
+		state += (expected - 0.3f * state) * dt * 20.f;
+	}
+
+	return max_error;
+}
+}
+
+TEST(PIDFixedTest, matchesFloat)
+{
+	const pid_mode_t modes[] = {PID_MODE_DERIVATIV_NONE, PID_MODE_DERIVATIV_CALC, PID_MODE_DERIVATIV_CALC_NO_SP, PID_MODE_DERIVATIV_SET};
+
+	for (pid_mode_t mode : modes) {
+		EXPECT_LT(maxErrorToFloat<q15_t>(mode, 0.8f, 2.f, 0.002f, 0.3f, 1.f), 2e-3f) << mode;
+		EXPECT_LT(maxErrorToFloat<q31_t>(mode, 0.8f, 2.f, 0.002f, 0.3f, 1.f), 1e-5f) << mode;
+
+		// large proportional and tiny integral gain, limited output
+		EXPECT_LT(maxErrorToFloat<q15_t>(mode, 4.f, 0.05f, 0.f, 1.f, 0.6f), 2e-3f) << mode;
+		EXPECT_LT(maxErrorToFloat<q31_t>(mode, 4.f, 0.05f, 0.f, 1.f, 0.6f), 1e-5f) << mode;
+	}
+}
+
+TEST(PIDFixedTest, integralLimit)
+{
+	PIDQ15 pid{PID_MODE_DERIVATIV_NONE};
+	pid.setParameters(0.f, 10.f, 0.f, 0.01f, 0.02f, 0.f);
+
+	for (int i = 0; i < 1000; i++) {
+		pid.update(toFixed<q15_t>(0.5f), 0);
+	}
+
+	// ki * integral_limit
+	EXPECT_NEAR(toFloat<q15_t>(pid.getIntegral()), 0.2f, 1e-4f);
+
+	pid.resetIntegral();
+	EXPECT_EQ(pid.getIntegral(), 0);
+}
+
+TEST(PIDFixedTest, outputSaturates)
+{
+	PIDQ31 pid{PID_MODE_DERIVATIV_CALC};
+	pid.setParameters(1000.f, 0.f, 0.f, 0.01f, 0.f, 0.f);
+
+	// no overflow with a large gain and full scale error
+	EXPECT_EQ(pid.update(INT32_MAX, INT32_MIN), INT32_MAX);
+	EXPECT_EQ(pid.update(INT32_MIN, INT32_MAX), INT32_MIN);
+
+	pid.setParameters(1000.f, 0.f, 0.f, 0.01f, 0.f, 0.25f);
+	EXPECT_NEAR(toFloat<q31_t>(pid.update(toFixed<q31_t>(0.1f), 0)), 0.25f, 1e-6f);
+	EXPECT_NEAR(toFloat<q31_t>(pid.getLastOutput()), 0.25f, 1e-6f);
+
+	EXPECT_FALSE(pid.setParameters(NAN, 0.f, 0.f, 0.01f, 0.f, 0.f));
+	EXPECT_FALSE(pid.setParameters(1.f, 0.f, 0.f, 0.f, 0.f, 0.f));
+}
@@ -85,6 +85,19 @@ Vector3f RateControl::update(const Vector3f &rate, const Vector3f &rate_sp, cons
 	return torque;
 }
 
+Vector3f RateControl::update(const float *const rate[3], const float *const angular_accel[3], const int samples,
+			     const Vector3f &rate_sp, const float dt, const bool landed)
+{
+	Vector3f torque;
+
+	for (int n = 0; n < samples; n++) {
+		torque = update(Vector3f{rate[0][n], rate[1][n], rate[2][n]}, rate_sp,
+				Vector3f{angular_accel[0][n], angular_accel[1][n], angular_accel[2][n]}, dt, landed);
+	}
+
+	return torque;
+}
+
 void RateControl::updateIntegral(Vector3f &rate_error, const float dt)
 {
 	for (int i = 0; i < 3; i++) {
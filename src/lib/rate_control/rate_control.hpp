@@ -96,6 +96,19 @@ public:
 	matrix::Vector3f update(const matrix::Vector3f &rate, const matrix::Vector3f &rate_sp,
 				const matrix::Vector3f &angular_accel, const float dt, const bool landed);
 
+	/**
+	 * Run the control loop on every gyro sample (sub-step) since the last output,
+	 * the integral is propagated with each sub-step while only the newest torque is returned.
+	 * @param rate angular rate samples per axis, oldest first
+	 * @param angular_accel angular acceleration samples per axis
+	 * @param samples number of sub-steps (> 0)
+	 * @param rate_sp desired vehicle angular rate setpoint, held for all sub-steps
+	 * @param dt time between sub-steps
+	 * @return [-1,1] normalized torque vector of the newest sub-step
+	 */
+	matrix::Vector3f update(const float *const rate[3], const float *const angular_accel[3], const int samples,
+				const matrix::Vector3f &rate_sp, const float dt, const bool landed);
+
 	/**
 	 * Set the integral term to 0 to prevent windup
 	 * @see _rate_int
@@ -42,3 +42,37 @@ TEST(RateControlTest, AllZeroCase)
 	Vector3f torque = rate_control.update(Vector3f(), Vector3f(), Vector3f(), 0.f, false);
 	EXPECT_EQ(torque, Vector3f());
 }
+
+TEST(RateControlTest, SubstepsIntegrateEverySample)
+{
+	RateControl rate_control;
+	rate_control.setPidGains(Vector3f(0.1f, 0.1f, 0.1f), Vector3f(0.2f, 0.2f, 0.2f), Vector3f(0.01f, 0.01f, 0.01f));
+	rate_control.setIntegratorLimit(Vector3f(1.f, 1.f, 1.f));
+
+	RateControl rate_control_single{rate_control};
+
+	const float x[4] {0.1f, 0.2f, 0.3f, 0.4f};
+	const float y[4] {-0.1f, -0.1f, 0.f, 0.1f};
+	const float z[4] {};
+	const float accel[4] {1.f, 1.f, 1.f, 1.f};
+	const float *const rate[3] {x, y, z};
+	const float *const angular_accel[3] {accel, accel, accel};
+	const Vector3f rate_sp(0.5f, 0.f, 0.f);
+	const float dt = 0.00025f;
+
+	const Vector3f torque = rate_control.update(rate, angular_accel, 4, rate_sp, dt, false);
+	Vector3f torque_single;
+
+	for (int n = 0; n < 4; n++) {
+		torque_single = rate_control_single.update(Vector3f(x[n], y[n], z[n]), rate_sp, Vector3f(1.f, 1.f, 1.f), dt, false);
+	}
+
+	EXPECT_EQ(torque, torque_single);
+
+	rate_ctrl_status_s status{};
+	rate_ctrl_status_s status_single{};
+	rate_control.getRateControlStatus(status);
+	rate_control_single.getRateControlStatus(status_single);
+	EXPECT_FLOAT_EQ(status.rollspeed_integ, status_single.rollspeed_integ);
+	EXPECT_GT(status.rollspeed_integ, 0.f);
+}
@@ -12,13 +12,21 @@
 
 #pragma pack(push, 1)
 typedef  struct rc_decode_buf_ {
+	// protocols with the same serial port settings can decode the same data in parallel,
+	// only the buffers of different port settings are shared
 	union {
-		crsf_frame_t crsf_frame;
-		ghst_frame_t ghst_frame;
-		dsm_decode_t dsm;
 		sbus_frame_t sbus_frame;
-		ReceiverFcPacket _strxpacket;
-		ReceiverFcPacketHoTT _hottrxpacket;
+
+		struct {
+			dsm_decode_t dsm;
+			ReceiverFcPacket _strxpacket;
+			ReceiverFcPacketHoTT _hottrxpacket;
+		};
+
+		struct {
+			crsf_frame_t crsf_frame;
+			ghst_frame_t ghst_frame;
+		};
 	};
 } rc_decode_buf_t;
 #pragma pack(pop)
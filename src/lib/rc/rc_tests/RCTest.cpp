@@ -31,6 +31,8 @@ public:
 
 private:
 	bool crsfTest();
+	bool crsfGhstParallelTest();
+	bool crsfDecodeTest(bool parallel_ghst);
 	bool ghstTest();
 	bool dsmTest(const char *filepath, unsigned expected_chancount, unsigned expected_dropcount, unsigned chan0);
 	bool dsmTest10Ch();
@@ -45,6 +47,7 @@ private:
 bool RCTest::run_tests()
 {
 	ut_run_test(crsfTest);
+	ut_run_test(crsfGhstParallelTest);
 	ut_run_test(ghstTest);
 	ut_run_test(dsmTest10Ch);
 	ut_run_test(dsmTest16Ch);
@@ -58,6 +61,17 @@ bool RCTest::run_tests()
 }
 
 bool RCTest::crsfTest()
+{
+	return crsfDecodeTest(false);
+}
+
+bool RCTest::crsfGhstParallelTest()
+{
+	// RCInput scans for CRSF and GHST in parallel, the GHST decoder must neither decode CRSF data nor disturb the CRSF decoder
+	return crsfDecodeTest(true);
+}
+
+bool RCTest::crsfDecodeTest(bool parallel_ghst)
 {
 	const char *filepath = TEST_DATA_PATH "crsf_rc_channels.txt";
 
@@ -104,6 +118,17 @@ bool RCTest::crsfTest()
 				has_decoded_values = true;
 			}
 
+			if (parallel_ghst) {
+				uint16_t ghst_values[max_channels];
+				uint16_t ghst_num_values = 0;
+				int8_t ghst_rssi = -1;
+
+				if (ghst_parse(now, frame, frame_len, ghst_values, &ghst_rssi, &ghst_num_values, max_channels)) {
+					PX4_ERR("GHST decoded CRSF data (line=%i)", line_counter);
+					return false;
+				}
+			}
+
 		} else if (strncmp(line, "DECODED ", 8) == 0) {
 
 			if (!has_decoded_values) {
@@ -0,0 +1,155 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "RtcmStream.hpp"
+
+#include <containers/LockGuard.hpp>
+
+#include <string.h>
+
+px4::atomic<RtcmStream *> RtcmStream::_instance{nullptr};
+
+RtcmStream *RtcmStream::instance()
+{
+	RtcmStream *stream = _instance.load();
+
+	if (stream == nullptr) {
+		RtcmStream *new_stream = new RtcmStream();
+
+		if (_instance.compare_exchange(&stream, new_stream)) {
+			stream = new_stream;
+
+		} else {
+			// another thread was faster
+			delete new_stream;
+		}
+	}
+
+	return stream;
+}
+
+RtcmStream::RtcmStream()
+{
+	pthread_mutex_init(&_mutex, nullptr);
+}
+
+RtcmStream::~RtcmStream()
+{
+	pthread_mutex_destroy(&_mutex);
+}
+
+bool RtcmStream::write(uint8_t source, const uint8_t *packet, size_t packet_len)
+{
+	if ((packet == nullptr) || (packet_len == 0) || (packet_len > MAX_PACKET_SIZE)) {
+		return false;
+	}
+
+	const uint32_t space_required = sizeof(Header) + packet_len;
+
+	LockGuard lg{_mutex};
+
+	// overwrite the oldest packets
+	while (_head - _tail + space_required > BUFFER_SIZE) {
+		Header oldest;
+		copy_out(_tail, reinterpret_cast<uint8_t *>(&oldest), sizeof(oldest));
+		_tail += sizeof(Header) + oldest.len;
+		_tail_sequence++;
+	}
+
+	const Header header{static_cast<uint16_t>(packet_len), source, 0};
+	copy_in(_head, reinterpret_cast<const uint8_t *>(&header), sizeof(header));
+	copy_in(_head + sizeof(Header), packet, packet_len);
+	_head += space_required;
+	_head_sequence++;
+
+	return true;
+}
+
+void RtcmStream::attach(Reader &reader)
+{
+	LockGuard lg{_mutex};
+	reader.position = _head;
+	reader.sequence = _head_sequence;
+	reader.attached = true;
+}
+
+size_t RtcmStream::read(Reader &reader, uint8_t *buf, size_t max_buf_len, uint8_t &source)
+{
+	if (!reader.attached || (buf == nullptr)) {
+		return 0;
+	}
+
+	LockGuard lg{_mutex};
+
+	while (reader.position != _head) {
+		if (reader.position - _tail > _head - _tail) {
+			// the packets of the reader were overwritten, continue with the oldest one
+			reader.dropped += _tail_sequence - reader.sequence;
+			reader.position = _tail;
+			reader.sequence = _tail_sequence;
+		}
+
+		Header header;
+		copy_out(reader.position, reinterpret_cast<uint8_t *>(&header), sizeof(header));
+
+		const uint32_t packet_position = reader.position + sizeof(Header);
+		reader.position = packet_position + header.len;
+		reader.sequence++;
+
+		if (header.len <= max_buf_len) {
+			copy_out(packet_position, buf, header.len);
+			source = header.source;
+			return header.len;
+		}
+	}
+
+	return 0;
+}
+
+void RtcmStream::copy_in(uint32_t position, const uint8_t *data, size_t len)
+{
+	const size_t offset = position % BUFFER_SIZE;
+	const size_t first = (len < BUFFER_SIZE - offset) ? len : BUFFER_SIZE - offset;
+
+	memcpy(&_buffer[offset], data, first);
+	memcpy(&_buffer[0], data + first, len - first);
+}
+
+void RtcmStream::copy_out(uint32_t position, uint8_t *data, size_t len) const
+{
+	const size_t offset = position % BUFFER_SIZE;
+	const size_t first = (len < BUFFER_SIZE - offset) ? len : BUFFER_SIZE - offset;
+
+	memcpy(data, &_buffer[offset], first);
+	memcpy(data + first, &_buffer[0], len - first);
+}
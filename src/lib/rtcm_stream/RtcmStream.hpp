@@ -0,0 +1,134 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include <px4_platform_common/atomic.h>
+
+
+// Byte stream of RTCM correction packets from the links (eg MAVLink
+// GPS_RTCM_DATA) to the GPS drivers.
+//
+// Packets are copied once into a shared ringbuffer. Every GPS driver
+// reads them through its own Reader, so multiple receivers do not
+// duplicate the data. Writers never wait for the readers: if the buffer
+// is full the oldest packets are overwritten, and a reader that has
+// not read them yet skips ahead and counts them as dropped.
+//
+// The stream is thread-safe.
+
+class RtcmStream
+{
+public:
+	static constexpr size_t BUFFER_SIZE = 4096;
+	static constexpr size_t MAX_PACKET_SIZE = 300;
+
+	static_assert((BUFFER_SIZE & (BUFFER_SIZE - 1)) == 0, "BUFFER_SIZE must be a power of 2 for the positions to wrap");
+
+	struct Reader {
+		uint32_t position{0};	///< stream position of the next packet to read
+		uint32_t sequence{0};	///< sequence number of the next packet to read
+		uint32_t dropped{0};	///< number of packets overwritten before they were read
+		bool attached{false};
+	};
+
+	/* @brief Get the stream shared by all modules
+	 *
+	 * @note Allocated on first use.
+	 *
+	 * @returns nullptr if the allocation fails.
+	 */
+	static RtcmStream *instance();
+
+	RtcmStream();
+	~RtcmStream();
+
+	RtcmStream(const RtcmStream &) = delete;
+	RtcmStream &operator=(const RtcmStream &) = delete;
+
+	/*
+	 * @brief Append a packet
+	 *
+	 * @param source Id of the sending link, readers can select a single source.
+	 * @param packet Pointer to packet to copy from.
+	 * @param packet_len Length of packet, at most MAX_PACKET_SIZE.
+	 *
+	 * @returns false if the packet is empty or too big.
+	 */
+	bool write(uint8_t source, const uint8_t *packet, size_t packet_len);
+
+	/*
+	 * @brief Start reading at the end of the stream, only packets written afterwards are read
+	 */
+	void attach(Reader &reader);
+
+	/*
+	 * @brief Get the next packet of a reader
+	 *
+	 * @param reader Attached reader.
+	 * @param buf Pointer to where the packet is copied into.
+	 * @param max_buf_len Max size of buf, packets that do not fit are skipped.
+	 * @param source Source of the packet.
+	 *
+	 * @returns length of the packet, 0 if there is no new packet.
+	 */
+	size_t read(Reader &reader, uint8_t *buf, size_t max_buf_len, uint8_t &source);
+
+private:
+	struct Header {
+		uint16_t len;
+		uint8_t source;
+		uint8_t reserved;
+	};
+
+	void copy_in(uint32_t position, const uint8_t *data, size_t len);
+	void copy_out(uint32_t position, uint8_t *data, size_t len) const;
+
+	static px4::atomic<RtcmStream *> _instance;
+
+	pthread_mutex_t _mutex;
+
+	// stream positions (total bytes written, wrapping), the buffer holds the packets from _tail to _head
+	uint32_t _head{0};
+	uint32_t _tail{0};
+
+	// packet sequence numbers at _head and _tail
+	uint32_t _head_sequence{0};
+	uint32_t _tail_sequence{0};
+
+	uint8_t _buffer[BUFFER_SIZE];
+};
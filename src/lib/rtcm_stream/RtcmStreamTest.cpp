@@ -0,0 +1,173 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "RtcmStream.hpp"
+
+static void fill(uint8_t *buf, size_t len, uint8_t seed)
+{
+	for (size_t i = 0; i < len; i++) {
+		buf[i] = static_cast<uint8_t>(seed + i);
+	}
+}
+
+TEST(RtcmStream, ReadOnlyAfterAttach)
+{
+	RtcmStream stream;
+	uint8_t packet[100];
+	fill(packet, sizeof(packet), 1);
+
+	RtcmStream::Reader reader;
+	uint8_t buf[RtcmStream::MAX_PACKET_SIZE];
+	uint8_t source = 0;
+
+	// not attached
+	EXPECT_TRUE(stream.write(0, packet, sizeof(packet)));
+	EXPECT_EQ(stream.read(reader, buf, sizeof(buf), source), 0u);
+
+	stream.attach(reader);
+	EXPECT_EQ(stream.read(reader, buf, sizeof(buf), source), 0u);
+
+	EXPECT_TRUE(stream.write(3, packet, sizeof(packet)));
+	EXPECT_EQ(stream.read(reader, buf, sizeof(buf), source), sizeof(packet));
+	EXPECT_EQ(source, 3);
+	EXPECT_EQ(memcmp(buf, packet, sizeof(packet)), 0);
+	EXPECT_EQ(stream.read(reader, buf, sizeof(buf), source), 0u);
+}
+
+TEST(RtcmStream, RejectInvalidPackets)
+{
+	RtcmStream stream;
+	uint8_t packet[RtcmStream::MAX_PACKET_SIZE + 1] {};
+
+	EXPECT_FALSE(stream.write(0, nullptr, 10));
+	EXPECT_FALSE(stream.write(0, packet, 0));
+	EXPECT_FALSE(stream.write(0, packet, sizeof(packet)));
+	EXPECT_TRUE(stream.write(0, packet, RtcmStream::MAX_PACKET_SIZE));
+}
+
+TEST(RtcmStream, MultipleReadersShareThePackets)
+{
+	RtcmStream stream;
+	RtcmStream::Reader reader1;
+	RtcmStream::Reader reader2;
+	stream.attach(reader1);
+	stream.attach(reader2);
+
+	uint8_t packet[180];
+	uint8_t buf[RtcmStream::MAX_PACKET_SIZE];
+	uint8_t source = 0;
+
+	for (uint8_t i = 0; i < 10; i++) {
+		fill(packet, sizeof(packet) - i, i);
+		ASSERT_TRUE(stream.write(i % 2, packet, sizeof(packet) - i));
+	}
+
+	// both readers get all packets in order, independent of each other
+	for (uint8_t i = 0; i < 10; i++) {
+		fill(packet, sizeof(packet) - i, i);
+
+		ASSERT_EQ(stream.read(reader1, buf, sizeof(buf), source), sizeof(packet) - i);
+		EXPECT_EQ(source, i % 2);
+		EXPECT_EQ(memcmp(buf, packet, sizeof(packet) - i), 0);
+	}
+
+	for (uint8_t i = 0; i < 10; i++) {
+		fill(packet, sizeof(packet) - i, i);
+
+		ASSERT_EQ(stream.read(reader2, buf, sizeof(buf), source), sizeof(packet) - i);
+		EXPECT_EQ(memcmp(buf, packet, sizeof(packet) - i), 0);
+	}
+
+	EXPECT_EQ(reader1.dropped, 0u);
+	EXPECT_EQ(reader2.dropped, 0u);
+}
+
+TEST(RtcmStream, SlowReaderDropsOldestPackets)
+{
+	RtcmStream stream;
+	RtcmStream::Reader fast;
+	RtcmStream::Reader slow;
+	stream.attach(fast);
+	stream.attach(slow);
+
+	uint8_t packet[200];
+	uint8_t buf[RtcmStream::MAX_PACKET_SIZE];
+	uint8_t source = 0;
+
+	// many times the buffer size, wrapping around
+	const int num_packets = 100;
+
+	for (int i = 0; i < num_packets; i++) {
+		fill(packet, sizeof(packet), static_cast<uint8_t>(i));
+		ASSERT_TRUE(stream.write(0, packet, sizeof(packet)));
+
+		ASSERT_EQ(stream.read(fast, buf, sizeof(buf), source), sizeof(packet));
+		EXPECT_EQ(memcmp(buf, packet, sizeof(packet)), 0);
+	}
+
+	// the slow reader continues with the oldest packet still buffered
+	const unsigned buffered = RtcmStream::BUFFER_SIZE / (sizeof(packet) + 4);
+	unsigned read_count = 0;
+	uint8_t expected_seed = static_cast<uint8_t>(num_packets - buffered);
+
+	while (stream.read(slow, buf, sizeof(buf), source) > 0) {
+		fill(packet, sizeof(packet), expected_seed++);
+		EXPECT_EQ(memcmp(buf, packet, sizeof(packet)), 0);
+		read_count++;
+	}
+
+	EXPECT_EQ(read_count, buffered);
+	EXPECT_EQ(slow.dropped, num_packets - buffered);
+	EXPECT_EQ(fast.dropped, 0u);
+}
+
+TEST(RtcmStream, SkipPacketsNotFittingTheBuffer)
+{
+	RtcmStream stream;
+	RtcmStream::Reader reader;
+	stream.attach(reader);
+
+	uint8_t packet[100] {};
+	uint8_t buf[50];
+	uint8_t source = 0;
+
+	ASSERT_TRUE(stream.write(0, packet, sizeof(packet)));
+	ASSERT_TRUE(stream.write(0, packet, 20));
+
+	EXPECT_EQ(stream.read(reader, buf, sizeof(buf), source), 20u);
+	EXPECT_EQ(stream.read(reader, buf, sizeof(buf), source), 0u);
+}
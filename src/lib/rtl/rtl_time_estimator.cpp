@@ -82,6 +82,8 @@ void RtlTimeEstimator::update()
 	_vehicle_status_sub.update();
 	_wind_sub.update();
 
+	bool inputs_changed = false;
+
 	if (_parameter_update_sub.updated()) {
 		parameter_update_s param_update;
 		_parameter_update_sub.copy(&param_update);
@@ -89,6 +91,24 @@ void RtlTimeEstimator::update()
 		// If any parameter updated, call updateParams() to check if
 		// this class attributes need updating (and do so).
 		updateParams();
+		inputs_changed = true;
+	}
+
+	if ((_vehicle_status_sub.get().vehicle_type != _vehicle_type) || (_vehicle_status_sub.get().is_vtol != _is_vtol)) {
+		_vehicle_type = _vehicle_status_sub.get().vehicle_type;
+		_is_vtol = _vehicle_status_sub.get().is_vtol;
+		inputs_changed = true;
+	}
+
+	const matrix::Vector2f wind = get_wind();
+
+	if ((wind - _wind_at_generation).norm() > WIND_CHANGE_THRESHOLD) {
+		_wind_at_generation = wind;
+		inputs_changed = true;
+	}
+
+	if (inputs_changed) {
+		_inputs_generation++;
 	}
 }
 
@@ -130,6 +150,14 @@ void RtlTimeEstimator::addWait(float time_s)
 	}
 }
 
+void RtlTimeEstimator::addEstimate(float time_s)
+{
+	if (PX4_ISFINITE(time_s)) {
+		_is_valid = true;
+		_time_estimate += time_s;
+	}
+}
+
 void RtlTimeEstimator::addDescendMCLand(float alt)
 {
 	if (PX4_ISFINITE(alt)) {
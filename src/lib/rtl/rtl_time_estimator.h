@@ -65,11 +65,27 @@ public:
 	void update();
 	void reset() { _time_estimate = 0.f; _is_valid = false;};
 	rtl_time_estimate_s getEstimate() const;
+	float getTimeEstimate() const { return _time_estimate; }
 	void addDistance(float hor_dist, const matrix::Vector2f &hor_direction, float vert_dist);
 	void addVertDistance(float alt);
 	void addWait(float time_s);
 	void addDescendMCLand(float alt);
 
+	/**
+	 * @brief Add a previously computed time estimate, e.g. a cached sum of mission legs
+	 *
+	 * @param time_s time estimate [s]
+	 */
+	void addEstimate(float time_s);
+
+	/**
+	 * @brief Counter which is incremented whenever an input of the estimate changed
+	 *
+	 * Changes in parameters, vehicle type or wind increment this counter, so that
+	 * users can cache time estimates of path segments as long as it stays the same.
+	 */
+	uint32_t inputsGeneration() const { return _inputs_generation; }
+
 private:
 	/**
 	 * @brief Get the Cruise Ground Speed
@@ -123,6 +139,13 @@ private:
 	float _time_estimate; 		/**< Accumulated time estimate [s] */
 	bool _is_valid{false};		/**< Checks if time estimate is valid */
 
+	static constexpr float WIND_CHANGE_THRESHOLD{0.5f}; /**< Wind change triggering an inputs update [m/s] */
+
+	uint32_t _inputs_generation{0};		/**< Incremented on every change of the estimate inputs */
+	uint8_t _vehicle_type{0};		/**< Vehicle type of the last inputs update */
+	bool _is_vtol{false};			/**< VTOL flag of the last inputs update */
+	matrix::Vector2f _wind_at_generation{};	/**< Wind of the last inputs update [m/s] */
+
 	DEFINE_PARAMETERS(
 		(ParamFloat<px4::params::RTL_TIME_FACTOR>) _param_rtl_time_factor,  /**< Safety factory for safe time estimate */
 		(ParamInt<px4::params::RTL_TIME_MARGIN>)   _param_rtl_time_margin   /**< Safety margin for safe time estimate */
@@ -99,6 +99,13 @@ public:
 		return _rotation * (_scale * ((data + _power * _power_compensation) - _offset));
 	}
 
+	// Correct() as affine map (corrected = A * data + b) to apply the calibration to a batch of samples
+	void CorrectionAffine(matrix::Matrix3f &A, matrix::Vector3f &b) const
+	{
+		A = _rotation * _scale;
+		b = A * (_power * _power_compensation - _offset);
+	}
+
 	// Compute sensor offset from bias (board frame)
 	matrix::Vector3f BiasCorrectedSensorOffset(const matrix::Vector3f &bias) const
 	{
@@ -35,6 +35,10 @@
  * @file arx_rls.hpp
  * @brief Efficient recursive weighted least-squares algorithm without matrix inversion
  *
+ * The covariance is propagated in square-root form (P = S * S') using Potter's algorithm,
+ * which keeps it symmetric positive definite and costs O(n^2) per sample, so that it can run
+ * at the rate controller frequency.
+ *
  * Assumes an ARX (autoregressive) model:
  * A(q^-1)y(k) = q^-d * B(q^-1)u(k) + A(q^-1)e(k)
  *
@@ -51,6 +55,7 @@
  *
  * References:
  * - Identification de systemes dynamiques, D.Bonvin and A.Karimi, epfl, 2011
+ * - Optimal Estimation of Dynamic Systems, J.L. Crassidis and J.L. Junkins, 2nd ed., 2011 (Potter's algorithm)
  *
  * @author Mathieu Bresciani <mathieu@auterion.com>
  */
@@ -80,17 +85,34 @@ public:
 	 * [a_1 .. a_n b_0 .. b_m]'
 	 */
 	const matrix::Vector < float, N + M + 1 > &getCoefficients() const { return _theta_hat; }
-	const matrix::Vector < float, N + M + 1 > getVariances() const { return _P.diag(); }
+	const matrix::Vector < float, N + M + 1 > getVariances() const
+	{
+		// diagonal of S * S'
+		matrix::Vector < float, N + M + 1 > variances;
+
+		for (size_t i = 0; i < N + M + 1; i++) {
+			float sum = 0.f;
+
+			for (size_t j = 0; j < N + M + 1; j++) {
+				sum += _S(i, j) * _S(i, j);
+			}
+
+			variances(i) = sum;
+		}
+
+		return variances;
+	}
+
 	float getInnovation() const { return _innovation; }
 	const matrix::Vector < float, N + M + 1 > &getDiffEstimate() const { return _diff_theta_hat; }
 
 	void reset(const matrix::Vector < float, N + M + 1 > &theta_init = {})
 	{
-		/* _P.uncorrelateCovarianceSetVariance<N + M + 1>(0, 10e3f); // does not work */
-		_P.setZero();
+		// initial variance of 10e3
+		_S.setZero();
 
 		for (size_t i = 0; i < (N + M + 1); i++) {
-			_P(i, i) = 10e3f;
+			_S(i, i) = 100.f;
 		}
 
 		_diff_theta_hat.setZero();
@@ -121,18 +143,56 @@ public:
 			return;
 		}
 
-		const matrix::Vector < float, N + M + 1 > phi = constructDesignVector();
-		const matrix::Matrix < float, 1, N + M + 1 > phi_t = phi.transpose();
+		static constexpr size_t n = N + M + 1;
+		const matrix::Vector<float, n> phi = constructDesignVector();
+
+		// f = S' * phi
+		matrix::Vector<float, n> f;
+
+		for (size_t j = 0; j < n; j++) {
+			float sum = 0.f;
+
+			for (size_t i = 0; i < n; i++) {
+				sum += _S(i, j) * phi(i);
+			}
+
+			f(j) = sum;
+		}
+
+		const float alpha = _lambda + f.dot(f);
+
+		// gain K = P * phi / alpha = S * f / alpha
+		matrix::Vector<float, n> gain;
+
+		for (size_t i = 0; i < n; i++) {
+			float sum = 0.f;
+
+			for (size_t j = 0; j < n; j++) {
+				sum += _S(i, j) * f(j);
+			}
+
+			gain(i) = sum / alpha;
+		}
+
+		// S = (S - K * f' / (1 + sqrt(lambda / alpha))) / sqrt(lambda)
+		// equivalent to P = (P - P * phi * phi' * P / alpha) / lambda
+		const float gamma = 1.f / (1.f + sqrtf(_lambda / alpha));
+		const float lambda_inv_sqrt = 1.f / sqrtf(_lambda);
 
-		_P = (_P - _P * phi * phi_t * _P / (_lambda + (phi_t * _P * phi)(0, 0))) / _lambda;
-		_innovation = _y[N] - (phi_t * _theta_hat)(0, 0);
-		_theta_hat = _theta_hat + _P * phi * _innovation;
+		for (size_t i = 0; i < n; i++) {
+			const float gain_gamma = gain(i) * gamma;
+
+			for (size_t j = 0; j < n; j++) {
+				_S(i, j) = (_S(i, j) - gain_gamma * f(j)) * lambda_inv_sqrt;
+			}
+		}
+
+		_innovation = _y[N] - phi.dot(_theta_hat);
+		_theta_hat = _theta_hat + gain * _innovation;
 
 		for (size_t i = 0; i < N + M + 1; i++) {
 			_diff_theta_hat(i) = fabsf(_theta_hat(i) - theta_prev(i));
 		}
-
-		/* fixCovarianceErrors(); // TODO: this could help against ill-conditioned matrix but needs more testing*/
 	}
 
 private:
@@ -178,26 +238,7 @@ private:
 		return phi;
 	}
 
-	void fixCovarianceErrors()
-	{
-		float max_var = 0.f;
-
-		for (size_t i = 0; i < (N + M + 1); i++) {
-			if (_P(i, i) > max_var) {
-				max_var = _P(i, i);
-			}
-		}
-
-		const float min_var_allowed = max_var * 0.1f;
-
-		for (size_t i = 0; i < (N + M + 1); i++) {
-			if (_P(i, i) < min_var_allowed) {
-				_P(i, i) = min_var_allowed;
-			}
-		}
-	}
-
-	matrix::SquareMatrix < float, N + M + 1 > _P;
+	matrix::SquareMatrix < float, N + M + 1 > _S; ///< square root of the covariance (P = S * S')
 	matrix::Vector < float, N + M + 1 > _theta_hat;
 	matrix::Vector < float, N + M + 1 > _diff_theta_hat;
 	float _innovation{};
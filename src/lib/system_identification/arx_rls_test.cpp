@@ -114,3 +114,62 @@ TEST_F(ArxRlsTest, resetTest)
 	// THEN: the result should be exactly the same
 	EXPECT_TRUE((coefficients - _rls.getCoefficients()).abs().max() < 1e-8f);
 }
+
+TEST_F(ArxRlsTest, squareRootMatchesDenseUpdate)
+{
+	// GIVEN: the square-root RLS and a reference implementation of the dense covariance update
+	ArxRls<2, 2, 1> _rls;
+	const float lambda = 0.999f;
+	_rls.setForgettingFactor(lambda);
+
+	SquareMatrix<double, 5> P;
+	P.setIdentity();
+	P *= 10e3;
+	Vector<double, 5> theta;
+	double u[4] {};
+	double y[3] {};
+
+	// WHEN: identifying a second order system excited with a square wave
+	for (int k = 0; k < 5000; k++) {
+		const double u_k = ((k / 20) % 2) ? 1.0 : -1.0;
+		const double y_k = 1.6 * y[2] - 0.64 * y[1] + 0.02 * u[2] + 0.01 * u[1];
+
+		for (int i = 0; i < 3; i++) {
+			u[i] = u[i + 1];
+		}
+
+		u[3] = u_k;
+		y[0] = y[1];
+		y[1] = y[2];
+		y[2] = y_k;
+
+		_rls.update((float)u_k, (float)y_k);
+
+		if (k >= 2 + 2 + 1) {
+			const double phi_data[5] = {-y[1], -y[0], u[2], u[1], u[0]};
+			const Vector<double, 5> phi(phi_data);
+			const Vector<double, 5> P_phi = P * phi;
+			const double alpha = lambda + phi.dot(P_phi);
+			theta += P_phi * ((y_k - phi.dot(theta)) / alpha);
+			for (int i = 0; i < 5; i++) {
+				for (int j = 0; j < 5; j++) {
+					P(i, j) = (P(i, j) - P_phi(i) * P_phi(j) / alpha) / (double)lambda;
+				}
+			}
+		}
+	}
+
+	// THEN: the estimates and variances are the same and match the system
+	const Vector<float, 5> coefficients = _rls.getCoefficients();
+	const Vector<float, 5> variances = _rls.getVariances();
+
+	for (int i = 0; i < 5; i++) {
+		EXPECT_NEAR(coefficients(i), theta(i), 1e-3);
+		EXPECT_NEAR(variances(i), P(i, i), 1e-3 * fabs(P(i, i)) + 1e-6);
+		EXPECT_GT(variances(i), 0.f);
+	}
+
+	float data_check[] = {-1.6f, 0.64f, 0.f, 0.02f, 0.01f};
+	const Vector<float, 5> coefficients_check(data_check);
+	EXPECT_TRUE((coefficients - coefficients_check).abs().max() < 1e-2f);
+}
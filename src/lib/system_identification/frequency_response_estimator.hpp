@@ -0,0 +1,300 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file frequency_response_estimator.hpp
+ * @brief Online frequency response estimation with a bank of single-bin DFTs
+ *
+ * The input and output signals are correlated at every sample with complex exponentials at
+ * N log-spaced frequencies, which is equivalent to running a Goertzel filter per bin but keeps
+ * the accumulation numerically stable in single precision over long experiments. The response
+ * at each bin is the ratio of the output and input spectra, H(f) = Y(f) / U(f).
+ *
+ * When used with u = rate error and y = measured rate while exciting the rate setpoint,
+ * H is the open-loop transfer function of the rate loop, from which the classical stability
+ * margins are computed.
+ */
+
+#pragma once
+
+#include <float.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <px4_platform_common/defines.h>
+
+template<size_t N>
+class FrequencyResponseEstimator final
+{
+public:
+	static_assert(N >= 2, "At least two frequency bins are required");
+
+	struct Margins {
+		float gain_crossover_frequency{NAN}; ///< [Hz] where |H| crosses 1 downwards
+		float phase_margin{NAN}; ///< [deg]
+		float phase_crossover_frequency{NAN}; ///< [Hz] where the phase crosses -180 deg above the gain crossover
+		float gain_margin{NAN}; ///< [dB]
+		float sensitivity_peak{NAN}; ///< [dB] max |1 / (1 + H)|
+	};
+
+	FrequencyResponseEstimator() = default;
+	~FrequencyResponseEstimator() = default;
+
+	/**
+	 * Reset the accumulators and place the bins log-spaced in [f_min, f_max]
+	 * @param dt nominal sample interval in seconds
+	 */
+	void reset(float f_min, float f_max, float dt)
+	{
+		const float f_ratio = f_max / f_min;
+
+		for (size_t k = 0; k < N; k++) {
+			_frequency[k] = f_min * powf(f_ratio, static_cast<float>(k) / static_cast<float>(N - 1));
+			const float omega = 2.f * M_PI_F * _frequency[k] * dt;
+			_rotation_re[k] = cosf(omega);
+			_rotation_im[k] = -sinf(omega);
+			_phasor_re[k] = 1.f;
+			_phasor_im[k] = 0.f;
+			_input_re[k] = 0.f;
+			_input_im[k] = 0.f;
+			_output_re[k] = 0.f;
+			_output_im[k] = 0.f;
+		}
+
+		_last_input = 0.f;
+		_last_output = 0.f;
+		_sample_count = 0;
+	}
+
+	/**
+	 * Add a sample pair
+	 * @param elapsed_samples number of nominal sample intervals since the previous call,
+	 *        larger than one when samples were lost. The missing samples are linearly
+	 *        interpolated so that the bins stay phase-aligned.
+	 */
+	void update(float input, float output, uint32_t elapsed_samples = 1)
+	{
+		if (_sample_count > 0) {
+			for (uint32_t i = 1; i < elapsed_samples; i++) {
+				const float ratio = static_cast<float>(i) / static_cast<float>(elapsed_samples);
+				accumulate(_last_input + ratio * (input - _last_input), _last_output + ratio * (output - _last_output));
+			}
+		}
+
+		accumulate(input, output);
+		_last_input = input;
+		_last_output = output;
+	}
+
+	uint32_t getSampleCount() const { return _sample_count; }
+	float getFrequency(size_t k) const { return _frequency[k]; }
+
+	/**
+	 * @return false if the input carries too little energy at that bin for the ratio to be meaningful
+	 */
+	bool getResponse(size_t k, float &re, float &im) const
+	{
+		float max_input_energy = 0.f;
+
+		for (size_t i = 0; i < N; i++) {
+			max_input_energy = fmaxf(max_input_energy, inputEnergy(i));
+		}
+
+		const float input_energy = inputEnergy(k);
+
+		if (input_energy < FLT_EPSILON || input_energy < kMinRelativeInputEnergy * max_input_energy) {
+			re = NAN;
+			im = NAN;
+			return false;
+		}
+
+		// Y * conj(U) / |U|^2
+		re = (_output_re[k] * _input_re[k] + _output_im[k] * _input_im[k]) / input_energy;
+		im = (_output_im[k] * _input_re[k] - _output_re[k] * _input_im[k]) / input_energy;
+		return true;
+	}
+
+	/**
+	 * Magnitude in dB and phase in degrees, unwrapped from the lowest bin and starting in (-360, 0]
+	 * @return number of valid bins, invalid ones are set to NAN
+	 */
+	size_t getBode(float magnitude_db[N], float phase_deg[N]) const
+	{
+		size_t valid = 0;
+		float previous_phase = NAN;
+
+		for (size_t k = 0; k < N; k++) {
+			float re;
+			float im;
+
+			if (!getResponse(k, re, im)) {
+				magnitude_db[k] = NAN;
+				phase_deg[k] = NAN;
+				continue;
+			}
+
+			magnitude_db[k] = 10.f * log10f(fmaxf(re * re + im * im, FLT_MIN));
+			float phase = atan2f(im, re) * (180.f / M_PI_F);
+
+			if (!PX4_ISFINITE(previous_phase)) {
+				if (phase > 0.f) {
+					phase -= 360.f;
+				}
+
+			} else {
+				while (phase - previous_phase > 180.f) {
+					phase -= 360.f;
+				}
+
+				while (phase - previous_phase < -180.f) {
+					phase += 360.f;
+				}
+			}
+
+			phase_deg[k] = phase;
+			previous_phase = phase;
+			valid++;
+		}
+
+		return valid;
+	}
+
+	Margins getMargins() const
+	{
+		Margins margins{};
+		float magnitude_db[N];
+		float phase_deg[N];
+		getBode(magnitude_db, phase_deg);
+
+		float sensitivity_peak = -INFINITY;
+		size_t crossover_index = N;
+
+		for (size_t k = 0; k < N; k++) {
+			float re;
+			float im;
+
+			if (getResponse(k, re, im)) {
+				// |S| = 1 / |1 + H|
+				const float denominator = (1.f + re) * (1.f + re) + im * im;
+				sensitivity_peak = fmaxf(sensitivity_peak, -10.f * log10f(fmaxf(denominator, FLT_MIN)));
+			}
+
+			if (k + 1 < N && crossover_index == N
+			    && magnitude_db[k] >= 0.f && magnitude_db[k + 1] < 0.f) {
+				const float ratio = magnitude_db[k] / (magnitude_db[k] - magnitude_db[k + 1]);
+				margins.gain_crossover_frequency = interpolateFrequency(k, ratio);
+				margins.phase_margin = 180.f + phase_deg[k] + ratio * (phase_deg[k + 1] - phase_deg[k]);
+				crossover_index = k;
+			}
+		}
+
+		if (sensitivity_peak > -INFINITY) {
+			margins.sensitivity_peak = sensitivity_peak;
+		}
+
+		// search the first -180 deg phase crossing above the gain crossover (or from the start if the loop gain never exceeds 1)
+		const size_t start_index = (crossover_index == N) ? 0 : crossover_index;
+
+		for (size_t k = start_index; k + 1 < N; k++) {
+			// the -180 deg line may be crossed at any multiple of 360 deg after unwrapping
+			const float lower = floorf((phase_deg[k] + 180.f) / 360.f) * 360.f - 180.f;
+
+			if (phase_deg[k + 1] < lower) {
+				const float ratio = (phase_deg[k] - lower) / (phase_deg[k] - phase_deg[k + 1]);
+				margins.phase_crossover_frequency = interpolateFrequency(k, ratio);
+				margins.gain_margin = -(magnitude_db[k] + ratio * (magnitude_db[k + 1] - magnitude_db[k]));
+				break;
+			}
+		}
+
+		return margins;
+	}
+
+private:
+	static constexpr float kMinRelativeInputEnergy = 1e-4f; ///< bins 40 dB below the strongest one are rejected
+	static constexpr uint32_t kRenormalizeInterval = 64;
+
+	float inputEnergy(size_t k) const { return _input_re[k] * _input_re[k] + _input_im[k] * _input_im[k]; }
+
+	float interpolateFrequency(size_t k, float ratio) const
+	{
+		// linear in log-frequency between bins k and k + 1
+		return _frequency[k] * powf(_frequency[k + 1] / _frequency[k], ratio);
+	}
+
+	void accumulate(float input, float output)
+	{
+		for (size_t k = 0; k < N; k++) {
+			_input_re[k] += input * _phasor_re[k];
+			_input_im[k] += input * _phasor_im[k];
+			_output_re[k] += output * _phasor_re[k];
+			_output_im[k] += output * _phasor_im[k];
+		}
+
+		rotate();
+	}
+
+	void rotate()
+	{
+		for (size_t k = 0; k < N; k++) {
+			const float re = _phasor_re[k] * _rotation_re[k] - _phasor_im[k] * _rotation_im[k];
+			const float im = _phasor_re[k] * _rotation_im[k] + _phasor_im[k] * _rotation_re[k];
+			_phasor_re[k] = re;
+			_phasor_im[k] = im;
+		}
+
+		if (++_sample_count % kRenormalizeInterval == 0) {
+			// first order correction towards unit magnitude, the drift is tiny after kRenormalizeInterval steps
+			for (size_t k = 0; k < N; k++) {
+				const float scale = 1.5f - 0.5f * (_phasor_re[k] * _phasor_re[k] + _phasor_im[k] * _phasor_im[k]);
+				_phasor_re[k] *= scale;
+				_phasor_im[k] *= scale;
+			}
+		}
+	}
+
+	float _frequency[N] {};
+	float _rotation_re[N] {};
+	float _rotation_im[N] {};
+	float _phasor_re[N] {};
+	float _phasor_im[N] {};
+	float _input_re[N] {};
+	float _input_im[N] {};
+	float _output_re[N] {};
+	float _output_im[N] {};
+
+	float _last_input{0.f};
+	float _last_output{0.f};
+	uint32_t _sample_count{0};
+};
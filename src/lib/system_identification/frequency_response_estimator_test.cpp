@@ -0,0 +1,206 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * Test code for the FrequencyResponseEstimator class
+ * Run this test only using make tests TESTFILTER=frequency_response_estimator
+ */
+
+#include <gtest/gtest.h>
+#include <complex>
+
+#include "frequency_response_estimator.hpp"
+#include "signal_generator.hpp"
+
+using Complex = std::complex<float>;
+
+static constexpr size_t kBins = 32;
+static constexpr float kDt = 1e-3f;
+static constexpr float kDuration = 20.f;
+static constexpr float kFMin = 2.f;
+static constexpr float kFMax = 150.f;
+
+class FrequencyResponseEstimatorTest : public ::testing::Test
+{
+public:
+	FrequencyResponseEstimatorTest()
+	{
+		_estimator.reset(kFMin, kFMax, kDt);
+	}
+
+	FrequencyResponseEstimator<kBins> _estimator;
+};
+
+static Complex lowpassResponse(float alpha, float f)
+{
+	// y[n] = y[n-1] + alpha * (u[n] - y[n-1])
+	const Complex z_inv = std::polar(1.f, -2.f * M_PI_F * f * kDt);
+	return alpha / (1.f - (1.f - alpha) * z_inv);
+}
+
+static Complex loopResponse(float gain, int delay, float f)
+{
+	// y[n+1] = y[n] + gain * u[n - delay]
+	const Complex z = std::polar(1.f, 2.f * M_PI_F * f * kDt);
+	return gain * std::pow(z, -delay) / (z - 1.f);
+}
+
+TEST_F(FrequencyResponseEstimatorTest, lowpassSweep)
+{
+	const float alpha = 0.2f;
+	float y = 0.f;
+
+	for (int n = 0; n < static_cast<int>(kDuration / kDt); n++) {
+		const float u = signal_generator::getLogSineSweep(1.f, 200.f, kDuration, n * kDt);
+		y += alpha * (u - y);
+		_estimator.update(u, y);
+	}
+
+	float magnitude_db[kBins];
+	float phase_deg[kBins];
+	EXPECT_EQ(_estimator.getBode(magnitude_db, phase_deg), kBins);
+
+	for (size_t k = 0; k < kBins; k++) {
+		const Complex expected = lowpassResponse(alpha, _estimator.getFrequency(k));
+		EXPECT_NEAR(magnitude_db[k], 20.f * log10f(std::abs(expected)), 0.5f) << "bin " << k;
+		EXPECT_NEAR(phase_deg[k], std::arg(expected) * 180.f / M_PI_F, 3.f) << "bin " << k;
+	}
+}
+
+TEST_F(FrequencyResponseEstimatorTest, lowpassPrbs)
+{
+	const float alpha = 0.2f;
+	float y = 0.f;
+
+	for (int n = 0; n < static_cast<int>(kDuration / kDt); n++) {
+		const float u = signal_generator::getSignal(signal_generator::SignalType::kPrbs, kFMin, kFMax, kDuration, n * kDt);
+		y += alpha * (u - y);
+		_estimator.update(u, y);
+	}
+
+	float magnitude_db[kBins];
+	float phase_deg[kBins];
+	EXPECT_EQ(_estimator.getBode(magnitude_db, phase_deg), kBins);
+
+	for (size_t k = 0; k < kBins; k++) {
+		const Complex expected = lowpassResponse(alpha, _estimator.getFrequency(k));
+		EXPECT_NEAR(magnitude_db[k], 20.f * log10f(std::abs(expected)), 0.5f) << "bin " << k;
+		EXPECT_NEAR(phase_deg[k], std::arg(expected) * 180.f / M_PI_F, 3.f) << "bin " << k;
+	}
+}
+
+TEST_F(FrequencyResponseEstimatorTest, lowpassSweepWithDroppedSamples)
+{
+	const float alpha = 0.2f;
+	float y = 0.f;
+	uint32_t elapsed_samples = 1;
+
+	for (int n = 0; n < static_cast<int>(kDuration / kDt); n++) {
+		const float u = signal_generator::getLogSineSweep(1.f, 200.f, kDuration, n * kDt);
+		y += alpha * (u - y);
+
+		// sporadically drop about one sample in 256, the estimator is told how many intervals elapsed
+		if (((static_cast<uint32_t>(n) * 2654435761u) >> 24) == 0) {
+			elapsed_samples++;
+			continue;
+		}
+
+		_estimator.update(u, y, elapsed_samples);
+		elapsed_samples = 1;
+	}
+
+	float magnitude_db[kBins];
+	float phase_deg[kBins];
+	EXPECT_EQ(_estimator.getBode(magnitude_db, phase_deg), kBins);
+
+	for (size_t k = 0; k < kBins; k++) {
+		const Complex expected = lowpassResponse(alpha, _estimator.getFrequency(k));
+		EXPECT_NEAR(magnitude_db[k], 20.f * log10f(std::abs(expected)), 0.5f) << "bin " << k;
+		EXPECT_NEAR(phase_deg[k], std::arg(expected) * 180.f / M_PI_F, 3.f) << "bin " << k;
+	}
+}
+
+TEST_F(FrequencyResponseEstimatorTest, closedLoopMargins)
+{
+	// proportional rate loop with an integrating plant and a transport delay, excited at the setpoint
+	const float gain = 2.f * M_PI_F * 20.f * kDt;
+	const int delay = 8;
+	float u_history[delay + 1] {};
+	float y = 0.f;
+
+	for (int n = 0; n < static_cast<int>(kDuration / kDt); n++) {
+		const float r = 0.5f * signal_generator::getLogSineSweep(1.f, 200.f, kDuration, n * kDt);
+		const float e = r - y;
+		_estimator.update(e, y);
+
+		for (int i = delay; i > 0; i--) {
+			u_history[i] = u_history[i - 1];
+		}
+
+		u_history[0] = e;
+		y += gain * u_history[delay];
+	}
+
+	// reference margins from a dense evaluation of the analytic response
+	float expected_crossover = NAN;
+	float expected_phase_margin = NAN;
+	float expected_phase_crossover = NAN;
+	float expected_gain_margin = NAN;
+	float previous_phase = -90.f;
+
+	for (float f = kFMin; f < kFMax; f += 0.01f) {
+		const Complex response = loopResponse(gain, delay, f);
+		float phase = std::arg(response) * 180.f / M_PI_F;
+
+		while (phase - previous_phase > 180.f) { phase -= 360.f; }
+
+		previous_phase = phase;
+
+		if (!PX4_ISFINITE(expected_crossover) && std::abs(response) < 1.f) {
+			expected_crossover = f;
+			expected_phase_margin = 180.f + phase;
+		}
+
+		if (!PX4_ISFINITE(expected_phase_crossover) && phase < -180.f) {
+			expected_phase_crossover = f;
+			expected_gain_margin = -20.f * log10f(std::abs(response));
+		}
+	}
+
+	const auto margins = _estimator.getMargins();
+	EXPECT_NEAR(margins.gain_crossover_frequency, expected_crossover, 0.05f * expected_crossover);
+	EXPECT_NEAR(margins.phase_margin, expected_phase_margin, 2.f);
+	EXPECT_NEAR(margins.phase_crossover_frequency, expected_phase_crossover, 0.05f * expected_phase_crossover);
+	EXPECT_NEAR(margins.gain_margin, expected_gain_margin, 1.f);
+	EXPECT_GT(margins.sensitivity_peak, 0.f);
+}
@@ -37,9 +37,20 @@
 
 #pragma once
 
+#include <math.h>
+#include <stdint.h>
+
+#include <px4_platform_common/defines.h>
+
 namespace signal_generator
 {
 
+enum class SignalType : uint8_t {
+	kLinearSineSweep = 0,
+	kLogSineSweep,
+	kPrbs
+};
+
 inline float getLinearSineSweep(float f_start, float f_end, float duration, float t)
 {
 	if (t > duration) {
@@ -63,4 +74,73 @@ inline float getLogSineSweep(float f_start, float f_end, float duration, float t
 	return sinf(M_TWOPI_F * f_start * duration * (powf(f_ratio, t / duration) - 1.f) / logf(f_ratio));
 }
 
+/*
+ * Maximum length binary sequence generated by the Galois LFSR x^15 + x^14 + 1 (period 32767 bits).
+ * The state after n shifts is x^n mod p(x) and is computed directly by binary exponentiation,
+ * so that independent consumers evaluating the signal at the same time get the same value
+ * even if they do not see every sample.
+ */
+inline float getPrbs(float f_clock, float duration, float t)
+{
+	if (t < 0.f || t > duration) {
+		return 0.f;
+	}
+
+	static constexpr uint32_t kPeriod = (1u << 15) - 1u;
+	static constexpr uint32_t kPolynomial = 0xC001; // x^15 + x^14 + 1
+
+	const auto mul_mod = [](uint32_t a, uint32_t b) {
+		uint32_t r = 0;
+
+		while (b != 0) {
+			if (b & 1u) {
+				r ^= a;
+			}
+
+			b >>= 1;
+			a <<= 1;
+
+			if (a & (1u << 15)) {
+				a ^= kPolynomial;
+			}
+		}
+
+		return r;
+	};
+
+	uint32_t n = static_cast<uint32_t>(t * f_clock) % kPeriod;
+	uint32_t base = 2u; // x
+	uint32_t state = 1u;
+
+	while (n != 0) {
+		if (n & 1u) {
+			state = mul_mod(state, base);
+		}
+
+		base = mul_mod(base, base);
+		n >>= 1;
+	}
+
+	return (state & (1u << 14)) ? 1.f : -1.f;
+}
+
+/*
+ * The PRBS is clocked at 2 * f_end, which keeps its spectrum within 4 dB of flat up to f_end.
+ */
+inline float getSignal(SignalType type, float f_start, float f_end, float duration, float t)
+{
+	switch (type) {
+	case SignalType::kLinearSineSweep:
+		return getLinearSineSweep(f_start, f_end, duration, t);
+
+	case SignalType::kLogSineSweep:
+		return getLogSineSweep(f_start, f_end, duration, t);
+
+	case SignalType::kPrbs:
+		return getPrbs(2.f * f_end, duration, t);
+	}
+
+	return 0.f;
+}
+
 } /* namespace signal_generator */
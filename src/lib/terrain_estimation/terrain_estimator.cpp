@@ -93,8 +93,8 @@ void TerrainEstimator::predict(float dt, const struct vehicle_attitude_s *attitu
 
 	// propagate state and covariance matrix
 	_x += dx;
-	_P += (A * _P + _P * A.transpose() +
-	       B * R * B.transpose() + Q) * dt;
+	_P += (A * _P + _P.multiplyByTranspose(A) +
+	       (B * R).multiplyByTranspose(B) + Q) * dt;
 }
 
 void TerrainEstimator::measurement_update(uint64_t time_ref, const struct sensor_gps_s *gps,
@@ -120,12 +120,12 @@ void TerrainEstimator::measurement_update(uint64_t time_ref, const struct sensor
 		y(0) = d * cosf(euler.phi()) * cosf(euler.theta());
 
 		// residual
-		matrix::Matrix<float, 1, 1> S_I = (C * _P * C.transpose());
+		matrix::Matrix<float, 1, 1> S_I = (C * _P).multiplyByTranspose(C);
 		S_I(0, 0) += R;
 		S_I = matrix::inv<float, 1> (S_I);
 		matrix::Vector<float, 1> r = y - C * _x;
 
-		matrix::Matrix<float, n_x, 1> K = _P * C.transpose() * S_I;
+		matrix::Matrix<float, n_x, 1> K = _P.multiplyByTranspose(C) * S_I;
 
 		// some sort of outlayer rejection
 		if (fabsf(distance->current_distance - _distance_last) < 1.0f) {
@@ -156,12 +156,12 @@ void TerrainEstimator::measurement_update(uint64_t time_ref, const struct sensor
 		y(0) = gps->vel_d_m_s;
 
 		// residual
-		matrix::Matrix<float, 1, 1> S_I = (C * _P * C.transpose());
+		matrix::Matrix<float, 1, 1> S_I = (C * _P).multiplyByTranspose(C);
 		S_I(0, 0) += R;
 		S_I = matrix::inv<float, 1>(S_I);
 		matrix::Vector<float, 1> r = y - C * _x;
 
-		matrix::Matrix<float, n_x, 1> K = _P * C.transpose() * S_I;
+		matrix::Matrix<float, n_x, 1> K = _P.multiplyByTranspose(C) * S_I;
 		_x += K * r;
 		_P -= K * C * _P;
 
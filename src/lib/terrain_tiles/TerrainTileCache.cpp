@@ -0,0 +1,385 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file TerrainTileCache.cpp
+ */
+
+#include "TerrainTileCache.hpp"
+
+#include <fcntl.h>
+#include <float.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <lib/geo/geo.h>
+#include <mathlib/mathlib.h>
+#include <px4_platform_common/log.h>
+
+TerrainTileCache::TerrainTileCache(const char *directory) :
+	_directory(directory)
+{
+}
+
+bool TerrainTileCache::getElevation(double lat, double lon, float &elevation)
+{
+	matrix::Vector2f gradient_ne;
+	return getElevationAndGradient(lat, lon, elevation, gradient_ne);
+}
+
+bool TerrainTileCache::getElevationAndGradient(double lat, double lon, float &elevation,
+		matrix::Vector2f &gradient_ne)
+{
+	double row_frac;
+	double col_frac;
+	float s[2][2];
+	double spacing_deg;
+
+	if (!getSamples(lat, lon, row_frac, col_frac, s, spacing_deg)) {
+		_misses++;
+		return false;
+	}
+
+	_hits++;
+
+	const float fr = static_cast<float>(row_frac);
+	const float fc = static_cast<float>(col_frac);
+
+	elevation = s[0][0] * (1.f - fr) * (1.f - fc) + s[0][1] * (1.f - fr) * fc
+		    + s[1][0] * fr * (1.f - fc) + s[1][1] * fr * fc;
+
+	// rows increase towards south, columns towards east
+	const float d_row = (s[1][0] - s[0][0]) * (1.f - fc) + (s[1][1] - s[0][1]) * fc;
+	const float d_col = (s[0][1] - s[0][0]) * (1.f - fr) + (s[1][1] - s[1][0]) * fr;
+
+	const float spacing_north = static_cast<float>(math::radians(spacing_deg) * CONSTANTS_RADIUS_OF_EARTH);
+	const float spacing_east = spacing_north * cosf(static_cast<float>(math::radians(lat)));
+
+	gradient_ne(0) = -d_row / spacing_north;
+	gradient_ne(1) = (spacing_east > FLT_EPSILON) ? d_col / spacing_east : 0.f;
+
+	return true;
+}
+
+void TerrainTileCache::prefetch(double lat, double lon)
+{
+	double row_frac;
+	double col_frac;
+	float s[2][2];
+	double spacing_deg;
+	getSamples(lat, lon, row_frac, col_frac, s, spacing_deg);
+}
+
+bool TerrainTileCache::getSamples(double lat, double lon, double &row_frac, double &col_frac, float samples[2][2],
+				  double &spacing_deg)
+{
+	if (!PX4_ISFINITE(lat) || !PX4_ISFINITE(lon) || (lat < -90.0) || (lat >= 90.0) || (lon < -180.0) || (lon >= 180.0)) {
+		return false;
+	}
+
+	const int16_t lat_deg = static_cast<int16_t>(floor(lat));
+	const int16_t lon_deg = static_cast<int16_t>(floor(lon));
+
+	const Tile *tile = findTile(lat_deg, lon_deg);
+
+	if (tile == nullptr) {
+		request(lat_deg, lon_deg, -1, -1);
+		return false;
+	}
+
+	if (tile->samples < 2) {
+		// no data for this tile
+		return false;
+	}
+
+	const int last = tile->samples - 1;
+	const double row = (lat_deg + 1 - lat) * last;
+	const double col = (lon - lon_deg) * last;
+	const int row0 = math::min(static_cast<int>(row), last - 1);
+	const int col0 = math::min(static_cast<int>(col), last - 1);
+
+	bool available = true;
+
+	for (int i = 0; i < 2; i++) {
+		for (int j = 0; j < 2; j++) {
+			int16_t height;
+
+			// keep going to queue all missing blocks at once
+			if (getSample(*tile, row0 + i, col0 + j, height) && (height != VOID_HEIGHT)) {
+				samples[i][j] = height;
+
+			} else {
+				available = false;
+			}
+		}
+	}
+
+	row_frac = row - row0;
+	col_frac = col - col0;
+	spacing_deg = 1.0 / last;
+
+	return available;
+}
+
+const TerrainTileCache::Tile *TerrainTileCache::findTile(int16_t lat_deg, int16_t lon_deg)
+{
+	for (Tile &tile : _tiles) {
+		if (tile.valid && (tile.lat_deg == lat_deg) && (tile.lon_deg == lon_deg)) {
+			tile.last_used = ++_access_counter;
+			return &tile;
+		}
+	}
+
+	return nullptr;
+}
+
+bool TerrainTileCache::getSample(const Tile &tile, int row, int col, int16_t &height)
+{
+	const uint16_t block_row = row / BLOCK_SIZE;
+	const uint16_t block_col = col / BLOCK_SIZE;
+
+	for (Block &block : _blocks) {
+		if (block.valid && (block.block_row == block_row) && (block.block_col == block_col)
+		    && (block.lat_deg == tile.lat_deg) && (block.lon_deg == tile.lon_deg)) {
+
+			block.last_used = ++_access_counter;
+			height = block.heights[(row % BLOCK_SIZE) * BLOCK_SIZE + (col % BLOCK_SIZE)];
+			return true;
+		}
+	}
+
+	request(tile.lat_deg, tile.lon_deg, block_row, block_col);
+	return false;
+}
+
+void TerrainTileCache::request(int16_t lat_deg, int16_t lon_deg, int32_t block_row, int32_t block_col)
+{
+	for (int i = 0; i < _num_pending; i++) {
+		const Request &req = _pending[i];
+
+		if ((req.lat_deg == lat_deg) && (req.lon_deg == lon_deg) && (req.block_row == block_row)
+		    && (req.block_col == block_col)) {
+			return;
+		}
+	}
+
+	// if the queue is full the request is dropped, it is repeated with the next lookup
+	if (_num_pending < MAX_PENDING) {
+		_pending[_num_pending++] = Request{lat_deg, lon_deg, block_row, block_col};
+	}
+}
+
+int TerrainTileCache::update(int max_loads)
+{
+	int loads = 0;
+
+	while ((_num_pending > 0) && (loads < max_loads)) {
+		const Request req = _pending[0];
+
+		_num_pending--;
+		memmove(&_pending[0], &_pending[1], _num_pending * sizeof(_pending[0]));
+
+		const bool success = (req.block_row < 0) ? loadTile(req) : loadBlock(req);
+
+		if (!success) {
+			_load_failures++;
+		}
+
+		loads++;
+	}
+
+	_loads += loads;
+	return loads;
+}
+
+bool TerrainTileCache::loadTile(const Request &req)
+{
+	if (findTile(req.lat_deg, req.lon_deg) != nullptr) {
+		return true;
+	}
+
+	char path[64];
+	tilePath(req.lat_deg, req.lon_deg, path, sizeof(path));
+
+	uint16_t samples = 0;
+	struct stat st;
+
+	if (stat(path, &st) == 0) {
+		const int n = static_cast<int>(sqrtf(st.st_size / 2.f) + 0.5f);
+
+		if ((n >= 2) && (n <= UINT16_MAX) && (static_cast<off_t>(2 * n * n) == st.st_size)) {
+			samples = n;
+
+		} else {
+			PX4_ERR("invalid tile %s", path);
+		}
+	}
+
+	// replace the least recently used tile, a missing tile is remembered to avoid retrying
+	Tile *slot = &_tiles[0];
+
+	for (Tile &tile : _tiles) {
+		if (!tile.valid) {
+			slot = &tile;
+			break;
+		}
+
+		if (tile.last_used < slot->last_used) {
+			slot = &tile;
+		}
+	}
+
+	slot->lat_deg = req.lat_deg;
+	slot->lon_deg = req.lon_deg;
+	slot->samples = samples;
+	slot->last_used = ++_access_counter;
+	slot->valid = true;
+
+	return samples > 0;
+}
+
+bool TerrainTileCache::loadBlock(const Request &req)
+{
+	const Tile *tile = findTile(req.lat_deg, req.lon_deg);
+
+	if (tile == nullptr) {
+		// the tile header was replaced in the meantime
+		request(req.lat_deg, req.lon_deg, -1, -1);
+		return false;
+	}
+
+	for (const Block &block : _blocks) {
+		if (block.valid && (block.block_row == req.block_row) && (block.block_col == req.block_col)
+		    && (block.lat_deg == req.lat_deg) && (block.lon_deg == req.lon_deg)) {
+			return true;
+		}
+	}
+
+	char path[64];
+	tilePath(req.lat_deg, req.lon_deg, path, sizeof(path));
+
+	const int fd = open(path, O_RDONLY);
+
+	if (fd < 0) {
+		return false;
+	}
+
+	Block *slot = &_blocks[0];
+
+	for (Block &block : _blocks) {
+		if (!block.valid) {
+			slot = &block;
+			break;
+		}
+
+		if (block.last_used < slot->last_used) {
+			slot = &block;
+		}
+	}
+
+	slot->valid = false;
+
+	const int samples = tile->samples;
+	const int first_row = req.block_row * BLOCK_SIZE;
+	const int first_col = req.block_col * BLOCK_SIZE;
+	const int num_cols = math::min(BLOCK_SIZE, samples - first_col);
+	bool success = num_cols > 0;
+
+	for (int i = 0; i < BLOCK_SIZE * BLOCK_SIZE; i++) {
+		slot->heights[i] = VOID_HEIGHT;
+	}
+
+	for (int r = 0; success && (r < BLOCK_SIZE) && (first_row + r < samples); r++) {
+		uint8_t buffer[2 * BLOCK_SIZE];
+		const off_t offset = 2 * (static_cast<off_t>(first_row + r) * samples + first_col);
+		const ssize_t len = 2 * num_cols;
+
+		if ((lseek(fd, offset, SEEK_SET) != offset) || (read(fd, buffer, len) != len)) {
+			success = false;
+			break;
+		}
+
+		for (int c = 0; c < num_cols; c++) {
+			// big endian
+			slot->heights[r * BLOCK_SIZE + c] = static_cast<int16_t>((buffer[2 * c] << 8) | buffer[2 * c + 1]);
+		}
+	}
+
+	close(fd);
+
+	if (success) {
+		slot->lat_deg = req.lat_deg;
+		slot->lon_deg = req.lon_deg;
+		slot->block_row = req.block_row;
+		slot->block_col = req.block_col;
+		slot->last_used = ++_access_counter;
+		slot->valid = true;
+	}
+
+	return success;
+}
+
+void TerrainTileCache::tilePath(int16_t lat_deg, int16_t lon_deg, char *path, size_t size) const
+{
+	snprintf(path, size, "%s/%c%02d%c%03d.hgt", _directory,
+		 (lat_deg >= 0) ? 'N' : 'S', abs(lat_deg),
+		 (lon_deg >= 0) ? 'E' : 'W', abs(lon_deg));
+}
+
+void TerrainTileCache::print_status() const
+{
+	int resident_tiles = 0;
+	int resident_blocks = 0;
+
+	for (const Tile &tile : _tiles) {
+		if (tile.valid && (tile.samples > 0)) {
+			resident_tiles++;
+		}
+	}
+
+	for (const Block &block : _blocks) {
+		if (block.valid) {
+			resident_blocks++;
+		}
+	}
+
+	PX4_INFO("terrain tiles: %s, %d/%d tiles, %d/%d blocks resident, %d pending", _directory,
+		 resident_tiles, NUM_TILES, resident_blocks, NUM_BLOCKS, _num_pending);
+	PX4_INFO("terrain lookups: %" PRIu32 " hits, %" PRIu32 " misses, %" PRIu32 " loads, %" PRIu32 " failed",
+		 _hits, _misses, _loads, _load_failures);
+}
@@ -0,0 +1,159 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file TerrainTileCache.hpp
+ *
+ * Cache of digital elevation model tiles on the storage device, for terrain height
+ * and gradient lookups without file access in the caller's loop.
+ *
+ * Tiles use the SRTM .hgt format: one file per 1x1 degree cell named after its
+ * south west corner (e.g. N47E008.hgt), containing N x N big endian int16 heights
+ * in meters AMSL, row major from the north west corner. The tile edges overlap with
+ * the neighbouring tiles, N is derived from the file size (1201 for SRTM3).
+ *
+ * The tiles are read in blocks of BLOCK_SIZE x BLOCK_SIZE samples into a fixed number
+ * of RAM slots with least recently used replacement. Lookups only access resident
+ * blocks and queue the missing ones, which are read by update() from a context that
+ * is allowed to block on file I/O.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <matrix/math.hpp>
+#include <px4_platform_common/defines.h>
+
+class TerrainTileCache
+{
+public:
+	static constexpr int BLOCK_SIZE = 32; ///< samples per block edge
+	static constexpr int NUM_BLOCKS = 8; ///< resident blocks
+	static constexpr int NUM_TILES = 4; ///< resident tile headers
+	static constexpr int MAX_PENDING = 8; ///< queued block loads
+
+	/**
+	 * @param directory directory containing the .hgt files
+	 */
+	explicit TerrainTileCache(const char *directory = PX4_STORAGEDIR "/terrain");
+	~TerrainTileCache() = default;
+
+	/**
+	 * Terrain height at a position, bilinearly interpolated. Does not access the file system,
+	 * if the required data is not resident it is queued for loading.
+	 * @param lat latitude [deg]
+	 * @param lon longitude [deg]
+	 * @param elevation terrain height [m AMSL]
+	 * @return true if the data was available
+	 */
+	bool getElevation(double lat, double lon, float &elevation);
+
+	/**
+	 * Terrain height and gradient at a position, see getElevation()
+	 * @param gradient_ne terrain slope along north and east [m/m]
+	 */
+	bool getElevationAndGradient(double lat, double lon, float &elevation, matrix::Vector2f &gradient_ne);
+
+	/**
+	 * Queue the data around a position for loading, e.g. a lookahead point
+	 */
+	void prefetch(double lat, double lon);
+
+	/**
+	 * Load queued blocks from the storage device, blocks on file I/O
+	 * @param max_loads maximum number of blocks to read in this call
+	 * @return number of blocks read
+	 */
+	int update(int max_loads = 1);
+
+	void print_status() const;
+
+private:
+	struct Tile {
+		int16_t lat_deg;	///< latitude of the south west corner [deg]
+		int16_t lon_deg;	///< longitude of the south west corner [deg]
+		uint16_t samples;	///< samples per edge, 0 if the tile does not exist
+		uint32_t last_used;
+		bool valid;
+	};
+
+	struct Block {
+		int16_t lat_deg;
+		int16_t lon_deg;
+		uint16_t block_row;
+		uint16_t block_col;
+		uint32_t last_used;
+		bool valid;
+		int16_t heights[BLOCK_SIZE * BLOCK_SIZE];
+	};
+
+	struct Request {
+		int16_t lat_deg;
+		int16_t lon_deg;
+		int32_t block_row; ///< -1 to load the tile header
+		int32_t block_col;
+	};
+
+	/**
+	 * Find the four samples around a position
+	 * @param row fractional row of the position in the tile, from north
+	 * @param col fractional column of the position in the tile, from west
+	 * @param samples heights of the four samples, [row][col]
+	 * @param spacing_deg sample spacing [deg]
+	 */
+	bool getSamples(double lat, double lon, double &row, double &col, float samples[2][2], double &spacing_deg);
+
+	const Tile *findTile(int16_t lat_deg, int16_t lon_deg);
+	bool getSample(const Tile &tile, int row, int col, int16_t &height);
+	void request(int16_t lat_deg, int16_t lon_deg, int32_t block_row, int32_t block_col);
+
+	bool loadTile(const Request &req);
+	bool loadBlock(const Request &req);
+	void tilePath(int16_t lat_deg, int16_t lon_deg, char *path, size_t size) const;
+
+	static constexpr int16_t VOID_HEIGHT = INT16_MIN;
+
+	const char *_directory;
+
+	Tile _tiles[NUM_TILES] {};
+	Block _blocks[NUM_BLOCKS] {};
+	Request _pending[MAX_PENDING] {};
+	int _num_pending{0};
+	uint32_t _access_counter{0};
+
+	uint32_t _hits{0};
+	uint32_t _misses{0};
+	uint32_t _loads{0};
+	uint32_t _load_failures{0};
+};
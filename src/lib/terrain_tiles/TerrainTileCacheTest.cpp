@@ -0,0 +1,166 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include "TerrainTileCache.hpp"
+
+#include <math.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+#include <lib/geo/geo.h>
+
+static constexpr int SAMPLES = 65;
+static constexpr const char *TILE_DIRECTORY = "/tmp/terrain_tile_cache_test";
+
+// plane through the tile, rising towards north and east
+static int16_t testHeight(int row, int col)
+{
+	return static_cast<int16_t>(1000 + 3 * (SAMPLES - 1 - row) + 5 * col);
+}
+
+class TerrainTileCacheTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		mkdir(TILE_DIRECTORY, 0777);
+		FILE *file = fopen("/tmp/terrain_tile_cache_test/N47E008.hgt", "wb");
+		ASSERT_NE(file, nullptr);
+
+		for (int row = 0; row < SAMPLES; row++) {
+			for (int col = 0; col < SAMPLES; col++) {
+				const uint16_t height = static_cast<uint16_t>(testHeight(row, col));
+				const uint8_t bytes[2] = {static_cast<uint8_t>(height >> 8), static_cast<uint8_t>(height & 0xff)};
+				fwrite(bytes, 1, sizeof(bytes), file);
+			}
+		}
+
+		fclose(file);
+	}
+
+	void TearDown() override
+	{
+		remove("/tmp/terrain_tile_cache_test/N47E008.hgt");
+		rmdir(TILE_DIRECTORY);
+	}
+
+	// the tile header and the blocks are queued in separate steps
+	void load(TerrainTileCache &cache, double lat, double lon)
+	{
+		for (int i = 0; i < 3; i++) {
+			cache.prefetch(lat, lon);
+			cache.update(TerrainTileCache::MAX_PENDING);
+		}
+	}
+};
+
+TEST_F(TerrainTileCacheTest, lookupAfterLoad)
+{
+	TerrainTileCache cache(TILE_DIRECTORY);
+	float elevation = NAN;
+
+	// WHEN: the data is not resident yet
+	// THEN: the lookup fails without file access and queues the data
+	EXPECT_FALSE(cache.getElevation(47.5, 8.5, elevation));
+	load(cache, 47.5, 8.5);
+
+	// WHEN: the data was loaded
+	// THEN: the lookup succeeds
+	ASSERT_TRUE(cache.getElevation(47.5, 8.5, elevation));
+	EXPECT_NEAR(elevation, 1000.f + 3.f * 32.f + 5.f * 32.f, 0.01f);
+}
+
+TEST_F(TerrainTileCacheTest, interpolationAndGradient)
+{
+	TerrainTileCache cache(TILE_DIRECTORY);
+
+	const double lat = 47.3;
+	const double lon = 8.7;
+	load(cache, lat, lon);
+
+	float elevation = NAN;
+	matrix::Vector2f gradient;
+	ASSERT_TRUE(cache.getElevationAndGradient(lat, lon, elevation, gradient));
+
+	// heights along a plane are reproduced exactly by the bilinear interpolation
+	const double row = (48.0 - lat) * (SAMPLES - 1);
+	const double col = (lon - 8.0) * (SAMPLES - 1);
+	EXPECT_NEAR(elevation, 1000.0 + 3.0 * (SAMPLES - 1 - row) + 5.0 * col, 0.01);
+
+	const float spacing_north = math::radians(1.f / (SAMPLES - 1)) * CONSTANTS_RADIUS_OF_EARTH_F;
+	const float spacing_east = spacing_north * cosf(math::radians(static_cast<float>(lat)));
+	EXPECT_NEAR(gradient(0), 3.f / spacing_north, 1e-6f);
+	EXPECT_NEAR(gradient(1), 5.f / spacing_east, 1e-6f);
+}
+
+TEST_F(TerrainTileCacheTest, tileEdges)
+{
+	TerrainTileCache cache(TILE_DIRECTORY);
+
+	// the north east corner is the last sample of the tile
+	load(cache, 47.99999, 8.99999);
+
+	float elevation = NAN;
+	ASSERT_TRUE(cache.getElevation(47.99999, 8.99999, elevation));
+	EXPECT_NEAR(elevation, testHeight(0, SAMPLES - 1), 0.1f);
+}
+
+TEST_F(TerrainTileCacheTest, missingTile)
+{
+	TerrainTileCache cache(TILE_DIRECTORY);
+	float elevation = NAN;
+
+	EXPECT_FALSE(cache.getElevation(10.5, 20.5, elevation));
+	load(cache, 10.5, 20.5);
+	EXPECT_FALSE(cache.getElevation(10.5, 20.5, elevation));
+
+	// a missing tile is not requested again
+	EXPECT_EQ(cache.update(), 0);
+}
+
+TEST_F(TerrainTileCacheTest, blockReplacement)
+{
+	TerrainTileCache cache(TILE_DIRECTORY);
+	float elevation = NAN;
+
+	// WHEN: more blocks are used than fit into RAM
+	for (int i = 0; i < 3 * TerrainTileCache::NUM_BLOCKS; i++) {
+		const double lat = 47.01 + 0.97 * (i % 4) / 3.0;
+		const double lon = 8.01 + 0.97 * (i / 4) / 5.0;
+		load(cache, lat, lon);
+
+		// THEN: the recently loaded data is resident
+		ASSERT_TRUE(cache.getElevation(lat, lon, elevation));
+	}
+}
@@ -119,6 +119,69 @@ WindEstimator::fuse_airspeed(uint64_t time_now, const float true_airspeed, const
 
 	_time_last_airspeed_fuse = time_now;
 
+	if (fuse_airspeed_measurement(true_airspeed, velI, hor_vel_variance, q_att)) {
+		run_sanity_checks();
+	}
+}
+
+void
+WindEstimator::fuse_beta(uint64_t time_now, const matrix::Vector3f &velI, const float hor_vel_variance,
+			 const matrix::Quatf &q_att)
+{
+	if (!_initialised) {
+		_initialised = initialise(velI, hor_vel_variance, matrix::Eulerf(q_att).psi());
+		return;
+	}
+
+	// don't fuse faster than 10Hz
+	if (time_now - _time_last_beta_fuse < 100_ms) {
+		return;
+	}
+
+	_time_last_beta_fuse = time_now;
+
+	if (fuse_beta_measurement(velI, hor_vel_variance, q_att)) {
+		run_sanity_checks();
+	}
+}
+
+void
+WindEstimator::fuse_airspeed_and_beta(uint64_t time_now, const float true_airspeed, const matrix::Vector3f &velI,
+				      const float hor_vel_variance, const matrix::Quatf &q_att)
+{
+	if (!_initialised) {
+		// try to initialise
+		_initialised = initialise(velI, hor_vel_variance, matrix::Eulerf(q_att).psi(), true_airspeed, _tas_var);
+		return;
+	}
+
+	// don't fuse faster than 10Hz, both measurements share the same time base
+	if (time_now - _time_last_airspeed_fuse < 100_ms) {
+		return;
+	}
+
+	_time_last_airspeed_fuse = time_now;
+	_time_last_beta_fuse = time_now;
+
+	bool fused = fuse_airspeed_measurement(true_airspeed, velI, hor_vel_variance, q_att);
+
+	if (_tas_innov_var < FLT_EPSILON) {
+		// filter was re-initialised
+		return;
+	}
+
+	// sequential scalar updates, sideslip is fused on top of the airspeed corrected state
+	fused |= fuse_beta_measurement(velI, hor_vel_variance, q_att);
+
+	if (fused) {
+		run_sanity_checks();
+	}
+}
+
+bool
+WindEstimator::fuse_airspeed_measurement(const float true_airspeed, const matrix::Vector3f &velI,
+		const float hor_vel_variance, const matrix::Quatf &q_att)
+{
 	matrix::Matrix<float, 1, 3> H_tas;
 	matrix::Matrix<float, 3, 1> K;
 
@@ -130,10 +193,10 @@ WindEstimator::fuse_airspeed(uint64_t time_now, const float true_airspeed, const
 	if (_tas_innov_var < FLT_EPSILON) {
 		// re init filter in case of a negative variance, and trigger early return to not fuse measurement
 		_initialised = initialise(velI, hor_vel_variance, matrix::Eulerf(q_att).psi(), true_airspeed, _tas_var);
-		return;
+		return false;
 
 	} else if (meas_is_rejected) {
-		return;
+		return false;
 	}
 
 	// apply correction to state
@@ -141,29 +204,16 @@ WindEstimator::fuse_airspeed(uint64_t time_now, const float true_airspeed, const
 	_state(INDEX_W_E) += _tas_innov * K(INDEX_W_E, 0);
 	_state(INDEX_TAS_SCALE) += _tas_innov * K(INDEX_TAS_SCALE, 0);
 
-	// update covariance matrix
-	_P = _P - K * H_tas * _P;
+	// update covariance matrix, H * P first keeps this an outer product of two vectors
+	_P = _P - K * (H_tas * _P);
 
-	run_sanity_checks();
+	return true;
 }
 
-void
-WindEstimator::fuse_beta(uint64_t time_now, const matrix::Vector3f &velI, const float hor_vel_variance,
-			 const matrix::Quatf &q_att)
+bool
+WindEstimator::fuse_beta_measurement(const matrix::Vector3f &velI, const float hor_vel_variance,
+				     const matrix::Quatf &q_att)
 {
-	if (!_initialised) {
-		_initialised = initialise(velI, hor_vel_variance, matrix::Eulerf(q_att).psi());
-		return;
-	}
-
-	// don't fuse faster than 10Hz
-	if (time_now - _time_last_beta_fuse < 100_ms) {
-		return;
-	}
-
-	_time_last_beta_fuse = time_now;
-
-
 	matrix::Matrix<float, 1, 3> H_beta;
 	matrix::Matrix<float, 3, 1> K;
 
@@ -175,10 +225,10 @@ WindEstimator::fuse_beta(uint64_t time_now, const matrix::Vector3f &velI, const
 	if (_beta_innov_var < FLT_EPSILON) {
 		// re init filter in case of a negative variance, and trigger early return to not fuse measurement
 		_initialised = initialise(velI, hor_vel_variance, matrix::Eulerf(q_att).psi());
-		return;
+		return false;
 
 	} else if (meas_is_rejected) {
-		return;
+		return false;
 	}
 
 	// apply correction to state
@@ -186,10 +236,10 @@ WindEstimator::fuse_beta(uint64_t time_now, const matrix::Vector3f &velI, const
 	_state(INDEX_W_E) += _beta_innov * K(INDEX_W_E, 0);
 	_state(INDEX_TAS_SCALE) += _beta_innov * K(INDEX_TAS_SCALE, 0);
 
-	// update covariance matrix
-	_P = _P - K * H_beta * _P;
+	// update covariance matrix, H * P first keeps this an outer product of two vectors
+	_P = _P - K * (H_beta * _P);
 
-	run_sanity_checks();
+	return true;
 }
 
 void
@@ -68,6 +68,13 @@ public:
 	void fuse_beta(uint64_t time_now, const matrix::Vector3f &velI, const float hor_vel_variance,
 		       const matrix::Quatf &q_att);
 
+	/**
+	 * Fuse airspeed and sideslip as two sequential scalar updates sharing one rate limit and one
+	 * covariance sanity check, equivalent to calling fuse_airspeed() and fuse_beta() at the same time.
+	 */
+	void fuse_airspeed_and_beta(uint64_t time_now, float true_airspeed, const matrix::Vector3f &velI,
+				    const float hor_vel_variance, const matrix::Quatf &q_att);
+
 	bool is_estimate_valid() { return _initialised; }
 
 	bool check_if_meas_is_rejected(float innov, float innov_var, uint8_t gate_size);
@@ -138,6 +145,11 @@ private:
 	bool initialise(const matrix::Vector3f &velI, const float hor_vel_variance, const float heading_rad,
 			const float tas_meas = NAN, const float tas_variance = NAN);
 
+	// scalar measurement updates, return true if the measurement was fused
+	bool fuse_airspeed_measurement(float true_airspeed, const matrix::Vector3f &velI, const float hor_vel_variance,
+				       const matrix::Quatf &q_att);
+	bool fuse_beta_measurement(const matrix::Vector3f &velI, const float hor_vel_variance, const matrix::Quatf &q_att);
+
 	void run_sanity_checks();
 
 	// return the square of two floating point numbers
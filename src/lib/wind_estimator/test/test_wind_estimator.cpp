@@ -0,0 +1,77 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * Run this test only using make tests TESTFILTER=unit-test_wind_estimator
+ */
+
+#include <gtest/gtest.h>
+#include <matrix/math.hpp>
+#include "../WindEstimator.hpp"
+
+using namespace matrix;
+
+TEST(TestWindEstimator, CombinedFusionMatchesSequentialFusion)
+{
+	// GIVEN: two estimators initialised with the same airspeed measurement
+	WindEstimator sequential;
+	WindEstimator combined;
+
+	const Vector3f vel_i{15.f, 3.f, 0.5f};
+	const Quatf q_att{Eulerf{0.05f, 0.02f, 0.1f}};
+	const float hor_vel_var = 0.1f;
+
+	uint64_t time_now = 1_s;
+	sequential.fuse_airspeed(time_now, 14.f, vel_i, hor_vel_var, q_att);
+	combined.fuse_airspeed_and_beta(time_now, 14.f, vel_i, hor_vel_var, q_att);
+
+	// WHEN: airspeed and sideslip are fused either separately or in one step
+	for (int i = 0; i < 100; i++) {
+		time_now += 100_ms;
+		const float true_airspeed = 14.f + 0.5f * sinf(0.1f * i);
+
+		sequential.update(time_now);
+		sequential.fuse_airspeed(time_now, true_airspeed, vel_i, hor_vel_var, q_att);
+		sequential.fuse_beta(time_now, vel_i, hor_vel_var, q_att);
+
+		combined.update(time_now);
+		combined.fuse_airspeed_and_beta(time_now, true_airspeed, vel_i, hor_vel_var, q_att);
+	}
+
+	// THEN: the estimates are the same
+	EXPECT_TRUE(combined.is_estimate_valid());
+	EXPECT_TRUE(isEqual(combined.get_wind(), sequential.get_wind()));
+	EXPECT_TRUE(isEqual(combined.get_wind_var(), sequential.get_wind_var()));
+	EXPECT_FLOAT_EQ(combined.get_tas_scale(), sequential.get_tas_scale());
+	EXPECT_FLOAT_EQ(combined.get_beta_innov(), sequential.get_beta_innov());
+}
@@ -66,7 +66,14 @@ static constexpr unsigned get_lookup_table_index(float *val, float min, float ma
 	return static_cast<unsigned>((-(min) + *val) / SAMPLING_RES);
 }
 
-static constexpr float get_table_data(float latitude_deg, float longitude_deg, const int16_t table[LAT_DIM][LON_DIM])
+struct TableCell {
+	unsigned lat_index;
+	unsigned lon_index;
+	float lat_scale; ///< position inside the cell [0, 1]
+	float lon_scale; ///< position inside the cell [0, 1]
+};
+
+static TableCell get_table_cell(float latitude_deg, float longitude_deg)
 {
 	latitude_deg = math::constrain(latitude_deg, SAMPLING_MIN_LAT, SAMPLING_MAX_LAT);
 
@@ -82,23 +89,38 @@ static constexpr float get_table_data(float latitude_deg, float longitude_deg, c
 	float min_lat = floorf(latitude_deg / SAMPLING_RES) * SAMPLING_RES;
 	float min_lon = floorf(longitude_deg / SAMPLING_RES) * SAMPLING_RES;
 
+	TableCell cell{};
+
 	/* find index of nearest low sampling point */
-	unsigned min_lat_index = get_lookup_table_index(&min_lat, SAMPLING_MIN_LAT, SAMPLING_MAX_LAT);
-	unsigned min_lon_index = get_lookup_table_index(&min_lon, SAMPLING_MIN_LON, SAMPLING_MAX_LON);
+	cell.lat_index = get_lookup_table_index(&min_lat, SAMPLING_MIN_LAT, SAMPLING_MAX_LAT);
+	cell.lon_index = get_lookup_table_index(&min_lon, SAMPLING_MIN_LON, SAMPLING_MAX_LON);
 
-	const float data_sw = table[min_lat_index][min_lon_index];
-	const float data_se = table[min_lat_index][min_lon_index + 1];
-	const float data_ne = table[min_lat_index + 1][min_lon_index + 1];
-	const float data_nw = table[min_lat_index + 1][min_lon_index];
+	cell.lat_scale = constrain((latitude_deg - min_lat) / SAMPLING_RES, 0.f, 1.f);
+	cell.lon_scale = constrain((longitude_deg - min_lon) / SAMPLING_RES, 0.f, 1.f);
 
-	/* perform bilinear interpolation on the four grid corners */
-	const float lat_scale = constrain((latitude_deg - min_lat) / SAMPLING_RES, 0.f, 1.f);
-	const float lon_scale = constrain((longitude_deg - min_lon) / SAMPLING_RES, 0.f, 1.f);
+	return cell;
+}
 
-	const float data_min = lon_scale * (data_se - data_sw) + data_sw;
-	const float data_max = lon_scale * (data_ne - data_nw) + data_nw;
+static GeoMagFieldCache::Bilinear get_bilinear(const TableCell &cell, const int16_t table[LAT_DIM][LON_DIM])
+{
+	const float data_sw = table[cell.lat_index][cell.lon_index];
+	const float data_se = table[cell.lat_index][cell.lon_index + 1];
+	const float data_ne = table[cell.lat_index + 1][cell.lon_index + 1];
+	const float data_nw = table[cell.lat_index + 1][cell.lon_index];
+
+	GeoMagFieldCache::Bilinear b{};
+	b.sw = data_sw;
+	b.d_lon = data_se - data_sw;
+	b.d_lat = data_nw - data_sw;
+	b.d_lat_lon = (data_ne - data_nw) - (data_se - data_sw);
+	return b;
+}
 
-	return lat_scale * (data_max - data_min) + data_min;
+static float get_table_data(float latitude_deg, float longitude_deg, const int16_t table[LAT_DIM][LON_DIM])
+{
+	/* perform bilinear interpolation on the four grid corners */
+	const TableCell cell = get_table_cell(latitude_deg, longitude_deg);
+	return get_bilinear(cell, table).evaluate(cell.lat_scale, cell.lon_scale);
 }
 
 float get_mag_declination_degrees(float latitude_deg, float longitude_deg)
@@ -125,3 +147,23 @@ float get_mag_strength_tesla(float latitude_deg, float longitude_deg)
 	return get_table_data(latitude_deg, longitude_deg, totalintensity_table)
 	       * WMM_TOTALINTENSITY_SCALE_TO_NANOTESLA * 1e-9f;
 }
+
+void GeoMagFieldCache::update(float latitude_deg, float longitude_deg)
+{
+	const TableCell cell = get_table_cell(latitude_deg, longitude_deg);
+
+	if (!_valid || (cell.lat_index != _lat_index) || (cell.lon_index != _lon_index)) {
+		// entered a new cell, load its corners once
+		_declination = get_bilinear(cell, declination_table);
+		_inclination = get_bilinear(cell, inclination_table);
+		_strength = get_bilinear(cell, totalintensity_table);
+
+		_lat_index = cell.lat_index;
+		_lon_index = cell.lon_index;
+		_valid = true;
+	}
+
+	_declination_deg = _declination.evaluate(cell.lat_scale, cell.lon_scale) * WMM_DECLINATION_SCALE_TO_DEGREES;
+	_inclination_deg = _inclination.evaluate(cell.lat_scale, cell.lon_scale) * WMM_INCLINATION_SCALE_TO_DEGREES;
+	_strength_gauss = _strength.evaluate(cell.lat_scale, cell.lon_scale) * WMM_TOTALINTENSITY_SCALE_TO_NANOTESLA * 1e-5f;
+}
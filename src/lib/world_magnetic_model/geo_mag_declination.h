@@ -50,3 +50,45 @@ float get_mag_inclination_degrees(float latitude_deg, float longitude_deg);
 // return magnetic field strength in Gauss or Tesla
 float get_mag_strength_gauss(float latitude_deg, float longitude_deg);
 float get_mag_strength_tesla(float latitude_deg, float longitude_deg);
+
+/**
+ * Magnetic field lookup for a moving position.
+ * The table corners of the current grid cell are kept, positions inside the cell are
+ * interpolated from them without another table lookup.
+ */
+class GeoMagFieldCache
+{
+public:
+	// bilinear interpolation coefficients of one table cell
+	struct Bilinear {
+		float sw;
+		float d_lon;
+		float d_lat;
+		float d_lat_lon;
+
+		float evaluate(float lat_scale, float lon_scale) const
+		{
+			return sw + d_lon * lon_scale + (d_lat + d_lat_lon * lon_scale) * lat_scale;
+		}
+	};
+
+	// evaluate the field at a position, the accessors return the result
+	void update(float latitude_deg, float longitude_deg);
+
+	float declination_degrees() const { return _declination_deg; }
+	float inclination_degrees() const { return _inclination_deg; }
+	float strength_gauss() const { return _strength_gauss; }
+
+private:
+	Bilinear _declination{};
+	Bilinear _inclination{};
+	Bilinear _strength{};
+
+	unsigned _lat_index{0};
+	unsigned _lon_index{0};
+	bool _valid{false};
+
+	float _declination_deg{0.f};
+	float _inclination_deg{0.f};
+	float _strength_gauss{0.f};
+};
@@ -78,12 +78,9 @@ AirspeedValidator::update_wind_estimator(const uint64_t time_now_usec, float air
 
 	if (lpos_valid && _in_fixed_wing_flight) {
 
-		// airspeed fusion (with raw TAS)
+		// airspeed (with raw TAS) and sideslip fusion
 		const float hor_vel_variance =  lpos_evh * lpos_evh;
-		_wind_estimator.fuse_airspeed(time_now_usec, airspeed_true_raw, vI, hor_vel_variance, q_att);
-
-		// sideslip fusion
-		_wind_estimator.fuse_beta(time_now_usec, vI, hor_vel_variance, q_att);
+		_wind_estimator.fuse_airspeed_and_beta(time_now_usec, airspeed_true_raw, vI, hor_vel_variance, q_att);
 	}
 }
 
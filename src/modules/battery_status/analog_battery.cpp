@@ -72,6 +72,13 @@ AnalogBattery::AnalogBattery(int index, ModuleParams *parent, const int sample_i
 
 void
 AnalogBattery::updateBatteryStatusADC(hrt_abstime timestamp, float voltage_raw, float current_raw)
+{
+	updateMeasurementsADC(voltage_raw, current_raw);
+	Battery::updateAndPublishBatteryStatus(timestamp);
+}
+
+void
+AnalogBattery::updateMeasurementsADC(float voltage_raw, float current_raw)
 {
 	const float voltage_v = voltage_raw * _analog_params.v_div;
 	const float current_a = (current_raw - _analog_params.v_offs_cur) * _analog_params.a_per_v;
@@ -82,7 +89,6 @@ AnalogBattery::updateBatteryStatusADC(hrt_abstime timestamp, float voltage_raw,
 	Battery::setConnected(connected);
 	Battery::updateVoltage(voltage_v);
 	Battery::updateCurrent(current_a);
-	Battery::updateAndPublishBatteryStatus(timestamp);
 }
 
 bool AnalogBattery::is_valid()
@@ -53,6 +53,14 @@ public:
 	 */
 	void updateBatteryStatusADC(hrt_abstime timestamp, float voltage_raw, float current_raw);
 
+	/**
+	 * Set the measurements without updating the battery status, for batteries updated by a BatteryBank.
+	 *
+	 * @param voltage_raw Battery voltage read from ADC, volts
+	 * @param current_raw Voltage of current sense resistor, volts
+	 */
+	void updateMeasurementsADC(float voltage_raw, float current_raw);
+
 	/**
 	 * Whether the ADC channel for the voltage of this battery is valid.
 	 * Corresponds to BOARD_BRICK_VALID_LIST
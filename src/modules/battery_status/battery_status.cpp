@@ -64,6 +64,7 @@
 #include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
 
 #include "analog_battery.h"
+#include <battery/battery_bank.h>
 
 using namespace time_literals;
 
@@ -118,6 +119,8 @@ private:
 #endif
 	}; // End _analogBatteries
 
+	BatteryBank _battery_bank;
+
 	perf_counter_t	_loop_perf;			/**< loop performance counter */
 
 	/**
@@ -143,6 +146,10 @@ BatteryStatus::BatteryStatus() :
 #endif
 	_loop_perf(perf_alloc(PC_ELAPSED, MODULE_NAME))
 {
+	for (int b = 0; b < BOARD_NUMBER_BRICKS; b++) {
+		_battery_bank.addBattery(_analogBatteries[b]);
+	}
+
 	updateParams();
 }
 
@@ -223,13 +230,15 @@ BatteryStatus::adc_poll()
 		for (int b = 0; b < BOARD_NUMBER_BRICKS; b++) {
 
 			if (has_bat_voltage_adc_channel[b]) { // Do not publish if no voltage channel configured
-				_analogBatteries[b]->updateBatteryStatusADC(
-					hrt_absolute_time(),
+				_analogBatteries[b]->updateMeasurementsADC(
 					bat_voltage_adc_readings[b],
 					bat_current_adc_readings[b]
 				);
 			}
 		}
+
+		// all bricks are sampled by the same ADC report
+		_battery_bank.updateAndPublishBatteryStatus(hrt_absolute_time());
 	}
 }
 
@@ -49,7 +49,10 @@ CameraFeedback::CameraFeedback() :
 bool
 CameraFeedback::init()
 {
-	if (!_trigger_sub.registerCallback()) {
+	_gpos_sub.set_interval_us(HISTORY_INTERVAL_US);
+	_att_sub.set_interval_us(HISTORY_INTERVAL_US);
+
+	if (!_trigger_sub.registerCallback() || !_gpos_sub.registerCallback() || !_att_sub.registerCallback()) {
 		PX4_ERR("callback registration failed");
 		return false;
 	}
@@ -59,31 +62,48 @@ CameraFeedback::init()
 	return true;
 }
 
+void
+CameraFeedback::update_history()
+{
+	vehicle_global_position_s gpos;
+
+	if (_gpos_sub.update(&gpos) && gpos.timestamp_sample != 0) {
+		_gpos_history.push(PositionSample{gpos.timestamp_sample, gpos.lat, gpos.lon, gpos.alt,
+						 gpos.terrain_alt, gpos.terrain_alt_valid});
+	}
+
+	vehicle_attitude_s att;
+
+	if (_att_sub.update(&att) && att.timestamp_sample != 0) {
+		_att_history.push(AttitudeSample{att.timestamp_sample, matrix::Quatf(att.q)});
+	}
+}
+
+bool
+CameraFeedback::history_covers(hrt_abstime timestamp) const
+{
+	return !_gpos_history.empty() && (_gpos_history.newest().timestamp_sample >= timestamp)
+	       && !_att_history.empty() && (_att_history.newest().timestamp_sample >= timestamp);
+}
+
 void
 CameraFeedback::Run()
 {
 	if (should_exit()) {
 		_trigger_sub.unregisterCallback();
+		_gpos_sub.unregisterCallback();
+		_att_sub.unregisterCallback();
 		exit_and_cleanup();
 		return;
 	}
 
+	update_history();
+
 	camera_trigger_s trig{};
 
 	while (_trigger_sub.update(&trig)) {
 
-		// update geotagging subscriptions
-		vehicle_global_position_s gpos{};
-		_gpos_sub.copy(&gpos);
-
-		vehicle_attitude_s att{};
-		_att_sub.copy(&att);
-
-		if (trig.timestamp == 0 ||
-		    gpos.timestamp == 0 ||
-		    att.timestamp == 0) {
-
-			// reject until we have valid data
+		if (trig.timestamp == 0) {
 			continue;
 		}
 
@@ -92,65 +112,114 @@ CameraFeedback::Run()
 			continue;
 		}
 
-		camera_capture_s capture{};
-
-		// Fill timestamps
-		capture.timestamp = trig.timestamp;
-		capture.timestamp_utc = trig.timestamp_utc;
+		if (_pending_count == MAX_PENDING_TRIGGERS) {
+			// queue full, geotag the oldest trigger with what we have
+			publish_capture(_pending_triggers[0]);
+			memmove(&_pending_triggers[0], &_pending_triggers[1], sizeof(camera_trigger_s) * (MAX_PENDING_TRIGGERS - 1));
+			_pending_count--;
+		}
 
-		// Fill image sequence
-		capture.seq = trig.seq;
+		_pending_triggers[_pending_count++] = trig;
+	}
 
-		// Fill position data
-		capture.lat = gpos.lat;
-		capture.lon = gpos.lon;
-		capture.alt = gpos.alt;
+	// The trigger edge is usually newer than the latest estimator output, hold it back until the
+	// history contains samples on both sides of it (or they did not arrive in time).
+	const hrt_abstime now = hrt_absolute_time();
+	uint8_t processed = 0;
 
-		if (gpos.terrain_alt_valid) {
-			capture.ground_distance = gpos.alt - gpos.terrain_alt;
+	while (processed < _pending_count) {
+		const camera_trigger_s &pending = _pending_triggers[processed];
 
-		} else {
-			capture.ground_distance = -1.0f;
+		if (!history_covers(pending.timestamp) && (now < pending.timestamp + MAX_TRIGGER_DELAY_US)) {
+			break;
 		}
 
-		// Fill attitude data
-		gimbal_device_attitude_status_s gimbal{};
-
-		if (_gimbal_sub.copy(&gimbal) && (hrt_elapsed_time(&gimbal.timestamp) < 1_s)) {
-			if (gimbal.device_flags & gimbal_device_attitude_status_s::DEVICE_FLAGS_YAW_LOCK) {
-				// Gimbal yaw angle is absolute angle relative to North
-				capture.q[0] = gimbal.q[0];
-				capture.q[1] = gimbal.q[1];
-				capture.q[2] = gimbal.q[2];
-				capture.q[3] = gimbal.q[3];
-
-			} else {
-				// Gimbal quaternion frame is in the Earth frame rotated so that the x-axis is pointing
-				// forward (yaw relative to vehicle). Get heading from the vehicle attitude and combine it
-				// with the gimbal orientation.
-				const matrix::Eulerf euler_vehicle(matrix::Quatf(att.q));
-				const matrix::Quatf q_heading(matrix::Eulerf(0.0f, 0.0f, euler_vehicle(2)));
-				matrix::Quatf q_gimbal(gimbal.q);
-				q_gimbal = q_heading * q_gimbal;
-
-				capture.q[0] = q_gimbal(0);
-				capture.q[1] = q_gimbal(1);
-				capture.q[2] = q_gimbal(2);
-				capture.q[3] = q_gimbal(3);
-			}
+		publish_capture(pending);
+		processed++;
+	}
+
+	if (processed > 0) {
+		_pending_count -= processed;
+		memmove(&_pending_triggers[0], &_pending_triggers[processed], sizeof(camera_trigger_s) * _pending_count);
+	}
+}
+
+void
+CameraFeedback::publish_capture(const camera_trigger_s &trig)
+{
+	const PositionSample *gpos_before = nullptr;
+	const PositionSample *gpos_after = nullptr;
+	const AttitudeSample *att_before = nullptr;
+	const AttitudeSample *att_after = nullptr;
+
+	if (!_gpos_history.find(trig.timestamp, gpos_before, gpos_after)
+	    || !_att_history.find(trig.timestamp, att_before, att_after)) {
+		// reject until we have valid data
+		return;
+	}
+
+	camera_capture_s capture{};
+
+	// Fill timestamps
+	capture.timestamp = trig.timestamp;
+	capture.timestamp_utc = trig.timestamp_utc;
+
+	// Fill image sequence
+	capture.seq = trig.seq;
+
+	// Fill position data, interpolated to the trigger time
+	const float k_pos = SampleHistory<PositionSample, HISTORY_SIZE>::factor(*gpos_before, *gpos_after, trig.timestamp);
+	capture.lat = gpos_before->lat + (gpos_after->lat - gpos_before->lat) * static_cast<double>(k_pos);
+	capture.lon = gpos_before->lon + (gpos_after->lon - gpos_before->lon) * static_cast<double>(k_pos);
+	capture.alt = math::interpolate(k_pos, 0.f, 1.f, gpos_before->alt, gpos_after->alt);
+
+	if (gpos_before->terrain_alt_valid && gpos_after->terrain_alt_valid) {
+		capture.ground_distance = capture.alt - math::interpolate(k_pos, 0.f, 1.f, gpos_before->terrain_alt,
+					  gpos_after->terrain_alt);
+
+	} else {
+		capture.ground_distance = -1.0f;
+	}
+
+	// Vehicle attitude at the trigger time, rotate from the earlier sample by the scaled delta rotation
+	const float k_att = SampleHistory<AttitudeSample, HISTORY_SIZE>::factor(*att_before, *att_after, trig.timestamp);
+	const matrix::AxisAnglef delta_att((att_before->q.inversed() * att_after->q).canonical());
+	const matrix::Quatf q_att = att_before->q * matrix::Quatf(matrix::AxisAnglef(delta_att * k_att));
+
+	// Fill attitude data
+	gimbal_device_attitude_status_s gimbal{};
+
+	if (_gimbal_sub.copy(&gimbal) && (hrt_elapsed_time(&gimbal.timestamp) < 1_s)) {
+		if (gimbal.device_flags & gimbal_device_attitude_status_s::DEVICE_FLAGS_YAW_LOCK) {
+			// Gimbal yaw angle is absolute angle relative to North
+			capture.q[0] = gimbal.q[0];
+			capture.q[1] = gimbal.q[1];
+			capture.q[2] = gimbal.q[2];
+			capture.q[3] = gimbal.q[3];
 
 		} else {
-			// No gimbal orientation, use vehicle attitude
-			capture.q[0] = att.q[0];
-			capture.q[1] = att.q[1];
-			capture.q[2] = att.q[2];
-			capture.q[3] = att.q[3];
+			// Gimbal quaternion frame is in the Earth frame rotated so that the x-axis is pointing
+			// forward (yaw relative to vehicle). Get heading from the vehicle attitude and combine it
+			// with the gimbal orientation.
+			const matrix::Eulerf euler_vehicle(q_att);
+			const matrix::Quatf q_heading(matrix::Eulerf(0.0f, 0.0f, euler_vehicle(2)));
+			matrix::Quatf q_gimbal(gimbal.q);
+			q_gimbal = q_heading * q_gimbal;
+
+			capture.q[0] = q_gimbal(0);
+			capture.q[1] = q_gimbal(1);
+			capture.q[2] = q_gimbal(2);
+			capture.q[3] = q_gimbal(3);
 		}
 
-		capture.result = 1;
-
-		_capture_pub.publish(capture);
+	} else {
+		// No gimbal orientation, use vehicle attitude
+		q_att.copyTo(capture.q);
 	}
+
+	capture.result = 1;
+
+	_capture_pub.publish(capture);
 }
 
 int
@@ -214,6 +283,10 @@ It discards topics from the `camera_trigger` module if camera capture is enabled
 For the topics that are not discarded it creates a `CameraCapture` topic with the timestamp information
 from the `CameraTrigger` and position information from the vehicle.
 
+Position and attitude are kept in a short history (200 ms) and interpolated to the trigger timestamp,
+so geotags stay accurate at high trigger rates. A trigger is held back until estimator samples newer
+than the trigger are available, or for at most 100 ms.
+
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("camera_feedback", "system");
@@ -57,6 +57,8 @@
 #include <uORB/topics/vehicle_global_position.h>
 #include <uORB/topics/gimbal_device_attitude_status.h>
 
+#include "SampleHistory.hpp"
+
 class CameraFeedback : public ModuleBase<CameraFeedback>, public ModuleParams, public px4::WorkItem
 {
 public:
@@ -76,14 +78,48 @@ public:
 
 private:
 
+	static constexpr uint32_t HISTORY_INTERVAL_US = 10000;		///< minimum spacing of history samples
+	static constexpr uint8_t HISTORY_SIZE = 20;			///< 200 ms of position and attitude
+	static constexpr uint8_t MAX_PENDING_TRIGGERS = 4;
+	static constexpr hrt_abstime MAX_TRIGGER_DELAY_US = 100000;	///< wait at most this long for samples after a trigger
+
+	struct PositionSample {
+		hrt_abstime timestamp_sample;
+		double lat;
+		double lon;
+		float alt;
+		float terrain_alt;
+		bool terrain_alt_valid;
+	};
+
+	struct AttitudeSample {
+		hrt_abstime timestamp_sample;
+		matrix::Quatf q;
+	};
+
 	void Run() override;
 
+	void update_history();
+
+	/**
+	 * Whether both histories contain a sample at or after the trigger time, i.e. the trigger can be interpolated
+	 */
+	bool history_covers(hrt_abstime timestamp) const;
+
+	void publish_capture(const camera_trigger_s &trig);
+
 	uORB::SubscriptionCallbackWorkItem _trigger_sub{this, ORB_ID(camera_trigger)};
+	uORB::SubscriptionCallbackWorkItem _gpos_sub{this, ORB_ID(vehicle_global_position)};
+	uORB::SubscriptionCallbackWorkItem _att_sub{this, ORB_ID(vehicle_attitude)};
 
-	uORB::Subscription	_gpos_sub{ORB_ID(vehicle_global_position)};
-	uORB::Subscription	_att_sub{ORB_ID(vehicle_attitude)};
 	uORB::Subscription	_gimbal_sub{ORB_ID(gimbal_device_attitude_status)};
 
+	SampleHistory<PositionSample, HISTORY_SIZE> _gpos_history{};
+	SampleHistory<AttitudeSample, HISTORY_SIZE> _att_history{};
+
+	camera_trigger_s _pending_triggers[MAX_PENDING_TRIGGERS] {};
+	uint8_t _pending_count{0};
+
 	uORB::Publication<camera_capture_s>	_capture_pub{ORB_ID(camera_capture)};
 
 	param_t _p_cam_cap_fback;
@@ -0,0 +1,133 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file SampleHistory.hpp
+ *
+ * Short time-indexed history of estimator samples, used to look up the vehicle
+ * state at the exact time of a camera trigger edge.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <drivers/drv_hrt.h>
+
+template<typename T, uint8_t N>
+class SampleHistory
+{
+public:
+	static_assert(N >= 2, "history needs at least two samples");
+
+	/**
+	 * Append a sample. Samples have to be pushed in increasing timestamp_sample order,
+	 * anything older than the newest entry is dropped.
+	 */
+	void push(const T &sample)
+	{
+		if (_size > 0 && sample.timestamp_sample <= newest().timestamp_sample) {
+			return;
+		}
+
+		_head = (_head + 1) % N;
+		_buffer[_head] = sample;
+
+		if (_size < N) {
+			_size++;
+		}
+	}
+
+	void reset() { _size = 0; }
+
+	bool empty() const { return _size == 0; }
+	uint8_t size() const { return _size; }
+
+	const T &newest() const { return _buffer[_head]; }
+	const T &oldest() const { return _buffer[(_head + N - _size + 1) % N]; }
+
+	/**
+	 * Find the two samples enclosing timestamp.
+	 * If the timestamp lies outside of the history both point to the closest sample.
+	 * @return false if the history is empty
+	 */
+	bool find(hrt_abstime timestamp, const T *&before, const T *&after) const
+	{
+		if (_size == 0) {
+			return false;
+		}
+
+		if (timestamp >= newest().timestamp_sample) {
+			before = after = &newest();
+			return true;
+		}
+
+		// walk backwards from the newest sample, triggers are usually recent
+		after = &newest();
+
+		for (uint8_t i = 1; i < _size; i++) {
+			const T &sample = _buffer[(_head + N - i) % N];
+
+			if (sample.timestamp_sample <= timestamp) {
+				before = &sample;
+				return true;
+			}
+
+			after = &sample;
+		}
+
+		before = after;
+		return true;
+	}
+
+	/**
+	 * Interpolation factor of timestamp between two samples, 0 at before and 1 at after.
+	 */
+	static float factor(const T &before, const T &after, hrt_abstime timestamp)
+	{
+		if (after.timestamp_sample <= before.timestamp_sample || timestamp <= before.timestamp_sample) {
+			return 0.f;
+		}
+
+		if (timestamp >= after.timestamp_sample) {
+			return 1.f;
+		}
+
+		return static_cast<float>(timestamp - before.timestamp_sample)
+		       / static_cast<float>(after.timestamp_sample - before.timestamp_sample);
+	}
+
+private:
+	T _buffer[N] {};
+	uint8_t _head{0};
+	uint8_t _size{0};
+};
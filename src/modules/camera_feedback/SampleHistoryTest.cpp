@@ -0,0 +1,101 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "SampleHistory.hpp"
+
+struct Sample {
+	hrt_abstime timestamp_sample;
+	float value;
+};
+
+using History = SampleHistory<Sample, 4>;
+
+TEST(SampleHistoryTest, Empty)
+{
+	History history;
+	const Sample *before = nullptr;
+	const Sample *after = nullptr;
+
+	EXPECT_TRUE(history.empty());
+	EXPECT_FALSE(history.find(1000, before, after));
+}
+
+TEST(SampleHistoryTest, FindEnclosingSamples)
+{
+	History history;
+
+	for (hrt_abstime t = 1000; t <= 6000; t += 1000) {
+		history.push(Sample{t, static_cast<float>(t)});
+	}
+
+	// only the 4 newest samples are kept
+	EXPECT_EQ(history.size(), 4);
+	EXPECT_EQ(history.oldest().timestamp_sample, 3000u);
+	EXPECT_EQ(history.newest().timestamp_sample, 6000u);
+
+	const Sample *before = nullptr;
+	const Sample *after = nullptr;
+
+	ASSERT_TRUE(history.find(4250, before, after));
+	EXPECT_EQ(before->timestamp_sample, 4000u);
+	EXPECT_EQ(after->timestamp_sample, 5000u);
+	EXPECT_FLOAT_EQ(History::factor(*before, *after, 4250), 0.25f);
+
+	// exact match
+	ASSERT_TRUE(history.find(5000, before, after));
+	EXPECT_EQ(before->timestamp_sample, 5000u);
+	EXPECT_FLOAT_EQ(History::factor(*before, *after, 5000), 0.f);
+
+	// newer than the history: hold the newest sample
+	ASSERT_TRUE(history.find(7000, before, after));
+	EXPECT_EQ(before, after);
+	EXPECT_EQ(before->timestamp_sample, 6000u);
+
+	// older than the history: hold the oldest sample
+	ASSERT_TRUE(history.find(1500, before, after));
+	EXPECT_EQ(before, after);
+	EXPECT_EQ(before->timestamp_sample, 3000u);
+	EXPECT_FLOAT_EQ(History::factor(*before, *after, 1500), 0.f);
+}
+
+TEST(SampleHistoryTest, RejectOutOfOrder)
+{
+	History history;
+	history.push(Sample{2000, 0.f});
+	history.push(Sample{1000, 0.f});
+	history.push(Sample{2000, 0.f});
+
+	EXPECT_EQ(history.size(), 1);
+}
@@ -490,6 +490,7 @@ int Commander::print_status()
 	_mode_management.printStatus();
 	perf_print_counter(_loop_perf);
 	perf_print_counter(_preflight_check_perf);
+	_health_and_arming_checks.printStatus();
 	return 0;
 }
 
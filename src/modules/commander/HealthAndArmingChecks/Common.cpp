@@ -98,7 +98,7 @@ bool Report::addExternalEvent(const event_s &event, NavModes modes)
 
 	unsigned total_size = sizeof(EventBufferHeader) + args_size;
 
-	if (total_size > sizeof(_event_buffer) - _next_buffer_idx) {
+	if (total_size > EVENT_BUFFER_SIZE - _next_buffer_idx) {
 		_buffer_overflowed = true;
 		return false;
 	}
@@ -194,11 +194,81 @@ void Report::reset()
 {
 	_current_result = (_current_result + 1) % 2;
 	_results[_current_result].reset();
+	_event_buffer = _event_buffers[_current_result];
 	_next_buffer_idx = 0;
 	_buffer_overflowed = false;
 	_results_changed = false;
 }
 
+void Report::beginCheck()
+{
+	// the check reports into empty results, which are then added to the ones of the previous checks
+	_check_start_results = _results[_current_result];
+	_check_start_buffer_idx = _next_buffer_idx;
+	_check_start_buffer_overflowed = _buffer_overflowed;
+	_results[_current_result].reset();
+	_buffer_overflowed = false;
+}
+
+void Report::endCheck(CheckOutput &output)
+{
+	const Results &check_results = _results[_current_result];
+
+	output.health = check_results.health;
+	output.arming_error = check_results.arming_checks.error;
+	output.arming_warning = check_results.arming_checks.warning;
+	output.cleared_can_arm = ~check_results.arming_checks.can_arm;
+	output.cleared_can_run = ~check_results.arming_checks.can_run;
+	output.num_events = check_results.num_events;
+	output.event_id_hash = check_results.event_id_hash;
+	output.event_buffer_start = _check_start_buffer_idx;
+	output.event_buffer_end = _next_buffer_idx;
+	output.event_buffer_run = _current_result;
+	output.buffer_overflowed = _buffer_overflowed;
+	output.valid = true;
+
+	_results[_current_result] = _check_start_results;
+	_buffer_overflowed = _check_start_buffer_overflowed;
+	addCheckOutput(output);
+}
+
+void Report::replayCheck(CheckOutput &output)
+{
+	const int size = output.event_buffer_end - output.event_buffer_start;
+
+	if (output.event_buffer_run != _current_result && size <= EVENT_BUFFER_SIZE - _next_buffer_idx) {
+		memcpy(_event_buffer + _next_buffer_idx, _event_buffers[output.event_buffer_run] + output.event_buffer_start, size);
+		output.event_buffer_start = _next_buffer_idx;
+		_next_buffer_idx += size;
+
+	} else {
+		// the events do not fit anymore, the results are still correct. Have the check run again next time.
+		output.event_buffer_start = _next_buffer_idx;
+		output.valid = false;
+		_buffer_overflowed = true;
+	}
+
+	output.event_buffer_end = _next_buffer_idx;
+	output.event_buffer_run = _current_result;
+	addCheckOutput(output);
+}
+
+void Report::addCheckOutput(const CheckOutput &output)
+{
+	Results &results = _results[_current_result];
+
+	results.health.is_present = results.health.is_present | output.health.is_present;
+	results.health.error = results.health.error | output.health.error;
+	results.health.warning = results.health.warning | output.health.warning;
+	results.arming_checks.error = results.arming_checks.error | output.arming_error;
+	results.arming_checks.warning = results.arming_checks.warning | output.arming_warning;
+	clearArmingBits(output.cleared_can_arm);
+	clearCanRunBits(output.cleared_can_run);
+	results.num_events += output.num_events;
+	results.event_id_hash ^= output.event_id_hash;
+	_buffer_overflowed |= output.buffer_overflowed;
+}
+
 void Report::prepare(uint8_t vehicle_type)
 {
 	// Get mode requirements before running any checks (in particular the mode checks require them)
@@ -317,3 +387,34 @@ bool Report::report(bool is_armed, bool force)
 			       current_results.health.error, current_results.health.warning);
 	return true;
 }
+
+void HealthAndArmingCheckBase::addInput(uORB::Subscription &subscription)
+{
+	if (_num_inputs < MAX_INPUTS) {
+		_inputs[_num_inputs++] = &subscription;
+
+	} else {
+		PX4_ERR("too many check inputs");
+	}
+}
+
+bool HealthAndArmingCheckBase::needsToRun(hrt_abstime now, bool forced)
+{
+	bool inputs_updated = false;
+
+	for (int i = 0; i < _num_inputs; ++i) {
+		inputs_updated |= _inputs[i]->updated();
+	}
+
+	bool timeout = false;
+
+	if (inputs_updated) {
+		_input_timeout_deadline = (_input_timeout > 0) ? now + _input_timeout : 0;
+
+	} else if (_input_timeout_deadline != 0 && now >= _input_timeout_deadline) {
+		_input_timeout_deadline = 0;
+		timeout = true;
+	}
+
+	return inputs_updated || timeout || forced || !_output.valid;
+}
@@ -39,6 +39,7 @@
 #include <uORB/topics/health_report.h>
 #include <uORB/topics/vehicle_status.h>
 #include <uORB/topics/failsafe_flags.h>
+#include <uORB/Subscription.hpp>
 #include <systemlib/mavlink_log.h>
 #include <drivers/drv_hrt.h>
 
@@ -189,6 +190,26 @@ public:
 		}
 	};
 
+	/**
+	 * Results and events of a single check, recorded so that they can be replayed when the check is skipped
+	 */
+	struct CheckOutput {
+		HealthResults health;
+		health_component_t arming_error{};
+		health_component_t arming_warning{};
+		NavModes cleared_can_arm{NavModes::None};
+		NavModes cleared_can_run{NavModes::None};
+
+		int num_events{0};
+		uint32_t event_id_hash{0};
+		uint16_t event_buffer_start{0}; ///< events of the check in the event buffer of the run they were recorded in
+		uint16_t event_buffer_end{0};
+		uint8_t event_buffer_run{0};
+		bool buffer_overflowed{false};
+
+		bool valid{false};
+	};
+
 	Report(failsafe_flags_s &failsafe_flags, hrt_abstime min_reporting_interval = 2_s)
 		: _min_reporting_interval(min_reporting_interval), _failsafe_flags(failsafe_flags) { }
 	~Report() = default;
@@ -316,6 +337,7 @@ private:
 	FRIEND_TEST(ReporterTest, arming_checks_mode_category2);
 	FRIEND_TEST(ReporterTest, reporting);
 	FRIEND_TEST(ReporterTest, reporting_multiple);
+	FRIEND_TEST(ReporterTest, check_replay);
 
 	/**
 	 * Reset current results.
@@ -334,14 +356,34 @@ private:
 
 	bool report(bool is_armed, bool force);
 
+	/**
+	 * Record the output of a single check: call beginCheck(), run the check, then endCheck()
+	 */
+	void beginCheck();
+	void endCheck(CheckOutput &output);
+
+	/**
+	 * Add the recorded output of a check again, instead of running it
+	 */
+	void replayCheck(CheckOutput &output);
+
+	void addCheckOutput(const CheckOutput &output);
+
 	const hrt_abstime _min_reporting_interval;
 
 	/// event buffer: stores current events + arguments.
 	/// Since the amount of extra arguments varies, 4 bytes is used here as estimate
-	uint8_t _event_buffer[(event_s::ORB_QUEUE_LENGTH - 2) * (sizeof(EventBufferHeader) + 1 + 1 + 4)];
+	static constexpr int EVENT_BUFFER_SIZE = (event_s::ORB_QUEUE_LENGTH - 2) * (sizeof(EventBufferHeader) + 1 + 1 + 4);
+	/// one buffer per result, events of skipped checks are copied over from the previous run
+	uint8_t _event_buffers[2][EVENT_BUFFER_SIZE];
+	uint8_t *_event_buffer{_event_buffers[0]};
 	int _next_buffer_idx{0};
 	bool _buffer_overflowed{false};
 
+	Results _check_start_results; ///< results before the check currently being recorded
+	int _check_start_buffer_idx{0};
+	bool _check_start_buffer_overflowed{false};
+
 	bool _already_reported{false};
 	bool _had_unreported_difference{false}; ///< true if there was a difference not reported yet (due to rate limitation)
 	bool _results_changed{false};
@@ -379,7 +421,7 @@ bool Report::addEvent(uint32_t event_id, const events::LogLevels &log_levels, co
 	static_assert(args_size <= sizeof(event_s::arguments), "Too many arguments");
 	unsigned total_size = sizeof(EventBufferHeader) + args_size;
 
-	if (total_size > sizeof(_event_buffer) - _next_buffer_idx) {
+	if (total_size > EVENT_BUFFER_SIZE - _next_buffer_idx) {
 		_buffer_overflowed = true;
 		return false;
 	}
@@ -409,4 +451,41 @@ public:
 	virtual void checkAndReport(const Context &context, Report &reporter) = 0;
 
 	void updateParams() override { ModuleParams::updateParams(); }
+
+	/**
+	 * Whether the check can be skipped if its inputs did not change (it declared its inputs)
+	 */
+	bool skippable() const { return _num_inputs > 0; }
+
+	/**
+	 * Whether a skippable check needs to run: an input got updated, the input timeout passed
+	 * or the recorded output is not valid.
+	 * @param forced run the check regardless of the inputs (e.g. the context or parameters changed)
+	 */
+	bool needsToRun(hrt_abstime now, bool forced);
+
+protected:
+	/**
+	 * Declare an input topic of the check, the check is then only run if one of its inputs got updated.
+	 * This is only for checks that do not depend on anything else than their inputs, the context and
+	 * the parameters (e.g. no failsafe flags of other checks or the current time).
+	 */
+	void addInput(uORB::Subscription &subscription);
+
+	/**
+	 * Also run the check if no input got updated for this time, for checks that detect data timeouts
+	 */
+	void setInputTimeout(hrt_abstime timeout) { _input_timeout = timeout; }
+
+private:
+	static constexpr int MAX_INPUTS = 2;
+
+	uORB::Subscription *_inputs[MAX_INPUTS] {};
+	uint8_t _num_inputs{0};
+	hrt_abstime _input_timeout{0};
+	hrt_abstime _input_timeout_deadline{0};
+
+	Report::CheckOutput _output{}; ///< recorded at the last run, replayed while the check is skipped
+
+	friend class HealthAndArmingChecks;
 };
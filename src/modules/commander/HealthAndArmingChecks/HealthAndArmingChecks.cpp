@@ -48,21 +48,34 @@ HealthAndArmingChecks::HealthAndArmingChecks(ModuleParams *parent, vehicle_statu
 	_failsafe_flags.auto_mission_missing = true;
 	_failsafe_flags.offboard_control_signal_lost = true;
 	_failsafe_flags.home_position_invalid = true;
+
+	for (unsigned i = 0; i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
+		if (!_checks[i].check) {
+			break;
+		}
+
+		_check_perf[i] = perf_alloc(PC_ELAPSED, _checks[i].name);
+	}
+}
+
+HealthAndArmingChecks::~HealthAndArmingChecks()
+{
+	for (unsigned i = 0; i < sizeof(_check_perf) / sizeof(_check_perf[0]); ++i) {
+		perf_free(_check_perf[i]);
+	}
 }
 
 bool HealthAndArmingChecks::update(bool force_reporting)
 {
+	// all checks depend on the vehicle status
+	const bool run_all = statusChanged() || _run_all_checks;
+	_run_all_checks = false;
+
 	_reporter.reset();
 
 	_reporter.prepare(_context.status().vehicle_type);
 
-	for (unsigned i = 0; i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
-		if (!_checks[i]) {
-			break;
-		}
-
-		_checks[i]->checkAndReport(_context, _reporter);
-	}
+	runChecks(run_all);
 
 	const bool results_changed = _reporter.finalize();
 	const bool reported = _reporter.report(_context.isArmed(), force_reporting);
@@ -78,13 +91,7 @@ bool HealthAndArmingChecks::update(bool force_reporting)
 
 		_reporter.prepare(_context.status().vehicle_type);
 
-		for (unsigned i = 0; i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
-			if (!_checks[i]) {
-				break;
-			}
-
-			_checks[i]->checkAndReport(_context, _reporter);
-		}
+		runChecks(true);
 
 		_reporter.finalize();
 		_reporter.report(_context.isArmed(), false);
@@ -108,13 +115,68 @@ bool HealthAndArmingChecks::update(bool force_reporting)
 	return reported;
 }
 
+void HealthAndArmingChecks::runChecks(bool run_all)
+{
+	const hrt_abstime now = hrt_absolute_time();
+
+	for (unsigned i = 0; i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
+		HealthAndArmingCheckBase *check = _checks[i].check;
+
+		if (!check) {
+			break;
+		}
+
+		if (!check->skippable()) {
+			perf_begin(_check_perf[i]);
+			check->checkAndReport(_context, _reporter);
+			perf_end(_check_perf[i]);
+
+		} else if (check->needsToRun(now, run_all)) {
+			perf_begin(_check_perf[i]);
+			_reporter.beginCheck();
+			check->checkAndReport(_context, _reporter);
+			_reporter.endCheck(check->_output);
+			perf_end(_check_perf[i]);
+
+		} else {
+			_reporter.replayCheck(check->_output);
+		}
+	}
+}
+
+bool HealthAndArmingChecks::statusChanged()
+{
+	// the timestamp changes with every publication, compare everything else
+	static_assert(offsetof(vehicle_status_s, timestamp) == 0, "timestamp expected first");
+	const vehicle_status_s &status = _context.status();
+	const size_t offset = sizeof(status.timestamp);
+
+	if (memcmp((const uint8_t *)&status + offset, (const uint8_t *)&_last_status + offset, sizeof(status) - offset) != 0) {
+		memcpy(&_last_status, &status, sizeof(status));
+		return true;
+	}
+
+	return false;
+}
+
+void HealthAndArmingChecks::printStatus() const
+{
+	for (unsigned i = 0; i < sizeof(_check_perf) / sizeof(_check_perf[0]); ++i) {
+		if (_check_perf[i]) {
+			perf_print_counter(_check_perf[i]);
+		}
+	}
+}
+
 void HealthAndArmingChecks::updateParams()
 {
 	for (unsigned i = 0; i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
-		if (!_checks[i]) {
+		if (!_checks[i].check) {
 			break;
 		}
 
-		_checks[i]->updateParams();
+		_checks[i].check->updateParams();
 	}
+
+	_run_all_checks = true;
 }
@@ -35,6 +35,7 @@
 
 #include "Common.hpp"
 
+#include <lib/perf/perf_counter.h>
 #include <px4_platform_common/module_params.h>
 #include <uORB/Publication.hpp>
 #include <uORB/topics/health_report.h>
@@ -76,7 +77,7 @@ class HealthAndArmingChecks : public ModuleParams
 {
 public:
 	HealthAndArmingChecks(ModuleParams *parent, vehicle_status_s &status);
-	~HealthAndArmingChecks() = default;
+	~HealthAndArmingChecks();
 
 	/**
 	 * Run arming checks and report if necessary.
@@ -103,6 +104,11 @@ public:
 
 	const failsafe_flags_s &failsafeFlags() const { return _failsafe_flags; }
 
+	/**
+	 * Print the execution time of each check
+	 */
+	void printStatus() const;
+
 #ifndef CONSTRAINED_FLASH
 	ExternalChecks &externalChecks() { return _external_checks; }
 #endif
@@ -110,12 +116,23 @@ public:
 protected:
 	void updateParams() override;
 private:
+	/**
+	 * Run all checks, skippable checks (with declared inputs) are only run if needed
+	 * @param run_all run all checks regardless of their inputs
+	 */
+	void runChecks(bool run_all);
+
+	bool statusChanged();
+
 	failsafe_flags_s _failsafe_flags{};
 
 	Context _context;
 	Report _reporter{_failsafe_flags};
 	orb_advert_t _mavlink_log_pub{nullptr};
 
+	vehicle_status_s _last_status{}; ///< the vehicle status the checks were last run with
+	bool _run_all_checks{true}; ///< force all checks to run, e.g. after a parameter change
+
 	uORB::Publication<health_report_s> _health_report_pub{ORB_ID(health_report)};
 	uORB::Publication<failsafe_flags_s> _failsafe_flags_pub{ORB_ID(failsafe_flags)};
 
@@ -154,40 +171,47 @@ private:
 	ExternalChecks _external_checks;
 #endif
 
-	HealthAndArmingCheckBase *_checks[40] = {
+	struct CheckEntry {
+		HealthAndArmingCheckBase *check;
+		const char *name; ///< perf counter name
+	};
+
+	CheckEntry _checks[40] = {
 #ifndef CONSTRAINED_FLASH
-		&_external_checks,
+		{&_external_checks, "check: external"},
 #endif
-		&_accelerometer_checks,
-		&_airspeed_checks,
-		&_arm_permission_checks,
-		&_baro_checks,
-		&_cpu_resource_checks,
-		&_distance_sensor_checks,
-		&_esc_checks,
-		&_estimator_checks,
-		&_failure_detector_checks,
-		&_gyro_checks,
-		&_imu_consistency_checks,
-		&_logger_checks,
-		&_magnetometer_checks,
-		&_manual_control_checks,
-		&_home_position_checks,
-		&_mission_checks,
-		&_offboard_checks, // must be after _estimator_checks
-		&_mode_checks, // must be after _estimator_checks, _home_position_checks, _mission_checks, _offboard_checks, _external_checks
-		&_open_drone_id_checks,
-		&_parachute_checks,
-		&_power_checks,
-		&_rc_calibration_checks,
-		&_sd_card_checks,
-		&_system_checks, // must be after _estimator_checks & _home_position_checks
-		&_battery_checks,
-		&_wind_checks,
-		&_geofence_checks, // must be after _home_position_checks
-		&_flight_time_checks,
-		&_rc_and_data_link_checks,
-		&_vtol_checks,
+		{&_accelerometer_checks, "check: accelerometer"},
+		{&_airspeed_checks, "check: airspeed"},
+		{&_arm_permission_checks, "check: arm_permission"},
+		{&_baro_checks, "check: baro"},
+		{&_cpu_resource_checks, "check: cpu_resource"},
+		{&_distance_sensor_checks, "check: distance_sensor"},
+		{&_esc_checks, "check: esc"},
+		{&_estimator_checks, "check: estimator"},
+		{&_failure_detector_checks, "check: failure_detector"},
+		{&_gyro_checks, "check: gyro"},
+		{&_imu_consistency_checks, "check: imu_consistency"},
+		{&_logger_checks, "check: logger"},
+		{&_magnetometer_checks, "check: magnetometer"},
+		{&_manual_control_checks, "check: manual_control"},
+		{&_home_position_checks, "check: home_position"},
+		{&_mission_checks, "check: mission"},
+		{&_offboard_checks, "check: offboard"}, // must be after _estimator_checks
+		{&_mode_checks, "check: mode"}, // must be after _estimator_checks, _home_position_checks, _mission_checks, _offboard_checks, _external_checks
+		{&_open_drone_id_checks, "check: open_drone_id"},
+		{&_parachute_checks, "check: parachute"},
+		{&_power_checks, "check: power"},
+		{&_rc_calibration_checks, "check: rc_calibration"},
+		{&_sd_card_checks, "check: sd_card"},
+		{&_system_checks, "check: system"}, // must be after _estimator_checks & _home_position_checks
+		{&_battery_checks, "check: battery"},
+		{&_wind_checks, "check: wind"},
+		{&_geofence_checks, "check: geofence"}, // must be after _home_position_checks
+		{&_flight_time_checks, "check: flight_time"},
+		{&_rc_and_data_link_checks, "check: rc_and_data_link"},
+		{&_vtol_checks, "check: vtol"},
 	};
+
+	perf_counter_t _check_perf[40] {};
 };
 
@@ -286,3 +286,68 @@ TEST_F(ReporterTest, reporting_multiple)
 	}
 }
 
+TEST_F(ReporterTest, check_replay)
+{
+	failsafe_flags_s failsafe_flags{};
+	Report reporter{failsafe_flags, 0_s};
+	Report::CheckOutput output{};
+
+	uORB::Subscription event_sub{ORB_ID(event)};
+	event_sub.subscribe();
+	event_s event;
+
+	while (event_sub.update(&event)) {}
+
+	// record the output of a check
+	reporter.reset();
+	reporter.setIsPresent(health_component_t::battery);
+	reporter.beginCheck();
+	reporter.armingCheckFailure(NavModes::PositionControl, health_component_t::remote_control,
+				    events::ID("arming_test_check_replay_fail1"), events::Log::Warning, "");
+	reporter.setIsPresent(health_component_t::remote_control);
+	reporter.endCheck(output);
+	reporter.finalize();
+	reporter.report(false, false);
+
+	ASSERT_TRUE(output.valid);
+	ASSERT_EQ(output.num_events, 1);
+	ASSERT_EQ(output.health.is_present, events::px4::enums::health_component_t::remote_control);
+	ASSERT_EQ(output.arming_warning, events::px4::enums::health_component_t::remote_control);
+	ASSERT_EQ(output.cleared_can_arm, NavModes::PositionControl);
+
+	const Report::HealthResults recorded_health_results = reporter.healthResults();
+	const Report::ArmingCheckResults recorded_arming_check_results = reporter.armingCheckResults();
+
+	while (event_sub.update(&event)) {}
+
+	// replaying gives the same results, nothing is reported again
+	for (int i = 0; i < 3; ++i) {
+		reporter.reset();
+		reporter.setIsPresent(health_component_t::battery);
+		reporter.replayCheck(output);
+		ASSERT_FALSE(reporter.finalize());
+		reporter.report(false, false);
+
+		ASSERT_FALSE(event_sub.updated());
+		ASSERT_FALSE(reporter.canArm(vehicle_status_s::NAVIGATION_STATE_POSCTL));
+		ASSERT_TRUE(reporter.canArm(vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION));
+		Report::HealthResults health_results = reporter.healthResults();
+		Report::ArmingCheckResults arming_check_results = reporter.armingCheckResults();
+		ASSERT_FALSE(health_results != recorded_health_results);
+		ASSERT_FALSE(arming_check_results != recorded_arming_check_results);
+	}
+
+	// the replayed events are reported when forced
+	reporter.reset();
+	reporter.replayCheck(output);
+	reporter.finalize();
+	ASSERT_TRUE(reporter.report(false, true));
+
+	ASSERT_TRUE(event_sub.update(&event));
+	ASSERT_EQ(event.id, events::ID("commander_arming_check_summary"));
+	ASSERT_TRUE(event_sub.update(&event));
+	ASSERT_EQ(event.id, events::ID("arming_test_check_replay_fail1"));
+	ASSERT_TRUE(event_sub.update(&event));
+	ASSERT_EQ(event.id, events::ID("commander_health_summary"));
+}
+
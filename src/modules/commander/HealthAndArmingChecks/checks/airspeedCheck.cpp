@@ -39,6 +39,8 @@ using namespace time_literals;
 AirspeedChecks::AirspeedChecks()
 	: _param_fw_airspd_max_handle(param_find("FW_AIRSPD_MAX"))
 {
+	addInput(_airspeed_validated_sub);
+	setInputTimeout(DATA_TIMEOUT);
 }
 
 void AirspeedChecks::checkAndReport(const Context &context, Report &reporter)
@@ -50,7 +52,7 @@ void AirspeedChecks::checkAndReport(const Context &context, Report &reporter)
 
 	airspeed_validated_s airspeed_validated;
 
-	if (_airspeed_validated_sub.copy(&airspeed_validated) && hrt_elapsed_time(&airspeed_validated.timestamp) < 2_s) {
+	if (_airspeed_validated_sub.copy(&airspeed_validated) && hrt_elapsed_time(&airspeed_validated.timestamp) < DATA_TIMEOUT) {
 
 		reporter.setIsPresent(health_component_t::differential_pressure);
 
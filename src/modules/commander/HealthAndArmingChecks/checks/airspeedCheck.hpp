@@ -47,6 +47,8 @@ public:
 	void checkAndReport(const Context &context, Report &reporter) override;
 
 private:
+	static constexpr hrt_abstime DATA_TIMEOUT = 2_s;
+
 	uORB::Subscription _airspeed_validated_sub{ORB_ID(airspeed_validated)};
 
 	const param_t _param_fw_airspd_max_handle;
@@ -88,5 +88,25 @@ void CpuResourceChecks::checkAndReport(const Context &context, Report &reporter)
 				mavlink_log_critical(reporter.mavlink_log_pub(), "Preflight Fail: CPU load too high: %3.1f%%", (double)cpuload_percent);
 			}
 		}
+
+		if (cpuload.stack_low) {
+			/* EVENT
+			 * @description
+			 * A task or work queue is close to a stack overflow (stack high-water mark). Its stack size needs to be increased.
+			 *
+			 * <profile name="dev">
+			 * The task is shown by 'top' and logged in the cpuload topic. Tools/stack_usage/stack_size_report.py
+			 * recommends work queue stack sizes from logged data.
+			 * </profile>
+			 */
+			reporter.healthFailure<uint16_t>(NavModes::All, health_component_t::system, events::ID("check_stack_low"),
+							 events::Log::Error, "Task low on stack: {1} bytes left", cpuload.stack_free_min);
+
+			if (reporter.mavlink_log_pub()) {
+				cpuload.stack_free_min_task[sizeof(cpuload.stack_free_min_task) - 1] = '\0';
+				mavlink_log_critical(reporter.mavlink_log_pub(), "Preflight Fail: %s low on stack (%u bytes left)",
+						     cpuload.stack_free_min_task, cpuload.stack_free_min);
+			}
+		}
 	}
 }
@@ -41,7 +41,7 @@
 class HomePositionChecks : public HealthAndArmingCheckBase
 {
 public:
-	HomePositionChecks() = default;
+	HomePositionChecks() { addInput(_home_position_sub); }
 	~HomePositionChecks() = default;
 
 	void checkAndReport(const Context &context, Report &reporter) override;
@@ -39,6 +39,9 @@ LoggerChecks::LoggerChecks()
 	: _param_sdlog_mode_handle(param_find("SDLOG_MODE"))
 {
 	param_get(_param_sdlog_mode_handle, &_sdlog_mode);
+
+	addInput(_logger_status_sub);
+	setInputTimeout(DATA_TIMEOUT);
 }
 
 void LoggerChecks::checkAndReport(const Context &context, Report &reporter)
@@ -50,7 +53,7 @@ void LoggerChecks::checkAndReport(const Context &context, Report &reporter)
 			logger_status_s status;
 			_logger_status_sub.copy(&status);
 
-			if (hrt_elapsed_time(&status.timestamp) < 3_s && status.is_logging) {
+			if (hrt_elapsed_time(&status.timestamp) < DATA_TIMEOUT && status.is_logging) {
 				active = true;
 			}
 		}
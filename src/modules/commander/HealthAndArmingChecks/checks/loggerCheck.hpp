@@ -48,6 +48,8 @@ public:
 	void checkAndReport(const Context &context, Report &reporter) override;
 
 private:
+	static constexpr hrt_abstime DATA_TIMEOUT = 3_s;
+
 	uORB::Subscription _logger_status_sub{ORB_ID::logger_status};
 	const param_t _param_sdlog_mode_handle;
 	int32_t _sdlog_mode = -1;
@@ -41,7 +41,7 @@
 class MissionChecks : public HealthAndArmingCheckBase
 {
 public:
-	MissionChecks() = default;
+	MissionChecks() { addInput(_mission_result_sub); }
 	~MissionChecks() = default;
 
 	void checkAndReport(const Context &context, Report &reporter) override;
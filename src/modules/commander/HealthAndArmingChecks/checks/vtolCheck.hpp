@@ -41,7 +41,7 @@
 class VtolChecks : public HealthAndArmingCheckBase
 {
 public:
-	VtolChecks() = default;
+	VtolChecks() { addInput(_vtol_vehicle_status_sub); }
 	~VtolChecks() = default;
 
 	void checkAndReport(const Context &context, Report &reporter) override;
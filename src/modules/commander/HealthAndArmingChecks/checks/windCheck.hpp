@@ -41,7 +41,7 @@
 class WindChecks : public HealthAndArmingCheckBase
 {
 public:
-	WindChecks() = default;
+	WindChecks() { addInput(_wind_sub); }
 	~WindChecks() = default;
 
 	void checkAndReport(const Context &context, Report &reporter) override;
@@ -545,6 +545,14 @@ void Failsafe::checkStateAndMode(const hrt_abstime &time_us, const State &state,
 				    ActionOptions(mode_fallback_action).allowUserTakeover(UserTakeoverAllowed::Always).cannotBeDeferred());
 }
 
+bool Failsafe::conditionsTimeDependent(const hrt_abstime &time_us, const State &state) const
+{
+	// the checks right after arming depend on the time since arming (spoolup and takeoff lockdown)
+	return (_armed_time != 0)
+	       && (time_us < _armed_time
+		   + static_cast<hrt_abstime>((_param_com_lkdown_tko.get() + _param_com_spoolup_time.get()) * 1_s));
+}
+
 void Failsafe::updateArmingState(const hrt_abstime &time_us, bool armed, const failsafe_flags_s &status_flags)
 {
 	if (!_was_armed && armed) {
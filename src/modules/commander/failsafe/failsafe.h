@@ -50,6 +50,8 @@ protected:
 	uint8_t modifyUserIntendedMode(Action previous_action, Action current_action,
 				       uint8_t user_intended_mode) const override;
 
+	bool conditionsTimeDependent(const hrt_abstime &time_us, const State &state) const override;
+
 private:
 	void updateArmingState(const hrt_abstime &time_us, bool armed, const failsafe_flags_s &status_flags);
 
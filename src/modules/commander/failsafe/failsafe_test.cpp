@@ -369,3 +369,72 @@ TEST_F(FailsafeTest, defer)
 	ASSERT_EQ(failsafe.selectedAction(), FailsafeBase::Action::Terminate);
 	ASSERT_FALSE(failsafe.failsafeDeferred());
 }
+
+TEST_F(FailsafeTest, skip_unchanged)
+{
+	FailsafeTester failsafe(nullptr);
+
+	failsafe_flags_s failsafe_flags{};
+	FailsafeBase::State state{};
+	state.armed = true;
+	state.user_intended_mode = vehicle_status_s::NAVIGATION_STATE_POSCTL;
+	state.vehicle_type = vehicle_status_s::VEHICLE_TYPE_ROTARY_WING;
+	hrt_abstime time = 5_s;
+
+	// Unchanged inputs: evaluated until settled, then skipped
+	for (int i = 0; i < 10; ++i) {
+		time += 10_ms;
+		failsafe_flags.timestamp = time;
+		failsafe.update(time, state, false, false, failsafe_flags);
+	}
+
+	ASSERT_EQ(failsafe.numEvaluations(), 2u);
+	ASSERT_EQ(failsafe.selectedAction(), FailsafeBase::Action::None);
+
+	// RC lost -> Hold, the delay is time dependent, so every update is evaluated
+	time += 10_ms;
+	failsafe_flags.manual_control_signal_lost = true;
+	failsafe.update(time, state, false, false, failsafe_flags);
+	ASSERT_EQ(failsafe.numEvaluations(), 3u);
+	ASSERT_EQ(failsafe.selectedAction(), FailsafeBase::Action::Hold);
+	time += 1_s;
+	failsafe.update(time, state, false, false, failsafe_flags);
+	ASSERT_EQ(failsafe.numEvaluations(), 4u);
+	time += 5_s;
+	failsafe.update(time, state, false, false, failsafe_flags);
+	ASSERT_EQ(failsafe.numEvaluations(), 5u);
+	ASSERT_EQ(failsafe.selectedAction(), FailsafeBase::Action::RTL);
+
+	// Once the start delay recovered, the state is settled again
+	for (int i = 0; i < 30; ++i) {
+		time += 1_s;
+		failsafe.update(time, state, false, false, failsafe_flags);
+	}
+
+	const uint32_t num_evaluations = failsafe.numEvaluations();
+
+	for (int i = 0; i < 10; ++i) {
+		time += 10_ms;
+		failsafe.update(time, state, false, false, failsafe_flags);
+	}
+
+	ASSERT_EQ(failsafe.numEvaluations(), num_evaluations);
+	ASSERT_EQ(failsafe.selectedAction(), FailsafeBase::Action::RTL);
+
+	// Stick movement is an input change -> user takeover
+	time += 10_ms;
+	failsafe.update(time, state, false, true, failsafe_flags);
+	ASSERT_EQ(failsafe.numEvaluations(), num_evaluations + 1);
+	ASSERT_TRUE(failsafe.userTakeoverActive());
+
+	// RC regained and mode change -> clear failsafe
+	time += 10_ms;
+	failsafe_flags.manual_control_signal_lost = false;
+	failsafe.update(time, state, false, false, failsafe_flags);
+	ASSERT_EQ(failsafe.numEvaluations(), num_evaluations + 2);
+	time += 10_ms;
+	state.user_intended_mode = vehicle_status_s::NAVIGATION_STATE_ALTCTL;
+	failsafe.update(time, state, false, false, failsafe_flags);
+	ASSERT_EQ(failsafe.numEvaluations(), num_evaluations + 3);
+	ASSERT_EQ(failsafe.selectedAction(), FailsafeBase::Action::None);
+}
@@ -40,6 +40,8 @@
 #include <px4_platform_common/log.h>
 #include <systemlib/mavlink_log.h>
 
+#include <cstring>
+
 using failsafe_action_t = events::px4::enums::failsafe_action_t;
 using failsafe_cause_t = events::px4::enums::failsafe_cause_t;
 
@@ -58,6 +60,18 @@ uint8_t FailsafeBase::update(const hrt_abstime &time_us, const State &state, boo
 		_last_update = time_us;
 	}
 
+	const bool inputs_unchanged = inputsUnchanged(state, user_intended_mode_updated, rc_sticks_takeover_request,
+				      status_flags);
+
+	if (inputs_unchanged && _settled && !timeDependent(time_us, state)) {
+		// The previous evaluation with the same inputs did not change anything, so running it again would not either
+		_last_update = time_us;
+		return _last_user_intended_mode;
+	}
+
+	const EvaluationResult previous_result = evaluationResult();
+	++_num_evaluations;
+
 	if ((_last_armed && !state.armed) || (!_last_armed && state.armed)) { // Disarming or Arming
 		removeActions(ClearCondition::OnDisarm);
 		removeActions(ClearCondition::OnModeChangeOrDisarm);
@@ -103,9 +117,84 @@ uint8_t FailsafeBase::update(const hrt_abstime &time_us, const State &state, boo
 	_last_update = time_us;
 	_last_status_flags = status_flags;
 	_last_armed = state.armed;
+	_last_state = state;
+	_config_changed = false;
+	_settled = inputs_unchanged && !timeDependent(time_us, state) && (evaluationResult() == previous_result);
 	return _last_user_intended_mode;
 }
 
+bool FailsafeBase::inputsUnchanged(const State &state, bool user_intended_mode_updated, bool rc_sticks_takeover_request,
+				   const failsafe_flags_s &status_flags) const
+{
+	if (_config_changed || user_intended_mode_updated || rc_sticks_takeover_request) {
+		return false;
+	}
+
+	if (state.armed != _last_state.armed
+	    || state.user_intended_mode != _last_state.user_intended_mode
+	    || state.user_intended_mode != _last_user_intended_mode
+	    || state.vehicle_type != _last_state.vehicle_type
+	    || state.vtol_in_transition_mode != _last_state.vtol_in_transition_mode
+	    || state.mission_finished != _last_state.mission_finished) {
+		return false;
+	}
+
+	// the timestamp is the only field that changes on every update
+	failsafe_flags_s flags = status_flags;
+	flags.timestamp = _last_status_flags.timestamp;
+	return memcmp(&flags, &_last_status_flags, sizeof(flags)) == 0;
+}
+
+bool FailsafeBase::timeDependent(const hrt_abstime &time_us, const State &state) const
+{
+	// Hold delay count down, deferred failsafes (timeout) and the start delay recovering after a delayed action
+	const hrt_abstime configured_delay = _param_com_fail_act_t.get() * 1_s;
+
+	return _current_delay > 0 || _failsafe_defer_started != 0 || _current_start_delay < configured_delay
+	       || conditionsTimeDependent(time_us, state);
+}
+
+FailsafeBase::EvaluationResult FailsafeBase::evaluationResult() const
+{
+	EvaluationResult result{};
+
+	for (int action_idx = 0; action_idx < max_num_actions; ++action_idx) {
+		result.actions[action_idx].id = _actions[action_idx].id;
+		result.actions[action_idx].action = _actions[action_idx].action;
+		result.actions[action_idx].clear_condition = _actions[action_idx].clear_condition;
+		result.actions[action_idx].allow_user_takeover = _actions[action_idx].allow_user_takeover;
+		result.actions[action_idx].state_failure = _actions[action_idx].state_failure;
+	}
+
+	result.selected_action = _selected_action;
+	result.user_intended_mode = _last_user_intended_mode;
+	result.user_takeover_active = _user_takeover_active;
+	result.current_delay = _current_delay;
+	result.current_start_delay = _current_start_delay;
+	result.failsafe_defer_started = _failsafe_defer_started;
+	return result;
+}
+
+bool FailsafeBase::EvaluationResult::operator==(const EvaluationResult &other) const
+{
+	for (int action_idx = 0; action_idx < max_num_actions; ++action_idx) {
+		if (actions[action_idx].id != other.actions[action_idx].id
+		    || actions[action_idx].action != other.actions[action_idx].action
+		    || actions[action_idx].clear_condition != other.actions[action_idx].clear_condition
+		    || actions[action_idx].allow_user_takeover != other.actions[action_idx].allow_user_takeover
+		    || actions[action_idx].state_failure != other.actions[action_idx].state_failure) {
+			return false;
+		}
+	}
+
+	return selected_action == other.selected_action
+	       && user_intended_mode == other.user_intended_mode
+	       && user_takeover_active == other.user_takeover_active
+	       && current_delay == other.current_delay
+	       && current_start_delay == other.current_start_delay
+	       && failsafe_defer_started == other.failsafe_defer_started;
+}
+
 void FailsafeBase::updateFailsafeDeferState(const hrt_abstime &time_us, bool defer)
 {
 	if (defer) {
@@ -144,6 +233,7 @@ void FailsafeBase::updateParams()
 {
 	ModuleParams::updateParams();
 	_current_start_delay = _param_com_fail_act_t.get() * 1_s;
+	_config_changed = true;
 }
 
 void FailsafeBase::updateDelay(const hrt_abstime &elapsed_us)
@@ -696,5 +786,6 @@ bool FailsafeBase::deferFailsafes(bool enabled, int timeout_s)
 	}
 
 	_defer_failsafes = enabled;
+	_config_changed = true;
 	return true;
 }
@@ -165,6 +165,12 @@ public:
 	bool getDeferFailsafes() const { return _defer_failsafes; }
 	bool failsafeDeferred() const { return _failsafe_defer_started != 0; }
 
+	/**
+	 * Number of times the conditions and actions got evaluated. update() skips the evaluation while none of
+	 * its inputs changed and the previous evaluation did not change the state machine either.
+	 */
+	uint32_t numEvaluations() const { return _num_evaluations; }
+
 protected:
 	enum class UserTakeoverAllowed {
 		Always, ///< allow takeover (immediately)
@@ -207,6 +213,12 @@ protected:
 				       const failsafe_flags_s &status_flags) = 0;
 	virtual Action checkModeFallback(const failsafe_flags_s &status_flags, uint8_t user_intended_mode) const = 0;
 
+	/**
+	 * @return true if checkStateAndMode() currently depends on time_us, i.e. it needs to be evaluated
+	 * even if none of the inputs changed
+	 */
+	virtual bool conditionsTimeDependent(const hrt_abstime &time_us, const State &state) const { return false; }
+
 	const failsafe_flags_s &lastStatusFlags() const { return _last_status_flags; }
 
 	bool checkFailsafe(int caller_id, bool last_state_failure, bool cur_state_failure, const ActionOptions &options);
@@ -234,6 +246,8 @@ protected:
 	void updateParams() override;
 
 private:
+	static constexpr int max_num_actions{8};
+
 	/**
 	 * Remove actions matching a condition
 	 */
@@ -255,13 +269,41 @@ private:
 
 	void updateFailsafeDeferState(const hrt_abstime &time_us, bool defer);
 
-	static constexpr int max_num_actions{8};
+	bool inputsUnchanged(const State &state, bool user_intended_mode_updated, bool rc_sticks_takeover_request,
+			     const failsafe_flags_s &status_flags) const;
+	bool timeDependent(const hrt_abstime &time_us, const State &state) const;
+
+	struct EvaluationResult {
+		bool operator==(const EvaluationResult &other) const;
+
+		struct {
+			int id;
+			Action action;
+			ClearCondition clear_condition;
+			UserTakeoverAllowed allow_user_takeover;
+			bool state_failure;
+		} actions[max_num_actions];
+
+		Action selected_action;
+		uint8_t user_intended_mode;
+		bool user_takeover_active;
+		hrt_abstime current_delay;
+		hrt_abstime current_start_delay;
+		hrt_abstime failsafe_defer_started;
+	};
+
+	EvaluationResult evaluationResult() const;
+
 	ActionOptions _actions[max_num_actions]; ///< currently active actions
 
 	hrt_abstime _last_update{};
 	bool _last_armed{false};
 	uint8_t _last_user_intended_mode{0};
 	failsafe_flags_s _last_status_flags{};
+	State _last_state{};
+	bool _settled{false}; ///< true if the last evaluation did not change anything for unchanged inputs
+	bool _config_changed{true}; ///< parameters or defer state got updated since the last evaluation
+	uint32_t _num_evaluations{0};
 	Action _selected_action{Action::None};
 	bool _user_takeover_active{false};
 	bool _notification_required{false};
@@ -203,6 +203,8 @@ bool FailureDetector::update(const vehicle_status_s &vehicle_status, const vehic
 		updateImbalancedPropStatus();
 	}
 
+	updateHighRateStatus(vehicle_status);
+
 	return _status.value != status_prev.value;
 }
 
@@ -472,3 +474,32 @@ void FailureDetector::updateMotorStatus(const vehicle_status_s &vehicle_status,
 		_status.flags.motor = false;
 	}
 }
+
+void FailureDetector::updateHighRateStatus(const vehicle_status_s &vehicle_status)
+{
+	const uint16_t high_rate_mask_prev = _motor_failure_high_rate_mask;
+
+	if (_param_fd_hr_en.get() && !_high_rate_detector.running()) {
+		_high_rate_detector.start();
+
+	} else if (!_param_fd_hr_en.get() && _high_rate_detector.running()) {
+		_high_rate_detector.stop();
+		_motor_failure_high_rate_mask = 0;
+	}
+
+	failure_detector_high_rate_s failure_detector_high_rate;
+
+	if (_failure_detector_high_rate_sub.update(&failure_detector_high_rate)) {
+		_motor_failure_high_rate_mask = failure_detector_high_rate.fd_motor ? failure_detector_high_rate.motor_failure_mask : 0;
+	}
+
+	// the high-rate stage latches confirmed motor failures until disarm
+	if (_motor_failure_high_rate_mask != 0) {
+		_status.flags.motor = true;
+
+	} else if (high_rate_mask_prev != 0) {
+		// fall back to the result of the commander rate motor check
+		_status.flags.motor = (vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED)
+				      && ((_motor_failure_esc_timed_out_mask | _motor_failure_esc_under_current_mask) != 0);
+	}
+}
@@ -62,8 +62,11 @@
 #include <uORB/topics/vehicle_imu_status.h>
 #include <uORB/topics/vehicle_status.h>
 #include <uORB/topics/esc_status.h>
+#include <uORB/topics/failure_detector_high_rate.h>
 #include <uORB/topics/pwm_input.h>
 
+#include "FailureDetectorHighRate.hpp"
+
 union failure_detector_status_u {
 	struct {
 		uint16_t roll : 1;
@@ -104,7 +107,7 @@ public:
 	const failure_detector_status_u &getStatus() const { return _status; }
 	const decltype(failure_detector_status_u::flags) &getStatusFlags() const { return _status.flags; }
 	float getImbalancedPropMetric() const { return _imbalanced_prop_lpf.getState(); }
-	uint16_t getMotorFailures() const { return _motor_failure_esc_timed_out_mask | _motor_failure_esc_under_current_mask; }
+	uint16_t getMotorFailures() const { return _motor_failure_esc_timed_out_mask | _motor_failure_esc_under_current_mask | _motor_failure_high_rate_mask; }
 
 private:
 	void updateAttitudeStatus(const vehicle_status_s &vehicle_status);
@@ -112,6 +115,7 @@ private:
 	void updateEscsStatus(const vehicle_status_s &vehicle_status, const esc_status_s &esc_status);
 	void updateMotorStatus(const vehicle_status_s &vehicle_status, const esc_status_s &esc_status);
 	void updateImbalancedPropStatus();
+	void updateHighRateStatus(const vehicle_status_s &vehicle_status);
 
 	failure_detector_status_u _status{};
 
@@ -131,6 +135,9 @@ private:
 	uint8_t _motor_failure_esc_under_current_mask{};  // ESC drawing too little current -> failure
 	bool _motor_failure_escs_have_current{false}; // true if some ESC had non-zero current (some don't support it)
 	hrt_abstime _motor_failure_undercurrent_start_time[actuator_motors_s::NUM_CONTROLS] {};
+	uint16_t _motor_failure_high_rate_mask{};         // confirmed by the high-rate stage
+
+	FailureDetectorHighRate _high_rate_detector;
 
 	uORB::Subscription _vehicle_attitude_sub{ORB_ID(vehicle_attitude)};
 	uORB::Subscription _esc_status_sub{ORB_ID(esc_status)}; // TODO: multi-instance
@@ -138,6 +145,7 @@ private:
 	uORB::Subscription _sensor_selection_sub{ORB_ID(sensor_selection)};
 	uORB::Subscription _vehicle_imu_status_sub{ORB_ID(vehicle_imu_status)};
 	uORB::Subscription _actuator_motors_sub{ORB_ID(actuator_motors)};
+	uORB::Subscription _failure_detector_high_rate_sub{ORB_ID(failure_detector_high_rate)};
 
 	FailureInjector _failure_injector;
 
@@ -155,6 +163,9 @@ private:
 		(ParamBool<px4::params::FD_ACT_EN>) _param_fd_actuator_en,
 		(ParamFloat<px4::params::FD_ACT_MOT_THR>) _param_fd_motor_throttle_thres,
 		(ParamFloat<px4::params::FD_ACT_MOT_C2T>) _param_fd_motor_current2throttle_thres,
-		(ParamInt<px4::params::FD_ACT_MOT_TOUT>) _param_fd_motor_time_thres
+		(ParamInt<px4::params::FD_ACT_MOT_TOUT>) _param_fd_motor_time_thres,
+
+		// High-rate stage
+		(ParamBool<px4::params::FD_HR_EN>) _param_fd_hr_en
 	)
 };
@@ -0,0 +1,259 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+* @file FailureDetectorHighRate.cpp
+*/
+
+#include "FailureDetectorHighRate.hpp"
+
+using namespace time_literals;
+
+FailureDetectorHighRate::FailureDetectorHighRate() :
+	ModuleParams(nullptr),
+	WorkItem("failure_detector_high_rate", px4::wq_configurations::rate_ctrl)
+{
+}
+
+FailureDetectorHighRate::~FailureDetectorHighRate()
+{
+	stop();
+	perf_free(_cycle_perf);
+}
+
+bool FailureDetectorHighRate::start()
+{
+	reset();
+	updateParams();
+
+	if (!_vehicle_angular_velocity_sub.registerCallback()) {
+		PX4_ERR("failure_detector_high_rate callback registration failed");
+		return false;
+	}
+
+	return true;
+}
+
+void FailureDetectorHighRate::stop()
+{
+	_vehicle_angular_velocity_sub.unregisterCallback();
+}
+
+void FailureDetectorHighRate::reset()
+{
+	for (auto &rate_error : _rate_error) {
+		rate_error.reset();
+	}
+
+	for (int i = 0; i < esc_status_s::CONNECTED_ESC_MAX; i++) {
+		_esc_current[i].reset();
+		_esc_throttle[i].reset();
+		_esc_timestamp[i] = 0;
+	}
+
+	_esc_valid_current_mask = 0;
+	_esc_timed_out_mask = 0;
+	_esc_under_current_mask = 0;
+	_motor_failure_mask = 0;
+	_escs_have_current = false;
+	_rate_tracking_failure = false;
+}
+
+void FailureDetectorHighRate::Run()
+{
+	perf_begin(_cycle_perf);
+
+	if (_parameter_update_sub.updated()) {
+		parameter_update_s param_update;
+		_parameter_update_sub.copy(&param_update);
+		updateParams();
+	}
+
+	vehicle_status_s vehicle_status;
+
+	if (_vehicle_status_sub.update(&vehicle_status)) {
+		const bool armed = (vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED);
+
+		if (armed != _armed) {
+			reset();
+		}
+
+		_armed = armed;
+		_rotary_wing = (vehicle_status.vehicle_type == vehicle_status_s::VEHICLE_TYPE_ROTARY_WING);
+	}
+
+	vehicle_control_mode_s vehicle_control_mode;
+
+	if (_vehicle_control_mode_sub.update(&vehicle_control_mode)) {
+		_rate_control_enabled = vehicle_control_mode.flag_control_rates_enabled;
+	}
+
+	vehicle_angular_velocity_s angular_velocity;
+
+	if (_vehicle_angular_velocity_sub.update(&angular_velocity)) {
+		if (_armed) {
+			updateRateTracking(angular_velocity);
+			updateEscs(angular_velocity.timestamp_sample);
+
+			// a motor is only reported once the vehicle also fails to track the rate setpoint,
+			// this allows for windows and timeouts much shorter than the ones of the commander stage
+			if (_rate_tracking_failure) {
+				_motor_failure_mask |= (_esc_timed_out_mask | _esc_under_current_mask);
+			}
+		}
+
+		publish(angular_velocity.timestamp_sample);
+	}
+
+	perf_end(_cycle_perf);
+}
+
+void FailureDetectorHighRate::updateRateTracking(const vehicle_angular_velocity_s &angular_velocity)
+{
+	vehicle_rates_setpoint_s vehicle_rates_setpoint;
+
+	if (_vehicle_rates_setpoint_sub.update(&vehicle_rates_setpoint)) {
+		_rates_setpoint = matrix::Vector3f(vehicle_rates_setpoint.roll, vehicle_rates_setpoint.pitch, vehicle_rates_setpoint.yaw);
+	}
+
+	if (!_rotary_wing || !_rate_control_enabled || !_rates_setpoint.isAllFinite()) {
+		for (auto &rate_error : _rate_error) {
+			rate_error.reset();
+		}
+
+		_rate_tracking_failure = false;
+		return;
+	}
+
+	const matrix::Vector3f rate_error = _rates_setpoint - matrix::Vector3f(angular_velocity.xyz);
+
+	for (int i = 0; i < 3; i++) {
+		_rate_error[i].update(rate_error(i));
+	}
+
+	// a lost motor shows up as a persistent roll and/or pitch rate error, yaw is too slow to be useful here
+	const float max_rate_error = math::radians(_param_fd_hr_rate_err.get());
+
+	_rate_tracking_failure = (max_rate_error > FLT_EPSILON) && _rate_error[0].full()
+				 && ((fabsf(_rate_error[0].mean()) > max_rate_error) || (fabsf(_rate_error[1].mean()) > max_rate_error));
+}
+
+void FailureDetectorHighRate::updateEscs(const hrt_abstime &now)
+{
+	esc_status_s esc_status;
+
+	if (_esc_status_sub.update(&esc_status)) {
+		actuator_motors_s actuator_motors{};
+		_actuator_motors_sub.copy(&actuator_motors);
+
+		const int limited_esc_count = math::min(esc_status.esc_count, esc_status_s::CONNECTED_ESC_MAX);
+
+		for (int esc_status_idx = 0; esc_status_idx < limited_esc_count; esc_status_idx++) {
+
+			const esc_report_s &esc_report = esc_status.esc[esc_status_idx];
+
+			// Map the esc status index to the actuator function index
+			const unsigned i_esc = esc_report.actuator_function - actuator_motors_s::ACTUATOR_FUNCTION_MOTOR1;
+
+			if ((i_esc >= esc_status_s::CONNECTED_ESC_MAX) || (esc_report.timestamp == _esc_timestamp[i_esc])) {
+				// not a motor or no new report for this ESC
+				continue;
+			}
+
+			_esc_timestamp[i_esc] = esc_report.timestamp;
+
+			if (esc_report.esc_current > FLT_EPSILON) {
+				_esc_valid_current_mask |= (1 << i_esc);
+				_escs_have_current = true;
+			}
+
+			float esc_throttle = 0.f;
+
+			if (PX4_ISFINITE(actuator_motors.control[i_esc])) {
+				esc_throttle = fabsf(actuator_motors.control[i_esc]);
+			}
+
+			_esc_current[i_esc].update(esc_report.esc_current);
+			_esc_throttle[i_esc].update(esc_throttle);
+
+			const bool throttle_above_threshold = _esc_throttle[i_esc].mean() > _param_fd_motor_throttle_thres.get();
+			const bool current_too_low = _esc_current[i_esc].mean() < _esc_throttle[i_esc].mean() *
+						     _param_fd_motor_current2throttle_thres.get();
+
+			if (_escs_have_current && _esc_current[i_esc].full() && throttle_above_threshold && current_too_low) {
+				_esc_under_current_mask |= (1 << i_esc);
+
+			} else {
+				_esc_under_current_mask &= ~(1 << i_esc);
+			}
+		}
+	}
+
+	// telemetry timeout of ESCs that previously reported valid data
+	const hrt_abstime timeout = _param_fd_hr_esc_tout.get() * 1_ms;
+	_esc_timed_out_mask = 0;
+
+	for (int i_esc = 0; i_esc < esc_status_s::CONNECTED_ESC_MAX; i_esc++) {
+		if ((_esc_valid_current_mask & (1 << i_esc)) && (now > _esc_timestamp[i_esc] + timeout)) {
+			_esc_timed_out_mask |= (1 << i_esc);
+		}
+	}
+}
+
+void FailureDetectorHighRate::publish(const hrt_abstime &timestamp_sample)
+{
+	const bool fd_motor = (_motor_failure_mask != 0);
+
+	// publish at 10 Hz or immediately when a flag changes
+	if ((hrt_elapsed_time(&_status.timestamp) >= 100_ms)
+	    || (_status.fd_motor != fd_motor)
+	    || (_status.motor_failure_mask != _motor_failure_mask)
+	    || (_status.fd_rate_tracking != _rate_tracking_failure)
+	    || (_status.esc_timed_out_mask != _esc_timed_out_mask)
+	    || (_status.esc_under_current_mask != _esc_under_current_mask)) {
+
+		_status.timestamp_sample = timestamp_sample;
+		_status.fd_motor = fd_motor;
+		_status.motor_failure_mask = _motor_failure_mask;
+		_status.fd_rate_tracking = _rate_tracking_failure;
+
+		for (int i = 0; i < 3; i++) {
+			_status.rate_error_mean[i] = _rate_error[i].mean();
+		}
+
+		_status.esc_timed_out_mask = _esc_timed_out_mask;
+		_status.esc_under_current_mask = _esc_under_current_mask;
+		_status.timestamp = hrt_absolute_time();
+		_failure_detector_high_rate_pub.publish(_status);
+	}
+}
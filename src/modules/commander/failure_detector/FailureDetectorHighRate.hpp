@@ -0,0 +1,125 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+* @file FailureDetectorHighRate.hpp
+* High-rate failure detection stage running on the rate controller work queue.
+*
+* Evaluates the rate tracking error on every angular velocity sample and the ESC
+* telemetry on every report with sliding window statistics, so that motor failures
+* are reported within a few control cycles instead of at commander rate.
+*/
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <lib/mathlib/math/SlidingWindow.hpp>
+#include <lib/perf/perf_counter.h>
+#include <matrix/matrix/math.hpp>
+#include <px4_platform_common/module_params.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+#include <uORB/Publication.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/actuator_motors.h>
+#include <uORB/topics/esc_status.h>
+#include <uORB/topics/failure_detector_high_rate.h>
+#include <uORB/topics/parameter_update.h>
+#include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_control_mode.h>
+#include <uORB/topics/vehicle_rates_setpoint.h>
+#include <uORB/topics/vehicle_status.h>
+
+class FailureDetectorHighRate : public ModuleParams, public px4::WorkItem
+{
+public:
+	FailureDetectorHighRate();
+	~FailureDetectorHighRate() override;
+
+	bool start();
+	void stop();
+
+	bool running() const { return _vehicle_angular_velocity_sub.registered(); }
+
+private:
+	void Run() override;
+
+	void reset();
+	void updateRateTracking(const vehicle_angular_velocity_s &angular_velocity);
+	void updateEscs(const hrt_abstime &now);
+	void publish(const hrt_abstime &timestamp_sample);
+
+	static constexpr int RATE_WINDOW_SIZE{32};	///< angular velocity samples
+	static constexpr int ESC_WINDOW_SIZE{8};	///< ESC reports per motor
+
+	math::SlidingWindow<float, RATE_WINDOW_SIZE> _rate_error[3] {};
+	math::SlidingWindow<float, ESC_WINDOW_SIZE> _esc_current[esc_status_s::CONNECTED_ESC_MAX] {};
+	math::SlidingWindow<float, ESC_WINDOW_SIZE> _esc_throttle[esc_status_s::CONNECTED_ESC_MAX] {};
+
+	hrt_abstime _esc_timestamp[esc_status_s::CONNECTED_ESC_MAX] {};
+
+	matrix::Vector3f _rates_setpoint{};
+
+	uint16_t _esc_valid_current_mask{0};	///< true if ESC telemetry was valid at some point
+	uint16_t _esc_timed_out_mask{0};
+	uint16_t _esc_under_current_mask{0};
+	uint16_t _motor_failure_mask{0};	///< confirmed failures, latched until disarm
+
+	bool _escs_have_current{false};
+	bool _rate_tracking_failure{false};
+	bool _armed{false};
+	bool _rate_control_enabled{false};
+	bool _rotary_wing{false};
+
+	failure_detector_high_rate_s _status{};
+
+	uORB::SubscriptionCallbackWorkItem _vehicle_angular_velocity_sub{this, ORB_ID(vehicle_angular_velocity)};
+
+	uORB::Subscription _actuator_motors_sub{ORB_ID(actuator_motors)};
+	uORB::Subscription _esc_status_sub{ORB_ID(esc_status)};
+	uORB::Subscription _parameter_update_sub{ORB_ID(parameter_update)};
+	uORB::Subscription _vehicle_control_mode_sub{ORB_ID(vehicle_control_mode)};
+	uORB::Subscription _vehicle_rates_setpoint_sub{ORB_ID(vehicle_rates_setpoint)};
+	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
+
+	uORB::Publication<failure_detector_high_rate_s> _failure_detector_high_rate_pub{ORB_ID(failure_detector_high_rate)};
+
+	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, "failure_detector_high_rate: cycle")};
+
+	DEFINE_PARAMETERS(
+		(ParamFloat<px4::params::FD_HR_RATE_ERR>) _param_fd_hr_rate_err,
+		(ParamInt<px4::params::FD_HR_ESC_TOUT>) _param_fd_hr_esc_tout,
+		(ParamFloat<px4::params::FD_ACT_MOT_THR>) _param_fd_motor_throttle_thres,
+		(ParamFloat<px4::params::FD_ACT_MOT_C2T>) _param_fd_motor_current2throttle_thres
+	)
+};
@@ -212,3 +212,49 @@ PARAM_DEFINE_FLOAT(FD_ACT_MOT_C2T, 2.0f);
  * @increment 100
  */
 PARAM_DEFINE_INT32(FD_ACT_MOT_TOUT, 100);
+
+/**
+ * Enable high-rate failure detection
+ *
+ * Runs an additional failure detection stage on the rate controller work queue
+ * that evaluates the rate tracking error on every angular velocity sample and the
+ * ESC telemetry on every report. A motor failure is reported once the ESC telemetry
+ * times out or shows too little current and the vehicle also fails to track the
+ * roll or pitch rate setpoint, which allows motor failure mitigation within a few
+ * control cycles.
+ *
+ * @boolean
+ *
+ * @group Failure Detector
+ */
+PARAM_DEFINE_INT32(FD_HR_EN, 0);
+
+/**
+ * High-rate failure detection rate tracking error threshold
+ *
+ * Mean roll or pitch rate tracking error over the last 32 angular velocity samples
+ * above which the high-rate stage considers the vehicle to be losing control.
+ * Setting this value to 0 disables the high-rate motor failure detection.
+ *
+ * @unit deg/s
+ * @min 0
+ * @max 1000
+ * @decimal 0
+ * @increment 10
+ * @group Failure Detector
+ */
+PARAM_DEFINE_FLOAT(FD_HR_RATE_ERR, 60.f);
+
+/**
+ * High-rate failure detection ESC telemetry timeout
+ *
+ * ESC telemetry timeout of the high-rate stage. Must be longer than the update
+ * interval of the individual ESC reports.
+ *
+ * @unit ms
+ * @min 5
+ * @max 300
+ * @increment 5
+ * @group Failure Detector
+ */
+PARAM_DEFINE_INT32(FD_HR_ESC_TOUT, 50);
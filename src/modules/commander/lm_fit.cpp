@@ -33,6 +33,61 @@
 
 #include "lm_fit.hpp"
 
+void SphereFitAccumulator::add(const matrix::Vector3f &sample)
+{
+	if (_count == 0) {
+		_origin = sample;
+	}
+
+	const matrix::Vector3f p = sample - _origin;
+	const float a[4] {2.f * p(0), 2.f * p(1), 2.f * p(2), 1.f};
+	const float b = p.norm_squared();
+
+	for (int i = 0; i < 4; i++) {
+		for (int j = i; j < 4; j++) {
+			_ATA(i, j) += a[i] * a[j];
+		}
+
+		_ATb(i) += a[i] * b;
+	}
+
+	_count++;
+}
+
+bool SphereFitAccumulator::solve(sphere_params &params) const
+{
+	if (_count < 4) {
+		return false;
+	}
+
+	// only the upper triangle is accumulated
+	matrix::SquareMatrix<float, 4> ATA = _ATA;
+
+	for (int i = 1; i < 4; i++) {
+		for (int j = 0; j < i; j++) {
+			ATA(i, j) = ATA(j, i);
+		}
+	}
+
+	matrix::SquareMatrix<float, 4> ATA_inv;
+
+	if (!ATA.I(ATA_inv)) {
+		return false;
+	}
+
+	const matrix::Vector<float, 4> x = ATA_inv * _ATb;
+	const matrix::Vector3f center{x(0), x(1), x(2)};
+	const float radius_squared = x(3) + center.norm_squared();
+
+	if (!PX4_ISFINITE(radius_squared) || radius_squared <= 0.f) {
+		return false;
+	}
+
+	params.offset = _origin + center;
+	params.radius = sqrtf(radius_squared);
+	return true;
+}
+
 struct iteration_result {
 	float gradient_damping;
 	float cost;
@@ -314,11 +369,10 @@ void lm_ellipsoid_fit_iteration(const float x[], const float y[], const float z[
 
 
 int lm_mag_fit(const float x[], const float y[], const float z[], unsigned int samples_collected, sphere_params &params,
-	       bool full_ellipsoid)
+	       bool full_ellipsoid, int min_iterations)
 {
 
 	const int max_iterations = 100;
-	const int min_iterations = 10;
 	const float cost_threshold = 0.01;
 	const float step_threshold = 0.001;
 
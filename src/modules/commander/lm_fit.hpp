@@ -43,6 +43,38 @@ struct sphere_params {
 	float radius{0.2f};
 };
 
+/**
+ * Linear least-squares sphere fit accumulated sample by sample.
+ *
+ * Solves |p|^2 = 2 p.c + (r^2 - |c|^2) for the offset c and radius r using only running sums,
+ * so the fit is available at any time while the samples are collected and solving it does not
+ * need another pass over the data. The samples are taken relative to the first one to keep the
+ * sums well conditioned in single precision.
+ */
+class SphereFitAccumulator
+{
+public:
+	void reset() { *this = SphereFitAccumulator{}; }
+
+	void add(const matrix::Vector3f &sample);
+
+	/**
+	 * Solve the normal equations for the sphere offset and radius.
+	 *
+	 * @param params offset and radius are updated on success, the other fields are left untouched
+	 * @return true on success, false if there are not enough samples or they do not span a sphere
+	 */
+	bool solve(sphere_params &params) const;
+
+	unsigned count() const { return _count; }
+
+private:
+	matrix::SquareMatrix<float, 4> _ATA{};
+	matrix::Vector<float, 4> _ATb{};
+	matrix::Vector3f _origin{};
+	unsigned _count{0};
+};
+
 
 /**
  * Least-squares fit of a sphere to a set of points.
@@ -53,13 +85,14 @@ struct sphere_params {
  * @param y point coordinates on the Y axis
  * @param z point coordinates on the Z axis
  * @param samples_collected number of points
- * @param max_iterations abort if maximum number of iterations have been reached. If unsure, set to 100.
  * @param params the values to be optimized
  * @param full_ellipsoid whether to just optimize a sphere, or do an ellipsoid optimization
+ * @param min_iterations number of iterations to run before checking for convergence. Can be lowered when
+ *                       params is already close to the solution (e.g. from SphereFitAccumulator).
  *
  * NB!! If you optimize the full ellipsoid, you must have already optimized without the full ellipsoid
  *
  * @return 0 on success, 1 on failure
  */
 int lm_mag_fit(const float x[], const float y[], const float z[], unsigned int samples_collected, sphere_params &params,
-	       bool full_ellipsoid);
+	       bool full_ellipsoid, int min_iterations = 10);
@@ -94,6 +94,8 @@ struct mag_worker_data_t {
 	float		*y[MAX_MAGS];
 	float		*z[MAX_MAGS];
 
+	SphereFitAccumulator sphere_fit[MAX_MAGS];	///< Running sphere fit, updated with every accepted sample
+
 	calibration::Magnetometer calibration[MAX_MAGS] {};
 };
 
@@ -386,6 +388,7 @@ static calibrate_return mag_calibration_worker(detect_orientation_return orienta
 						worker_data->z[cur_mag][worker_data->calibration_counter_total[cur_mag]] = new_samples[cur_mag](2);
 
 						worker_data->calibration_counter_total[cur_mag]++;
+						worker_data->sphere_fit[cur_mag].add(new_samples[cur_mag]);
 					}
 				}
 
@@ -407,10 +410,16 @@ static calibrate_return mag_calibration_worker(detect_orientation_return orienta
 						status.y[cur_mag] = worker_data->y[cur_mag][sample];
 						status.z[cur_mag] = worker_data->z[cur_mag][sample];
 
+						sphere_params sphere{};
+						sphere.radius = 0.f;
+						worker_data->sphere_fit[cur_mag].solve(sphere);
+						status.sphere_radius[cur_mag] = sphere.radius;
+
 					} else {
 						status.x[cur_mag] = 0.f;
 						status.y[cur_mag] = 0.f;
 						status.z[cur_mag] = 0.f;
+						status.sphere_radius[cur_mag] = 0.f;
 					}
 				}
 
@@ -587,10 +596,18 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 				sphere_data.diag = matrix::Vector3f(diag[cur_mag](0), diag[cur_mag](1), diag[cur_mag](2));
 				sphere_data.offdiag = matrix::Vector3f(offdiag[cur_mag](0), offdiag[cur_mag](1), offdiag[cur_mag](2));
 
+				// Start from the linear sphere fit accumulated during data collection, it is already close to the
+				// solution and only needs a few refinement iterations.
+				int min_iterations = 10;
+
+				if (worker_data.sphere_fit[cur_mag].solve(sphere_data)) {
+					min_iterations = 2;
+				}
+
 				bool sphere_fit_success = false;
 				bool ellipsoid_fit_success = false;
 				int ret = lm_mag_fit(worker_data.x[cur_mag], worker_data.y[cur_mag], worker_data.z[cur_mag],
-						     worker_data.calibration_counter_total[cur_mag], sphere_data, false);
+						     worker_data.calibration_counter_total[cur_mag], sphere_data, false, min_iterations);
 
 				if (ret == PX4_OK) {
 					sphere_fit_success = true;
@@ -195,6 +195,68 @@ TEST_F(MagCalTest, sphereRegularlySpaced)
 	EXPECT_NEAR(sphere.diag(2), scale_true(2), 0.001f) << "scale Z: " << scale_true(2);
 }
 
+TEST_F(MagCalTest, sphereAccumulatorRegularlySpaced)
+{
+	// GIVEN: a dataset of regularly spaced points
+	// on a perfect sphere but not centered on the origin
+	static constexpr unsigned int N_SAMPLES = 240;
+
+	const float mag_str_true = 0.4f;
+	const Vector3f offset_true = {-1.07f, 0.35f, -0.78f};
+	const Vector3f scale_true = {1.f, 1.f, 1.f};
+
+	float x[N_SAMPLES];
+	float y[N_SAMPLES];
+	float z[N_SAMPLES];
+	generateRegularData(x, y, z, N_SAMPLES, mag_str_true);
+	modifyOffsetScale(x, y, z, N_SAMPLES, offset_true, scale_true);
+
+	// WHEN: accumulating the samples one at a time
+	SphereFitAccumulator accumulator;
+	sphere_params sphere;
+
+	EXPECT_FALSE(accumulator.solve(sphere));
+
+	for (unsigned int k = 0; k < N_SAMPLES; k++) {
+		accumulator.add(Vector3f{x[k], y[k], z[k]});
+	}
+
+	// THEN: the linear fit should directly find the correct parameters
+	EXPECT_EQ(accumulator.count(), N_SAMPLES);
+	EXPECT_TRUE(accumulator.solve(sphere));
+	EXPECT_NEAR(sphere.radius, mag_str_true, 0.001f) << "radius: " << sphere.radius;
+	EXPECT_NEAR(sphere.offset(0), offset_true(0), 0.001f) << "offset X: " << sphere.offset(0);
+	EXPECT_NEAR(sphere.offset(1), offset_true(1), 0.001f) << "offset Y: " << sphere.offset(1);
+	EXPECT_NEAR(sphere.offset(2), offset_true(2), 0.001f) << "offset Z: " << sphere.offset(2);
+}
+
+TEST_F(MagCalTest, sphereAccumulatorReplayTestData)
+{
+	// GIVEN: a real test dataset with large offsets
+	constexpr unsigned int N_SAMPLES = 231;
+
+	const float mag_str_true = 0.4f;
+	const Vector3f offset_true = {-0.18f, 0.05f, -0.58f};
+
+	// WHEN: seeding the LM fit with the accumulated linear fit
+	SphereFitAccumulator accumulator;
+
+	for (unsigned int k = 0; k < N_SAMPLES; k++) {
+		accumulator.add(Vector3f{mag_data1_x[k], mag_data1_y[k], mag_data1_z[k]});
+	}
+
+	sphere_params sphere;
+	EXPECT_TRUE(accumulator.solve(sphere));
+	int sphere_success = lm_mag_fit(mag_data1_x, mag_data1_y, mag_data1_z, N_SAMPLES, sphere, false, 2);
+
+	// THEN: a few refinement iterations should be enough to find the correct parameters
+	EXPECT_EQ(sphere_success, PX4_OK);
+	EXPECT_NEAR(sphere.radius, mag_str_true, 0.1f) << "radius: " << sphere.radius;
+	EXPECT_NEAR(sphere.offset(0), offset_true(0), 0.01f) << "offset X: " << sphere.offset(0);
+	EXPECT_NEAR(sphere.offset(1), offset_true(1), 0.01f) << "offset Y: " << sphere.offset(1);
+	EXPECT_NEAR(sphere.offset(2), offset_true(2), 0.01f) << "offset Z: " << sphere.offset(2);
+}
+
 TEST_F(MagCalTest, replayTestData)
 {
 	// GIVEN: a real test dataset with large offsets
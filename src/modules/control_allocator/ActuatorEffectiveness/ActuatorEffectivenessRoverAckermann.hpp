@@ -35,6 +35,8 @@
 
 #include "ActuatorEffectiveness.hpp"
 
+#include <mathlib/mathlib.h>
+
 class ActuatorEffectivenessRoverAckermann : public ActuatorEffectiveness
 {
 public:
@@ -48,6 +50,27 @@ public:
 			    const matrix::Vector<float, NUM_ACTUATORS> &actuator_max) override;
 
 	const char *name() const override { return "Rover (Ackermann)"; }
+
+	/**
+	 * Allocation of this geometry for controllers that skip the control allocator (fused allocation):
+	 * the drive motor follows the x thrust and is stopped at zero thrust, the steering servo the z torque.
+	 * @param thrust_x normalized thrust setpoint
+	 * @param torque_z normalized yaw torque setpoint
+	 * @param motor_reversible motor accepts negative setpoints (CA_R_REV)
+	 * @param motor drive motor setpoint, NAN if stopped
+	 * @param servo steering servo setpoint
+	 */
+	static void allocateDirect(float thrust_x, float torque_z, bool motor_reversible, float &motor, float &servo)
+	{
+		motor = math::constrain(thrust_x, motor_reversible ? -1.f : 0.f, 1.f);
+
+		// same threshold as stopMaskedMotorsWithZeroThrust()
+		if (fabsf(motor) < .02f) {
+			motor = NAN;
+		}
+
+		servo = math::constrain(torque_z, -1.f, 1.f);
+	}
 private:
 	uint32_t _motors_mask{};
 };
@@ -63,6 +63,32 @@ ControlAllocation::setEffectivenessMatrix(
 	_control_trim = _effectiveness * linearization_point_clipped;
 }
 
+void
+ControlAllocation::getConfig(Config &config) const
+{
+	config.effectiveness = _effectiveness;
+	config.control_allocation_scale = _control_allocation_scale;
+	config.control_trim = _control_trim;
+	config.actuator_trim = _actuator_trim;
+	config.actuator_min = _actuator_min;
+	config.actuator_max = _actuator_max;
+	config.actuator_slew_rate_limit = _actuator_slew_rate_limit;
+	config.num_actuators = _num_actuators;
+}
+
+void
+ControlAllocation::setConfig(const Config &config)
+{
+	_effectiveness = config.effectiveness;
+	_control_allocation_scale = config.control_allocation_scale;
+	_control_trim = config.control_trim;
+	_actuator_trim = config.actuator_trim;
+	_actuator_min = config.actuator_min;
+	_actuator_max = config.actuator_max;
+	_actuator_slew_rate_limit = config.actuator_slew_rate_limit;
+	_num_actuators = config.num_actuators;
+}
+
 void
 ControlAllocation::setActuatorSetpoint(
 	const matrix::Vector<float, ControlAllocation::NUM_ACTUATORS> &actuator_sp)
@@ -93,6 +93,34 @@ public:
 		THRUST_Z
 	};
 
+	/**
+	 * Everything derived from the effectiveness matrix that allocate() needs,
+	 * used to hand a precomputed allocation to another instance (@see getConfig(), setConfig())
+	 */
+	struct Config {
+		matrix::Matrix<float, NUM_AXES, NUM_ACTUATORS> effectiveness;
+		matrix::Matrix<float, NUM_ACTUATORS, NUM_AXES> mix;
+		matrix::Vector<float, NUM_AXES> control_allocation_scale;
+		matrix::Vector<float, NUM_AXES> control_trim;
+		ActuatorVector actuator_trim;
+		ActuatorVector actuator_min;
+		ActuatorVector actuator_max;
+		ActuatorVector actuator_slew_rate_limit;
+		int num_actuators{0};
+	};
+
+	/**
+	 * Precompute everything that only depends on the effectiveness matrix,
+	 * so that allocate() only depends on the control setpoint
+	 */
+	virtual void prepare() {}
+
+	/**
+	 * Get / set the precomputed allocation, the actuator setpoint is not part of it
+	 */
+	virtual void getConfig(Config &config) const;
+	virtual void setConfig(const Config &config);
+
 	/**
 	 * Allocate control setpoint to actuators
 	 */
@@ -0,0 +1,277 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ControlAllocationActiveSet.cpp
+ *
+ * Control Allocation Algorithm using a warm started, iteration bounded active-set solver.
+ */
+
+#include "ControlAllocationActiveSet.hpp"
+
+#include <mathlib/math/Limits.hpp>
+
+void
+ControlAllocationActiveSet::allocate()
+{
+	// Compute new gains and normalization if needed
+	updatePseudoInverse();
+
+	_prev_actuator_sp = _actuator_sp;
+
+	const int num_actuators = _num_actuators;
+
+	// normalized effectiveness B, rows scaled the same way as the mix columns (see normalizeControlAllocationMatrix())
+	matrix::Vector<float, NUM_AXES> row_weight;
+	row_weight.setAll(1.f);
+
+	if (_control_allocation_scale(0) > FLT_EPSILON) {
+		row_weight(0) = _control_allocation_scale(0);
+		row_weight(1) = _control_allocation_scale(1);
+	}
+
+	if (_control_allocation_scale(2) > FLT_EPSILON) {
+		row_weight(2) = _control_allocation_scale(2);
+	}
+
+	if (_control_allocation_scale(3) > FLT_EPSILON) {
+		row_weight(3) = _control_allocation_scale(3);
+		row_weight(4) = _control_allocation_scale(4);
+		row_weight(5) = _control_allocation_scale(5);
+	}
+
+	// axis priorities Wv, yaw is given up first
+	matrix::Vector<float, NUM_AXES> axis_weight;
+	axis_weight.setAll(1.f);
+	axis_weight(2) = math::max(_param_ca_qp_yaw_w.get(), 0.f);
+
+	const matrix::Vector<float, NUM_AXES> v = _control_sp - _control_trim;
+
+	matrix::Matrix<float, NUM_AXES, NUM_ACTUATORS> WB;
+
+	for (int i = 0; i < NUM_AXES; i++) {
+		for (int j = 0; j < num_actuators; j++) {
+			WB(i, j) = axis_weight(i) * row_weight(i) * _effectiveness(i, j);
+		}
+	}
+
+	// unconstrained (pseudo-inverse) solution, also the first warm start
+	const ActuatorVector du_pinv{_mix * v};
+
+	// H = B^T * Wv^2 * B + eps * I, c = B^T * Wv^2 * v + eps * du_p
+	_hessian = WB.transposeMultiply(WB);
+	ActuatorVector c{WB.transposeMultiply(matrix::Matrix<float, NUM_AXES, 1>(axis_weight.emult(v)))};
+
+	for (int i = 0; i < num_actuators; i++) {
+		_hessian(i, i) += REGULARIZATION;
+		c(i) += REGULARIZATION * du_pinv(i);
+	}
+
+	// bounds relative to trim
+	ActuatorVector lower;
+	ActuatorVector upper;
+
+	for (int i = 0; i < num_actuators; i++) {
+		if (_actuator_max(i) < _actuator_min(i)) {
+			// disabled actuator, stays at trim
+			lower(i) = 0.f;
+			upper(i) = 0.f;
+
+		} else {
+			lower(i) = _actuator_min(i) - _actuator_trim(i);
+			upper(i) = _actuator_max(i) - _actuator_trim(i);
+		}
+	}
+
+	// warm start: previous solution and its active set, or the pseudo-inverse solution
+	ActuatorVector du = _warm_start_valid ? _du : du_pinv;
+
+	for (int i = 0; i < NUM_ACTUATORS; i++) {
+		if (i >= num_actuators) {
+			du(i) = 0.f;
+			_bound_state[i] = 0;
+
+		} else if (du(i) <= lower(i)) {
+			du(i) = lower(i);
+			_bound_state[i] = -1;
+
+		} else if (du(i) >= upper(i)) {
+			du(i) = upper(i);
+			_bound_state[i] = 1;
+
+		} else {
+			_bound_state[i] = 0;
+		}
+	}
+
+	const int max_iterations = math::max(_param_ca_qp_max_iter.get(), (int32_t)1);
+	int iteration = 0;
+
+	while (iteration < max_iterations) {
+		iteration++;
+
+		// step to the optimum of the free actuators, keeping the active set fixed
+		const ActuatorVector gradient = _hessian * du - c;
+		ActuatorVector p;
+
+		if (!solveFree(-gradient, p)) {
+			break;
+		}
+
+		float alpha = 1.f;
+		int blocking = -1;
+
+		for (int i = 0; i < num_actuators; i++) {
+			if (_bound_state[i] == 0) {
+				if ((p(i) < -TOLERANCE) && (du(i) + alpha * p(i) < lower(i))) {
+					alpha = (lower(i) - du(i)) / p(i);
+					blocking = i;
+
+				} else if ((p(i) > TOLERANCE) && (du(i) + alpha * p(i) > upper(i))) {
+					alpha = (upper(i) - du(i)) / p(i);
+					blocking = i;
+				}
+			}
+		}
+
+		du += p * alpha;
+
+		if (blocking >= 0) {
+			// add the blocking constraint to the active set
+			_bound_state[blocking] = (p(blocking) < 0.f) ? -1 : 1;
+			du(blocking) = (p(blocking) < 0.f) ? lower(blocking) : upper(blocking);
+			continue;
+		}
+
+		// full step, optimal if all Lagrange multipliers of the active set are positive
+		const ActuatorVector gradient_new = _hessian * du - c;
+		int release = -1;
+		float lambda_min = -TOLERANCE;
+
+		for (int i = 0; i < num_actuators; i++) {
+			if ((_bound_state[i] != 0) && (upper(i) - lower(i) > TOLERANCE)) {
+				const float lambda = (_bound_state[i] < 0) ? gradient_new(i) : -gradient_new(i);
+
+				if (lambda < lambda_min) {
+					lambda_min = lambda;
+					release = i;
+				}
+			}
+		}
+
+		if (release < 0) {
+			break;
+		}
+
+		_bound_state[release] = 0;
+	}
+
+	_last_iterations = iteration;
+	_du = du;
+	_warm_start_valid = true;
+
+	_actuator_sp = _actuator_trim + du;
+}
+
+bool
+ControlAllocationActiveSet::solveFree(const ActuatorVector &rhs, ActuatorVector &p)
+{
+	int free_idx[NUM_ACTUATORS];
+	int num_free = 0;
+
+	for (int i = 0; i < _num_actuators; i++) {
+		if (_bound_state[i] == 0) {
+			free_idx[num_free++] = i;
+		}
+	}
+
+	p.setZero();
+
+	// Cholesky decomposition H_ff = L * L^T
+	for (int j = 0; j < num_free; j++) {
+		float diag = _hessian(free_idx[j], free_idx[j]);
+
+		for (int k = 0; k < j; k++) {
+			diag -= _cholesky(j, k) * _cholesky(j, k);
+		}
+
+		if (diag <= 0.f) {
+			return false;
+		}
+
+		_cholesky(j, j) = sqrtf(diag);
+
+		for (int i = j + 1; i < num_free; i++) {
+			float sum = _hessian(free_idx[i], free_idx[j]);
+
+			for (int k = 0; k < j; k++) {
+				sum -= _cholesky(i, k) * _cholesky(j, k);
+			}
+
+			_cholesky(i, j) = sum / _cholesky(j, j);
+		}
+	}
+
+	// forward substitution L * y = rhs_f
+	float y[NUM_ACTUATORS];
+
+	for (int i = 0; i < num_free; i++) {
+		float sum = rhs(free_idx[i]);
+
+		for (int k = 0; k < i; k++) {
+			sum -= _cholesky(i, k) * y[k];
+		}
+
+		y[i] = sum / _cholesky(i, i);
+	}
+
+	// back substitution L^T * p_f = y
+	for (int i = num_free - 1; i >= 0; i--) {
+		float sum = y[i];
+
+		for (int k = i + 1; k < num_free; k++) {
+			sum -= _cholesky(k, i) * p(free_idx[k]);
+		}
+
+		p(free_idx[i]) = sum / _cholesky(i, i);
+	}
+
+	return true;
+}
+
+void
+ControlAllocationActiveSet::updateParameters()
+{
+	updateParams();
+}
@@ -0,0 +1,102 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ControlAllocationActiveSet.hpp
+ *
+ * Control Allocation Algorithm solving a box constrained weighted least squares problem
+ * with an active-set method.
+ *
+ *   min |Wv * (B * du - v)|^2 + eps * |du - du_p|^2   subject to   u_min <= u_trim + du <= u_max
+ *
+ * B is the normalized effectiveness matrix, v the demanded control and du_p the (unclipped)
+ * pseudo-inverse solution. When the demand is feasible the result is the pseudo-inverse
+ * solution, otherwise the weighted control error is minimized (roll and pitch before yaw)
+ * within the actuator limits, preferring solutions close to du_p.
+ *
+ * The solver is warm started from the previous solution and its active set, and the number
+ * of iterations is capped (CA_QP_MAX_ITER) for a deterministic worst case execution time.
+ * If the cap is hit the last feasible iterate is used.
+ */
+
+#pragma once
+
+#include "ControlAllocationPseudoInverse.hpp"
+
+#include <px4_platform_common/module_params.h>
+
+class ControlAllocationActiveSet: public ControlAllocationPseudoInverse, public ModuleParams
+{
+public:
+
+	ControlAllocationActiveSet() : ModuleParams(nullptr) {}
+	virtual ~ControlAllocationActiveSet() = default;
+
+	void allocate() override;
+
+	void updateParameters() override;
+
+	/**
+	 * Number of solver iterations used by the last allocation
+	 */
+	int lastIterations() const { return _last_iterations; }
+
+private:
+	using ActuatorBoundState = int8_t; ///< -1: at lower bound, 0: free, 1: at upper bound
+
+	static constexpr float REGULARIZATION = 1e-4f; ///< eps, weight of the distance to the pseudo-inverse solution
+	static constexpr float TOLERANCE = 1e-6f;
+
+	/**
+	 * Solve H_ff * p_f = rhs_f for the free actuators with a Cholesky decomposition of the
+	 * reduced Hessian, p is 0 for actuators in the active set.
+	 *
+	 * @return false if the reduced Hessian is not positive definite
+	 */
+	bool solveFree(const ActuatorVector &rhs, ActuatorVector &p);
+
+	// members instead of locals to keep them off the rate_ctrl stack
+	matrix::SquareMatrix<float, NUM_ACTUATORS> _hessian; ///< H = B^T * Wv^2 * B + eps * I
+	matrix::SquareMatrix<float, NUM_ACTUATORS> _cholesky; ///< factor of the reduced Hessian (compact)
+
+	ActuatorBoundState _bound_state[NUM_ACTUATORS] {}; ///< active set, kept for warm starting
+	ActuatorVector _du; ///< previous solution relative to trim
+	bool _warm_start_valid{false};
+	int _last_iterations{0};
+
+	DEFINE_PARAMETERS(
+		(ParamInt<px4::params::CA_QP_MAX_ITER>) _param_ca_qp_max_iter,
+		(ParamFloat<px4::params::CA_QP_YAW_W>) _param_ca_qp_yaw_w
+	)
+};
@@ -0,0 +1,224 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ControlAllocationActiveSetTest.cpp
+ *
+ * Tests for the active-set Control Allocation Algorithm
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <ControlAllocationActiveSet.hpp>
+#include <../ActuatorEffectiveness/ActuatorEffectivenessRotors.hpp>
+
+using namespace matrix;
+
+namespace
+{
+
+// Returns the effectiveness matrix of a quad-x with the same geometry as the sequential desaturation tests,
+// or of a coaxial octo-x with an opposite spinning rotor below each of them
+ActuatorEffectiveness::EffectivenessMatrix make_quad_x_effectiveness(bool coaxial = false)
+{
+	ActuatorEffectivenessRotors::Geometry geometry = {};
+	const float x[4] {1.f, -1.f, 1.f, -1.f};
+	const float y[4] {1.f, -1.f, -1.f, 1.f};
+	const float moment_ratio[4] {0.05f, 0.05f, -0.05f, -0.05f};
+	const int num_rotors = coaxial ? 8 : 4;
+
+	for (int i = 0; i < num_rotors; i++) {
+		const bool lower = (i >= 4);
+		geometry.rotors[i].position = Vector3f(x[i % 4], y[i % 4], lower ? 0.1f : 0.f);
+		geometry.rotors[i].axis = Vector3f(0.f, 0.f, -1.f);
+		geometry.rotors[i].thrust_coef = 1.f;
+		geometry.rotors[i].moment_ratio = lower ? -moment_ratio[i % 4] : moment_ratio[i % 4];
+	}
+
+	geometry.num_rotors = num_rotors;
+
+	ActuatorEffectiveness::EffectivenessMatrix effectiveness;
+	effectiveness.setZero();
+	ActuatorEffectivenessRotors::computeEffectivenessMatrix(geometry, effectiveness);
+	return effectiveness;
+}
+
+// Configures an allocator for the quad with motor outputs in [0, 1] and normalized controls
+void setup_quad_allocator(ControlAllocationPseudoInverse &allocator, bool coaxial = false)
+{
+	ActuatorEffectiveness::ActuatorVector actuator_trim;
+	ActuatorEffectiveness::ActuatorVector linearization_point;
+	ActuatorEffectiveness::ActuatorVector actuator_max;
+	actuator_max.setAll(1.f);
+
+	allocator.setActuatorMin(ActuatorEffectiveness::ActuatorVector());
+	allocator.setActuatorMax(actuator_max);
+	allocator.setEffectivenessMatrix(make_quad_x_effectiveness(coaxial), actuator_trim, linearization_point,
+				       coaxial ? 8 : 4, true);
+}
+
+static constexpr float EXPECT_NEAR_TOL{1e-3f};
+
+} // namespace
+
+// Without saturation the result is the pseudo-inverse solution
+TEST(ControlAllocationActiveSetTest, UnsaturatedMatchesPseudoInverse)
+{
+	ControlAllocationActiveSet allocator;
+	ControlAllocationPseudoInverse reference;
+	setup_quad_allocator(allocator);
+	setup_quad_allocator(reference);
+
+	Vector<float, ActuatorEffectiveness::NUM_AXES> control_sp;
+	control_sp(ControlAllocation::ControlAxis::ROLL) = 0.1f;
+	control_sp(ControlAllocation::ControlAxis::PITCH) = -0.05f;
+	control_sp(ControlAllocation::ControlAxis::YAW) = 0.05f;
+	control_sp(ControlAllocation::ControlAxis::THRUST_Z) = -0.5f;
+
+	allocator.setControlSetpoint(control_sp);
+	reference.setControlSetpoint(control_sp);
+	allocator.allocate();
+	reference.allocate();
+
+	for (int i = 0; i < ActuatorEffectiveness::NUM_ACTUATORS; i++) {
+		EXPECT_NEAR(allocator.getActuatorSetpoint()(i), reference.getActuatorSetpoint()(i), EXPECT_NEAR_TOL);
+	}
+}
+
+// Same for a coaxial octo, where the solution is not unique without the actuator effort term
+TEST(ControlAllocationActiveSetTest, UnsaturatedMatchesPseudoInverseCoaxial)
+{
+	ControlAllocationActiveSet allocator;
+	ControlAllocationPseudoInverse reference;
+	setup_quad_allocator(allocator, true);
+	setup_quad_allocator(reference, true);
+
+	Vector<float, ActuatorEffectiveness::NUM_AXES> control_sp;
+	control_sp(ControlAllocation::ControlAxis::ROLL) = -0.2f;
+	control_sp(ControlAllocation::ControlAxis::PITCH) = 0.1f;
+	control_sp(ControlAllocation::ControlAxis::YAW) = 0.1f;
+	control_sp(ControlAllocation::ControlAxis::THRUST_Z) = -0.5f;
+
+	allocator.setControlSetpoint(control_sp);
+	reference.setControlSetpoint(control_sp);
+	allocator.allocate();
+	reference.allocate();
+
+	for (int i = 0; i < ActuatorEffectiveness::NUM_ACTUATORS; i++) {
+		EXPECT_NEAR(allocator.getActuatorSetpoint()(i), reference.getActuatorSetpoint()(i), EXPECT_NEAR_TOL);
+	}
+}
+
+// With saturation all outputs stay within the limits and roll is allocated before yaw
+TEST(ControlAllocationActiveSetTest, SaturatedWithinLimits)
+{
+	ControlAllocationActiveSet allocator;
+	setup_quad_allocator(allocator);
+
+	Vector<float, ActuatorEffectiveness::NUM_AXES> control_sp;
+	control_sp(ControlAllocation::ControlAxis::ROLL) = 0.6f;
+	control_sp(ControlAllocation::ControlAxis::YAW) = 0.6f;
+	control_sp(ControlAllocation::ControlAxis::THRUST_Z) = -0.8f;
+
+	allocator.setControlSetpoint(control_sp);
+	allocator.allocate();
+
+	const ActuatorEffectiveness::ActuatorVector actuator_sp = allocator.getActuatorSetpoint();
+
+	for (int i = 0; i < ActuatorEffectiveness::NUM_ACTUATORS; i++) {
+		EXPECT_GE(actuator_sp(i), -EXPECT_NEAR_TOL);
+		EXPECT_LE(actuator_sp(i), 1.f + EXPECT_NEAR_TOL);
+	}
+
+	const Vector<float, ActuatorEffectiveness::NUM_AXES> control_allocated = allocator.getAllocatedControl();
+	const float roll_error = fabsf(control_allocated(ControlAllocation::ControlAxis::ROLL) - 0.6f);
+	const float yaw_error = fabsf(control_allocated(ControlAllocation::ControlAxis::YAW) - 0.6f);
+
+	EXPECT_LT(roll_error, 0.01f);
+	EXPECT_GT(yaw_error, roll_error);
+}
+
+// Saturated coaxial octo: within limits and a smaller control error than the clipped pseudo-inverse solution
+TEST(ControlAllocationActiveSetTest, SaturatedCoaxialBetterThanClipping)
+{
+	ControlAllocationActiveSet allocator;
+	ControlAllocationPseudoInverse reference;
+	setup_quad_allocator(allocator, true);
+	setup_quad_allocator(reference, true);
+
+	Vector<float, ActuatorEffectiveness::NUM_AXES> control_sp;
+	control_sp(ControlAllocation::ControlAxis::ROLL) = 0.7f;
+	control_sp(ControlAllocation::ControlAxis::PITCH) = -0.4f;
+	control_sp(ControlAllocation::ControlAxis::YAW) = 0.3f;
+	control_sp(ControlAllocation::ControlAxis::THRUST_Z) = -0.85f;
+
+	allocator.setControlSetpoint(control_sp);
+	reference.setControlSetpoint(control_sp);
+	allocator.allocate();
+	reference.allocate();
+	reference.clipActuatorSetpoint();
+
+	for (int i = 0; i < ActuatorEffectiveness::NUM_ACTUATORS; i++) {
+		EXPECT_GE(allocator.getActuatorSetpoint()(i), -EXPECT_NEAR_TOL);
+		EXPECT_LE(allocator.getActuatorSetpoint()(i), 1.f + EXPECT_NEAR_TOL);
+	}
+
+	const float error = Vector<float, ActuatorEffectiveness::NUM_AXES>(allocator.getAllocatedControl() - control_sp).norm();
+	const float error_clipped = Vector<float, ActuatorEffectiveness::NUM_AXES>(reference.getAllocatedControl() - control_sp).norm();
+	EXPECT_LT(error, error_clipped);
+	EXPECT_LE(allocator.lastIterations(), 10);
+}
+
+// Warm started from the previous solution, an unchanged setpoint converges in a single iteration
+TEST(ControlAllocationActiveSetTest, WarmStart)
+{
+	ControlAllocationActiveSet allocator;
+	setup_quad_allocator(allocator);
+
+	Vector<float, ActuatorEffectiveness::NUM_AXES> control_sp;
+	control_sp(ControlAllocation::ControlAxis::ROLL) = 0.8f;
+	control_sp(ControlAllocation::ControlAxis::PITCH) = 0.5f;
+	control_sp(ControlAllocation::ControlAxis::THRUST_Z) = -0.9f;
+
+	allocator.setControlSetpoint(control_sp);
+	allocator.allocate();
+	const ActuatorEffectiveness::ActuatorVector actuator_sp = allocator.getActuatorSetpoint();
+
+	allocator.allocate();
+	EXPECT_EQ(allocator.lastIterations(), 1);
+
+	for (int i = 0; i < ActuatorEffectiveness::NUM_ACTUATORS; i++) {
+		EXPECT_NEAR(allocator.getActuatorSetpoint()(i), actuator_sp(i), EXPECT_NEAR_TOL);
+	}
+}
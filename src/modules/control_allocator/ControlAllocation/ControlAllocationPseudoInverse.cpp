@@ -53,11 +53,36 @@ ControlAllocationPseudoInverse::setEffectivenessMatrix(
 	_normalization_needs_update = update_normalization_scale;
 }
 
+void
+ControlAllocationPseudoInverse::getConfig(Config &config) const
+{
+	ControlAllocation::getConfig(config);
+	config.mix = _mix;
+}
+
+void
+ControlAllocationPseudoInverse::setConfig(const Config &config)
+{
+	ControlAllocation::setConfig(config);
+	_mix = config.mix;
+
+	// the mix is precomputed, don't recompute it on the fast path
+	_mix_update_needed = false;
+	_normalization_needs_update = false;
+}
+
 void
 ControlAllocationPseudoInverse::updatePseudoInverse()
 {
 	if (_mix_update_needed) {
-		matrix::geninv(_effectiveness, _mix);
+		_mix_update_needed = false;
+
+		if (!updateCachedInverse() && !_normalization_needs_update) {
+			// effectiveness unchanged, keep the current mix
+			return;
+		}
+
+		_mix = _pinv;
 
 		if (_normalization_needs_update && !_had_actuator_failure) {
 			updateControlAllocationMatrixScale();
@@ -65,10 +90,44 @@ ControlAllocationPseudoInverse::updatePseudoInverse()
 		}
 
 		normalizeControlAllocationMatrix();
-		_mix_update_needed = false;
 	}
 }
 
+bool
+ControlAllocationPseudoInverse::updateCachedInverse()
+{
+	if (_pinv_valid && (_num_actuators == _pinv_num_actuators)) {
+		if (_effectiveness == _pinv_effectiveness) {
+			return false;
+		}
+
+		if (_pinv_refine_count < PINV_REFINE_MAX_COUNT) {
+			// A * X is the identity for the controllable axes, disabled axes (zero rows) map to 0
+			matrix::SquareMatrix<float, NUM_AXES> D;
+
+			for (int i = 0; i < NUM_AXES; i++) {
+				D(i, i) = (_effectiveness.row(i).norm_squared() > 0.f) ? 1.f : 0.f;
+			}
+
+			const matrix::SquareMatrix<float, NUM_AXES> AX = _effectiveness * _pinv;
+
+			if ((AX - D).abs().max() < PINV_REFINE_MAX_ERROR) {
+				// Newton-Schulz: X = X * (2 * D - A * X), the error converges quadratically
+				_pinv = _pinv * (D * 2.f - AX);
+				_pinv_effectiveness = _effectiveness;
+				_pinv_refine_count++;
+				return true;
+			}
+		}
+	}
+
+	_pinv_valid = matrix::geninv(_effectiveness, _pinv);
+	_pinv_effectiveness = _effectiveness;
+	_pinv_num_actuators = _num_actuators;
+	_pinv_refine_count = 0;
+	return true;
+}
+
 void
 ControlAllocationPseudoInverse::updateControlAllocationMatrixScale()
 {
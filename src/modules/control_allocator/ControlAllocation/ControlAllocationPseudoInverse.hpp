@@ -54,6 +54,9 @@ public:
 	virtual ~ControlAllocationPseudoInverse() = default;
 
 	void allocate() override;
+	void prepare() override { updatePseudoInverse(); }
+	void getConfig(Config &config) const override;
+	void setConfig(const Config &config) override;
 	void setEffectivenessMatrix(const matrix::Matrix<float, NUM_AXES, NUM_ACTUATORS> &effectiveness,
 				    const ActuatorVector &actuator_trim, const ActuatorVector &linearization_point, int num_actuators,
 				    bool update_normalization_scale) override;
@@ -69,6 +72,27 @@ protected:
 	 */
 	void updatePseudoInverse();
 
+	/**
+	 * Update the cached pseudo inverse _pinv of _effectiveness.
+	 *
+	 * Small changes of the effectiveness (e.g. tilting rotors) are tracked with one Newton-Schulz
+	 * step warm started from the previous inverse, which is cheaper than a full geninv() and has
+	 * a fixed cost. Falls back to geninv() if the previous inverse is not close enough, and
+	 * periodically to avoid drift.
+	 *
+	 * @return true if the pseudo inverse changed
+	 */
+	bool updateCachedInverse();
+
+	static constexpr float PINV_REFINE_MAX_ERROR = 0.1f; ///< max |A * X - I| to refine the previous inverse
+	static constexpr int PINV_REFINE_MAX_COUNT = 20; ///< refinements in a row before a full recompute
+
+	matrix::Matrix<float, NUM_ACTUATORS, NUM_AXES> _pinv; ///< pseudo inverse of _effectiveness (not normalized)
+	matrix::Matrix<float, NUM_AXES, NUM_ACTUATORS> _pinv_effectiveness; ///< effectiveness _pinv was computed for
+	int _pinv_num_actuators{0};
+	int _pinv_refine_count{0};
+	bool _pinv_valid{false};
+
 private:
 	void normalizeControlAllocationMatrix();
 	void updateControlAllocationMatrixScale();
@@ -67,3 +67,44 @@ TEST(ControlAllocationTest, AllZeroCase)
 	EXPECT_EQ(actuator_sp, actuator_sp_expected);
 	EXPECT_EQ(control_allocated, control_allocated_expected);
 }
+
+TEST(ControlAllocationTest, SlowlyChangingEffectiveness)
+{
+	// quad with rotors tilting forward, the cached inverse is refined instead of recomputed
+	ControlAllocationPseudoInverse method;
+	matrix::Vector<float, 16> actuator_trim;
+	matrix::Vector<float, 16> linearization_point;
+
+	matrix::Vector<float, 6> control_sp;
+	control_sp(0) = 0.1f;
+	control_sp(1) = -0.05f;
+	control_sp(2) = 0.02f;
+	control_sp(5) = -0.6f;
+
+	for (int step = 0; step <= 50; step++) {
+		const float tilt = step * 0.01f;
+		matrix::Matrix<float, 6, 16> effectiveness;
+
+		for (int i = 0; i < 4; i++) {
+			const float x = (i == 0 || i == 3) ? 1.f : -1.f;
+			const float y = (i < 2) ? 1.f : -1.f;
+			const float dir = (i % 2 == 0) ? 1.f : -1.f;
+			effectiveness(0, i) = -y * cosf(tilt);
+			effectiveness(1, i) = x * cosf(tilt);
+			effectiveness(2, i) = 0.05f * dir * cosf(tilt) + y * sinf(tilt);
+			effectiveness(5, i) = -cosf(tilt);
+		}
+
+		method.setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, 4, false);
+		method.setControlSetpoint(control_sp);
+		method.allocate();
+
+		// reference: full pseudo inverse
+		ControlAllocationPseudoInverse reference;
+		reference.setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, 4, false);
+		reference.setControlSetpoint(control_sp);
+		reference.allocate();
+
+		EXPECT_TRUE(isEqual(method.getActuatorSetpoint(), reference.getActuatorSetpoint(), 1e-3f)) << "step " << step;
+	}
+}
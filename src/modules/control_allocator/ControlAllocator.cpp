@@ -52,8 +52,17 @@ using namespace time_literals;
 ControlAllocator::ControlAllocator() :
 	ModuleParams(nullptr),
 	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::rate_ctrl),
-	_loop_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": cycle"))
+	_loop_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")),
+	_latency_perf(perf_alloc(PC_HISTOGRAM, PERF_LATENCY_PREFIX "3 actuator_motors"))
 {
+	_dual_rate = _param_ca_dual_rate.get();
+
+	if (_dual_rate) {
+		_allocation_snapshot = new TripleBuffer<AllocationSnapshot>();
+		_slow_path = new SlowPath(*this);
+		_slow_path_perf = perf_alloc(PC_ELAPSED, MODULE_NAME": slow path");
+	}
+
 	_control_allocator_status_pub[0].advertise();
 	_control_allocator_status_pub[1].advertise();
 
@@ -78,13 +87,26 @@ ControlAllocator::ControlAllocator() :
 
 ControlAllocator::~ControlAllocator()
 {
+	if (_slow_path) {
+		_slow_path->ScheduleClear();
+
+		// wait for a running slow path cycle to finish
+		LockGuard lg{_slow_path_mutex};
+		delete _slow_path;
+		_slow_path = nullptr;
+	}
+
 	for (int i = 0; i < ActuatorEffectiveness::MAX_NUM_MATRICES; ++i) {
 		delete _control_allocation[i];
+		delete _control_allocation_slow[i];
 	}
 
 	delete _actuator_effectiveness;
+	delete _allocation_snapshot;
 
 	perf_free(_loop_perf);
+	perf_free(_latency_perf);
+	perf_free(_slow_path_perf);
 }
 
 bool
@@ -104,6 +126,10 @@ ControlAllocator::init()
 	ScheduleDelayed(50_ms);
 #endif
 
+	if (_slow_path) {
+		_slow_path->ScheduleOnInterval(SLOW_PATH_INTERVAL);
+	}
+
 	return true;
 }
 
@@ -133,9 +159,33 @@ ControlAllocator::parameters_updated()
 
 	for (int i = 0; i < _num_control_allocation; ++i) {
 		_control_allocation[i]->updateParameters();
+
+		if (_control_allocation_slow[i]) {
+			_control_allocation_slow[i]->updateParameters();
+		}
 	}
 
 	update_effectiveness_matrix_if_needed(EffectivenessUpdateReason::CONFIGURATION_UPDATE);
+	apply_allocation_snapshot();
+}
+
+ControlAllocation *
+ControlAllocator::create_control_allocation(AllocationMethod method)
+{
+	switch (method) {
+	case AllocationMethod::PSEUDO_INVERSE:
+		return new ControlAllocationPseudoInverse();
+
+	case AllocationMethod::SEQUENTIAL_DESATURATION:
+		return new ControlAllocationSequentialDesaturation();
+
+	case AllocationMethod::ACTIVE_SET:
+		return new ControlAllocationActiveSet();
+
+	default:
+		PX4_ERR("Unknown allocation method");
+		return nullptr;
+	}
 }
 
 void
@@ -161,6 +211,9 @@ ControlAllocator::update_allocation_method(bool force)
 
 			delete _control_allocation[i];
 			_control_allocation[i] = nullptr;
+
+			delete _control_allocation_slow[i];
+			_control_allocation_slow[i] = nullptr;
 		}
 
 		_num_control_allocation = _actuator_effectiveness->numMatrices();
@@ -178,27 +231,23 @@ ControlAllocator::update_allocation_method(bool force)
 				method = desired_methods[i];
 			}
 
-			switch (method) {
-			case AllocationMethod::PSEUDO_INVERSE:
-				_control_allocation[i] = new ControlAllocationPseudoInverse();
-				break;
+			_control_allocation[i] = create_control_allocation(method);
 
-			case AllocationMethod::SEQUENTIAL_DESATURATION:
-				_control_allocation[i] = new ControlAllocationSequentialDesaturation();
-				break;
-
-			default:
-				PX4_ERR("Unknown allocation method");
-				break;
+			if (_dual_rate) {
+				_control_allocation_slow[i] = create_control_allocation(method);
 			}
 
-			if (_control_allocation[i] == nullptr) {
+			if (_control_allocation[i] == nullptr || (_dual_rate && _control_allocation_slow[i] == nullptr)) {
 				PX4_ERR("alloc failed");
 				_num_control_allocation = 0;
 
 			} else {
 				_control_allocation[i]->setNormalizeRPY(normalize_rpy[i]);
 				_control_allocation[i]->setActuatorSetpoint(actuator_sp[i]);
+
+				if (_dual_rate) {
+					_control_allocation_slow[i]->setNormalizeRPY(normalize_rpy[i]);
+				}
 			}
 		}
 
@@ -322,6 +371,7 @@ ControlAllocator::Run()
 		if (_handled_motor_failure_bitmask == 0) {
 			// We don't update the geometry after an actuator failure, as it could lead to unexpected results
 			// (e.g. a user could add/remove motors, such that the bitmask isn't correct anymore)
+			LockGuard lg{_slow_path_mutex};
 			updateParams();
 			parameters_updated();
 		}
@@ -404,7 +454,13 @@ ControlAllocator::Run()
 
 		check_for_motor_failures();
 
-		update_effectiveness_matrix_if_needed(EffectivenessUpdateReason::NO_EXTERNAL_UPDATE);
+		if (_dual_rate) {
+			// effectiveness, normalization and pseudo-inverse are precomputed by the slow path
+			apply_allocation_snapshot();
+
+		} else {
+			update_effectiveness_matrix_if_needed(EffectivenessUpdateReason::NO_EXTERNAL_UPDATE);
+		}
 
 		// Set control setpoint vector(s)
 		matrix::Vector<float, NUM_AXES> c[ActuatorEffectiveness::MAX_NUM_MATRICES];
@@ -478,8 +534,13 @@ ControlAllocator::update_effectiveness_matrix_if_needed(EffectivenessUpdateReaso
 	if (_actuator_effectiveness->getEffectivenessMatrix(config, reason)) {
 		_last_effectiveness_update = hrt_absolute_time();
 
-		memcpy(_control_allocation_selection_indexes, config.matrix_selection_indexes,
-		       sizeof(_control_allocation_selection_indexes));
+		// in dual-rate mode the result goes into the next snapshot instead of the allocation loop
+		AllocationSnapshot *snapshot = _dual_rate ? &_allocation_snapshot->back() : nullptr;
+		ControlAllocation **control_allocation = _dual_rate ? _control_allocation_slow : _control_allocation;
+		uint8_t *selection_indexes = _dual_rate ? snapshot->selection_indexes : _control_allocation_selection_indexes;
+		int *num_actuators = _dual_rate ? snapshot->num_actuators : _num_actuators;
+
+		memcpy(selection_indexes, config.matrix_selection_indexes, sizeof(_control_allocation_selection_indexes));
 
 		// Get the minimum and maximum depending on type and configuration
 		ActuatorEffectiveness::ActuatorVector minimum[ActuatorEffectiveness::MAX_NUM_MATRICES];
@@ -492,21 +553,21 @@ ControlAllocator::update_effectiveness_matrix_if_needed(EffectivenessUpdateReaso
 		static_assert(actuator_servos_trim_s::NUM_CONTROLS == actuator_servos_s::NUM_CONTROLS, "size mismatch");
 
 		for (int actuator_type = 0; actuator_type < (int)ActuatorType::COUNT; ++actuator_type) {
-			_num_actuators[actuator_type] = config.num_actuators[actuator_type];
+			num_actuators[actuator_type] = config.num_actuators[actuator_type];
 
 			for (int actuator_type_idx = 0; actuator_type_idx < config.num_actuators[actuator_type]; ++actuator_type_idx) {
 				if (actuator_idx >= NUM_ACTUATORS) {
-					_num_actuators[actuator_type] = 0;
+					num_actuators[actuator_type] = 0;
 					PX4_ERR("Too many actuators");
 					break;
 				}
 
-				int selected_matrix = _control_allocation_selection_indexes[actuator_idx];
+				int selected_matrix = selection_indexes[actuator_idx];
 
 				if ((ActuatorType)actuator_type == ActuatorType::MOTORS) {
 					if (actuator_type_idx >= MAX_NUM_MOTORS) {
 						PX4_ERR("Too many motors");
-						_num_actuators[actuator_type] = 0;
+						num_actuators[actuator_type] = 0;
 						break;
 					}
 
@@ -522,7 +583,7 @@ ControlAllocator::update_effectiveness_matrix_if_needed(EffectivenessUpdateReaso
 				} else if ((ActuatorType)actuator_type == ActuatorType::SERVOS) {
 					if (actuator_type_idx >= MAX_NUM_SERVOS) {
 						PX4_ERR("Too many servos");
-						_num_actuators[actuator_type] = 0;
+						num_actuators[actuator_type] = 0;
 						break;
 					}
 
@@ -546,8 +607,8 @@ ControlAllocator::update_effectiveness_matrix_if_needed(EffectivenessUpdateReaso
 			actuator_idx = 0;
 			memset(&actuator_idx_matrix, 0, sizeof(actuator_idx_matrix));
 
-			for (int motors_idx = 0; motors_idx < _num_actuators[0] && motors_idx < actuator_motors_s::NUM_CONTROLS; motors_idx++) {
-				int selected_matrix = _control_allocation_selection_indexes[actuator_idx];
+			for (int motors_idx = 0; motors_idx < num_actuators[0] && motors_idx < actuator_motors_s::NUM_CONTROLS; motors_idx++) {
+				int selected_matrix = selection_indexes[actuator_idx];
 
 				if (_handled_motor_failure_bitmask & (1 << motors_idx)) {
 					ActuatorEffectiveness::EffectivenessMatrix &matrix = config.effectiveness_matrices[selected_matrix];
@@ -563,9 +624,9 @@ ControlAllocator::update_effectiveness_matrix_if_needed(EffectivenessUpdateReaso
 		}
 
 		for (int i = 0; i < _num_control_allocation; ++i) {
-			_control_allocation[i]->setActuatorMin(minimum[i]);
-			_control_allocation[i]->setActuatorMax(maximum[i]);
-			_control_allocation[i]->setSlewRateLimit(slew_rate[i]);
+			control_allocation[i]->setActuatorMin(minimum[i]);
+			control_allocation[i]->setActuatorMax(maximum[i]);
+			control_allocation[i]->setSlewRateLimit(slew_rate[i]);
 
 			// Set all the elements of a row to 0 if that row has weak authority.
 			// That ensures that the algorithm doesn't try to control axes with only marginal control authority,
@@ -589,15 +650,70 @@ ControlAllocator::update_effectiveness_matrix_if_needed(EffectivenessUpdateReaso
 
 			// Assign control effectiveness matrix
 			int total_num_actuators = config.num_actuators_matrix[i];
-			_control_allocation[i]->setEffectivenessMatrix(config.effectiveness_matrices[i], config.trim[i],
+			control_allocation[i]->setEffectivenessMatrix(config.effectiveness_matrices[i], config.trim[i],
 					config.linearization_point[i], total_num_actuators, reason == EffectivenessUpdateReason::CONFIGURATION_UPDATE);
 		}
 
 		trims.timestamp = hrt_absolute_time();
 		_actuator_servos_trim_pub.publish(trims);
+
+		if (snapshot) {
+			for (int i = 0; i < _num_control_allocation; ++i) {
+				control_allocation[i]->prepare();
+				control_allocation[i]->getConfig(snapshot->config[i]);
+			}
+
+			_allocation_snapshot->publish();
+		}
+	}
+}
+
+void
+ControlAllocator::request_effectiveness_update(EffectivenessUpdateReason reason)
+{
+	if (_dual_rate) {
+		_slow_path_update_reason.store((int)reason);
+
+	} else {
+		update_effectiveness_matrix_if_needed(reason);
 	}
 }
 
+void
+ControlAllocator::run_slow_path()
+{
+	// configuration changes hold the lock, skip this cycle
+	if (pthread_mutex_trylock(&_slow_path_mutex) != 0) {
+		return;
+	}
+
+	perf_begin(_slow_path_perf);
+
+	const int reason = _slow_path_update_reason.fetch_and(0);
+	update_effectiveness_matrix_if_needed((EffectivenessUpdateReason)reason);
+
+	perf_end(_slow_path_perf);
+
+	pthread_mutex_unlock(&_slow_path_mutex);
+}
+
+void
+ControlAllocator::apply_allocation_snapshot()
+{
+	if (!_dual_rate || !_allocation_snapshot->update()) {
+		return;
+	}
+
+	const AllocationSnapshot &snapshot = _allocation_snapshot->front();
+
+	for (int i = 0; i < _num_control_allocation; ++i) {
+		_control_allocation[i]->setConfig(snapshot.config[i]);
+	}
+
+	memcpy(_control_allocation_selection_indexes, snapshot.selection_indexes, sizeof(_control_allocation_selection_indexes));
+	memcpy(_num_actuators, snapshot.num_actuators, sizeof(_num_actuators));
+}
+
 void
 ControlAllocator::publish_control_allocator_status(int matrix_index)
 {
@@ -694,6 +810,10 @@ ControlAllocator::publish_actuator_controls()
 
 	_actuator_motors_pub.publish(actuator_motors);
 
+	if (_timestamp_sample != 0) {
+		perf_set_elapsed(_latency_perf, actuator_motors.timestamp - _timestamp_sample);
+	}
+
 	// servos
 	if (_num_actuators[1] > 0) {
 		int servos_idx;
@@ -717,29 +837,52 @@ ControlAllocator::publish_actuator_controls()
 void
 ControlAllocator::check_for_motor_failures()
 {
+	if ((FailureMode)_param_ca_failure_mode.get() <= FailureMode::IGNORE) {
+		return;
+	}
+
+	bool updated = false;
 	failure_detector_status_s failure_detector_status;
 
-	if ((FailureMode)_param_ca_failure_mode.get() > FailureMode::IGNORE
-	    && _failure_detector_status_sub.update(&failure_detector_status)) {
-		if (failure_detector_status.fd_motor) {
+	if (_failure_detector_status_sub.update(&failure_detector_status)) {
+		_reported_motor_failure_bitmask = failure_detector_status.fd_motor ? failure_detector_status.motor_failure_mask : 0;
+		updated = true;
+	}
+
+	failure_detector_high_rate_s failure_detector_high_rate;
+
+	if (_failure_detector_high_rate_sub.update(&failure_detector_high_rate)) {
+		_reported_motor_failure_high_rate_bitmask = failure_detector_high_rate.fd_motor ?
+				failure_detector_high_rate.motor_failure_mask : 0;
+		updated = true;
+	}
 
-			if (_handled_motor_failure_bitmask != failure_detector_status.motor_failure_mask) {
+	if (updated) {
+		const uint16_t motor_failure_mask = _reported_motor_failure_bitmask | _reported_motor_failure_high_rate_bitmask;
+
+		if (motor_failure_mask != 0) {
+
+			if (_handled_motor_failure_bitmask != motor_failure_mask) {
 				// motor failure bitmask changed
 				switch ((FailureMode)_param_ca_failure_mode.get()) {
 				case FailureMode::REMOVE_FIRST_FAILING_MOTOR: {
 						// Count number of failed motors
-						const int num_motors_failed = math::countSetBits(failure_detector_status.motor_failure_mask);
+						const int num_motors_failed = math::countSetBits(motor_failure_mask);
 
 						// Only handle if it is the first failure
 						if (_handled_motor_failure_bitmask == 0 && num_motors_failed == 1) {
-							_handled_motor_failure_bitmask = failure_detector_status.motor_failure_mask;
+							_handled_motor_failure_bitmask = motor_failure_mask;
 							PX4_WARN("Removing motor from allocation (0x%x)", _handled_motor_failure_bitmask);
 
 							for (int i = 0; i < _num_control_allocation; ++i) {
 								_control_allocation[i]->setHadActuatorFailure(true);
+
+								if (_control_allocation_slow[i]) {
+									_control_allocation_slow[i]->setHadActuatorFailure(true);
+								}
 							}
 
-							update_effectiveness_matrix_if_needed(EffectivenessUpdateReason::MOTOR_ACTIVATION_UPDATE);
+							request_effectiveness_update(EffectivenessUpdateReason::MOTOR_ACTIVATION_UPDATE);
 						}
 					}
 					break;
@@ -757,9 +900,13 @@ ControlAllocator::check_for_motor_failures()
 
 			for (int i = 0; i < _num_control_allocation; ++i) {
 				_control_allocation[i]->setHadActuatorFailure(false);
+
+				if (_control_allocation_slow[i]) {
+					_control_allocation_slow[i]->setHadActuatorFailure(false);
+				}
 			}
 
-			update_effectiveness_matrix_if_needed(EffectivenessUpdateReason::MOTOR_ACTIVATION_UPDATE);
+			request_effectiveness_update(EffectivenessUpdateReason::MOTOR_ACTIVATION_UPDATE);
 		}
 	}
 }
@@ -808,6 +955,10 @@ int ControlAllocator::print_status()
 	case AllocationMethod::AUTO:
 		PX4_INFO("Method: Auto");
 		break;
+
+	case AllocationMethod::ACTIVE_SET:
+		PX4_INFO("Method: Active-set");
+		break;
 	}
 
 	// Print current airframe
@@ -840,6 +991,11 @@ int ControlAllocator::print_status()
 	// Print perf
 	perf_print_counter(_loop_perf);
 
+	if (_dual_rate) {
+		PX4_INFO("Dual-rate: slow path every %i ms", (int)(SLOW_PATH_INTERVAL / 1000));
+		perf_print_counter(_slow_path_perf);
+	}
+
 	return 0;
 }
 
@@ -55,11 +55,15 @@
 #include <ActuatorEffectivenessHelicopterCoaxial.hpp>
 
 #include <ControlAllocation.hpp>
+#include <ControlAllocationActiveSet.hpp>
 #include <ControlAllocationPseudoInverse.hpp>
 #include <ControlAllocationSequentialDesaturation.hpp>
 
+#include <containers/LockGuard.hpp>
+#include <containers/TripleBuffer.hpp>
 #include <lib/matrix/matrix/math.hpp>
 #include <lib/perf/perf_counter.h>
+#include <px4_platform_common/atomic.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/module_params.h>
@@ -77,6 +81,7 @@
 #include <uORB/topics/vehicle_torque_setpoint.h>
 #include <uORB/topics/vehicle_thrust_setpoint.h>
 #include <uORB/topics/vehicle_status.h>
+#include <uORB/topics/failure_detector_high_rate.h>
 #include <uORB/topics/failure_detector_status.h>
 
 class ControlAllocator : public ModuleBase<ControlAllocator>, public ModuleParams, public px4::ScheduledWorkItem
@@ -122,6 +127,33 @@ private:
 		float slew_rate_servos[MAX_NUM_SERVOS];
 	};
 
+	/**
+	 * Slow path of the dual-rate mode (CA_DUAL_RATE): updates the effectiveness matrices,
+	 * normalization and pseudo-inverses on a lower priority work queue.
+	 */
+	class SlowPath : public px4::ScheduledWorkItem
+	{
+	public:
+		explicit SlowPath(ControlAllocator &control_allocator) :
+			ScheduledWorkItem(MODULE_NAME"_slow", px4::wq_configurations::nav_and_controllers),
+			_control_allocator(control_allocator)
+		{}
+
+	private:
+		void Run() override { _control_allocator.run_slow_path(); }
+
+		ControlAllocator &_control_allocator;
+	};
+
+	// Precomputed allocation handed from the slow path to the fast path (dual-rate)
+	struct AllocationSnapshot {
+		ControlAllocation::Config config[ActuatorEffectiveness::MAX_NUM_MATRICES];
+		uint8_t selection_indexes[NUM_ACTUATORS * ActuatorEffectiveness::MAX_NUM_MATRICES];
+		int num_actuators[(int)ActuatorType::COUNT];
+	};
+
+	static constexpr hrt_abstime SLOW_PATH_INTERVAL = 20_ms;
+
 	/**
 	 * initialize some vectors/matrices from parameters
 	 */
@@ -132,6 +164,20 @@ private:
 
 	void update_effectiveness_matrix_if_needed(EffectivenessUpdateReason reason);
 
+	/**
+	 * Update the effectiveness matrix immediately, or on the next slow path cycle in dual-rate mode
+	 */
+	void request_effectiveness_update(EffectivenessUpdateReason reason);
+
+	void run_slow_path();
+
+	/**
+	 * Take the latest precomputed allocation of the slow path (dual-rate)
+	 */
+	void apply_allocation_snapshot();
+
+	static ControlAllocation *create_control_allocation(AllocationMethod method);
+
 	void check_for_motor_failures();
 
 	void publish_control_allocator_status(int matrix_index);
@@ -140,6 +186,7 @@ private:
 
 	AllocationMethod _allocation_method_id{AllocationMethod::NONE};
 	ControlAllocation *_control_allocation[ActuatorEffectiveness::MAX_NUM_MATRICES] {}; 	///< class for control allocation calculations
+	ControlAllocation *_control_allocation_slow[ActuatorEffectiveness::MAX_NUM_MATRICES] {}; 	///< slow path instances (dual-rate)
 	int _num_control_allocation{0};
 	hrt_abstime _last_effectiveness_update{0};
 
@@ -190,6 +237,7 @@ private:
 	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
 	uORB::Subscription _vehicle_control_mode_sub{ORB_ID(vehicle_control_mode)};
 	uORB::Subscription _failure_detector_status_sub{ORB_ID(failure_detector_status)};
+	uORB::Subscription _failure_detector_high_rate_sub{ORB_ID(failure_detector_high_rate)};
 
 	matrix::Vector3f _torque_sp;
 	matrix::Vector3f _thrust_sp;
@@ -199,7 +247,20 @@ private:
 	// For example, the system might report two motor failures, but only the first one is handled by CA
 	uint16_t _handled_motor_failure_bitmask{0};
 
+	// Reported motor failures, the high-rate stage is read directly to skip the commander latency
+	uint16_t _reported_motor_failure_bitmask{0};
+	uint16_t _reported_motor_failure_high_rate_bitmask{0};
+
 	perf_counter_t	_loop_perf;			/**< loop duration performance counter */
+	perf_counter_t	_latency_perf;			/**< sensor sample to actuator_motors latency */
+
+	// dual-rate mode
+	bool _dual_rate{false};
+	SlowPath *_slow_path{nullptr};
+	TripleBuffer<AllocationSnapshot> *_allocation_snapshot{nullptr};
+	pthread_mutex_t _slow_path_mutex = PTHREAD_MUTEX_INITIALIZER; ///< serializes the slow path and configuration changes
+	px4::atomic_int _slow_path_update_reason{(int)EffectivenessUpdateReason::NO_EXTERNAL_UPDATE};
+	perf_counter_t _slow_path_perf{nullptr};
 
 	bool _armed{false};
 	hrt_abstime _last_run{0};
@@ -214,7 +275,8 @@ private:
 		(ParamInt<px4::params::CA_AIRFRAME>) _param_ca_airframe,
 		(ParamInt<px4::params::CA_METHOD>) _param_ca_method,
 		(ParamInt<px4::params::CA_FAILURE_MODE>) _param_ca_failure_mode,
-		(ParamInt<px4::params::CA_R_REV>) _param_r_rev
+		(ParamInt<px4::params::CA_R_REV>) _param_r_rev,
+		(ParamBool<px4::params::CA_DUAL_RATE>) _param_ca_dual_rate
 	)
 
 };
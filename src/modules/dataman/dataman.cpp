@@ -49,6 +49,7 @@
 #include <px4_platform_common/getopt.h>
 #include <drivers/drv_hrt.h>
 #include <lib/parameters/param.h>
+#include <lib/mathlib/mathlib.h>
 #include <lib/perf/perf_counter.h>
 #include <stdlib.h>
 
@@ -59,6 +60,13 @@
 
 #include "dataman.h"
 
+#if defined(__PX4_POSIX)
+#include <dataman_client/DatamanClient.hpp>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 __BEGIN_DECLS
 __EXPORT int dataman_main(int argc, char *argv[]);
 __END_DECLS
@@ -69,6 +77,8 @@ static constexpr int TASK_STACK_SIZE = 1420;
 static ssize_t _file_write(dm_item_t item, unsigned index, const void *buf, size_t count);
 static ssize_t _file_read(dm_item_t item, unsigned index, void *buf, size_t count);
 static int  _file_clear(dm_item_t item);
+static ssize_t _file_write_batch(dm_item_t item, unsigned index, unsigned num_items, const uint8_t *buf, size_t count);
+static ssize_t _file_read_batch(dm_item_t item, unsigned index, unsigned num_items, uint8_t *buf, size_t count);
 static int _file_initialize(unsigned max_offset);
 static void _file_shutdown();
 
@@ -76,13 +86,30 @@ static void _file_shutdown();
 static ssize_t _ram_write(dm_item_t item, unsigned index, const void *buf, size_t count);
 static ssize_t _ram_read(dm_item_t item, unsigned index, void *buf, size_t count);
 static int  _ram_clear(dm_item_t item);
+static ssize_t _ram_write_batch(dm_item_t item, unsigned index, unsigned num_items, const uint8_t *buf, size_t count);
+static ssize_t _ram_read_batch(dm_item_t item, unsigned index, unsigned num_items, uint8_t *buf, size_t count);
 static int _ram_initialize(unsigned max_offset);
 static void _ram_shutdown();
 
+#if defined(__PX4_POSIX)
+/* Private memory mapped file Operations */
+static ssize_t _mmap_write(dm_item_t item, unsigned index, const void *buf, size_t count);
+static ssize_t _mmap_read(dm_item_t item, unsigned index, void *buf, size_t count);
+static int  _mmap_clear(dm_item_t item);
+static ssize_t _mmap_write_batch(dm_item_t item, unsigned index, unsigned num_items, const uint8_t *buf, size_t count);
+static ssize_t _mmap_read_batch(dm_item_t item, unsigned index, unsigned num_items, uint8_t *buf, size_t count);
+static int _mmap_initialize(unsigned max_offset);
+static void _mmap_shutdown();
+#endif
+
 typedef struct dm_operations_t {
 	ssize_t (*write)(dm_item_t item, unsigned index, const void *buf, size_t count);
 	ssize_t (*read)(dm_item_t item, unsigned index, void *buf, size_t count);
 	int (*clear)(dm_item_t item);
+	/* Batch operations on num_items consecutive indexes, buf holds num_items items of count bytes each.
+	 * Return the number of items processed, < 0 on error */
+	ssize_t (*write_batch)(dm_item_t item, unsigned index, unsigned num_items, const uint8_t *buf, size_t count);
+	ssize_t (*read_batch)(dm_item_t item, unsigned index, unsigned num_items, uint8_t *buf, size_t count);
 	int (*initialize)(unsigned max_offset);
 	void (*shutdown)();
 	int (*wait)(px4_sem_t *sem);
@@ -92,6 +119,8 @@ static constexpr dm_operations_t dm_file_operations = {
 	.write   = _file_write,
 	.read    = _file_read,
 	.clear   = _file_clear,
+	.write_batch = _file_write_batch,
+	.read_batch = _file_read_batch,
 	.initialize = _file_initialize,
 	.shutdown = _file_shutdown,
 	.wait = px4_sem_wait,
@@ -101,11 +130,26 @@ static constexpr dm_operations_t dm_ram_operations = {
 	.write   = _ram_write,
 	.read    = _ram_read,
 	.clear   = _ram_clear,
+	.write_batch = _ram_write_batch,
+	.read_batch = _ram_read_batch,
 	.initialize = _ram_initialize,
 	.shutdown = _ram_shutdown,
 	.wait = px4_sem_wait,
 };
 
+#if defined(__PX4_POSIX)
+static constexpr dm_operations_t dm_mmap_operations = {
+	.write   = _mmap_write,
+	.read    = _mmap_read,
+	.clear   = _mmap_clear,
+	.write_batch = _mmap_write_batch,
+	.read_batch = _mmap_read_batch,
+	.initialize = _mmap_initialize,
+	.shutdown = _mmap_shutdown,
+	.wait = px4_sem_wait,
+};
+#endif
+
 static const dm_operations_t *g_dm_ops;
 
 static struct {
@@ -116,6 +160,9 @@ static struct {
 		struct {
 			uint8_t *data;
 			uint8_t *data_end;
+			int fd; // backing file of the memory mapped backend
+			size_t size;
+			hrt_abstime dirty_time; // first write that was not synced yet, 0 if synced
 		} ram;
 	};
 	bool running;
@@ -141,6 +188,15 @@ static constexpr size_t g_per_item_size_with_hdr[DM_KEY_NUM_KEYS] = {
 	g_per_item_size[DM_KEY_COMPAT] + DM_SECTOR_HDR_SIZE
 };
 
+/* Buffer to read or write a range of items with a single file access */
+#if defined(MEMORY_CONSTRAINED_SYSTEM)
+static constexpr size_t DM_BATCH_BUFFER_SIZE = 512;
+#else
+static constexpr size_t DM_BATCH_BUFFER_SIZE = 4096;
+#endif
+
+static uint8_t g_batch_buffer[DM_BATCH_BUFFER_SIZE];
+
 /* Table of offset for index 0 of each item type */
 static unsigned int g_key_offsets[DM_KEY_NUM_KEYS];
 
@@ -190,6 +246,25 @@ calculate_offset(dm_item_t item, unsigned index)
 	return g_key_offsets[item] + (index * g_per_item_size_with_hdr[item]);
 }
 
+/* Calculate the offset in file of the first item of a range of items */
+static int
+calculate_batch_offset(dm_item_t item, unsigned index, unsigned num_items, size_t count)
+{
+	const int offset = calculate_offset(item, index);
+
+	/* Make sure the whole range is valid */
+	if ((offset < 0) || (num_items == 0) || (num_items > g_per_item_max_index[item] - index)) {
+		return -1;
+	}
+
+	/* Make sure the caller does not use larger items than we can handle */
+	if (count > (g_per_item_size_with_hdr[item] - DM_SECTOR_HDR_SIZE)) {
+		return -E2BIG;
+	}
+
+	return offset;
+}
+
 /* Each data item is stored as follows
  *
  * byte 0: Length of user data item
@@ -529,27 +604,10 @@ _file_clear(dm_item_t item)
 	return result;
 }
 
-static int
-_file_initialize(unsigned max_offset)
+/* Reset the content if the storage is new or has an incompatible layout */
+static void
+initialize_content(bool file_existed)
 {
-	const bool file_existed = (access(k_data_manager_device_path, F_OK) == 0);
-
-	/* Open or create the data manager file */
-	dm_operations_data.file.fd = open(k_data_manager_device_path, O_RDWR | O_CREAT | O_BINARY, PX4_O_MODE_666);
-
-	if (dm_operations_data.file.fd < 0) {
-		PX4_WARN("Could not open data manager file %s", k_data_manager_device_path);
-		px4_sem_post(&g_init_sema); /* Don't want to hang startup */
-		return -1;
-	}
-
-	if ((unsigned)lseek(dm_operations_data.file.fd, max_offset, SEEK_SET) != max_offset) {
-		close(dm_operations_data.file.fd);
-		PX4_WARN("Could not seek data manager file %s", k_data_manager_device_path);
-		px4_sem_post(&g_init_sema); /* Don't want to hang startup */
-		return -1;
-	}
-
 	dataman_compat_s compat_state{};
 
 	dm_operations_data.silence = true;
@@ -589,6 +647,174 @@ _file_initialize(unsigned max_offset)
 		g_dm_ops->write(DM_KEY_FENCE_POINTS_STATE, 0, reinterpret_cast<uint8_t *>(&stats), sizeof(mission_stats_entry_s));
 		g_dm_ops->write(DM_KEY_SAFE_POINTS_STATE, 0, reinterpret_cast<uint8_t *>(&stats), sizeof(mission_stats_entry_s));
 	}
+}
+
+/* write a range of items to the data manager RAM buffer */
+static ssize_t _ram_write_batch(dm_item_t item, unsigned index, unsigned num_items, const uint8_t *buf, size_t count)
+{
+	const int offset = calculate_batch_offset(item, index, num_items, count);
+
+	if (offset < 0) {
+		return offset;
+	}
+
+	for (unsigned i = 0; i < num_items; i++) {
+		if (_ram_write(item, index + i, &buf[i * count], count) < 0) {
+			return -1;
+		}
+	}
+
+	return num_items;
+}
+
+/* Retrieve a range of items from the data manager RAM buffer */
+static ssize_t _ram_read_batch(dm_item_t item, unsigned index, unsigned num_items, uint8_t *buf, size_t count)
+{
+	const int offset = calculate_batch_offset(item, index, num_items, count);
+
+	if (offset < 0) {
+		return offset;
+	}
+
+	for (unsigned i = 0; i < num_items; i++) {
+		/* empty entries read as zero */
+		memset(&buf[i * count], 0, count);
+
+		if (_ram_read(item, index + i, &buf[i * count], count) < 0) {
+			return -1;
+		}
+	}
+
+	return num_items;
+}
+
+/* write a range of items to the data manager file, in chunks of DM_BATCH_BUFFER_SIZE */
+static ssize_t
+_file_write_batch(dm_item_t item, unsigned index, unsigned num_items, const uint8_t *buf, size_t count)
+{
+	const int offset = calculate_batch_offset(item, index, num_items, count);
+
+	if (offset < 0) {
+		return offset;
+	}
+
+	const size_t item_size = g_per_item_size_with_hdr[item];
+	const unsigned items_per_chunk = DM_BATCH_BUFFER_SIZE / item_size;
+	unsigned items_written = 0;
+
+	while (items_written < num_items) {
+		const unsigned chunk_items = math::min(items_per_chunk, num_items - items_written);
+
+		/* Lay out the items like the file, each prefixed with its length */
+		for (unsigned i = 0; i < chunk_items; i++) {
+			uint8_t *buffer = &g_batch_buffer[i * item_size];
+			buffer[0] = count;
+			buffer[1] = 0;
+			buffer[2] = 0;
+			buffer[3] = 0;
+			memcpy(buffer + DM_SECTOR_HDR_SIZE, &buf[(items_written + i) * count], count);
+			memset(buffer + DM_SECTOR_HDR_SIZE + count, 0, item_size - DM_SECTOR_HDR_SIZE - count);
+		}
+
+		const int chunk_offset = offset + items_written * item_size;
+		const ssize_t chunk_size = chunk_items * item_size;
+
+		if (lseek(dm_operations_data.file.fd, chunk_offset, SEEK_SET) != chunk_offset) {
+			PX4_ERR("file batch write lseek failed %d", errno);
+			break;
+		}
+
+		const ssize_t ret_write = write(dm_operations_data.file.fd, g_batch_buffer, chunk_size);
+
+		if (ret_write != chunk_size) {
+			PX4_ERR("file batch write failed, wrote %zd bytes, expected %zd", ret_write, chunk_size);
+			break;
+		}
+
+		items_written += chunk_items;
+	}
+
+	/* Make sure data is written to physical media, once for the whole range */
+	fsync(dm_operations_data.file.fd);
+
+	return (items_written == num_items) ? (ssize_t)num_items : -1;
+}
+
+/* Retrieve a range of items from the data manager file, in chunks of DM_BATCH_BUFFER_SIZE */
+static ssize_t
+_file_read_batch(dm_item_t item, unsigned index, unsigned num_items, uint8_t *buf, size_t count)
+{
+	const int offset = calculate_batch_offset(item, index, num_items, count);
+
+	if (offset < 0) {
+		return offset;
+	}
+
+	const size_t item_size = g_per_item_size_with_hdr[item];
+	const unsigned items_per_chunk = DM_BATCH_BUFFER_SIZE / item_size;
+	unsigned items_read = 0;
+
+	while (items_read < num_items) {
+		const unsigned chunk_items = math::min(items_per_chunk, num_items - items_read);
+		const int chunk_offset = offset + items_read * item_size;
+		const size_t chunk_size = chunk_items * item_size;
+
+		if (lseek(dm_operations_data.file.fd, chunk_offset, SEEK_SET) != chunk_offset) {
+			PX4_ERR("file batch read lseek failed %d", errno);
+			return -1;
+		}
+
+		const ssize_t len = read(dm_operations_data.file.fd, g_batch_buffer, chunk_size);
+
+		if (len < 0) {
+			PX4_ERR("file batch read failed %d", errno);
+			return -1;
+		}
+
+		/* Items beyond the end of the file are empty */
+		memset(&g_batch_buffer[len], 0, chunk_size - len);
+
+		for (unsigned i = 0; i < chunk_items; i++) {
+			const uint8_t *buffer = &g_batch_buffer[i * item_size];
+			uint8_t *item_buf = &buf[(items_read + i) * count];
+
+			/* We got more than requested!!! */
+			if (buffer[0] > count) {
+				return -1;
+			}
+
+			memset(item_buf, 0, count);
+			memcpy(item_buf, buffer + DM_SECTOR_HDR_SIZE, buffer[0]);
+		}
+
+		items_read += chunk_items;
+	}
+
+	return num_items;
+}
+
+static int
+_file_initialize(unsigned max_offset)
+{
+	const bool file_existed = (access(k_data_manager_device_path, F_OK) == 0);
+
+	/* Open or create the data manager file */
+	dm_operations_data.file.fd = open(k_data_manager_device_path, O_RDWR | O_CREAT | O_BINARY, PX4_O_MODE_666);
+
+	if (dm_operations_data.file.fd < 0) {
+		PX4_WARN("Could not open data manager file %s", k_data_manager_device_path);
+		px4_sem_post(&g_init_sema); /* Don't want to hang startup */
+		return -1;
+	}
+
+	if ((unsigned)lseek(dm_operations_data.file.fd, max_offset, SEEK_SET) != max_offset) {
+		close(dm_operations_data.file.fd);
+		PX4_WARN("Could not seek data manager file %s", k_data_manager_device_path);
+		px4_sem_post(&g_init_sema); /* Don't want to hang startup */
+		return -1;
+	}
+
+	initialize_content(file_existed);
 
 	dm_operations_data.running = true;
 
@@ -628,13 +854,171 @@ _ram_shutdown()
 	dm_operations_data.running = false;
 }
 
+#if defined(__PX4_POSIX)
+
+/* Sync the memory mapped file after this time, or when there are no more requests */
+static constexpr hrt_abstime MMAP_SYNC_INTERVAL = 200_ms;
+
+/* Protects the mapping against the direct reads of the clients */
+static pthread_rwlock_t g_mmap_lock = PTHREAD_RWLOCK_INITIALIZER;
+
+static void _mmap_mark_dirty()
+{
+	if (dm_operations_data.ram.dirty_time == 0) {
+		dm_operations_data.ram.dirty_time = hrt_absolute_time();
+	}
+}
+
+/* Write dirty pages of the mapping to the file */
+static void _mmap_sync(bool force)
+{
+	if ((dm_operations_data.ram.dirty_time != 0)
+	    && (force || (hrt_elapsed_time(&dm_operations_data.ram.dirty_time) > MMAP_SYNC_INTERVAL))) {
+
+		if (msync(dm_operations_data.ram.data, dm_operations_data.ram.size, MS_SYNC) != 0) {
+			PX4_ERR("msync failed %d", errno);
+		}
+
+		dm_operations_data.ram.dirty_time = 0;
+	}
+}
+
+static ssize_t _mmap_write(dm_item_t item, unsigned index, const void *buf, size_t count)
+{
+	pthread_rwlock_wrlock(&g_mmap_lock);
+	const ssize_t ret = _ram_write(item, index, buf, count);
+	pthread_rwlock_unlock(&g_mmap_lock);
+
+	if (ret >= 0) {
+		_mmap_mark_dirty();
+	}
+
+	return ret;
+}
+
+static ssize_t _mmap_read(dm_item_t item, unsigned index, void *buf, size_t count)
+{
+	// only the dataman task modifies the mapping, so it can read without the lock
+	return _ram_read(item, index, buf, count);
+}
+
+/* Called by the DatamanClients from their own thread */
+static ssize_t _mmap_direct_read(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length)
+{
+	ssize_t ret = -1;
+	pthread_rwlock_rdlock(&g_mmap_lock);
+
+	if (dm_operations_data.running) {
+		ret = _ram_read(item, index, buffer, length);
+	}
+
+	pthread_rwlock_unlock(&g_mmap_lock);
+	return ret;
+}
+
+static ssize_t _mmap_write_batch(dm_item_t item, unsigned index, unsigned num_items, const uint8_t *buf, size_t count)
+{
+	pthread_rwlock_wrlock(&g_mmap_lock);
+	const ssize_t ret = _ram_write_batch(item, index, num_items, buf, count);
+	pthread_rwlock_unlock(&g_mmap_lock);
+
+	if (ret >= 0) {
+		_mmap_mark_dirty();
+	}
+
+	return ret;
+}
+
+static ssize_t _mmap_read_batch(dm_item_t item, unsigned index, unsigned num_items, uint8_t *buf, size_t count)
+{
+	return _ram_read_batch(item, index, num_items, buf, count);
+}
+
+static int  _mmap_clear(dm_item_t item)
+{
+	pthread_rwlock_wrlock(&g_mmap_lock);
+	const int ret = _ram_clear(item);
+	pthread_rwlock_unlock(&g_mmap_lock);
+
+	_mmap_mark_dirty();
+	return ret;
+}
+
+static int
+_mmap_initialize(unsigned max_offset)
+{
+	const bool file_existed = (access(k_data_manager_device_path, F_OK) == 0);
+
+	/* Same layout as the file backend, so both can use the same file */
+	dm_operations_data.ram.fd = open(k_data_manager_device_path, O_RDWR | O_CREAT | O_BINARY, PX4_O_MODE_666);
+
+	if (dm_operations_data.ram.fd < 0) {
+		PX4_WARN("Could not open data manager file %s", k_data_manager_device_path);
+		px4_sem_post(&g_init_sema); /* Don't want to hang startup */
+		return -1;
+	}
+
+	struct stat st {};
+
+	if ((fstat(dm_operations_data.ram.fd, &st) != 0)
+	    || ((st.st_size < (off_t)max_offset) && (ftruncate(dm_operations_data.ram.fd, max_offset) != 0))) {
+		close(dm_operations_data.ram.fd);
+		PX4_WARN("Could not resize data manager file %s", k_data_manager_device_path);
+		px4_sem_post(&g_init_sema); /* Don't want to hang startup */
+		return -1;
+	}
+
+	void *data = mmap(nullptr, max_offset, PROT_READ | PROT_WRITE, MAP_SHARED, dm_operations_data.ram.fd, 0);
+
+	if (data == MAP_FAILED) {
+		close(dm_operations_data.ram.fd);
+		PX4_WARN("Could not map data manager file %s (%d)", k_data_manager_device_path, errno);
+		px4_sem_post(&g_init_sema); /* Don't want to hang startup */
+		return -1;
+	}
+
+	dm_operations_data.ram.data = (uint8_t *)data;
+	dm_operations_data.ram.data_end = &dm_operations_data.ram.data[max_offset - 1];
+	dm_operations_data.ram.size = max_offset;
+	dm_operations_data.ram.dirty_time = 0;
+
+	initialize_content(file_existed);
+
+	_mmap_sync(true);
+
+	dm_operations_data.running = true;
+	DatamanClient::setDirectRead(_mmap_direct_read);
+
+	return 0;
+}
+
+static void
+_mmap_shutdown()
+{
+	DatamanClient::setDirectRead(nullptr);
+
+	pthread_rwlock_wrlock(&g_mmap_lock);
+	_mmap_sync(true);
+	munmap(dm_operations_data.ram.data, dm_operations_data.ram.size);
+	close(dm_operations_data.ram.fd);
+	dm_operations_data.running = false;
+	pthread_rwlock_unlock(&g_mmap_lock);
+}
+
+#endif // __PX4_POSIX
+
 static int
 task_main(int argc, char *argv[])
 {
 	/* Dataman can use disk or RAM */
 	switch (backend) {
 	case BACKEND_FILE:
+#if defined(__PX4_POSIX)
+		/* reads are served from the mapping, writes are synced in the background */
+		g_dm_ops = &dm_mmap_operations;
+#else
 		g_dm_ops = &dm_file_operations;
+#endif
 		break;
 
 	case BACKEND_RAM:
@@ -703,7 +1087,28 @@ task_main(int argc, char *argv[])
 	/* Start the endless loop, waiting for then processing work requests */
 	while (true) {
 
-		ret = px4_poll(&fds, 1, 1000);
+		int timeout_ms = 1000;
+
+#if defined(__PX4_POSIX)
+		const bool mmap_dirty = (g_dm_ops == &dm_mmap_operations) && (dm_operations_data.ram.dirty_time != 0);
+
+		if (mmap_dirty) {
+			/* wake up in time to sync the written items */
+			timeout_ms = 50;
+		}
+
+#endif
+
+		ret = px4_poll(&fds, 1, timeout_ms);
+
+#if defined(__PX4_POSIX)
+
+		if (mmap_dirty) {
+			/* sync once there are no more requests, but don't delay it forever under load */
+			_mmap_sync(ret == 0);
+		}
+
+#endif
 
 		if (ret > 0) {
 
@@ -788,6 +1193,52 @@ task_main(int argc, char *argv[])
 
 					break;
 
+				case DM_WRITE_BATCH:
+
+					g_func_counts[DM_WRITE_BATCH]++;
+					perf_begin(_dm_write_perf);
+					result = -1;
+
+					if ((request.buffer != 0) && (hrt_absolute_time() < request.deadline)) {
+						result = g_dm_ops->write_batch(static_cast<dm_item_t>(request.item), request.index, request.count,
+									       reinterpret_cast<const uint8_t *>(static_cast<uintptr_t>(request.buffer)), request.data_length);
+					}
+
+					perf_end(_dm_write_perf);
+
+					if (result >= 0) {
+						response.status = dataman_response_s::STATUS_SUCCESS;
+						response.count = result;
+
+					} else {
+						response.status = dataman_response_s::STATUS_FAILURE_WRITE_FAILED;
+					}
+
+					break;
+
+				case DM_READ_BATCH:
+
+					g_func_counts[DM_READ_BATCH]++;
+					perf_begin(_dm_read_perf);
+					result = -1;
+
+					if ((request.buffer != 0) && (hrt_absolute_time() < request.deadline)) {
+						result = g_dm_ops->read_batch(static_cast<dm_item_t>(request.item), request.index, request.count,
+									      reinterpret_cast<uint8_t *>(static_cast<uintptr_t>(request.buffer)), request.data_length);
+					}
+
+					perf_end(_dm_read_perf);
+
+					if (result >= 0) {
+						response.status = dataman_response_s::STATUS_SUCCESS;
+						response.count = result;
+
+					} else {
+						response.status = dataman_response_s::STATUS_FAILURE_READ_FAILED;
+					}
+
+					break;
+
 				default:
 					break;
 
@@ -852,6 +1303,8 @@ status()
 	PX4_INFO("Writes   %u", g_func_counts[DM_WRITE]);
 	PX4_INFO("Reads    %u", g_func_counts[DM_READ]);
 	PX4_INFO("Clears   %u", g_func_counts[DM_CLEAR]);
+	PX4_INFO("Batch writes %u", g_func_counts[DM_WRITE_BATCH]);
+	PX4_INFO("Batch reads  %u", g_func_counts[DM_READ_BATCH]);
 
 	perf_print_counter(_dm_read_perf);
 	perf_print_counter(_dm_write_perf);
@@ -881,6 +1334,10 @@ Each type has a specific type and a fixed maximum amount of storage items, so th
 ### Implementation
 Reading and writing a single item is always atomic.
 
+On POSIX the file backend maps the file into memory. Clients read items directly from the
+mapping without a round trip through the dataman task, and writes are synced to the file in
+the background (once idle, at the latest after 200 ms).
+
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("dataman", "system");
@@ -63,6 +63,8 @@ typedef enum {
 	DM_WRITE,			///< Write index for given item
 	DM_READ,			///< Read index for given item
 	DM_CLEAR,			///< Clear all index for given item
+	DM_READ_BATCH,		///< Read a range of consecutive indexes for given item
+	DM_WRITE_BATCH,		///< Write a range of consecutive indexes for given item
 	DM_NUMBER_OF_FUNCS
 } dm_function_t;
 
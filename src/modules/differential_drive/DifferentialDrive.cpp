@@ -42,7 +42,23 @@ DifferentialDrive::DifferentialDrive() :
 
 bool DifferentialDrive::init()
 {
-	ScheduleOnInterval(10_ms); // 100 Hz
+	// run on estimator updates instead of a fixed interval to minimize the control latency
+	_vehicle_angular_velocity_sub.set_interval_us(CONTROL_INTERVAL_MIN);
+
+	if (!_vehicle_angular_velocity_sub.registerCallback()) {
+		PX4_ERR("callback registration failed");
+		return false;
+	}
+
+	if (!_vehicle_local_position_sub.registerCallback()) {
+		PX4_ERR("callback registration failed");
+		return false;
+	}
+
+#ifndef ENABLE_LOCKSTEP_SCHEDULER // Backup schedule would interfere with lockstep
+	ScheduleDelayed(CONTROL_INTERVAL_BACKUP);
+#endif
+
 	return true;
 }
 
@@ -64,11 +80,24 @@ void DifferentialDrive::updateParams()
 void DifferentialDrive::Run()
 {
 	if (should_exit()) {
+		_vehicle_angular_velocity_sub.unregisterCallback();
+		_vehicle_local_position_sub.unregisterCallback();
 		ScheduleClear();
 		exit_and_cleanup();
 		return;
 	}
 
+#ifndef ENABLE_LOCKSTEP_SCHEDULER // Backup schedule would interfere with lockstep
+	ScheduleDelayed(CONTROL_INTERVAL_BACKUP);
+#endif
+
+	// clear the trigger updates, control and guidance copy the latest data themselves
+	vehicle_angular_velocity_s vehicle_angular_velocity;
+	_vehicle_angular_velocity_sub.update(&vehicle_angular_velocity);
+
+	vehicle_local_position_s vehicle_local_position;
+	_vehicle_local_position_sub.update(&vehicle_local_position);
+
 	hrt_abstime now = hrt_absolute_time();
 	const float dt = math::min((now - _time_stamp_last), 5000_ms) / 1e6f;
 	_time_stamp_last = now;
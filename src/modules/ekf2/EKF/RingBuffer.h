@@ -119,38 +119,49 @@ public:
 
 	bool pop_first_older_than(const uint64_t &timestamp, data_type *sample)
 	{
-		// start looking from newest observation data
-		for (uint8_t i = 0; i < _size; i++) {
-			int index = (_head - i);
-			index = index < 0 ? _size + index : index;
+		if (_first_write) {
+			// empty
+			return false;
+		}
 
-			if (timestamp >= _buffer[index].time_us && timestamp < _buffer[index].time_us + (uint64_t)1e5) {
-				*sample = _buffer[index];
+		// samples are pushed in chronological order, so start looking from the oldest
+		// observation data and stop at the first one newer than the requested timestamp.
+		// Every sample skipped here is removed by the pop, which makes the lookup O(1)
+		// amortized instead of scanning the whole buffer from the head on every call.
+		int match = -1;
+		uint8_t index = _tail;
 
-				// Now we can set the tail to the item which
-				// comes after the one we removed since we don't
-				// want to have any older data in the buffer
-				if (index == _head) {
-					_tail = _head;
-					_first_write = true;
+		while (timestamp >= _buffer[index].time_us) {
+			match = index;
 
-				} else {
-					_tail = (index + 1) % _size;
-				}
+			if (index == _head) {
+				break;
+			}
 
-				_buffer[index].time_us = 0;
+			index = (index + 1) % _size;
+		}
 
-				return true;
-			}
+		if ((match < 0) || (timestamp >= _buffer[match].time_us + (uint64_t)1e5)) {
+			// no sample older than timestamp, or the newest one is too old
+			return false;
+		}
 
-			if (index == _tail) {
-				// we have reached the tail and haven't got a
-				// match
-				return false;
-			}
+		*sample = _buffer[match];
+
+		// Now we can set the tail to the item which
+		// comes after the one we removed since we don't
+		// want to have any older data in the buffer
+		if (match == _head) {
+			_tail = _head;
+			_first_write = true;
+
+		} else {
+			_tail = (match + 1) % _size;
 		}
 
-		return false;
+		_buffer[match].time_us = 0;
+
+		return true;
 	}
 
 	int get_used_size() const { return sizeof(*this) + sizeof(data_type) * entries(); }
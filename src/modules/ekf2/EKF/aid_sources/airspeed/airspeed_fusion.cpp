@@ -207,7 +207,11 @@ void Ekf::fuseAirspeed(const airspeedSample &airspeed_sample, estimator_aid_sour
 		K.slice<State::wind_vel.dof, 1>(State::wind_vel.idx, 0) = K_wind;
 	}
 
-	const bool is_fused = measurementUpdate(K, H, aid_src.observation_variance, aid_src.innovation);
+	// the observation jacobian is only non-zero for the velocity and wind states
+	const SparseVectorState<State::vel.idx, State::vel.idx + 1, State::vel.idx + 2,
+	      State::wind_vel.idx, State::wind_vel.idx + 1> H_sparse(H);
+
+	const bool is_fused = measurementUpdate(K, H_sparse, aid_src.observation_variance, aid_src.innovation);
 
 	aid_src.fused = is_fused;
 	_fault_status.flags.bad_airspeed = !is_fused;
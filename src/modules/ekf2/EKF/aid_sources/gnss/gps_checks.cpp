@@ -102,9 +102,10 @@ void Ekf::collect_gps(const gnssSample &gps)
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 
 			// set the magnetic field data returned by the geo library using the current GPS position
-			const float mag_declination_gps = math::radians(get_mag_declination_degrees(gps.lat, gps.lon));
-			const float mag_inclination_gps = math::radians(get_mag_inclination_degrees(gps.lat, gps.lon));
-			const float mag_strength_gps = get_mag_strength_gauss(gps.lat, gps.lon);
+			_wmm.update(gps.lat, gps.lon);
+			const float mag_declination_gps = math::radians(_wmm.declination_degrees());
+			const float mag_inclination_gps = math::radians(_wmm.inclination_degrees());
+			const float mag_strength_gps = _wmm.strength_gauss();
 
 			if (PX4_ISFINITE(mag_declination_gps) && PX4_ISFINITE(mag_inclination_gps) && PX4_ISFINITE(mag_strength_gps)) {
 
@@ -132,9 +132,12 @@ void Ekf::fuseGpsYaw(float antenna_yaw_offset)
 
 	// calculate the Kalman gains
 	// only calculate gains for states we are using
-	VectorState Kfusion = P * H / gnss_yaw.innovation_variance;
+	// the observation jacobian is only non-zero for the attitude states
+	const SparseVectorState<State::quat_nominal.idx, State::quat_nominal.idx + 1, State::quat_nominal.idx + 2> H_sparse(H);
 
-	const bool is_fused = measurementUpdate(Kfusion, H, gnss_yaw.observation_variance, gnss_yaw.innovation);
+	VectorState Kfusion = P * H_sparse / gnss_yaw.innovation_variance;
+
+	const bool is_fused = measurementUpdate(Kfusion, H_sparse, gnss_yaw.observation_variance, gnss_yaw.innovation);
 	_fault_status.flags.bad_hdg = !is_fused;
 	gnss_yaw.fused = is_fused;
 
@@ -85,7 +85,47 @@ void Ekf::controlGravityFusion(const imuSample &imu)
 
 	bool fused[3] {false, false, false};
 
-	// update the states and covariance using sequential fusion
+	const bool accel_clipping = imu.delta_vel_clipping[0] || imu.delta_vel_clipping[1] || imu.delta_vel_clipping[2];
+
+	if (!_control_status.flags.gravity_vector || _aid_src_gravity.innovation_rejected || accel_clipping) {
+		return;
+	}
+
+	// try to fuse all axes jointly (linearised at the same state), sharing the P * H products
+	{
+		float innovation_variance_axis;
+		VectorState H_y;
+		VectorState H_z;
+		sym::ComputeGravityYInnovVarAndH(state_vector, P, measurement_var, &innovation_variance_axis, &H_y);
+		sym::ComputeGravityZInnovVarAndH(state_vector, P, measurement_var, &innovation_variance_axis, &H_z);
+
+		// the observation jacobians are only non-zero for the attitude states
+		matrix::Matrix<float, State::quat_nominal.dof, 3> H_quat;
+		H_quat.col(0) = H.slice<State::quat_nominal.dof, 1>(State::quat_nominal.idx, 0);
+		H_quat.col(1) = H_y.slice<State::quat_nominal.dof, 1>(State::quat_nominal.idx, 0);
+		H_quat.col(2) = H_z.slice<State::quat_nominal.dof, 1>(State::quat_nominal.idx, 0);
+
+		const matrix::Matrix<float, State::size, State::quat_nominal.dof> P_quat = P.slice<State::size, State::quat_nominal.dof>(0,
+				State::quat_nominal.idx);
+		const matrix::Matrix<float, State::size, 3> PH = P_quat * H_quat;
+
+		const matrix::Matrix<float, State::quat_nominal.dof, 3> PH_quat = PH.slice<State::quat_nominal.dof, 3>(State::quat_nominal.idx,
+				0);
+		const Vector3f R(measurement_var, measurement_var, measurement_var);
+		const matrix::SquareMatrix<float, 3> S = H_quat.transposeMultiply(PH_quat) + matrix::diag(R);
+
+		matrix::Matrix<float, State::size, 3> K;
+
+		if (computeJointKalmanGain(PH, S, R, K)
+		    && measurementUpdate(K, PH, S, innovation)) {
+
+			_aid_src_gravity.fused = true;
+			_aid_src_gravity.time_last_fuse = imu.time_us;
+			return;
+		}
+	}
+
+	// otherwise update the states and covariance using sequential fusion
 	for (uint8_t index = 0; index <= 2; index++) {
 		// Calculate Kalman gains and observation jacobians
 		if (index == 0) {
@@ -108,11 +148,7 @@ void Ekf::controlGravityFusion(const imuSample &imu)
 
 		VectorState K = P * H / _aid_src_gravity.innovation_variance[index];
 
-		const bool accel_clipping = imu.delta_vel_clipping[0] || imu.delta_vel_clipping[1] || imu.delta_vel_clipping[2];
-
-		if (_control_status.flags.gravity_vector && !_aid_src_gravity.innovation_rejected && !accel_clipping) {
-			fused[index] = measurementUpdate(K, H, _aid_src_gravity.observation_variance[index], _aid_src_gravity.innovation[index]);
-		}
+		fused[index] = measurementUpdate(K, H, _aid_src_gravity.observation_variance[index], _aid_src_gravity.innovation[index]);
 	}
 
 	if (fused[0] && fused[1] && fused[2]) {
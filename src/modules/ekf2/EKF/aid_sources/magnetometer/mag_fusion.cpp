@@ -59,10 +59,64 @@ bool Ekf::fuseMag(const Vector3f &mag, const float R_MAG, VectorState &H, estima
 
 	const auto state_vector = _state.vector();
 
+	auto limitKalmanGain = [&](VectorState &Kfusion) {
+		if (update_all_states) {
+			if (!update_tilt) {
+				Kfusion(State::quat_nominal.idx + 0) = 0.f;
+				Kfusion(State::quat_nominal.idx + 1) = 0.f;
+			}
+
+		} else {
+			// zero non-mag Kalman gains if not updating all states
+
+			// copy mag_I and mag_B Kalman gains
+			const Vector3f K_mag_I = Kfusion.slice<State::mag_I.dof, 1>(State::mag_I.idx, 0);
+			const Vector3f K_mag_B = Kfusion.slice<State::mag_B.dof, 1>(State::mag_B.idx, 0);
+
+			// zero all Kalman gains, then restore mag
+			Kfusion.setZero();
+			Kfusion.slice<State::mag_I.dof, 1>(State::mag_I.idx, 0) = K_mag_I;
+			Kfusion.slice<State::mag_B.dof, 1>(State::mag_B.idx, 0) = K_mag_B;
+		}
+	};
+
 	bool fused[3] {false, false, false};
+	bool fused_jointly = false;
+
+	// try to fuse all components jointly (linearised at the same state), sharing the P * H products
+	// synthesized measurements (Z component) are never fused in 3D
+	if (!_control_status.flags.synthetic_mag_z) {
+		float innovation_variance_axis;
+		VectorState H_y;
+		VectorState H_z;
+		sym::ComputeMagYInnovVarAndH(state_vector, P, R_MAG, FLT_EPSILON, &innovation_variance_axis, &H_y);
+		sym::ComputeMagZInnovVarAndH(state_vector, P, R_MAG, FLT_EPSILON, &innovation_variance_axis, &H_z);
+
+		matrix::Matrix<float, State::size, 3> H_xyz;
+		H_xyz.col(0) = H;
+		H_xyz.col(1) = H_y;
+		H_xyz.col(2) = H_z;
+
+		const matrix::Matrix<float, State::size, 3> PH = P * H_xyz;
+		const Vector3f R(R_MAG, R_MAG, R_MAG);
+		const matrix::SquareMatrix<float, 3> S = H_xyz.transposeMultiply(PH) + matrix::diag(R);
+
+		matrix::Matrix<float, State::size, 3> K;
+
+		if (computeJointKalmanGain(PH, S, R, K)) {
+			for (uint8_t index = 0; index <= 2; index++) {
+				VectorState K_index = K.col(index);
+				limitKalmanGain(K_index);
+				K.col(index) = K_index;
+			}
+
+			fused_jointly = measurementUpdate(K, PH, S, Vector3f(aid_src.innovation));
+			fused[0] = fused[1] = fused[2] = fused_jointly;
+		}
+	}
 
-	// update the states and covariance using sequential fusion of the magnetometer components
-	for (uint8_t index = 0; index <= 2; index++) {
+	// otherwise update the states and covariance using sequential fusion of the magnetometer components
+	for (uint8_t index = 0; (index <= 2) && !fused_jointly; index++) {
 		// Calculate Kalman gains and observation jacobians
 		if (index == 0) {
 			// everything was already computed
@@ -102,25 +156,7 @@ bool Ekf::fuseMag(const Vector3f &mag, const float R_MAG, VectorState &H, estima
 		}
 
 		VectorState Kfusion = P * H / aid_src.innovation_variance[index];
-
-		if (update_all_states) {
-			if (!update_tilt) {
-				Kfusion(State::quat_nominal.idx + 0) = 0.f;
-				Kfusion(State::quat_nominal.idx + 1) = 0.f;
-			}
-
-		} else {
-			// zero non-mag Kalman gains if not updating all states
-
-			// copy mag_I and mag_B Kalman gains
-			const Vector3f K_mag_I = Kfusion.slice<State::mag_I.dof, 1>(State::mag_I.idx, 0);
-			const Vector3f K_mag_B = Kfusion.slice<State::mag_B.dof, 1>(State::mag_B.idx, 0);
-
-			// zero all Kalman gains, then restore mag
-			Kfusion.setZero();
-			Kfusion.slice<State::mag_I.dof, 1>(State::mag_I.idx, 0) = K_mag_I;
-			Kfusion.slice<State::mag_B.dof, 1>(State::mag_B.idx, 0) = K_mag_B;
-		}
+		limitKalmanGain(Kfusion);
 
 		if (measurementUpdate(Kfusion, H, aid_src.observation_variance[index], aid_src.innovation[index])) {
 			fused[index] = true;
@@ -144,9 +144,13 @@ void Ekf::fuseOptFlow()
 			}
 		}
 
-		VectorState Kfusion = P * H / _aid_src_optical_flow.innovation_variance[index];
+		// the observation jacobian is only non-zero for the attitude and velocity states
+		const SparseVectorState<State::quat_nominal.idx, State::quat_nominal.idx + 1, State::quat_nominal.idx + 2,
+		      State::vel.idx, State::vel.idx + 1, State::vel.idx + 2> H_sparse(H);
 
-		if (measurementUpdate(Kfusion, H, _aid_src_optical_flow.observation_variance[index], _aid_src_optical_flow.innovation[index])) {
+		VectorState Kfusion = P * H_sparse / _aid_src_optical_flow.innovation_variance[index];
+
+		if (measurementUpdate(Kfusion, H_sparse, _aid_src_optical_flow.observation_variance[index], _aid_src_optical_flow.innovation[index])) {
 			fused[index] = true;
 		}
 	}
@@ -142,7 +142,12 @@ void Ekf::fuseSideslip(estimator_aid_source1d_s &sideslip)
 		K.slice<State::wind_vel.dof, 1>(State::wind_vel.idx, 0) = K_wind;
 	}
 
-	const bool is_fused = measurementUpdate(K, H, sideslip.observation_variance, sideslip.innovation);
+	// the observation jacobian is only non-zero for the attitude, velocity and wind states
+	const SparseVectorState<State::quat_nominal.idx, State::quat_nominal.idx + 1, State::quat_nominal.idx + 2,
+	      State::vel.idx, State::vel.idx + 1, State::vel.idx + 2,
+	      State::wind_vel.idx, State::wind_vel.idx + 1> H_sparse(H);
+
+	const bool is_fused = measurementUpdate(K, H_sparse, sideslip.observation_variance, sideslip.innovation);
 
 	sideslip.fused = is_fused;
 	_fault_status.flags.bad_sideslip = !is_fused;
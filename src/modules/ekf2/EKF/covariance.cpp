@@ -125,10 +125,22 @@ void Ekf::predictCovariance(const imuSample &imu_delayed)
 	}
 
 	// calculate variances and upper diagonal covariances for quaternion, velocity, position and gyro bias states
+#if defined(CONFIG_EKF2_DOUBLE_PRECISION_COVARIANCE_PREDICTION)
+	// evaluate the prediction (A * P * A.T + G * Q * G.T) in double precision to limit round-off of the small
+	// covariances and the loss of symmetry / positive definiteness it causes, P itself is stored as float
+	const Vector3f accel = imu_delayed.delta_vel / math::max(imu_delayed.delta_vel_dt, FLT_EPSILON);
+	const Vector3f gyro = imu_delayed.delta_ang / math::max(imu_delayed.delta_ang_dt, FLT_EPSILON);
+
+	P = sym::PredictCovariance<double>(_state.vector().cast<double>(), P.cast<double>(),
+					   accel.cast<double>(), accel_var.cast<double>(),
+					   gyro.cast<double>(), static_cast<double>(gyro_var),
+					   static_cast<double>(dt)).cast<float>();
+#else
 	P = sym::PredictCovariance(_state.vector(), P,
 				   imu_delayed.delta_vel / math::max(imu_delayed.delta_vel_dt, FLT_EPSILON), accel_var,
 				   imu_delayed.delta_ang / math::max(imu_delayed.delta_ang_dt, FLT_EPSILON), gyro_var,
 				   dt);
+#endif // CONFIG_EKF2_DOUBLE_PRECISION_COVARIANCE_PREDICTION
 
 	// Construct the process noise variance diagonal for those states with a stationary process model
 	// These are kinematic states and their error growth is controlled separately by the IMU noise variances
@@ -258,6 +258,43 @@ bool Ekf::initialiseFilter()
 	return true;
 }
 
+bool Ekf::restoreState(const StateSample &state, const SquareMatrixState &covariances, const bool yaw_align,
+		       const bool origin_valid, const double latitude, const double longitude, const float altitude)
+{
+	// the IMU buffer needs to be running to know the delayed time horizon
+	if (!_initialised || _filter_initialised
+	    || !state.vector().isAllFinite() || !covariances.isAllFinite()) {
+		return false;
+	}
+
+	// set the origin first, the position reset it might trigger is overwritten below
+	if (origin_valid && !setEkfGlobalOrigin(latitude, longitude, altitude)) {
+		return false;
+	}
+
+	_state = state;
+	_state.quat_nominal.normalize();
+	_R_to_earth = Dcmf(_state.quat_nominal);
+
+	P = covariances;
+	constrainStateVariances();
+
+	_control_status.flags.yaw_align = yaw_align;
+
+	_is_first_imu_sample = false;
+	_filter_initialised = true;
+
+#if defined(CONFIG_EKF2_TERRAIN)
+	initHagl();
+#endif // CONFIG_EKF2_TERRAIN
+
+	_output_predictor.alignOutputFilter(_state.quat_nominal, _state.vel, _state.pos);
+
+	ECL_INFO("%llu: EKF state restored", (unsigned long long)_time_delayed_us);
+
+	return true;
+}
+
 bool Ekf::initialiseTilt()
 {
 	const float accel_norm = _accel_lpf.getState().norm();
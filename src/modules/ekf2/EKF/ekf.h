@@ -72,6 +72,8 @@ class Ekf final : public EstimatorInterface
 {
 public:
 	typedef matrix::Vector<float, State::size> VectorState;
+	template <size_t ...Idxs>
+	using SparseVectorState = matrix::SparseVectorf<State::size, Idxs...>;
 	typedef matrix::SquareMatrix<float, State::size> SquareMatrixState;
 	typedef matrix::SquareMatrix<float, 2> Matrix2f;
 
@@ -256,6 +258,12 @@ public:
 	bool getEkfGlobalOrigin(uint64_t &origin_time, double &latitude, double &longitude, float &origin_alt) const;
 	bool setEkfGlobalOrigin(double latitude, double longitude, float altitude, float eph = 0.f, float epv = 0.f);
 
+	// initialise the filter from a previously captured state, covariance and origin (e.g. to start a replay in the middle of a log)
+	// measurement buffers are not restored, the aiding sources start again through their usual checks
+	// return false if the filter is already running or the data isn't valid
+	bool restoreState(const StateSample &state, const SquareMatrixState &covariances, bool yaw_align,
+			  bool origin_valid, double latitude, double longitude, float altitude);
+
 	// get the 1-sigma horizontal and vertical position uncertainty of the ekf WGS-84 position
 	void get_ekf_gpos_accuracy(float *ekf_eph, float *ekf_epv) const;
 
@@ -319,6 +327,35 @@ public:
 	// fuse single direct state measurement (eg NED velocity, NED position, mag earth field, etc)
 	bool fuseDirectStateMeasurement(const float innov, const float innov_var, const float R, const int state_index);
 
+	// fuse N direct measurements of consecutive states (eg NED velocity) jointly
+	// falls back to sequential fusion if the joint update is not numerically safe
+	template <size_t N>
+	bool fuseDirectStateMeasurement(const float (&innov)[N], const float (&innov_var)[N], const float (&R)[N],
+					const int state_index)
+	{
+		// H selects the states, so PH are columns of P and H.T * PH a diagonal block of P
+		const matrix::Matrix<float, State::size, N> PH = P.slice<State::size, N>(0, state_index);
+		matrix::SquareMatrix<float, N> S = P.slice<N, N>(state_index, state_index);
+
+		for (size_t n = 0; n < N; n++) {
+			S(n, n) += R[n];
+		}
+
+		matrix::Matrix<float, State::size, N> K;
+
+		if (computeJointKalmanGain(PH, S, matrix::Vector<float, N>(R), K)) {
+			return measurementUpdate(K, PH, S, matrix::Vector<float, N>(innov));
+		}
+
+		for (size_t n = 0; n < N; n++) {
+			if (!fuseDirectStateMeasurement(innov[n], innov_var[n], R[n], state_index + n)) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 	// gyro bias
 	const Vector3f &getGyroBias() const { return _state.gyro_bias; } // get the gyroscope bias in rad/s
 	Vector3f getGyroBiasVariance() const { return getStateVariance<State::gyro_bias>(); } // get the gyroscope bias variance in rad/s
@@ -474,35 +511,80 @@ public:
 		// Efficient implementation of the Joseph stabilized covariance update
 		// Based on "G. J. Bierman. Factorization Methods for Discrete Sequential Estimation. Academic Press, Dover Publications, New York, 1977, 2006"
 		// P = (I - K * H) * P * (I - K * H).T   + K * R * K.T
-		//   =      P_temp     * (I - H.T * K.T) + K * R * K.T
-		//   =      P_temp - P_temp * H.T * K.T  + K * R * K.T
+		//   = P - K * PH.T - PH * K.T + (H.T * PH + R) * K * K.T
+		// P is symmetric, so PH == H.T * P.T == H.T * P
+		const VectorState PH = P * H; // H is stored as a column vector. H is in fact H.T
+		P.josephUpdate(K, PH, H.dot(PH) + R);
+#endif
+
+		constrainStateVariances();
+
+		// apply the state corrections
+		fuse(K, innovation);
+		return true;
+	}
 
-		// Step 1: conventional update
-		// Compute P_temp and store it in P to avoid allocating more memory
-		// P is symmetric, so PH == H.T * P.T == H.T * P. Taking the row is faster as matrices are row-major
-		VectorState PH = P * H; // H is stored as a column vector. H is in fact H.T
+	// sparse observation jacobian, P * H only uses the columns of P of the non-zero entries
+	template <size_t ...Idxs>
+	bool measurementUpdate(VectorState &K, const SparseVectorState<Idxs...> &H, const float R, const float innovation)
+	{
+		clearInhibitedStateKalmanGains(K);
+
+		const VectorState PH = P * H;
+		P.josephUpdate(K, PH, H.dot(PH) + R);
+
+		constrainStateVariances();
+
+		// apply the state corrections
+		fuse(K, innovation);
+		return true;
+	}
+
+	// Kalman gain for N correlated observations fused jointly, observation jacobians stored as the columns of H
+	// PH = P * H, S = H.T * P * H + R
+	// returns false if the joint update is not numerically safe, the observations must then be fused sequentially
+	template <size_t N>
+	bool computeJointKalmanGain(const matrix::Matrix<float, State::size, N> &PH, const matrix::SquareMatrix<float, N> &S,
+				    const matrix::Vector<float, N> &R, matrix::Matrix<float, State::size, N> &K) const
+	{
+		// the Cholesky pivots are the innovation variances of the equivalent sequential fusion,
+		// each must be at least the observation variance (same check as for the sequential fusion)
+		const matrix::SquareMatrix<float, N> L = matrix::cholesky(S);
 
-		for (unsigned i = 0; i < State::size; i++) {
-			for (unsigned j = 0; j < State::size; j++) {
-				P(i, j) -= K(i) * PH(j); // P is now not symmetrical if K is not optimal (e.g.: some gains have been zeroed)
+		for (size_t n = 0; n < N; n++) {
+			if (!(L(n, n) * L(n, n) >= R(n))) {
+				return false;
 			}
 		}
 
-		// Step 2: stabilized update
-		PH = P * H; // H is stored as a column vector. H is in fact H.T
+		matrix::SquareMatrix<float, N> S_inv;
 
-		for (unsigned i = 0; i < State::size; i++) {
-			for (unsigned j = 0; j <= i; j++) {
-				P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * R * K(j);
-				P(j, i) = P(i, j);
-			}
+		if (!matrix::inv(S, S_inv)) {
+			return false;
 		}
-#endif
+
+		K = PH * S_inv;
+		return true;
+	}
+
+	// joint update of N correlated observations, see computeJointKalmanGain()
+	template <size_t N>
+	bool measurementUpdate(matrix::Matrix<float, State::size, N> &K, const matrix::Matrix<float, State::size, N> &PH,
+			       const matrix::SquareMatrix<float, N> &S, const matrix::Vector<float, N> &innovation)
+	{
+		for (size_t n = 0; n < N; n++) {
+			VectorState K_n = K.col(n);
+			clearInhibitedStateKalmanGains(K_n);
+			K.col(n) = K_n;
+		}
+
+		// Joseph stabilized covariance update, valid for any gain K
+		P.josephUpdate(K, PH, S);
 
 		constrainStateVariances();
 
 		// apply the state corrections
-		fuse(K, innovation);
+		fuse(K * innovation, 1.f);
 		return true;
 	}
 
@@ -96,9 +96,10 @@ bool Ekf::setEkfGlobalOrigin(const double latitude, const double longitude, cons
 		_gps_alt_ref = altitude;
 
 #if defined(CONFIG_EKF2_MAGNETOMETER)
-		const float mag_declination_gps = math::radians(get_mag_declination_degrees(latitude, longitude));
-		const float mag_inclination_gps = math::radians(get_mag_inclination_degrees(latitude, longitude));
-		const float mag_strength_gps = get_mag_strength_gauss(latitude, longitude);
+		_wmm.update(latitude, longitude);
+		const float mag_declination_gps = math::radians(_wmm.declination_degrees());
+		const float mag_inclination_gps = math::radians(_wmm.inclination_degrees());
+		const float mag_strength_gps = _wmm.strength_gauss();
 
 		if (PX4_ISFINITE(mag_declination_gps) && PX4_ISFINITE(mag_inclination_gps) && PX4_ISFINITE(mag_strength_gps)) {
 			_mag_declination_gps = mag_declination_gps;
@@ -728,30 +729,11 @@ bool Ekf::fuseDirectStateMeasurement(const float innov, const float innov_var, c
 	// Efficient implementation of the Joseph stabilized covariance update
 	// Based on "G. J. Bierman. Factorization Methods for Discrete Sequential Estimation. Academic Press, Dover Publications, New York, 1977, 2006"
 	// P = (I - K * H) * P * (I - K * H).T   + K * R * K.T
-	//   =      P_temp     * (I - H.T * K.T) + K * R * K.T
-	//   =      P_temp - P_temp * H.T * K.T  + K * R * K.T
-
-	// Step 1: conventional update
-	// Compute P_temp and store it in P to avoid allocating more memory
-	// P is symmetric, so PH == H.T * P.T == H.T * P. Taking the row is faster as matrices are row-major
-	VectorState PH = P.row(state_index);
-
-	for (unsigned i = 0; i < State::size; i++) {
-		for (unsigned j = 0; j < State::size; j++) {
-			P(i, j) -= K(i) * PH(j); // P is now not symmetric if K is not optimal (e.g.: some gains have been zeroed)
-		}
-	}
-
-	// Step 2: stabilized update
-	// P (or "P_temp") is not symmetric so we must take the column
-	PH = P.col(state_index);
-
-	for (unsigned i = 0; i < State::size; i++) {
-		for (unsigned j = 0; j <= i; j++) {
-			P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * R * K(j);
-			P(j, i) = P(i, j);
-		}
-	}
+	//   = P - K * PH.T - PH * K.T + (H.T * PH + R) * K * K.T
+	// H only has a single non-zero entry, so PH is a column of P and H.T * PH a diagonal element
+	// P is symmetric, taking the row is faster as matrices are row-major
+	const VectorState PH = P.row(state_index);
+	P.josephUpdate(K, PH, P(state_index, state_index) + R);
 #endif
 
 	constrainStateVariances();
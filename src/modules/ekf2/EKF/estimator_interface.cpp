@@ -77,6 +77,18 @@ EstimatorInterface::~EstimatorInterface()
 
 // Accumulate imu data and store to buffer at desired rate
 void EstimatorInterface::setIMUData(const imuSample &imu_sample)
+{
+	// accumulate and down-sample imu data and push to the buffer when new downsampled data becomes available
+	if (_imu_down_sampler.update(imu_sample)) {
+		const imuSample imu_down_sampled = _imu_down_sampler.getDownSampledImuAndTriggerReset();
+		setIMUData(imu_sample, &imu_down_sampled);
+
+	} else {
+		setIMUData(imu_sample, nullptr);
+	}
+}
+
+void EstimatorInterface::setIMUData(const imuSample &imu_sample, const imuSample *imu_down_sampled)
 {
 	// TODO: resolve misplaced responsibility
 	if (!_initialised) {
@@ -88,12 +100,11 @@ void EstimatorInterface::setIMUData(const imuSample &imu_sample)
 	// the output observer always runs
 	_output_predictor.calculateOutputStates(imu_sample.time_us, imu_sample.delta_ang, imu_sample.delta_ang_dt, imu_sample.delta_vel, imu_sample.delta_vel_dt);
 
-	// accumulate and down-sample imu data and push to the buffer when new downsampled data becomes available
-	if (_imu_down_sampler.update(imu_sample)) {
+	if (imu_down_sampled) {
 
 		_imu_updated = true;
 
-		_imu_buffer.push(_imu_down_sampler.getDownSampledImuAndTriggerReset());
+		_imu_buffer.push(*imu_down_sampled);
 
 		// get the oldest data from the buffer
 		_time_delayed_us = _imu_buffer.get_oldest().time_us;
@@ -72,6 +72,7 @@
 #endif // CONFIG_EKF2_RANGE_FINDER
 
 #include <lib/atmosphere/atmosphere.h>
+#include <lib/world_magnetic_model/geo_mag_declination.h>
 #include <matrix/math.hpp>
 #include <mathlib/mathlib.h>
 #include <mathlib/math/filter/AlphaFilter.hpp>
@@ -83,6 +84,9 @@ class EstimatorInterface
 public:
 	void setIMUData(const imuSample &imu_sample);
 
+	// imu data down-sampled externally (eg shared by multiple instances), nullptr if no new down-sampled data
+	void setIMUData(const imuSample &imu_sample, const imuSample *imu_down_sampled);
+
 #if defined(CONFIG_EKF2_GNSS)
 	void setGpsData(const gnssSample &gnss_sample);
 
@@ -458,6 +462,8 @@ protected:
 	uint64_t _wmm_gps_time_last_set{0};      // time WMM last set
 
 #if defined(CONFIG_EKF2_MAGNETOMETER)
+	GeoMagFieldCache _wmm{};                 // world magnetic model lookup, keeps the current table cell
+
 	float _mag_declination_gps{NAN};         // magnetic declination returned by the geo library using the last valid GPS position (rad)
 	float _mag_inclination_gps{NAN};	  // magnetic inclination returned by the geo library using the last valid GPS position (rad)
 	float _mag_strength_gps{NAN};	          // magnetic strength returned by the geo library using the last valid GPS position (T)
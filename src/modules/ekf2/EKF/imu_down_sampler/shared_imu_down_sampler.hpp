@@ -0,0 +1,97 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * IMU down-sampler shared by the estimator instances using the same IMU
+ *
+ * Every IMU sample is only accumulated once, by the first instance processing it.
+ * All instances sharing the down-sampler must run on the same thread (work queue).
+ */
+#ifndef EKF_SHARED_IMU_DOWN_SAMPLER_HPP
+#define EKF_SHARED_IMU_DOWN_SAMPLER_HPP
+
+#include "imu_down_sampler.hpp"
+
+class SharedImuDownSampler
+{
+public:
+	SharedImuDownSampler() = default;
+	~SharedImuDownSampler() = default;
+
+	/**
+	 * Accumulate a new IMU sample (if not already done by another instance)
+	 *
+	 * @param imu_sample IMU sample
+	 * @param target_dt_us down-sampling target interval
+	 * @param consumed_time_us time of the last down-sampled sample the calling instance received
+	 * @param imu_down_sampled down-sampled sample output
+	 * @return true if a down-sampled sample newer than consumed_time_us is available
+	 */
+	bool update(const imuSample &imu_sample, int32_t target_dt_us, uint64_t &consumed_time_us, imuSample &imu_down_sampled)
+	{
+		if (imu_sample.time_us > _input_time_us) {
+			_input_time_us = imu_sample.time_us;
+			_target_dt_us = target_dt_us;
+
+			if (_down_sampler.update(imu_sample)) {
+				_down_sampled = _down_sampler.getDownSampledImuAndTriggerReset();
+			}
+		}
+
+		if (consumed_time_us == 0) {
+			// a new instance starts with the next down-sampled sample
+			consumed_time_us = math::max(_down_sampled.time_us, (uint64_t)1);
+			return false;
+		}
+
+		if ((_down_sampled.time_us > consumed_time_us) && (_down_sampled.time_us <= imu_sample.time_us)) {
+			consumed_time_us = _down_sampled.time_us;
+			imu_down_sampled = _down_sampled;
+			return true;
+		}
+
+		return false;
+	}
+
+private:
+	int32_t _target_dt_us{10000};
+
+	ImuDownSampler _down_sampler{_target_dt_us};
+
+	imuSample _down_sampled{};
+
+	uint64_t _input_time_us{0};
+};
+
+#endif // !EKF_SHARED_IMU_DOWN_SAMPLER_HPP
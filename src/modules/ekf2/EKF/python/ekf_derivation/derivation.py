@@ -53,12 +53,35 @@ from utils.derivation_utils import *
 # Initialize parser
 parser = argparse.ArgumentParser()
 
-parser.add_argument("--disable_mag", action='store_true', help="disable mag")
-parser.add_argument("--disable_wind", action='store_true', help="disable wind")
+# States that are only observable (and therefore only worth estimating) when the
+#  corresponding aid source is enabled at build time
+optional_states = {
+    "mag": ["mag_I", "mag_B"],
+    "wind": ["wind_vel"],
+}
+
+parser.add_argument("--disable", action='append', default=[], choices=optional_states.keys(),
+                    help="remove the states of an aid source from the state vector (can be repeated)")
+parser.add_argument("--disable_mag", action='store_true', help="disable mag (same as --disable mag)")
+parser.add_argument("--disable_wind", action='store_true', help="disable wind (same as --disable wind)")
 
 # Read arguments from command line
 args = parser.parse_args()
 
+if args.disable_mag:
+    args.disable.append("mag")
+
+if args.disable_wind:
+    args.disable.append("wind")
+
+args.disable_mag = "mag" in args.disable
+args.disable_wind = "wind" in args.disable
+
+def remove_disabled_states(values: Values):
+    for aid_source in set(args.disable):
+        for key in optional_states[aid_source]:
+            del values[key]
+
 # The state vector is organized in an ordered dictionary
 State = Values(
     quat_nominal = sf.Rot3(),
@@ -71,12 +94,7 @@ State = Values(
     wind_vel = sf.V2()
 )
 
-if args.disable_mag:
-    del State["mag_I"]
-    del State["mag_B"]
-
-if args.disable_wind:
-    del State["wind_vel"]
+remove_disabled_states(State)
 
 class IdxDof():
     def __init__(self, idx, dof):
@@ -135,12 +153,7 @@ def predict_covariance(
         wind_vel = sf.V2.symbolic("wind_vel")
     )
 
-    if args.disable_mag:
-        del state_error["mag_I"]
-        del state_error["mag_B"]
-
-    if args.disable_wind:
-        del state_error["wind_vel"]
+    remove_disabled_states(state_error)
 
     # True state kinematics
     state_t = Values()
@@ -643,7 +656,7 @@ def compute_gravity_z_innov_var_and_h(
 
     return (innov_var, H.T)
 
-print("Derive EKF2 equations...")
+print(f"Derive EKF2 equations ({State.tangent_dim()} states)...")
 generate_px4_function(predict_covariance, output_names=None)
 
 if not args.disable_mag:
@@ -45,14 +45,18 @@ using matrix::Dcmf;
 using matrix::Eulerf;
 using matrix::Matrix3f;
 using matrix::Quatf;
+using matrix::SquareMatrix3f;
 using matrix::Vector2f;
 using matrix::Vector3f;
 using matrix::wrap_pi;
-using math::Utilities::getEulerYaw;
 using math::Utilities::updateYawInRotMat;
 
 EKFGSF_yaw::EKFGSF_yaw()
 {
+	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+		setAhrsRotMat(model_index, Dcmf{});
+	}
+
 	reset();
 }
 
@@ -99,9 +103,7 @@ void EKFGSF_yaw::predict(const matrix::Vector3f &delta_ang, const float delta_an
 		}
 	}
 
-	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index ++) {
-		predictEKF(model_index, delta_ang, delta_ang_dt, delta_vel, delta_vel_dt, in_air);
-	}
+	predictEKF(delta_ang, delta_ang_dt, delta_vel, delta_vel_dt, in_air);
 }
 
 void EKFGSF_yaw::fuseVelocity(const Vector2f &vel_NE, const float vel_accuracy, const bool in_air)
@@ -119,14 +121,8 @@ void EKFGSF_yaw::fuseVelocity(const Vector2f &vel_NE, const float vel_accuracy,
 		}
 
 	} else {
-		bool bad_update = false;
-
-		for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
-			// subsequent measurements are fused as direct state observations
-			if (!updateEKF(model_index, vel_NE, vel_accuracy)) {
-				bad_update = true;
-			}
-		}
+		// subsequent measurements are fused as direct state observations
+		const bool bad_update = !updateEKF(vel_NE, vel_accuracy);
 
 		if (!bad_update) {
 			float total_weight = 0.0f;
@@ -161,8 +157,8 @@ void EKFGSF_yaw::fuseVelocity(const Vector2f &vel_NE, const float vel_accuracy,
 		Vector2f yaw_vector;
 
 		for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index ++) {
-			yaw_vector(0) += _model_weights(model_index) * cosf(_ekf_gsf[model_index].X(2));
-			yaw_vector(1) += _model_weights(model_index) * sinf(_ekf_gsf[model_index].X(2));
+			yaw_vector(0) += _model_weights(model_index) * cosf(_ekf_gsf.X[2][model_index]);
+			yaw_vector(1) += _model_weights(model_index) * sinf(_ekf_gsf.X[2][model_index]);
 		}
 
 		_gsf_yaw = atan2f(yaw_vector(1), yaw_vector(0));
@@ -172,19 +168,16 @@ void EKFGSF_yaw::fuseVelocity(const Vector2f &vel_NE, const float vel_accuracy,
 		_gsf_yaw_variance = 0.0f;
 
 		for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index ++) {
-			const float yaw_delta = wrap_pi(_ekf_gsf[model_index].X(2) - _gsf_yaw);
-			_gsf_yaw_variance += _model_weights(model_index) * (_ekf_gsf[model_index].P(2, 2) + yaw_delta * yaw_delta);
+			const float yaw_delta = wrap_pi(_ekf_gsf.X[2][model_index] - _gsf_yaw);
+			_gsf_yaw_variance += _model_weights(model_index) * (_ekf_gsf.P[2][2][model_index] + yaw_delta * yaw_delta);
 		}
 	}
 }
 
-void EKFGSF_yaw::ahrsPredict(const uint8_t model_index, const Vector3f &delta_ang, const float delta_ang_dt)
+void EKFGSF_yaw::ahrsPredict(const Vector3f &delta_ang, const float delta_ang_dt)
 {
-	// generate attitude solution using simple complementary filter for the selected model
-	const Vector3f ang_rate = delta_ang / fmaxf(delta_ang_dt, 0.001f) - _ahrs_ekf_gsf[model_index].gyro_bias;
-
-	const Dcmf R_to_body = _ahrs_ekf_gsf[model_index].R.transpose();
-	const Vector3f gravity_direction_bf = R_to_body.col(2);
+	// generate attitude solutions using simple complementary filters, all models in lockstep
+	const Vector3f ang_rate_meas = delta_ang / fmaxf(delta_ang_dt, 0.001f);
 
 	const float ahrs_accel_norm = _ahrs_accel.norm();
 
@@ -192,41 +185,60 @@ void EKFGSF_yaw::ahrsPredict(const uint8_t model_index, const Vector3f &delta_an
 	const float ahrs_accel_fusion_gain = ahrsCalcAccelGain();
 
 	// Perform angular rate correction using accel data and reduce correction as accel magnitude moves away from 1 g (reduces drift when vehicle picked up and moved).
+	const float tilt_correction_gain = (ahrs_accel_fusion_gain > 0.f) ? ahrs_accel_fusion_gain / ahrs_accel_norm : 0.f;
+
 	// During fixed wing flight, compensate for centripetal acceleration assuming coordinated turns and X axis forward
-	Vector3f tilt_correction{};
+	const float true_airspeed = (PX4_ISFINITE(_true_airspeed) && (_true_airspeed > FLT_EPSILON)) ? _true_airspeed : 0.f;
 
-	if (ahrs_accel_fusion_gain > 0.f) {
+	// Gyro bias estimation
+	constexpr float gyro_bias_limit = 0.05f;
+	const float gyro_bias_gain = _gyro_bias_gain * delta_ang_dt;
 
-		Vector3f accel = _ahrs_accel;
+	float delta_angle_corrected[3][N_MODELS_EKFGSF];
 
-		if (PX4_ISFINITE(_true_airspeed) && (_true_airspeed > FLT_EPSILON)) {
-			// Calculate body frame centripetal acceleration with assumption X axis is aligned with the airspeed vector
-			// Use cross product of body rate and body frame airspeed vector
-			const Vector3f centripetal_accel_bf = Vector3f(0.0f, _true_airspeed * ang_rate(2), - _true_airspeed * ang_rate(1));
+	// all models in lockstep, the loop body is kept free of branches so that it can be vectorised
+	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+		float ang_rate[3];
 
-			// correct measured accel for centripetal acceleration
-			accel -= centripetal_accel_bf;
+		for (uint8_t axis = 0; axis < 3; axis++) {
+			ang_rate[axis] = ang_rate_meas(axis) - _ahrs_ekf_gsf.gyro_bias[axis][model_index];
 		}
 
-		tilt_correction = (gravity_direction_bf % accel) * ahrs_accel_fusion_gain / ahrs_accel_norm;
-	}
+		// gravity direction in body frame is the last row of the body to earth rotation matrix
+		const float g0 = _ahrs_ekf_gsf.R[2][0][model_index];
+		const float g1 = _ahrs_ekf_gsf.R[2][1][model_index];
+		const float g2 = _ahrs_ekf_gsf.R[2][2][model_index];
 
-	// Gyro bias estimation
-	constexpr float gyro_bias_limit = 0.05f;
-	const float spin_rate = ang_rate.length();
+		// correct measured accel for the body frame centripetal acceleration, calculated as the cross product
+		// of body rate and body frame airspeed vector with assumption X axis is aligned with the airspeed vector
+		const float a0 = _ahrs_accel(0);
+		const float a1 = _ahrs_accel(1) - true_airspeed * ang_rate[2];
+		const float a2 = _ahrs_accel(2) + true_airspeed * ang_rate[1];
 
-	if (spin_rate < math::radians(10.f)) {
-		_ahrs_ekf_gsf[model_index].gyro_bias -= tilt_correction * (_gyro_bias_gain * delta_ang_dt);
-		_ahrs_ekf_gsf[model_index].gyro_bias = matrix::constrain(_ahrs_ekf_gsf[model_index].gyro_bias,
-						       -gyro_bias_limit, gyro_bias_limit);
-	}
+		const float tilt_correction[3] {
+			(g1 * a2 - g2 * a1) * tilt_correction_gain,
+			(g2 * a0 - g0 * a2) * tilt_correction_gain,
+			(g0 * a1 - g1 * a0) * tilt_correction_gain,
+		};
 
-	// delta angle from previous to current frame
-	const Vector3f delta_angle_corrected = delta_ang
-					       + (tilt_correction - _ahrs_ekf_gsf[model_index].gyro_bias) * delta_ang_dt;
+		const float spin_rate_sq = sq(ang_rate[0]) + sq(ang_rate[1]) + sq(ang_rate[2]);
+		const bool update_gyro_bias = spin_rate_sq < sq(math::radians(10.f));
+
+		for (uint8_t axis = 0; axis < 3; axis++) {
+			const float gyro_bias_prev = _ahrs_ekf_gsf.gyro_bias[axis][model_index];
+			const float gyro_bias_new = fminf(fmaxf(gyro_bias_prev - tilt_correction[axis] * gyro_bias_gain,
+							  -gyro_bias_limit), gyro_bias_limit);
+			const float gyro_bias = update_gyro_bias ? gyro_bias_new : gyro_bias_prev;
+
+			_ahrs_ekf_gsf.gyro_bias[axis][model_index] = gyro_bias;
+
+			// delta angle from previous to current frame
+			delta_angle_corrected[axis][model_index] = delta_ang(axis) + (tilt_correction[axis] - gyro_bias) * delta_ang_dt;
+		}
+	}
 
-	// Apply delta angle to rotation matrix
-	_ahrs_ekf_gsf[model_index].R = ahrsPredictRotMat(_ahrs_ekf_gsf[model_index].R, delta_angle_corrected);
+	// Apply delta angles to rotation matrices
+	ahrsPredictRotMat(delta_angle_corrected);
 }
 
 void EKFGSF_yaw::ahrsAlignTilt(const Vector3f &delta_vel)
@@ -257,7 +269,7 @@ void EKFGSF_yaw::ahrsAlignTilt(const Vector3f &delta_vel)
 	R.setRow(2, down_in_bf);
 
 	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
-		_ahrs_ekf_gsf[model_index].R = R;
+		setAhrsRotMat(model_index, R);
 	}
 }
 
@@ -266,34 +278,22 @@ void EKFGSF_yaw::ahrsAlignYaw()
 	// Align yaw angle for each model
 	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
 
-		const float yaw = wrap_pi(_ekf_gsf[model_index].X(2));
-		const Dcmf R = _ahrs_ekf_gsf[model_index].R;
-		_ahrs_ekf_gsf[model_index].R = updateYawInRotMat(yaw, R);
+		const float yaw = wrap_pi(_ekf_gsf.X[2][model_index]);
+		setAhrsRotMat(model_index, updateYawInRotMat(yaw, ahrsRotMat(model_index)));
 	}
 }
 
-void EKFGSF_yaw::predictEKF(const uint8_t model_index, const Vector3f &delta_ang, const float delta_ang_dt,
+void EKFGSF_yaw::predictEKF(const Vector3f &delta_ang, const float delta_ang_dt,
 			    const Vector3f &delta_vel, const float delta_vel_dt, bool in_air)
 {
 	// generate an attitude reference using IMU data
-	ahrsPredict(model_index, delta_ang, delta_ang_dt);
+	ahrsPredict(delta_ang, delta_ang_dt);
 
 	// we don't start running the EKF part of the algorithm until there are regular velocity observations
 	if (!_ekf_gsf_vel_fuse_started) {
 		return;
 	}
 
-	// Calculate the yaw state using a projection onto the horizontal that avoids gimbal lock
-	_ekf_gsf[model_index].X(2) = getEulerYaw(_ahrs_ekf_gsf[model_index].R);
-
-	// calculate delta velocity in a horizontal front-right frame
-	const Vector3f del_vel_NED = _ahrs_ekf_gsf[model_index].R * delta_vel;
-	const float cos_yaw = cosf(_ekf_gsf[model_index].X(2));
-	const float sin_yaw = sinf(_ekf_gsf[model_index].X(2));
-	const float dvx =   del_vel_NED(0) * cos_yaw + del_vel_NED(1) * sin_yaw;
-	const float dvy = - del_vel_NED(0) * sin_yaw + del_vel_NED(1) * cos_yaw;
-	const float daz = Vector3f(_ahrs_ekf_gsf[model_index].R * delta_ang)(2);
-
 	// delta velocity process noise double if we're not in air
 	const float accel_noise = in_air ? _accel_noise : 2.f * _accel_noise;
 	const float d_vel_var = sq(accel_noise * delta_vel_dt);
@@ -301,91 +301,134 @@ void EKFGSF_yaw::predictEKF(const uint8_t model_index, const Vector3f &delta_ang
 	// Use fixed values for delta angle process noise variances
 	const float d_ang_var = sq(_gyro_noise * delta_ang_dt);
 
-	_ekf_gsf[model_index].P = sym::YawEstPredictCovariance(_ekf_gsf[model_index].X, _ekf_gsf[model_index].P, Vector2f(dvx, dvy), d_vel_var, daz, d_ang_var);
+	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+		const float (&R)[3][3][N_MODELS_EKFGSF] = _ahrs_ekf_gsf.R;
 
-	// covariance matrix is symmetrical, so copy upper half to lower half
-	_ekf_gsf[model_index].P(1, 0) = _ekf_gsf[model_index].P(0, 1);
-	_ekf_gsf[model_index].P(2, 0) = _ekf_gsf[model_index].P(0, 2);
-	_ekf_gsf[model_index].P(2, 1) = _ekf_gsf[model_index].P(1, 2);
+		// Calculate the yaw state using a projection onto the horizontal that avoids gimbal lock
+		// (see math::Utilities::getEulerYaw())
+		if (fabsf(R[2][0][model_index]) < fabsf(R[2][1][model_index])) {
+			_ekf_gsf.X[2][model_index] = atan2f(R[1][0][model_index], R[0][0][model_index]);
 
-	// constrain variances
-	const float min_var = 1e-6f;
+		} else {
+			_ekf_gsf.X[2][model_index] = atan2f(-R[0][1][model_index], R[1][1][model_index]);
+		}
+
+		// calculate delta velocity in a horizontal front-right frame
+		float del_vel_NED[3];
+
+		for (uint8_t row = 0; row < 3; row++) {
+			del_vel_NED[row] = R[row][0][model_index] * delta_vel(0)
+					   + R[row][1][model_index] * delta_vel(1)
+					   + R[row][2][model_index] * delta_vel(2);
+		}
 
-	for (unsigned index = 0; index < 3; index++) {
-		_ekf_gsf[model_index].P(index, index) = fmaxf(_ekf_gsf[model_index].P(index, index), min_var);
+		const float cos_yaw = cosf(_ekf_gsf.X[2][model_index]);
+		const float sin_yaw = sinf(_ekf_gsf.X[2][model_index]);
+		const float dvx =   del_vel_NED[0] * cos_yaw + del_vel_NED[1] * sin_yaw;
+		const float dvy = - del_vel_NED[0] * sin_yaw + del_vel_NED[1] * cos_yaw;
+		const float daz = R[2][0][model_index] * delta_ang(0)
+				  + R[2][1][model_index] * delta_ang(1)
+				  + R[2][2][model_index] * delta_ang(2);
+
+		const Vector3f X(_ekf_gsf.X[0][model_index], _ekf_gsf.X[1][model_index], _ekf_gsf.X[2][model_index]);
+		setEkfCovariance(model_index,
+				 sym::YawEstPredictCovariance(X, ekfCovariance(model_index), Vector2f(dvx, dvy), d_vel_var, daz, d_ang_var));
+
+		// sum delta velocities in earth frame:
+		_ekf_gsf.X[0][model_index] += del_vel_NED[0];
+		_ekf_gsf.X[1][model_index] += del_vel_NED[1];
 	}
 
-	// sum delta velocities in earth frame:
-	_ekf_gsf[model_index].X(0) += del_vel_NED(0);
-	_ekf_gsf[model_index].X(1) += del_vel_NED(1);
+	constrainCovariances();
 }
 
-bool EKFGSF_yaw::updateEKF(const uint8_t model_index, const Vector2f &vel_NE, const float vel_accuracy)
+bool EKFGSF_yaw::updateEKF(const Vector2f &vel_NE, const float vel_accuracy)
 {
 	// set observation variance from accuracy estimate supplied by GPS and apply a sanity check minimum
 	const float vel_obs_var = sq(fmaxf(vel_accuracy, 0.01f));
 
-	// calculate velocity observation innovations
-	_ekf_gsf[model_index].innov(0) = _ekf_gsf[model_index].X(0) - vel_NE(0);
-	_ekf_gsf[model_index].innov(1) = _ekf_gsf[model_index].X(1) - vel_NE(1);
-
-	matrix::Matrix<float, 3, 2> K;
-	matrix::SquareMatrix<float, 3> P_new;
+	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+		// calculate velocity observation innovations
+		const float innov_n = _ekf_gsf.X[0][model_index] - vel_NE(0);
+		const float innov_e = _ekf_gsf.X[1][model_index] - vel_NE(1);
+		_ekf_gsf.innov[0][model_index] = innov_n;
+		_ekf_gsf.innov[1][model_index] = innov_e;
+
+		matrix::Matrix<float, 3, 2> K;
+		matrix::SquareMatrix<float, 2> S_inverse;
+		SquareMatrix3f P_new;
+
+		sym::YawEstComputeMeasurementUpdate(ekfCovariance(model_index),
+						    vel_obs_var,
+						    FLT_EPSILON,
+						    &S_inverse,
+						    &_ekf_gsf.S_det_inverse[model_index],
+						    &K,
+						    &P_new);
+
+		setEkfCovariance(model_index, P_new);
+
+		for (uint8_t row = 0; row < 2; row++) {
+			for (uint8_t col = 0; col < 2; col++) {
+				_ekf_gsf.S_inverse[row][col][model_index] = S_inverse(row, col);
+			}
+		}
 
-	sym::YawEstComputeMeasurementUpdate(_ekf_gsf[model_index].P,
-					    vel_obs_var,
-					    FLT_EPSILON,
-					    &_ekf_gsf[model_index].S_inverse,
-					    &_ekf_gsf[model_index].S_det_inverse,
-					    &K,
-					    &P_new);
+		// test ratio = transpose(innovation) * inverse(innovation variance) * innovation = [1x2] * [2,2] * [2,1] = [1,1]
+		const float test_ratio = innov_n * (S_inverse(0, 0) * innov_n + S_inverse(0, 1) * innov_e)
+					 + innov_e * (S_inverse(1, 0) * innov_n + S_inverse(1, 1) * innov_e);
 
-	_ekf_gsf[model_index].P = P_new;
+		// Perform a chi-square innovation consistency test and calculate a compression scale factor
+		// that limits the magnitude of innovations to 5-sigma
+		// If the test ratio is greater than 25 (5 Sigma) then reduce the length of the innovation vector to clip it at 5-Sigma
+		// This protects from large measurement spikes
+		const float innov_comp_scale_factor = test_ratio > 25.f ? sqrtf(25.0f / test_ratio) : 1.f;
 
-	// copy upper to lower diagonal
-	_ekf_gsf[model_index].P(1, 0) = _ekf_gsf[model_index].P(0, 1);
-	_ekf_gsf[model_index].P(2, 0) = _ekf_gsf[model_index].P(0, 2);
-	_ekf_gsf[model_index].P(2, 1) = _ekf_gsf[model_index].P(1, 2);
+		// Correct the state vector and capture the change in yaw angle
+		const float oldYaw = _ekf_gsf.X[2][model_index];
 
-	// constrain variances
-	const float min_var = 1e-6f;
+		for (uint8_t row = 0; row < 3; row++) {
+			_ekf_gsf.X[row][model_index] -= (K(row, 0) * innov_n + K(row, 1) * innov_e) * innov_comp_scale_factor;
+		}
 
-	for (unsigned index = 0; index < 3; index++) {
-		_ekf_gsf[model_index].P(index, index) = fmaxf(_ekf_gsf[model_index].P(index, index), min_var);
-	}
+		const float yawDelta = _ekf_gsf.X[2][model_index] - oldYaw;
 
-	// test ratio = transpose(innovation) * inverse(innovation variance) * innovation = [1x2] * [2,2] * [2,1] = [1,1]
-	const float test_ratio = _ekf_gsf[model_index].innov * (_ekf_gsf[model_index].S_inverse * _ekf_gsf[model_index].innov);
+		// apply the change in yaw angle to the AHRS
+		// take advantage of sparseness in the yaw rotation matrix
+		const float cosYaw = cosf(yawDelta);
+		const float sinYaw = sinf(yawDelta);
 
-	// Perform a chi-square innovation consistency test and calculate a compression scale factor
-	// that limits the magnitude of innovations to 5-sigma
-	// If the test ratio is greater than 25 (5 Sigma) then reduce the length of the innovation vector to clip it at 5-Sigma
-	// This protects from large measurement spikes
-	const float innov_comp_scale_factor = test_ratio > 25.f ? sqrtf(25.0f / test_ratio) : 1.f;
+		for (uint8_t col = 0; col < 3; col++) {
+			const float R_prev0 = _ahrs_ekf_gsf.R[0][col][model_index];
+			const float R_prev1 = _ahrs_ekf_gsf.R[1][col][model_index];
 
-	// Correct the state vector and capture the change in yaw angle
-	const float oldYaw = _ekf_gsf[model_index].X(2);
+			_ahrs_ekf_gsf.R[0][col][model_index] = R_prev0 * cosYaw - R_prev1 * sinYaw;
+			_ahrs_ekf_gsf.R[1][col][model_index] = R_prev0 * sinYaw + R_prev1 * cosYaw;
+		}
+	}
 
-	_ekf_gsf[model_index].X -= (K * _ekf_gsf[model_index].innov) * innov_comp_scale_factor;
+	constrainCovariances();
 
-	const float yawDelta = _ekf_gsf[model_index].X(2) - oldYaw;
+	return true;
+}
 
-	// apply the change in yaw angle to the AHRS
-	// take advantage of sparseness in the yaw rotation matrix
-	const float cosYaw = cosf(yawDelta);
-	const float sinYaw = sinf(yawDelta);
-	const float R_prev00 = _ahrs_ekf_gsf[model_index].R(0, 0);
-	const float R_prev01 = _ahrs_ekf_gsf[model_index].R(0, 1);
-	const float R_prev02 = _ahrs_ekf_gsf[model_index].R(0, 2);
+void EKFGSF_yaw::constrainCovariances()
+{
+	// covariance matrix is symmetrical, so copy upper half to lower half
+	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+		_ekf_gsf.P[1][0][model_index] = _ekf_gsf.P[0][1][model_index];
+		_ekf_gsf.P[2][0][model_index] = _ekf_gsf.P[0][2][model_index];
+		_ekf_gsf.P[2][1][model_index] = _ekf_gsf.P[1][2][model_index];
+	}
 
-	_ahrs_ekf_gsf[model_index].R(0, 0) = R_prev00 * cosYaw - _ahrs_ekf_gsf[model_index].R(1, 0) * sinYaw;
-	_ahrs_ekf_gsf[model_index].R(0, 1) = R_prev01 * cosYaw - _ahrs_ekf_gsf[model_index].R(1, 1) * sinYaw;
-	_ahrs_ekf_gsf[model_index].R(0, 2) = R_prev02 * cosYaw - _ahrs_ekf_gsf[model_index].R(1, 2) * sinYaw;
-	_ahrs_ekf_gsf[model_index].R(1, 0) = R_prev00 * sinYaw + _ahrs_ekf_gsf[model_index].R(1, 0) * cosYaw;
-	_ahrs_ekf_gsf[model_index].R(1, 1) = R_prev01 * sinYaw + _ahrs_ekf_gsf[model_index].R(1, 1) * cosYaw;
-	_ahrs_ekf_gsf[model_index].R(1, 2) = R_prev02 * sinYaw + _ahrs_ekf_gsf[model_index].R(1, 2) * cosYaw;
+	// constrain variances
+	const float min_var = 1e-6f;
 
-	return true;
+	for (uint8_t index = 0; index < 3; index++) {
+		for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+			_ekf_gsf.P[index][index][model_index] = fmaxf(_ekf_gsf.P[index][index][model_index], min_var);
+		}
+	}
 }
 
 void EKFGSF_yaw::initialiseEKFGSF(const Vector2f &vel_NE, const float vel_accuracy)
@@ -396,30 +439,33 @@ void EKFGSF_yaw::initialiseEKFGSF(const Vector2f &vel_NE, const float vel_accura
 
 	const float yaw_increment = 2.f * M_PI_F / (float)N_MODELS_EKFGSF;
 
-	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
-		_ekf_gsf[model_index] = {};
+	_ekf_gsf = {};
 
+	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
 		// evenly space initial yaw estimates in the region between +-Pi
-		_ekf_gsf[model_index].X(2) = -M_PI_F + (0.5f * yaw_increment) + ((float)model_index * yaw_increment);
+		_ekf_gsf.X[2][model_index] = -M_PI_F + (0.5f * yaw_increment) + ((float)model_index * yaw_increment);
 
 		// take velocity states and corresponding variance from last measurement
-		_ekf_gsf[model_index].X(0) = vel_NE(0);
-		_ekf_gsf[model_index].X(1) = vel_NE(1);
+		_ekf_gsf.X[0][model_index] = vel_NE(0);
+		_ekf_gsf.X[1][model_index] = vel_NE(1);
 
-		_ekf_gsf[model_index].P(0, 0) = sq(fmaxf(vel_accuracy, 0.01f));
-		_ekf_gsf[model_index].P(1, 1) = _ekf_gsf[model_index].P(0, 0);
+		_ekf_gsf.P[0][0][model_index] = sq(fmaxf(vel_accuracy, 0.01f));
+		_ekf_gsf.P[1][1][model_index] = _ekf_gsf.P[0][0][model_index];
 
 		// use half yaw interval for yaw uncertainty
-		_ekf_gsf[model_index].P(2, 2) = sq(0.5f * yaw_increment);
+		_ekf_gsf.P[2][2][model_index] = sq(0.5f * yaw_increment);
 	}
 }
 
 float EKFGSF_yaw::gaussianDensity(const uint8_t model_index) const
 {
 	// calculate transpose(innovation) * inv(S) * innovation
-	const float normDist = _ekf_gsf[model_index].innov.dot(_ekf_gsf[model_index].S_inverse * _ekf_gsf[model_index].innov);
+	const float innov_n = _ekf_gsf.innov[0][model_index];
+	const float innov_e = _ekf_gsf.innov[1][model_index];
+	const float normDist = innov_n * (_ekf_gsf.S_inverse[0][0][model_index] * innov_n + _ekf_gsf.S_inverse[0][1][model_index] * innov_e)
+			       + innov_e * (_ekf_gsf.S_inverse[1][0][model_index] * innov_n + _ekf_gsf.S_inverse[1][1][model_index] * innov_e);
 
-	return (1.f / (2.f * M_PI_F)) * sqrtf(_ekf_gsf[model_index].S_det_inverse) * expf(-0.5f * normDist);
+	return (1.f / (2.f * M_PI_F)) * sqrtf(_ekf_gsf.S_det_inverse[model_index]) * expf(-0.5f * normDist);
 }
 
 bool EKFGSF_yaw::getLogData(float *yaw_composite, float *yaw_variance, float yaw[N_MODELS_EKFGSF],
@@ -430,9 +476,9 @@ bool EKFGSF_yaw::getLogData(float *yaw_composite, float *yaw_variance, float yaw
 		*yaw_variance = _gsf_yaw_variance;
 
 		for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
-			yaw[model_index] = _ekf_gsf[model_index].X(2);
-			innov_VN[model_index] = _ekf_gsf[model_index].innov(0);
-			innov_VE[model_index] = _ekf_gsf[model_index].innov(1);
+			yaw[model_index] = _ekf_gsf.X[2][model_index];
+			innov_VN[model_index] = _ekf_gsf.innov[0][model_index];
+			innov_VE[model_index] = _ekf_gsf.innov[1][model_index];
 			weight[model_index] = _model_weights(model_index);
 		}
 
@@ -463,29 +509,72 @@ float EKFGSF_yaw::ahrsCalcAccelGain() const
 	return _tilt_gain * sq(1.f - math::min(attenuation * fabsf(delta_accel_g), 1.f));
 }
 
-Matrix3f EKFGSF_yaw::ahrsPredictRotMat(const Matrix3f &R, const Vector3f &g)
+void EKFGSF_yaw::ahrsPredictRotMat(const float g[3][N_MODELS_EKFGSF])
 {
-	Matrix3f ret = R;
-	ret(0, 0) += R(0, 1) * g(2) - R(0, 2) * g(1);
-	ret(0, 1) += R(0, 2) * g(0) - R(0, 0) * g(2);
-	ret(0, 2) += R(0, 0) * g(1) - R(0, 1) * g(0);
-	ret(1, 0) += R(1, 1) * g(2) - R(1, 2) * g(1);
-	ret(1, 1) += R(1, 2) * g(0) - R(1, 0) * g(2);
-	ret(1, 2) += R(1, 0) * g(1) - R(1, 1) * g(0);
-	ret(2, 0) += R(2, 1) * g(2) - R(2, 2) * g(1);
-	ret(2, 1) += R(2, 2) * g(0) - R(2, 0) * g(2);
-	ret(2, 2) += R(2, 0) * g(1) - R(2, 1) * g(0);
-
-	// Renormalise rows
+	float (&R)[3][3][N_MODELS_EKFGSF] = _ahrs_ekf_gsf.R;
+
 	for (uint8_t r = 0; r < 3; r++) {
-		const float rowLengthSq = ret.row(r).norm_squared();
+		for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+			const float R0 = R[r][0][model_index];
+			const float R1 = R[r][1][model_index];
+			const float R2 = R[r][2][model_index];
 
-		if (rowLengthSq > FLT_EPSILON) {
+			const float ret0 = R0 + (R1 * g[2][model_index] - R2 * g[1][model_index]);
+			const float ret1 = R1 + (R2 * g[0][model_index] - R0 * g[2][model_index]);
+			const float ret2 = R2 + (R0 * g[1][model_index] - R1 * g[0][model_index]);
+
+			// Renormalise rows
 			// Use linear approximation for inverse sqrt taking advantage of the row length being close to 1.0
-			const float rowLengthInv = 1.5f - 0.5f * rowLengthSq;
-			ret.row(r) *= rowLengthInv;
+			const float rowLengthSq = ret0 * ret0 + ret1 * ret1 + ret2 * ret2;
+			const float rowLengthInv = (rowLengthSq > FLT_EPSILON) ? (1.5f - 0.5f * rowLengthSq) : 1.f;
+
+			R[r][0][model_index] = ret0 * rowLengthInv;
+			R[r][1][model_index] = ret1 * rowLengthInv;
+			R[r][2][model_index] = ret2 * rowLengthInv;
+		}
+	}
+}
+
+Dcmf EKFGSF_yaw::ahrsRotMat(const uint8_t model_index) const
+{
+	Dcmf R;
+
+	for (uint8_t row = 0; row < 3; row++) {
+		for (uint8_t col = 0; col < 3; col++) {
+			R(row, col) = _ahrs_ekf_gsf.R[row][col][model_index];
 		}
 	}
 
-	return ret;
+	return R;
+}
+
+void EKFGSF_yaw::setAhrsRotMat(const uint8_t model_index, const Dcmf &R)
+{
+	for (uint8_t row = 0; row < 3; row++) {
+		for (uint8_t col = 0; col < 3; col++) {
+			_ahrs_ekf_gsf.R[row][col][model_index] = R(row, col);
+		}
+	}
+}
+
+SquareMatrix3f EKFGSF_yaw::ekfCovariance(const uint8_t model_index) const
+{
+	SquareMatrix3f P;
+
+	for (uint8_t row = 0; row < 3; row++) {
+		for (uint8_t col = 0; col < 3; col++) {
+			P(row, col) = _ekf_gsf.P[row][col][model_index];
+		}
+	}
+
+	return P;
+}
+
+void EKFGSF_yaw::setEkfCovariance(const uint8_t model_index, const SquareMatrix3f &P)
+{
+	for (uint8_t row = 0; row < 3; row++) {
+		for (uint8_t col = 0; col < 3; col++) {
+			_ekf_gsf.P[row][col][model_index] = P(row, col);
+		}
+	}
 }
@@ -37,7 +37,11 @@
 #include <lib/mathlib/mathlib.h>
 #include <lib/matrix/matrix/math.hpp>
 
+#if defined(CONFIG_EKF2_GSF_MODELS)
+static constexpr uint8_t N_MODELS_EKFGSF = CONFIG_EKF2_GSF_MODELS;
+#else
 static constexpr uint8_t N_MODELS_EKFGSF = 5;
+#endif // CONFIG_EKF2_GSF_MODELS
 
 class EKFGSF_yaw
 {
@@ -61,8 +65,10 @@ public:
 		// uncorrected rate gyro bias error about the gravity vector
 		if (!_ahrs_ekf_gsf_tilt_aligned || !_ekf_gsf_vel_fuse_started || force) {
 			// init gyro bias for each model
-			for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
-				_ahrs_ekf_gsf[model_index].gyro_bias = imu_gyro_bias;
+			for (uint8_t axis = 0; axis < 3; axis++) {
+				for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+					_ahrs_ekf_gsf.gyro_bias[axis][model_index] = imu_gyro_bias(axis);
+				}
 			}
 		}
 	}
@@ -93,10 +99,12 @@ private:
 	// Declarations used by the bank of N_MODELS_EKFGSF AHRS complementary filters
 	float _true_airspeed{NAN};	// true airspeed used for centripetal accel compensation (m/s)
 
+	// The bank is stored as a structure of arrays: every element holds one lane per model so that
+	// all models are processed in lockstep by loops over contiguous data the compiler can vectorise.
 	struct {
-		matrix::Dcmf R{matrix::eye<float, 3>()}; // matrix that rotates a vector from body to earth frame
-		matrix::Vector3f gyro_bias{};            // gyro bias learned and used by the quaternion calculation
-	} _ahrs_ekf_gsf[N_MODELS_EKFGSF] {};
+		float R[3][3][N_MODELS_EKFGSF];       // matrix that rotates a vector from body to earth frame
+		float gyro_bias[3][N_MODELS_EKFGSF];  // gyro bias learned and used by the quaternion calculation
+	} _ahrs_ekf_gsf{};
 
 	bool _ahrs_ekf_gsf_tilt_aligned{false};  // true the initial tilt alignment has been calculated
 	matrix::Vector3f _ahrs_accel{0.f, 0.f, 0.f};     // low pass filtered body frame specific force vector used by AHRS calculation (m/s/s)
@@ -104,8 +112,8 @@ private:
 	// calculate the gain from gravity vector misalingment to tilt correction to be used by all AHRS filters
 	float ahrsCalcAccelGain() const;
 
-	// update specified AHRS rotation matrix using IMU and optionally true airspeed data
-	void ahrsPredict(const uint8_t model_index, const matrix::Vector3f &delta_ang, const float delta_ang_dt);
+	// update all AHRS rotation matrices using IMU and optionally true airspeed data
+	void ahrsPredict(const matrix::Vector3f &delta_ang, const float delta_ang_dt);
 
 	// align all AHRS roll and pitch orientations using IMU delta velocity vector
 	void ahrsAlignTilt(const matrix::Vector3f &delta_vel);
@@ -113,31 +121,40 @@ private:
 	// align all AHRS yaw orientations to initial values
 	void ahrsAlignYaw();
 
-	// Efficient propagation of a delta angle in body frame applied to the body to earth frame rotation matrix
-	matrix::Matrix3f ahrsPredictRotMat(const matrix::Matrix3f &R, const matrix::Vector3f &g);
+	// Efficient propagation of the per model delta angles in body frame applied to the body to earth frame rotation matrices
+	void ahrsPredictRotMat(const float g[3][N_MODELS_EKFGSF]);
+
+	matrix::Dcmf ahrsRotMat(const uint8_t model_index) const;
+	void setAhrsRotMat(const uint8_t model_index, const matrix::Dcmf &R);
 
 	// Declarations used by a bank of N_MODELS_EKFGSF EKFs
 
 	struct {
-		matrix::Vector3f X{};                       // Vel North (m/s),  Vel East (m/s), yaw (rad)s
-		matrix::SquareMatrix<float, 3> P{};         // covariance matrix
-		matrix::SquareMatrix<float, 2> S_inverse{}; // inverse of the innovation covariance matrix
-		float S_det_inverse{};                      // inverse of the innovation covariance matrix determinant
-		matrix::Vector2f innov{};                   // Velocity N,E innovation (m/s)
-	} _ekf_gsf[N_MODELS_EKFGSF] {};
+		float X[3][N_MODELS_EKFGSF];            // Vel North (m/s),  Vel East (m/s), yaw (rad)s
+		float P[3][3][N_MODELS_EKFGSF];         // covariance matrix
+		float S_inverse[2][2][N_MODELS_EKFGSF]; // inverse of the innovation covariance matrix
+		float S_det_inverse[N_MODELS_EKFGSF];   // inverse of the innovation covariance matrix determinant
+		float innov[2][N_MODELS_EKFGSF];        // Velocity N,E innovation (m/s)
+	} _ekf_gsf{};
 
 	bool _ekf_gsf_vel_fuse_started{}; // true when the EKF's have started fusing velocity data and the prediction and update processing is active
 
 	// initialise states and covariance data for the GSF and EKF filters
 	void initialiseEKFGSF(const matrix::Vector2f &vel_NE, const float vel_accuracy);
 
-	// predict state and covariance for the specified EKF using inertial data
-	void predictEKF(const uint8_t model_index, const matrix::Vector3f &delta_ang, const float delta_ang_dt,
+	// predict state and covariance for all EKFs using inertial data
+	void predictEKF(const matrix::Vector3f &delta_ang, const float delta_ang_dt,
 			const matrix::Vector3f &delta_vel, const float delta_vel_dt, bool in_air = false);
 
-	// update state and covariance for the specified EKF using a NE velocity measurement
+	// update state and covariance for all EKFs using a NE velocity measurement
 	// return false if update failed
-	bool updateEKF(const uint8_t model_index, const matrix::Vector2f &vel_NE, const float vel_accuracy);
+	bool updateEKF(const matrix::Vector2f &vel_NE, const float vel_accuracy);
+
+	// copy upper to lower diagonal and constrain the variances of all covariance matrices
+	void constrainCovariances();
+
+	matrix::SquareMatrix3f ekfCovariance(const uint8_t model_index) const;
+	void setEkfCovariance(const uint8_t model_index, const matrix::SquareMatrix3f &P);
 
 	inline float sq(float x) const { return x * x; };
 
@@ -45,8 +45,15 @@ static constexpr float kMaxDelaySecondsExternalPosMeasurement = 15.0f; // [s]
 
 pthread_mutex_t ekf2_module_mutex = PTHREAD_MUTEX_INITIALIZER;
 static px4::atomic<EKF2 *> _objects[EKF2_MAX_INSTANCES] {};
+#if defined(CONFIG_EKF2_FAST_ODOMETRY)
+static px4::atomic<EKF2FastOdometry *> _ekf2_fast_odometry {nullptr};
+#endif // CONFIG_EKF2_FAST_ODOMETRY
 #if defined(CONFIG_EKF2_MULTI_INSTANCE)
 static px4::atomic<EKF2Selector *> _ekf2_selector {nullptr};
+
+#if defined(CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING)
+SharedImuDownSampler EKF2::_shared_imu_down_samplers[EKF2::MAX_NUM_IMUS] {};
+#endif // CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING
 #endif // CONFIG_EKF2_MULTI_INSTANCE
 
 EKF2::EKF2(bool multi_mode, const px4::wq_config_t &config, bool replay_mode):
@@ -232,6 +239,7 @@ EKF2::~EKF2()
 {
 	perf_free(_ekf_update_perf);
 	perf_free(_msg_missed_imu_perf);
+	perf_free(_diagnostics_perf);
 }
 
 #if defined(CONFIG_EKF2_MULTI_INSTANCE)
@@ -351,6 +359,14 @@ bool EKF2::multi_init(int imu, int mag)
 
 	bool changed_instance = _vehicle_imu_sub.ChangeInstance(imu);
 
+#if defined(CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING)
+
+	if ((imu >= 0) && (imu < MAX_NUM_IMUS)) {
+		_shared_imu_down_sampler = &_shared_imu_down_samplers[imu];
+	}
+
+#endif // CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING
+
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 
 	if (!_magnetometer_sub.ChangeInstance(mag)) {
@@ -387,6 +403,7 @@ int EKF2::print_status(bool verbose)
 
 	perf_print_counter(_ekf_update_perf);
 	perf_print_counter(_msg_missed_imu_perf);
+	perf_print_counter(_diagnostics_perf);
 
 	if (verbose) {
 #if defined(CONFIG_EKF2_VERBOSE_STATUS)
@@ -441,6 +458,19 @@ void EKF2::Run()
 		_ekf.updateParameters();
 	}
 
+	if (_load_shedding_sub.updated()) {
+		load_shedding_s load_shedding;
+
+		if (_load_shedding_sub.copy(&load_shedding)) {
+			const bool shed = load_shedding.shed & load_shedding_s::SHED_EKF2_DIAGNOSTICS;
+
+			if (shed != _diagnostics_load_shedding) {
+				PX4_INFO("%d - load shedding: %s diagnostics rate", _instance, shed ? "reducing" : "restoring");
+				_diagnostics_load_shedding = shed;
+			}
+		}
+	}
+
 	if (!_callback_registered) {
 #if defined(CONFIG_EKF2_MULTI_INSTANCE)
 
@@ -649,7 +679,26 @@ void EKF2::Run()
 		const hrt_abstime now = imu_sample_new.time_us;
 
 		// push imu data into estimator
-		_ekf.setIMUData(imu_sample_new);
+#if defined(CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING)
+
+		if (_shared_imu_down_sampler) {
+			imuSample imu_down_sampled;
+			const bool down_sampled = _shared_imu_down_sampler->update(imu_sample_new, _param_ekf2_predict_us.get(),
+						  _shared_imu_down_sampled_time_us, imu_down_sampled);
+
+			_ekf.setIMUData(imu_sample_new, down_sampled ? &imu_down_sampled : nullptr);
+
+		} else
+#endif // CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING
+		{
+			_ekf.setIMUData(imu_sample_new);
+		}
+
+		if (_replay_mode) {
+			// replay started in the middle of a log
+			UpdateSnapshotRestore();
+		}
+
 		PublishAttitude(now); // publish attitude immediately (uses quaternion from output predictor)
 
 		// integrate time to monitor time slippage
@@ -716,36 +765,20 @@ void EKF2::Run()
 
 			// publish status/logging messages
 			PublishEventFlags(now);
-			PublishInnovations(now);
-			PublishInnovationTestRatios(now);
-			PublishInnovationVariances(now);
-			PublishStates(now);
-			PublishStatus(now);
+			PublishSnapshot(now);
+			PublishStatus(now); // estimator_status is used by the selector, keep it at the full rate
 			PublishStatusFlags(now);
-			PublishAidSourceStatus(now);
-
-#if defined(CONFIG_EKF2_BAROMETER)
-			PublishBaroBias(now);
-#endif // CONFIG_EKF2_BAROMETER
-
-#if defined(CONFIG_EKF2_RANGE_FINDER)
-			PublishRngHgtBias(now);
-#endif // CONFIG_EKF2_RANGE_FINDER
-
-#if defined(CONFIG_EKF2_EXTERNAL_VISION)
-			PublishEvPosBias(now);
-#endif // CONFIG_EKF2_EXTERNAL_VISION
 
 #if defined(CONFIG_EKF2_GNSS)
-			PublishGnssHgtBias(now);
 			PublishGpsStatus(now);
-			PublishYawEstimatorStatus(now);
 #endif // CONFIG_EKF2_GNSS
 
 #if defined(CONFIG_EKF2_OPTICAL_FLOW)
 			PublishOpticalFlowVel(now);
 #endif // CONFIG_EKF2_OPTICAL_FLOW
 
+			PublishDiagnostics(now);
+
 			UpdateAccelCalibration(now);
 			UpdateGyroCalibration(now);
 #if defined(CONFIG_EKF2_MAGNETOMETER)
@@ -862,6 +895,80 @@ void EKF2::VerifyParams()
 	}
 }
 
+void EKF2::PublishDiagnostics(const hrt_abstime &timestamp)
+{
+	// Diagnostic topics are published every EKF2_DIAG_DECIM filter updates. Each slot gets its own
+	// phase so that the publications are spread over the cycles instead of all landing on the same one.
+	// While shed by load_mon the decimation is increased further.
+	const int32_t decimation = math::max(_param_ekf2_diag_decim.get(), static_cast<int32_t>(1))
+				   * (_diagnostics_load_shedding ? DIAGNOSTICS_LOAD_SHEDDING_DECIMATION : 1);
+	const int32_t phase = _diagnostics_phase % decimation;
+
+	enum DiagnosticsSlot : int32_t {
+		Innovations,
+		InnovationTestRatios,
+		InnovationVariances,
+		States,
+		AidSourceStatus,
+		HeightBiases,
+		YawEstimatorStatus,
+	};
+
+	const auto due = [decimation, phase](DiagnosticsSlot slot) { return (slot % decimation) == phase; };
+
+	perf_begin(_diagnostics_perf);
+
+	if (due(Innovations)) {
+		PublishInnovations(timestamp);
+	}
+
+	if (due(InnovationTestRatios)) {
+		PublishInnovationTestRatios(timestamp);
+	}
+
+	if (due(InnovationVariances)) {
+		PublishInnovationVariances(timestamp);
+	}
+
+	if (due(States)) {
+		PublishStates(timestamp);
+	}
+
+	if (due(AidSourceStatus)) {
+		PublishAidSourceStatus(timestamp);
+	}
+
+	if (due(HeightBiases)) {
+#if defined(CONFIG_EKF2_BAROMETER)
+		PublishBaroBias(timestamp);
+#endif // CONFIG_EKF2_BAROMETER
+
+#if defined(CONFIG_EKF2_RANGE_FINDER)
+		PublishRngHgtBias(timestamp);
+#endif // CONFIG_EKF2_RANGE_FINDER
+
+#if defined(CONFIG_EKF2_EXTERNAL_VISION)
+		PublishEvPosBias(timestamp);
+#endif // CONFIG_EKF2_EXTERNAL_VISION
+
+#if defined(CONFIG_EKF2_GNSS)
+		PublishGnssHgtBias(timestamp);
+#endif // CONFIG_EKF2_GNSS
+	}
+
+#if defined(CONFIG_EKF2_GNSS)
+
+	if (due(YawEstimatorStatus)) {
+		PublishYawEstimatorStatus(timestamp);
+	}
+
+#endif // CONFIG_EKF2_GNSS
+
+	perf_end(_diagnostics_perf);
+
+	_diagnostics_phase = (phase + 1) % decimation;
+}
+
 void EKF2::PublishAidSourceStatus(const hrt_abstime &timestamp)
 {
 #if defined(CONFIG_EKF2_AIRSPEED)
@@ -1786,6 +1893,71 @@ void EKF2::PublishStates(const hrt_abstime &timestamp)
 	_estimator_states_pub.publish(states);
 }
 
+void EKF2::PublishSnapshot(const hrt_abstime &timestamp)
+{
+	const hrt_abstime interval_us = static_cast<hrt_abstime>(_param_ekf2_snap_int.get() * 1e6f);
+
+	if ((interval_us == 0) || !_ekf.control_status_flags().tilt_align
+	    || (timestamp < _last_snapshot_published + interval_us)) {
+		return;
+	}
+
+	estimator_snapshot_s snapshot{};
+	snapshot.timestamp_sample = _ekf.time_delayed_us();
+	const auto state_vector = _ekf.state().vector();
+	state_vector.copyTo(snapshot.states);
+	snapshot.n_states = state_vector.size();
+	_ekf.covariances().upper_right_triangle().copyTo(snapshot.covariances);
+	snapshot.control_status = _ekf.control_status().value;
+	snapshot.yaw_align = _ekf.control_status_flags().yaw_align;
+
+	uint64_t origin_time;
+	snapshot.origin_valid = _ekf.getEkfGlobalOrigin(origin_time, snapshot.origin_lat, snapshot.origin_lon,
+				snapshot.origin_alt);
+
+	snapshot.timestamp = _replay_mode ? timestamp : hrt_absolute_time();
+	_estimator_snapshot_pub.publish(snapshot);
+
+	_last_snapshot_published = timestamp;
+}
+
+void EKF2::UpdateSnapshotRestore()
+{
+	estimator_snapshot_s snapshot;
+
+	if (_estimator_snapshot_restore_sub.update(&snapshot)) {
+		static_assert(sizeof(snapshot.states) == sizeof(StateSample), "snapshot doesn't match StateSample size");
+
+		if (snapshot.n_states != sizeof(snapshot.states) / sizeof(snapshot.states[0])) {
+			PX4_ERR("%d - state snapshot size mismatch (%d)", _instance, snapshot.n_states);
+			return;
+		}
+
+		StateSample state;
+		memcpy(&state, snapshot.states, sizeof(state));
+
+		// covariance upper right triangle (row-major)
+		Ekf::SquareMatrixState covariances;
+		size_t index = 0;
+
+		for (unsigned row = 0; row < State::size; row++) {
+			for (unsigned col = row; col < State::size; col++) {
+				covariances(row, col) = snapshot.covariances[index];
+				covariances(col, row) = snapshot.covariances[index];
+				index++;
+			}
+		}
+
+		if (_ekf.restoreState(state, covariances, snapshot.yaw_align,
+				      snapshot.origin_valid, snapshot.origin_lat, snapshot.origin_lon, snapshot.origin_alt)) {
+			PX4_INFO("%d - state restored from snapshot at %" PRIu64, _instance, snapshot.timestamp_sample);
+
+		} else {
+			PX4_WARN("%d - state snapshot restore failed", _instance);
+		}
+	}
+}
+
 void EKF2::PublishStatus(const hrt_abstime &timestamp)
 {
 	estimator_status_s status{};
@@ -1954,10 +2126,11 @@ void EKF2::PublishStatusFlags(const hrt_abstime &timestamp)
 #if defined(CONFIG_EKF2_GNSS)
 void EKF2::PublishYawEstimatorStatus(const hrt_abstime &timestamp)
 {
-	static_assert(sizeof(yaw_estimator_status_s::yaw) / sizeof(float) == N_MODELS_EKFGSF,
+	static_assert(sizeof(yaw_estimator_status_s::yaw) / sizeof(float) >= N_MODELS_EKFGSF,
 		      "yaw_estimator_status_s::yaw wrong size");
 
-	yaw_estimator_status_s yaw_est_test_data;
+	// unused model slots are published as zero
+	yaw_estimator_status_s yaw_est_test_data{};
 
 	if (_ekf.getDataEKFGSF(&yaw_est_test_data.yaw_composite, &yaw_est_test_data.yaw_variance,
 			       yaw_est_test_data.yaw,
@@ -2863,6 +3036,24 @@ int EKF2::task_spawn(int argc, char *argv[])
 		}
 	}
 
+#if defined(CONFIG_EKF2_FAST_ODOMETRY)
+	int32_t fast_odometry = 0;
+	param_get(param_find("EKF2_FAST_ODOM"), &fast_odometry);
+
+	if (success && !replay_mode && (fast_odometry != 0) && (_ekf2_fast_odometry.load() == nullptr)) {
+		EKF2FastOdometry *inst = new EKF2FastOdometry();
+
+		if (inst && inst->Start()) {
+			_ekf2_fast_odometry.store(inst);
+
+		} else {
+			PX4_ERR("Failed to start EKF2 fast odometry");
+			delete inst;
+		}
+	}
+
+#endif // CONFIG_EKF2_FAST_ODOMETRY
+
 	return success ? PX4_OK : PX4_ERROR;
 }
 
@@ -2951,6 +3142,12 @@ extern "C" __EXPORT int ekf2_main(int argc, char *argv[])
 			}
 #endif // CONFIG_EKF2_MULTI_INSTANCE
 
+#if defined(CONFIG_EKF2_FAST_ODOMETRY)
+			if (_ekf2_fast_odometry.load()) {
+				_ekf2_fast_odometry.load()->PrintStatus();
+			}
+#endif // CONFIG_EKF2_FAST_ODOMETRY
+
 			bool verbose_status = false;
 
 #if defined(CONFIG_EKF2_VERBOSE_STATUS)
@@ -2998,6 +3195,16 @@ extern "C" __EXPORT int ekf2_main(int argc, char *argv[])
 			// otherwise stop everything
 			bool was_running = false;
 
+#if defined(CONFIG_EKF2_FAST_ODOMETRY)
+			if (_ekf2_fast_odometry.load()) {
+				PX4_INFO("stopping ekf2 fast odometry");
+				_ekf2_fast_odometry.load()->Stop();
+				delete _ekf2_fast_odometry.load();
+				_ekf2_fast_odometry.store(nullptr);
+				was_running = true;
+			}
+#endif // CONFIG_EKF2_FAST_ODOMETRY
+
 #if defined(CONFIG_EKF2_MULTI_INSTANCE)
 			if (_ekf2_selector.load()) {
 				PX4_INFO("stopping ekf2 selector");
@@ -42,10 +42,17 @@
 #define EKF2_HPP
 
 #include "EKF/ekf.h"
+#if defined(CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING)
+# include "EKF/imu_down_sampler/shared_imu_down_sampler.hpp"
+#endif // CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING
 #include "Utility/PreFlightChecker.hpp"
 
 #include "EKF2Selector.hpp"
 
+#if defined(CONFIG_EKF2_FAST_ODOMETRY)
+# include "EKF2FastOdometry.hpp"
+#endif // CONFIG_EKF2_FAST_ODOMETRY
+
 #include <float.h>
 
 #include <containers/LockGuard.hpp>
@@ -70,9 +77,11 @@
 #include <uORB/topics/estimator_event_flags.h>
 #include <uORB/topics/estimator_innovations.h>
 #include <uORB/topics/estimator_sensor_bias.h>
+#include <uORB/topics/estimator_snapshot.h>
 #include <uORB/topics/estimator_states.h>
 #include <uORB/topics/estimator_status.h>
 #include <uORB/topics/estimator_status_flags.h>
+#include <uORB/topics/load_shedding.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_combined.h>
 #include <uORB/topics/sensor_selection.h>
@@ -165,6 +174,7 @@ private:
 	void VerifyParams();
 
 	void PublishAidSourceStatus(const hrt_abstime &timestamp);
+	void PublishDiagnostics(const hrt_abstime &timestamp);
 	void PublishAttitude(const hrt_abstime &timestamp);
 
 #if defined(CONFIG_EKF2_BAROMETER)
@@ -188,9 +198,12 @@ private:
 	void PublishLocalPosition(const hrt_abstime &timestamp);
 	void PublishOdometry(const hrt_abstime &timestamp, const imuSample &imu_sample);
 	void PublishSensorBias(const hrt_abstime &timestamp);
+	void PublishSnapshot(const hrt_abstime &timestamp);
 	void PublishStates(const hrt_abstime &timestamp);
 	void PublishStatus(const hrt_abstime &timestamp);
 	void PublishStatusFlags(const hrt_abstime &timestamp);
+
+	void UpdateSnapshotRestore();
 #if defined(CONFIG_EKF2_WIND)
 	void PublishWindEstimate(const hrt_abstime &timestamp);
 #endif // CONFIG_EKF2_WIND
@@ -252,11 +265,13 @@ private:
 	void PublishAidSourceStatus(const T &status, hrt_abstime &status_publish_last, uORB::PublicationMulti<T> &pub)
 	{
 		if (status.timestamp_sample > status_publish_last) {
-			// publish if updated
-			T status_out{status};
-			status_out.estimator_instance = _instance;
-			status_out.timestamp = hrt_absolute_time();
-			pub.publish(status_out);
+			// publish if updated and someone (eg logger, mavlink) is subscribed
+			if (pub.has_subscribers()) {
+				T status_out{status};
+				status_out.estimator_instance = _instance;
+				status_out.timestamp = hrt_absolute_time();
+				pub.publish(status_out);
+			}
 
 			// record timestamp sample
 			status_publish_last = status.timestamp_sample;
@@ -269,6 +284,13 @@ private:
 	const bool _multi_mode;
 	int _instance{0};
 
+#if defined(CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING)
+	// instances using the same IMU run on the same INS work queue and share the down-sampling
+	static SharedImuDownSampler _shared_imu_down_samplers[MAX_NUM_IMUS];
+	SharedImuDownSampler *_shared_imu_down_sampler{nullptr};
+	uint64_t _shared_imu_down_sampled_time_us{0};
+#endif // CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING
+
 	px4::atomic_bool _task_should_exit{false};
 
 	// time slip monitoring
@@ -276,8 +298,9 @@ private:
 	uint64_t _start_time_us = 0;		///< system time at EKF start (uSec)
 	int64_t _last_time_slip_us = 0;		///< Last time slip (uSec)
 
-	perf_counter_t _ekf_update_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": EKF update")};
+	perf_counter_t _ekf_update_perf{perf_alloc(PC_HISTOGRAM, MODULE_NAME": EKF update")};
 	perf_counter_t _msg_missed_imu_perf{perf_alloc(PC_COUNT, MODULE_NAME": IMU message missed")};
+	perf_counter_t _diagnostics_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": diagnostics publish")};
 
 	InFlightCalibration _accel_cal{};
 	InFlightCalibration _gyro_cal{};
@@ -292,6 +315,12 @@ private:
 	Vector3f _last_gyro_bias_published{};
 
 	hrt_abstime _last_sensor_bias_published{0};
+	hrt_abstime _last_snapshot_published{0};
+
+	int32_t _diagnostics_phase{0}; ///< EKF update cycle within the diagnostics decimation period
+	bool _diagnostics_load_shedding{false}; ///< diagnostics decimated further by load_mon (SYS_SHED_EKF)
+
+	static constexpr int32_t DIAGNOSTICS_LOAD_SHEDDING_DECIMATION{4}; ///< additional diagnostics decimation while shed
 
 	hrt_abstime _status_fake_hgt_pub_last{0};
 	hrt_abstime _status_fake_pos_pub_last{0};
@@ -397,10 +426,12 @@ private:
 
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 
+	uORB::Subscription _load_shedding_sub{ORB_ID(load_shedding)};
 	uORB::Subscription _sensor_selection_sub{ORB_ID(sensor_selection)};
 	uORB::Subscription _status_sub{ORB_ID(vehicle_status)};
 	uORB::Subscription _vehicle_command_sub{ORB_ID(vehicle_command)};
 	uORB::Subscription _vehicle_land_detected_sub{ORB_ID(vehicle_land_detected)};
+	uORB::Subscription _estimator_snapshot_restore_sub{ORB_ID(estimator_snapshot_restore)};
 
 	uORB::SubscriptionCallbackWorkItem _sensor_combined_sub{this, ORB_ID(sensor_combined)};
 	uORB::SubscriptionCallbackWorkItem _vehicle_imu_sub{this, ORB_ID(vehicle_imu)};
@@ -438,6 +469,7 @@ private:
 	uORB::PublicationMulti<estimator_innovations_s>      _estimator_innovation_variances_pub{ORB_ID(estimator_innovation_variances)};
 	uORB::PublicationMulti<estimator_innovations_s>      _estimator_innovations_pub{ORB_ID(estimator_innovations)};
 	uORB::PublicationMulti<estimator_sensor_bias_s>      _estimator_sensor_bias_pub{ORB_ID(estimator_sensor_bias)};
+	uORB::PublicationMulti<estimator_snapshot_s>         _estimator_snapshot_pub{ORB_ID(estimator_snapshot)};
 	uORB::PublicationMulti<estimator_states_s>           _estimator_states_pub{ORB_ID(estimator_states)};
 	uORB::PublicationMulti<estimator_status_flags_s>     _estimator_status_flags_pub{ORB_ID(estimator_status_flags)};
 	uORB::PublicationMulti<estimator_status_s>           _estimator_status_pub{ORB_ID(estimator_status)};
@@ -731,7 +763,11 @@ private:
 
 		// output predictor filter time constants
 		(ParamFloat<px4::params::EKF2_TAU_VEL>) _param_ekf2_tau_vel,
-		(ParamFloat<px4::params::EKF2_TAU_POS>) _param_ekf2_tau_pos
+		(ParamFloat<px4::params::EKF2_TAU_POS>) _param_ekf2_tau_pos,
+
+		(ParamFloat<px4::params::EKF2_SNAP_INT>) _param_ekf2_snap_int,
+
+		(ParamInt<px4::params::EKF2_DIAG_DECIM>) _param_ekf2_diag_decim
 	)
 };
 #endif // !EKF2_HPP
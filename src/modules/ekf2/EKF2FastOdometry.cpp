@@ -0,0 +1,179 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "EKF2FastOdometry.hpp"
+
+#include <lib/geo/geo.h> // CONSTANTS_ONE_G
+
+using matrix::AxisAnglef;
+using matrix::Quatf;
+using matrix::Vector3f;
+
+EKF2FastOdometry::EKF2FastOdometry() :
+	ScheduledWorkItem("ekf2_fast_odometry", px4::wq_configurations::rate_ctrl)
+{
+	_vehicle_odometry_fast_pub.advertise();
+}
+
+EKF2FastOdometry::~EKF2FastOdometry()
+{
+	Stop();
+
+	perf_free(_cycle_perf);
+	perf_free(_reset_perf);
+}
+
+bool EKF2FastOdometry::Start()
+{
+	return _vehicle_angular_velocity_sub.registerCallback();
+}
+
+void EKF2FastOdometry::Stop()
+{
+	_vehicle_angular_velocity_sub.unregisterCallback();
+
+	ScheduleClear();
+}
+
+void EKF2FastOdometry::Run()
+{
+	perf_begin(_cycle_perf);
+
+	vehicle_acceleration_s vehicle_acceleration;
+
+	if (_vehicle_acceleration_sub.update(&vehicle_acceleration)) {
+		_acceleration = Vector3f{vehicle_acceleration.xyz};
+	}
+
+	vehicle_angular_velocity_s vehicle_angular_velocity;
+
+	if (_vehicle_angular_velocity_sub.update(&vehicle_angular_velocity)) {
+
+		ImuSample sample{};
+		sample.time_us = vehicle_angular_velocity.timestamp_sample;
+		sample.angular_velocity = Vector3f{vehicle_angular_velocity.xyz};
+		sample.acceleration = _acceleration;
+
+		_buffer_newest = (_buffer_newest + 1) % BUFFER_SIZE;
+		_buffer[_buffer_newest] = sample;
+		_buffer_count = math::min(_buffer_count + 1, static_cast<int>(BUFFER_SIZE));
+
+		vehicle_odometry_s vehicle_odometry;
+
+		if (_vehicle_odometry_sub.update(&vehicle_odometry)) {
+			// EKF2 correction, restart from its output and apply the newer gyro samples again
+			Reset(vehicle_odometry);
+			perf_count(_reset_perf);
+
+		} else if (_reference_valid) {
+			Propagate(sample);
+		}
+
+		if (_reference_valid) {
+			Publish(sample.angular_velocity);
+		}
+	}
+
+	perf_end(_cycle_perf);
+}
+
+void EKF2FastOdometry::Reset(const vehicle_odometry_s &odometry)
+{
+	_reference_valid = PX4_ISFINITE(odometry.q[0])
+			   && (odometry.pose_frame == vehicle_odometry_s::POSE_FRAME_NED)
+			   && (odometry.velocity_frame == vehicle_odometry_s::VELOCITY_FRAME_NED);
+
+	if (!_reference_valid) {
+		return;
+	}
+
+	_odometry_reference = odometry;
+
+	_time_us = odometry.timestamp_sample;
+	_q = Quatf{odometry.q};
+	_position = Vector3f{odometry.position};
+	_velocity = Vector3f{odometry.velocity};
+
+	// oldest to newest
+	for (uint8_t i = 0; i < _buffer_count; i++) {
+		const uint8_t index = (_buffer_newest + BUFFER_SIZE - _buffer_count + 1 + i) % BUFFER_SIZE;
+
+		if (_buffer[index].time_us > _time_us) {
+			Propagate(_buffer[index]);
+		}
+	}
+}
+
+void EKF2FastOdometry::Propagate(const ImuSample &sample)
+{
+	if (sample.time_us <= _time_us) {
+		return;
+	}
+
+	const float dt = math::min((sample.time_us - _time_us) * 1e-6f, DT_MAX);
+	_time_us = sample.time_us;
+
+	// attitude
+	_q = _q * Quatf{AxisAnglef{sample.angular_velocity * dt}};
+	_q.normalize();
+
+	// velocity and position, the specific force is rotated to the earth frame and gravity added back
+	const Vector3f acceleration = _q.rotateVector(sample.acceleration) + Vector3f{0.f, 0.f, CONSTANTS_ONE_G};
+
+	_position += _velocity * dt + acceleration * (0.5f * dt * dt);
+	_velocity += acceleration * dt;
+}
+
+void EKF2FastOdometry::Publish(const Vector3f &angular_velocity)
+{
+	// frames, variances, reset counter and quality are those of the last EKF2 output
+	vehicle_odometry_s odometry{_odometry_reference};
+	odometry.timestamp_sample = _time_us;
+
+	_position.copyTo(odometry.position);
+	_q.copyTo(odometry.q);
+	_velocity.copyTo(odometry.velocity);
+	angular_velocity.copyTo(odometry.angular_velocity);
+
+	odometry.timestamp = hrt_absolute_time();
+	_vehicle_odometry_fast_pub.publish(odometry);
+}
+
+void EKF2FastOdometry::PrintStatus()
+{
+	PX4_INFO_RAW("fast odometry: %s, last correction %.1f ms ago\n", _reference_valid ? "valid" : "invalid",
+		     _reference_valid ? (double)(hrt_elapsed_time(&_odometry_reference.timestamp) * 1e-3f) : -1.);
+
+	perf_print_counter(_cycle_perf);
+	perf_print_counter(_reset_perf);
+}
@@ -0,0 +1,117 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file EKF2FastOdometry.hpp
+ *
+ * Propagates the EKF2 output predictor state (vehicle_odometry) at the full
+ * gyro rate using vehicle_angular_velocity and vehicle_acceleration. Every new
+ * vehicle_odometry sample resets the propagation, the buffered gyro samples
+ * newer than it are applied again.
+ */
+
+#ifndef EKF2FASTODOMETRY_HPP
+#define EKF2FASTODOMETRY_HPP
+
+#include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
+#include <lib/matrix/matrix/math.hpp>
+#include <lib/perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/module.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
+#include <uORB/Publication.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/vehicle_acceleration.h>
+#include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_odometry.h>
+
+using namespace time_literals;
+
+class EKF2FastOdometry : public px4::ScheduledWorkItem
+{
+public:
+	EKF2FastOdometry();
+	~EKF2FastOdometry() override;
+
+	bool Start();
+	void Stop();
+
+	void PrintStatus();
+
+private:
+	static constexpr uint8_t BUFFER_SIZE{32};    ///< gyro samples kept to re-apply after a correction
+	static constexpr float DT_MAX{0.02f};        ///< longest integration step [s]
+
+	struct ImuSample {
+		hrt_abstime time_us{0};
+		matrix::Vector3f angular_velocity{};  ///< bias corrected angular velocity, FRD body frame [rad/s]
+		matrix::Vector3f acceleration{};      ///< bias corrected specific force, FRD body frame [m/s^2]
+	};
+
+	void Run() override;
+
+	// restart the propagation from an EKF2 output predictor sample
+	void Reset(const vehicle_odometry_s &odometry);
+
+	void Propagate(const ImuSample &sample);
+
+	void Publish(const matrix::Vector3f &angular_velocity);
+
+	uORB::SubscriptionCallbackWorkItem _vehicle_angular_velocity_sub{this, ORB_ID(vehicle_angular_velocity)};
+	uORB::Subscription _vehicle_acceleration_sub{ORB_ID(vehicle_acceleration)};
+	uORB::Subscription _vehicle_odometry_sub{ORB_ID(vehicle_odometry)};
+
+	uORB::Publication<vehicle_odometry_s> _vehicle_odometry_fast_pub{ORB_ID(vehicle_odometry_fast)};
+
+	ImuSample _buffer[BUFFER_SIZE] {};
+	uint8_t _buffer_newest{0};
+	uint8_t _buffer_count{0};
+
+	matrix::Vector3f _acceleration{};
+
+	// propagated state, NED earth frame
+	vehicle_odometry_s _odometry_reference{};
+	bool _reference_valid{false};
+
+	hrt_abstime _time_us{0};
+	matrix::Quatf _q{};
+	matrix::Vector3f _position{};
+	matrix::Vector3f _velocity{};
+
+	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": fast odometry")};
+	perf_counter_t _reset_perf{perf_alloc(PC_COUNT, MODULE_NAME": fast odometry correction")};
+};
+#endif // !EKF2FASTODOMETRY_HPP
@@ -0,0 +1,119 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Batch EKF replay: replays all given logs against all parameter sets in parallel
+ * and writes one line of summary metrics per log and parameter set.
+ *
+ * Usage: ekf2_batch_replay [-j <threads>] [-p <parameter sets file>] [-o <summary.csv>] <log.csv>...
+ *
+ * The logs are in the replay data format of the sensor simulator (see
+ * sensor_simulator/convertULogToSensorData.py). The parameter sets file contains
+ * one set per line: 'name EKF2_GPS_P_NOISE=0.3 EKF2_GPS_DELAY=80 ...'.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <unistd.h>
+
+#include "sensor_simulator/batch_replay.h"
+
+static void usage()
+{
+	std::cerr << "Usage: ekf2_batch_replay [-j <threads>] [-p <parameter sets file>] [-o <summary.csv>] <log.csv>..."
+		  << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+	BatchReplay batch_replay;
+	unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+	const char *output_file = nullptr;
+	int ch;
+
+	while ((ch = getopt(argc, argv, "j:p:o:h")) != -1) {
+		switch (ch) {
+		case 'j':
+			num_threads = std::max(1, atoi(optarg));
+			break;
+
+		case 'p':
+			if (!batch_replay.loadParameterSets(optarg)) {
+				return 1;
+			}
+
+			break;
+
+		case 'o':
+			output_file = optarg;
+			break;
+
+		default:
+			usage();
+			return 1;
+		}
+	}
+
+	if (optind >= argc) {
+		usage();
+		return 1;
+	}
+
+	for (int i = optind; i < argc; i++) {
+		if (!batch_replay.addLog(argv[i])) {
+			return 1;
+		}
+	}
+
+	std::cerr << "Running " << batch_replay.numJobs() << " replays on " << num_threads << " threads" << std::endl;
+
+	const std::vector<BatchReplay::Result> results = batch_replay.run(num_threads);
+
+	if (output_file) {
+		std::ofstream file(output_file);
+
+		if (!file) {
+			std::cerr << "Can not write to " << output_file << std::endl;
+			return 1;
+		}
+
+		BatchReplay::writeSummary(file, results);
+
+	} else {
+		BatchReplay::writeSummary(std::cout, results);
+	}
+
+	return 0;
+}
@@ -0,0 +1,414 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "batch_replay.h"
+
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+
+struct FloatParameter {
+	const char *name;
+	float parameters::*value;
+};
+
+struct IntParameter {
+	const char *name;
+	int32_t parameters::*value;
+};
+
+// the EKF2 parameters that are typically tuned with replay
+const FloatParameter float_parameters[] {
+	{"EKF2_GYR_NOISE", &parameters::gyro_noise},
+	{"EKF2_ACC_NOISE", &parameters::accel_noise},
+	{"EKF2_GYR_B_NOISE", &parameters::gyro_bias_p_noise},
+	{"EKF2_ACC_B_NOISE", &parameters::accel_bias_p_noise},
+	{"EKF2_WIND_NSD", &parameters::wind_vel_nsd},
+	{"EKF2_GPS_DELAY", &parameters::gps_delay_ms},
+	{"EKF2_GPS_V_NOISE", &parameters::gps_vel_noise},
+	{"EKF2_GPS_P_NOISE", &parameters::gps_pos_noise},
+	{"EKF2_GPS_P_GATE", &parameters::gps_pos_innov_gate},
+	{"EKF2_GPS_V_GATE", &parameters::gps_vel_innov_gate},
+	{"EKF2_BARO_DELAY", &parameters::baro_delay_ms},
+	{"EKF2_BARO_NOISE", &parameters::baro_noise},
+	{"EKF2_BARO_GATE", &parameters::baro_innov_gate},
+	{"EKF2_MAG_DELAY", &parameters::mag_delay_ms},
+	{"EKF2_MAG_E_NOISE", &parameters::mage_p_noise},
+	{"EKF2_MAG_B_NOISE", &parameters::magb_p_noise},
+	{"EKF2_HEAD_NOISE", &parameters::mag_heading_noise},
+	{"EKF2_MAG_NOISE", &parameters::mag_noise},
+	{"EKF2_MAG_GATE", &parameters::mag_innov_gate},
+	{"EKF2_HDG_GATE", &parameters::heading_innov_gate},
+	{"EKF2_ASP_DELAY", &parameters::airspeed_delay_ms},
+	{"EKF2_TAS_GATE", &parameters::tas_innov_gate},
+	{"EKF2_EAS_NOISE", &parameters::eas_noise},
+	{"EKF2_RNG_DELAY", &parameters::range_delay_ms},
+	{"EKF2_RNG_NOISE", &parameters::range_noise},
+	{"EKF2_RNG_GATE", &parameters::range_innov_gate},
+};
+
+const IntParameter int_parameters[] {
+	{"EKF2_IMU_CTRL", &parameters::imu_ctrl},
+	{"EKF2_GPS_CTRL", &parameters::gnss_ctrl},
+	{"EKF2_GPS_CHECK", &parameters::gps_check_mask},
+	{"EKF2_BARO_CTRL", &parameters::baro_ctrl},
+	{"EKF2_HGT_REF", &parameters::height_sensor_ref},
+	{"EKF2_MAG_TYPE", &parameters::mag_fusion_type},
+	{"EKF2_RNG_CTRL", &parameters::rng_ctrl},
+};
+
+bool isKnownParameter(const std::string &name)
+{
+	for (const auto &param : float_parameters) {
+		if (name == param.name) {
+			return true;
+		}
+	}
+
+	for (const auto &param : int_parameters) {
+		if (name == param.name) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+float maxOf(float x) { return x; }
+
+template<size_t N>
+float maxOf(const float (&x)[N])
+{
+	float max = x[0];
+
+	for (size_t i = 1; i < N; i++) {
+		max = std::max(max, x[i]);
+	}
+
+	return max;
+}
+
+float sumOfSquares(float x) { return x * x; }
+
+template<size_t N>
+float sumOfSquares(const float (&x)[N])
+{
+	float sum = 0.f;
+
+	for (size_t i = 0; i < N; i++) {
+		sum += x[i] * x[i];
+	}
+
+	return sum;
+}
+
+/**
+ * Accumulate the test ratio of an aid source if it has been updated since the last call
+ * @param active only count the sample if the fusion of the aid source is active
+ * @return true if counted
+ */
+template<typename T>
+bool accumulate(const T &aid_src, bool active, uint64_t &last_timestamp_sample,
+		BatchReplay::TestRatioStatistics &statistics)
+{
+	if (aid_src.timestamp_sample == 0 || aid_src.timestamp_sample == last_timestamp_sample) {
+		return false;
+	}
+
+	last_timestamp_sample = aid_src.timestamp_sample;
+
+	if (!active) {
+		return false;
+	}
+
+	const float test_ratio = maxOf(aid_src.test_ratio);
+
+	if (!std::isfinite(test_ratio)) {
+		return false;
+	}
+
+	statistics.samples++;
+	statistics.sum += test_ratio;
+	statistics.max = std::max(statistics.max, test_ratio);
+
+	if (aid_src.innovation_rejected) {
+		statistics.rejected++;
+	}
+
+	return true;
+}
+
+} // namespace
+
+bool BatchReplay::addLog(const std::string &file_name)
+{
+	std::shared_ptr<const ReplayData> data = SensorSimulator::loadReplayData(file_name);
+
+	if (!data || data->empty()) {
+		std::cerr << "No replay data in " << file_name << std::endl;
+		return false;
+	}
+
+	_logs.push_back(Log{file_name, data});
+	return true;
+}
+
+bool BatchReplay::addParameterSet(const std::string &definition)
+{
+	std::stringstream ss(definition);
+	ParameterSet parameter_set;
+
+	if (!(ss >> parameter_set.name)) {
+		return false;
+	}
+
+	std::string assignment;
+
+	while (ss >> assignment) {
+		const size_t pos = assignment.find('=');
+
+		if (pos == std::string::npos || !isKnownParameter(assignment.substr(0, pos))) {
+			std::cerr << "Invalid parameter " << assignment << " in set " << parameter_set.name << std::endl;
+			return false;
+		}
+
+		parameter_set.values.emplace_back(assignment.substr(0, pos), std::stof(assignment.substr(pos + 1)));
+	}
+
+	_parameter_sets.push_back(parameter_set);
+	return true;
+}
+
+bool BatchReplay::loadParameterSets(const std::string &file_name)
+{
+	std::ifstream file(file_name);
+
+	if (!file) {
+		std::cerr << "Can not open " << file_name << std::endl;
+		return false;
+	}
+
+	std::string line;
+
+	while (getline(file, line)) {
+		line = line.substr(0, line.find('#'));
+
+		if (line.find_first_not_of(" \t\r") == std::string::npos) {
+			continue;
+		}
+
+		if (!addParameterSet(line)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool BatchReplay::applyParameterSet(const ParameterSet &parameter_set, parameters &params)
+{
+	for (const auto &value : parameter_set.values) {
+		bool found = false;
+
+		for (const auto &param : float_parameters) {
+			if (value.first == param.name) {
+				params.*param.value = value.second;
+				found = true;
+			}
+		}
+
+		for (const auto &param : int_parameters) {
+			if (value.first == param.name) {
+				params.*param.value = static_cast<int32_t>(value.second);
+				found = true;
+			}
+		}
+
+		if (!found) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+std::vector<BatchReplay::Result> BatchReplay::run(unsigned num_threads) const
+{
+	const std::vector<ParameterSet> default_parameter_sets{ParameterSet{"default", {}}};
+	const std::vector<ParameterSet> &parameter_sets = _parameter_sets.empty() ? default_parameter_sets : _parameter_sets;
+
+	const size_t num_jobs = _logs.size() * parameter_sets.size();
+	std::vector<Result> results(num_jobs);
+
+	// the jobs are independent, every worker takes the next one until all are done
+	std::atomic<size_t> next_job{0};
+
+	auto worker = [&]() {
+		for (size_t job = next_job++; job < num_jobs; job = next_job++) {
+			results[job] = runJob(_logs[job / parameter_sets.size()], parameter_sets[job % parameter_sets.size()]);
+		}
+	};
+
+	num_threads = std::max(1u, std::min(num_threads, static_cast<unsigned>(num_jobs)));
+
+	std::vector<std::thread> threads;
+
+	for (unsigned i = 1; i < num_threads; i++) {
+		threads.emplace_back(worker);
+	}
+
+	worker();
+
+	for (auto &thread : threads) {
+		thread.join();
+	}
+
+	return results;
+}
+
+BatchReplay::Result BatchReplay::runJob(const Log &log, const ParameterSet &parameter_set) const
+{
+	Result result;
+	result.log = log.name;
+	result.parameter_set = parameter_set.name;
+
+	std::shared_ptr<Ekf> ekf = std::make_shared<Ekf>();
+	SensorSimulator sensor_simulator(ekf);
+
+	applyParameterSet(parameter_set, *ekf->getParamHandle());
+
+	sensor_simulator.setReplayData(log.data);
+
+	// IMU, mag and baro are always running, start the other sensors contained in the log
+	bool has_sensor[static_cast<int>(sensor_info::measurement_t::LANDING_STATUS) + 1] {};
+
+	for (const sensor_info &sample : *log.data) {
+		has_sensor[static_cast<int>(sample.sensor_type)] = true;
+	}
+
+	if (has_sensor[static_cast<int>(sensor_info::measurement_t::GPS)]) {
+		sensor_simulator.startGps();
+	}
+
+	if (has_sensor[static_cast<int>(sensor_info::measurement_t::AIRSPEED)]) {
+		sensor_simulator.startAirspeedSensor();
+	}
+
+	if (has_sensor[static_cast<int>(sensor_info::measurement_t::RANGE)]) {
+		sensor_simulator.startRangeFinder();
+	}
+
+	if (has_sensor[static_cast<int>(sensor_info::measurement_t::FLOW)]) {
+		sensor_simulator.startFlow();
+	}
+
+	uint64_t gnss_pos_last{0};
+	uint64_t gnss_vel_last{0};
+	uint64_t gnss_hgt_last{0};
+	uint64_t baro_hgt_last{0};
+	uint64_t mag_last{0};
+
+	double horizontal_position_error_sum{0.};
+	double vertical_position_error_sum{0.};
+	double velocity_error_sum{0.};
+
+	while (!sensor_simulator.replayFinished()) {
+		sensor_simulator.runReplayMicroseconds(10'000);
+
+		const filter_control_status_u &control_status = ekf->control_status();
+
+		if (accumulate(ekf->aid_src_gnss_pos(), control_status.flags.gps, gnss_pos_last, result.gnss_pos)) {
+			horizontal_position_error_sum += sumOfSquares(ekf->aid_src_gnss_pos().innovation);
+		}
+
+		if (accumulate(ekf->aid_src_gnss_vel(), control_status.flags.gps, gnss_vel_last, result.gnss_vel)) {
+			velocity_error_sum += sumOfSquares(ekf->aid_src_gnss_vel().innovation);
+		}
+
+		if (accumulate(ekf->aid_src_gnss_hgt(), control_status.flags.gps_hgt, gnss_hgt_last, result.gnss_hgt)) {
+			vertical_position_error_sum += sumOfSquares(ekf->aid_src_gnss_hgt().innovation);
+		}
+
+		accumulate(ekf->aid_src_baro_hgt(), control_status.flags.baro_hgt, baro_hgt_last, result.baro_hgt);
+		accumulate(ekf->aid_src_mag(), control_status.flags.mag_3D, mag_last, result.mag);
+	}
+
+	result.duration_s = sensor_simulator.getTime() * 1e-6f;
+
+	if (result.gnss_pos.samples > 0) {
+		result.horizontal_position_error_rms = sqrt(horizontal_position_error_sum / result.gnss_pos.samples);
+	}
+
+	if (result.gnss_hgt.samples > 0) {
+		result.vertical_position_error_rms = sqrt(vertical_position_error_sum / result.gnss_hgt.samples);
+	}
+
+	if (result.gnss_vel.samples > 0) {
+		result.velocity_error_rms = sqrt(velocity_error_sum / result.gnss_vel.samples);
+	}
+
+	return result;
+}
+
+void BatchReplay::writeSummary(std::ostream &out, const std::vector<Result> &results)
+{
+	static const char *aid_sources[] {"gnss_pos", "gnss_vel", "gnss_hgt", "baro_hgt", "mag"};
+
+	out << "log,parameter_set,duration_s";
+
+	for (const char *aid_source : aid_sources) {
+		out << "," << aid_source << "_test_ratio_mean," << aid_source << "_test_ratio_max," << aid_source << "_rejected";
+	}
+
+	out << ",hpos_error_rms,vpos_error_rms,vel_error_rms" << std::endl;
+
+	for (const Result &result : results) {
+		out << result.log << "," << result.parameter_set << "," << std::setprecision(6) << result.duration_s;
+
+		for (const TestRatioStatistics *statistics : {&result.gnss_pos, &result.gnss_vel, &result.gnss_hgt, &result.baro_hgt, &result.mag}) {
+			const float rejected = (statistics->samples > 0) ? static_cast<float>(statistics->rejected) / statistics->samples : 0.f;
+			out << "," << statistics->mean() << "," << statistics->max << "," << rejected;
+		}
+
+		out << "," << result.horizontal_position_error_rms
+		    << "," << result.vertical_position_error_rms
+		    << "," << result.velocity_error_rms << std::endl;
+	}
+}
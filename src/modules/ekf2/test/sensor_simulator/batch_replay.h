@@ -0,0 +1,134 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Replays many logs against many parameter sets in parallel.
+ * Every job (log x parameter set) runs an independent Ekf instance fed by
+ * its own SensorSimulator. The replay data of a log is loaded once and shared
+ * read-only by all jobs using it. Instead of the full EKF state, each job only
+ * accumulates summary metrics: innovation test ratios per aid source and
+ * the position and velocity error with respect to the GNSS reference.
+ */
+#ifndef EKF_BATCH_REPLAY_H
+#define EKF_BATCH_REPLAY_H
+
+#include <algorithm>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "sensor_simulator.h"
+
+class BatchReplay
+{
+public:
+	struct ParameterSet {
+		std::string name;
+		std::vector<std::pair<std::string, float>> values; ///< EKF2 parameter name and value
+	};
+
+	struct TestRatioStatistics {
+		uint32_t samples{0};
+		uint32_t rejected{0};
+		float sum{0.f};
+		float max{0.f};
+
+		float mean() const { return (samples > 0) ? sum / samples : 0.f; }
+	};
+
+	struct Result {
+		std::string log;
+		std::string parameter_set;
+		float duration_s{0.f};
+
+		TestRatioStatistics gnss_pos;
+		TestRatioStatistics gnss_vel;
+		TestRatioStatistics gnss_hgt;
+		TestRatioStatistics baro_hgt;
+		TestRatioStatistics mag;
+
+		// errors with respect to the GNSS reference, from the innovations while the fusion is active
+		float horizontal_position_error_rms{0.f}; ///< (m)
+		float vertical_position_error_rms{0.f};   ///< (m)
+		float velocity_error_rms{0.f};            ///< (m/s)
+	};
+
+	/**
+	 * Load a log in the replay data format of the sensor simulator
+	 * (see convertULogToSensorData.py)
+	 */
+	bool addLog(const std::string &file_name);
+
+	/**
+	 * Add a parameter set, given as 'name PARAM=value PARAM=value ...'
+	 * @return false if the definition contains an unknown parameter
+	 */
+	bool addParameterSet(const std::string &definition);
+
+	/**
+	 * Add all parameter sets from a file, one per line, '#' starts a comment
+	 */
+	bool loadParameterSets(const std::string &file_name);
+
+	/**
+	 * Run all combinations of the loaded logs and parameter sets
+	 * @param num_threads number of worker threads
+	 * @return a result per job, ordered by log and then by parameter set
+	 */
+	std::vector<Result> run(unsigned num_threads) const;
+
+	static void writeSummary(std::ostream &out, const std::vector<Result> &results);
+
+	/**
+	 * Apply a parameter set to the parameters of an Ekf
+	 * @return false if a parameter is unknown
+	 */
+	static bool applyParameterSet(const ParameterSet &parameter_set, parameters &params);
+
+	size_t numJobs() const { return _logs.size() * std::max<size_t>(_parameter_sets.size(), 1); }
+
+private:
+	struct Log {
+		std::string name;
+		std::shared_ptr<const ReplayData> data;
+	};
+
+	Result runJob(const Log &log, const ParameterSet &parameter_set) const;
+
+	std::vector<Log> _logs;
+	std::vector<ParameterSet> _parameter_sets;
+};
+#endif // !EKF_BATCH_REPLAY_H
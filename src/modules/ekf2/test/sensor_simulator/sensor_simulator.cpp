@@ -25,6 +25,19 @@ SensorSimulator::SensorSimulator(std::shared_ptr<Ekf> ekf):
 
 void SensorSimulator::loadSensorDataFromFile(std::string file_name)
 {
+	setReplayData(loadReplayData(file_name));
+}
+
+void SensorSimulator::setReplayData(std::shared_ptr<const ReplayData> replay_data)
+{
+	_replay_data = replay_data;
+	_current_replay_data_index = 0;
+	_has_replay_data = true;
+}
+
+std::shared_ptr<const ReplayData> SensorSimulator::loadReplayData(const std::string &file_name)
+{
+	auto replay_data = std::make_shared<ReplayData>();
 	std::ifstream file(file_name);
 	std::string line;
 
@@ -42,8 +55,8 @@ void SensorSimulator::loadSensorDataFromFile(std::string file_name)
 
 		sensor_sample.timestamp = std::stoul(timestamp);
 
-		if (_replay_data.size() > 0) {
-			sensor_info last_sample = _replay_data.back();
+		if (replay_data->size() > 0) {
+			sensor_info last_sample = replay_data->back();
 
 			if (sensor_sample.timestamp < last_sample.timestamp) {
 				std::cout << "Timestamps not sorted ascendingly" << std::endl;
@@ -106,11 +119,11 @@ void SensorSimulator::loadSensorDataFromFile(std::string file_name)
 			i++;
 		}
 
-		_replay_data.emplace_back(sensor_sample);
+		replay_data->emplace_back(sensor_sample);
 	}
 
 	file.close();
-	_has_replay_data = true;
+	return replay_data;
 }
 
 void SensorSimulator::setSensorRateToDefault()
@@ -214,20 +227,16 @@ void SensorSimulator::runReplayMicroseconds(uint32_t duration)
 
 void SensorSimulator::setSensorDataFromReplayData()
 {
-	if (_replay_data.size() > 0) {
-		sensor_info sample = _replay_data[_current_replay_data_index];
-
-		while (sample.timestamp < _time) {
-			setSingleReplaySample(sample);
-
-			if (_current_replay_data_index < _replay_data.size()) {
-				_current_replay_data_index ++;
+	if (_replay_data->size() > 0) {
+		while (_current_replay_data_index < _replay_data->size()) {
+			const sensor_info &sample = (*_replay_data)[_current_replay_data_index];
 
-			} else {
+			if (sample.timestamp >= _time) {
 				break;
 			}
 
-			sample = _replay_data[_current_replay_data_index];
+			setSingleReplaySample(sample);
+			_current_replay_data_index++;
 		}
 
 	} else {
@@ -257,9 +266,10 @@ void SensorSimulator::setSingleReplaySample(const sensor_info &sample)
 		_baro.setData((float) sample.sensor_data[0]);
 
 	} else if (sample.sensor_type == sensor_info::measurement_t::GPS) {
-		_gps.setAltitude((int32_t) sample.sensor_data[0]);
-		_gps.setLatitude((int32_t) sample.sensor_data[1]);
-		_gps.setLongitude((int32_t) sample.sensor_data[2]);
+		// replay data: alt [mm], lon [1e-7 deg], lat [1e-7 deg]
+		_gps.setAltitude((float)(sample.sensor_data[0] * 1e-3));
+		_gps.setLongitude(sample.sensor_data[1] * 1e-7);
+		_gps.setLatitude(sample.sensor_data[2] * 1e-7);
 		_gps.setVelocity(Vector3f((float) sample.sensor_data[3],
 					  (float) sample.sensor_data[4],
 					  (float) sample.sensor_data[5]));
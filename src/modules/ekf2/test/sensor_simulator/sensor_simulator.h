@@ -70,6 +70,8 @@ struct sensor_info {
 	std::array<double, 10> sensor_data{};
 };
 
+using ReplayData = std::vector<sensor_info>;
+
 class SensorSimulator
 {
 
@@ -119,6 +121,14 @@ public:
 
 	void loadSensorDataFromFile(std::string filename);
 
+	/**
+	 * Load replay data from a file so that it can be shared (read-only) by multiple simulators
+	 */
+	static std::shared_ptr<const ReplayData> loadReplayData(const std::string &file_name);
+	void setReplayData(std::shared_ptr<const ReplayData> replay_data);
+
+	bool replayFinished() const { return !_replay_data || _current_replay_data_index >= _replay_data->size(); }
+
 	Airspeed    _airspeed;
 	Baro        _baro;
 	Flow        _flow;
@@ -141,7 +151,7 @@ private:
 
 	std::shared_ptr<Ekf> _ekf{nullptr};
 
-	std::vector<sensor_info> _replay_data{};
+	std::shared_ptr<const ReplayData> _replay_data{};
 
 	bool _has_replay_data{false};
 
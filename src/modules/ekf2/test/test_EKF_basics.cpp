@@ -355,4 +355,45 @@ TEST_F(EkfBasicsTest, global_position_from_opt_flow)
 	EXPECT_TRUE(_ekf->local_position_is_valid());
 }
 
+TEST_F(EkfBasicsTest, restoreState)
+{
+	// GIVEN: a filter running with GNSS aiding
+	_sensor_simulator.startGps();
+	_sensor_simulator.runSeconds(11);
+	EXPECT_TRUE(_ekf->control_status_flags().gps);
+
+	const StateSample state = _ekf->state();
+	const Ekf::SquareMatrixState covariances = _ekf->covariances();
+	_ekf->getEkfGlobalOrigin(_origin_time, _latitude, _longitude, _altitude);
+
+	// WHEN: a new filter is started from this state
+	std::shared_ptr<Ekf> ekf_restored = std::make_shared<Ekf>();
+	ekf_restored->init(0);
+	EXPECT_TRUE(ekf_restored->restoreState(state, covariances, true, true, _latitude, _longitude, _altitude));
+
+	// THEN: it continues from the same state and origin
+	EXPECT_TRUE(ekf_restored->control_status_flags().yaw_align);
+	EXPECT_TRUE(matrix::isEqual(ekf_restored->state().vector(), state.vector()));
+	EXPECT_TRUE(matrix::isEqual(ekf_restored->covariances_diagonal(), _ekf->covariances_diagonal()));
+
+	ekf_restored->getEkfGlobalOrigin(_origin_time, _latitude_new, _longitude_new, _altitude_new);
+	EXPECT_DOUBLE_EQ(_latitude, _latitude_new);
+	EXPECT_DOUBLE_EQ(_longitude, _longitude_new);
+	EXPECT_FLOAT_EQ(_altitude, _altitude_new);
+
+	// AND: a running filter can't be restored
+	EXPECT_FALSE(_ekf->restoreState(state, covariances, true, true, _latitude, _longitude, _altitude));
+
+	// AND WHEN: the restored filter keeps running with the same measurements
+	SensorSimulator sensor_simulator(ekf_restored);
+	sensor_simulator.startGps();
+	sensor_simulator.runSeconds(11);
+
+	// THEN: GNSS fusion starts again without a position jump
+	EXPECT_TRUE(ekf_restored->attitude_valid());
+	EXPECT_TRUE(ekf_restored->control_status_flags().gps);
+	EXPECT_TRUE(ekf_restored->global_position_is_valid());
+	EXPECT_LT(Vector3f(ekf_restored->getPosition() - Vector3f(state.pos)).norm(), 1.f);
+}
+
 // TODO: Add sampling tests
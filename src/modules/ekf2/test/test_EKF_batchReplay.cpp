@@ -0,0 +1,111 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+#include "sensor_simulator/batch_replay.h"
+
+class EkfBatchReplayTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		ASSERT_TRUE(_batch_replay.addLog(TEST_DATA_PATH"/replay_data/iris_gps.csv"));
+		ASSERT_TRUE(_batch_replay.addLog(TEST_DATA_PATH"/replay_data/ekf_gsf_reset.csv"));
+		ASSERT_TRUE(_batch_replay.addParameterSet("default"));
+		ASSERT_TRUE(_batch_replay.addParameterSet("tight_gates EKF2_GPS_P_GATE=1 EKF2_GPS_V_GATE=1"));
+		ASSERT_TRUE(_batch_replay.addParameterSet("gps_noise EKF2_GPS_P_NOISE=2 EKF2_GPS_V_NOISE=1.5"));
+	}
+
+	BatchReplay _batch_replay;
+};
+
+TEST_F(EkfBatchReplayTest, invalidParameterSet)
+{
+	EXPECT_FALSE(_batch_replay.addParameterSet("unknown EKF2_FOO=1"));
+	EXPECT_FALSE(_batch_replay.addParameterSet("missing_value EKF2_GPS_P_GATE"));
+	EXPECT_EQ(_batch_replay.numJobs(), 6u);
+}
+
+TEST_F(EkfBatchReplayTest, parallelMatchesSequential)
+{
+	// WHEN: replaying all jobs sequentially and in parallel
+	const std::vector<BatchReplay::Result> sequential = _batch_replay.run(1);
+	const std::vector<BatchReplay::Result> parallel = _batch_replay.run(4);
+
+	// THEN: the instances are independent, so the results are identical and in the same order
+	ASSERT_EQ(sequential.size(), 6u);
+	ASSERT_EQ(parallel.size(), sequential.size());
+
+	for (size_t i = 0; i < sequential.size(); i++) {
+		EXPECT_EQ(parallel[i].log, sequential[i].log);
+		EXPECT_EQ(parallel[i].parameter_set, sequential[i].parameter_set);
+		EXPECT_EQ(parallel[i].gnss_pos.samples, sequential[i].gnss_pos.samples);
+		EXPECT_EQ(parallel[i].gnss_pos.rejected, sequential[i].gnss_pos.rejected);
+		EXPECT_EQ(parallel[i].gnss_vel.max, sequential[i].gnss_vel.max);
+		EXPECT_EQ(parallel[i].mag.sum, sequential[i].mag.sum);
+		EXPECT_EQ(parallel[i].horizontal_position_error_rms, sequential[i].horizontal_position_error_rms);
+		EXPECT_EQ(parallel[i].velocity_error_rms, sequential[i].velocity_error_rms);
+	}
+
+	// AND: the GNSS data of the logs has been fused and the parameter sets are applied
+	for (const BatchReplay::Result &result : sequential) {
+		EXPECT_GT(result.duration_s, 30.f);
+		EXPECT_GT(result.gnss_pos.samples, 0u);
+		EXPECT_GT(result.baro_hgt.samples, 0u);
+	}
+
+	// test ratios scale with the inverse of the gate size
+	EXPECT_GT(sequential[1].gnss_pos.mean(), sequential[0].gnss_pos.mean());
+	EXPECT_LT(sequential[2].gnss_pos.mean(), sequential[0].gnss_pos.mean());
+}
+
+TEST_F(EkfBatchReplayTest, summary)
+{
+	const std::vector<BatchReplay::Result> results = _batch_replay.run(2);
+
+	std::stringstream summary;
+	BatchReplay::writeSummary(summary, results);
+
+	// header and one line per job
+	std::string line;
+	int lines = 0;
+
+	while (getline(summary, line)) {
+		lines++;
+	}
+
+	EXPECT_EQ(lines, 7);
+}
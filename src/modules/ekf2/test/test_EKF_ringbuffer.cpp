@@ -158,3 +158,33 @@ TEST_F(EkfRingBufferTest, reallocateBuffer)
 	EXPECT_EQ(3, _buffer->get_length());
 
 }
+
+TEST_F(EkfRingBufferTest, popSampleDelayedHorizon)
+{
+	// GIVEN: a long buffer filled at 100 Hz with a delay of 1 s
+	ASSERT_EQ(true, _buffer->allocate(200));
+
+	for (uint64_t time_us = 1000000; time_us <= 2000000; time_us += 10000) {
+		sample s = {};
+		s.time_us = time_us;
+		_buffer->push(s);
+	}
+
+	sample pop = {};
+
+	// WHEN: the delayed horizon falls between two samples
+	// THEN: the newest older sample is returned and older samples are dropped
+	EXPECT_EQ(true, _buffer->pop_first_older_than(1505000, &pop));
+	EXPECT_EQ(1500000, pop.time_us);
+	EXPECT_EQ(1510000, _buffer->get_oldest().time_us);
+
+	// WHEN: the horizon did not reach the next sample yet
+	// THEN: nothing is returned
+	EXPECT_EQ(false, _buffer->pop_first_older_than(1509999, &pop));
+
+	// WHEN: the horizon reaches the newest sample
+	// THEN: it is returned and the buffer is empty
+	EXPECT_EQ(true, _buffer->pop_first_older_than(2000000, &pop));
+	EXPECT_EQ(2000000, pop.time_us);
+	EXPECT_EQ(false, _buffer->pop_first_older_than(2000000, &pop));
+}
@@ -44,6 +44,9 @@ FlightModeManager::FlightModeManager() :
 {
 	updateParams();
 
+	// time-critical on the shared nav_and_controllers queue, run ahead of eg navigator (CONFIG_PX4_WORK_QUEUE_EDF)
+	SetDeadline(5_ms);
+
 	// initialize all flight-tasks
 	// currently this is required to get all parameters read
 	for (int i = 0; i < static_cast<int>(FlightTaskIndex::Count); i++) {
@@ -60,7 +63,10 @@ FlightModeManager::~FlightModeManager()
 		_current_task.task->~FlightTask();
 	}
 
+	stopStandbyTask();
+
 	perf_free(_loop_perf);
+	perf_free(_standby_perf);
 }
 
 bool FlightModeManager::init()
@@ -119,6 +125,7 @@ void FlightModeManager::Run()
 			generateTrajectorySetpoint(dt, vehicle_local_position);
 		}
 
+		updateStandbyTask();
 	}
 
 	perf_end(_loop_perf);
@@ -131,6 +138,10 @@ void FlightModeManager::updateParams()
 	if (isAnyTaskActive()) {
 		_current_task.task->handleParameterUpdate();
 	}
+
+	if (_standby_task.task) {
+		_standby_task.task->handleParameterUpdate();
+	}
 }
 
 void FlightModeManager::start_flight_task()
@@ -369,6 +380,76 @@ void FlightModeManager::generateTrajectorySetpoint(const float dt,
 	_old_landing_gear_position = landing_gear.landing_gear;
 }
 
+void FlightModeManager::updateStandbyTask()
+{
+	FlightTaskIndex standby_index = FlightTaskIndex::None;
+
+	switch (_param_fmm_standby.get()) {
+	case 1:
+		standby_index = FlightTaskIndex::Descend;
+		break;
+
+	case 2:
+		standby_index = FlightTaskIndex::Failsafe;
+		break;
+	}
+
+	// only needed next to a different active task, and the storage is still in use after a take over
+	if (!_vehicle_control_mode_sub.get().flag_armed || !isAnyTaskActive() || _current_task_in_standby_storage
+	    || (standby_index == _current_task.index)) {
+		standby_index = FlightTaskIndex::None;
+	}
+
+	if (standby_index != _standby_task.index) {
+		stopStandbyTask();
+		startStandbyTask(standby_index);
+	}
+
+	if (!_standby_task.task || (++_standby_update_counter < STANDBY_UPDATE_DECIMATION)) {
+		return;
+	}
+
+	_standby_update_counter = 0;
+
+	perf_begin(_standby_perf);
+	_standby_task.task->updateInitialize();
+	_standby_task.task->update();
+	perf_end(_standby_perf);
+}
+
+void FlightModeManager::startStandbyTask(FlightTaskIndex task_index)
+{
+	switch (task_index) {
+	case FlightTaskIndex::Descend:
+		_standby_task.task = new (&_standby_task_union.Descend) FlightTaskDescend();
+		break;
+
+	case FlightTaskIndex::Failsafe:
+		_standby_task.task = new (&_standby_task_union.Failsafe) FlightTaskFailsafe();
+		break;
+
+	default:
+		return;
+	}
+
+	_standby_task.index = task_index;
+	_standby_update_counter = 0;
+
+	if (!_standby_task.task->updateInitialize()
+	    || !_standby_task.task->activate(_current_task.task->getTrajectorySetpoint())) {
+		stopStandbyTask();
+	}
+}
+
+void FlightModeManager::stopStandbyTask()
+{
+	if (_standby_task.task) {
+		_standby_task.task->~FlightTask();
+		_standby_task.task = nullptr;
+		_standby_task.index = FlightTaskIndex::None;
+	}
+}
+
 FlightTaskError FlightModeManager::switchTask(FlightTaskIndex new_task_index)
 {
 	// switch to the running task, nothing to do
@@ -385,9 +466,23 @@ FlightTaskError FlightModeManager::switchTask(FlightTaskIndex new_task_index)
 		last_reset_counters = _current_task.task->getResetCounters();
 	}
 
-	if (_initTask(new_task_index)) {
-		// invalid task
-		return FlightTaskError::InvalidTask;
+	if (_standby_task.task && (new_task_index == _standby_task.index)) {
+		// take over the standby task: constructed with its parameters loaded and its subscriptions up to date,
+		// the activation below only anchors its setpoints at the current state
+		_initTask(FlightTaskIndex::None);
+		_current_task = _standby_task;
+		_standby_task = {};
+		_current_task_in_standby_storage = true;
+
+	} else {
+		// _initTask() always destructs the previous task, also when it lived in the standby storage
+		const bool init_failed = _initTask(new_task_index);
+		_current_task_in_standby_storage = false;
+
+		if (init_failed) {
+			// invalid task
+			return FlightTaskError::InvalidTask;
+		}
 	}
 
 	if (!isAnyTaskActive()) {
@@ -400,6 +495,7 @@ FlightTaskError FlightModeManager::switchTask(FlightTaskIndex new_task_index)
 		_current_task.task->~FlightTask();
 		_current_task.task = nullptr;
 		_current_task.index = FlightTaskIndex::None;
+		_current_task_in_standby_storage = false;
 		return FlightTaskError::ActivationFailed;
 	}
 
@@ -471,7 +567,12 @@ int FlightModeManager::print_status()
 		PX4_INFO("Running, no flight task active");
 	}
 
+	if (_standby_task.task) {
+		PX4_INFO("Standby flight task: %" PRIu32, static_cast<uint32_t>(_standby_task.index));
+	}
+
 	perf_print_counter(_loop_perf);
+	perf_print_counter(_standby_perf);
 	return 0;
 }
 
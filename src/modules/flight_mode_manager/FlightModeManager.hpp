@@ -92,6 +92,14 @@ private:
 	void handleCommand();
 	void generateTrajectorySetpoint(const float dt, const vehicle_local_position_s &vehicle_local_position);
 
+	/**
+	 * Keep the configured standby task (FMM_STANDBY) constructed, activated and updated at a decimated rate
+	 * next to the active task, such that switching to it does not need a cold start.
+	 */
+	void updateStandbyTask();
+	void startStandbyTask(FlightTaskIndex task_index);
+	void stopStandbyTask();
+
 	/**
 	 * Switch to a specific task (for normal usage)
 	 * @param task index to switch to
@@ -127,12 +135,30 @@ private:
 		FlightTaskIndex index{FlightTaskIndex::None};
 	} _current_task{};
 
+	/**
+	 * Separate storage for the hot standby task, only the tasks that can be selected by FMM_STANDBY.
+	 */
+	union StandbyTaskUnion {
+		StandbyTaskUnion() {}
+		~StandbyTaskUnion() {}
+
+		FlightTaskDescend Descend;
+		FlightTaskFailsafe Failsafe;
+	} _standby_task_union;
+
+	flight_task_t _standby_task{};
+	bool _current_task_in_standby_storage{false}; ///< the active task was taken over from the standby storage
+	uint8_t _standby_update_counter{0};
+
+	static constexpr uint8_t STANDBY_UPDATE_DECIMATION{5}; ///< update the standby task every 5th cycle (10 Hz)
+
 	int8_t _old_landing_gear_position{landing_gear_s::GEAR_KEEP};
 	uint8_t _takeoff_state{takeoff_status_s::TAKEOFF_STATE_UNINITIALIZED};
 
 	bool _no_matching_task_error_printed{false};
 
 	perf_counter_t _loop_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")}; ///< loop duration performance counter
+	perf_counter_t _standby_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": standby")}; ///< standby task update duration
 	hrt_abstime _time_stamp_last_loop{0}; ///< time stamp of last loop iteration
 
 	vehicle_command_s _current_command{};
@@ -154,6 +180,7 @@ private:
 	uORB::Publication<vehicle_constraints_s> _vehicle_constraints_pub{ORB_ID(vehicle_constraints)};
 
 	DEFINE_PARAMETERS(
-		(ParamInt<px4::params::MPC_POS_MODE>) _param_mpc_pos_mode
+		(ParamInt<px4::params::MPC_POS_MODE>) _param_mpc_pos_mode,
+		(ParamInt<px4::params::FMM_STANDBY>) _param_fmm_standby
 	);
 };
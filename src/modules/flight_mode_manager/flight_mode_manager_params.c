@@ -34,3 +34,17 @@
 /**
  * @file flight_mode_manager_params.c
  */
+
+/**
+ * Hot standby flight task
+ *
+ * Keeps the selected flight task constructed and updated at 10 Hz next to the active one
+ * while armed, such that a switch to it does not require a cold start of the task.
+ * The additional CPU load is reported by the "flight_mode_manager: standby" perf counter.
+ *
+ * @value 0 Disabled
+ * @value 1 Descend
+ * @value 2 Failsafe
+ * @group Multicopter Position Control
+ */
+PARAM_DEFINE_INT32(FMM_STANDBY, 0);
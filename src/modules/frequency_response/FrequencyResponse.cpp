@@ -0,0 +1,444 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file FrequencyResponse.cpp
+ */
+
+#include "FrequencyResponse.hpp"
+
+FrequencyResponse::FrequencyResponse() :
+	ModuleParams(nullptr),
+	WorkItem(MODULE_NAME, px4::wq_configurations::hp_default)
+{
+	_frequency_response_pub.advertise();
+	_rate_loop_excitation_pub.advertise();
+}
+
+FrequencyResponse::~FrequencyResponse()
+{
+	perf_free(_cycle_perf);
+	perf_free(_gap_perf);
+}
+
+bool FrequencyResponse::init()
+{
+	// the gyro callback is only registered while a test is running
+	ScheduleNow();
+	return true;
+}
+
+void FrequencyResponse::requestTest(int axis)
+{
+	_requested_axis.store(axis);
+	ScheduleNow();
+}
+
+void FrequencyResponse::requestAbort()
+{
+	_abort_requested.store(true);
+	ScheduleNow();
+}
+
+void FrequencyResponse::Run()
+{
+	if (should_exit()) {
+		if (_state == frequency_response_s::STATE_INIT || _state == frequency_response_s::STATE_RUNNING) {
+			stopTest(frequency_response_s::STATE_FAIL);
+		}
+
+		_vehicle_angular_velocity_sub.unregisterCallback();
+		exit_and_cleanup();
+		return;
+	}
+
+	// check for parameter updates
+	if (_parameter_update_sub.updated()) {
+		// clear update
+		parameter_update_s pupdate;
+		_parameter_update_sub.copy(&pupdate);
+
+		// update parameters from storage
+		updateParams();
+	}
+
+	if (_vehicle_status_sub.updated()) {
+		vehicle_status_s vehicle_status;
+
+		if (_vehicle_status_sub.copy(&vehicle_status)) {
+			_armed = (vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED);
+		}
+	}
+
+	if (_vehicle_land_detected_sub.updated()) {
+		vehicle_land_detected_s vehicle_land_detected;
+
+		if (_vehicle_land_detected_sub.copy(&vehicle_land_detected)) {
+			_landed = vehicle_land_detected.landed;
+		}
+	}
+
+	const bool running = (_state == frequency_response_s::STATE_INIT) || (_state == frequency_response_s::STATE_RUNNING);
+
+	if (_abort_requested.load()) {
+		_abort_requested.store(false);
+
+		if (running) {
+			PX4_WARN("aborted");
+			stopTest(frequency_response_s::STATE_FAIL);
+			return;
+		}
+	}
+
+	const int requested_axis = _requested_axis.load();
+
+	if (requested_axis >= 0) {
+		_requested_axis.store(-1);
+
+		if (running) {
+			PX4_WARN("test already running");
+
+		} else if (!_armed || _landed) {
+			PX4_ERR("vehicle must be flying");
+
+		} else {
+			startTest(requested_axis);
+		}
+
+		return;
+	}
+
+	if (!running) {
+		return;
+	}
+
+	vehicle_angular_velocity_s angular_velocity;
+
+	if (!_vehicle_angular_velocity_sub.update(&angular_velocity)) {
+		return;
+	}
+
+	perf_begin(_cycle_perf);
+
+	const hrt_abstime now = angular_velocity.timestamp_sample;
+
+	// disarming, landing or any pilot intervention aborts the excitation immediately
+	manual_control_setpoint_s manual_control_setpoint{};
+	_manual_control_setpoint_sub.copy(&manual_control_setpoint);
+
+	if (!_armed || _landed
+	    || (fabsf(manual_control_setpoint.roll) > 0.05f)
+	    || (fabsf(manual_control_setpoint.pitch) > 0.05f)
+	    || (fabsf(manual_control_setpoint.yaw) > 0.05f)) {
+		PX4_WARN("aborted by pilot or landing");
+		stopTest(frequency_response_s::STATE_FAIL);
+		perf_end(_cycle_perf);
+		return;
+	}
+
+	if (_state == frequency_response_s::STATE_INIT) {
+		// measure the gyro sample interval before starting the excitation
+		if (_last_sample != 0 && now > _last_sample) {
+			_interval_sum += (now - _last_sample) * 1e-6f;
+			_interval_count++;
+		}
+
+		_last_sample = now;
+
+		if ((now > _state_start_time + kInitDuration) && (_interval_count > 0)) {
+			_sample_interval = _interval_sum / _interval_count;
+
+			// keep the analysis well below Nyquist
+			const float f_max = math::min(_param_fra_freq_max.get(), 0.4f / _sample_interval);
+			const float f_min = math::constrain(_param_fra_freq_min.get(), 0.1f, 0.5f * f_max);
+			_estimator.reset(f_min, f_max, _sample_interval);
+
+			_excitation.axis = _axis;
+			_excitation.signal = static_cast<uint8_t>(_param_fra_signal.get());
+			_excitation.amplitude = _param_fra_amp.get();
+			_excitation.frequency_start = f_min;
+			_excitation.frequency_end = f_max;
+			_excitation.duration = _param_fra_duration.get();
+			_excitation.start_time = now + static_cast<hrt_abstime>(_sample_interval * 1e6f);
+			publishExcitation();
+
+			_state = frequency_response_s::STATE_RUNNING;
+			_state_start_time = now;
+		}
+
+	} else if (now >= _excitation.start_time) {
+		const float t = (now - _excitation.start_time) * 1e-6f;
+
+		if (t > _excitation.duration) {
+			_margins = _estimator.getMargins();
+			stopTest(frequency_response_s::STATE_COMPLETE);
+
+			PX4_INFO("axis %d: crossover %.1f Hz, phase margin %.1f deg, gain margin %.1f dB",
+				 _axis, (double)_margins.gain_crossover_frequency, (double)_margins.phase_margin,
+				 (double)_margins.gain_margin);
+
+			perf_end(_cycle_perf);
+			return;
+		}
+
+		vehicle_rates_setpoint_s vehicle_rates_setpoint;
+
+		if (_vehicle_rates_setpoint_sub.update(&vehicle_rates_setpoint)) {
+			const float setpoint[3] {vehicle_rates_setpoint.roll, vehicle_rates_setpoint.pitch, vehicle_rates_setpoint.yaw};
+			_rate_setpoint = setpoint[_axis];
+		}
+
+		// reproduce the rate error seen by the rate controller, which evaluates the same signal at the same sample time
+		const float excitation = _excitation.amplitude * signal_generator::getSignal(
+						 static_cast<signal_generator::SignalType>(_excitation.signal),
+						 _excitation.frequency_start, _excitation.frequency_end, _excitation.duration, t);
+		const float rate = angular_velocity.xyz[_axis];
+		const float rate_error = (PX4_ISFINITE(_rate_setpoint) ? _rate_setpoint : rate) + excitation - rate;
+
+		// account for gyro samples this work item did not see
+		uint32_t elapsed_samples = 1;
+
+		if (_last_sample != 0 && now > _last_sample) {
+			elapsed_samples = math::max(lroundf((now - _last_sample) * 1e-6f / _sample_interval), 1L);
+
+			if (elapsed_samples > 1) {
+				perf_count(_gap_perf);
+			}
+		}
+
+		_last_sample = now;
+		_estimator.update(rate_error, rate, elapsed_samples);
+
+		// keep the excitation alive at the rate controller
+		if (hrt_elapsed_time(&_excitation.timestamp) > 100_ms) {
+			publishExcitation();
+		}
+
+		if (now > _last_response_publish + 500_ms) {
+			_margins = _estimator.getMargins();
+			publishResponse(now);
+		}
+	}
+
+	perf_end(_cycle_perf);
+}
+
+void FrequencyResponse::startTest(uint8_t axis)
+{
+	if (!_vehicle_angular_velocity_sub.registerCallback()) {
+		PX4_ERR("callback registration failed");
+		return;
+	}
+
+	_axis = axis;
+	_state = frequency_response_s::STATE_INIT;
+	_state_start_time = hrt_absolute_time();
+	_last_sample = 0;
+	_interval_sum = 0.f;
+	_interval_count = 0;
+	_rate_setpoint = NAN;
+	_margins = {};
+
+	PX4_INFO("starting on axis %d", _axis);
+	publishResponse(_state_start_time);
+}
+
+void FrequencyResponse::stopTest(uint8_t state)
+{
+	_vehicle_angular_velocity_sub.unregisterCallback();
+
+	_excitation.start_time = 0;
+	publishExcitation();
+
+	_state = state;
+	publishResponse(hrt_absolute_time());
+}
+
+void FrequencyResponse::publishExcitation()
+{
+	_excitation.timestamp = hrt_absolute_time();
+	_rate_loop_excitation_pub.publish(_excitation);
+}
+
+void FrequencyResponse::publishResponse(hrt_abstime now)
+{
+	frequency_response_s frequency_response{};
+	frequency_response.state = _state;
+	frequency_response.axis = _axis;
+
+	if (_state == frequency_response_s::STATE_RUNNING) {
+		frequency_response.progress = math::constrain((now - _excitation.start_time) * 1e-6f / _excitation.duration, 0.f, 1.f);
+
+	} else if (_state == frequency_response_s::STATE_COMPLETE) {
+		frequency_response.progress = 1.f;
+	}
+
+	if (_state == frequency_response_s::STATE_RUNNING || _state == frequency_response_s::STATE_COMPLETE) {
+		frequency_response.sample_rate = 1.f / _sample_interval;
+
+		for (size_t k = 0; k < kNumBins; k++) {
+			frequency_response.frequency[k] = _estimator.getFrequency(k);
+		}
+
+		_estimator.getBode(frequency_response.magnitude, frequency_response.phase);
+
+	} else {
+		for (size_t k = 0; k < kNumBins; k++) {
+			frequency_response.magnitude[k] = NAN;
+			frequency_response.phase[k] = NAN;
+		}
+	}
+
+	frequency_response.gain_crossover_frequency = _margins.gain_crossover_frequency;
+	frequency_response.phase_margin = _margins.phase_margin;
+	frequency_response.phase_crossover_frequency = _margins.phase_crossover_frequency;
+	frequency_response.gain_margin = _margins.gain_margin;
+	frequency_response.sensitivity_peak = _margins.sensitivity_peak;
+
+	frequency_response.timestamp = hrt_absolute_time();
+	_frequency_response_pub.publish(frequency_response);
+
+	_last_response_publish = now;
+}
+
+int FrequencyResponse::task_spawn(int argc, char *argv[])
+{
+	FrequencyResponse *instance = new FrequencyResponse();
+
+	if (instance) {
+		_object.store(instance);
+		_task_id = task_id_is_work_queue;
+
+		if (instance->init()) {
+			return PX4_OK;
+		}
+
+	} else {
+		PX4_ERR("alloc failed");
+	}
+
+	delete instance;
+	_object.store(nullptr);
+	_task_id = -1;
+
+	return PX4_ERROR;
+}
+
+int FrequencyResponse::custom_command(int argc, char *argv[])
+{
+	if (!is_running()) {
+		PX4_INFO("not running");
+		return PX4_ERROR;
+	}
+
+	if (argc >= 1) {
+		if (strcmp(argv[0], "run") == 0) {
+			static constexpr const char *axes[] {"roll", "pitch", "yaw"};
+
+			for (int axis = 0; axis < 3; axis++) {
+				if (argc >= 2 && strcmp(argv[1], axes[axis]) == 0) {
+					get_instance()->requestTest(axis);
+					return PX4_OK;
+				}
+			}
+
+			return print_usage("axis must be roll, pitch or yaw");
+
+		} else if (strcmp(argv[0], "abort") == 0) {
+			get_instance()->requestAbort();
+			return PX4_OK;
+		}
+	}
+
+	return print_usage("unknown command");
+}
+
+int FrequencyResponse::print_status()
+{
+	static constexpr const char *states[] {"idle", "init", "running", "complete", "fail"};
+	PX4_INFO("state: %s, axis: %d", states[math::min(_state, (uint8_t)frequency_response_s::STATE_FAIL)], _axis);
+
+	if (_state == frequency_response_s::STATE_RUNNING || _state == frequency_response_s::STATE_COMPLETE) {
+		PX4_INFO("sample rate: %.1f Hz", (double)(1.f / _sample_interval));
+		PX4_INFO("gain crossover: %.1f Hz, phase margin: %.1f deg",
+			 (double)_margins.gain_crossover_frequency, (double)_margins.phase_margin);
+		PX4_INFO("phase crossover: %.1f Hz, gain margin: %.1f dB",
+			 (double)_margins.phase_crossover_frequency, (double)_margins.gain_margin);
+		PX4_INFO("sensitivity peak: %.1f dB", (double)_margins.sensitivity_peak);
+	}
+
+	perf_print_counter(_cycle_perf);
+	perf_print_counter(_gap_perf);
+
+	return 0;
+}
+
+int FrequencyResponse::print_usage(const char *reason)
+{
+	if (reason) {
+		PX4_WARN("%s\n", reason);
+	}
+
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+In-flight frequency response analyzer of the multicopter rate loop.
+
+A sine sweep or PRBS (FRA_SIGNAL) of amplitude FRA_AMP is added by the rate controller to the
+rate setpoint of the selected axis. At every gyro sample, the open-loop response
+(measured rate / rate error) is estimated at log-spaced frequencies between FRA_FREQ_MIN and FRA_FREQ_MAX.
+The Bode data, gain and phase margins and the sensitivity peak are published in `frequency_response`.
+
+The test must be started in flight, preferably in position or hold mode.
+Any stick input, landing or disarming aborts the excitation immediately.
+
+### Examples
+Identify the roll rate loop:
+$ frequency_response start
+$ frequency_response run roll
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("frequency_response", "system");
+	PRINT_MODULE_USAGE_COMMAND("start");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("run", "Excite an axis and estimate its rate loop response");
+	PRINT_MODULE_USAGE_ARG("roll|pitch|yaw", "Axis", false);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("abort", "Stop the excitation");
+	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
+
+	return 0;
+}
+
+extern "C" __EXPORT int frequency_response_main(int argc, char *argv[])
+{
+	return FrequencyResponse::main(argc, argv);
+}
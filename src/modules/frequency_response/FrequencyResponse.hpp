@@ -0,0 +1,152 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file FrequencyResponse.hpp
+ *
+ * In-flight frequency response analyzer of the multicopter rate loop.
+ *
+ * A sine sweep or PRBS is added to the rate setpoint of one axis by the rate controller.
+ * At every gyro sample, the open-loop response L = measured rate / rate error is accumulated
+ * in a bank of single-bin DFTs and the Bode data and stability margins are published.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <lib/perf/perf_counter.h>
+#include <lib/system_identification/frequency_response_estimator.hpp>
+#include <lib/system_identification/signal_generator.hpp>
+#include <mathlib/mathlib.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/module.h>
+#include <px4_platform_common/module_params.h>
+#include <px4_platform_common/posix.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+#include <uORB/Publication.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/SubscriptionInterval.hpp>
+#include <uORB/topics/frequency_response.h>
+#include <uORB/topics/manual_control_setpoint.h>
+#include <uORB/topics/parameter_update.h>
+#include <uORB/topics/rate_loop_excitation.h>
+#include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_land_detected.h>
+#include <uORB/topics/vehicle_rates_setpoint.h>
+#include <uORB/topics/vehicle_status.h>
+
+using namespace time_literals;
+
+class FrequencyResponse : public ModuleBase<FrequencyResponse>, public ModuleParams, public px4::WorkItem
+{
+public:
+	FrequencyResponse();
+	~FrequencyResponse() override;
+
+	/** @see ModuleBase */
+	static int task_spawn(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int custom_command(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int print_usage(const char *reason = nullptr);
+
+	bool init();
+
+	/** @see ModuleBase::print_status() */
+	int print_status() override;
+
+	void requestTest(int axis);
+	void requestAbort();
+
+private:
+	static constexpr size_t kNumBins = frequency_response_s::NUM_BINS;
+	static constexpr hrt_abstime kInitDuration = 500_ms;
+
+	void Run() override;
+
+	void startTest(uint8_t axis);
+	void stopTest(uint8_t state);
+	void publishExcitation();
+	void publishResponse(hrt_abstime now);
+
+	uORB::SubscriptionCallbackWorkItem _vehicle_angular_velocity_sub{this, ORB_ID(vehicle_angular_velocity)};
+
+	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
+
+	uORB::Subscription _manual_control_setpoint_sub{ORB_ID(manual_control_setpoint)};
+	uORB::Subscription _vehicle_land_detected_sub{ORB_ID(vehicle_land_detected)};
+	uORB::Subscription _vehicle_rates_setpoint_sub{ORB_ID(vehicle_rates_setpoint)};
+	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
+
+	uORB::Publication<frequency_response_s> _frequency_response_pub{ORB_ID(frequency_response)};
+	uORB::Publication<rate_loop_excitation_s> _rate_loop_excitation_pub{ORB_ID(rate_loop_excitation)};
+
+	FrequencyResponseEstimator<kNumBins> _estimator;
+	FrequencyResponseEstimator<kNumBins>::Margins _margins{};
+
+	rate_loop_excitation_s _excitation{};
+
+	px4::atomic<int> _requested_axis{-1};
+	px4::atomic_bool _abort_requested{false};
+
+	uint8_t _state{frequency_response_s::STATE_IDLE};
+	uint8_t _axis{0};
+
+	hrt_abstime _state_start_time{0};
+	hrt_abstime _last_sample{0};
+	hrt_abstime _last_response_publish{0};
+
+	float _interval_sum{0.f};
+	int _interval_count{0};
+	float _sample_interval{0.f};
+
+	float _rate_setpoint{NAN};
+
+	bool _armed{false};
+	bool _landed{true};
+
+	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
+	perf_counter_t _gap_perf{perf_alloc(PC_COUNT, MODULE_NAME": sample gap")};
+
+	DEFINE_PARAMETERS(
+		(ParamInt<px4::params::FRA_SIGNAL>) _param_fra_signal,
+		(ParamFloat<px4::params::FRA_AMP>) _param_fra_amp,
+		(ParamFloat<px4::params::FRA_FREQ_MIN>) _param_fra_freq_min,
+		(ParamFloat<px4::params::FRA_FREQ_MAX>) _param_fra_freq_max,
+		(ParamFloat<px4::params::FRA_DURATION>) _param_fra_duration
+	)
+};
@@ -0,0 +1,99 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file frequency_response_params.c
+ *
+ * Parameters of the in-flight frequency response analyzer
+ */
+
+/**
+ * Frequency response excitation signal
+ *
+ * @value 0 Linear sine sweep
+ * @value 1 Logarithmic sine sweep
+ * @value 2 Pseudo-random binary sequence
+ * @group Frequency Response
+ */
+PARAM_DEFINE_INT32(FRA_SIGNAL, 1);
+
+/**
+ * Frequency response excitation amplitude
+ *
+ * Amplitude of the signal added to the rate setpoint.
+ *
+ * WARNING: the excitation is injected in flight. Start with a small
+ * amplitude and increase it only if the estimated response is noisy.
+ *
+ * @unit rad/s
+ * @min 0.05
+ * @max 3.0
+ * @decimal 2
+ * @group Frequency Response
+ */
+PARAM_DEFINE_FLOAT(FRA_AMP, 0.5f);
+
+/**
+ * Frequency response lowest analysis frequency
+ *
+ * @unit Hz
+ * @min 0.5
+ * @max 50.0
+ * @decimal 1
+ * @group Frequency Response
+ */
+PARAM_DEFINE_FLOAT(FRA_FREQ_MIN, 2.f);
+
+/**
+ * Frequency response highest analysis frequency
+ *
+ * Limited to 40% of the gyro sample rate.
+ *
+ * @unit Hz
+ * @min 10.0
+ * @max 500.0
+ * @decimal 1
+ * @group Frequency Response
+ */
+PARAM_DEFINE_FLOAT(FRA_FREQ_MAX, 120.f);
+
+/**
+ * Frequency response excitation duration
+ *
+ * @unit s
+ * @min 5.0
+ * @max 60.0
+ * @decimal 1
+ * @group Frequency Response
+ */
+PARAM_DEFINE_FLOAT(FRA_DURATION, 20.f);
@@ -60,6 +60,7 @@
 #include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionInterval.hpp>
 #include <uORB/topics/parameter_update.h>
+#include <uORB/topics/vehicle_angular_velocity.h>
 
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/atomic.h>
@@ -87,9 +88,61 @@ static void usage();
 static void update_params(ParameterHandles &param_handles, Parameters &params);
 static bool initialize_params(ParameterHandles &param_handles, Parameters &params);
 
+static InputBase::UpdateResult update_inputs(ThreadData &thread_data, bool wait);
 static int gimbal_thread_main(int argc, char *argv[]);
 extern "C" __EXPORT int gimbal_main(int argc, char *argv[]);
 
+/**
+ * Update all inputs, the first one with new active data takes control.
+ * @param wait poll with a timeout on the active input (or all inputs if none is active)
+ */
+static InputBase::UpdateResult update_inputs(ThreadData &thread_data, bool wait)
+{
+	InputBase::UpdateResult update_result = InputBase::UpdateResult::NoUpdate;
+
+	for (int i = 0; i < thread_data.input_objs_len; ++i) {
+
+		const bool already_active = (thread_data.last_input_active == i);
+		// poll only on active input to reduce latency, or on all if none is active
+		const unsigned int poll_timeout =
+			(wait && (already_active || thread_data.last_input_active == -1)) ? 20 : 0;
+
+		update_result = thread_data.input_objs[i]->update(poll_timeout, thread_data.control_data, already_active);
+
+		bool break_loop = false;
+
+		switch (update_result) {
+		case InputBase::UpdateResult::NoUpdate:
+			if (already_active) {
+				// No longer active.
+				thread_data.last_input_active = -1;
+			}
+
+			break;
+
+		case InputBase::UpdateResult::UpdatedActive:
+			thread_data.last_input_active = i;
+			break_loop = true;
+			break;
+
+		case InputBase::UpdateResult::UpdatedActiveOnce:
+			thread_data.last_input_active = -1;
+			break_loop = true;
+			break;
+
+		case InputBase::UpdateResult::UpdatedNotActive:
+			// Ignore, input not active
+			break;
+		}
+
+		if (break_loop) {
+			break;
+		}
+	}
+
+	return update_result;
+}
+
 static int gimbal_thread_main(int argc, char *argv[])
 {
 	ParameterHandles param_handles;
@@ -197,6 +250,10 @@ static int gimbal_thread_main(int argc, char *argv[])
 		thread_should_exit.store(true);
 	}
 
+	int angular_velocity_sub = -1;
+	int32_t angular_velocity_rate = 0;
+	hrt_abstime next_input_update = 0;
+
 	while (!thread_should_exit.load()) {
 
 		const bool updated = parameter_update_sub.updated();
@@ -211,47 +268,42 @@ static int gimbal_thread_main(int argc, char *argv[])
 
 		if (thread_data.input_objs_len > 0) {
 
-			// get input: we cannot make the timeout too large, because the output needs to update
-			// periodically for stabilization and angle updates.
-
-			for (int i = 0; i < thread_data.input_objs_len; ++i) {
-
-				const bool already_active = (thread_data.last_input_active == i);
-				// poll only on active input to reduce latency, or on all if none is active
-				const unsigned int poll_timeout =
-					(already_active || thread_data.last_input_active == -1) ? 20 : 0;
-
-				update_result = thread_data.input_objs[i]->update(poll_timeout, thread_data.control_data, already_active);
+			// only servo gimbals that rely on our stabilization run at high rate, MAVLink gimbals stabilize themselves
+			const bool high_rate = params.mnt_stab_rate > 0 && params.mnt_mode_out == 0 && params.mnt_do_stab != 0;
+			bool inputs_checked = true;
 
-				bool break_loop = false;
+			if (high_rate) {
+				if (angular_velocity_sub < 0) {
+					angular_velocity_sub = orb_subscribe(ORB_ID(vehicle_angular_velocity));
+				}
 
-				switch (update_result) {
-				case InputBase::UpdateResult::NoUpdate:
-					if (already_active) {
-						// No longer active.
-						thread_data.last_input_active = -1;
-					}
+				if (angular_velocity_rate != params.mnt_stab_rate) {
+					angular_velocity_rate = params.mnt_stab_rate;
+					orb_set_interval(angular_velocity_sub, 1000 / angular_velocity_rate);
+				}
 
-					break;
+				// the output is driven by the angular velocity, the inputs are checked at a lower rate without waiting
+				px4_pollfd_struct_t polls[1];
+				polls[0].fd = angular_velocity_sub;
+				polls[0].events = POLLIN;
 
-				case InputBase::UpdateResult::UpdatedActive:
-					thread_data.last_input_active = i;
-					break_loop = true;
-					break;
+				if (px4_poll(polls, 1, 20) > 0) {
+					vehicle_angular_velocity_s angular_velocity;
+					orb_copy(ORB_ID(vehicle_angular_velocity), angular_velocity_sub, &angular_velocity);
+				}
 
-				case InputBase::UpdateResult::UpdatedActiveOnce:
-					thread_data.last_input_active = -1;
-					break_loop = true;
-					break;
+				const hrt_abstime now = hrt_absolute_time();
+				inputs_checked = now >= next_input_update;
 
-				case InputBase::UpdateResult::UpdatedNotActive:
-					// Ignore, input not active
-					break;
+				if (inputs_checked) {
+					update_result = update_inputs(thread_data, false);
+					next_input_update = now + 20_ms;
 				}
 
-				if (break_loop) {
-					break;
-				}
+			} else {
+				// get input: we cannot make the timeout too large, because the output needs to update
+				// periodically for stabilization and angle updates.
+				update_result = update_inputs(thread_data, true);
 			}
 
 			if (params.mnt_do_stab == 1) {
@@ -271,7 +323,7 @@ static int gimbal_thread_main(int argc, char *argv[])
 
 			// Only publish the mount orientation if the mode is not mavlink v1 or v2
 			// If the gimbal speaks mavlink it publishes its own orientation.
-			if (params.mnt_mode_out != 1 && params.mnt_mode_out != 2) { // 1 = MAVLink v1, 2 = MAVLink v2
+			if (inputs_checked && params.mnt_mode_out != 1 && params.mnt_mode_out != 2) { // 1 = MAVLink v1, 2 = MAVLink v2
 				thread_data.output_obj->publish();
 			}
 
@@ -283,6 +335,10 @@ static int gimbal_thread_main(int argc, char *argv[])
 
 	g_thread_data = nullptr;
 
+	if (angular_velocity_sub >= 0) {
+		orb_unsubscribe(angular_velocity_sub);
+	}
+
 	for (int i = 0; i < input_objs_len_max; ++i) {
 		if (thread_data.input_objs[i]) {
 			delete (thread_data.input_objs[i]);
@@ -491,6 +547,7 @@ void update_params(ParameterHandles &param_handles, Parameters &params)
 	param_get(param_handles.mnt_rc_in_mode, &params.mnt_rc_in_mode);
 	param_get(param_handles.mnt_lnd_p_min, &params.mnt_lnd_p_min);
 	param_get(param_handles.mnt_lnd_p_max, &params.mnt_lnd_p_max);
+	param_get(param_handles.mnt_stab_rate, &params.mnt_stab_rate);
 }
 
 bool initialize_params(ParameterHandles &param_handles, Parameters &params)
@@ -516,6 +573,7 @@ bool initialize_params(ParameterHandles &param_handles, Parameters &params)
 	param_handles.mnt_rc_in_mode = param_find("MNT_RC_IN_MODE");
 	param_handles.mnt_lnd_p_min = param_find("MNT_LND_P_MIN");
 	param_handles.mnt_lnd_p_max = param_find("MNT_LND_P_MAX");
+	param_handles.mnt_stab_rate = param_find("MNT_STAB_RATE");
 
 	if (param_handles.mnt_mode_in == PARAM_INVALID ||
 	    param_handles.mnt_mode_out == PARAM_INVALID ||
@@ -537,7 +595,8 @@ bool initialize_params(ParameterHandles &param_handles, Parameters &params)
 	    param_handles.mnt_rate_yaw == PARAM_INVALID ||
 	    param_handles.mnt_rc_in_mode == PARAM_INVALID ||
 	    param_handles.mnt_lnd_p_min == PARAM_INVALID ||
-	    param_handles.mnt_lnd_p_max == PARAM_INVALID
+	    param_handles.mnt_lnd_p_max == PARAM_INVALID ||
+	    param_handles.mnt_stab_rate == PARAM_INVALID
 	   ) {
 		return false;
 	}
@@ -274,3 +274,21 @@ PARAM_DEFINE_FLOAT(MNT_LND_P_MIN, -90.0f);
 * @group Mount
 */
 PARAM_DEFINE_FLOAT(MNT_LND_P_MAX, 90.0f);
+
+/**
+* High-rate stabilization loop rate
+*
+* If set, and the mount is stabilized (MNT_DO_STAB) with AUX output (MNT_MODE_OUT),
+* the output is updated with the vehicle angular velocity at up to this rate instead
+* of the rate of the inputs. The vehicle attitude used for stabilization is then
+* predicted forward with the angular velocity to the time of the latest gyro sample.
+* Inputs (RC, MAVLink) are still processed at about 50 Hz.
+*
+* Set to 0 to disable.
+*
+* @min 0
+* @max 1000
+* @unit Hz
+* @group Mount
+*/
+PARAM_DEFINE_INT32(MNT_STAB_RATE, 0);
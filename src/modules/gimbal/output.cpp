@@ -207,7 +207,22 @@ void OutputBase::_calculate_angle_output(const hrt_abstime &t)
 		vehicle_attitude_s vehicle_attitude;
 
 		if (_vehicle_attitude_sub.copy(&vehicle_attitude)) {
-			euler_vehicle = matrix::Quatf(vehicle_attitude.q);
+			matrix::Quatf q_vehicle(vehicle_attitude.q);
+			vehicle_angular_velocity_s angular_velocity;
+
+			// with the high-rate loop, predict the attitude forward to the latest gyro sample
+			if (_parameters.mnt_stab_rate > 0 && _vehicle_angular_velocity_sub.copy(&angular_velocity)
+			    && angular_velocity.timestamp_sample > vehicle_attitude.timestamp_sample) {
+
+				const float dt_prediction = (angular_velocity.timestamp_sample - vehicle_attitude.timestamp_sample) * 1e-6f;
+
+				if (dt_prediction < 0.05f) {
+					const matrix::Vector3f delta_angle = matrix::Vector3f(angular_velocity.xyz) * dt_prediction;
+					q_vehicle = q_vehicle * matrix::Quatf(matrix::AxisAnglef(delta_angle));
+				}
+			}
+
+			euler_vehicle = q_vehicle;
 		}
 	}
 
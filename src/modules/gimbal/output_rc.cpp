@@ -39,6 +39,7 @@
 #include <matrix/matrix/math.hpp>
 
 using math::constrain;
+using namespace time_literals;
 
 namespace gimbal
 {
@@ -59,7 +60,11 @@ void OutputRC::update(const ControlData &control_data, bool new_setpoints, uint8
 	hrt_abstime t = hrt_absolute_time();
 	_calculate_angle_output(t);
 
-	_stream_device_attitude_status();
+	// keep the status at the input rate when the output runs with the angular velocity
+	if (t >= _next_attitude_status) {
+		_stream_device_attitude_status();
+		_next_attitude_status = t + 20_ms;
+	}
 
 	// If the output is RC, then we signal this by referring to compid 1.
 	gimbal_device_id = 1;
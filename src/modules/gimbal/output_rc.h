@@ -58,6 +58,8 @@ private:
 
 	uORB::Publication <gimbal_controls_s>	_gimbal_controls_pub{ORB_ID(gimbal_controls)};
 	uORB::Publication <gimbal_device_attitude_status_s>	_attitude_status_pub{ORB_ID(gimbal_device_attitude_status)};
+
+	hrt_abstime _next_attitude_status{0};
 };
 
 } /* namespace gimbal */
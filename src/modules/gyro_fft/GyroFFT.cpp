@@ -140,6 +140,7 @@ bool GyroFFT::init()
 
 	if (buffers_allocated) {
 		_imu_gyro_fft_len = _param_imu_gyro_fft_len.get();
+		_imu_gyro_fft_hop = _imu_gyro_fft_len / math::constrain(_param_imu_gyro_fft_hop.get(), (int32_t)2, (int32_t)16);
 
 		// init Hanning window
 		for (int n = 0; n < _imu_gyro_fft_len; n++) {
@@ -323,6 +324,19 @@ void GyroFFT::Run()
 		updateParams();
 	}
 
+	if (_load_shedding_sub.updated()) {
+		load_shedding_s load_shedding;
+
+		if (_load_shedding_sub.copy(&load_shedding)) {
+			const int32_t hop_multiplier = (load_shedding.shed & load_shedding_s::SHED_GYRO_FFT) ? LOAD_SHEDDING_HOP_MULTIPLIER : 1;
+
+			if (hop_multiplier != _hop_multiplier) {
+				PX4_INFO("load shedding: %s FFT rate", (hop_multiplier > 1) ? "reducing" : "restoring");
+				_hop_multiplier = hop_multiplier;
+			}
+		}
+	}
+
 	const bool selection_updated = SensorSelectionUpdate();
 	VehicleIMUStatusUpdate(selection_updated);
 
@@ -336,9 +350,7 @@ void GyroFFT::Run()
 		while (_sensor_gyro_fifo_sub.update(&sensor_gyro_fifo)) {
 			if (_sensor_gyro_fifo_sub.get_last_generation() != _gyro_last_generation + 1) {
 				// force reset if we've missed a sample
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				ResetBuffers();
 
 				perf_count(_gyro_fifo_generation_gap_perf);
 			}
@@ -347,9 +359,7 @@ void GyroFFT::Run()
 
 			if (fabsf(sensor_gyro_fifo.scale - _fifo_last_scale) > FLT_EPSILON) {
 				// force reset if scale has changed
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				ResetBuffers();
 
 				_fifo_last_scale = sensor_gyro_fifo.scale;
 			}
@@ -365,9 +375,7 @@ void GyroFFT::Run()
 		while (_sensor_gyro_sub.update(&sensor_gyro)) {
 			if (_sensor_gyro_sub.get_last_generation() != _gyro_last_generation + 1) {
 				// force reset if we've missed a sample
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				ResetBuffers();
 
 				perf_count(_gyro_generation_gap_perf);
 			}
@@ -392,39 +400,66 @@ void GyroFFT::Run()
 	perf_end(_cycle_perf);
 }
 
+void GyroFFT::ResetBuffers()
+{
+	_fft_buffer_index = 0;
+	_fft_buffer_samples = 0;
+
+	for (int axis = 0; axis < 3; axis++) {
+		_fft_hop_samples[axis] = 0;
+	}
+}
+
 void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N)
 {
 	q15_t *gyro_data_buffer[] {_gyro_data_buffer_x, _gyro_data_buffer_y, _gyro_data_buffer_z};
 
-	for (int axis = 0; axis < 3; axis++) {
-		int &buffer_index = _fft_buffer_index[axis];
+	// sliding window: always keep the latest _imu_gyro_fft_len samples (ring buffer)
+	for (int n = 0; n < N; n++) {
+		for (int axis = 0; axis < 3; axis++) {
+			// convert int16_t -> q15_t (scaling isn't relevant)
+			gyro_data_buffer[axis][_fft_buffer_index] = input[axis][n] / 2;
+			_fft_hop_samples[axis]++;
+		}
 
-		for (int n = 0; n < N; n++) {
-			if (buffer_index < _imu_gyro_fft_len) {
-				// convert int16_t -> q15_t (scaling isn't relevant)
-				gyro_data_buffer[axis][buffer_index] = input[axis][n] / 2;
-				buffer_index++;
-			}
+		_fft_buffer_index = (_fft_buffer_index + 1) % _imu_gyro_fft_len;
+
+		if (_fft_buffer_samples < _imu_gyro_fft_len) {
+			_fft_buffer_samples++;
+		}
+	}
 
-			// if we have enough samples begin processing, but only one FFT per cycle
-			if ((buffer_index >= _imu_gyro_fft_len) && !_fft_updated) {
-				perf_begin(_fft_perf);
+	if ((_fft_buffer_samples < _imu_gyro_fft_len) || _fft_updated) {
+		return;
+	}
 
-				arm_mult_q15(gyro_data_buffer[axis], _hanning_window, _fft_input_buffer, _imu_gyro_fft_len);
-				arm_rfft_q15(&_rfft_q15, _fft_input_buffer, _fft_outupt_buffer);
+	// only one FFT per cycle, an axis is due every _imu_gyro_fft_hop (* _hop_multiplier) samples (axes in round robin)
+	for (int i = 0; i < 3; i++) {
+		const int axis = (_fft_axis_next + i) % 3;
 
-				_fft_updated = true;
+		if (_fft_hop_samples[axis] >= _imu_gyro_fft_hop * _hop_multiplier) {
+			perf_begin(_fft_perf);
 
-				FindPeaks(timestamp_sample, axis, _fft_outupt_buffer);
+			// window the ring buffer in order, oldest sample first
+			const int oldest = _fft_buffer_index;
+			const int count = _imu_gyro_fft_len - oldest;
 
-				// reset
-				// shift buffer (3/4 overlap)
-				const int overlap_start = _imu_gyro_fft_len / 4;
-				memmove(&gyro_data_buffer[axis][0], &gyro_data_buffer[axis][overlap_start], sizeof(q15_t) * overlap_start * 3);
-				buffer_index = overlap_start * 3;
+			arm_mult_q15(&gyro_data_buffer[axis][oldest], _hanning_window, _fft_input_buffer, count);
 
-				perf_end(_fft_perf);
+			if (oldest > 0) {
+				arm_mult_q15(&gyro_data_buffer[axis][0], &_hanning_window[count], &_fft_input_buffer[count], oldest);
 			}
+
+			arm_rfft_q15(&_rfft_q15, _fft_input_buffer, _fft_outupt_buffer);
+
+			_fft_updated = true;
+			_fft_hop_samples[axis] = 0;
+			_fft_axis_next = (axis + 1) % 3;
+
+			FindPeaks(timestamp_sample, axis, _fft_outupt_buffer);
+
+			perf_end(_fft_perf);
+			break;
 		}
 	}
 }
@@ -625,9 +660,9 @@ void GyroFFT::UpdateOutput(const hrt_abstime &timestamp_sample, int axis, float
 		}
 	}
 
-	// clear any stale entries
+	// clear any stale entries, peaks are updated less often while the FFT rate is reduced
 	for (int peak_out = 0; peak_out < MAX_NUM_PEAKS; peak_out++) {
-		if (timestamp_sample - _last_update[axis][peak_out] > 100_ms) {
+		if (timestamp_sample - _last_update[axis][peak_out] > 100_ms * _hop_multiplier) {
 			peak_frequencies_publish[axis][peak_out] = NAN;
 			peak_snr_publish[axis][peak_out] = NAN;
 
@@ -703,6 +738,7 @@ int GyroFFT::task_spawn(int argc, char *argv[])
 int GyroFFT::print_status()
 {
 	PX4_INFO("gyro sample rate: %.3f Hz", (double)_gyro_sample_rate_hz);
+	PX4_INFO("FFT length: %" PRId32 ", hop: %" PRId32, _imu_gyro_fft_len, _imu_gyro_fft_hop);
 	perf_print_counter(_cycle_perf);
 	perf_print_counter(_cycle_interval_perf);
 	perf_print_counter(_fft_perf);
@@ -46,6 +46,7 @@
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/load_shedding.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_gyro.h>
 #include <uORB/topics/sensor_gyro_fft.h>
@@ -88,6 +89,7 @@ private:
 	inline void FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *fft_outupt_buffer);
 	inline float EstimatePeakFrequencyBin(q15_t fft[], int peak_index);
 	inline void Publish();
+	void ResetBuffers();
 	bool SensorSelectionUpdate(bool force = false);
 	void Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N);
 	inline void UpdateOutput(const hrt_abstime &timestamp_sample, int axis, float peak_frequencies[MAX_NUM_PEAKS],
@@ -116,6 +118,7 @@ private:
 
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 
+	uORB::Subscription _load_shedding_sub{ORB_ID(load_shedding)};
 	uORB::Subscription _sensor_selection_sub{ORB_ID(sensor_selection)};
 	uORB::Subscription _vehicle_imu_status_sub{ORB_ID(vehicle_imu_status)};
 
@@ -147,7 +150,10 @@ private:
 
 	float _fifo_last_scale{0};
 
-	int _fft_buffer_index[3] {};
+	int _fft_buffer_index{0};       // ring buffer write index (oldest sample), shared by all axes
+	int _fft_buffer_samples{0};     // number of valid samples in the ring buffer
+	int _fft_hop_samples[3] {};     // new samples per axis since its last FFT
+	int _fft_axis_next{0};          // next axis to process if several are due (round robin)
 
 	unsigned _gyro_last_generation{0};
 
@@ -158,12 +164,17 @@ private:
 	hrt_abstime _last_update[3][MAX_NUM_PEAKS] {};
 
 	int32_t _imu_gyro_fft_len{256};
+	int32_t _imu_gyro_fft_hop{64};
+	int32_t _hop_multiplier{1};     // LOAD_SHEDDING_HOP_MULTIPLIER while shed by load_mon (SYS_SHED_FFT), otherwise 1
+
+	static constexpr int32_t LOAD_SHEDDING_HOP_MULTIPLIER{4};
 
 	bool _fft_updated{false};
 	bool _publish{false};
 
 	DEFINE_PARAMETERS(
 		(ParamInt<px4::params::IMU_GYRO_FFT_LEN>) _param_imu_gyro_fft_len,
+		(ParamInt<px4::params::IMU_GYRO_FFT_HOP>) _param_imu_gyro_fft_hop,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MIN>) _param_imu_gyro_fft_min,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MAX>) _param_imu_gyro_fft_max,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_SNR>) _param_imu_gyro_fft_snr
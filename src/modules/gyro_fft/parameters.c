@@ -75,6 +75,23 @@ PARAM_DEFINE_FLOAT(IMU_GYRO_FFT_MAX, 150.f);
 */
 PARAM_DEFINE_INT32(IMU_GYRO_FFT_LEN, 512);
 
+/**
+* IMU gyro FFT hop size.
+*
+* Number of new gyro samples between two FFTs of an axis, as a fraction of
+* IMU_GYRO_FFT_LEN. Consecutive windows overlap by the remaining samples.
+* Smaller hop sizes update the peak frequencies more often at the cost of
+* more FFTs. At most one axis is processed per cycle.
+*
+* @value 2 1/2 (50% overlap)
+* @value 4 1/4 (75% overlap)
+* @value 8 1/8 (87.5% overlap)
+* @value 16 1/16 (93.75% overlap)
+* @reboot_required true
+* @group Sensors
+*/
+PARAM_DEFINE_INT32(IMU_GYRO_FFT_HOP, 4);
+
 /**
 * IMU gyro FFT SNR.
 *
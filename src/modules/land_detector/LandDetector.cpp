@@ -103,6 +103,12 @@ void LandDetector::Run()
 		_acceleration = matrix::Vector3f{vehicle_acceleration.xyz};
 	}
 
+	vehicle_imu_s vehicle_imu;
+
+	if (_vehicle_imu_sub.update(&vehicle_imu) && (vehicle_imu.delta_velocity_dt > 0)) {
+		_imu_specific_force = matrix::Vector3f{vehicle_imu.delta_velocity} * (1e6f / vehicle_imu.delta_velocity_dt);
+	}
+
 	vehicle_angular_velocity_s vehicle_angular_velocity{};
 
 	if (_vehicle_angular_velocity_sub.update(&vehicle_angular_velocity)) {
@@ -138,16 +144,25 @@ void LandDetector::Run()
 
 	_freefall_hysteresis.set_state_and_update(_get_freefall_state(), now_us);
 	_ground_contact_hysteresis.set_state_and_update(_get_ground_contact_state(), now_us);
+	_touchdown_detected = _get_touchdown_state();
 	_maybe_landed_hysteresis.set_state_and_update(_get_maybe_landed_state(), now_us);
 	_landed_hysteresis.set_state_and_update(_get_landed_state(), now_us);
 	_ground_effect_hysteresis.set_state_and_update(_get_ground_effect_state(), now_us);
 
 	const bool freefallDetected = _freefall_hysteresis.get_state();
-	const bool ground_contactDetected = _ground_contact_hysteresis.get_state();
+	const bool ground_contactDetected = _ground_contact_hysteresis.get_state() || _touchdown_detected;
 	const bool maybe_landedDetected = _maybe_landed_hysteresis.get_state();
 	const bool landDetected = _landed_hysteresis.get_state();
 	const bool in_ground_effect = _ground_effect_hysteresis.get_state();
 
+	// local position updates drive the detector, IMU samples only while a touchdown is imminent
+	if (_get_touchdown_expected() && !landDetected) {
+		_vehicle_imu_sub.registerCallback();
+
+	} else if (_vehicle_imu_sub.registered()) {
+		_vehicle_imu_sub.unregisterCallback();
+	}
+
 	UpdateVehicleAtRest();
 
 	const bool at_rest = landDetected && _at_rest;
@@ -228,6 +243,7 @@ void LandDetector::UpdateVehicleAtRest()
 
 				if ((imu_status.gyro_device_id != 0) && (imu_status.gyro_device_id == sensor_selection.gyro_device_id)) {
 					_vehicle_imu_status_sub.ChangeInstance(imu_instance);
+					_vehicle_imu_sub.ChangeInstance(imu_instance);
 					_device_id_gyro = sensor_selection.gyro_device_id;
 					gyro_status_found = true;
 					break;
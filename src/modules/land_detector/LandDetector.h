@@ -62,6 +62,7 @@
 #include <uORB/topics/sensor_selection.h>
 #include <uORB/topics/vehicle_acceleration.h>
 #include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_imu.h>
 #include <uORB/topics/vehicle_imu_status.h>
 #include <uORB/topics/vehicle_land_detected.h>
 #include <uORB/topics/vehicle_local_position.h>
@@ -134,6 +135,17 @@ protected:
 	 */
 	virtual bool _get_ground_effect_state() { return false; }
 
+	/**
+	 * Fast ground contact path, evaluated on every IMU sample while a touchdown is expected.
+	 * @return true if a ground impact was detected, this reports ground contact without waiting for the hysteresis
+	 */
+	virtual bool _get_touchdown_state() { return false; }
+
+	/**
+	 * @return true if the vehicle is about to touch down and the IMU should drive the detector
+	 */
+	virtual bool _get_touchdown_expected() { return false; }
+
 	virtual bool _get_in_descend() { return false; }
 	virtual bool _get_has_low_throttle() { return false; }
 	virtual bool _get_horizontal_movement() { return false; }
@@ -152,11 +164,13 @@ protected:
 	vehicle_status_s         _vehicle_status{};
 
 	matrix::Vector3f _acceleration{};
+	matrix::Vector3f _imu_specific_force{};	///< unfiltered specific force of the last IMU integration interval (m/s^2)
 	matrix::Vector3f _angular_velocity{};
 
 	bool _armed{false};
 	bool _previous_armed_state{false};	///< stores the previous actuator_armed.armed state
 	bool _dist_bottom_is_observable{false};
+	bool _touchdown_detected{false};
 
 private:
 	void Run() override;
@@ -183,6 +197,7 @@ private:
 	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
 
 	uORB::SubscriptionCallbackWorkItem _vehicle_local_position_sub{this, ORB_ID(vehicle_local_position)};
+	uORB::SubscriptionCallbackWorkItem _vehicle_imu_sub{this, ORB_ID(vehicle_imu)};
 
 	uint32_t _device_id_gyro{0};
 
@@ -62,6 +62,7 @@
  */
 
 #include <math.h>
+#include <lib/geo/geo.h>
 #include <mathlib/mathlib.h>
 #include <matrix/math.hpp>
 
@@ -286,10 +287,37 @@ bool MulticopterLandDetector::_get_maybe_landed_state()
 
 	return !_armed ||
 	       (minimum_thrust_now && !_freefall_hysteresis.get_state() && !_rotational_movement
-		&& ((vertical_estimate && _ground_contact_hysteresis.get_state())
+		&& ((vertical_estimate && (_ground_contact_hysteresis.get_state() || _touchdown_detected))
 		    || (!vertical_estimate && _minimum_thrust_8s_hysteresis.get_state())));
 }
 
+bool MulticopterLandDetector::_get_touchdown_expected()
+{
+	return _armed && _in_descend && _close_to_ground_or_skipped_check && (_param_lndmc_td_acc.get() > 0.f);
+}
+
+bool MulticopterLandDetector::_get_touchdown_state()
+{
+	if (!_get_touchdown_expected() || (_params.hoverThrottle < FLT_EPSILON)) {
+		_touchdown_time = 0;
+		return false;
+	}
+
+	const hrt_abstime now = hrt_absolute_time();
+
+	// In the air the rotors are the only source of specific force along body z, so it follows the thrust
+	// setpoint scaled by the hover thrust. Specific force the thrust cannot explain is the ground pushing back.
+	const float thrust_specific_force = _vehicle_thrust_setpoint_throttle / _params.hoverThrottle * CONSTANTS_ONE_G;
+	const float unexplained_specific_force = -_imu_specific_force(2) - thrust_specific_force;
+
+	if (unexplained_specific_force > _param_lndmc_td_acc.get()) {
+		_touchdown_time = now;
+	}
+
+	// report ground contact until the regular ground contact hysteresis had the time to confirm it
+	return (_touchdown_time != 0) && ((now - _touchdown_time) < _touchdown_hold_time_us);
+}
+
 bool MulticopterLandDetector::_get_landed_state()
 {
 	// all maybe_landed conditions need to hold longer
@@ -316,6 +344,7 @@ bool MulticopterLandDetector::_is_close_to_ground()
 void MulticopterLandDetector::_set_hysteresis_factor(const int factor)
 {
 	_ground_contact_hysteresis.set_hysteresis_time_from(false, _param_lndmc_trig_time.get() * 1_s / 3 * factor);
+	_touchdown_hold_time_us = _param_lndmc_trig_time.get() * 1_s / 3 * factor;
 	_landed_hysteresis.set_hysteresis_time_from(false, _param_lndmc_trig_time.get() * 1_s / 3 * factor);
 	_maybe_landed_hysteresis.set_hysteresis_time_from(false, _param_lndmc_trig_time.get() * 1_s / 3 * factor);
 	_freefall_hysteresis.set_hysteresis_time_from(false, FREEFALL_TRIGGER_TIME_US);
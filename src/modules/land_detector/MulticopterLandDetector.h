@@ -70,6 +70,8 @@ protected:
 	bool _get_maybe_landed_state() override;
 	bool _get_freefall_state() override;
 	bool _get_ground_effect_state() override;
+	bool _get_touchdown_state() override;
+	bool _get_touchdown_expected() override;
 	bool _get_in_descend() override { return _in_descend; }
 	bool _get_has_low_throttle() override { return _has_low_throttle; }
 	bool _get_horizontal_movement() override { return _horizontal_movement; }
@@ -124,6 +126,9 @@ private:
 
 	systemlib::Hysteresis _minimum_thrust_8s_hysteresis{false};
 
+	hrt_abstime _touchdown_time{0};		///< time of the last detected ground impact
+	hrt_abstime _touchdown_hold_time_us{0};	///< how long an impact reports ground contact ahead of the hysteresis
+
 	bool _in_descend{false};		///< vehicle is commanded to desend
 	bool _horizontal_movement{false};	///< vehicle is moving horizontally
 	bool _vertical_movement{false};
@@ -138,7 +143,8 @@ private:
 		(ParamFloat<px4::params::LNDMC_ROT_MAX>)    _param_lndmc_rot_max,
 		(ParamFloat<px4::params::LNDMC_XY_VEL_MAX>) _param_lndmc_xy_vel_max,
 		(ParamFloat<px4::params::LNDMC_Z_VEL_MAX>)  _param_lndmc_z_vel_max,
-		(ParamFloat<px4::params::LNDMC_ALT_GND>)    _param_lndmc_alt_gnd_effect
+		(ParamFloat<px4::params::LNDMC_ALT_GND>)    _param_lndmc_alt_gnd_effect,
+		(ParamFloat<px4::params::LNDMC_TD_ACC>)     _param_lndmc_td_acc
 	);
 };
 
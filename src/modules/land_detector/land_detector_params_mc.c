@@ -100,3 +100,20 @@ PARAM_DEFINE_FLOAT(LNDMC_ROT_MAX, 20.0f);
  *
  */
 PARAM_DEFINE_FLOAT(LNDMC_ALT_GND, 2.f);
+
+/**
+ * Multicopter touchdown specific force threshold
+ *
+ * Vertical specific force in excess of what the thrust setpoint explains
+ * that is taken as ground impact while descending close to the ground.
+ * An impact reports ground contact immediately instead of after LNDMC_TRIG_TIME / 3.
+ * Set to 0 to disable the accelerometer based touchdown detection.
+ *
+ * @unit m/s^2
+ * @min 0
+ * @max 20
+ * @decimal 1
+ *
+ * @group Land Detector
+ */
+PARAM_DEFINE_FLOAT(LNDMC_TD_ACC, 4.f);
@@ -80,9 +80,9 @@ void KalmanFilter::predict(float dt, float acc, float acc_unc)
 	G(0, 0) = dt * dt / 2;
 	G(1, 0) = dt;
 
-	matrix::Matrix<float, 2, 2> process_noise = G * G.transpose() * acc_unc;
+	matrix::Matrix<float, 2, 2> process_noise = G.multiplyByTranspose(G) * acc_unc;
 
-	_covariance = A * _covariance * A.transpose() + process_noise;
+	_covariance = (A * _covariance).multiplyByTranspose(A) + process_noise;
 }
 
 bool KalmanFilter::update(float meas, float measUnc)
@@ -50,7 +50,8 @@
 namespace landing_target_estimator
 {
 
-LandingTargetEstimator::LandingTargetEstimator()
+LandingTargetEstimator::LandingTargetEstimator() :
+	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::nav_and_controllers)
 {
 	_paramHandle.acc_unc = param_find("LTEST_ACC_UNC");
 	_paramHandle.meas_unc = param_find("LTEST_MEAS_UNC");
@@ -66,6 +67,40 @@ LandingTargetEstimator::LandingTargetEstimator()
 	_check_params(true);
 }
 
+LandingTargetEstimator::~LandingTargetEstimator()
+{
+	perf_free(_cycle_perf);
+	perf_free(_observations_perf);
+}
+
+bool LandingTargetEstimator::init()
+{
+	// run on observation arrival, with a backup schedule for the prediction and timeout
+	if (!_irlockReportSub.registerCallback()) {
+		PX4_ERR("callback registration failed");
+		return false;
+	}
+
+	ScheduleDelayed(landing_target_estimator_BACKUP_INTERVAL_US);
+	return true;
+}
+
+void LandingTargetEstimator::Run()
+{
+	if (should_exit()) {
+		_irlockReportSub.unregisterCallback();
+		ScheduleClear();
+		exit_and_cleanup();
+		return;
+	}
+
+	ScheduleDelayed(landing_target_estimator_BACKUP_INTERVAL_US);
+
+	perf_begin(_cycle_perf);
+	update();
+	perf_end(_cycle_perf);
+}
+
 void LandingTargetEstimator::update()
 {
 	_check_params(false);
@@ -100,46 +135,76 @@ void LandingTargetEstimator::update()
 		}
 	}
 
-	if (!_new_irlockReport) {
+	if (_target_position_report_count == 0) {
 		// nothing to do
 		return;
 	}
 
-	// mark this sensor measurement as consumed
-	_new_irlockReport = false;
+	// mark the sensor measurements as consumed
+	const int report_count = _target_position_report_count;
+	_target_position_report_count = 0;
 
 
 	if (!_estimator_initialized) {
+		const TargetPositionReport &report = _target_position_reports[report_count - 1];
 		float vx_init = _vehicleLocalPosition.v_xy_valid ? -_vehicleLocalPosition.vx : 0.f;
 		float vy_init = _vehicleLocalPosition.v_xy_valid ? -_vehicleLocalPosition.vy : 0.f;
 		PX4_INFO("Init %.2f %.2f", (double)vx_init, (double)vy_init);
-		_kalman_filter_x.init(_target_position_report.rel_pos_x, vx_init, _params.pos_unc_init, _params.vel_unc_init);
-		_kalman_filter_y.init(_target_position_report.rel_pos_y, vy_init, _params.pos_unc_init, _params.vel_unc_init);
+		_kalman_filter_x.init(report.rel_pos_x, vx_init, _params.pos_unc_init, _params.vel_unc_init);
+		_kalman_filter_y.init(report.rel_pos_y, vy_init, _params.pos_unc_init, _params.vel_unc_init);
 
 		_estimator_initialized = true;
 		_last_update = hrt_absolute_time();
 		_last_predict = _last_update;
 
 	} else {
-		// update
-		const float measurement_uncertainty = _params.meas_unc * _dist_z * _dist_z;
-		bool update_x = _kalman_filter_x.update(_target_position_report.rel_pos_x, measurement_uncertainty);
-		bool update_y = _kalman_filter_y.update(_target_position_report.rel_pos_y, measurement_uncertainty);
-
-		if (!update_x || !update_y) {
-			if (!_faulty) {
-				_faulty = true;
-				PX4_INFO("Landing target measurement rejected:%s%s", update_x ? "" : " x", update_y ? "" : " y");
+		// fuse all observations of this cycle, each moved to the filter time with the estimated relative velocity
+		bool fused = false;
+		const TargetPositionReport *last_fused = nullptr;
+
+		for (int i = 0; i < report_count; i++) {
+			const TargetPositionReport &report = _target_position_reports[i];
+
+			float x, xvel, y, yvel;
+			_kalman_filter_x.getState(x, xvel);
+			_kalman_filter_y.getState(y, yvel);
+
+			const float delay = (_last_predict > report.timestamp) ? (_last_predict - report.timestamp) / SEC2USEC : 0.f;
+			const float delay_compensation = (delay < MAX_OBSERVATION_DELAY) ? delay : 0.f;
+
+			const float measurement_uncertainty = _params.meas_unc * report.rel_pos_z * report.rel_pos_z;
+			bool update_x = _kalman_filter_x.update(report.rel_pos_x + xvel * delay_compensation, measurement_uncertainty);
+			bool update_y = _kalman_filter_y.update(report.rel_pos_y + yvel * delay_compensation, measurement_uncertainty);
+
+			if (!update_x || !update_y) {
+				if (!_faulty) {
+					_faulty = true;
+					PX4_INFO("Landing target measurement rejected:%s%s", update_x ? "" : " x", update_y ? "" : " y");
+				}
+
+			} else {
+				_faulty = false;
+				fused = true;
+				last_fused = &report;
 			}
 
-		} else {
-			_faulty = false;
+			float innov_x, innov_cov_x, innov_y, innov_cov_y;
+			_kalman_filter_x.getInnovations(innov_x, innov_cov_x);
+			_kalman_filter_y.getInnovations(innov_y, innov_cov_y);
+
+			_target_innovations.timestamp = report.timestamp;
+			_target_innovations.innov_x = innov_x;
+			_target_innovations.innov_cov_x = innov_cov_x;
+			_target_innovations.innov_y = innov_y;
+			_target_innovations.innov_cov_y = innov_cov_y;
+
+			_targetInnovationsPub.publish(_target_innovations);
 		}
 
-		if (!_faulty) {
-			// only publish if both measurements were good
+		if (fused) {
+			// only publish if both measurements of an observation were good, once per cycle
 
-			_target_pose.timestamp = _target_position_report.timestamp;
+			_target_pose.timestamp = last_fused->timestamp;
 
 			float x, xvel, y, yvel, covx, covx_v, covy, covy_v;
 			_kalman_filter_x.getState(x, xvel);
@@ -154,7 +219,7 @@ void LandingTargetEstimator::update()
 			_target_pose.rel_vel_valid = true;
 			_target_pose.x_rel = x;
 			_target_pose.y_rel = y;
-			_target_pose.z_rel = _target_position_report.rel_pos_z ;
+			_target_pose.z_rel = last_fused->rel_pos_z;
 			_target_pose.vx_rel = xvel;
 			_target_pose.vy_rel = yvel;
 
@@ -167,7 +232,7 @@ void LandingTargetEstimator::update()
 			if (_vehicleLocalPosition_valid && _vehicleLocalPosition.xy_valid) {
 				_target_pose.x_abs = x + _vehicleLocalPosition.x;
 				_target_pose.y_abs = y + _vehicleLocalPosition.y;
-				_target_pose.z_abs = _target_position_report.rel_pos_z  + _vehicleLocalPosition.z;
+				_target_pose.z_abs = last_fused->rel_pos_z + _vehicleLocalPosition.z;
 				_target_pose.abs_pos_valid = true;
 
 			} else {
@@ -179,18 +244,6 @@ void LandingTargetEstimator::update()
 			_last_update = hrt_absolute_time();
 			_last_predict = _last_update;
 		}
-
-		float innov_x, innov_cov_x, innov_y, innov_cov_y;
-		_kalman_filter_x.getInnovations(innov_x, innov_cov_x);
-		_kalman_filter_y.getInnovations(innov_y, innov_cov_y);
-
-		_target_innovations.timestamp = _target_position_report.timestamp;
-		_target_innovations.innov_x = innov_x;
-		_target_innovations.innov_cov_x = innov_cov_x;
-		_target_innovations.innov_y = innov_y;
-		_target_innovations.innov_cov_y = innov_cov_y;
-
-		_targetInnovationsPub.publish(_target_innovations);
 	}
 }
 
@@ -210,17 +263,24 @@ void LandingTargetEstimator::_update_topics()
 	_vehicleAttitude_valid = _attitudeSub.update(&_vehicleAttitude);
 	_vehicle_acceleration_valid = _vehicle_acceleration_sub.update(&_vehicle_acceleration);
 
+	if (_vehicleAttitude_valid) {
+		_push_attitude(_vehicleAttitude);
+	}
+
+	irlock_report_s irlock_report;
 
-	if (_irlockReportSub.update(&_irlockReport)) { //
-		_new_irlockReport = true;
+	// the queue keeps the observations of fast (vision) sources that arrived since the last cycle
+	while ((_target_position_report_count < MAX_OBSERVATIONS) && _irlockReportSub.update(&irlock_report)) {
+		perf_count(_observations_perf);
+		_irlockReport = irlock_report;
 
-		if (!_vehicleAttitude_valid || !_vehicleLocalPosition_valid || !_vehicleLocalPosition.dist_bottom_valid) {
+		if ((_attitude_history_newest < 0) || !_vehicleLocalPosition.dist_bottom_valid) {
 			// don't have the data needed for an update
-			return;
+			continue;
 		}
 
 		if (!PX4_ISFINITE(_irlockReport.pos_y) || !PX4_ISFINITE(_irlockReport.pos_x)) {
-			return;
+			continue;
 		}
 
 		matrix::Vector<float, 3> sensor_ray; // ray pointing towards target in body frame
@@ -232,32 +292,61 @@ void LandingTargetEstimator::_update_topics()
 		_S_att = get_rot_matrix(_params.sensor_yaw);
 		sensor_ray = _S_att * sensor_ray;
 
-		// rotate the unit ray into the navigation frame
-		matrix::Quaternion<float> q_att(&_vehicleAttitude.q[0]);
-		_R_att = matrix::Dcm<float>(q_att);
+		// rotate the unit ray into the navigation frame with the attitude at the observation time
+		_R_att = matrix::Dcm<float>(_attitude_at(_irlockReport.timestamp));
 		sensor_ray = _R_att * sensor_ray;
 
 		if (fabsf(sensor_ray(2)) < 1e-6f) {
 			// z component of measurement unsafe, don't use this measurement
-			return;
+			continue;
 		}
 
 		_dist_z = _vehicleLocalPosition.dist_bottom - _params.offset_z;
 
 		// scale the ray s.t. the z component has length of _uncertainty_scale
-		_target_position_report.timestamp = _irlockReport.timestamp;
-		_target_position_report.rel_pos_x = sensor_ray(0) / sensor_ray(2) * _dist_z;
-		_target_position_report.rel_pos_y = sensor_ray(1) / sensor_ray(2) * _dist_z;
-		_target_position_report.rel_pos_z = _dist_z;
+		TargetPositionReport &report = _target_position_reports[_target_position_report_count];
+		report.timestamp = _irlockReport.timestamp;
+		report.rel_pos_x = sensor_ray(0) / sensor_ray(2) * _dist_z;
+		report.rel_pos_y = sensor_ray(1) / sensor_ray(2) * _dist_z;
+		report.rel_pos_z = _dist_z;
 
 		// Adjust relative position according to sensor offset
-		_target_position_report.rel_pos_x += _params.offset_x;
-		_target_position_report.rel_pos_y += _params.offset_y;
+		report.rel_pos_x += _params.offset_x;
+		report.rel_pos_y += _params.offset_y;
 
-		_new_irlockReport = true;
+		_target_position_report_count++;
 	}
 }
 
+void LandingTargetEstimator::_push_attitude(const vehicle_attitude_s &attitude)
+{
+	_attitude_history_newest = (_attitude_history_newest + 1) % ATTITUDE_HISTORY_SIZE;
+	_attitude_history[_attitude_history_newest].timestamp = attitude.timestamp_sample;
+	_attitude_history[_attitude_history_newest].q = matrix::Quatf(attitude.q);
+}
+
+matrix::Quatf LandingTargetEstimator::_attitude_at(hrt_abstime timestamp) const
+{
+	// newest attitude sampled before the observation, or the oldest available
+	int index = _attitude_history_newest;
+
+	for (int i = 0; i < ATTITUDE_HISTORY_SIZE; i++) {
+		const int candidate = (_attitude_history_newest - i + ATTITUDE_HISTORY_SIZE) % ATTITUDE_HISTORY_SIZE;
+
+		if (_attitude_history[candidate].timestamp == 0) {
+			break;
+		}
+
+		index = candidate;
+
+		if (_attitude_history[candidate].timestamp <= timestamp) {
+			break;
+		}
+	}
+
+	return _attitude_history[index].q;
+}
+
 void LandingTargetEstimator::_update_params()
 {
 	param_get(_paramHandle.acc_unc, &_params.acc_unc);
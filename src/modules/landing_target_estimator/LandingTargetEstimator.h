@@ -42,11 +42,14 @@
 
 #pragma once
 
-#include <px4_platform_common/workqueue.h>
+#include <px4_platform_common/module.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
 #include <drivers/drv_hrt.h>
+#include <lib/perf/perf_counter.h>
 #include <parameters/param.h>
 #include <uORB/Publication.hpp>
 #include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
 #include <uORB/SubscriptionInterval.hpp>
 #include <uORB/topics/vehicle_acceleration.h>
 #include <uORB/topics/vehicle_attitude.h>
@@ -66,12 +69,26 @@ using namespace time_literals;
 namespace landing_target_estimator
 {
 
-class LandingTargetEstimator
+class LandingTargetEstimator : public ModuleBase<LandingTargetEstimator>, public px4::ScheduledWorkItem
 {
 public:
 
 	LandingTargetEstimator();
-	virtual ~LandingTargetEstimator() = default;
+	~LandingTargetEstimator() override;
+
+	/** @see ModuleBase */
+	static int task_spawn(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int custom_command(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int print_usage(const char *reason = nullptr);
+
+	/** @see ModuleBase::print_status() */
+	int print_status() override;
+
+	bool init();
 
 	/*
 	 * Get new measurements and update the state estimate
@@ -80,6 +97,8 @@ public:
 
 protected:
 
+	void Run() override;
+
 	/*
 	 * Update uORB topics.
 	 */
@@ -93,6 +112,15 @@ protected:
 	/* timeout after which filter is reset if target not seen */
 	static constexpr uint32_t landing_target_estimator_TIMEOUT_US = 2000000;
 
+	/* prediction rate without observations, the filter otherwise runs on observation arrival */
+	static constexpr hrt_abstime landing_target_estimator_BACKUP_INTERVAL_US = 20_ms;
+
+	/* observations fused per cycle, the irlock_report queue length */
+	static constexpr int MAX_OBSERVATIONS = irlock_report_s::ORB_QUEUE_LENGTH;
+
+	/* observations older than this are not compensated for their delay */
+	static constexpr float MAX_OBSERVATION_DELAY = 0.5f;
+
 	uORB::Publication<landing_target_pose_s> _targetPosePub{ORB_ID(landing_target_pose)};
 	landing_target_pose_s _target_pose{};
 
@@ -139,17 +167,38 @@ private:
 		enum Rotation sensor_yaw;
 	} _params;
 
-	struct {
+	struct TargetPositionReport {
 		hrt_abstime timestamp;
 		float rel_pos_x;
 		float rel_pos_y;
 		float rel_pos_z;
-	} _target_position_report;
+	};
+
+	// observations received since the last cycle, fused together
+	TargetPositionReport _target_position_reports[MAX_OBSERVATIONS] {};
+	int _target_position_report_count{0};
+
+	// attitude history to rotate delayed observations with the attitude at their sampling time
+	static constexpr int ATTITUDE_HISTORY_SIZE = 16;
+
+	struct AttitudeSample {
+		hrt_abstime timestamp;
+		matrix::Quatf q;
+	};
+
+	AttitudeSample _attitude_history[ATTITUDE_HISTORY_SIZE] {};
+	int _attitude_history_newest{-1};
+
+	void _push_attitude(const vehicle_attitude_s &attitude);
+	matrix::Quatf _attitude_at(hrt_abstime timestamp) const;
 
 	uORB::Subscription _vehicleLocalPositionSub{ORB_ID(vehicle_local_position)};
 	uORB::Subscription _attitudeSub{ORB_ID(vehicle_attitude)};
 	uORB::Subscription _vehicle_acceleration_sub{ORB_ID(vehicle_acceleration)};
-	uORB::Subscription _irlockReportSub{ORB_ID(irlock_report)};
+	uORB::SubscriptionCallbackWorkItem _irlockReportSub{this, ORB_ID(irlock_report)};
+
+	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
+	perf_counter_t _observations_perf{perf_alloc(PC_COUNT, MODULE_NAME": observations")};
 
 	vehicle_local_position_s	_vehicleLocalPosition{};
 	vehicle_attitude_s		_vehicleAttitude{};
@@ -160,8 +209,6 @@ private:
 	bool _vehicleLocalPosition_valid{false};
 	bool _vehicleAttitude_valid{false};
 	bool _vehicle_acceleration_valid{false};
-	bool _new_irlockReport{false};
-	bool _new_sensorReport{false};
 	bool _estimator_initialized{false};
 	// keep track of whether last measurement was rejected
 	bool _faulty{false};
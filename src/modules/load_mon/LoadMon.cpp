@@ -46,6 +46,10 @@ static constexpr unsigned FDS_LOW_WARNING_THRESHOLD = 2; ///< if free file descr
 
 using namespace time_literals;
 
+static constexpr float LOAD_SHEDDING_HYSTERESIS = 0.1f;		///< load below SYS_SHED_LOAD minus this counts as recovered
+static constexpr hrt_abstime LOAD_SHEDDING_RAISE_TIME = 1_s;	///< minimum time between two raised levels while overloaded
+static constexpr hrt_abstime LOAD_SHEDDING_LOWER_TIME = 5_s;	///< time without overload before a level is lowered
+
 namespace load_mon
 {
 
@@ -101,6 +105,15 @@ void LoadMon::Run()
 
 	cpuload();
 
+	if ((_param_sys_perf_int.get() > 0)
+	    && (hrt_elapsed_time(&_perf_counters_last_publish) >= (hrt_abstime)_param_sys_perf_int.get() * 1_ms)) {
+		perf_counters();
+
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+		work_queue_status();
+#endif
+	}
+
 #if defined(__PX4_NUTTX)
 
 	if (_param_sys_stck_en.get()) {
@@ -232,11 +245,30 @@ void LoadMon::cpuload()
 #elif defined(__PX4_QURT)
 	cpuload.ram_usage = 0.0f;
 	cpuload.load = px4muorb_get_cpu_load() / 100.0f;
+#endif
+#if defined(__PX4_NUTTX)
+	cpuload.stack_free_min = _stack_free_min;
+	strncpy((char *)cpuload.stack_free_min_task, _stack_free_min_task, sizeof(cpuload.stack_free_min_task));
+	cpuload.stack_low = (_stack_free_min < STACK_LOW_WARNING_THRESHOLD);
+#else
+	cpuload.stack_free_min = UINT16_MAX;
 #endif
 	cpuload.timestamp = hrt_absolute_time();
 
 	_cpuload_pub.publish(cpuload);
 
+#if defined(CONFIG_PX4_PM)
+
+	if (_param_sys_pm_en.get()) {
+		px4_pm_update(cpuload.load);
+	}
+
+#endif // CONFIG_PX4_PM
+
+	if (_param_sys_shed_en.get()) {
+		load_shedding(cpuload.load);
+	}
+
 	// store for next iteration
 #if defined(__PX4_LINUX)
 	_last_total_time_stamp = total_time_stamp;
@@ -247,6 +279,172 @@ void LoadMon::cpuload()
 #endif
 }
 
+void LoadMon::load_shedding(float load)
+{
+	const hrt_abstime now = hrt_absolute_time();
+
+	// rate controller deadline misses per second since the previous update
+	float deadline_misses = 0.f;
+	rate_ctrl_status_s rate_ctrl_status;
+
+	if (_rate_ctrl_status_sub.copy(&rate_ctrl_status)) {
+		// the count restarts with the controller
+		const uint32_t misses = (rate_ctrl_status.deadline_miss_count >= _deadline_miss_count_last) ?
+					rate_ctrl_status.deadline_miss_count - _deadline_miss_count_last : 0;
+
+		if (_load_shedding_last_update != 0) {
+			deadline_misses = misses / math::max((now - _load_shedding_last_update) * 1e-6f, 0.1f);
+		}
+
+		_deadline_miss_count_last = rate_ctrl_status.deadline_miss_count;
+	}
+
+	_load_shedding_last_update = now;
+
+	const bool deadline_check = _param_sys_shed_miss.get() > 0.f;
+	const bool overloaded = (load > _param_sys_shed_load.get())
+				|| (deadline_check && (deadline_misses > _param_sys_shed_miss.get()));
+	const bool recovered = (load < _param_sys_shed_load.get() - LOAD_SHEDDING_HYSTERESIS)
+			       && (deadline_misses < 0.5f);
+
+	const uint8_t level_prev = _load_shedding_level;
+
+	// raise one level per second while overloaded, lower one level every 5 seconds after it recovered
+	if (overloaded) {
+		_load_shedding_last_overload = now;
+
+		if ((_load_shedding_level < load_shedding_s::LEVEL_MAX)
+		    && (now - _load_shedding_last_change >= LOAD_SHEDDING_RAISE_TIME)) {
+			_load_shedding_level++;
+		}
+
+	} else if (recovered && (_load_shedding_level > 0)
+		   && (now - math::max(_load_shedding_last_change, _load_shedding_last_overload) >= LOAD_SHEDDING_LOWER_TIME)) {
+		_load_shedding_level--;
+	}
+
+	// consumers with a priority of 0 are never shed, otherwise from their level on
+	const auto shed_at = [this](int32_t priority) { return (priority > 0) && (_load_shedding_level >= priority); };
+
+	load_shedding_s load_shedding{};
+	load_shedding.level = _load_shedding_level;
+	load_shedding.shed = (shed_at(_param_sys_shed_log.get()) ? load_shedding_s::SHED_LOGGER : 0)
+			     | (shed_at(_param_sys_shed_mav.get()) ? load_shedding_s::SHED_MAVLINK : 0)
+			     | (shed_at(_param_sys_shed_ekf.get()) ? load_shedding_s::SHED_EKF2_DIAGNOSTICS : 0)
+			     | (shed_at(_param_sys_shed_fft.get()) ? load_shedding_s::SHED_GYRO_FFT : 0);
+	load_shedding.load = load;
+	load_shedding.deadline_misses = deadline_misses;
+	load_shedding.timestamp = hrt_absolute_time();
+	_load_shedding_pub.publish(load_shedding);
+
+	if (_load_shedding_level != level_prev) {
+		_load_shedding_last_change = now;
+
+		PX4_WARN("load shedding level %" PRIu8 " (load %.0f%%, %.1f deadline misses/s), shed:%s%s%s%s",
+			 _load_shedding_level, (double)(load * 100.f), (double)deadline_misses,
+			 (load_shedding.shed & load_shedding_s::SHED_LOGGER) ? " logger" : "",
+			 (load_shedding.shed & load_shedding_s::SHED_MAVLINK) ? " mavlink" : "",
+			 (load_shedding.shed & load_shedding_s::SHED_EKF2_DIAGNOSTICS) ? " ekf2" : "",
+			 (load_shedding.shed & load_shedding_s::SHED_GYRO_FFT) ? " gyro_fft" : "");
+	}
+}
+
+void LoadMon::perf_counters_callback(perf_counter_t handle, void *user)
+{
+	if (perf_type(handle) != PC_HISTOGRAM) {
+		return;
+	}
+
+	perf_counters_s *msg = (perf_counters_s *)user;
+
+	// only sample the counters of the current page, the others keep accumulating
+	if ((msg->total_count >= msg->first_index) && (msg->count < perf_counters_s::MAX_COUNTERS)) {
+		perf_sample_t sample;
+
+		if (perf_sample(handle, &sample)) {
+			perf_counter_sample_s &counter = msg->counters[msg->count];
+			counter.timestamp = hrt_absolute_time();
+			strncpy(counter.name, sample.name, sizeof(counter.name) - 1);
+			counter.name[sizeof(counter.name) - 1] = '\0';
+			counter.event_count = sample.event_count;
+			counter.time_avg_us = sample.time_avg_us;
+			counter.time_max_us = sample.time_max_us;
+			counter.p50_us = sample.p50_us;
+			counter.p90_us = sample.p90_us;
+			counter.p99_us = sample.p99_us;
+			counter.p99_9_us = sample.p99_9_us;
+			msg->count++;
+		}
+	}
+
+	msg->total_count++;
+}
+
+void LoadMon::perf_counters()
+{
+	const uint16_t first_index = (_perf_counters.first_index + _perf_counters.count < _perf_counters.total_count) ?
+				     _perf_counters.first_index + _perf_counters.count : 0;
+
+	_perf_counters = {};
+	_perf_counters.first_index = first_index;
+
+	perf_iterate_all(perf_counters_callback, &_perf_counters);
+
+	if (_perf_counters.count > 0) {
+		_perf_counters.timestamp = hrt_absolute_time();
+		_perf_counters_pub.publish(_perf_counters);
+	}
+
+	_perf_counters_last_publish = hrt_absolute_time();
+}
+
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+void LoadMon::work_queue_status_callback(px4::WorkQueue *wq, px4::WorkItem *item, void *user)
+{
+	work_queue_status_s *msg = (work_queue_status_s *)user;
+
+	// only sample (and reset) the items of the current page, the others keep accumulating
+	if ((msg->total_count >= msg->first_index) && (msg->count < work_queue_status_s::MAX_ITEMS)) {
+		px4::DurationHistogram run_time;
+		px4::DurationHistogram delay;
+		item->get_run_stats(run_time, delay, true);
+
+		work_item_status_s &status = msg->items[msg->count];
+		status.timestamp = hrt_absolute_time();
+		strncpy(status.name, item->ItemName(), sizeof(status.name) - 1);
+		status.name[sizeof(status.name) - 1] = '\0';
+		strncpy(status.work_queue, wq->get_name(), sizeof(status.work_queue) - 1);
+		status.work_queue[sizeof(status.work_queue) - 1] = '\0';
+		status.run_count = run_time.count();
+		status.run_time_avg_us = run_time.mean();
+		status.run_time_p99_us = run_time.percentile(99.f);
+		status.run_time_max_us = run_time.max();
+		status.delay_avg_us = delay.mean();
+		status.delay_p99_us = delay.percentile(99.f);
+		status.delay_max_us = delay.max();
+		msg->count++;
+	}
+
+	msg->total_count++;
+}
+
+void LoadMon::work_queue_status()
+{
+	const uint16_t first_index = (_work_queue_status.first_index + _work_queue_status.count < _work_queue_status.total_count) ?
+				     _work_queue_status.first_index + _work_queue_status.count : 0;
+
+	_work_queue_status = {};
+	_work_queue_status.first_index = first_index;
+
+	px4::WorkQueueManagerForEachItem(work_queue_status_callback, &_work_queue_status);
+
+	if (_work_queue_status.count > 0) {
+		_work_queue_status.timestamp = hrt_absolute_time();
+		_work_queue_status_pub.publish(_work_queue_status);
+	}
+}
+#endif // CONFIG_PX4_WORK_ITEM_STATS
+
 #if defined(__PX4_NUTTX)
 void LoadMon::stack_usage()
 {
@@ -263,6 +461,7 @@ void LoadMon::stack_usage()
 	if (system_load.tasks[_stack_task_index].valid && (system_load.tasks[_stack_task_index].tcb->pid > 0)) {
 
 		stack_free = up_check_tcbstack_remain(system_load.tasks[_stack_task_index].tcb);
+		task_stack_info.stack_size = math::min(system_load.tasks[_stack_task_index].tcb->adj_stack_size, (size_t)UINT16_MAX);
 
 		strncpy((char *)task_stack_info.task_name, system_load.tasks[_stack_task_index].tcb->name, CONFIG_TASK_NAME_SIZE - 1);
 		task_stack_info.task_name[CONFIG_TASK_NAME_SIZE - 1] = '\0';
@@ -292,6 +491,11 @@ void LoadMon::stack_usage()
 
 		_task_stack_info_pub.publish(task_stack_info);
 
+		if (stack_free < _stack_free_min_cycle) {
+			_stack_free_min_cycle = stack_free;
+			memcpy(_stack_free_min_cycle_task, task_stack_info.task_name, sizeof(_stack_free_min_cycle_task));
+		}
+
 		// Found task low on stack, report and exit. Continue here in next cycle.
 		if (stack_free < STACK_LOW_WARNING_THRESHOLD) {
 			PX4_WARN("%s low on stack! (%i bytes left)", task_stack_info.task_name, stack_free);
@@ -300,6 +504,14 @@ void LoadMon::stack_usage()
 
 	// Continue after last checked task next cycle
 	_stack_task_index = (_stack_task_index + 1) % CONFIG_FS_PROCFS_MAX_TASKS;
+
+	if (_stack_task_index == 0) {
+		// all tasks checked, report the lowest one (tasks may have exited since)
+		_stack_free_min = math::min(_stack_free_min_cycle, (unsigned)UINT16_MAX);
+		memcpy(_stack_free_min_task, _stack_free_min_cycle_task, sizeof(_stack_free_min_task));
+		_stack_free_min_cycle = UINT16_MAX;
+		_stack_free_min_cycle_task[0] = '\0';
+	}
 }
 #endif
 
@@ -317,6 +529,16 @@ usage and publish the `cpuload` topic.
 
 On NuttX it also checks the stack usage of each process and if it falls below 300 bytes, a warning is output,
 which will also appear in the log file.
+
+If SYS_PERF_INT is set, delta samples of the PC_HISTOGRAM perf counters (event count, average, maximum and
+percentiles of the elapsed time) are published periodically on the `perf_counters` topic, which is logged by default.
+With CONFIG_PX4_WORK_ITEM_STATS the run time and queueing delay of every work item are published at the same
+interval on the `work_queue_status` topic.
+
+If SYS_SHED_EN is set, a load shedding level is raised while the CPU load or the rate controller deadline misses
+exceed SYS_SHED_LOAD and SYS_SHED_MISS, and lowered again after they recovered. It is published on the
+`load_shedding` topic together with the consumers (logger, mavlink, ekf2 diagnostics, gyro_fft) that reduce
+their optional work at that level, as selected by their SYS_SHED_* priorities. Level changes are logged.
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("load_mon", "system");
@@ -43,11 +43,21 @@
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/module_params.h>
 #include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
+#include <px4_platform_common/power_management.h>
 #include <px4_platform/cpuload.h>
 #include <uORB/Publication.hpp>
+#include <uORB/Subscription.hpp>
 #include <uORB/topics/cpuload.h>
+#include <uORB/topics/load_shedding.h>
+#include <uORB/topics/perf_counters.h>
+#include <uORB/topics/rate_ctrl_status.h>
 #include <uORB/topics/task_stack_info.h>
 
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+#include <px4_platform_common/px4_work_queue/WorkQueueManager.hpp>
+#include <uORB/topics/work_queue_status.h>
+#endif
+
 #if defined(__PX4_LINUX)
 #include <sys/times.h>
 #endif
@@ -81,6 +91,24 @@ private:
 	/** Do a calculation of the CPU load and publish it. */
 	void cpuload();
 
+	/** Publish delta samples of the streamed perf counters. */
+	void perf_counters();
+
+	static void perf_counters_callback(perf_counter_t handle, void *user);
+
+	/** Update the load shedding level from the CPU load and the rate controller deadline misses and publish it. */
+	void load_shedding(float load);
+
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+	/** Publish the run time and queueing delay statistics of the work items. */
+	void work_queue_status();
+
+	static void work_queue_status_callback(px4::WorkQueue *wq, px4::WorkItem *item, void *user);
+
+	uORB::Publication<work_queue_status_s> _work_queue_status_pub{ORB_ID(work_queue_status)};
+	work_queue_status_s _work_queue_status{};
+#endif
+
 	/* Stack check only available on Nuttx */
 #if defined(__PX4_NUTTX)
 	/* Calculate stack usage */
@@ -88,9 +116,27 @@ private:
 
 	int _stack_task_index{0};
 
+	unsigned _stack_free_min_cycle{UINT16_MAX};			///< lowest free stack in the current check cycle
+	char _stack_free_min_cycle_task[CONFIG_TASK_NAME_SIZE] {};
+	uint16_t _stack_free_min{UINT16_MAX};				///< lowest free stack in the last full check cycle
+	char _stack_free_min_task[CONFIG_TASK_NAME_SIZE] {};
+
 	uORB::Publication<task_stack_info_s> _task_stack_info_pub{ORB_ID(task_stack_info)};
 #endif
 	uORB::Publication<cpuload_s> _cpuload_pub {ORB_ID(cpuload)};
+	uORB::Publication<perf_counters_s> _perf_counters_pub{ORB_ID(perf_counters)};
+
+	perf_counters_s _perf_counters{};
+	hrt_abstime _perf_counters_last_publish{0};
+
+	uORB::Publication<load_shedding_s> _load_shedding_pub{ORB_ID(load_shedding)};
+	uORB::Subscription _rate_ctrl_status_sub{ORB_ID(rate_ctrl_status)};
+
+	uint8_t _load_shedding_level{0};
+	hrt_abstime _load_shedding_last_change{0};
+	hrt_abstime _load_shedding_last_overload{0};
+	hrt_abstime _load_shedding_last_update{0};
+	uint32_t _deadline_miss_count_last{0};
 
 #if defined(__PX4_LINUX)
 	FILE *_proc_fd = nullptr;
@@ -105,7 +151,16 @@ private:
 	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
 
 	DEFINE_PARAMETERS(
-		(ParamBool<px4::params::SYS_STCK_EN>) _param_sys_stck_en
+		(ParamBool<px4::params::SYS_STCK_EN>) _param_sys_stck_en,
+		(ParamInt<px4::params::SYS_PERF_INT>) _param_sys_perf_int,
+		(ParamBool<px4::params::SYS_PM_EN>) _param_sys_pm_en,
+		(ParamBool<px4::params::SYS_SHED_EN>) _param_sys_shed_en,
+		(ParamFloat<px4::params::SYS_SHED_LOAD>) _param_sys_shed_load,
+		(ParamFloat<px4::params::SYS_SHED_MISS>) _param_sys_shed_miss,
+		(ParamInt<px4::params::SYS_SHED_LOG>) _param_sys_shed_log,
+		(ParamInt<px4::params::SYS_SHED_MAV>) _param_sys_shed_mav,
+		(ParamInt<px4::params::SYS_SHED_EKF>) _param_sys_shed_ekf,
+		(ParamInt<px4::params::SYS_SHED_FFT>) _param_sys_shed_fft
 	)
 };
 
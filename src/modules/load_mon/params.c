@@ -38,3 +38,140 @@
  * @group System
  */
 PARAM_DEFINE_INT32(SYS_STCK_EN, 1);
+
+/**
+ * Perf counter streaming interval
+ *
+ * Interval at which load_mon publishes delta samples of the PC_HISTOGRAM
+ * perf counters on the perf_counters topic. Set to 0 to disable.
+ * The value is rounded up to the 500 ms cycle of load_mon.
+ *
+ * @min 0
+ * @max 60000
+ * @unit ms
+ * @reboot_required true
+ * @group System
+ */
+PARAM_DEFINE_INT32(SYS_PERF_INT, 1000);
+
+/**
+ * CPU power management
+ *
+ * Lower the CPU performance level (eg the core clock) while the CPU load
+ * is low, and return to full performance as soon as it increases. Requires
+ * a board with power management operations (CONFIG_PX4_PM), has no effect
+ * otherwise.
+ *
+ * @boolean
+ * @reboot_required true
+ * @group System
+ */
+PARAM_DEFINE_INT32(SYS_PM_EN, 0);
+
+/**
+ * Load shedding
+ *
+ * Raise a load shedding level while the CPU load exceeds SYS_SHED_LOAD or
+ * the rate controller misses its deadline more often than SYS_SHED_MISS,
+ * one level per second up to 3. Each level is lowered again after 5 seconds
+ * without overload. The logger, mavlink, ekf2 diagnostics and gyro_fft
+ * reduce their optional work from the level set by their SYS_SHED_*
+ * priority and restore it when the level drops below.
+ *
+ * @boolean
+ * @reboot_required true
+ * @group System
+ */
+PARAM_DEFINE_INT32(SYS_SHED_EN, 0);
+
+/**
+ * Load shedding CPU load threshold
+ *
+ * The CPU load above which the load shedding level is raised. It is
+ * lowered again once the load is 0.1 below.
+ *
+ * @min 0.5
+ * @max 1.0
+ * @decimal 2
+ * @increment 0.05
+ * @reboot_required true
+ * @group System
+ */
+PARAM_DEFINE_FLOAT(SYS_SHED_LOAD, 0.9f);
+
+/**
+ * Load shedding deadline miss threshold
+ *
+ * The rate of rate controller cycles whose output was ready only after the
+ * next gyro sample was due, above which the load shedding level is raised.
+ * Set to 0 to only use the CPU load.
+ *
+ * @unit 1/s
+ * @min 0
+ * @max 100
+ * @decimal 0
+ * @increment 1
+ * @reboot_required true
+ * @group System
+ */
+PARAM_DEFINE_FLOAT(SYS_SHED_MISS, 5.f);
+
+/**
+ * Load shedding priority of the logger
+ *
+ * Load shedding level from which the logger decimates its normal priority
+ * topics and drops its best-effort topics. Critical topics are always logged.
+ *
+ * @value 0 Never
+ * @value 1 Level 1
+ * @value 2 Level 2
+ * @value 3 Level 3
+ * @reboot_required true
+ * @group System
+ */
+PARAM_DEFINE_INT32(SYS_SHED_LOG, 3);
+
+/**
+ * Load shedding priority of mavlink
+ *
+ * Load shedding level from which mavlink halves its stream rates,
+ * the high rate streams are reduced first.
+ *
+ * @value 0 Never
+ * @value 1 Level 1
+ * @value 2 Level 2
+ * @value 3 Level 3
+ * @reboot_required true
+ * @group System
+ */
+PARAM_DEFINE_INT32(SYS_SHED_MAV, 1);
+
+/**
+ * Load shedding priority of the ekf2 diagnostics
+ *
+ * Load shedding level from which ekf2 publishes its diagnostic topics
+ * (see EKF2_DIAG_DECIM) at a quarter of their rate.
+ *
+ * @value 0 Never
+ * @value 1 Level 1
+ * @value 2 Level 2
+ * @value 3 Level 3
+ * @reboot_required true
+ * @group System
+ */
+PARAM_DEFINE_INT32(SYS_SHED_EKF, 1);
+
+/**
+ * Load shedding priority of gyro_fft
+ *
+ * Load shedding level from which gyro_fft computes its FFTs at a quarter
+ * of the rate set by IMU_GYRO_FFT_HOP.
+ *
+ * @value 0 Never
+ * @value 1 Level 1
+ * @value 2 Level 2
+ * @value 3 Level 3
+ * @reboot_required true
+ * @group System
+ */
+PARAM_DEFINE_INT32(SYS_SHED_FFT, 2);
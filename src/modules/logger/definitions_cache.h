@@ -0,0 +1,140 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace px4
+{
+namespace logger
+{
+
+/**
+ * @class DefinitionsCache
+ * Serialized ULog definitions section (formats, parameters and parameter defaults of the full log), built while
+ * not logging so that it can be written with a single write when a log file is started.
+ */
+class DefinitionsCache
+{
+public:
+	DefinitionsCache() = default;
+	~DefinitionsCache() { delete[] _buffer; }
+
+	DefinitionsCache(const DefinitionsCache &) = delete;
+	DefinitionsCache &operator=(const DefinitionsCache &) = delete;
+
+	/**
+	 * Start capturing (discards the current content)
+	 * @param capacity buffer size, allocated on first use
+	 * @return false if the buffer could not be allocated
+	 */
+	bool begin(size_t capacity)
+	{
+		if (_buffer == nullptr) {
+			_buffer = new uint8_t[capacity];
+
+			if (_buffer == nullptr) {
+				return false;
+			}
+
+			_capacity = capacity;
+		}
+
+		_size = 0;
+		_valid = false;
+		_overflow = false;
+		_capturing = true;
+		return true;
+	}
+
+	/**
+	 * Stop capturing
+	 * @param params_used number of used parameters at the time of capturing
+	 * @return true if everything fitted into the buffer
+	 */
+	bool end(unsigned params_used)
+	{
+		_capturing = false;
+		_valid = !_overflow;
+		_params_used = params_used;
+
+		if (_overflow) {
+			// not retried, free the memory
+			delete[] _buffer;
+			_buffer = nullptr;
+			_capacity = 0;
+			_size = 0;
+		}
+
+		return _valid;
+	}
+
+	void append(const void *ptr, size_t size)
+	{
+		if (_size + size > _capacity) {
+			_overflow = true;
+			return;
+		}
+
+		memcpy(_buffer + _size, ptr, size);
+		_size += size;
+	}
+
+	void invalidate() { _valid = false; }
+
+	/** @return true if the content is complete and parameters have not been marked as used since */
+	bool valid(unsigned params_used) const { return _valid && (params_used == _params_used); }
+
+	bool capturing() const { return _capturing; }
+
+	/** @return true if the definitions did not fit into the buffer */
+	bool too_small() const { return _overflow; }
+
+	uint8_t *data() { return _buffer; }
+	size_t size() const { return _size; }
+
+private:
+	uint8_t *_buffer{nullptr};
+	size_t _capacity{0};
+	size_t _size{0};
+	unsigned _params_used{0};
+	bool _valid{false};
+	bool _overflow{false};
+	bool _capturing{false};
+};
+
+} // namespace logger
+} // namespace px4
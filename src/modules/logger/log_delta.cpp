@@ -0,0 +1,305 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "log_delta.h"
+
+#include <string.h>
+
+#include <uORB/topics/uORBTopics.hpp>
+#include <uORB/topics/sensor_accel_fifo.h>
+#include <uORB/topics/sensor_gyro_fifo.h>
+
+namespace px4
+{
+namespace logger
+{
+
+static constexpr size_t TIMESTAMP_SIZE = sizeof(uint64_t);
+static constexpr size_t MAX_VARINT_SIZE = 10;
+
+// both FIFO topics are encoded as sensor_gyro_fifo_s
+static_assert(sizeof(sensor_accel_fifo_s) == sizeof(sensor_gyro_fifo_s), "FIFO layout mismatch");
+static_assert(offsetof(sensor_accel_fifo_s, samples) == offsetof(sensor_gyro_fifo_s, samples), "FIFO layout mismatch");
+static_assert(offsetof(sensor_accel_fifo_s, x) == offsetof(sensor_gyro_fifo_s, x), "FIFO layout mismatch");
+static_assert(offsetof(sensor_accel_fifo_s, z) == offsetof(sensor_gyro_fifo_s, z), "FIFO layout mismatch");
+
+static inline size_t write_varint(uint8_t *buffer, int64_t value)
+{
+	uint64_t zigzag = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+	size_t n = 0;
+
+	while (zigzag >= 0x80) {
+		buffer[n++] = (uint8_t)(zigzag | 0x80);
+		zigzag >>= 7;
+	}
+
+	buffer[n++] = (uint8_t)zigzag;
+	return n;
+}
+
+bool LogDelta::start(uint32_t keyframe_interval_ms, int num_topics, size_t max_msg_size)
+{
+	stop();
+
+	if (keyframe_interval_ms == 0 || num_topics <= 0) {
+		return false;
+	}
+
+	_topics = new Topic[num_topics];
+	_msg_buffer = new uint8_t[max_msg_size];
+
+	if (!_topics || !_msg_buffer) {
+		stop();
+		return false;
+	}
+
+	_num_topics = num_topics;
+	_msg_buffer_size = max_msg_size;
+	_keyframe_interval_us = keyframe_interval_ms * 1000ULL;
+	return true;
+}
+
+bool LogDelta::add_topic(int topic, const orb_metadata *meta)
+{
+	if (!_topics || topic < 0 || topic >= _num_topics) {
+		return false;
+	}
+
+	Topic &t = _topics[topic];
+	delete[] t.last;
+	t = Topic{};
+
+	if (meta->o_size_no_padding <= TIMESTAMP_SIZE) {
+		// nothing to encode, always written in full
+		return true;
+	}
+
+	const ORB_ID orb_id = static_cast<ORB_ID>(meta->o_id);
+
+	if (orb_id == ORB_ID::sensor_gyro_fifo || orb_id == ORB_ID::sensor_accel_fifo) {
+		t.encoding = Encoding::Fifo;
+	}
+
+	// FIFO samples are decoded as a full struct
+	const size_t storage_size = t.encoding == Encoding::Fifo ? sizeof(sensor_gyro_fifo_s) : meta->o_size_no_padding;
+	t.last = new uint8_t[storage_size];
+
+	if (!t.last) {
+		return false;
+	}
+
+	memset(t.last, 0, storage_size);
+	t.size = meta->o_size_no_padding;
+	return true;
+}
+
+void LogDelta::stop()
+{
+	if (_topics) {
+		for (int i = 0; i < _num_topics; ++i) {
+			delete[] _topics[i].last;
+		}
+	}
+
+	delete[] _topics;
+	_topics = nullptr;
+	_num_topics = 0;
+	delete[] _msg_buffer;
+	_msg_buffer = nullptr;
+	_msg_buffer_size = 0;
+}
+
+size_t LogDelta::encode(int topic, uint16_t msg_id, const uint8_t *payload, bool &keyframe)
+{
+	keyframe = true;
+
+	if (!_topics || topic < 0 || topic >= _num_topics || !_topics[topic].last) {
+		return 0;
+	}
+
+	const Topic &t = _topics[topic];
+
+	if (sizeof(ulog_message_data_s) + t.size > _msg_buffer_size) {
+		return 0;
+	}
+
+	uint64_t timestamp;
+	memcpy(&timestamp, payload, sizeof(timestamp));
+
+	const bool reset = !t.valid || timestamp >= t.next_keyframe;
+
+	if (t.encoding == Encoding::Fifo) {
+		const size_t msg_size = encode_fifo(t, msg_id, payload, timestamp, reset);
+		keyframe = reset || msg_size == 0;
+		return msg_size;
+	}
+
+	if (reset) {
+		return 0;
+	}
+
+	keyframe = false;
+	return encode_delta(t, msg_id, payload, timestamp);
+}
+
+size_t LogDelta::encode_delta(const Topic &t, uint16_t msg_id, const uint8_t *payload, uint64_t timestamp)
+{
+	const size_t full_size = sizeof(ulog_message_data_s) + t.size;
+	const size_t data_size = t.size - TIMESTAMP_SIZE;
+	const size_t num_blocks = (data_size + ULOG_DATA_DELTA_BLOCK_SIZE - 1) / ULOG_DATA_DELTA_BLOCK_SIZE;
+	const size_t mask_size = (num_blocks + 7) / 8;
+
+	ulog_message_data_delta_s header{};
+	size_t msg_size = sizeof(header) + mask_size;
+
+	if (msg_size >= full_size) {
+		return 0;
+	}
+
+	uint8_t *mask = _msg_buffer + sizeof(header);
+	memset(mask, 0, mask_size);
+
+	const uint8_t *data = payload + TIMESTAMP_SIZE;
+	const uint8_t *last = t.last + TIMESTAMP_SIZE;
+
+	for (size_t block = 0; block < num_blocks; ++block) {
+		const size_t offset = block * ULOG_DATA_DELTA_BLOCK_SIZE;
+		const size_t length = data_size - offset < ULOG_DATA_DELTA_BLOCK_SIZE ? data_size - offset : ULOG_DATA_DELTA_BLOCK_SIZE;
+
+		if (memcmp(data + offset, last + offset, length) != 0) {
+			if (msg_size + length >= full_size) {
+				// not worth it, write a keyframe instead
+				return 0;
+			}
+
+			mask[block / 8] |= 1 << (block % 8);
+			memcpy(_msg_buffer + msg_size, data + offset, length);
+			msg_size += length;
+		}
+	}
+
+	header.msg_size = static_cast<uint16_t>(msg_size - ULOG_MSG_HEADER_LEN);
+	header.msg_id = msg_id;
+	header.timestamp = timestamp;
+	memcpy(_msg_buffer, &header, sizeof(header));
+
+	return msg_size;
+}
+
+size_t LogDelta::encode_fifo(const Topic &t, uint16_t msg_id, const uint8_t *payload, uint64_t timestamp, bool reset)
+{
+	sensor_gyro_fifo_s fifo{};
+	memcpy(&fifo, payload, t.size);
+
+	sensor_gyro_fifo_s last;
+	memcpy(&last, t.last, sizeof(last));
+
+	const int samples = fifo.samples;
+
+	if (samples > (int)(sizeof(fifo.x) / sizeof(fifo.x[0]))) {
+		return 0;
+	}
+
+	ulog_message_data_fifo_s header{};
+	header.flags = 0;
+
+	if (reset) {
+		header.flags = ULOG_DATA_FIFO_FLAG_RESET | ULOG_DATA_FIFO_FLAG_PARAMS;
+
+	} else if (fifo.device_id != last.device_id
+		   || memcmp(&fifo.dt, &last.dt, sizeof(fifo.dt)) != 0
+		   || memcmp(&fifo.scale, &last.scale, sizeof(fifo.scale)) != 0) {
+		header.flags = ULOG_DATA_FIFO_FLAG_PARAMS;
+	}
+
+	// stop as soon as the full data message would be smaller
+	const size_t max_size = sizeof(ulog_message_data_s) + t.size;
+	size_t msg_size = sizeof(header);
+
+	if (header.flags & ULOG_DATA_FIFO_FLAG_PARAMS) {
+		memcpy(_msg_buffer + msg_size, &fifo.device_id, sizeof(fifo.device_id));
+		memcpy(_msg_buffer + msg_size + 4, &fifo.dt, sizeof(fifo.dt));
+		memcpy(_msg_buffer + msg_size + 8, &fifo.scale, sizeof(fifo.scale));
+		msg_size += 12;
+	}
+
+	msg_size += write_varint(_msg_buffer + msg_size, (int64_t)(timestamp - fifo.timestamp_sample));
+	_msg_buffer[msg_size++] = fifo.samples;
+
+	const int16_t *axes[3] {fifo.x, fifo.y, fifo.z};
+	const int16_t *last_axes[3] {last.x, last.y, last.z};
+
+	for (int axis = 0; axis < 3; ++axis) {
+		int32_t previous = (reset || last.samples == 0) ? 0 : last_axes[axis][last.samples - 1];
+
+		for (int i = 0; i < samples; ++i) {
+			if (msg_size + MAX_VARINT_SIZE > max_size) {
+				return 0;
+			}
+
+			msg_size += write_varint(_msg_buffer + msg_size, axes[axis][i] - previous);
+			previous = axes[axis][i];
+		}
+	}
+
+	if (msg_size >= max_size) {
+		return 0;
+	}
+
+	header.msg_size = static_cast<uint16_t>(msg_size - ULOG_MSG_HEADER_LEN);
+	header.msg_id = msg_id;
+	header.timestamp = timestamp;
+	memcpy(_msg_buffer, &header, sizeof(header));
+
+	return msg_size;
+}
+
+void LogDelta::written(int topic, const uint8_t *payload, bool keyframe)
+{
+	if (!_topics || topic < 0 || topic >= _num_topics || !_topics[topic].last) {
+		return;
+	}
+
+	Topic &t = _topics[topic];
+	memcpy(t.last, payload, t.size);
+	t.valid = true;
+
+	if (keyframe) {
+		uint64_t timestamp;
+		memcpy(&timestamp, payload, sizeof(timestamp));
+		t.next_keyframe = timestamp + _keyframe_interval_us;
+	}
+}
+
+} //namespace logger
+} //namespace px4
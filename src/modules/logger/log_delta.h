@@ -0,0 +1,129 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "messages.h"
+
+#include <uORB/uORB.h>
+
+namespace px4
+{
+namespace logger
+{
+
+/**
+ * @class LogDelta
+ * Delta encoding of the data messages of the full log (@see ulog_message_data_delta_s).
+ *
+ * For each logged topic the last sample written to the file is kept. A new sample is written as a delta if
+ * that is smaller than the full message, and as a full data message (keyframe) otherwise, at least every
+ * keyframe interval. The reference sample is only updated once a message actually got written, so dropouts
+ * do not break the decoding.
+ *
+ * The raw IMU FIFO topics use a dedicated encoding instead (@see ulog_message_data_fifo_s): the integer samples
+ * are stored as varint differences, which typically takes 1-2 bytes instead of 2 per sample.
+ */
+class LogDelta
+{
+public:
+	LogDelta() = default;
+	~LogDelta() { stop(); }
+
+	/**
+	 * Allocate the state for a new log file
+	 * @param keyframe_interval_ms maximum time between two full messages of the same topic
+	 * @param num_topics upper bound of the topic indexes passed to the other methods
+	 * @param max_msg_size maximum size of a data message (including header)
+	 * @return true on success
+	 */
+	bool start(uint32_t keyframe_interval_ms, int num_topics, size_t max_msg_size);
+
+	/**
+	 * Enable delta encoding for a topic
+	 * @return true on success
+	 */
+	bool add_topic(int topic, const orb_metadata *meta);
+
+	/** free all state */
+	void stop();
+
+	bool enabled() const { return _topics != nullptr; }
+
+	/**
+	 * Encode a sample against the last written one into message()
+	 * @param payload topic data, starting with the timestamp
+	 * @param keyframe set to true if the message can be decoded without the previous ones
+	 * @return size of the encoded message (including header), 0 if a full data message must be written instead
+	 */
+	size_t encode(int topic, uint16_t msg_id, const uint8_t *payload, bool &keyframe);
+
+	/** the message from the last successful encode() */
+	uint8_t *message() { return _msg_buffer; }
+
+	/**
+	 * Update the reference after a message of the topic got written to the file
+	 * @param payload topic data (not the encoded message)
+	 * @param keyframe true if the full data message or a keyframe was written
+	 */
+	void written(int topic, const uint8_t *payload, bool keyframe);
+
+private:
+	enum class Encoding : uint8_t {
+		Delta,
+		Fifo,
+	};
+
+	struct Topic {
+		uint8_t *last{nullptr}; ///< last written sample
+		uint64_t next_keyframe{0};
+		uint16_t size{0};
+		Encoding encoding{Encoding::Delta};
+		bool valid{false};
+	};
+
+	size_t encode_delta(const Topic &t, uint16_t msg_id, const uint8_t *payload, uint64_t timestamp);
+	size_t encode_fifo(const Topic &t, uint16_t msg_id, const uint8_t *payload, uint64_t timestamp, bool reset);
+
+	Topic *_topics{nullptr};
+	int _num_topics{0};
+	uint8_t *_msg_buffer{nullptr};
+	size_t _msg_buffer_size{0};
+	uint64_t _keyframe_interval_us{0};
+};
+
+} //namespace logger
+} //namespace px4
@@ -0,0 +1,183 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "log_index.h"
+
+#include <string.h>
+
+#include <mathlib/mathlib.h>
+
+namespace px4
+{
+namespace logger
+{
+
+bool LogIndex::start(uint32_t interval_ms, int num_msg_ids)
+{
+	stop();
+
+	if (interval_ms == 0 || num_msg_ids <= 0) {
+		return false;
+	}
+
+	_entries = new Entry[MAX_ENTRIES];
+	_topics = new Topic[num_msg_ids];
+
+	if (!_entries || !_topics) {
+		stop();
+		return false;
+	}
+
+	memset(_topics, 0, num_msg_ids * sizeof(Topic));
+	_num_topics = num_msg_ids;
+	_num_entries = 0;
+	_interval_us = interval_ms * 1000ULL;
+	return true;
+}
+
+void LogIndex::stop()
+{
+	delete[] _entries;
+	_entries = nullptr;
+	delete[] _topics;
+	_topics = nullptr;
+	_num_topics = 0;
+	_num_entries = 0;
+}
+
+void LogIndex::add(uint8_t msg_id, uint64_t timestamp, uint64_t offset)
+{
+	if (!_entries || msg_id >= _num_topics) {
+		return;
+	}
+
+	Topic &topic = _topics[msg_id];
+
+	if (topic.num_messages == 0) {
+		topic.first_timestamp = timestamp;
+	}
+
+	topic.last_timestamp = timestamp;
+	++topic.num_messages;
+
+	if (timestamp < topic.next_entry_timestamp) {
+		return;
+	}
+
+	while (_num_entries >= MAX_ENTRIES) {
+		compact();
+
+		if (timestamp < topic.next_entry_timestamp) {
+			return;
+		}
+	}
+
+	_entries[_num_entries++] = Entry{timestamp, offset, msg_id};
+	topic.next_entry_timestamp = (timestamp / _interval_us + 1) * _interval_us;
+}
+
+void LogIndex::compact()
+{
+	_interval_us *= 2;
+
+	for (int i = 0; i < _num_topics; ++i) {
+		_topics[i].next_entry_timestamp = 0;
+	}
+
+	int num_kept = 0;
+
+	for (int i = 0; i < _num_entries; ++i) {
+		const Entry &entry = _entries[i];
+		Topic &topic = _topics[entry.msg_id];
+
+		if (entry.timestamp >= topic.next_entry_timestamp) {
+			topic.next_entry_timestamp = (entry.timestamp / _interval_us + 1) * _interval_us;
+			_entries[num_kept++] = entry;
+		}
+	}
+
+	_num_entries = num_kept;
+}
+
+size_t LogIndex::next_message(Iterator &it, ulog_message_index_s &msg) const
+{
+	constexpr int max_entries_per_msg = sizeof(msg.entries) / sizeof(msg.entries[0]);
+
+	for (; it.msg_id < _num_topics; ++it.msg_id, it.entry = 0) {
+		const int msg_id = it.msg_id;
+		const Topic &topic = _topics[msg_id];
+
+		if (topic.num_messages == 0) {
+			continue;
+		}
+
+		int num = 0;
+
+		for (; it.entry < _num_entries && num < max_entries_per_msg; ++it.entry) {
+			const Entry &entry = _entries[it.entry];
+
+			if (entry.msg_id == msg_id) {
+				msg.entries[num].timestamp = entry.timestamp;
+				msg.entries[num].offset = entry.offset;
+				++num;
+			}
+		}
+
+		if (num == 0) {
+			continue;
+		}
+
+		if (it.entry >= _num_entries) {
+			// done with this msg_id
+			++it.msg_id;
+			it.entry = 0;
+		}
+
+		msg.msg_type = static_cast<uint8_t>(ULogMessageType::INDEX);
+		msg.msg_id = msg_id;
+		msg.interval_ms = (uint32_t)math::min(_interval_us / 1000, (uint64_t)UINT32_MAX);
+		msg.num_messages = topic.num_messages;
+		msg.first_timestamp = topic.first_timestamp;
+		msg.last_timestamp = topic.last_timestamp;
+
+		const size_t msg_size = sizeof(msg) - sizeof(msg.entries) + num * sizeof(msg.entries[0]);
+		msg.msg_size = msg_size - ULOG_MSG_HEADER_LEN;
+		return msg_size;
+	}
+
+	return 0;
+}
+
+} //namespace logger
+} //namespace px4
@@ -0,0 +1,125 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "messages.h"
+
+namespace px4
+{
+namespace logger
+{
+
+/**
+ * @class LogIndex
+ * Collects the file offsets of logged data messages while writing the full log, so that an index can be
+ * appended to the file when it is closed (@see ulog_message_index_s).
+ *
+ * The memory is fixed: when the table is full, the interval between entries of the same message is doubled
+ * and the existing entries are thinned out accordingly.
+ */
+class LogIndex
+{
+public:
+	LogIndex() = default;
+	~LogIndex() { stop(); }
+
+	/** state for iterating over the index messages with next_message() */
+	struct Iterator {
+		int msg_id{0};
+		int entry{0};
+	};
+
+	/**
+	 * Allocate the index for a new log file
+	 * @param interval_ms initial minimum time between two entries of the same message
+	 * @param num_msg_ids upper bound of the msg_id's used in the log
+	 * @return true on success
+	 */
+	bool start(uint32_t interval_ms, int num_msg_ids);
+
+	/** free the index */
+	void stop();
+
+	bool enabled() const { return _entries != nullptr; }
+
+	/**
+	 * Add a data message
+	 * @param offset file offset at which the message got written
+	 */
+	void add(uint8_t msg_id, uint64_t timestamp, uint64_t offset);
+
+	/**
+	 * Fill in the next index message
+	 * @param it iteration state, start with a default-initialized Iterator
+	 * @return size of the message (including header), 0 if there are no more messages
+	 */
+	size_t next_message(Iterator &it, ulog_message_index_s &msg) const;
+
+	int num_entries() const { return _num_entries; }
+
+private:
+	void compact();
+
+	struct Entry {
+		uint64_t timestamp;
+		uint64_t offset;
+		uint8_t msg_id;
+	};
+
+	struct Topic {
+		uint64_t first_timestamp;
+		uint64_t last_timestamp;
+		uint64_t next_entry_timestamp; ///< minimum timestamp for the next entry
+		uint32_t num_messages;
+	};
+
+#ifdef __PX4_NUTTX
+	static constexpr int MAX_ENTRIES = 512;
+#else
+	static constexpr int MAX_ENTRIES = 8192;
+#endif
+
+	Entry *_entries{nullptr};
+	int _num_entries{0};
+	Topic *_topics{nullptr};
+	int _num_topics{0};
+	uint64_t _interval_us{0};
+};
+
+} //namespace logger
+} //namespace px4
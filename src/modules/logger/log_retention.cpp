@@ -0,0 +1,550 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "log_retention.h"
+#include "util.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <errno.h>
+
+#include <mathlib/mathlib.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/time.h>
+
+#if defined(__PX4_DARWIN)
+#include <sys/param.h>
+#include <sys/mount.h>
+#else
+#include <sys/statfs.h>
+#endif
+
+namespace px4
+{
+namespace logger
+{
+
+LogRetention::LogRetention() :
+	px4::WorkItem("logger_retention", px4::wq_configurations::lp_default)
+{
+	pthread_mutex_init(&_mutex, nullptr);
+}
+
+LogRetention::~LogRetention()
+{
+	_exit.store(true);
+
+	// wait for a running cleanup
+	while (_state != State::Idle) {
+		px4_usleep(10000);
+	}
+
+	pthread_mutex_destroy(&_mutex);
+}
+
+void LogRetention::start(const char *log_root_dir, int32_t max_log_dirs_to_keep)
+{
+	_log_root_dir = log_root_dir;
+	_max_log_dirs_to_keep = (max_log_dirs_to_keep == 0) ? INT32_MAX : max_log_dirs_to_keep;
+	request("", "");
+}
+
+void LogRetention::request(const char *log_dir, const char *log_file)
+{
+	if (!_log_root_dir) {
+		return;
+	}
+
+	pthread_mutex_lock(&_mutex);
+	strncpy(_requested_log_dir, log_dir, sizeof(_requested_log_dir) - 1);
+	strncpy(_requested_log_file, log_file, sizeof(_requested_log_file) - 1);
+	_request_pending = true;
+	pthread_mutex_unlock(&_mutex);
+
+	ScheduleNow();
+}
+
+void LogRetention::Run()
+{
+	if (_exit.load()) {
+		if (_dir) {
+			closedir(_dir);
+			_dir = nullptr;
+		}
+
+		_state = State::Idle;
+		return;
+	}
+
+	switch (_state) {
+	case State::Idle: {
+			pthread_mutex_lock(&_mutex);
+			const bool pending = _request_pending;
+			_request_pending = false;
+			memcpy(_log_dir, _requested_log_dir, sizeof(_log_dir));
+			memcpy(_log_file, _requested_log_file, sizeof(_log_file));
+			pthread_mutex_unlock(&_mutex);
+
+			if (!pending) {
+				return;
+			}
+
+			_files_removable = true;
+
+			struct statfs statfs_buf;
+
+			if (statfs(_log_root_dir, &statfs_buf) != 0) {
+				PX4_ERR("statfs failed (%i)", errno);
+				return;
+			}
+
+			_disk_size = (uint64_t)statfs_buf.f_blocks * statfs_buf.f_bsize;
+			_available = (uint64_t)statfs_buf.f_bavail * statfs_buf.f_bsize;
+			_state = _dirs_valid ? State::Check : State::ScanRoot;
+		}
+		break;
+
+	case State::ScanRoot:
+		if (scan_root()) {
+			_dirs_valid = true;
+			_state = State::Check;
+		}
+
+		break;
+
+	case State::Check:
+		if (request_pending()) {
+			// start over with the new current log
+			_state = State::Idle;
+
+		} else {
+			_state = check();
+
+			if (_state == State::Idle) {
+				// cleanup done, now fill in the directory sizes
+				_state = State::SizeDirs;
+			}
+		}
+
+		break;
+
+	case State::SizeDirs:
+
+		// a new request has priority, the sizing continues afterwards
+		if (request_pending() || size_dirs()) {
+			if (_dir) {
+				// sized again from the start next time
+				closedir(_dir);
+				_dir = nullptr;
+				_dirs[_dir_index].size = 0;
+			}
+
+			_state = State::Idle;
+		}
+
+		break;
+
+	case State::RemoveDir:
+		if (remove_dir()) {
+			_state = _dirs_valid ? State::Check : State::ScanRoot;
+		}
+
+		break;
+
+	case State::RemoveFile:
+		remove_file();
+		_state = State::Check;
+		break;
+	}
+
+	if (_state == State::SizeDirs || _state == State::Idle) {
+		_free_space.store(_available);
+		// use a threshold of 50 MiB: if below, do not start logging
+		_storage_full.store(_available < 50ULL * 1024ULL * 1024ULL);
+	}
+
+	if (_state == State::Idle) {
+		uint64_t logs_size = 0;
+
+		for (int i = 0; i < _num_dirs; ++i) {
+			logs_size += _dirs[i].size;
+		}
+
+		_logs_size.store(logs_size);
+		_num_log_dirs.store(_num_dirs_total);
+
+		if (!request_pending()) {
+			return;
+		}
+	}
+
+	ScheduleNow();
+}
+
+bool LogRetention::scan_root()
+{
+	if (!_dir) {
+		_dir = opendir(_log_root_dir);
+		_num_dirs = 0;
+		_num_dirs_total = 0;
+
+		if (!_dir) {
+			return true; // ignore if we cannot access the log directory
+		}
+	}
+
+	for (int i = 0; i < ENTRIES_PER_RUN; ++i) {
+		struct dirent *result = readdir(_dir);
+
+		if (!result) {
+			closedir(_dir);
+			_dir = nullptr;
+			return true;
+		}
+
+		int year, month, day, sess_idx;
+
+		if (sscanf(result->d_name, "sess%d", &sess_idx) == 1) {
+			insert_dir(result->d_name, sess_idx, false);
+
+		} else if (sscanf(result->d_name, "%d-%d-%d", &year, &month, &day) == 3) {
+			insert_dir(result->d_name, year * 10000 + month * 100 + day, true);
+		}
+	}
+
+	return false;
+}
+
+void LogRetention::insert_dir(const char *name, int32_t order, bool is_date)
+{
+	++_num_dirs_total;
+
+	if (strlen(name) >= sizeof(LogDir::name)) {
+		return;
+	}
+
+	// keep the directories sorted by scheme and age, the newest ones drop out if the cache is full
+	int i = 0;
+
+	while (i < _num_dirs && (_dirs[i].is_date < is_date || (_dirs[i].is_date == is_date && _dirs[i].order < order))) {
+		++i;
+	}
+
+	if (i >= MAX_DIRS) {
+		return;
+	}
+
+	const int num_move = math::min(_num_dirs, MAX_DIRS - 1) - i;
+
+	if (num_move > 0) {
+		memmove(&_dirs[i + 1], &_dirs[i], num_move * sizeof(LogDir));
+	}
+
+	LogDir &dir = _dirs[i];
+	strncpy(dir.name, name, sizeof(dir.name));
+	dir.order = order;
+	dir.is_date = is_date;
+	dir.size_valid = false;
+	dir.size = 0;
+
+	if (_num_dirs < MAX_DIRS) {
+		++_num_dirs;
+	}
+}
+
+bool LogRetention::size_dirs()
+{
+	if (!_dir) {
+		_dir_index = -1;
+
+		for (int i = 0; i < _num_dirs; ++i) {
+			if (!_dirs[i].size_valid) {
+				_dir_index = i;
+				break;
+			}
+		}
+
+		if (_dir_index < 0) {
+			return true;
+		}
+
+		char path[LOG_DIR_LEN];
+
+		if (!dir_path(_dirs[_dir_index].name, path, sizeof(path)) || !(_dir = opendir(path))) {
+			_dirs[_dir_index].size_valid = true;
+			return false;
+		}
+	}
+
+	LogDir &log_dir = _dirs[_dir_index];
+
+	for (int i = 0; i < ENTRIES_PER_RUN; ++i) {
+		struct dirent *result = readdir(_dir);
+
+		if (!result) {
+			closedir(_dir);
+			_dir = nullptr;
+			log_dir.size_valid = true;
+			return false; // continue with the next directory
+		}
+
+		char path[LOG_DIR_LEN];
+		struct stat statbuf;
+
+		if (snprintf(path, sizeof(path), "%s/%s/%s", _log_root_dir, log_dir.name, result->d_name) < (int)sizeof(path)
+		    && stat(path, &statbuf) == 0 && S_ISREG(statbuf.st_mode)) {
+			log_dir.size += statbuf.st_size;
+		}
+	}
+
+	return false;
+}
+
+LogRetention::State LogRetention::check()
+{
+	const bool low_space = _available < min_free_bytes();
+
+	if (_num_dirs_total > _max_log_dirs_to_keep || low_space) {
+		_remove_index = oldest_dir();
+
+		if (_remove_index >= 0) {
+			char path[LOG_DIR_LEN];
+			dir_path(_dirs[_remove_index].name, path, sizeof(path));
+			PX4_INFO("removing log directory %s to get more space (left=%u MiB)", path,
+				 (unsigned int)(_available / 1024U / 1024U));
+			return State::RemoveDir;
+		}
+	}
+
+	if (low_space && _files_removable && _log_dir[0] != '\0') {
+		return State::RemoveFile;
+	}
+
+	return State::Idle;
+}
+
+int LogRetention::oldest_dir() const
+{
+	// There are 2 directory naming schemes: sess<i> or <year>-<month>-<day>.
+	// For both we find the oldest and then remove the one which has more directories.
+	int num_sess = 0, num_dates = 0;
+	int oldest_sess = -1, oldest_date = -1;
+
+	for (int i = 0; i < _num_dirs; ++i) {
+		const LogDir &dir = _dirs[i];
+
+		if (dir.is_date) {
+			++num_dates;
+
+		} else {
+			++num_sess;
+		}
+
+		if (is_current_dir(dir)) {
+			continue;
+		}
+
+		if (dir.is_date && oldest_date < 0) {
+			oldest_date = i;
+
+		} else if (!dir.is_date && oldest_sess < 0) {
+			oldest_sess = i;
+		}
+	}
+
+	if (oldest_sess >= 0 && (num_sess >= num_dates || oldest_date < 0)) {
+		return oldest_sess;
+	}
+
+	return oldest_date;
+}
+
+bool LogRetention::remove_dir()
+{
+	LogDir &log_dir = _dirs[_remove_index];
+	char path[LOG_DIR_LEN];
+
+	if (!dir_path(log_dir.name, path, sizeof(path))) {
+		return true;
+	}
+
+	DIR *dp = opendir(path);
+	bool done = (dp == nullptr);
+
+	for (int i = 0; !done && i < ENTRIES_PER_RUN;) {
+		struct dirent *result = readdir(dp);
+
+		if (!result) {
+			done = true;
+			break;
+		}
+
+		if (!strcmp(result->d_name, ".") || !strcmp(result->d_name, "..")) {
+			continue;
+		}
+
+		char file_path[LOG_DIR_LEN];
+		struct stat statbuf;
+
+		if (snprintf(file_path, sizeof(file_path), "%s/%s", path, result->d_name) >= (int)sizeof(file_path)
+		    || stat(file_path, &statbuf) != 0) {
+			done = true;
+			break;
+		}
+
+		int ret = S_ISDIR(statbuf.st_mode) ? util::remove_directory(file_path) : unlink(file_path);
+
+		if (ret != 0) {
+			PX4_ERR("Failed to delete %s", file_path);
+			done = true;
+			break;
+		}
+
+		if (S_ISREG(statbuf.st_mode)) {
+			_available += statbuf.st_size;
+
+			if (log_dir.size >= (uint64_t)statbuf.st_size) {
+				log_dir.size -= statbuf.st_size;
+			}
+		}
+
+		++i;
+	}
+
+	if (dp) {
+		closedir(dp);
+	}
+
+	if (!done) {
+		return false;
+	}
+
+	if (rmdir(path) != 0) {
+		PX4_ERR("Failed to delete directory");
+	}
+
+	// drop it from the cache either way, so that it is not retried forever
+	memmove(&_dirs[_remove_index], &_dirs[_remove_index + 1], (_num_dirs - _remove_index - 1) * sizeof(LogDir));
+	--_num_dirs;
+	--_num_dirs_total;
+	_remove_index = -1;
+
+	if (_num_dirs == 0 && _num_dirs_total > 0) {
+		// more directories than the cache holds: rescan
+		_dirs_valid = false;
+	}
+
+	return true;
+}
+
+void LogRetention::remove_file()
+{
+	// file names within a directory sort chronologically (log<i>.ulg or <hour>_<minute>_<second>.ulg)
+	char path[LOG_DIR_LEN];
+
+	if (!dir_path(_log_dir, path, sizeof(path))) {
+		_files_removable = false;
+		return;
+	}
+
+	DIR *dp = opendir(path);
+
+	if (!dp) {
+		_files_removable = false;
+		return;
+	}
+
+	char oldest[sizeof(_log_file)] = "";
+	struct dirent *result = nullptr;
+
+	while ((result = readdir(dp))) {
+		if (strstr(result->d_name, ".ulg") && strcmp(result->d_name, _log_file) < 0
+		    && (oldest[0] == '\0' || strcmp(result->d_name, oldest) < 0)) {
+			strncpy(oldest, result->d_name, sizeof(oldest) - 1);
+		}
+	}
+
+	closedir(dp);
+
+	char file_path[LOG_DIR_LEN];
+	struct stat statbuf;
+
+	if (oldest[0] == '\0' || snprintf(file_path, sizeof(file_path), "%s/%s", path, oldest) >= (int)sizeof(file_path)
+	    || stat(file_path, &statbuf) != 0) {
+		// nothing (more) to remove
+		_files_removable = false;
+		return;
+	}
+
+	PX4_INFO("removing log file %s to get more space (left=%u MiB)", file_path,
+		 (unsigned int)(_available / 1024U / 1024U));
+
+	if (unlink(file_path) == 0) {
+		_available += statbuf.st_size;
+
+	} else {
+		PX4_ERR("Failed to delete %s", file_path);
+		_files_removable = false;
+	}
+}
+
+bool LogRetention::request_pending()
+{
+	pthread_mutex_lock(&_mutex);
+	const bool pending = _request_pending;
+	pthread_mutex_unlock(&_mutex);
+	return pending;
+}
+
+bool LogRetention::dir_path(const char *name, char *path, size_t path_size) const
+{
+	return snprintf(path, path_size, "%s/%s", _log_root_dir, name) < (int)path_size;
+}
+
+bool LogRetention::is_current_dir(const LogDir &dir) const
+{
+	return strcmp(dir.name, _log_dir) == 0;
+}
+
+uint64_t LogRetention::min_free_bytes() const
+{
+	// 300 MiB, reduced if it's larger than 10% of the disk size
+	return math::min(300ULL * 1024ULL * 1024ULL, (unsigned long long)(_disk_size / 10));
+}
+
+} //namespace logger
+} //namespace px4
@@ -0,0 +1,183 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <dirent.h>
+#include <pthread.h>
+#include <stdint.h>
+
+#include "util.h"
+
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+
+namespace px4
+{
+namespace logger
+{
+
+/**
+ * @class LogRetention
+ * Removes old logs in the background (on the low priority work queue), so that neither starting a log
+ * nor the logger and writer threads block on file system operations.
+ *
+ * The log root directory is expected to contain directories in the form of sess<i> or <year>-<month>-<day>.
+ * Logs are removed if there are more than max_log_dirs_to_keep directories, or if the free space falls below
+ * 300 MiB (or 10% of the disk size). The oldest directories are removed first (never the current one), then
+ * the oldest files of the current directory (up to the current file).
+ *
+ * All the work is split into small steps, each handling a few directory entries, after which the work item is
+ * rescheduled. The root directory is scanned once and cached. statfs() (which can be slow on FAT) is only called
+ * once per cleanup, the free space is then tracked from the sizes of the removed files. After a cleanup the
+ * sizes of the cached directories are added up, again in small steps.
+ */
+class LogRetention : public px4::WorkItem
+{
+public:
+	LogRetention();
+	~LogRetention() override;
+
+	/**
+	 * Start scanning the log root directory and remove old logs as needed
+	 * @param log_root_dir log root directory (must stay valid)
+	 * @param max_log_dirs_to_keep maximum log directories to keep (set to 0 for unlimited)
+	 */
+	void start(const char *log_root_dir, int32_t max_log_dirs_to_keep);
+
+	/**
+	 * Request a cleanup for a newly started log file. If a cleanup is running, another one follows.
+	 * @param log_dir name of the current log directory within the root directory, e.g. "sess001"
+	 * @param log_file name of the current log file within log_dir, e.g. "log001.ulg"
+	 */
+	void request(const char *log_dir, const char *log_file);
+
+	/** whether there was less than 50 MiB free space left after the last cleanup */
+	bool storage_full() const { return _storage_full.load(); }
+
+	/** free space after the last cleanup [bytes] */
+	uint64_t free_space() const { return _free_space.load(); }
+
+	/** total size of the logs in the cached directories [bytes] (filled in after a cleanup) */
+	uint64_t logs_size() const { return _logs_size.load(); }
+
+	int num_log_dirs() const { return _num_log_dirs.load(); }
+
+private:
+	void Run() override;
+
+	enum class State {
+		Idle,
+		ScanRoot,
+		Check,
+		RemoveDir,
+		RemoveFile,
+		SizeDirs,
+	};
+
+	struct LogDir {
+		char name[12]; ///< same size as Logger::LogFileName::log_dir
+		int32_t order; ///< sess<i>: i, dates: <year><month><day>
+		bool is_date;
+		bool size_valid;
+		uint64_t size; ///< total size of the files [bytes]
+	};
+
+	/** read the next entries of the root directory into _dirs. @return true when done */
+	bool scan_root();
+
+	/** add up the file sizes of the next entries of the next directory without size. @return true when all done */
+	bool size_dirs();
+
+	/** decide on the next step after a directory or file was removed */
+	State check();
+
+	/** remove the next entries of _dirs[_remove_index]. @return true when done */
+	bool remove_dir();
+
+	/** remove the oldest file of the current directory */
+	void remove_file();
+
+	void insert_dir(const char *name, int32_t order, bool is_date);
+
+	/** index of the directory to remove next (oldest of the scheme with more directories), -1 if none */
+	int oldest_dir() const;
+
+	bool request_pending();
+
+	bool dir_path(const char *name, char *path, size_t path_size) const;
+
+	bool is_current_dir(const LogDir &dir) const;
+
+	uint64_t min_free_bytes() const;
+
+#ifdef __PX4_NUTTX
+	static constexpr int MAX_DIRS = 64;
+#else
+	static constexpr int MAX_DIRS = 512;
+#endif
+	static constexpr int ENTRIES_PER_RUN = 16; ///< max number of directory entries handled per run
+
+	const char *_log_root_dir{nullptr};
+	int32_t _max_log_dirs_to_keep{0};
+
+	pthread_mutex_t _mutex;
+	bool _request_pending{false};
+	char _requested_log_dir[12] {};
+	char _requested_log_file[31] {}; ///< same size as Logger::LogFileName::log_file_name
+
+	// the following are only accessed from Run()
+	State _state{State::Idle};
+	bool _dirs_valid{false};
+	LogDir _dirs[MAX_DIRS] {};
+	int _num_dirs{0}; ///< number of cached directories
+	int _num_dirs_total{0}; ///< number of directories, including those that did not fit into the cache
+	DIR *_dir{nullptr}; ///< directory being scanned
+	int _dir_index{-1}; ///< index into _dirs of _dir
+	int _remove_index{-1};
+	char _log_dir[12] {};
+	char _log_file[31] {};
+	bool _files_removable{false}; ///< whether there are old files left in the current directory
+	uint64_t _disk_size{0};
+	uint64_t _available{0}; ///< free space estimate [bytes]
+
+	px4::atomic_bool _storage_full{false};
+	px4::atomic<uint64_t> _free_space{0};
+	px4::atomic<uint64_t> _logs_size{0};
+	px4::atomic_int _num_log_dirs{0};
+	px4::atomic_bool _exit{false};
+};
+
+} //namespace logger
+} //namespace px4
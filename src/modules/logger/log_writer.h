@@ -126,6 +126,34 @@ public:
 		return 0;
 	}
 
+	/** @see LogWriterFile::reserve_message() */
+	uint8_t *reserve_message_file(LogType type, size_t size)
+	{
+		if (_log_writer_file) { return _log_writer_file->reserve_message(type, size); }
+
+		return nullptr;
+	}
+
+	/** @see LogWriterFile::commit_message() */
+	void commit_message_file(LogType type, size_t size)
+	{
+		if (_log_writer_file) { _log_writer_file->commit_message(type, size); }
+	}
+
+	/** @see LogWriterFile::get_write_offset() */
+	uint64_t get_write_offset_file(LogType type) const
+	{
+		if (_log_writer_file) { return _log_writer_file->get_write_offset(type); }
+
+		return 0;
+	}
+
+	/** @see LogWriterFile::set_appended_data_offset() */
+	void set_appended_data_offset_file(LogType type, uint64_t offset)
+	{
+		if (_log_writer_file) { _log_writer_file->set_appended_data_offset(type, offset); }
+	}
+
 	size_t get_buffer_size_file(LogType type) const
 	{
 		if (_log_writer_file) { return _log_writer_file->get_buffer_size(type); }
@@ -133,6 +161,11 @@ public:
 		return 0;
 	}
 
+	void print_write_latency_file(LogType type) const
+	{
+		if (_log_writer_file) { _log_writer_file->print_write_latency(type); }
+	}
+
 	size_t get_buffer_fill_count_file(LogType type) const
 	{
 		if (_log_writer_file) { return _log_writer_file->get_buffer_fill_count(type); }
@@ -174,6 +207,13 @@ public:
 		if (_log_writer_file) { _log_writer_file->set_encryption_parameters(algorithm, key_idx, exchange_key_idx); }
 	}
 #endif
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	void set_compression(bool enable)
+	{
+		if (_log_writer_file) { _log_writer_file->set_compression(enable); }
+	}
+#endif
 private:
 
 	LogWriterFile *_log_writer_file = nullptr;
@@ -35,6 +35,7 @@
 #include "messages.h"
 
 #include <fcntl.h>
+#include <stddef.h>
 #include <string.h>
 #include <errno.h>
 
@@ -61,15 +62,18 @@ LogWriterFile::LogWriterFile(size_t buffer_size)
 	//needs to be larger than the minimum write chunk (300 is somewhat arbitrary)
 	{
 		math::max(buffer_size, _min_write_chunk + 300),
-		perf_alloc(PC_ELAPSED, "logger_sd_write"), perf_alloc(PC_ELAPSED, "logger_sd_fsync")},
+		perf_alloc(PC_HISTOGRAM, "logger_sd_write"), perf_alloc(PC_HISTOGRAM, "logger_sd_fsync")},
 
 	{
 		300, // buffer size for the mission log (can be kept fairly small)
-		perf_alloc(PC_ELAPSED, "logger_sd_write_mission"), perf_alloc(PC_ELAPSED, "logger_sd_fsync_mission")}
+		perf_alloc(PC_HISTOGRAM, "logger_sd_write_mission"), perf_alloc(PC_HISTOGRAM, "logger_sd_fsync_mission")}
 }
 {
 	pthread_mutex_init(&_mtx, nullptr);
 	pthread_cond_init(&_cv, nullptr);
+#if defined(PX4_CRYPTO)
+	pthread_cond_init(&_encrypt_cv, nullptr);
+#endif
 }
 
 bool LogWriterFile::init()
@@ -81,6 +85,9 @@ LogWriterFile::~LogWriterFile()
 {
 	pthread_mutex_destroy(&_mtx);
 	pthread_cond_destroy(&_cv);
+#if defined(PX4_CRYPTO)
+	pthread_cond_destroy(&_encrypt_cv);
+#endif
 }
 
 #if defined(PX4_CRYPTO)
@@ -225,7 +232,14 @@ bool LogWriterFile::start_log(LogType type, const char *filename)
 
 	unlock();
 
-	if (type == LogType::Full) {
+	bool compress = false;
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	compress = (type == LogType::Full) && _compress;
+#endif
+
+	// the hardfault handler appends uncompressed data, which would corrupt a compressed log
+	if (type == LogType::Full && !compress) {
 		// register the current file with the hardfault handler: if the system crashes,
 		// the hardfault handler will append the crash log to that file on the next reboot.
 		// Note that we don't deregister it when closing the log, so that crashes after disarming
@@ -248,7 +262,7 @@ bool LogWriterFile::start_log(LogType type, const char *filename)
 
 #endif
 
-	if (_buffers[(int)type].start_log(filename)) {
+	if (_buffers[(int)type].start_log(filename, compress)) {
 		PX4_INFO("Opened %s log file: %s", log_type_str(type), filename);
 		notify();
 		return true;
@@ -310,6 +324,25 @@ int LogWriterFile::thread_start()
 	pthread_attr_setstacksize(&thr_attr, PX4_STACK_ADJUSTED(1170));
 
 	int ret = pthread_create(&_thread, &thr_attr, &LogWriterFile::run_helper, this);
+
+#if defined(PX4_CRYPTO)
+
+	if (ret == 0) {
+		/* below the writer, so that writing out encrypted data takes precedence */
+		param.sched_priority = SCHED_PRIORITY_DEFAULT - 41;
+		(void)pthread_attr_setschedparam(&thr_attr, &param);
+		pthread_attr_setstacksize(&thr_attr, PX4_STACK_ADJUSTED(1170));
+
+		ret = pthread_create(&_encrypt_thread, &thr_attr, &LogWriterFile::encrypt_helper, this);
+
+		if (ret != 0) {
+			_encrypt_thread = 0;
+			thread_stop();
+		}
+	}
+
+#endif
+
 	pthread_attr_destroy(&thr_attr);
 
 	return ret;
@@ -331,6 +364,21 @@ void LogWriterFile::thread_stop()
 	if (ret) {
 		PX4_WARN("join failed: %d", ret);
 	}
+
+#if defined(PX4_CRYPTO)
+
+	if (_encrypt_thread != 0) {
+		notify();
+		ret = pthread_join(_encrypt_thread, nullptr);
+
+		if (ret) {
+			PX4_WARN("join failed: %d", ret);
+		}
+
+		_encrypt_thread = 0;
+	}
+
+#endif
 }
 
 void *LogWriterFile::run_helper(void *context)
@@ -341,6 +389,95 @@ void *LogWriterFile::run_helper(void *context)
 	return nullptr;
 }
 
+#if defined(PX4_CRYPTO)
+void *LogWriterFile::encrypt_helper(void *context)
+{
+	px4_prctl(PR_SET_NAME, "log_encrypt", px4_getpid());
+
+	static_cast<LogWriterFile *>(context)->run_encrypt();
+	return nullptr;
+}
+
+void LogWriterFile::run_encrypt()
+{
+	pthread_mutex_lock(&_mtx);
+
+	while (true) {
+		bool encrypted_any = false;
+
+		/* mission log first, same as the writer */
+		for (int i = (int)LogType::Count - 1; i >= 0; --i) {
+			LogFileBuffer &buffer = _buffers[i];
+
+			if (_algorithm == CRYPTO_NONE || buffer.fd() < 0) {
+				continue;
+			}
+
+			const size_t blocksize = _min_blocksize;
+			uint8_t *ptr;
+			size_t size = buffer.get_encrypt_ptr(&ptr, blocksize);
+
+			// limit the chunk size, so that the writer can start on the data early
+			const size_t max_size = math::max((_min_write_chunk / blocksize) * blocksize, blocksize);
+
+			if (size > max_size) {
+				size = max_size;
+			}
+
+			if (size == 0) {
+				continue;
+			}
+
+			/* The data between the read position and the write position is only modified by this
+			 * thread, so it can be encrypted in place without holding the lock. */
+			_encrypting = true;
+			pthread_mutex_unlock(&_mtx);
+
+			size_t out = size;
+
+			if (!_crypto.encrypt_data(_key_idx, ptr, size, ptr, &out)) {
+				PX4_ERR("Encryption failed, logfile corrupted");
+
+			} else if (out != size) {
+				PX4_ERR("Encryption output size mismatch, logfile corrupted");
+			}
+
+			pthread_mutex_lock(&_mtx);
+			_encrypting = false;
+			buffer.mark_encrypted(size);
+			encrypted_any = true;
+		}
+
+		if (encrypted_any) {
+			pthread_cond_broadcast(&_cv);
+			continue;
+		}
+
+		/* only exit once the writer does not wait for encrypted data anymore */
+		if (_exit_thread.load() && _buffers[0].fd() < 0 && _buffers[1].fd() < 0) {
+			break;
+		}
+
+		pthread_cond_wait(&_encrypt_cv, &_mtx);
+	}
+
+	pthread_mutex_unlock(&_mtx);
+}
+#endif
+
+bool LogWriterFile::encryption_pending(const LogFileBuffer &buffer) const
+{
+#if defined(PX4_CRYPTO)
+
+	if (_algorithm != CRYPTO_NONE) {
+		const size_t blocksize = _min_blocksize;
+		return (buffer.count() / blocksize) * blocksize > buffer.encrypted();
+	}
+
+#endif
+	return false;
+}
+
 void LogWriterFile::run()
 {
 	while (!_exit_thread.load()) {
@@ -389,12 +526,25 @@ void LogWriterFile::run()
 			int i = (int)LogType::Count - 1;
 
 			while (i >= 0) {
+				LogFileBuffer &buffer = _buffers[i];
+#if defined(LOGGER_WRITEV)
+				struct iovec iov[2];
+				const bool is_part = false;
+				size_t available = buffer.get_read_iov(iov);
+#else
 				void *read_ptr;
 				bool is_part;
-				LogFileBuffer &buffer = _buffers[i];
 				size_t available = buffer.get_read_ptr(&read_ptr, &is_part);
+#endif
 
 #if defined(PX4_CRYPTO)
+
+				if (_algorithm != CRYPTO_NONE && available > buffer.encrypted()) {
+					// only write what the encryption thread already processed
+					available = buffer.encrypted();
+					is_part = false;
+				}
+
 				// Split into min blocksize chunks, so it is good for encrypting in pieces
 				available = (available / _min_blocksize) * _min_blocksize;
 #endif
@@ -403,39 +553,21 @@ void LogWriterFile::run()
 				if (available >= min_available[i] || is_part || (!buffer._should_run && available > 0)) {
 					pthread_mutex_unlock(&_mtx);
 
-#if defined(PX4_CRYPTO)
-					/* This makes the following assumptions:
-					 * - the chipher size is always the
-					     same as the input size
-					 * - the encryption can be done in
-					     place. This is always taken care
-					     by the px4 crypto interfaces
-					 */
-
-					size_t out = available;
-
-					if (_algorithm != CRYPTO_NONE) {
-						_crypto.encrypt_data(
-							_key_idx,
-							(uint8_t *)read_ptr,
-							available,
-							(uint8_t *)read_ptr,
-							&out);
-
-						if (out != available) {
-							PX4_ERR("Encryption output size mismatch, logfile corrupted");
-						}
-					}
-
-#endif
-
+#if defined(LOGGER_WRITEV)
+					int written = buffer.write_to_file(iov, call_fsync);
+#else
 					int written = buffer.write_to_file(read_ptr, available, call_fsync);
+#endif
 
 					if (written < 0) {
 						// retry once
 						PX4_ERR("write failed errno:%i (%s), retrying", errno, strerror(errno));
 						px4_usleep(10000); // 10 milliseconds
+#if defined(LOGGER_WRITEV)
+						written = buffer.write_to_file(iov, call_fsync);
+#else
 						written = buffer.write_to_file(read_ptr, available, call_fsync);
+#endif
 					}
 
 					/* buffer.mark_read() requires _mtx to be locked */
@@ -445,7 +577,8 @@ void LogWriterFile::run()
 						/* subtract bytes written from number in buffer (count -= written) */
 						buffer.mark_read(written);
 
-						if (!buffer._should_run && written == static_cast<int>(available) && !is_part) {
+						if (!buffer._should_run && written == static_cast<int>(available) && !is_part
+						    && !encryption_pending(buffer)) {
 							/* Stop only when all data written */
 							pthread_mutex_unlock(&_mtx);
 							buffer.close_file();
@@ -460,6 +593,14 @@ void LogWriterFile::run()
 						pthread_mutex_unlock(&_mtx);
 						buffer.close_file();
 						pthread_mutex_lock(&_mtx);
+#if defined(PX4_CRYPTO)
+
+						// do not reset the buffer under the encryption thread
+						while (_encrypting) {
+							pthread_cond_wait(&_cv, &_mtx);
+						}
+
+#endif
 						buffer.reset();
 					}
 
@@ -468,7 +609,7 @@ void LogWriterFile::run()
 					buffer.fsync();
 					pthread_mutex_lock(&_mtx);
 
-				} else if (available == 0 && !buffer._should_run) {
+				} else if (available == 0 && !buffer._should_run && !encryption_pending(buffer)) {
 					pthread_mutex_unlock(&_mtx);
 					buffer.close_file();
 					pthread_mutex_lock(&_mtx);
@@ -498,8 +639,10 @@ void LogWriterFile::run()
 			 * and calling pthread_cond_wait() will still wait for the next notify(). But this is generally
 			 * not an issue because notify() is called regularly.
 			 * If the logger was switched off in the meantime, do not wait for data, instead run this loop
-			 * once more to write remaining data and close the file. */
-			if (_buffers[0]._should_run || _buffers[1]._should_run) {
+			 * once more to write remaining data and close the file.
+			 * After stopping, wait for the encryption thread to process the remaining data. */
+			if (_buffers[0]._should_run || _buffers[1]._should_run
+			    || encryption_pending(_buffers[0]) || encryption_pending(_buffers[1])) {
 				pthread_cond_wait(&_cv, &_mtx);
 			}
 		}
@@ -603,9 +746,20 @@ LogWriterFile::LogFileBuffer::~LogFileBuffer()
 	}
 
 	free(_buffer);
+	free(_filename);
 
 	perf_free(_perf_write);
 	perf_free(_perf_fsync);
+
+#if defined(LOGGER_DIRECT_IO)
+	free(_direct_block);
+#endif
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	delete _hse;
+	free(_compress_buffer);
+	perf_free(_perf_compress);
+#endif
 }
 
 void LogWriterFile::LogFileBuffer::write_no_check(void *ptr, size_t size)
@@ -649,9 +803,76 @@ size_t LogWriterFile::LogFileBuffer::get_read_ptr(void **ptr, bool *is_part)
 	}
 }
 
-bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
+size_t LogWriterFile::LogFileBuffer::get_encrypt_ptr(uint8_t **ptr, size_t blocksize) const
 {
-	_fd = ::open(filename, O_CREAT | O_WRONLY, PX4_O_MODE_666);
+	size_t size = _count - _encrypted;
+
+	if (size == 0) {
+		return 0;
+	}
+
+	const size_t start = (_head + _buffer_size - _count + _encrypted) % _buffer_size;
+
+	if (start + size > _buffer_size) {
+		size = _buffer_size - start;
+	}
+
+	*ptr = &_buffer[start];
+	return (size / blocksize) * blocksize;
+}
+
+#if defined(LOGGER_WRITEV)
+size_t LogWriterFile::LogFileBuffer::get_read_iov(struct iovec iov[2])
+{
+	int read_ptr = _head - _count;
+
+	if (read_ptr < 0) {
+		read_ptr += _buffer_size;
+		iov[0].iov_base = &_buffer[read_ptr];
+		iov[0].iov_len = _buffer_size - read_ptr;
+		iov[1].iov_base = _buffer;
+		iov[1].iov_len = _head;
+
+	} else {
+		iov[0].iov_base = &_buffer[read_ptr];
+		iov[0].iov_len = _count;
+		iov[1].iov_base = _buffer;
+		iov[1].iov_len = 0;
+	}
+
+	return _count;
+}
+#endif
+
+bool LogWriterFile::LogFileBuffer::start_log(const char *filename, bool compress)
+{
+#if defined(LOGGER_DIRECT_IO)
+	_fd = ::open(filename, O_CREAT | O_WRONLY | O_DIRECT, PX4_O_MODE_666);
+	_direct = (_fd >= 0);
+
+	if (_fd < 0 && errno == EINVAL) {
+		// the file system does not support direct I/O (e.g. tmpfs)
+		PX4_WARN("direct I/O not supported for %s", filename);
+	}
+
+	if (_direct && _direct_block == nullptr) {
+		if (posix_memalign((void **)&_direct_block, 4096, _direct_block_size) != 0) {
+			_direct_block = nullptr;
+			_direct = false;
+			::close(_fd);
+			_fd = -1;
+		}
+	}
+
+	_direct_fill = 0;
+	_direct_offset = 0;
+
+	if (_fd < 0)
+#endif
+	{
+		_fd = ::open(filename, O_CREAT | O_WRONLY, PX4_O_MODE_666);
+	}
+
 	_had_write_error.store(false);
 
 	if (_fd < 0) {
@@ -659,6 +880,10 @@ bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
 		return false;
 	}
 
+	free(_filename);
+	_filename = strdup(filename);
+	_appended_data_offset = 0;
+
 	if (_buffer == nullptr) {
 		_buffer = (uint8_t *) px4_cache_aligned_alloc(_buffer_size);
 
@@ -670,6 +895,44 @@ bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
 		}
 	}
 
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+	if (compress) {
+		if (_hse == nullptr) {
+			_hse = new heatshrink_encoder();
+			_compress_buffer = (uint8_t *)px4_cache_aligned_alloc(_compress_buffer_size);
+			_perf_compress = perf_alloc(PC_ELAPSED, "logger_compress");
+		}
+
+		if (_hse == nullptr || _compress_buffer == nullptr) {
+			PX4_ERR("Can't create log compression buffer");
+			::close(_fd);
+			_fd = -1;
+			return false;
+		}
+
+		const ulog_compressed_header_s header = {
+			.magic = {'U', 'L', 'o', 'g', 'Z', 'p'},
+			.hdr_ver = 1,
+			.algorithm = 1,
+			.window_bits = HEATSHRINK_STATIC_WINDOW_BITS,
+			.lookahead_bits = HEATSHRINK_STATIC_LOOKAHEAD_BITS
+		};
+
+		memcpy(_compress_buffer, &header, sizeof(header));
+		_compress_count = sizeof(header);
+
+	} else {
+		if (_hse != nullptr) {
+			delete _hse;
+			_hse = nullptr;
+			free(_compress_buffer);
+			_compress_buffer = nullptr;
+		}
+	}
+
+#endif
+
 	// Clear buffer and counters
 	_head = 0;
 	_count = 0;
@@ -680,17 +943,77 @@ bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
 	return true;
 }
 
-void LogWriterFile::LogFileBuffer::fsync() const
+void LogWriterFile::LogFileBuffer::fsync()
 {
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+	if (_hse != nullptr) {
+		flush_compressed();
+	}
+
+#endif
+
 	perf_begin(_perf_fsync);
+
+#if defined(LOGGER_DIRECT_IO)
+
+	if (_direct) {
+		sync_direct();
+	}
+
+#endif
+
 	::fsync(_fd);
 	perf_end(_perf_fsync);
 }
 
-ssize_t LogWriterFile::LogFileBuffer::write_to_file(const void *buffer, size_t size, bool call_fsync) const
+ssize_t LogWriterFile::LogFileBuffer::write_to_file(const void *buffer, size_t size, bool call_fsync)
+{
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+	if (_hse != nullptr) {
+		return write_compressed(buffer, size, call_fsync);
+	}
+
+#endif
+
+	ssize_t ret = write_raw(buffer, size);
+
+	if (call_fsync) {
+		fsync();
+	}
+
+	return ret;
+}
+
+#if defined(LOGGER_WRITEV)
+ssize_t LogWriterFile::LogFileBuffer::write_to_file(const struct iovec iov[2], bool call_fsync)
 {
+	bool scatter_gather = iov[1].iov_len > 0;
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	scatter_gather = scatter_gather && _hse == nullptr;
+#endif
+#if defined(LOGGER_DIRECT_IO)
+	scatter_gather = scatter_gather && !_direct;
+#endif
+
+	if (!scatter_gather) {
+		// compression and direct I/O copy into their own block anyway
+		ssize_t ret = write_to_file(iov[0].iov_base, iov[0].iov_len, call_fsync && iov[1].iov_len == 0);
+
+		if (ret == (ssize_t)iov[0].iov_len && iov[1].iov_len > 0) {
+			ssize_t ret2 = write_to_file(iov[1].iov_base, iov[1].iov_len, call_fsync);
+
+			if (ret2 > 0) {
+				ret += ret2;
+			}
+		}
+
+		return ret;
+	}
+
 	perf_begin(_perf_write);
-	ssize_t ret = ::write(_fd, buffer, size);
+	ssize_t ret = ::writev(_fd, iov, 2);
 	perf_end(_perf_write);
 
 	if (call_fsync) {
@@ -699,9 +1022,217 @@ ssize_t LogWriterFile::LogFileBuffer::write_to_file(const void *buffer, size_t s
 
 	return ret;
 }
+#endif // LOGGER_WRITEV
+
+ssize_t LogWriterFile::LogFileBuffer::write_raw(const void *buffer, size_t size)
+{
+#if defined(LOGGER_DIRECT_IO)
+
+	if (_direct) {
+		return write_direct(buffer, size);
+	}
+
+#endif
+
+	perf_begin(_perf_write);
+	ssize_t ret = ::write(_fd, buffer, size);
+	perf_end(_perf_write);
+
+	return ret;
+}
+
+#if defined(LOGGER_DIRECT_IO)
+ssize_t LogWriterFile::LogFileBuffer::write_direct(const void *buffer, size_t size)
+{
+	const uint8_t *data = static_cast<const uint8_t *>(buffer);
+	size_t consumed = 0;
+
+	while (consumed < size) {
+		// a full block is left over if the previous write failed
+		if (_direct_fill == _direct_block_size && write_direct_block() < 0) {
+			return (consumed > 0) ? (ssize_t)consumed : -1;
+		}
+
+		const size_t n = math::min(size - consumed, _direct_block_size - _direct_fill);
+		memcpy(&_direct_block[_direct_fill], data + consumed, n);
+		_direct_fill += n;
+		consumed += n;
+	}
+
+	if (_direct_fill == _direct_block_size) {
+		// on failure this is retried with the next write
+		write_direct_block();
+	}
+
+	return consumed;
+}
+
+int LogWriterFile::LogFileBuffer::write_direct_block()
+{
+	perf_begin(_perf_write);
+	ssize_t ret = ::pwrite(_fd, _direct_block, _direct_block_size, _direct_offset);
+	perf_end(_perf_write);
+
+	if (ret != (ssize_t)_direct_block_size) {
+		return -1;
+	}
+
+	_direct_offset += _direct_block_size;
+	_direct_fill = 0;
+	return 0;
+}
+
+int LogWriterFile::LogFileBuffer::sync_direct()
+{
+	if (_direct_fill == _direct_block_size) {
+		return write_direct_block();
+	}
+
+	if (_direct_fill == 0) {
+		return 0;
+	}
+
+	memset(&_direct_block[_direct_fill], 0, _direct_block_size - _direct_fill);
+
+	perf_begin(_perf_write);
+	ssize_t ret = ::pwrite(_fd, _direct_block, _direct_block_size, _direct_offset);
+	perf_end(_perf_write);
+
+	if (ret != (ssize_t)_direct_block_size || ::ftruncate(_fd, _direct_offset + _direct_fill) != 0) {
+		return -1;
+	}
+
+	return 0;
+}
+#endif // LOGGER_DIRECT_IO
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+ssize_t LogWriterFile::LogFileBuffer::write_compressed(const void *buffer, size_t size, bool call_fsync)
+{
+	const uint8_t *data = static_cast<const uint8_t *>(buffer);
+	size_t consumed = 0;
+
+	while (consumed < size) {
+		if (_compress_buffer_size - _compress_count < _compress_frame_max) {
+			if (flush_compressed() < 0) {
+				// report what was consumed so far, so that nothing is compressed twice on retry
+				return (consumed > 0) ? (ssize_t)consumed : -1;
+			}
+		}
+
+		const size_t frame_size = math::min(size - consumed, _compress_frame_input);
+
+		if (!compress_frame(data + consumed, frame_size)) {
+			errno = EIO;
+			return (consumed > 0) ? (ssize_t)consumed : -1;
+		}
+
+		consumed += frame_size;
+	}
+
+	if (call_fsync) {
+		fsync();
+	}
+
+	return consumed;
+}
+
+bool LogWriterFile::LogFileBuffer::compress_frame(const uint8_t *buffer, size_t size)
+{
+	perf_begin(_perf_compress);
+
+	heatshrink_encoder_reset(_hse);
+
+	uint8_t *frame = &_compress_buffer[_compress_count];
+	uint8_t *out = frame + _compress_frame_header;
+	const size_t out_capacity = _compress_frame_max - _compress_frame_header;
+	size_t out_size = 0;
+	size_t in_size = 0;
+	bool finished = false;
+
+	while (!finished) {
+		if (in_size < size) {
+			size_t count = 0;
+
+			if (heatshrink_encoder_sink(_hse, const_cast<uint8_t *>(buffer + in_size), size - in_size, &count) < 0) {
+				break;
+			}
+
+			in_size += count;
+
+		} else {
+			finished = (heatshrink_encoder_finish(_hse) == HSER_FINISH_DONE);
+		}
+
+		HSE_poll_res pres;
+
+		do {
+			size_t count = 0;
+			pres = heatshrink_encoder_poll(_hse, out + out_size, out_capacity - out_size, &count);
+			out_size += count;
+		} while (pres == HSER_POLL_MORE && out_size < out_capacity);
+
+		if (pres < 0 || (pres == HSER_POLL_MORE && out_size >= out_capacity)) {
+			break;
+		}
+	}
+
+	perf_end(_perf_compress);
+
+	if (!finished) {
+		PX4_ERR("log compression failed");
+		return false;
+	}
+
+	frame[0] = (uint8_t)out_size;
+	frame[1] = (uint8_t)(out_size >> 8);
+	frame[2] = (uint8_t)size;
+	frame[3] = (uint8_t)(size >> 8);
+	_compress_count += _compress_frame_header + out_size;
+
+	return true;
+}
+
+int LogWriterFile::LogFileBuffer::flush_compressed()
+{
+	size_t written = 0;
+
+	while (written < _compress_count) {
+		ssize_t ret = write_raw(_compress_buffer + written, _compress_count - written);
+
+		if (ret <= 0) {
+			// keep the unwritten part for the next attempt
+			memmove(_compress_buffer, _compress_buffer + written, _compress_count - written);
+			_compress_count -= written;
+			return -1;
+		}
+
+		written += ret;
+	}
+
+	_compress_count = 0;
+	return 0;
+}
+#endif // CONFIG_LOGGER_COMPRESSION
 
 void LogWriterFile::LogFileBuffer::close_file()
 {
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+	if (_fd >= 0 && _hse != nullptr && flush_compressed() < 0) {
+		PX4_ERR("writing compressed log data failed (%i)", errno);
+	}
+
+#endif
+
+#if defined(LOGGER_DIRECT_IO)
+
+	if (_fd >= 0 && _direct && sync_direct() < 0) {
+		PX4_ERR("writing log data failed (%i)", errno);
+	}
+
+#endif
+
 	if (_fd >= 0) {
 		int res = close(_fd);
 
@@ -710,15 +1241,46 @@ void LogWriterFile::LogFileBuffer::close_file()
 
 		} else {
 			PX4_INFO("closed logfile, bytes written: %zu", _total_written);
+
+			if (_appended_data_offset > 0 && _appended_data_offset < _total_written) {
+				write_appended_data_offset();
+			}
 		}
 	}
 }
 
+void LogWriterFile::LogFileBuffer::write_appended_data_offset()
+{
+	// reopen the file, as with direct I/O only aligned blocks can be written
+	int fd = _filename ? ::open(_filename, O_WRONLY) : -1;
+
+	if (fd < 0) {
+		PX4_ERR("Can't open log file to set appended data offset, errno: %d", errno);
+		return;
+	}
+
+	// the flag bits message directly follows the file header. The offset is written first, so that the flag
+	// only gets set with a valid offset.
+	const off_t flag_bits_offset = sizeof(ulog_file_header_s);
+	const uint8_t incompat_flags0 = ULOG_INCOMPAT_FLAG0_DATA_APPENDED_MASK;
+
+	if (::pwrite(fd, &_appended_data_offset, sizeof(_appended_data_offset),
+		     flag_bits_offset + offsetof(ulog_message_flag_bits_s, appended_offsets)) != sizeof(_appended_data_offset)
+	    || ::pwrite(fd, &incompat_flags0, sizeof(incompat_flags0),
+			flag_bits_offset + offsetof(ulog_message_flag_bits_s, incompat_flags)) != sizeof(incompat_flags0)) {
+		PX4_ERR("Setting appended data offset failed, errno: %d", errno);
+	}
+
+	::close(fd);
+}
+
 void LogWriterFile::LogFileBuffer::reset()
 {
 	_head = 0;
 	_count = 0;
+	_encrypted = 0;
 	_fd = -1;
+	_appended_data_offset = 0;
 }
 
 }
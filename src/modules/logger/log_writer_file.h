@@ -41,6 +41,24 @@
 #include <perf/perf_counter.h>
 #include <px4_platform_common/crypto.h>
 
+#if defined(CONFIG_LOGGER_DIRECT_IO) && defined(__PX4_POSIX)
+#include <fcntl.h>
+#if defined(O_DIRECT)
+#define LOGGER_DIRECT_IO 1
+#endif
+#endif
+
+#if defined(__PX4_POSIX) && !defined(PX4_CRYPTO)
+#include <sys/uio.h>
+// write both parts of the ring buffer with a single writev() call
+#define LOGGER_WRITEV 1
+#endif
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+#define HEATSHRINK_DYNAMIC_ALLOC 0
+#include <lib/heatshrink/heatshrink/heatshrink_encoder.h>
+#endif
+
 namespace px4
 {
 namespace logger
@@ -101,6 +119,9 @@ public:
 	void notify()
 	{
 		pthread_cond_broadcast(&_cv);
+#if defined(PX4_CRYPTO)
+		pthread_cond_broadcast(&_encrypt_cv);
+#endif
 	}
 
 	size_t get_total_written(LogType type) const
@@ -108,6 +129,46 @@ public:
 		return _buffers[(int)type].total_written();
 	}
 
+	/**
+	 * Get contiguous space for a message in the buffer, so that the caller can serialize it in place
+	 * instead of passing it to write_message(). The message is written once commit_message() is called.
+	 * The caller must call lock() before calling this, and hold it until commit_message().
+	 * @param size number of bytes to reserve
+	 * @return nullptr if the log is not started or there is not enough contiguous space left
+	 */
+	uint8_t *reserve_message(LogType type, size_t size)
+	{
+		return is_started(type) ? _buffers[(int)type].reserve(size) : nullptr;
+	}
+
+	/**
+	 * Write a message previously serialized into the space returned by reserve_message()
+	 * @param size size of the message, at most the reserved size
+	 */
+	void commit_message(LogType type, size_t size)
+	{
+		_buffers[(int)type].commit(size);
+	}
+
+	/**
+	 * File offset at which the next message passed to write_message() starts.
+	 * The caller must call lock() before calling this.
+	 */
+	uint64_t get_write_offset(LogType type) const
+	{
+		return _buffers[(int)type].total_written() + _buffers[(int)type].count();
+	}
+
+	/**
+	 * Mark the data from a file offset onwards as appended data. The flag bits message is updated accordingly
+	 * once the file is closed (@see ULOG_INCOMPAT_FLAG0_DATA_APPENDED_MASK).
+	 * The caller must call lock() before calling this.
+	 */
+	void set_appended_data_offset(LogType type, uint64_t offset)
+	{
+		_buffers[(int)type].set_appended_data_offset(offset);
+	}
+
 	size_t get_buffer_size(LogType type) const
 	{
 		return _buffers[(int)type].buffer_size();
@@ -134,6 +195,13 @@ public:
 
 	bool had_write_error() const { return _buffers[(int)LogType::Full]._had_write_error.load(); }
 
+	/** print the write and fsync latency of a log type */
+	void print_write_latency(LogType type) const
+	{
+		perf_print_counter(_buffers[(int)type].perf_write());
+		perf_print_counter(_buffers[(int)type].perf_fsync());
+	}
+
 	pthread_t thread_id() const { return _thread; }
 
 #if defined(PX4_CRYPTO)
@@ -145,11 +213,30 @@ public:
 	}
 #endif
 
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	/**
+	 * Enable compression of the full log for the next started log file.
+	 * The file then consists of a ulog_compressed_header_s followed by independently
+	 * compressed frames (@see LogFileBuffer::compress_frame()).
+	 */
+	void set_compression(bool enable) { _compress = enable; }
+#endif
+
 private:
 	static void *run_helper(void *);
 
 	void run();
 
+#if defined(PX4_CRYPTO)
+	static void *encrypt_helper(void *);
+
+	/**
+	 * Encryption thread: encrypts the buffered data in place ahead of the writer thread, so that
+	 * the next chunk is encrypted while the previous one is written to the file.
+	 */
+	void run_encrypt();
+#endif
+
 	/**
 	 * permanently store the ulog file name for the hardfault crash handler, so that it can
 	 * append crash logs to the last ulog file.
@@ -173,7 +260,7 @@ private:
 
 		~LogFileBuffer();
 
-		bool start_log(const char *filename);
+		bool start_log(const char *filename, bool compress = false);
 
 		void close_file();
 
@@ -181,6 +268,34 @@ private:
 
 		size_t get_read_ptr(void **ptr, bool *is_part);
 
+#if defined(LOGGER_WRITEV)
+		/**
+		 * Get both parts of the data to be written (the second one is empty if the data does not wrap around)
+		 * @return total number of bytes
+		 */
+		size_t get_read_iov(struct iovec iov[2]);
+
+		ssize_t write_to_file(const struct iovec iov[2], bool call_fsync);
+#endif
+
+		/**
+		 * Get a pointer to size contiguous bytes at the write position, nullptr if not available
+		 */
+		uint8_t *reserve(size_t size)
+		{
+			if (!_buffer || available() < size || _buffer_size - _head < size) {
+				return nullptr;
+			}
+
+			return &_buffer[_head];
+		}
+
+		void commit(size_t size)
+		{
+			_head = (_head + size) % _buffer_size;
+			_count += size;
+		}
+
 		/**
 		 * Write to the buffer but assuming there is enough space
 		 */
@@ -190,16 +305,32 @@ private:
 
 		int fd() const { return _fd; }
 
-		inline ssize_t write_to_file(const void *buffer, size_t size, bool call_fsync) const;
+		inline ssize_t write_to_file(const void *buffer, size_t size, bool call_fsync);
+
+		inline void fsync();
+
+		void mark_read(size_t n) { _count -= n; _total_written += n; _encrypted = n < _encrypted ? _encrypted - n : 0; }
 
-		inline void fsync() const;
+		/**
+		 * Get the contiguous data following the already encrypted part, rounded down to blocksize
+		 * @return number of bytes to encrypt
+		 */
+		size_t get_encrypt_ptr(uint8_t **ptr, size_t blocksize) const;
+
+		void mark_encrypted(size_t n) { _encrypted += n; }
 
-		void mark_read(size_t n) { _count -= n; _total_written += n; }
+		/** number of bytes from the read position onwards that are encrypted and ready to be written */
+		size_t encrypted() const { return _encrypted; }
 
 		size_t total_written() const { return _total_written; }
 		size_t buffer_size() const { return _buffer_size; }
+
+		void set_appended_data_offset(uint64_t offset) { _appended_data_offset = offset; }
 		size_t count() const { return _count; }
 
+		perf_counter_t perf_write() const { return _perf_write; }
+		perf_counter_t perf_fsync() const { return _perf_fsync; }
+
 		bool _should_run = false;
 		px4::atomic_bool _had_write_error{false};
 	private:
@@ -208,21 +339,90 @@ private:
 		uint8_t *_buffer = nullptr;
 		size_t _head = 0; ///< next position to write to
 		size_t _count = 0; ///< number of bytes in _buffer to be written
+		size_t _encrypted = 0; ///< number of bytes in _buffer already encrypted (only used with PX4_CRYPTO)
 		size_t _total_written = 0;
+		char *_filename{nullptr};
+		uint64_t _appended_data_offset{0};
 		perf_counter_t _perf_write;
 		perf_counter_t _perf_fsync;
+
+		/** set the appended data flag and offset in the flag bits message of the closed file */
+		void write_appended_data_offset();
+
+		/** write to the file (through the direct I/O block if enabled) */
+		ssize_t write_raw(const void *buffer, size_t size);
+
+#if defined(LOGGER_DIRECT_IO)
+		/**
+		 * With direct I/O the page cache is bypassed (O_DIRECT), so that writes do not stall when
+		 * dirty pages are flushed. Data is copied from the ring buffer into an aligned block,
+		 * which is written at block-aligned file offsets once full. On fsync a partial block is
+		 * written zero-padded and the file truncated to its logical size; the block is then
+		 * rewritten at the same offset once it fills up.
+		 */
+		static constexpr size_t _direct_block_size = 16 * 1024;
+
+		ssize_t write_direct(const void *buffer, size_t size);
+
+		/** write the full block and advance to the next one */
+		int write_direct_block();
+
+		/** write out a partially filled block */
+		int sync_direct();
+
+		uint8_t *_direct_block{nullptr};
+		size_t _direct_fill{0};
+		off_t _direct_offset{0}; ///< file offset of _direct_block
+		bool _direct{false};
+#endif
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+		/**
+		 * Each frame is a 4 byte header (little-endian uint16 compressed size, uint16 uncompressed size)
+		 * followed by the heatshrink stream of at most _compress_frame_input bytes. The encoder is
+		 * reset for every frame, so a truncated file can be decompressed up to the last complete frame.
+		 */
+		static constexpr size_t _compress_frame_header = 4;
+		static constexpr size_t _compress_frame_input = _min_write_chunk;
+		// worst case: every byte is a literal, which takes 9 bits
+		static constexpr size_t _compress_frame_max = _compress_frame_header + _compress_frame_input
+				+ _compress_frame_input / 8 + 2;
+		static constexpr size_t _compress_buffer_size = _min_write_chunk + _compress_frame_max;
+
+		ssize_t write_compressed(const void *buffer, size_t size, bool call_fsync);
+
+		/** append a compressed frame to _compress_buffer */
+		bool compress_frame(const uint8_t *buffer, size_t size);
+
+		/** write out _compress_buffer */
+		int flush_compressed();
+
+		heatshrink_encoder *_hse{nullptr};
+		uint8_t *_compress_buffer{nullptr};
+		size_t _compress_count{0};
+		perf_counter_t _perf_compress{nullptr};
+#endif
 	};
 
+	/** true if the buffer contains data that the encryption thread still has to process */
+	bool encryption_pending(const LogFileBuffer &buffer) const;
+
 	LogFileBuffer _buffers[(int)LogType::Count];
 
 	px4::atomic_bool	_exit_thread{false};
 	bool			_need_reliable_transfer{false};
 	px4::atomic_bool	_want_fsync{false};
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	bool			_compress{false};
+#endif
 	pthread_mutex_t		_mtx;
 	pthread_cond_t		_cv;
 	pthread_t _thread = 0;
 #if defined(PX4_CRYPTO)
 	bool init_logfile_encryption(const char *filename);
+	pthread_cond_t		_encrypt_cv;
+	pthread_t _encrypt_thread = 0;
+	bool _encrypting{false}; ///< the encryption thread is working on a chunk (protected by _mtx)
 	PX4Crypto _crypto;
 	int _min_blocksize;
 	px4_crypto_algorithm_t _algorithm;
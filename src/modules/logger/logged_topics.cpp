@@ -51,6 +51,7 @@ void LoggedTopics::add_default_topics()
 	add_topic("airspeed", 1000);
 	add_optional_topic("airspeed_validated", 200);
 	add_optional_topic("autotune_attitude_control_status", 100);
+	add_optional_topic("boot_timeline");
 	add_optional_topic("camera_capture");
 	add_optional_topic("camera_trigger");
 	add_optional_topic("can_interface_status", 10);
@@ -64,6 +65,7 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic("external_ins_global_position");
 	add_optional_topic("external_ins_local_position");
 	add_optional_topic("esc_status", 250);
+	add_optional_topic("failure_detector_high_rate", 100);
 	add_topic("failure_detector_status", 100);
 	add_topic("failsafe_flags");
 	add_optional_topic("follow_target", 500);
@@ -71,6 +73,7 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic("follow_target_status", 400);
 	add_optional_topic("flaps_setpoint", 1000);
 	add_optional_topic("flight_phase_estimation", 1000);
+	add_optional_topic("frequency_response");
 	add_topic("gimbal_manager_set_attitude", 500);
 	add_optional_topic("generator_status");
 	add_optional_topic("gps_dump");
@@ -87,6 +90,7 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic("landing_gear_wheel", 100);
 	add_optional_topic("landing_target_pose", 1000);
 	add_optional_topic("launch_detection_status", 200);
+	add_optional_topic("load_shedding");
 	add_optional_topic("magnetometer_bias_estimate", 200);
 	add_topic("manual_control_setpoint", 200);
 	add_topic("manual_control_switches");
@@ -96,12 +100,15 @@ void LoggedTopics::add_default_topics()
 	add_topic("offboard_control_mode", 100);
 	add_topic("onboard_computer_status", 10);
 	add_topic("parameter_update");
+	add_optional_topic("perf_counters");
+	add_optional_topic("work_queue_status");
 	add_topic("position_controller_status", 500);
 	add_topic("position_controller_landing_status", 100);
 	add_topic("goto_setpoint", 200);
 	add_topic("position_setpoint_triplet", 200);
 	add_optional_topic("px4io_status");
 	add_topic("radio_status");
+	add_optional_topic("rate_loop_excitation");
 	add_topic("rover_ackermann_guidance_status", 100);
 	add_topic("rtl_time_estimate", 1000);
 	add_topic("rtl_status", 2000);
@@ -143,6 +150,7 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic_multi("actuator_outputs", 100, 3);
 	add_optional_topic_multi("airspeed_wind", 1000, 4);
 	add_optional_topic_multi("control_allocator_status", 200, 2);
+	add_optional_topic_multi("magnetometer_calibration_candidate", 1000, 4);
 	add_optional_topic_multi("rate_ctrl_status", 200, 2);
 	add_optional_topic_multi("sensor_hygrometer", 500, 4);
 	add_optional_topic_multi("rpm", 200);
@@ -265,6 +273,7 @@ void LoggedTopics::add_default_topics()
 
 	// EKF replay
 	add_topic("estimator_baro_bias");
+	add_optional_topic("estimator_snapshot");
 	add_topic("estimator_gnss_hgt_bias");
 	add_topic("estimator_rng_hgt_bias");
 	add_topic("estimator_ev_pos_bias");
@@ -356,6 +365,9 @@ void LoggedTopics::add_estimator_replay_topics()
 	add_topic("vehicle_visual_odometry");
 	add_topic("aux_global_position");
 	add_topic_multi("distance_sensor");
+
+	// EKF2 state snapshots (EKF2_SNAP_INT) to start a replay in the middle of the log
+	add_optional_topic("estimator_snapshot");
 }
 
 void LoggedTopics::add_thermal_calibration_topics()
@@ -372,6 +384,7 @@ void LoggedTopics::add_sensor_comparison_topics()
 	add_topic_multi("sensor_baro", 100, 4);
 	add_topic_multi("sensor_gyro", 100, 4);
 	add_topic_multi("sensor_mag", 100, 4);
+	add_optional_topic_multi("sensor_mag_fifo", 0, 4);
 }
 
 void LoggedTopics::add_vision_and_avoidance_topics()
@@ -407,7 +420,7 @@ void LoggedTopics::add_mavlink_tunnel()
 	add_topic("mavlink_tunnel");
 }
 
-int LoggedTopics::add_topics_from_file(const char *fname)
+int LoggedTopics::add_topics_from_file(const char *fname, bool mavlink)
 {
 	int ntopics = 0;
 
@@ -446,6 +459,17 @@ int LoggedTopics::add_topics_from_file(const char *fname)
 				topic_name[name_len - 1] = '\0';
 			}
 
+			if (mavlink) {
+				if (add_mavlink_topic(topic_name, interval_ms, (nfields > 2) ? (int)instance : -1)) {
+					ntopics++;
+
+				} else {
+					PX4_ERR("Failed to add topic %s", topic_name);
+				}
+
+				continue;
+			}
+
 			/* add topic with specified interval_ms */
 			if ((nfields > 2 && add_topic(topic_name, interval_ms, instance))
 			    || add_topic_multi(topic_name, interval_ms)) {
@@ -501,6 +525,7 @@ bool LoggedTopics::add_topic(const orb_metadata *topic, uint16_t interval_ms, ui
 	RequestedSubscription &sub = _subscriptions.sub[_subscriptions.count++];
 	sub.interval_ms = interval_ms;
 	sub.instance = instance;
+	sub.priority = _priority;
 	sub.id = static_cast<ORB_ID>(topic->o_id);
 	return true;
 }
@@ -525,6 +550,7 @@ bool LoggedTopics::add_topic(const char *name, uint16_t interval_ms, uint8_t ins
 						  topics[i]->o_name, instance, interval_ms);
 
 					_subscriptions.sub[j].interval_ms = interval_ms;
+					_subscriptions.sub[j].priority = _priority;
 					success = true;
 					already_added = true;
 					break;
@@ -567,9 +593,69 @@ bool LoggedTopics::initialize_logged_topics(SDLogProfileMask profile)
 		initialize_configured_topics(profile);
 	}
 
+	set_critical_topics();
+
 	return _subscriptions.count > 0;
 }
 
+bool LoggedTopics::initialize_mavlink_topics()
+{
+	// select from all topics by default
+	for (int i = 0; i < _subscriptions.count; ++i) {
+		_subscriptions.sub[i].mavlink = false;
+	}
+
+	int ntopics = add_topics_from_file(PX4_STORAGEDIR "/etc/logging/logger_topics_mavlink.txt", true);
+
+	if (ntopics > 0) {
+		PX4_INFO("streaming %d topics from logger_topics_mavlink.txt", ntopics);
+		return true;
+	}
+
+	for (int i = 0; i < _subscriptions.count; ++i) {
+		_subscriptions.sub[i].mavlink = true;
+		_subscriptions.sub[i].mavlink_interval_ms = 0;
+	}
+
+	return false;
+}
+
+bool LoggedTopics::add_mavlink_topic(const char *name, uint16_t interval_ms, int instance)
+{
+	bool found = false;
+
+	for (int i = 0; i < _subscriptions.count; ++i) {
+		RequestedSubscription &sub = _subscriptions.sub[i];
+
+		if ((strcmp(get_orb_meta(sub.id)->o_name, name) == 0) && (instance < 0 || sub.instance == instance)) {
+			sub.mavlink = true;
+			sub.mavlink_interval_ms = interval_ms;
+			found = true;
+		}
+	}
+
+	if (!found) {
+		// not logged to file, add it for the stream only
+		const int first = _subscriptions.count;
+
+		if (instance >= 0) {
+			add_topic(name, interval_ms, instance);
+
+		} else {
+			add_topic_multi(name, interval_ms);
+		}
+
+		for (int i = first; i < _subscriptions.count; ++i) {
+			_subscriptions.sub[i].file = false;
+			_subscriptions.sub[i].mavlink = true;
+			_subscriptions.sub[i].mavlink_interval_ms = 0; // subscription interval already limits the rate
+			found = true;
+		}
+	}
+
+	return found;
+}
+
 void LoggedTopics::initialize_configured_topics(SDLogProfileMask profile)
 {
 	// load appropriate topics for profile
@@ -590,6 +676,13 @@ void LoggedTopics::initialize_configured_topics(SDLogProfileMask profile)
 		add_system_identification_topics();
 	}
 
+	if (profile & SDLogProfileMask::VISION_AND_AVOIDANCE) {
+		add_vision_and_avoidance_topics();
+	}
+
+	// the following profiles add (mostly high-rate) topics that are the first to be decimated under buffer pressure
+	_priority = TopicPriority::BestEffort;
+
 	if (profile & SDLogProfileMask::HIGH_RATE) {
 		add_high_rate_topics();
 	}
@@ -602,10 +695,6 @@ void LoggedTopics::initialize_configured_topics(SDLogProfileMask profile)
 		add_sensor_comparison_topics();
 	}
 
-	if (profile & SDLogProfileMask::VISION_AND_AVOIDANCE) {
-		add_vision_and_avoidance_topics();
-	}
-
 	if (profile & SDLogProfileMask::RAW_IMU_GYRO_FIFO) {
 		add_raw_imu_gyro_fifo();
 	}
@@ -617,4 +706,31 @@ void LoggedTopics::initialize_configured_topics(SDLogProfileMask profile)
 	if (profile & SDLogProfileMask::MAVLINK_TUNNEL) {
 		add_mavlink_tunnel();
 	}
+
+	_priority = TopicPriority::Normal;
+}
+
+void LoggedTopics::set_critical_topics()
+{
+	static constexpr ORB_ID critical_topics[] {
+		ORB_ID::actuator_armed,
+		ORB_ID::actuator_motors,
+		ORB_ID::actuator_outputs,
+		ORB_ID::actuator_servos,
+		ORB_ID::battery_status,
+		ORB_ID::failsafe_flags,
+		ORB_ID::failure_detector_status,
+		ORB_ID::vehicle_command,
+		ORB_ID::vehicle_command_ack,
+		ORB_ID::vehicle_land_detected,
+		ORB_ID::vehicle_status,
+	};
+
+	for (int i = 0; i < _subscriptions.count; ++i) {
+		for (const ORB_ID id : critical_topics) {
+			if (_subscriptions.sub[i].id == id) {
+				_subscriptions.sub[i].priority = TopicPriority::Critical;
+			}
+		}
+	}
 }
@@ -63,6 +63,16 @@ enum class MissionLogType : int32_t {
 	Geotagging =             2
 };
 
+/**
+ * @enum TopicPriority
+ * Under log buffer pressure, lower priority topics are decimated and dropped first
+ */
+enum class TopicPriority : uint8_t {
+	Critical = 0, //!< never decimated (e.g. vehicle_status, actuator outputs, failsafe topics)
+	Normal,       //!< default
+	BestEffort,   //!< high-rate topics of the optional profiles, decimated first
+};
+
 inline bool operator&(SDLogProfileMask a, SDLogProfileMask b)
 {
 	return static_cast<int32_t>(a) & static_cast<int32_t>(b);
@@ -82,7 +92,11 @@ public:
 	struct RequestedSubscription {
 		uint16_t interval_ms;
 		uint8_t instance;
+		TopicPriority priority{TopicPriority::Normal};
 		ORB_ID id{ORB_ID::INVALID};
+		bool file{true};               ///< written to the log file
+		bool mavlink{true};            ///< streamed over mavlink
+		uint16_t mavlink_interval_ms{0}; ///< additional rate limit of the mavlink stream
 	};
 	struct RequestedSubscriptionArray {
 		RequestedSubscription sub[MAX_TOPICS_NUM];
@@ -103,6 +117,14 @@ public:
 
 	bool initialize_logged_topics(SDLogProfileMask profile);
 
+	/**
+	 * Select the topics streamed over mavlink from logger_topics_mavlink.txt, topics that are not logged
+	 * to file are added for the stream only. Without the file all logged topics are streamed.
+	 * Must be called after initialize_logged_topics().
+	 * @return true if a topic selection for the mavlink stream is configured
+	 */
+	bool initialize_mavlink_topics();
+
 	const RequestedSubscriptionArray &subscriptions() const { return _subscriptions; }
 	int numMissionSubscriptions() const { return _num_mission_subs; }
 
@@ -146,9 +168,19 @@ private:
 	/**
 	 * Parse a file containing a list of uORB topics to log, calling add_topic for each
 	 * @param fname name of file
+	 * @param mavlink if true, select the topics for the mavlink stream with add_mavlink_topic() instead
 	 * @return number of topics added
 	 */
-	int add_topics_from_file(const char *fname);
+	int add_topics_from_file(const char *fname, bool mavlink = false);
+
+	/**
+	 * Select a topic for the mavlink stream
+	 * @param name topic name
+	 * @param interval limit in milliseconds if >0, otherwise stream as fast as the topic is logged.
+	 * @param instance orb topic instance, -1 for all instances
+	 * @return true on success
+	 */
+	bool add_mavlink_topic(const char *name, uint16_t interval_ms, int instance);
 
 	/**
 	 * Add a topic to be logged for the mission log (it's also added to the full log).
@@ -164,6 +196,11 @@ private:
 	 */
 	void initialize_configured_topics(SDLogProfileMask profile);
 
+	/**
+	 * Set the priority of all added topics that must never be dropped to TopicPriority::Critical
+	 */
+	void set_critical_topics();
+
 	void add_default_topics();
 	void add_estimator_replay_topics();
 	void add_thermal_calibration_topics();
@@ -185,6 +222,7 @@ private:
 	RequestedSubscriptionArray _subscriptions;
 	int _num_mission_subs{0};
 	float _rate_factor{1.0f};
+	TopicPriority _priority{TopicPriority::Normal}; ///< priority of topics added next
 };
 
 } //namespace logger
@@ -32,6 +32,7 @@
  ****************************************************************************/
 
 #include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/boot_trace.h>
 #include <px4_platform_common/console_buffer.h>
 #include "logged_topics.h"
 #include "logger.h"
@@ -217,6 +218,17 @@ int Logger::print_status()
 		PX4_INFO("Not logging");
 	}
 
+	if (_writer.backend() & LogWriter::BackendFile) {
+		PX4_INFO("Log storage: %i dirs, %u MiB of logs, %u MiB free", _log_retention.num_log_dirs(),
+			 (unsigned int)(_log_retention.logs_size() / 1024U / 1024U),
+			 (unsigned int)(_log_retention.free_space() / 1024U / 1024U));
+	}
+
+#if defined(CONFIG_LOGGER_DEFINITIONS_CACHE)
+	PX4_INFO("Definitions cache: %u bytes (%s)", (unsigned int)_definitions_cache.size(),
+		 _definitions_cache.valid(param_count_used()) ? "valid" : "outdated");
+#endif
+
 	return 0;
 }
 
@@ -244,6 +256,11 @@ void Logger::print_statistics(LogType type)
 
 	PX4_INFO("Since last status: dropouts: %zu (max len: %.3f s), max used buffer: %zu / %zu B",
 		 stats.write_dropouts, (double)stats.max_dropout_duration, stats.high_water, _writer.get_buffer_size_file(type));
+	if (type == LogType::Full) {
+		PX4_INFO("Degradation level: %" PRIu8 ", decimated messages: %zu", _degradation_level, stats.messages_decimated);
+	}
+
+	_writer.print_write_latency_file(type);
 	stats.high_water = 0;
 	stats.write_dropouts = 0;
 	stats.max_dropout_duration = 0.f;
@@ -415,6 +432,8 @@ Logger::~Logger()
 	}
 
 	delete[](_msg_buffer);
+	delete[](_rate_buckets);
+	delete[](_rate_bucket_subs);
 	delete[](_subscriptions);
 }
 
@@ -428,6 +447,10 @@ void Logger::update_params()
 
 		// update parameters from storage
 		ModuleParams::updateParams();
+
+#if defined(CONFIG_LOGGER_DEFINITIONS_CACHE)
+		_definitions_cache.invalidate();
+#endif
 	}
 }
 
@@ -464,6 +487,9 @@ bool Logger::copy_if_updated(int sub_idx, void *buffer, bool try_to_subscribe)
 
 	} else if (try_to_subscribe) {
 		if (sub.subscribe()) {
+			// its bucket might not be checked anymore
+			_rate_buckets[sub.rate_bucket].next_due = 0;
+
 			write_add_logged_msg(LogType::Full, sub);
 
 			if (sub_idx < _num_mission_subs) {
@@ -530,6 +556,8 @@ bool Logger::initialize_topics()
 		return false;
 	}
 
+	_mavlink_topics_configured = (_writer.backend() & LogWriter::BackendMavlink) && logged_topics.initialize_mavlink_topics();
+
 	if ((sdlog_profile & SDLogProfileMask::RAW_IMU_ACCEL_FIFO) || (sdlog_profile & SDLogProfileMask::RAW_IMU_GYRO_FIFO)) {
 		// if we are logging high-rate FIFO, reduce the logging interval & increase process priority to avoid missing samples
 		PX4_INFO("Logging FIFO data: increasing task prio and logging rate");
@@ -560,12 +588,69 @@ bool Logger::initialize_topics()
 
 		for (int i = 0; i < logged_topics.subscriptions().count; ++i) {
 			const LoggedTopics::RequestedSubscription &sub = logged_topics.subscriptions().sub[i];
-			_subscriptions[i] = LoggerSubscription(sub.id, sub.interval_ms, sub.instance);
+			_subscriptions[i] = LoggerSubscription(sub.id, sub.interval_ms, sub.instance, sub.priority);
+			_subscriptions[i].file = sub.file;
+			_subscriptions[i].mavlink = sub.mavlink;
+			_subscriptions[i].mavlink_interval_ms = sub.mavlink_interval_ms;
 			_subscriptions[i].subscribe();
 		}
 	}
 
 	_num_subscriptions = logged_topics.subscriptions().count;
+	return initialize_rate_buckets();
+}
+
+bool Logger::initialize_rate_buckets()
+{
+	delete[](_rate_buckets);
+	_rate_buckets = nullptr;
+	delete[](_rate_bucket_subs);
+	_rate_bucket_subs = nullptr;
+	_num_rate_buckets = 0;
+
+	if (_num_subscriptions == 0) {
+		return true;
+	}
+
+	_rate_buckets = new RateBucket[_num_subscriptions];
+	_rate_bucket_subs = new uint8_t[_num_subscriptions];
+
+	if (!_rate_buckets || !_rate_bucket_subs) {
+		PX4_ERR("alloc failed");
+		return false;
+	}
+
+	// one bucket per distinct interval
+	for (int i = 0; i < _num_subscriptions; ++i) {
+		const uint32_t interval_us = _subscriptions[i].get_interval_us();
+		int bucket_idx = 0;
+
+		while (bucket_idx < _num_rate_buckets && _rate_buckets[bucket_idx].interval_us != interval_us) {
+			++bucket_idx;
+		}
+
+		if (bucket_idx == _num_rate_buckets) {
+			_rate_buckets[bucket_idx] = RateBucket{interval_us, 0, 0, 0};
+			++_num_rate_buckets;
+		}
+
+		_subscriptions[i].rate_bucket = bucket_idx;
+		++_rate_buckets[bucket_idx].count;
+	}
+
+	uint16_t first = 0;
+
+	for (int bucket_idx = 0; bucket_idx < _num_rate_buckets; ++bucket_idx) {
+		_rate_buckets[bucket_idx].first = first;
+		first += _rate_buckets[bucket_idx].count;
+		_rate_buckets[bucket_idx].count = 0;
+	}
+
+	for (int i = 0; i < _num_subscriptions; ++i) {
+		RateBucket &bucket = _rate_buckets[_subscriptions[i].rate_bucket];
+		_rate_bucket_subs[bucket.first + bucket.count++] = i;
+	}
+
 	return true;
 }
 
@@ -587,10 +672,9 @@ void Logger::run()
 			}
 		}
 
-		if (util::check_free_space(LOG_ROOT[(int)LogType::Full], _param_sdlog_dirs_max.get(), _mavlink_log_pub,
-					   _file_name[(int)LogType::Full].sess_dir_index) == 1) {
-			return;
-		}
+		// old logs are removed in the background, so that this does not delay the start of logging
+		_file_name[(int)LogType::Full].sess_dir_index = util::get_next_sess_dir_index(LOG_ROOT[(int)LogType::Full]);
+		_log_retention.start(LOG_ROOT[(int)LogType::Full], _param_sdlog_dirs_max.get());
 	}
 
 	uORB::Subscription parameter_update_sub(ORB_ID(parameter_update));
@@ -735,6 +819,10 @@ void Logger::run()
 				}
 			}
 
+			if (!_should_stop_file_log && should_rotate_log_file(loop_time)) {
+				rotate_log_file();
+			}
+
 			/* Check if parameters have changed */
 			if (!_should_stop_file_log) { // do not record param changes after disarming
 				if (parameter_update_sub.updated()) {
@@ -749,51 +837,34 @@ void Logger::run()
 			/* wait for lock on log buffer */
 			_writer.lock();
 
-			for (int sub_idx = 0; sub_idx < _num_subscriptions; ++sub_idx) {
-				LoggerSubscription &sub = _subscriptions[sub_idx];
-				/* if this topic has been updated, copy the new data into the message buffer
-				 * and write a message to the log
-				 */
-				const bool try_to_subscribe = (sub_idx == next_subscribe_topic_index);
+			update_degradation_level();
 
-				if (copy_if_updated(sub_idx, _msg_buffer + sizeof(ulog_message_data_s), try_to_subscribe)) {
-					// each message consists of a header followed by an orb data object
-					const size_t msg_size = sizeof(ulog_message_data_s) + sub.get_topic()->o_size_no_padding;
-					const uint16_t write_msg_size = static_cast<uint16_t>(msg_size - ULOG_MSG_HEADER_LEN);
-					const uint16_t write_msg_id = sub.msg_id;
+			for (int bucket_idx = 0; bucket_idx < _num_rate_buckets; ++bucket_idx) {
+				RateBucket &bucket = _rate_buckets[bucket_idx];
 
-					//write one byte after another (necessary because of alignment)
-					_msg_buffer[0] = (uint8_t)write_msg_size;
-					_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
-					_msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::DATA);
-					_msg_buffer[3] = (uint8_t)write_msg_id;
-					_msg_buffer[4] = (uint8_t)(write_msg_id >> 8);
+				// skip the whole bucket if none of its subscriptions can be updated yet
+				if (loop_time < bucket.next_due) {
+					continue;
+				}
 
-					// PX4_INFO("topic: %s, size = %zu, out_size = %zu", sub.get_topic()->o_name, sub.get_topic()->o_size, msg_size);
+				hrt_abstime next_due = UINT64_MAX;
 
-					// full log
-					if (write_message(LogType::Full, _msg_buffer, msg_size)) {
+				for (int i = bucket.first; i < bucket.first + bucket.count; ++i) {
+					const int sub_idx = _rate_bucket_subs[i];
+					LoggerSubscription &sub = _subscriptions[sub_idx];
 
-#ifdef DBGPRINT
-						total_bytes += msg_size;
-#endif /* DBGPRINT */
+					// topics that are not subscribed yet are handled below
+					if (sub.valid()) {
+						handle_subscription_update(sub_idx, false, loop_time, total_bytes);
+						next_due = math::min(next_due, sub.get_last_update() + sub.get_interval_us());
 					}
+				}
 
-					// mission log
-					if (sub_idx < _num_mission_subs) {
-						if (_writer.is_started(LogType::Mission)) {
-							if (_mission_subscriptions[sub_idx].next_write_time < (loop_time / 100000)) {
-								unsigned delta_time = _mission_subscriptions[sub_idx].min_delta_ms;
-
-								if (delta_time > 0) {
-									_mission_subscriptions[sub_idx].next_write_time = (loop_time / 100000) + delta_time / 100;
-								}
+				bucket.next_due = next_due;
+			}
 
-								write_message(LogType::Mission, _msg_buffer, msg_size);
-							}
-						}
-					}
-				}
+			if (next_subscribe_topic_index >= 0 && !_subscriptions[next_subscribe_topic_index].valid()) {
+				handle_subscription_update(next_subscribe_topic_index, true, loop_time, total_bytes);
 			}
 
 			// check for new events
@@ -890,6 +961,16 @@ void Logger::run()
 				next_subscribe_topic_index = 0;
 			}
 
+#if defined(CONFIG_LOGGER_DEFINITIONS_CACHE)
+
+			// prepare the definitions for the next log start (after boot and parameter changes)
+			if (loop_time > _definitions_cache_next_check) {
+				_definitions_cache_next_check = loop_time + 1_s;
+				update_definitions_cache();
+			}
+
+#endif
+
 			was_started = false;
 		}
 
@@ -972,6 +1053,192 @@ void Logger::debug_print_buffer(uint32_t &total_bytes, hrt_abstime &timer_start)
 #endif /* DBGPRINT */
 }
 
+bool Logger::can_write_in_place(int sub_idx) const
+{
+	// the message must only go to the full log file (and there must be no pending dropout message)
+	return _subscriptions[sub_idx].file
+	       && !_writer.is_started(LogType::Full, LogWriter::BackendMavlink)
+	       && (sub_idx >= _num_mission_subs || !_writer.is_started(LogType::Mission))
+	       && _statistics[(int)LogType::Full].dropout_start == 0;
+}
+
+#if defined(CONFIG_LOGGER_DELTA_ENCODING)
+bool Logger::can_write_delta() const
+{
+	// with a separate topic selection for the mavlink stream, the file is written on its own
+	return !_writer.is_started(LogType::Full, LogWriter::BackendMavlink) || _mavlink_topics_configured;
+}
+#endif
+
+void Logger::write_data_header(uint8_t *buffer, size_t msg_size, uint16_t msg_id)
+{
+	const uint16_t write_msg_size = static_cast<uint16_t>(msg_size - ULOG_MSG_HEADER_LEN);
+
+	//write one byte after another (necessary because of alignment)
+	buffer[0] = (uint8_t)write_msg_size;
+	buffer[1] = (uint8_t)(write_msg_size >> 8);
+	buffer[2] = static_cast<uint8_t>(ULogMessageType::DATA);
+	buffer[3] = (uint8_t)msg_id;
+	buffer[4] = (uint8_t)(msg_id >> 8);
+}
+
+void Logger::handle_subscription_update(int sub_idx, bool try_to_subscribe, hrt_abstime loop_time,
+		uint32_t &total_bytes)
+{
+	LoggerSubscription &sub = _subscriptions[sub_idx];
+
+	// each message consists of a header followed by an orb data object
+	const size_t msg_size = sizeof(ulog_message_data_s) + sub.get_topic()->o_size_no_padding;
+
+	if (!try_to_subscribe && can_write_in_place(sub_idx)) {
+		// copy the data directly into the write buffer. orb_copy() writes o_size bytes (including padding),
+		// of which only msg_size are committed.
+		uint8_t *buffer = _writer.reserve_message_file(LogType::Full, sizeof(ulog_message_data_s) + sub.get_topic()->o_size);
+
+		if (buffer) {
+			if (copy_if_updated(sub_idx, buffer + sizeof(ulog_message_data_s), false)) {
+				if (should_write_under_pressure(sub)) {
+					uint64_t timestamp;
+					memcpy(&timestamp, buffer + sizeof(ulog_message_data_s), sizeof(timestamp));
+
+					size_t write_size = 0;
+					bool keyframe = true;
+
+#if defined(CONFIG_LOGGER_DELTA_ENCODING)
+
+					if (_log_delta.enabled()) {
+						write_size = _log_delta.encode(sub_idx, sub.msg_id, buffer + sizeof(ulog_message_data_s), keyframe);
+						_log_delta.written(sub_idx, buffer + sizeof(ulog_message_data_s), keyframe);
+
+						if (write_size > 0) {
+							// the encoded message is never larger than the full one
+							memcpy(buffer, _log_delta.message(), write_size);
+						}
+					}
+
+#endif
+
+					const uint64_t file_offset = _writer.get_write_offset_file(LogType::Full);
+
+					if (write_size == 0) {
+						write_data_header(buffer, msg_size, sub.msg_id);
+						write_size = msg_size;
+					}
+
+					if (keyframe) {
+						_log_index.add(sub.msg_id, timestamp, file_offset);
+					}
+
+					_writer.commit_message_file(LogType::Full, write_size);
+
+#ifdef DBGPRINT
+					total_bytes += write_size;
+#endif /* DBGPRINT */
+
+				} else {
+					_statistics[(int)LogType::Full].messages_decimated++;
+				}
+			}
+
+			return;
+		}
+	}
+
+	/* if this topic has been updated, copy the new data into the message buffer
+	 * and write a message to the log
+	 */
+	if (copy_if_updated(sub_idx, _msg_buffer + sizeof(ulog_message_data_s), try_to_subscribe)) {
+		write_data_header(_msg_buffer, msg_size, sub.msg_id);
+
+		// PX4_INFO("topic: %s, size = %zu, out_size = %zu", sub.get_topic()->o_name, sub.get_topic()->o_size, msg_size);
+
+		// full log, with a topic selection for the mavlink stream the file is written separately
+		if (_mavlink_topics_configured) {
+			_writer.select_write_backend(LogWriter::BackendFile);
+		}
+
+		if (!sub.file) {
+			// only streamed over mavlink
+
+		} else if (!should_write_under_pressure(sub)) {
+			_statistics[(int)LogType::Full].messages_decimated++;
+
+		} else {
+			const uint64_t file_offset = _writer.get_write_offset_file(LogType::Full);
+			const uint8_t *payload = _msg_buffer + sizeof(ulog_message_data_s);
+			size_t delta_size = 0;
+
+#if defined(CONFIG_LOGGER_DELTA_ENCODING)
+
+			bool keyframe = true;
+
+			if (_log_delta.enabled() && can_write_delta()) {
+				delta_size = _log_delta.encode(sub_idx, sub.msg_id, payload, keyframe);
+			}
+
+			if (delta_size > 0 && write_message(LogType::Full, _log_delta.message(), delta_size)) {
+				_log_delta.written(sub_idx, payload, keyframe);
+
+				if (keyframe) {
+					uint64_t timestamp;
+					memcpy(&timestamp, payload, sizeof(timestamp));
+					_log_index.add(sub.msg_id, timestamp, file_offset);
+				}
+
+#ifdef DBGPRINT
+				total_bytes += delta_size;
+#endif /* DBGPRINT */
+			}
+
+#endif
+
+			if (delta_size == 0 && write_message(LogType::Full, _msg_buffer, msg_size)) {
+				uint64_t timestamp;
+				memcpy(&timestamp, payload, sizeof(timestamp));
+				_log_index.add(sub.msg_id, timestamp, file_offset);
+
+#if defined(CONFIG_LOGGER_DELTA_ENCODING)
+				// keep the reference in sync when the data is written in full
+				_log_delta.written(sub_idx, payload, true);
+#endif
+
+#ifdef DBGPRINT
+				total_bytes += msg_size;
+#endif /* DBGPRINT */
+			}
+		}
+
+		if (_mavlink_topics_configured) {
+			_writer.unselect_write_backend();
+
+			// the stream has its own rate limit and does not affect the file log statistics
+			if (sub.mavlink && (loop_time >= sub.mavlink_next_write)
+			    && _writer.is_started(LogType::Full, LogWriter::BackendMavlink)) {
+				sub.mavlink_next_write = loop_time + sub.mavlink_interval_ms * 1000;
+
+				_writer.select_write_backend(LogWriter::BackendMavlink);
+				_writer.write_message(LogType::Full, _msg_buffer, msg_size);
+				_writer.unselect_write_backend();
+			}
+		}
+
+		// mission log
+		if (sub_idx < _num_mission_subs) {
+			if (_writer.is_started(LogType::Mission)) {
+				if (_mission_subscriptions[sub_idx].next_write_time < (loop_time / 100000)) {
+					unsigned delta_time = _mission_subscriptions[sub_idx].min_delta_ms;
+
+					if (delta_time > 0) {
+						_mission_subscriptions[sub_idx].next_write_time = (loop_time / 100000) + delta_time / 100;
+					}
+
+					write_message(LogType::Mission, _msg_buffer, msg_size);
+				}
+			}
+		}
+	}
+}
+
 bool Logger::handle_event_updates(uint32_t &total_bytes)
 {
 	bool data_written = false;
@@ -1002,7 +1269,12 @@ bool Logger::handle_event_updates(uint32_t &total_bytes)
 			_msg_buffer[4] = (uint8_t)(write_msg_id >> 8);
 
 			// full log
+			const uint64_t file_offset = _writer.get_write_offset_file(LogType::Full);
+
 			if (write_message(LogType::Full, _msg_buffer, msg_size)) {
+				uint64_t timestamp;
+				memcpy(&timestamp, &orb_event->timestamp, sizeof(timestamp));
+				_log_index.add(write_msg_id, timestamp, file_offset);
 
 #ifdef DBGPRINT
 				total_bytes += msg_size;
@@ -1059,6 +1331,9 @@ void Logger::publish_logger_status()
 				status.message_gaps = _message_gaps;
 				status.buffer_used_bytes = buffer_fill_count_file;
 				status.buffer_size_bytes = _writer.get_buffer_size_file(log_type);
+				status.degradation_level = _statistics[i].max_degradation_level;
+				status.messages_decimated = _statistics[i].messages_decimated;
+				_statistics[i].max_degradation_level = (log_type == LogType::Full) ? _degradation_level : 0;
 			}
 
 			_logger_status_pub[i].publish(status);
@@ -1086,6 +1361,10 @@ void Logger::adjust_subscription_updates()
 			++j;
 		}
 	}
+
+	for (int i = 0; i < _num_rate_buckets; ++i) {
+		_rate_buckets[i].next_due = 0;
+	}
 }
 
 bool Logger::get_disable_boot_logging()
@@ -1198,8 +1477,93 @@ void Logger::handle_vehicle_command_update()
 	}
 }
 
+void Logger::update_degradation_level()
+{
+	uint8_t level = 0;
+
+	const size_t buffer_size = _writer.get_buffer_size_file(LogType::Full);
+
+	if (buffer_size > 0 && _writer.is_started(LogType::Full, LogWriter::BackendFile)) {
+		const size_t fill = _writer.get_buffer_fill_count_file(LogType::Full);
+
+		if (fill * 10 >= buffer_size * 9) {
+			level = 3;
+
+		} else if (fill * 4 >= buffer_size * 3) {
+			level = 2;
+
+		} else if (fill * 2 >= buffer_size) {
+			level = 1;
+		}
+	}
+
+	if (_load_shedding_sub.updated()) {
+		load_shedding_s load_shedding;
+
+		if (_load_shedding_sub.copy(&load_shedding)) {
+			const bool shed = load_shedding.shed & load_shedding_s::SHED_LOGGER;
+
+			if (shed != _load_shedding) {
+				PX4_INFO("load shedding: %s topic rates", shed ? "reducing" : "restoring");
+				_load_shedding = shed;
+			}
+		}
+	}
+
+	if (_load_shedding) {
+		level = math::max(level, (uint8_t)2);
+	}
+
+	_degradation_level = level;
+
+	Statistics &stats = _statistics[(int)LogType::Full];
+
+	if (level > stats.max_degradation_level) {
+		stats.max_degradation_level = level;
+	}
+}
+
+bool Logger::should_write_under_pressure(LoggerSubscription &sub)
+{
+	switch (sub.priority) {
+	case TopicPriority::Critical:
+		return true;
+
+	case TopicPriority::Normal:
+		if (_degradation_level >= 3) {
+			return false;
+
+		} else if (_degradation_level == 2) {
+			return (++sub.decimation_count & 1) == 0;
+		}
+
+		return true;
+
+	case TopicPriority::BestEffort:
+		if (_degradation_level >= 2) {
+			return false;
+
+		} else if (_degradation_level == 1) {
+			return (++sub.decimation_count & 1) == 0;
+		}
+
+		return true;
+	}
+
+	return true;
+}
+
 bool Logger::write_message(LogType type, void *ptr, size_t size)
 {
+#if defined(CONFIG_LOGGER_DEFINITIONS_CACHE)
+
+	if (_definitions_cache.capturing()) {
+		_definitions_cache.append(ptr, size);
+		return true;
+	}
+
+#endif
+
 	Statistics &stats = _statistics[(int)type];
 
 	if (_writer.write_message(type, ptr, size, stats.dropout_start) != -1) {
@@ -1287,6 +1651,21 @@ int Logger::create_log_dir(LogType type, tm *tt, char *log_dir, int log_dir_len)
 	return strlen(log_dir);
 }
 
+#if defined(CONFIG_LOGGER_COMPRESSION)
+bool Logger::log_compression_enabled()
+{
+#if defined(PX4_CRYPTO)
+
+	if (_param_sdlog_crypto_algorithm.get() != 0) {
+		return false;
+	}
+
+#endif
+
+	return _param_sdlog_compress.get();
+}
+#endif
+
 int Logger::get_log_file_name(LogType type, char *file_name, size_t file_name_size, bool notify)
 {
 	tm tt = {};
@@ -1303,11 +1682,18 @@ int Logger::get_log_file_name(LogType type, char *file_name, size_t file_name_si
 		replay_suffix = "_replayed";
 	}
 
-	const char *crypto_suffix = "";
+	const char *file_suffix = "";
 #if defined(PX4_CRYPTO)
 
 	if (_param_sdlog_crypto_algorithm.get() != 0) {
-		crypto_suffix = "c";
+		file_suffix = "c";
+	}
+
+#endif
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+	if (type == LogType::Full && log_compression_enabled()) {
+		file_suffix = "z";
 	}
 
 #endif
@@ -1324,7 +1710,7 @@ int Logger::get_log_file_name(LogType type, char *file_name, size_t file_name_si
 		char log_file_name_time[16] = "";
 		strftime(log_file_name_time, sizeof(log_file_name_time), "%H_%M_%S", &tt);
 		snprintf(log_file_name, sizeof(LogFileName::log_file_name), "%s%s.ulg%s", log_file_name_time, replay_suffix,
-			 crypto_suffix);
+			 file_suffix);
 		snprintf(file_name + n, file_name_size - n, "/%s", log_file_name);
 
 		if (notify) {
@@ -1355,7 +1741,7 @@ int Logger::get_log_file_name(LogType type, char *file_name, size_t file_name_si
 		while (file_number <= MAX_NO_LOGFILE) {
 			/* format log file path: e.g. /fs/microsd/log/sess001/log001.ulg */
 			snprintf(log_file_name, sizeof(LogFileName::log_file_name), "log%03" PRIu16 "%s.ulg%s", file_number, replay_suffix,
-				 crypto_suffix);
+				 file_suffix);
 			snprintf(file_name + n, file_name_size - n, "/%s", log_file_name);
 
 			if (!util::file_exist(file_name)) {
@@ -1404,6 +1790,18 @@ void Logger::start_log_file(LogType type)
 		initialize_load_output(PrintLoadReason::Preflight);
 	}
 
+	if (type == LogType::Full && _log_retention.storage_full()) {
+		const uint32_t free_mib = _log_retention.free_space() / 1024U / 1024U;
+		mavlink_log_critical(&_mavlink_log_pub, "[logger] Not logging; SD almost full: %u MiB\t", (unsigned int)free_mib);
+		/* EVENT
+		 * @description Either manually free up some space, or enable automatic log rotation
+		 * via <param>SDLOG_DIRS_MAX</param>.
+		 */
+		events::send<uint32_t>(events::ID("logger_storage_full"), events::Log::Error,
+				       "Not logging, storage is almost full: {1} MiB", free_mib);
+		return;
+	}
+
 	PX4_INFO("Start file log (type: %s)", log_type_str(type));
 	_statistics[(int) type].start_time_file = 0;
 
@@ -1421,19 +1819,42 @@ void Logger::start_log_file(LogType type)
 		_param_sdlog_crypto_exchange_key.get());
 #endif
 
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	_writer.set_compression(log_compression_enabled());
+#endif
+
+#if defined(CONFIG_LOGGER_DELTA_ENCODING)
+	const bool delta_data = type == LogType::Full && _param_sdlog_delta_kf.get() > 0;
+#else
+	const bool delta_data = false;
+#endif
+
 	if (_writer.start_log_file(type, file_name)) {
 		_writer.select_write_backend(LogWriter::BackendFile);
 		_writer.set_need_reliable_transfer(true);
 
-		write_header(type);
+		write_header(type, delta_data);
 		write_version(type);
-		write_formats(type);
+
+#if defined(CONFIG_LOGGER_DEFINITIONS_CACHE)
+		const bool definitions_written = (type == LogType::Full) && write_definitions_cache();
+#else
+		const bool definitions_written = false;
+#endif
+
+		if (!definitions_written) {
+			write_formats(type);
+
+			if (type == LogType::Full) {
+				write_parameters(type);
+				write_parameter_defaults(type);
+			}
+		}
 
 		if (type == LogType::Full) {
-			write_parameters(type);
-			write_parameter_defaults(type);
 			write_perf_data(PrintLoadReason::Preflight);
 			write_console_output();
+			write_boot_trace();
 			write_events_file(LogType::Full);
 			write_excluded_optional_topics(type);
 		}
@@ -1443,12 +1864,39 @@ void Logger::start_log_file(LogType type)
 		_writer.unselect_write_backend();
 		_writer.notify();
 
+#if defined(CONFIG_LOGGER_DELTA_ENCODING)
+
+		if (delta_data) {
+			start_log_delta();
+		}
+
+#endif
+
 		if (type == LogType::Full) {
 			/* reset performance counters to get in-flight min and max values in post flight log */
 			perf_reset_all();
 		}
 
 		_statistics[(int) type].start_time_file = hrt_absolute_time();
+		_statistics[(int) type].messages_decimated = 0;
+
+		if (type == LogType::Full) {
+			const LogFileName &log_file_name = _file_name[(int)LogType::Full];
+			_log_retention.request(log_file_name.log_dir, log_file_name.log_file_name);
+
+			// offsets refer to the uncompressed and unencrypted file
+			bool index = _param_sdlog_idx_int.get() > 0;
+#if defined(PX4_CRYPTO)
+			index = index && _param_sdlog_crypto_algorithm.get() == 0;
+#endif
+#if defined(CONFIG_LOGGER_COMPRESSION)
+			index = index && !log_compression_enabled();
+#endif
+
+			if (index && !_log_index.start(_param_sdlog_idx_int.get(), _num_subscriptions + 1)) {
+				PX4_ERR("failed to allocate log index");
+			}
+		}
 	}
 
 }
@@ -1462,12 +1910,93 @@ void Logger::stop_log_file(LogType type)
 	if (type == LogType::Full) {
 		_writer.set_need_reliable_transfer(true);
 		write_perf_data(PrintLoadReason::Postflight);
+		write_index();
 		_writer.set_need_reliable_transfer(false);
+		_log_segment = 0;
+#if defined(CONFIG_LOGGER_DELTA_ENCODING)
+		_log_delta.stop();
+#endif
 	}
 
 	_writer.stop_log_file(type);
 }
 
+#if defined(CONFIG_LOGGER_DELTA_ENCODING)
+void Logger::start_log_delta()
+{
+	if (!_log_delta.start(_param_sdlog_delta_kf.get(), _num_subscriptions, _msg_buffer_len)) {
+		PX4_ERR("failed to allocate delta encoding");
+		return;
+	}
+
+	for (int i = 0; i < _num_subscriptions; ++i) {
+		if (_subscriptions[i].file && !_log_delta.add_topic(i, _subscriptions[i].get_topic())) {
+			PX4_ERR("failed to allocate delta encoding");
+			_log_delta.stop();
+			return;
+		}
+	}
+}
+#endif
+
+bool Logger::should_rotate_log_file(hrt_abstime now) const
+{
+	const hrt_abstime start_time = _statistics[(int)LogType::Full].start_time_file;
+
+	if (start_time == 0) {
+		return false;
+	}
+
+	const int32_t rot_size_mb = _param_sdlog_rot_size.get();
+	const int32_t rot_time_min = _param_sdlog_rot_time.get();
+
+	return (rot_size_mb > 0 && _writer.get_total_written_file(LogType::Full) >= (size_t)rot_size_mb * 1024 * 1024)
+	       || (rot_time_min > 0 && now - start_time >= (hrt_abstime)rot_time_min * 60_s);
+}
+
+void Logger::rotate_log_file()
+{
+	PX4_INFO("log file rotation");
+
+	const uint32_t log_segment = _log_segment + 1;
+	stop_log_file(LogType::Full);
+	start_log_file(LogType::Full);
+
+	if (!_writer.is_started(LogType::Full, LogWriter::BackendFile)) {
+		return;
+	}
+
+	_log_segment = log_segment;
+	write_info(LogType::Full, "log_segment", _log_segment);
+}
+
+void Logger::write_index()
+{
+	if (!_log_index.enabled()) {
+		return;
+	}
+
+	_writer.select_write_backend(LogWriter::BackendFile);
+	_writer.lock();
+
+	const uint64_t appended_data_offset = _writer.get_write_offset_file(LogType::Full);
+
+	LogIndex::Iterator it{};
+	ulog_message_index_s msg;
+	size_t msg_size;
+
+	while ((msg_size = _log_index.next_message(it, msg)) > 0) {
+		write_message(LogType::Full, &msg, msg_size);
+	}
+
+	_writer.set_appended_data_offset_file(LogType::Full, appended_data_offset);
+
+	_writer.unlock();
+	_writer.unselect_write_backend();
+
+	_log_index.stop();
+}
+
 void Logger::start_log_mavlink()
 {
 	if (!can_start_mavlink_log()) {
@@ -1493,6 +2022,7 @@ void Logger::start_log_mavlink()
 	write_parameter_defaults(LogType::Full);
 	write_perf_data(PrintLoadReason::Preflight);
 	write_console_output();
+	write_boot_trace();
 	write_events_file(LogType::Full);
 	write_excluded_optional_topics(LogType::Full);
 	write_all_add_logged_msg(LogType::Full);
@@ -2003,6 +2533,19 @@ void Logger::write_info_template(LogType type, const char *name, T value, const
 	_writer.unlock();
 }
 
+void Logger::write_boot_trace()
+{
+	px4_boot_trace_event_s event;
+
+	// one line per section: name, start [us], duration [us] (-1 if it did not end)
+	for (int i = 0; px4_boot_trace_get(i, &event); i++) {
+		char buffer[64];
+		snprintf(buffer, sizeof(buffer), "%s,%" PRIu64 ",%" PRIi32 "\n", event.name, event.start,
+			 (event.duration == UINT32_MAX) ? -1 : (int32_t)event.duration);
+		write_info_multiple(LogType::Full, "boot_trace", buffer, i != 0);
+	}
+}
+
 void Logger::write_excluded_optional_topics(LogType type)
 {
 	for (int i = 0; i < _num_excluded_optional_topic_ids; ++i) {
@@ -2014,7 +2557,7 @@ void Logger::write_excluded_optional_topics(LogType type)
 	}
 }
 
-void Logger::write_header(LogType type)
+void Logger::write_header(LogType type, bool delta_data)
 {
 	ulog_file_header_s header = {};
 	header.magic[0] = 'U';
@@ -2034,6 +2577,10 @@ void Logger::write_header(LogType type)
 
 	flag_bits.compat_flags[0] = ULOG_COMPAT_FLAG0_DEFAULT_PARAMETERS_MASK;
 
+	if (delta_data) {
+		flag_bits.incompat_flags[0] |= ULOG_INCOMPAT_FLAG0_DATA_DELTA_MASK;
+	}
+
 	flag_bits.msg_size = sizeof(flag_bits) - ULOG_MSG_HEADER_LEN;
 	flag_bits.msg_type = static_cast<uint8_t>(ULogMessageType::FLAG_BITS);
 
@@ -2354,6 +2901,43 @@ void Logger::write_changed_parameters(LogType type)
 	_writer.notify();
 }
 
+#if defined(CONFIG_LOGGER_DEFINITIONS_CACHE)
+void Logger::update_definitions_cache()
+{
+	if (_definitions_cache.too_small() || _definitions_cache.valid(param_count_used())) {
+		return;
+	}
+
+	// the used count is taken first, parameters marked as used meanwhile invalidate the cache again
+	const unsigned params_used = param_count_used();
+
+	if (!_definitions_cache.begin(CONFIG_LOGGER_DEFINITIONS_CACHE_SIZE)) {
+		return;
+	}
+
+	write_formats(LogType::Full);
+	write_parameters(LogType::Full);
+	write_parameter_defaults(LogType::Full);
+
+	if (!_definitions_cache.end(params_used)) {
+		PX4_WARN("definitions cache too small (%i bytes), disabled", CONFIG_LOGGER_DEFINITIONS_CACHE_SIZE);
+	}
+}
+
+bool Logger::write_definitions_cache()
+{
+	if (!_definitions_cache.valid(param_count_used())) {
+		return false;
+	}
+
+	_writer.lock();
+	write_message(LogType::Full, _definitions_cache.data(), _definitions_cache.size());
+	_writer.unlock();
+	_writer.notify();
+	return true;
+}
+#endif
+
 void Logger::write_events_file(LogType type)
 {
 	int fd = open(PX4_ROOTFSDIR "/etc/extras/all_events.json.xz", O_RDONLY);
@@ -2405,6 +2989,11 @@ It supports 2 backends:
 
 Both backends can be enabled and used at the same time.
 
+By default the MAVLink stream contains the same topics as the file. A lightweight live log can be configured
+with `etc/logging/logger_topics_mavlink.txt` on the SD card, using the same format as `logger_topics.txt`
+(`<topic_name>[ <interval>[ <instance>]]`). Only the listed topics are then streamed, each rate limited by
+its interval, while the file log is unchanged. Listed topics that are not in the file log are streamed only.
+
 The file backend supports 2 types of log files: full (the normal log) and a mission
 log. The mission log is a reduced ulog file and can be used for example for geotagging or
 vehicle management. It can be enabled and configured via SDLOG_MISSION parameter.
@@ -33,6 +33,14 @@
 
 #pragma once
 
+#include "log_index.h"
+#if defined(CONFIG_LOGGER_DELTA_ENCODING)
+#include "log_delta.h"
+#endif
+#if defined(CONFIG_LOGGER_DEFINITIONS_CACHE)
+#include "definitions_cache.h"
+#endif
+#include "log_retention.h"
 #include "log_writer.h"
 #include "logged_topics.h"
 #include "messages.h"
@@ -50,6 +58,7 @@
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionInterval.hpp>
+#include <uORB/topics/load_shedding.h>
 #include <uORB/topics/logger_status.h>
 #include <uORB/topics/log_message.h>
 #include <uORB/topics/manual_control_setpoint.h>
@@ -74,11 +83,21 @@ static constexpr uint8_t MSG_ID_INVALID = UINT8_MAX;
 struct LoggerSubscription : public uORB::SubscriptionInterval {
 	LoggerSubscription() = default;
 
-	LoggerSubscription(ORB_ID id, uint32_t interval_ms = 0, uint8_t instance = 0) :
-		uORB::SubscriptionInterval(id, interval_ms * 1000, instance)
+	LoggerSubscription(ORB_ID id, uint32_t interval_ms = 0, uint8_t instance = 0,
+			   TopicPriority topic_priority = TopicPriority::Normal) :
+		uORB::SubscriptionInterval(id, interval_ms * 1000, instance),
+		priority(topic_priority)
 	{}
 
 	uint8_t msg_id{MSG_ID_INVALID};
+	TopicPriority priority{TopicPriority::Normal};
+	uint8_t decimation_count{0};
+	uint8_t rate_bucket{0};             ///< index into Logger::_rate_buckets
+
+	bool file{true};                    ///< written to the log file
+	bool mavlink{true};                 ///< streamed over mavlink
+	uint16_t mavlink_interval_ms{0};    ///< minimum time between 2 mavlink stream writes [ms]
+	hrt_abstime mavlink_next_write{0};
 };
 
 class Logger : public ModuleBase<Logger>, public ModuleParams
@@ -169,12 +188,25 @@ private:
 		bool has_log_dir{false};
 	};
 
+	/**
+	 * Subscriptions with the same interval. A bucket is only checked for updates once one of its
+	 * subscriptions can have new data, which avoids checking every topic on every logger iteration.
+	 */
+	struct RateBucket {
+		uint32_t interval_us;
+		hrt_abstime next_due;               ///< earliest time at which one of the subscriptions is due
+		uint16_t first;                     ///< index of the first subscription in _rate_bucket_subs
+		uint16_t count;
+	};
+
 	struct Statistics {
 		hrt_abstime start_time_file{0};				///< Time when logging started, file backend (not the logger thread)
 		hrt_abstime dropout_start{0};				///< start of current dropout (0 = no dropout)
 		float max_dropout_duration{0.0f};			///< max duration of dropout [s]
 		size_t write_dropouts{0};				///< failed buffer writes due to buffer overflow
 		size_t high_water{0};					///< maximum used write buffer
+		size_t messages_decimated{0};				///< messages skipped due to buffer pressure
+		uint8_t max_degradation_level{0};			///< highest degradation level
 	};
 
 	struct MissionSubscription {
@@ -208,6 +240,13 @@ private:
 	 */
 	int create_log_dir(LogType type, tm *tt, char *log_dir, int log_dir_len);
 
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	/**
+	 * Compression is enabled with SDLOG_COMPRESS, but not combined with encryption
+	 */
+	bool log_compression_enabled();
+#endif
+
 	/**
 	 * Get log file name with directory (create it if necessary)
 	 */
@@ -217,6 +256,18 @@ private:
 
 	void stop_log_file(LogType type);
 
+#if defined(CONFIG_LOGGER_DELTA_ENCODING)
+	/**
+	 * set up delta encoding for all subscriptions written to the full log file (@see LogDelta)
+	 */
+	void start_log_delta();
+
+	/**
+	 * Data messages can only be delta encoded if they exclusively go to the full log file
+	 */
+	bool can_write_delta() const;
+#endif
+
 	void start_log_mavlink();
 
 	void stop_log_mavlink();
@@ -233,8 +284,9 @@ private:
 
 	/**
 	 * write the file header with file magic and timestamp.
+	 * @param delta_data set the incompat flag for delta encoded data messages
 	 */
-	void write_header(LogType type);
+	void write_header(LogType type, bool delta_data = false);
 
 	void write_formats(LogType type);
 
@@ -243,11 +295,31 @@ private:
 	 */
 	void write_perf_data(PrintLoadReason reason);
 
+	/**
+	 * write the index of the full log as appended data (@see LogIndex)
+	 */
+	void write_index();
+
+	/**
+	 * check if the full log file reached the rotation size or time (SDLOG_ROT_SIZE, SDLOG_ROT_TIME)
+	 */
+	bool should_rotate_log_file(hrt_abstime now) const;
+
+	/**
+	 * close the full log file and continue in a new one
+	 */
+	void rotate_log_file();
+
 	/**
 	 * write bootup console output
 	 */
 	void write_console_output();
 
+	/**
+	 * write the boot timeline (px4_boot_trace)
+	 */
+	void write_boot_trace();
+
 	/**
 	 * callback to write the performance counters
 	 */
@@ -276,10 +348,47 @@ private:
 	void write_parameter_defaults(LogType type);
 
 	void write_changed_parameters(LogType type);
+
+#if defined(CONFIG_LOGGER_DEFINITIONS_CACHE)
+	/**
+	 * (re-)build the cached formats, parameters and parameter defaults of the full log if outdated
+	 */
+	void update_definitions_cache();
+
+	/**
+	 * write the cached formats, parameters and parameter defaults of the full log
+	 * @return false if the cache is outdated (nothing written)
+	 */
+	bool write_definitions_cache();
+#endif
 	void write_events_file(LogType type);
 
 	inline bool copy_if_updated(int sub_idx, void *buffer, bool try_to_subscribe);
 
+	/**
+	 * Check a subscription for an update and write it to the log(s).
+	 * Must be called with _writer.lock() held.
+	 */
+	void handle_subscription_update(int sub_idx, bool try_to_subscribe, hrt_abstime loop_time, uint32_t &total_bytes);
+
+	/**
+	 * Check if a subscription update can be copied directly into the write buffer of the full log file,
+	 * instead of going through _msg_buffer
+	 */
+	bool can_write_in_place(int sub_idx) const;
+
+	/**
+	 * Write the header of a ULog data message
+	 * @param msg_size message size including the header
+	 */
+	static void write_data_header(uint8_t *buffer, size_t msg_size, uint16_t msg_id);
+
+	/**
+	 * Group the subscriptions into rate buckets (@see RateBucket)
+	 * @return true on success
+	 */
+	bool initialize_rate_buckets();
+
 	/**
 	 * Write exactly one ulog message to the logger and handle dropouts.
 	 * Must be called with _writer.lock() held.
@@ -287,6 +396,19 @@ private:
 	 */
 	bool write_message(LogType type, void *ptr, size_t size);
 
+	/**
+	 * Update the degradation level from the full log buffer fill level.
+	 * Level 0: everything is logged, 1: best-effort topics are decimated (every 2nd message),
+	 * 2: best-effort topics are dropped and normal topics decimated, 3: only critical topics are logged.
+	 * While the logger is shed by load_mon (SYS_SHED_LOG), the level is at least 2.
+	 */
+	void update_degradation_level();
+
+	/**
+	 * Check if a message of a subscription should be written at the current degradation level
+	 */
+	bool should_write_under_pressure(LoggerSubscription &sub);
+
 	/**
 	 * Add topic subscriptions from SD file if it exists, otherwise add topics based on the configured profile.
 	 * This must be called before start_log() (because it does not write an ADD_LOGGED_MSG message).
@@ -354,8 +476,12 @@ private:
 
 	LoggerSubscription	 			*_subscriptions{nullptr}; ///< all subscriptions for full & mission log (in front)
 	int						_num_subscriptions{0};
+	RateBucket					*_rate_buckets{nullptr};
+	int						_num_rate_buckets{0};
+	uint8_t						*_rate_bucket_subs{nullptr}; ///< subscription indexes, grouped by bucket
 	MissionSubscription 				_mission_subscriptions[MAX_MISSION_TOPICS_NUM] {}; ///< additional data for mission subscriptions
 	int						_num_mission_subs{0};
+	bool						_mavlink_topics_configured{false}; ///< the mavlink stream has its own topic selection
 	LoggerSubscription				_event_subscription; ///< Subscription for the event topic (handled separately)
 	uint16_t 					_event_sequence_offset{0}; ///< event sequence offset to account for skipped (not logged) messages
 	uint16_t 					_event_sequence_offset_mission{0};
@@ -364,6 +490,16 @@ private:
 	int						_num_excluded_optional_topic_ids{0};
 
 	LogWriter					_writer;
+	LogIndex					_log_index; ///< index of the full log file
+#if defined(CONFIG_LOGGER_DELTA_ENCODING)
+	LogDelta					_log_delta; ///< delta encoding of the full log file
+#endif
+#if defined(CONFIG_LOGGER_DEFINITIONS_CACHE)
+	DefinitionsCache				_definitions_cache; ///< serialized definitions of the full log
+	hrt_abstime					_definitions_cache_next_check{0};
+#endif
+	LogRetention					_log_retention; ///< removes old logs in the background
+	uint32_t					_log_segment{0}; ///< number of rotations of the current full log
 	uint32_t					_log_interval{0};
 	float						_rate_factor{1.0f};
 	const orb_metadata				*_polling_topic_meta{nullptr}; ///< if non-null, poll on this topic instead of sleeping
@@ -382,9 +518,12 @@ private:
 	int						_lockstep_component{-1};
 
 	uint32_t					_message_gaps{0};
+	uint8_t						_degradation_level{0};
+	bool						_load_shedding{false}; ///< shed by load_mon (SYS_SHED_LOG)
 
 	timer_callback_data_s				_timer_callback_data{};
 
+	uORB::Subscription				_load_shedding_sub{ORB_ID(load_shedding)};
 	uORB::Subscription				_manual_control_setpoint_sub{ORB_ID(manual_control_setpoint)};
 	uORB::Subscription				_vehicle_command_sub{ORB_ID(vehicle_command)};
 	uORB::Subscription				_vehicle_status_sub{ORB_ID(vehicle_status)};
@@ -397,11 +536,20 @@ private:
 		(ParamInt<px4::params::SDLOG_PROFILE>) _param_sdlog_profile,
 		(ParamInt<px4::params::SDLOG_MISSION>) _param_sdlog_mission,
 		(ParamBool<px4::params::SDLOG_BOOT_BAT>) _param_sdlog_boot_bat,
-		(ParamBool<px4::params::SDLOG_UUID>) _param_sdlog_uuid
+		(ParamBool<px4::params::SDLOG_UUID>) _param_sdlog_uuid,
+		(ParamInt<px4::params::SDLOG_IDX_INT>) _param_sdlog_idx_int,
+		(ParamInt<px4::params::SDLOG_ROT_SIZE>) _param_sdlog_rot_size,
+		(ParamInt<px4::params::SDLOG_ROT_TIME>) _param_sdlog_rot_time
 #if defined(PX4_CRYPTO)
 		, (ParamInt<px4::params::SDLOG_ALGORITHM>) _param_sdlog_crypto_algorithm,
 		(ParamInt<px4::params::SDLOG_KEY>) _param_sdlog_crypto_key,
 		(ParamInt<px4::params::SDLOG_EXCH_KEY>) _param_sdlog_crypto_exchange_key
+#endif
+#if defined(CONFIG_LOGGER_COMPRESSION)
+		, (ParamBool<px4::params::SDLOG_COMPRESS>) _param_sdlog_compress
+#endif
+#if defined(CONFIG_LOGGER_DELTA_ENCODING)
+		, (ParamInt<px4::params::SDLOG_DELTA_KF>) _param_sdlog_delta_kf
 #endif
 	)
 };
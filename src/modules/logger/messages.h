@@ -49,6 +49,9 @@ enum class ULogMessageType : uint8_t {
 	LOGGING = 'L',
 	LOGGING_TAGGED = 'C',
 	FLAG_BITS = 'B',
+	INDEX = 'X',
+	DATA_DELTA = 'd',
+	DATA_FIFO = 'f',
 };
 
 
@@ -89,6 +92,23 @@ struct ulog_key_header_s {
 };
 
 
+/** first bytes of a compressed log file, followed by the compressed frames */
+struct ulog_compressed_header_s {
+	/* magic identifying the file content */
+	uint8_t magic[6];
+
+	/* version of this header and the frame format */
+	uint8_t hdr_ver;
+
+	/* compression algorithm (1 = heatshrink) */
+	uint8_t algorithm;
+
+	/* heatshrink window and lookahead size (log2) */
+	uint8_t window_bits;
+	uint8_t lookahead_bits;
+};
+
+
 /**
  * @brief Message Header for the ULog
  *
@@ -179,6 +199,50 @@ struct ulog_message_data_s {
 	uint16_t msg_id;
 };
 
+/**
+ * @brief Logged Data Delta Message
+ *
+ * Replaces a Data Message if ULOG_INCOMPAT_FLAG0_DATA_DELTA_MASK is set. The payload after the timestamp
+ * is split into blocks of ULOG_DATA_DELTA_BLOCK_SIZE bytes (the last one can be shorter). data contains a
+ * bit mask with one bit per block (LSB first), followed by the blocks that changed with respect to the
+ * previous message with the same msg_id. The blocks that are not set are unchanged.
+ */
+#define ULOG_DATA_DELTA_BLOCK_SIZE 4
+
+struct ulog_message_data_delta_s {
+	uint16_t msg_size; ///< size of message - ULOG_MSG_HEADER_LEN
+	uint8_t msg_type = static_cast<uint8_t>(ULogMessageType::DATA_DELTA);
+
+	uint16_t msg_id;
+	uint64_t timestamp;
+	uint8_t data[0];
+};
+
+/**
+ * @brief Logged FIFO Data Message
+ *
+ * Replaces a Data Message of sensor_gyro_fifo and sensor_accel_fifo if ULOG_INCOMPAT_FLAG0_DATA_DELTA_MASK is set.
+ * data contains:
+ * - device_id (uint32), dt (float) and scale (float), only if ULOG_DATA_FIFO_FLAG_PARAMS is set
+ * - timestamp - timestamp_sample
+ * - the number of samples (uint8)
+ * - the x, then y, then z samples, each as difference to the previous sample of the axis. For the first sample
+ *   this is the last one of the previous message with the same msg_id, or 0 if ULOG_DATA_FIFO_FLAG_RESET is set.
+ * Signed integers are zigzag and varint (LEB128) encoded. Array elements after the valid samples are 0.
+ */
+#define ULOG_DATA_FIFO_FLAG_PARAMS (1<<0) ///< device_id, dt and scale are included (otherwise unchanged)
+#define ULOG_DATA_FIFO_FLAG_RESET (1<<1) ///< no reference to the previous message (always with PARAMS)
+
+struct ulog_message_data_fifo_s {
+	uint16_t msg_size; ///< size of message - ULOG_MSG_HEADER_LEN
+	uint8_t msg_type = static_cast<uint8_t>(ULogMessageType::DATA_FIFO);
+
+	uint16_t msg_id;
+	uint64_t timestamp;
+	uint8_t flags; ///< @see ULOG_DATA_FIFO_FLAG_*
+	uint8_t data[0];
+};
+
 /**
  * @brief Information Message
  *
@@ -282,6 +346,7 @@ struct ulog_message_parameter_default_s {
 
 
 #define ULOG_INCOMPAT_FLAG0_DATA_APPENDED_MASK (1<<0)
+#define ULOG_INCOMPAT_FLAG0_DATA_DELTA_MASK (1<<1) ///< the data section contains ulog_message_data_delta_s and ulog_message_data_fifo_s
 
 #define ULOG_COMPAT_FLAG0_DEFAULT_PARAMETERS_MASK (1<<0)
 
@@ -294,4 +359,28 @@ struct ulog_message_flag_bits_s {
 	uint64_t appended_offsets[3]; ///< file offset(s) for appended data if ULOG_INCOMPAT_FLAG0_DATA_APPENDED_MASK is set
 };
 
+struct ulog_index_entry_s {
+	uint64_t timestamp; ///< timestamp of the data message at offset
+	uint64_t offset; ///< file offset of the data message (or a dropout message right before it)
+};
+
+/**
+ * @brief Index Message
+ *
+ * Written to the appended data section when the log file is closed. For one logged message (msg_id) it contains
+ * the time range and a list of file offsets, about one per interval_ms, so that readers can seek to a topic and
+ * time window without scanning the whole file. Long lists are split into several messages with the same msg_id.
+ */
+struct ulog_message_index_s {
+	uint16_t msg_size; ///< size of message - ULOG_MSG_HEADER_LEN
+	uint8_t msg_type = static_cast<uint8_t>(ULogMessageType::INDEX);
+
+	uint16_t msg_id; ///< msg_id as in ulog_message_add_logged_s
+	uint32_t interval_ms; ///< minimum time between two entries
+	uint32_t num_messages; ///< number of logged data messages
+	uint64_t first_timestamp;
+	uint64_t last_timestamp;
+	ulog_index_entry_s entries[32]; ///< in increasing order (only the used part is written)
+};
+
 #pragma pack(pop)
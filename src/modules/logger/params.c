@@ -150,7 +150,7 @@ PARAM_DEFINE_INT32(SDLOG_PROFILE, 1);
  * Maximum number of log directories to keep
  *
  * If there are more log directories than this value,
- * the system will delete the oldest directories during startup.
+ * the system will delete the oldest directories (in the background, when logging starts).
  *
  * In addition, the system will delete old logs if there is not enough free space left.
  * The minimum amount is 300 MB.
@@ -177,10 +177,98 @@ PARAM_DEFINE_INT32(SDLOG_DIRS_MAX, 0);
  */
 PARAM_DEFINE_INT32(SDLOG_UUID, 1);
 
+/**
+ * Log file compression
+ *
+ * If enabled, the full log is written compressed (.ulgz file), which reduces the
+ * SD card bandwidth by typically 2-4x. The file can be converted back to a ULog file
+ * with Tools/ulog_decompress.py.
+ * Compression is not combined with encryption (SDLOG_ALGORITHM), and only available
+ * if the logger is built with CONFIG_LOGGER_COMPRESSION.
+ *
+ * @boolean
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_COMPRESS, 0);
+
+/**
+ * Delta encoding keyframe interval
+ *
+ * If set, data messages of the full log are written as deltas against the previous
+ * sample of the same topic: only the 4 byte blocks that changed are stored. A full
+ * sample (keyframe) is written at least once per interval for every topic.
+ * This mostly reduces the size of slowly changing topics (e.g. vehicle_status).
+ * The raw IMU FIFO topics (SDLOG_PROFILE bits 8 and 9) are stored as variable-length
+ * differences between consecutive samples instead, which makes full-rate IMU logging
+ * about 4-5 times smaller.
+ * The file can be converted back to a regular ULog file with Tools/ulog_delta_decode.py.
+ * Only available if the logger is built with CONFIG_LOGGER_DELTA_ENCODING.
+ *
+ * Set to 0 to disable.
+ *
+ * @min 0
+ * @max 60000
+ * @unit ms
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_DELTA_KF, 0);
+
+/**
+ * Log index interval
+ *
+ * When the full log is closed, an index is appended to the file, listing per logged
+ * topic its time range and the file offset of a message about every SDLOG_IDX_INT
+ * milliseconds. Tools can use it to seek directly to a topic and time window.
+ * The index has a fixed size, so for long logs the interval is increased automatically.
+ * It is not written for compressed or encrypted logs.
+ *
+ * Set to 0 to disable.
+ *
+ * @min 0
+ * @max 60000
+ * @unit ms
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_IDX_INT, 1000);
+
+/**
+ * Log file rotation size
+ *
+ * If the full log file exceeds this size, it is closed and logging continues in
+ * a new file in the same directory. Each file starts with the complete header
+ * (formats, parameters, logged topics) and can be read on its own.
+ * Use this to stay below the 4 GiB file size limit of FAT32 on long flights.
+ * Old logs are removed in the background as needed (see SDLOG_DIRS_MAX).
+ *
+ * Set to 0 to disable.
+ *
+ * @min 0
+ * @max 4000
+ * @unit MB
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_ROT_SIZE, 0);
+
+/**
+ * Log file rotation time
+ *
+ * If the full log file has been written for this long, it is closed and logging
+ * continues in a new file (see SDLOG_ROT_SIZE).
+ *
+ * Set to 0 to disable.
+ *
+ * @min 0
+ * @max 1440
+ * @unit min
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_ROT_TIME, 0);
+
 /**
  * Logfile Encryption algorithm
  *
- * Selects the algorithm used for logfile encryption
+ * Selects the algorithm used for logfile encryption.
+ * AES (AES-256-CTR) requires a crypto backend with hardware support.
  *
  * @value 0 Disabled
  * @value 2 XChaCha20
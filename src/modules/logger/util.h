@@ -63,17 +63,10 @@ int remove_directory(const char *dir);
 bool file_exist(const char *filename);
 
 /**
- * Check if there is enough free space left on the SD Card.
- * It will remove old log files if there is not enough space,
- * and if that fails return 1, and send a user message
- * @param log_root_dir log root directory: it's expected to contain directories in the form of sess%i or %d-%d-%d (year, month, day)
- * @param max_log_dirs_to_keep maximum log directories to keep (set to 0 for unlimited)
- * @param mavlink_log_pub
- * @param sess_dir_index output argument: will be set to the next free directory sess%i index.
- * @return 0 on success, 1 if not enough space, <0 on error
+ * Get the index for the next sess<i> log directory (one more than the highest existing one)
+ * @param log_root_dir log root directory
  */
-int check_free_space(const char *log_root_dir, int32_t max_log_dirs_to_keep, orb_advert_t &mavlink_log_pub,
-		     int &sess_dir_index);
+int get_next_sess_dir_index(const char *log_root_dir);
 
 /**
  * Get the time for log file name
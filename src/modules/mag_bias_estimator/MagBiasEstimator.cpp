@@ -49,6 +49,7 @@ MagBiasEstimator::MagBiasEstimator() :
 MagBiasEstimator::~MagBiasEstimator()
 {
 	perf_free(_cycle_perf);
+	perf_free(_soft_iron_perf);
 }
 
 int MagBiasEstimator::task_spawn(int argc, char *argv[])
@@ -94,7 +95,12 @@ void MagBiasEstimator::Run()
 				}
 
 				if (_arming_state == vehicle_status_s::ARMING_STATE_ARMED) {
-					ScheduleOnInterval(1_s);
+					// start a new in flight calibration every flight
+					for (auto &soft_iron_estimator : _soft_iron_estimator) {
+						soft_iron_estimator.reset();
+					}
+
+					ScheduleOnInterval(_param_mbe_si_en.get() ? 100_ms : 1_s);
 
 				} else {
 					// restore 50 Hz scheduling
@@ -116,6 +122,10 @@ void MagBiasEstimator::Run()
 
 	// only run when disarmed
 	if (_arming_state == vehicle_status_s::ARMING_STATE_ARMED) {
+		if (_param_mbe_si_en.get() && !_system_calibrating) {
+			updateSoftIronEstimate();
+		}
+
 		return;
 	}
 
@@ -231,6 +241,55 @@ void MagBiasEstimator::Run()
 	perf_end(_cycle_perf);
 }
 
+void MagBiasEstimator::updateSoftIronEstimate()
+{
+	perf_begin(_soft_iron_perf);
+
+	for (int mag_index = 0; mag_index < MAX_SENSOR_COUNT; mag_index++) {
+		int sensor_mag_updates = 0;
+		sensor_mag_s sensor_mag;
+
+		while ((sensor_mag_updates < sensor_mag_s::ORB_QUEUE_LENGTH) && _sensor_mag_subs[mag_index].update(&sensor_mag)) {
+			sensor_mag_updates++;
+
+			_calibration[mag_index].set_device_id(sensor_mag.device_id);
+
+			const Vector3f mag_raw{sensor_mag.x, sensor_mag.y, sensor_mag.z};
+			_soft_iron_estimator[mag_index].addSample(mag_raw, _calibration[mag_index].Correct(mag_raw));
+		}
+	}
+
+	// bounded work per cycle: solve the fit of at most one sensor, and only once it has enough new samples
+	static constexpr unsigned MIN_NEW_SAMPLES = 50;
+
+	for (int i = 0; i < MAX_SENSOR_COUNT; i++) {
+		const int mag_index = _soft_iron_update_index;
+		_soft_iron_update_index = (_soft_iron_update_index + 1) % MAX_SENSOR_COUNT;
+
+		MagSoftIronEstimator &estimator = _soft_iron_estimator[mag_index];
+
+		if ((_calibration[mag_index].device_id() != 0) && (estimator.newSamples() >= MIN_NEW_SAMPLES)) {
+			estimator.update();
+
+			magnetometer_calibration_candidate_s candidate{};
+			candidate.device_id = _calibration[mag_index].device_id();
+			estimator.offset().copyTo(candidate.offset);
+			estimator.diagonal().copyTo(candidate.diagonal);
+			estimator.offdiagonal().copyTo(candidate.off_diagonal);
+			candidate.field_strength = estimator.fieldStrength();
+			candidate.fitness = estimator.fitness();
+			candidate.coverage = estimator.coverage();
+			candidate.sample_count = estimator.sampleCount();
+			candidate.valid = estimator.valid();
+			candidate.timestamp = hrt_absolute_time();
+			_magnetometer_calibration_candidate_pub[mag_index].publish(candidate);
+			break;
+		}
+	}
+
+	perf_end(_soft_iron_perf);
+}
+
 void MagBiasEstimator::publishMagBiasEstimate()
 {
 	magnetometer_bias_estimate_s mag_bias_est{};
@@ -267,9 +326,23 @@ int MagBiasEstimator::print_status()
 				 (double)bias(0),
 				 (double)bias(1),
 				 (double)bias(2));
+
+			const MagSoftIronEstimator &soft_iron = _soft_iron_estimator[mag_index];
+
+			if (soft_iron.sampleCount() > 0) {
+				PX4_INFO("%d soft iron candidate (%s): offset [% 05.3f % 05.3f % 05.3f], diag [%.3f %.3f %.3f], offdiag [% 05.3f % 05.3f % 05.3f], coverage %.2f, fitness %.4f",
+					 mag_index, soft_iron.valid() ? "valid" : "invalid",
+					 (double)soft_iron.offset()(0), (double)soft_iron.offset()(1), (double)soft_iron.offset()(2),
+					 (double)soft_iron.diagonal()(0), (double)soft_iron.diagonal()(1), (double)soft_iron.diagonal()(2),
+					 (double)soft_iron.offdiagonal()(0), (double)soft_iron.offdiagonal()(1), (double)soft_iron.offdiagonal()(2),
+					 (double)soft_iron.coverage(), (double)soft_iron.fitness());
+			}
 		}
 	}
 
+	perf_print_counter(_cycle_perf);
+	perf_print_counter(_soft_iron_perf);
+
 	return 0;
 }
 
@@ -283,6 +356,9 @@ int MagBiasEstimator::print_usage(const char *reason)
 		R"DESCR_STR(
 ### Description
 Online magnetometer bias estimator.
+
+With MBE_SI_EN enabled, a full hard and soft iron calibration (ellipsoid fit) is also accumulated in flight
+and published as magnetometer_calibration_candidate for review. It is not applied automatically.
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("mag_bias_estimator", "system");
@@ -34,6 +34,8 @@
 #pragma once
 
 #include <drivers/drv_hrt.h>
+#include "MagSoftIronEstimator.hpp"
+
 #include <lib/field_sensor_bias_estimator/FieldSensorBiasEstimator.hpp>
 #include <lib/mathlib/mathlib.h>
 #include <lib/perf/perf_counter.h>
@@ -44,9 +46,11 @@
 #include <px4_platform_common/module_params.h>
 #include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
 #include <uORB/Publication.hpp>
+#include <uORB/PublicationMulti.hpp>
 #include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionMultiArray.hpp>
 #include <uORB/topics/magnetometer_bias_estimate.h>
+#include <uORB/topics/magnetometer_calibration_candidate.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_mag.h>
 #include <uORB/topics/vehicle_angular_velocity.h>
@@ -80,6 +84,7 @@ public:
 private:
 	void Run() override;
 	void publishMagBiasEstimate();
+	void updateSoftIronEstimate();
 
 	static constexpr int MAX_SENSOR_COUNT = 4;
 
@@ -93,6 +98,17 @@ private:
 
 	uORB::Publication<magnetometer_bias_estimate_s> _magnetometer_bias_estimate_pub{ORB_ID(magnetometer_bias_estimate)};
 
+	uORB::PublicationMulti<magnetometer_calibration_candidate_s> _magnetometer_calibration_candidate_pub[MAX_SENSOR_COUNT] {
+		{ORB_ID(magnetometer_calibration_candidate)},
+		{ORB_ID(magnetometer_calibration_candidate)},
+		{ORB_ID(magnetometer_calibration_candidate)},
+		{ORB_ID(magnetometer_calibration_candidate)},
+	};
+
+	// in flight hard and soft iron calibration
+	MagSoftIronEstimator _soft_iron_estimator[MAX_SENSOR_COUNT];
+	int _soft_iron_update_index{0};
+
 	calibration::Magnetometer _calibration[MAX_SENSOR_COUNT];
 
 	hrt_abstime _time_valid[MAX_SENSOR_COUNT] {};
@@ -104,9 +120,11 @@ private:
 	bool _system_calibrating{false};
 
 	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
+	perf_counter_t _soft_iron_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": soft iron fit")};
 
 	DEFINE_PARAMETERS(
-		(ParamFloat<px4::params::MBE_LEARN_GAIN>) _param_mbe_learn_gain
+		(ParamFloat<px4::params::MBE_LEARN_GAIN>) _param_mbe_learn_gain,
+		(ParamBool<px4::params::MBE_SI_EN>) _param_mbe_si_en
 	)
 };
 
@@ -0,0 +1,231 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "MagSoftIronEstimator.hpp"
+
+#include <mathlib/mathlib.h>
+#include <px4_platform_common/defines.h>
+
+using matrix::SquareMatrix;
+using matrix::Vector3f;
+
+namespace mag_bias_estimator
+{
+
+bool MagSoftIronEstimator::addSample(const Vector3f &mag_raw, const Vector3f &mag_corrected)
+{
+	if (!mag_raw.isAllFinite() || !mag_corrected.longerThan(0.05f)) {
+		return false;
+	}
+
+	// direction bin of the dominant axis
+	int axis = 0;
+
+	for (int i = 1; i < 3; i++) {
+		if (fabsf(mag_corrected(i)) > fabsf(mag_corrected(axis))) {
+			axis = i;
+		}
+	}
+
+	const int bin = 2 * axis + ((mag_corrected(axis) < 0.f) ? 1 : 0);
+
+	if (_bin_count[bin] >= MAX_SAMPLES_PER_BIN) {
+		return false;
+	}
+
+	if (_sample_count == 0) {
+		_origin = mag_raw;
+	}
+
+	// x^2 + y^2 + z^2 = U (x^2 + y^2 - 2 z^2) + V (x^2 - 2 y^2 + z^2) + 4 M xy + 2 N xz + 2 P yz + Q x + R y + S z + T
+	const double x = mag_raw(0) - _origin(0);
+	const double y = mag_raw(1) - _origin(1);
+	const double z = mag_raw(2) - _origin(2);
+
+	const double a[N] {
+		x * x + y * y - 2.0 * z * z,
+		x * x - 2.0 * y * y + z * z,
+		4.0 * x * y,
+		2.0 * x * z,
+		2.0 * y * z,
+		x, y, z,
+		1.0
+	};
+
+	const double b = x * x + y * y + z * z;
+
+	for (int i = 0; i < N; i++) {
+		for (int j = i; j < N; j++) {
+			_ATA(i, j) += a[i] * a[j];
+		}
+
+		_ATb(i) += a[i] * b;
+	}
+
+	_btb += b * b;
+
+	_bin_count[bin]++;
+	_sample_count++;
+
+	return true;
+}
+
+float MagSoftIronEstimator::coverage() const
+{
+	int bins_covered = 0;
+
+	for (int bin = 0; bin < NUM_BINS; bin++) {
+		if (_bin_count[bin] >= MIN_SAMPLES_PER_BIN) {
+			bins_covered++;
+		}
+	}
+
+	return static_cast<float>(bins_covered) / NUM_BINS;
+}
+
+bool MagSoftIronEstimator::update()
+{
+	_sample_count_last_update = _sample_count;
+	_valid = false;
+
+	if (_sample_count < 2 * N) {
+		return false;
+	}
+
+	SquareMatrix<double, N> ATA = _ATA;
+
+	for (int i = 1; i < N; i++) {
+		for (int j = 0; j < i; j++) {
+			ATA(i, j) = ATA(j, i);
+		}
+	}
+
+	SquareMatrix<double, N> ATA_inv;
+
+	if (!ATA.I(ATA_inv)) {
+		return false;
+	}
+
+	// quadric x^T M x + 2 v^T x - T = 0 relative to the first sample
+	const matrix::Vector<double, N> theta = ATA_inv * _ATb;
+
+	SquareMatrix<double, 3> M;
+	M(0, 0) = 1.0 - theta(0) - theta(1);
+	M(1, 1) = 1.0 - theta(0) + 2.0 * theta(1);
+	M(2, 2) = 1.0 + 2.0 * theta(0) - theta(1);
+	M(0, 1) = M(1, 0) = -2.0 * theta(2);
+	M(0, 2) = M(2, 0) = -theta(3);
+	M(1, 2) = M(2, 1) = -theta(4);
+
+	const matrix::Vector3d v{-0.5 * theta(5), -0.5 * theta(6), -0.5 * theta(7)};
+
+	SquareMatrix<double, 3> M_inv;
+
+	if (!M.I(M_inv)) {
+		return false;
+	}
+
+	// center c = -M^-1 v, (x - c)^T M (x - c) = k
+	const matrix::Vector3d center = -(M_inv * v);
+	const double k = theta(8) + center.dot(M * center);
+
+	if (!(k > 0.0)) {
+		return false;
+	}
+
+	// A = M / k maps the ellipsoid to the unit sphere and has to be positive definite
+	const SquareMatrix<double, 3> A = M / k;
+
+	const double minor_1 = A(0, 0);
+	const double minor_2 = A(0, 0) * A(1, 1) - A(0, 1) * A(1, 0);
+	const double minor_3 = A(0, 0) * (A(1, 1) * A(2, 2) - A(1, 2) * A(2, 1))
+			       - A(0, 1) * (A(1, 0) * A(2, 2) - A(1, 2) * A(2, 0))
+			       + A(0, 2) * (A(1, 0) * A(2, 1) - A(1, 1) * A(2, 0));
+
+	if (!(minor_1 > 0.0) || !(minor_2 > 0.0) || !(minor_3 > 0.0)) {
+		return false;
+	}
+
+	// symmetric square root S of A (Denman-Beavers iteration), |S (x - c)| = 1
+	SquareMatrix<float, 3> Y{A.cast<float>()};
+	SquareMatrix<float, 3> Z{matrix::eye<float, 3>()};
+
+	for (int i = 0; i < 10; i++) {
+		SquareMatrix<float, 3> Y_inv;
+		SquareMatrix<float, 3> Z_inv;
+
+		if (!Y.I(Y_inv) || !Z.I(Z_inv)) {
+			return false;
+		}
+
+		const SquareMatrix<float, 3> Y_next = (Y + Z_inv) * 0.5f;
+		Z = (Z + Y_inv) * 0.5f;
+		Y = Y_next;
+	}
+
+	// scale S to a unit mean diagonal, the field strength is then the sphere radius
+	const float trace = Y.trace();
+
+	if (!(trace > 0.f)) {
+		return false;
+	}
+
+	_field_strength = 3.f / trace;
+	const SquareMatrix<float, 3> W = Y * _field_strength;
+
+	_offset = _origin + Vector3f{(float)center(0), (float)center(1), (float)center(2)};
+	_diagonal = Vector3f{W(0, 0), W(1, 1), W(2, 2)};
+	_offdiagonal = Vector3f{W(0, 1), W(0, 2), W(1, 2)};
+
+	// RMS of the algebraic residuals (x - c)^T M (x - c) - k from the normal equations,
+	// converted to an approximate RMS distance to the fitted sphere
+	const double rss = theta.dot(ATA * theta) - 2.0 * theta.dot(_ATb) + _btb;
+	_fitness = _field_strength * sqrtf(fmaxf((float)(rss / _sample_count), 0.f)) / (2.f * (float)k);
+
+	// maximum measurement range is ~1.9 Ga, the earth field is ~0.6 Ga, so an offset larger than ~1.3 Ga
+	// means the mag will saturate in some directions
+	static constexpr float MAX_OFFSET = 1.3f;
+	static constexpr float MAX_FITNESS = 0.02f;
+
+	_valid = _offset.isAllFinite() && _diagonal.isAllFinite() && _offdiagonal.isAllFinite()
+		 && (coverage() >= 1.f)
+		 && (_field_strength >= 0.2f) && (_field_strength < 0.7f)
+		 && (_diagonal.min() > 0.f)
+		 && (fabsf(_offset(0)) < MAX_OFFSET) && (fabsf(_offset(1)) < MAX_OFFSET) && (fabsf(_offset(2)) < MAX_OFFSET)
+		 && (_fitness < MAX_FITNESS);
+
+	return true;
+}
+
+} // namespace mag_bias_estimator
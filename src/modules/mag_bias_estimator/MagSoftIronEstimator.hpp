@@ -0,0 +1,123 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file MagSoftIronEstimator.hpp
+ *
+ * Background hard and soft iron magnetometer calibration.
+ *
+ * Raw magnetometer samples are accumulated into the normal equations of a linear
+ * least-squares ellipsoid fit (quadric with the trace of M constrained to 3, which
+ * is well suited to the nearly spherical magnetometer data), so no samples need to be stored
+ * and the work per sample is constant. The samples are binned by direction and only
+ * used while their bin is not full, which balances the fit towards all orientations
+ * and bounds the total work. Solving the fit is done on request (at most once per
+ * estimator cycle) and gives a calibration candidate in the same form as the commander
+ * calibration (offset, symmetric scale matrix).
+ */
+
+#pragma once
+
+#include <matrix/matrix/math.hpp>
+
+namespace mag_bias_estimator
+{
+
+class MagSoftIronEstimator
+{
+public:
+	MagSoftIronEstimator() = default;
+	~MagSoftIronEstimator() = default;
+
+	void reset() { *this = MagSoftIronEstimator{}; }
+
+	/**
+	 * Add a raw sample.
+	 *
+	 * @param mag_raw raw sensor frame measurement (Gauss)
+	 * @param mag_corrected the same measurement corrected with the current calibration, used for binning
+	 * @return true if the sample was used
+	 */
+	bool addSample(const matrix::Vector3f &mag_raw, const matrix::Vector3f &mag_corrected);
+
+	/**
+	 * Solve the fit for the samples added so far.
+	 *
+	 * @return true if the fit succeeded, the result is then available from the getters
+	 */
+	bool update();
+
+	// number of samples added since the last update()
+	unsigned newSamples() const { return _sample_count - _sample_count_last_update; }
+	unsigned sampleCount() const { return _sample_count; }
+
+	// fraction of the direction bins with enough samples [0, 1]
+	float coverage() const;
+
+	// true if the last fit passed the coverage, fitness and range checks
+	bool valid() const { return _valid; }
+
+	const matrix::Vector3f &offset() const { return _offset; }
+	const matrix::Vector3f &diagonal() const { return _diagonal; }
+	const matrix::Vector3f &offdiagonal() const { return _offdiagonal; }
+	float fieldStrength() const { return _field_strength; }
+	float fitness() const { return _fitness; }
+
+	static constexpr int NUM_BINS = 6;                     ///< +-X, +-Y, +-Z dominant directions
+	static constexpr unsigned MAX_SAMPLES_PER_BIN = 200;
+	static constexpr unsigned MIN_SAMPLES_PER_BIN = 20;
+
+private:
+	static constexpr int N = 9;
+
+	// running sums of the normal equations, upper triangle only
+	matrix::SquareMatrix<double, N> _ATA{};
+	matrix::Vector<double, N> _ATb{};
+	double _btb{0.0};
+
+	matrix::Vector3f _origin{};                            ///< samples are taken relative to the first one
+
+	unsigned _bin_count[NUM_BINS] {};
+	unsigned _sample_count{0};
+	unsigned _sample_count_last_update{0};
+
+	matrix::Vector3f _offset{};
+	matrix::Vector3f _diagonal{1.f, 1.f, 1.f};
+	matrix::Vector3f _offdiagonal{};
+	float _field_strength{0.f};
+	float _fitness{0.f};
+	bool _valid{false};
+};
+
+} // namespace mag_bias_estimator
@@ -56,3 +56,16 @@ PARAM_DEFINE_INT32(MBE_ENABLE, 1);
  * @group Magnetometer Bias Estimator
  */
 PARAM_DEFINE_FLOAT(MBE_LEARN_GAIN, 18.f);
+
+/**
+ * Enable in-flight mag soft iron calibration
+ *
+ * Accumulates a full hard and soft iron calibration (ellipsoid fit) of every
+ * magnetometer while armed and publishes it as a calibration candidate.
+ * The candidate is only valid once the samples cover all directions and
+ * it is never applied automatically.
+ *
+ * @boolean
+ * @group Magnetometer Bias Estimator
+ */
+PARAM_DEFINE_INT32(MBE_SI_EN, 0);
@@ -0,0 +1,180 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file MavlinkMessageQueue.hpp
+ *
+ * Bounded lock-free multi-producer single-consumer queue for forwarded messages.
+ *
+ * Producers (the receive threads of other MAVLink instances) never block on the
+ * consumer (the transmit loop of this instance), so a slow link can not stall
+ * or priority-invert the forwarding instances. When the queue is full the message
+ * is dropped, as with the previous ringbuffer.
+ *
+ * Based on the bounded queue by Dmitry Vyukov: every slot carries a sequence
+ * number telling whether it is ready to be written or read in the current lap.
+ */
+
+#pragma once
+
+#include <px4_platform_common/atomic.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+template<size_t SLOT_SIZE>
+class MavlinkMessageQueue
+{
+public:
+	MavlinkMessageQueue() = default;
+	~MavlinkMessageQueue() { delete[] _slots; }
+
+	MavlinkMessageQueue(const MavlinkMessageQueue &) = delete;
+	MavlinkMessageQueue &operator=(const MavlinkMessageQueue &) = delete;
+
+	/**
+	 * Allocate the slots. Must be called before the queue is shared with producers.
+	 * @param num_slots number of messages, rounded up to a power of 2
+	 */
+	bool allocate(size_t num_slots)
+	{
+		size_t capacity = 1;
+
+		while (capacity < num_slots) {
+			capacity <<= 1;
+		}
+
+		_slots = new Slot[capacity];
+
+		if (_slots == nullptr) {
+			return false;
+		}
+
+		for (size_t i = 0; i < capacity; i++) {
+			_slots[i].sequence.store(i);
+		}
+
+		_mask = capacity - 1;
+		return true;
+	}
+
+	/**
+	 * Add a message, may be called concurrently from multiple threads.
+	 * @return false if the queue is full or the message does not fit
+	 */
+	bool push(const uint8_t *buf, size_t len)
+	{
+		if ((_slots == nullptr) || (len > SLOT_SIZE)) {
+			return false;
+		}
+
+		uint32_t pos = _enqueue_pos.load();
+		Slot *slot;
+
+		for (;;) {
+			slot = &_slots[pos & _mask];
+			const int32_t diff = static_cast<int32_t>(slot->sequence.load() - pos);
+
+			if (diff == 0) {
+				// slot is free in this lap, claim it
+				if (_enqueue_pos.compare_exchange(&pos, pos + 1)) {
+					break;
+				}
+
+				_contended.fetch_add(1);
+
+			} else if (diff < 0) {
+				// slot still holds the message from the previous lap
+				_dropped.fetch_add(1);
+				return false;
+
+			} else {
+				// another producer claimed it first
+				pos = _enqueue_pos.load();
+			}
+		}
+
+		memcpy(slot->data, buf, len);
+		slot->len = len;
+		slot->sequence.store(pos + 1);
+		return true;
+	}
+
+	/**
+	 * Remove the oldest message, must only be called from the consumer thread.
+	 * @return message size, 0 if the queue is empty
+	 */
+	size_t pop(uint8_t *buf, size_t buf_len)
+	{
+		if (_slots == nullptr) {
+			return 0;
+		}
+
+		Slot &slot = _slots[_dequeue_pos & _mask];
+
+		if (static_cast<int32_t>(slot.sequence.load() - (_dequeue_pos + 1)) < 0) {
+			return 0;
+		}
+
+		const size_t len = (slot.len <= buf_len) ? slot.len : 0;
+		memcpy(buf, slot.data, len);
+
+		// release the slot for the producers of the next lap
+		slot.sequence.store(_dequeue_pos + _mask + 1);
+		_dequeue_pos++;
+		return len;
+	}
+
+	/** number of messages dropped because the queue was full */
+	uint32_t dropped() const { return _dropped.load(); }
+
+	/** number of times a producer lost a race for a slot and had to retry */
+	uint32_t contended() const { return _contended.load(); }
+
+private:
+	struct Slot {
+		px4::atomic<uint32_t> sequence{0};
+		uint16_t len{0};
+		uint8_t data[SLOT_SIZE];
+	};
+
+	Slot *_slots{nullptr};
+	uint32_t _mask{0};
+
+	px4::atomic<uint32_t> _enqueue_pos{0};
+	uint32_t _dequeue_pos{0};
+
+	px4::atomic<uint32_t> _dropped{0};
+	px4::atomic<uint32_t> _contended{0};
+};
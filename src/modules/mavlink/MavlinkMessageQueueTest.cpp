@@ -0,0 +1,159 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "MavlinkMessageQueue.hpp"
+
+using Queue = MavlinkMessageQueue<16>;
+
+TEST(MavlinkMessageQueueTest, PushPop)
+{
+	Queue queue;
+	ASSERT_TRUE(queue.allocate(3)); // rounded up to 4
+
+	uint8_t buf[16] {};
+
+	EXPECT_EQ(queue.pop(buf, sizeof(buf)), 0u);
+
+	for (uint8_t i = 0; i < 4; i++) {
+		const uint8_t msg[3] {i, i, i};
+		EXPECT_TRUE(queue.push(msg, sizeof(msg)));
+	}
+
+	// full
+	const uint8_t msg[3] {};
+	EXPECT_FALSE(queue.push(msg, sizeof(msg)));
+	EXPECT_EQ(queue.dropped(), 1u);
+
+	for (uint8_t i = 0; i < 4; i++) {
+		ASSERT_EQ(queue.pop(buf, sizeof(buf)), 3u);
+		EXPECT_EQ(buf[0], i);
+		EXPECT_EQ(buf[2], i);
+	}
+
+	EXPECT_EQ(queue.pop(buf, sizeof(buf)), 0u);
+
+	// too large for a slot
+	const uint8_t large[17] {};
+	EXPECT_FALSE(queue.push(large, sizeof(large)));
+}
+
+TEST(MavlinkMessageQueueTest, WrapAround)
+{
+	Queue queue;
+	ASSERT_TRUE(queue.allocate(2));
+
+	uint8_t buf[16] {};
+
+	for (uint32_t i = 0; i < 1000; i++) {
+		const uint8_t msg[1] {static_cast<uint8_t>(i)};
+		ASSERT_TRUE(queue.push(msg, sizeof(msg)));
+		ASSERT_EQ(queue.pop(buf, sizeof(buf)), 1u);
+		EXPECT_EQ(buf[0], static_cast<uint8_t>(i));
+	}
+}
+
+namespace
+{
+static constexpr int NUM_PRODUCERS = 4;
+static constexpr uint32_t MSGS_PER_PRODUCER = 2000;
+
+struct ProducerArgs {
+	Queue *queue;
+	uint8_t id;
+};
+
+void *producer(void *arg)
+{
+	ProducerArgs *args = static_cast<ProducerArgs *>(arg);
+
+	for (uint32_t i = 0; i < MSGS_PER_PRODUCER;) {
+		uint8_t msg[5] {args->id};
+		memcpy(&msg[1], &i, sizeof(i));
+
+		if (args->queue->push(msg, sizeof(msg))) {
+			i++;
+
+		} else {
+			sched_yield();
+		}
+	}
+
+	return nullptr;
+}
+}
+
+TEST(MavlinkMessageQueueTest, MultipleProducers)
+{
+	Queue queue;
+	ASSERT_TRUE(queue.allocate(8));
+
+	pthread_t threads[NUM_PRODUCERS];
+	ProducerArgs args[NUM_PRODUCERS];
+
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		args[i] = {&queue, static_cast<uint8_t>(i)};
+		ASSERT_EQ(pthread_create(&threads[i], nullptr, producer, &args[i]), 0);
+	}
+
+	// every producer's messages have to arrive complete and in order
+	uint32_t next[NUM_PRODUCERS] {};
+	uint32_t received = 0;
+
+	while (received < NUM_PRODUCERS * MSGS_PER_PRODUCER) {
+		uint8_t buf[16];
+
+		if (queue.pop(buf, sizeof(buf)) == 5) {
+			ASSERT_LT(buf[0], NUM_PRODUCERS);
+			uint32_t seq;
+			memcpy(&seq, &buf[1], sizeof(seq));
+			ASSERT_EQ(seq, next[buf[0]]);
+			next[buf[0]]++;
+			received++;
+
+		} else {
+			sched_yield();
+		}
+	}
+
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		pthread_join(threads[i], nullptr);
+	}
+
+	uint8_t buf[16];
+	EXPECT_EQ(queue.pop(buf, sizeof(buf)), 0u);
+}
@@ -92,6 +92,20 @@ void mavlink_end_uart_send(mavlink_channel_t chan, int length);
 extern mavlink_status_t *mavlink_get_channel_status(uint8_t chan);
 extern mavlink_message_t *mavlink_get_channel_buffer(uint8_t chan);
 
+#if !MAVLINK_FTP_UNIT_TEST
+/* message signing, see mavlink_sign_control.cpp */
+#define MAVLINK_NO_SIGN_PACKET
+#define MAVLINK_NO_SIGNATURE_CHECK
+
+uint8_t mavlink_sign_packet(mavlink_signing_t *signing, uint8_t signature[MAVLINK_SIGNATURE_BLOCK_LEN],
+			    const uint8_t *header, uint8_t header_len,
+			    const uint8_t *packet, uint8_t packet_len,
+			    const uint8_t crc[2]);
+
+bool mavlink_signature_check(mavlink_signing_t *signing, mavlink_signing_streams_t *signing_streams,
+			     const mavlink_message_t *msg);
+#endif
+
 #include <mavlink.h>
 #if !MAVLINK_FTP_UNIT_TEST
 #include <uAvionix.h>
@@ -34,6 +34,7 @@
 #include "mavlink_events.h"
 #include "mavlink_main.h"
 
+#include <lib/mathlib/mathlib.h>
 #include <px4_log.h>
 #include <errno.h>
 
@@ -41,40 +42,82 @@ namespace events
 {
 
 EventBuffer::EventBuffer(int capacity)
-	: _capacity(capacity)
+	: _capacity(capacity * sizeof(Event))
 {
 	pthread_mutex_init(&_mutex, nullptr);
 }
 
 EventBuffer::~EventBuffer()
 {
-	delete[](_events);
+	delete[](_data);
 	pthread_mutex_destroy(&_mutex);
 }
 
 int EventBuffer::init()
 {
-	if (_events) { return 0; }
+	if (_data) { return 0; }
 
-	_events = new Event[_capacity];
+	_data = new uint8_t[_capacity];
 
-	if (!_events) {
+	if (!_data) {
 		return -ENOMEM;
 	}
 
 	return 0;
 }
 
+void EventBuffer::read(int offset, void *dst, int len) const
+{
+	const int first = math::min(len, _capacity - offset);
+	memcpy(dst, &_data[offset], first);
+	memcpy(static_cast<uint8_t *>(dst) + first, _data, len - first);
+}
+
+void EventBuffer::write(int offset, const void *src, int len)
+{
+	const int first = math::min(len, _capacity - offset);
+	memcpy(&_data[offset], src, first);
+	memcpy(_data, static_cast<const uint8_t *>(src) + first, len - first);
+}
+
+int EventBuffer::next_record(int offset, RecordHeader &header) const
+{
+	read(offset, &header, sizeof(header));
+	return (offset + sizeof(header) + header.arguments_size) % _capacity;
+}
+
 void EventBuffer::insert_event(const Event &event)
 {
+	RecordHeader header;
+	header.timestamp_ms = event.timestamp_ms;
+	header.id = event.id;
+	header.sequence = event.sequence;
+	header.log_levels = event.log_levels;
+	header.arguments_size = sizeof(event.arguments);
+
+	while (header.arguments_size > 0 && event.arguments[header.arguments_size - 1] == 0) {
+		--header.arguments_size;
+	}
+
+	const int record_size = sizeof(header) + header.arguments_size;
+
 	pthread_mutex_lock(&_mutex);
-	_events[_next] = event;
-	_next = (_next + 1) % _capacity;
 
-	if (_size < _capacity) {
-		++_size;
+	// drop the oldest records until the new one fits
+	while (_used + record_size > _capacity) {
+		RecordHeader oldest;
+		const int next = next_record(_tail, oldest);
+		_used -= sizeof(oldest) + oldest.arguments_size;
+		_tail = next;
+		--_size;
 	}
 
+	write(_head, &header, sizeof(header));
+	write((_head + sizeof(header)) % _capacity, event.arguments, header.arguments_size);
+	_head = (_head + record_size) % _capacity;
+	_used += record_size;
+	++_size;
+
 	_latest_sequence.store(event.sequence);
 	pthread_mutex_unlock(&_mutex);
 }
@@ -84,33 +127,45 @@ uint16_t EventBuffer::get_oldest_sequence_after(uint16_t sequence) const
 	pthread_mutex_lock(&_mutex);
 	uint16_t sequence_ret = _latest_sequence.load();
 	uint16_t min_diff = UINT16_MAX;
+	int offset = _tail;
 
 	for (int i = 0; i < _size; ++i) {
-		uint16_t event_seq = _events[i].sequence;
-		uint16_t diff = event_seq - sequence;
+		RecordHeader header;
+		offset = next_record(offset, header);
+		uint16_t diff = header.sequence - sequence;
 
 		// this handles wrap-arounds correctly
-		if (event_seq != sequence && diff < min_diff) {
+		if (header.sequence != sequence && diff < min_diff) {
 			min_diff = diff;
-			sequence_ret = event_seq;
+			sequence_ret = header.sequence;
 		}
 	}
 
 	pthread_mutex_unlock(&_mutex);
 	return sequence_ret;
 }
+
 bool EventBuffer::get_event(uint16_t sequence, Event &event) const
 {
 	pthread_mutex_lock(&_mutex);
+	int offset = _tail;
 
-	for (int count = 0; count < _size; ++count) {
-		int index = (_next - 1 - count + _size) % _size;
-
-		if (_events[index].sequence == sequence) {
-			event = _events[index];
+	for (int i = 0; i < _size; ++i) {
+		RecordHeader header;
+		const int next = next_record(offset, header);
+
+		if (header.sequence == sequence) {
+			event.timestamp_ms = header.timestamp_ms;
+			event.id = header.id;
+			event.sequence = header.sequence;
+			event.log_levels = header.log_levels;
+			read((offset + sizeof(header)) % _capacity, event.arguments, header.arguments_size);
+			memset(event.arguments + header.arguments_size, 0, sizeof(event.arguments) - header.arguments_size);
 			pthread_mutex_unlock(&_mutex);
 			return true;
 		}
+
+		offset = next;
 	}
 
 	pthread_mutex_unlock(&_mutex);
@@ -189,6 +244,13 @@ void SendProtocol::handle_request_event(const mavlink_message_t &msg) const
 	const uint16_t end_sequence = request_event.last_sequence + 1;
 
 	for (uint16_t sequence = request_event.first_sequence; sequence != end_sequence; ++sequence) {
+		// Answer a large request in bursts limited by the tx buffer, instead of overrunning it and
+		// losing the tail of the burst. The GCS requests the remaining events again.
+		if (_mavlink.get_free_tx_buf() < MAVLINK_MSG_ID_EVENT_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES) {
+			PX4_DEBUG("tx buffer full, not answering request from seq=%i", sequence);
+			break;
+		}
+
 		if (_buffer.get_event(sequence, e)) {
 			PX4_DEBUG("sending requested event %i", sequence);
 			send_event(e);
@@ -65,6 +65,10 @@ struct Event {
  * @class EventBuffer
  * Event buffer that can be shared between threads and multiple SendProtocol instances.
  * All methods are thread-safe.
+ *
+ * Events are stored as variable-length records in a byte ringbuffer, with the trailing
+ * zero bytes of the arguments removed. Most events only use a few argument bytes, so
+ * considerably more events fit than with fixed-size entries, which helps to bridge bursts.
  */
 class EventBuffer
 {
@@ -72,7 +76,7 @@ public:
 
 	/**
 	 * Create an event buffer. Required memory: sizeof(Event) * capacity.
-	 * @param capacity maximum number of buffered events
+	 * @param capacity maximum number of buffered events with full-size arguments
 	 */
 	EventBuffer(int capacity = 20);
 	~EventBuffer();
@@ -84,20 +88,38 @@ public:
 
 	/**
 	 * Insert a new event. It's expect to have a later sequence number than the
-	 * already inserted events.
+	 * already inserted events. The oldest events are dropped to make space.
 	 */
 	void insert_event(const Event &event);
 
 	bool get_event(uint16_t sequence, Event &event) const;
 
+	/**
+	 * Number of buffered events
+	 */
 	int size() const;
 private:
+	/** Record header, followed by arguments_size argument bytes */
+	struct RecordHeader {
+		uint32_t timestamp_ms;
+		uint32_t id;
+		uint16_t sequence;
+		uint8_t log_levels;
+		uint8_t arguments_size;
+	};
+
+	void read(int offset, void *dst, int len) const;
+	void write(int offset, const void *src, int len);
+	int next_record(int offset, RecordHeader &header) const;
+
 	::px4::atomic<uint16_t> _latest_sequence{events::initial_event_sequence};
 
-	Event *_events{nullptr}; ///< stored events, ringbuffer
-	int _capacity;
-	int _next{0}; ///< next element to use
-	int _size{0};
+	uint8_t *_data{nullptr}; ///< stored event records, ringbuffer
+	const int _capacity; ///< [bytes]
+	int _head{0}; ///< next byte to write
+	int _tail{0}; ///< start of the oldest record
+	int _used{0}; ///< [bytes]
+	int _size{0}; ///< number of records
 
 	mutable pthread_mutex_t _mutex;
 };
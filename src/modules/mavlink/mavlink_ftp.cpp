@@ -42,14 +42,27 @@
 #include <errno.h>
 #include <cstring>
 
+#include <containers/LockGuard.hpp>
+#include <lib/mathlib/mathlib.h>
+
 #include "mavlink_ftp.h"
 #include "mavlink_tests/mavlink_ftp_test.h"
 
 #include "mavlink_main.h"
 
+#if defined(MAVLINK_FTP_MMAP)
+#include <sys/mman.h>
+#endif // MAVLINK_FTP_MMAP
+
 using namespace time_literals;
 
 constexpr const char MavlinkFTP::_root_dir[];
+constexpr const char MavlinkFTP::kParamFilePath[];
+constexpr const char MavlinkFTP::kParamExportFile[];
+
+static pthread_mutex_t param_export_mutex = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t param_export_hash = 0;
+static bool param_export_valid = false;
 
 MavlinkFTP::MavlinkFTP(Mavlink &mavlink) :
 	_mavlink(mavlink)
@@ -60,6 +73,8 @@ MavlinkFTP::MavlinkFTP(Mavlink &mavlink) :
 
 MavlinkFTP::~MavlinkFTP()
 {
+	_closeSession();
+
 	delete[] _work_buffer1;
 	delete[] _work_buffer2;
 }
@@ -514,7 +529,17 @@ MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 		return kErrNoSessionsAvailable;
 	}
 
-	_constructPath(_work_buffer1, _work_buffer1_len, _data_as_cstring(payload));
+	if ((oflag == O_RDONLY) && (strcmp(_data_as_cstring(payload), kParamFilePath) == 0)) {
+		if (!_exportParams()) {
+			return kErrFailErrno;
+		}
+
+		strncpy(_work_buffer1, kParamExportFile, _work_buffer1_len);
+		_work_buffer1[_work_buffer1_len - 1] = '\0';
+
+	} else {
+		_constructPath(_work_buffer1, _work_buffer1_len, _data_as_cstring(payload));
+	}
 
 	PX4_DEBUG("FTP: open '%s'", _work_buffer1);
 
@@ -550,6 +575,21 @@ MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 	_session_info.fd = fd;
 	_session_info.file_size = fileSize;
 	_session_info.stream_download = false;
+	_session_info.stream_burst_size = 0;
+
+#if defined(MAVLINK_FTP_MMAP)
+	_session_info.mapped = nullptr;
+
+	if ((oflag == O_RDONLY) && (fileSize > 0)) {
+		void *mapped = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+
+		if (mapped != MAP_FAILED) {
+			madvise(mapped, fileSize, MADV_SEQUENTIAL);
+			_session_info.mapped = static_cast<uint8_t *>(mapped);
+		}
+	}
+
+#endif // MAVLINK_FTP_MMAP
 
 	payload->session = 0;
 	payload->size = sizeof(uint32_t);
@@ -558,6 +598,47 @@ MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 	return kErrNone;
 }
 
+bool
+MavlinkFTP::_exportParams()
+{
+	LockGuard lg{param_export_mutex};
+
+	const uint32_t hash = param_hash_check();
+
+	if (param_export_valid && (hash == param_export_hash)) {
+		return true;
+	}
+
+	// export to a temporary file first, so that an ongoing download of the previous export is not truncated
+	static constexpr const char tmp_file[] = PX4_STORAGEDIR "/ftp_param.tmp";
+
+	// create the file here, param_export() falls back to the flash parameter storage if it can't be opened
+	const int fd = ::open(tmp_file, O_WRONLY | O_CREAT | O_TRUNC, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		_our_errno = errno;
+		PX4_ERR("FTP: parameter export failed: %s", strerror(_our_errno));
+		return false;
+	}
+
+	::close(fd);
+
+	// volatile parameters are not part of the hash
+	const int ret = param_export(tmp_file, [](param_t param) { return !param_is_volatile(param); });
+
+	if ((ret != 0) || (unlink(kParamExportFile) != 0 && errno != ENOENT) || (rename(tmp_file, kParamExportFile) != 0)) {
+		_our_errno = errno;
+		PX4_ERR("FTP: parameter export failed");
+		unlink(tmp_file);
+		param_export_valid = false;
+		return false;
+	}
+
+	param_export_hash = hash;
+	param_export_valid = true;
+	return true;
+}
+
 /// @brief Responds to a Read command
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workRead(PayloadHeader *payload)
@@ -574,26 +655,73 @@ MavlinkFTP::_workRead(PayloadHeader *payload)
 		return kErrEOF;
 	}
 
-	PX4_DEBUG("lseek with offset: %ld", payload->offset);
+	int bytes_read = _readSession(payload->offset, &payload->data[0], payload->size);
 
-	if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
+	if (bytes_read < 0) {
+		PX4_ERR("read fail %d, %s", bytes_read, strerror(_our_errno));
+		return kErrFailErrno;
+	}
+
+	payload->size = bytes_read;
+
+	// a client reading single chunks during a burst download is filling gaps, the bursts are too long for the link
+	if (_session_info.stream_burst_size > kBurstSizeMin) {
+		_session_info.stream_burst_size = math::max(_session_info.stream_burst_size / 2, kBurstSizeMin);
+	}
+
+	return kErrNone;
+}
+
+int
+MavlinkFTP::_readSession(uint32_t offset, uint8_t *dst, unsigned len)
+{
+#if defined(MAVLINK_FTP_MMAP)
+
+	if (_session_info.mapped) {
+		const unsigned bytes = (offset < _session_info.file_size) ? math::min(len, (unsigned)(_session_info.file_size - offset)) : 0;
+		memcpy(dst, &_session_info.mapped[offset], bytes);
+		return bytes;
+	}
+
+#endif // MAVLINK_FTP_MMAP
+
+	PX4_DEBUG("lseek with offset: %" PRIu32, offset);
+
+	if (lseek(_session_info.fd, offset, SEEK_SET) < 0) {
 		_our_errno = errno;
 		PX4_ERR("seek fail: %s", strerror(_our_errno));
-		return kErrFailErrno;
+		return -1;
 	}
 
-	int bytes_read = ::read(_session_info.fd, &payload->data[0], payload->size);
+	int bytes_read = ::read(_session_info.fd, dst, len);
 
 	if (bytes_read < 0) {
 		// Negative return indicates error other than eof
 		_our_errno = errno;
-		PX4_ERR("read fail %d, %s", bytes_read, strerror(_our_errno));
-		return kErrFailErrno;
 	}
 
-	payload->size = bytes_read;
+	return bytes_read;
+}
 
-	return kErrNone;
+void
+MavlinkFTP::_closeSession()
+{
+	if (_session_info.fd < 0) {
+		return;
+	}
+
+#if defined(MAVLINK_FTP_MMAP)
+
+	if (_session_info.mapped) {
+		munmap(_session_info.mapped, _session_info.file_size);
+		_session_info.mapped = nullptr;
+	}
+
+#endif // MAVLINK_FTP_MMAP
+
+	::close(_session_info.fd);
+	_session_info.fd = -1;
+	_session_info.stream_download = false;
 }
 
 /// @brief Responds to a Stream command
@@ -606,6 +734,18 @@ MavlinkFTP::_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t
 	}
 
 	PX4_DEBUG("FTP: burst offset:%" PRIu32, payload->offset);
+
+	// continuing where the previous burst ended means nothing was lost, the link can take longer bursts
+	if (_session_info.stream_burst_size == 0) {
+		_session_info.stream_burst_size = kBurstSizeDefault;
+
+	} else if (payload->offset == _session_info.stream_offset) {
+		_session_info.stream_burst_size = math::min(_session_info.stream_burst_size * 2, kBurstSizeMax);
+
+	} else if (payload->offset < _session_info.stream_offset) {
+		_session_info.stream_burst_size = math::max(_session_info.stream_burst_size / 2, kBurstSizeMin);
+	}
+
 	// Setup for streaming sends
 	_session_info.stream_download = true;
 	_session_info.stream_offset = payload->offset;
@@ -801,9 +941,7 @@ MavlinkFTP::_workTerminate(PayloadHeader *payload)
 	}
 
 	PX4_DEBUG("work terminate: close");
-	::close(_session_info.fd);
-	_session_info.fd = -1;
-	_session_info.stream_download = false;
+	_closeSession();
 
 	payload->size = 0;
 
@@ -816,11 +954,7 @@ MavlinkFTP::_workReset(PayloadHeader *payload)
 {
 	PX4_DEBUG("work reset: close");
 
-	if (_session_info.fd != -1) {
-		::close(_session_info.fd);
-		_session_info.fd = -1;
-		_session_info.stream_download = false;
-	}
+	_closeSession();
 
 	payload->size = 0;
 
@@ -1036,9 +1170,7 @@ void MavlinkFTP::send()
 	} else if (_session_info.fd != -1) {
 		// close session without activity
 		if (hrt_elapsed_time(&_last_work_buffer_access) > 10_s) {
-			::close(_session_info.fd);
-			_session_info.fd = -1;
-			_session_info.stream_download = false;
+			_closeSession();
 			_last_reply_valid = false;
 			PX4_WARN("Session was closed without activity");
 		}
@@ -1088,14 +1220,7 @@ void MavlinkFTP::send()
 		}
 
 		if (error_code == kErrNone) {
-			if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
-				error_code = kErrFailErrno;
-				PX4_WARN("stream download: seek fail");
-			}
-		}
-
-		if (error_code == kErrNone) {
-			int bytes_read = ::read(_session_info.fd, &payload->data[0], kMaxDataLength);
+			int bytes_read = _readSession(payload->offset, &payload->data[0], kMaxDataLength);
 
 			if (bytes_read < 0) {
 				// Negative return indicates error other than eof
@@ -1128,8 +1253,7 @@ void MavlinkFTP::send()
 			if (max_bytes_to_send < (get_size() * 2)) {
 				more_data = false;
 
-				/* perform transfers in 35K chunks - this is determined empirical */
-				if (_session_info.stream_chunk_transmitted > 35000) {
+				if (_session_info.stream_chunk_transmitted > _session_info.stream_burst_size) {
 					payload->burst_complete = true;
 					_session_info.stream_download = false;
 					_session_info.stream_chunk_transmitted = 0;
@@ -45,6 +45,10 @@
 
 #include "mavlink_bridge_header.h"
 
+#if defined(__PX4_POSIX)
+# define MAVLINK_FTP_MMAP ///< serve downloads from memory mapped files
+#endif // __PX4_POSIX
+
 class MavlinkFtpTest;
 class Mavlink;
 
@@ -147,6 +151,21 @@ private:
 	ErrorCode	_workRename(PayloadHeader *payload);
 	ErrorCode	_workCalcFileCRC32(PayloadHeader *payload);
 
+	/**
+	 * Export all non-default parameters for the virtual file kParamFilePath,
+	 * the export is kept and only regenerated when the parameter hash changes.
+	 * @return true if the export file is up to date
+	 */
+	bool		_exportParams();
+
+	/**
+	 * Read from the open session at an offset
+	 * @return number of bytes read, -1 on error (_our_errno is set)
+	 */
+	int		_readSession(uint32_t offset, uint8_t *dst, unsigned len);
+
+	void		_closeSession();
+
 	uint8_t _getServerSystemId(void);
 	uint8_t _getServerComponentId(void);
 	uint8_t _getServerChannel(void);
@@ -168,6 +187,15 @@ private:
 	static const char	kDirentDir = 'D';	///< Identifies Directory returned from List command
 	static const char	kDirentSkip = 'S';	///< Identifies Skipped entry from List command
 
+	// the burst size grows while bursts complete without the client requesting missing data and shrinks otherwise
+	static constexpr unsigned kBurstSizeMin = 8192;
+	static constexpr unsigned kBurstSizeDefault = 35000; ///< determined empirically
+#if defined(__PX4_POSIX)
+	static constexpr unsigned kBurstSizeMax = 4 * 1024 * 1024;
+#else
+	static constexpr unsigned kBurstSizeMax = kBurstSizeDefault;
+#endif
+
 	/// @brief Maximum data size in RequestHeader::data
 	static const uint8_t	kMaxDataLength = MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN - sizeof(PayloadHeader);
 
@@ -180,6 +208,10 @@ private:
 		uint8_t		stream_target_system_id;
 		uint8_t         stream_target_component_id;
 		unsigned	stream_chunk_transmitted;
+		unsigned	stream_burst_size;	///< bytes sent per burst, adapted to the link, 0 before the first burst
+#if defined(MAVLINK_FTP_MMAP)
+		uint8_t		*mapped;		///< read only files are memory mapped if possible
+#endif // MAVLINK_FTP_MMAP
 	};
 	struct SessionInfo _session_info {};	///< Session info, fd=-1 for no active session
 
@@ -208,6 +240,10 @@ private:
 #endif
 	static constexpr const int _root_dir_len = sizeof(_root_dir) - 1;
 
+	// a download of the virtual file kParamFilePath serves all non-default parameters (BSON, see param_export())
+	static constexpr const char kParamFilePath[] = "@PARAM/param.bson";
+	static constexpr const char kParamExportFile[] = PX4_STORAGEDIR "/ftp_param.bson";
+
 	bool _last_reply_valid = false;
 	uint8_t _last_reply[MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL_LEN - MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN
 								      + sizeof(PayloadHeader) + sizeof(uint32_t)];
@@ -57,6 +57,7 @@
 #include <px4_platform_common/events.h>
 
 #include <uORB/topics/event.h>
+#include "mavlink_message_cache.h"
 #include "mavlink_receiver.h"
 #include "mavlink_main.h"
 
@@ -418,6 +419,11 @@ Mavlink::get_status_all_instances(bool show_streams_status)
 		}
 	}
 
+	if (iterations > 0 && !show_streams_status) {
+		printf("\n");
+		MavlinkMessageCache::print_status();
+	}
+
 	/* return an error if there are no instances */
 	return (iterations == 0);
 }
@@ -737,7 +743,13 @@ Mavlink::get_free_tx_buf()
 
 void Mavlink::send_start(int length)
 {
-	pthread_mutex_lock(&_send_mutex);
+	// the receive thread sends replies (acks, mission, ftp, parameters) concurrently to the main loop
+	if (pthread_mutex_trylock(&_send_mutex) != 0) {
+		pthread_mutex_lock(&_send_mutex);
+		_send_lock_contended++;
+	}
+
+	_send_lock_count++;
 	_last_write_try_time = hrt_absolute_time();
 
 	// check if there is space in the buffer
@@ -773,6 +785,18 @@ void Mavlink::send_finish()
 
 	else if (get_protocol() == Protocol::UDP) {
 
+# if defined(MAVLINK_UDP_SENDMMSG)
+
+		if (_udp_batching) {
+			// counted when the batch is sent
+			udp_batch_queue();
+			_buf_fill = 0;
+			pthread_mutex_unlock(&_send_mutex);
+			return;
+		}
+
+# endif // MAVLINK_UDP_SENDMMSG
+
 # if defined(CONFIG_NET)
 
 		if (_src_addr_initialized) {
@@ -836,6 +860,123 @@ void Mavlink::send_bytes(const uint8_t *buf, unsigned packet_len)
 	}
 }
 
+#if defined(MAVLINK_UDP_SENDMMSG)
+void Mavlink::udp_batch_begin()
+{
+	if (get_protocol() == Protocol::UDP) {
+		pthread_mutex_lock(&_send_mutex);
+		_udp_batching = true;
+		pthread_mutex_unlock(&_send_mutex);
+	}
+}
+
+void Mavlink::udp_batch_end()
+{
+	pthread_mutex_lock(&_send_mutex);
+	udp_batch_flush();
+	_udp_batching = false;
+	pthread_mutex_unlock(&_send_mutex);
+}
+
+void Mavlink::udp_batch_queue()
+{
+	if (_udp_batch_count == 0) {
+		_udp_batch_first = _last_write_try_time;
+	}
+
+	memcpy(_udp_batch_buf[_udp_batch_count], _buf, _buf_fill);
+	_udp_batch_len[_udp_batch_count] = _buf_fill;
+	_udp_batch_count++;
+
+	// do not hold back datagrams for long, e.g. while a stream sends many messages at once
+	if ((_udp_batch_count == UDP_BATCH_SIZE) || (hrt_elapsed_time(&_udp_batch_first) > UDP_BATCH_MAX_DELAY)) {
+		udp_batch_flush();
+	}
+}
+
+void Mavlink::udp_batch_flush()
+{
+	if (_udp_batch_count == 0) {
+		return;
+	}
+
+	// every datagram goes to the partner and optionally to the broadcast address
+	iovec iov[UDP_BATCH_SIZE];
+	mmsghdr msgs[UDP_BATCH_SIZE * 2] {};
+	int num_msgs = 0;
+
+	for (int i = 0; i < _udp_batch_count; i++) {
+		iov[i].iov_base = _udp_batch_buf[i];
+		iov[i].iov_len = _udp_batch_len[i];
+
+		msgs[num_msgs].msg_hdr.msg_name = &_src_addr;
+		msgs[num_msgs].msg_hdr.msg_namelen = sizeof(_src_addr);
+		msgs[num_msgs].msg_hdr.msg_iov = &iov[i];
+		msgs[num_msgs].msg_hdr.msg_iovlen = 1;
+		num_msgs++;
+	}
+
+	bool broadcast = false;
+
+	if ((_mode != MAVLINK_MODE_ONBOARD) && broadcast_enabled() &&
+	    (!get_client_source_initialized() || !is_gcs_connected())) {
+
+		if (!_broadcast_address_found) {
+			find_broadcast_address();
+		}
+
+		if (_broadcast_address_found) {
+			broadcast = true;
+
+			for (int i = 0; i < _udp_batch_count; i++) {
+				msgs[num_msgs].msg_hdr.msg_name = &_bcast_addr;
+				msgs[num_msgs].msg_hdr.msg_namelen = sizeof(_bcast_addr);
+				msgs[num_msgs].msg_hdr.msg_iov = &iov[i];
+				msgs[num_msgs].msg_hdr.msg_iovlen = 1;
+				num_msgs++;
+			}
+		}
+	}
+
+	int sent = 0;
+
+	while (sent < num_msgs) {
+		const int ret = sendmmsg(_socket_fd, &msgs[sent], num_msgs - sent, 0);
+
+		if (ret <= 0) {
+			break;
+		}
+
+		sent += ret;
+	}
+
+	for (int i = 0; i < _udp_batch_count; i++) {
+		if ((i < sent) && (msgs[i].msg_len == _udp_batch_len[i])) {
+			_tstatus.tx_message_count++;
+			count_txbytes(_udp_batch_len[i]);
+			_last_write_success_time = _last_write_try_time;
+
+		} else {
+			count_txerrbytes(_udp_batch_len[i]);
+		}
+	}
+
+	if (broadcast) {
+		if (sent < num_msgs) {
+			if (!_broadcast_failed_warned) {
+				PX4_ERR("sending broadcast failed, errno: %d: %s", errno, strerror(errno));
+				_broadcast_failed_warned = true;
+			}
+
+		} else {
+			_broadcast_failed_warned = false;
+		}
+	}
+
+	_udp_batch_count = 0;
+}
+#endif // MAVLINK_UDP_SENDMMSG
+
 #ifdef MAVLINK_UDP
 void Mavlink::find_broadcast_address()
 {
@@ -1151,6 +1292,8 @@ Mavlink::configure_stream(const char *stream_name, const float rate)
 {
 	PX4_DEBUG("configure_stream(%s, %.3f)", stream_name, (double)rate);
 
+	_stream_scheduler.invalidate();
+
 	/* calculate interval in us, -1 means unlimited stream, 0 means disabled */
 	int interval = 0;
 
@@ -1233,9 +1376,8 @@ Mavlink::pass_message(const mavlink_message_t *msg)
 {
 	/* size is 12 bytes plus variable payload */
 	int size = MAVLINK_NUM_NON_PAYLOAD_BYTES + msg->len;
-	LockGuard lg{_message_buffer_mutex};
 
-	if (!_message_buffer.push_back(reinterpret_cast<const uint8_t *>(msg), size)) {
+	if (!_message_queue.push(reinterpret_cast<const uint8_t *>(msg), size)) {
 		perf_count(_forwarding_error_perf);
 	}
 }
@@ -1279,14 +1421,21 @@ Mavlink::update_rate_mult()
 {
 	float const_rate = 0.0f;
 	float rate = 0.0f;
+	float rate_high = 0.0f; // part of rate from the high rate streams
 
 	/* scale down rates if their theoretical bandwidth is exceeding the link bandwidth */
 	for (const auto &stream : _streams) {
+		const float stream_rate = (stream->get_interval() > 0) ? stream->get_size_avg() * 1000000.0f / stream->get_interval() : 0;
+
 		if (stream->const_rate()) {
-			const_rate += (stream->get_interval() > 0) ? stream->get_size_avg() * 1000000.0f / stream->get_interval() : 0;
+			const_rate += stream_rate;
 
 		} else {
-			rate += (stream->get_interval() > 0) ? stream->get_size_avg() * 1000000.0f / stream->get_interval() : 0;
+			rate += stream_rate;
+
+			if (stream->high_rate()) {
+				rate_high += stream_rate;
+			}
 		}
 	}
 
@@ -1335,11 +1484,57 @@ Mavlink::update_rate_mult()
 		PX4_ERR("instance %d: RADIO_STATUS timeout", _instance_id);
 	}
 
-	/* pick the minimum from bandwidth mult and hardware mult as limit */
-	_rate_mult = fminf(bandwidth_mult, hardware_mult);
+	if (_load_shedding_sub.updated()) {
+		load_shedding_s load_shedding;
+
+		if (_load_shedding_sub.copy(&load_shedding)) {
+			const bool shed = load_shedding.shed & load_shedding_s::SHED_MAVLINK;
 
+			if (shed != _load_shedding) {
+				PX4_INFO("instance %d: load shedding, %s stream rates", _instance_id, shed ? "reducing" : "restoring");
+				_load_shedding = shed;
+			}
+		}
+	}
+
+	// halve the total stream rate while shed, the high rate streams are reduced first like on a limited link
+	const float load_mult = _load_shedding ? 0.5f : 1.0f;
+
+	const float rate_mult_prev = _rate_mult;
+	const float rate_mult_high_rate_prev = _rate_mult_high_rate;
+
+	/* pick the minimum from bandwidth mult, hardware mult and load mult as limit */
 	/* ensure the rate multiplier never drops below 5% so that something is always sent */
-	_rate_mult = math::constrain(_rate_mult, 0.05f, 1.0f);
+	const float rate_mult = math::constrain(fminf(fminf(bandwidth_mult, hardware_mult), load_mult), 0.05f, 1.0f);
+
+	// the data rate the link permits goes to the normal streams first, so that the high rate streams are shed first
+	const float rate_normal = rate - rate_high;
+	const float rate_permitted = rate_mult * rate;
+
+	_rate_mult = (rate_normal > 0.f) ? math::constrain(rate_permitted / rate_normal, 0.05f, 1.0f) : rate_mult;
+	const float rate_mult_high_rate = (rate_high > 0.f) ? (rate_permitted - _rate_mult * rate_normal) / rate_high : rate_mult;
+
+	// keep room in the TX buffer for heartbeats, command acks, mission and parameter transfers,
+	// shed the high rate streams quickly while it is full and recover slowly
+	const hrt_abstime now = hrt_absolute_time();
+	const float dt = math::constrain((now - _rate_mult_last_update) * 1e-6f, 0.f, 0.1f);
+	_rate_mult_last_update = now;
+
+	if (get_free_tx_buf() < MAVLINK_MAX_PACKET_LEN) {
+		_tx_buffer_mult -= 2.f * dt;
+
+	} else {
+		_tx_buffer_mult += 0.2f * dt;
+	}
+
+	_tx_buffer_mult = math::constrain(_tx_buffer_mult, 0.05f, 1.0f);
+
+	_rate_mult_high_rate = math::constrain(rate_mult_high_rate * _tx_buffer_mult, 0.05f, 1.0f);
+
+	// the stream deadlines depend on the rate multiplier, small changes only shift them slightly
+	if ((fabsf(_rate_mult - rate_mult_prev) > 0.01f) || (fabsf(_rate_mult_high_rate - rate_mult_high_rate_prev) > 0.01f)) {
+		_stream_scheduler.invalidate();
+	}
 }
 
 void
@@ -2157,19 +2352,15 @@ Mavlink::task_main(int argc, char *argv[])
 		return PX4_ERROR;
 	}
 
-	pthread_mutex_init(&_message_buffer_mutex, nullptr);
 	pthread_mutex_init(&_send_mutex, nullptr);
 	pthread_mutex_init(&_radio_status_mutex, nullptr);
 
 	/* if we are passing on mavlink messages, we need to prepare a buffer for this instance */
 	if (get_forwarding_on()) {
-		/* initialize message buffer if multiplexing is on.
-		 * make space for two messages plus off-by-one space as we use the empty element
-		 * marker ring buffer approach.
+		/* initialize message queue if multiplexing is on.
+		 * forwarding instances push into it from their receive threads without locking.
 		 */
-		LockGuard lg{_message_buffer_mutex};
-
-		if (!_message_buffer.allocate(2 * sizeof(mavlink_message_t) + 1)) {
+		if (!_message_queue.allocate(MESSAGE_QUEUE_SLOTS)) {
 			PX4_ERR("msg buf alloc fail");
 			return PX4_ERROR;
 		}
@@ -2253,6 +2444,8 @@ Mavlink::task_main(int argc, char *argv[])
 		send_autopilot_capabilities();
 	}
 
+	_sign_control.start(get_instance_id(), get_status(), _is_usb_uart, _param_mav_sign_cfg.get());
+
 	_receiver.start();
 
 	uint16_t event_sequence_offset = 0; // offset to account for skipped events, not sent via MAVLink
@@ -2261,9 +2454,22 @@ Mavlink::task_main(int argc, char *argv[])
 
 	_task_running.store(true);
 
+	hrt_abstime next_stream_update = 0;
+
 	while (!should_exit()) {
-		/* main loop */
-		px4_usleep(_main_loop_delay);
+		/* main loop, sleep until the next stream is due */
+		unsigned sleep_time = _main_loop_delay;
+
+		if (next_stream_update != 0) {
+			const hrt_abstime now = hrt_absolute_time();
+
+			if (next_stream_update > now) {
+				sleep_time = math::constrain(next_stream_update - now, (hrt_abstime)MAVLINK_MIN_INTERVAL,
+							     (hrt_abstime)_main_loop_delay);
+			}
+		}
+
+		px4_usleep(sleep_time);
 
 		if (!should_transmit()) {
 			check_requested_subscriptions();
@@ -2290,6 +2496,8 @@ Mavlink::task_main(int argc, char *argv[])
 			mavlink_update_parameters();
 		}
 
+		_sign_control.update(_param_mav_sign_cfg.get());
+
 		configure_sik_radio();
 
 		handleStatus();
@@ -2313,11 +2521,16 @@ Mavlink::task_main(int argc, char *argv[])
 
 		check_requested_subscriptions();
 
-		/* update streams */
-		for (const auto &stream : _streams) {
-			stream->update(t);
+#if defined(MAVLINK_UDP_SENDMMSG)
+		// acks and shell output above are sent right away, the streams, events and forwarded messages are batched
+		udp_batch_begin();
+#endif // MAVLINK_UDP_SENDMMSG
 
-			if (!_first_heartbeat_sent) {
+		/* update streams that are due */
+		next_stream_update = _stream_scheduler.update(_streams, t);
+
+		if (!_first_heartbeat_sent) {
+			for (const auto &stream : _streams) {
 				if (_mode == MAVLINK_MODE_IRIDIUM) {
 					if (stream->get_id() == MAVLINK_MSG_ID_HIGH_LATENCY2) {
 						_first_heartbeat_sent = stream->first_message_sent();
@@ -2376,22 +2589,19 @@ Mavlink::task_main(int argc, char *argv[])
 		/* pass messages from other instances */
 		if (get_forwarding_on()) {
 
+			// We only send one message at a time, not to put too much strain on a
+			// link from forwarded messages.
 			mavlink_message_t msg;
-			size_t available_bytes;
-			{
-				// We only send one message at a time, not to put too much strain on a
-				// link from forwarded messages.
-				LockGuard lg{_message_buffer_mutex};
-				available_bytes = _message_buffer.pop_front(reinterpret_cast<uint8_t *>(&msg), sizeof(msg));
-				// We need to make sure to release the lock here before sending the
-				// bytes out via IP or UART which could potentially take longer.
-			}
 
-			if (available_bytes > 0) {
+			if (_message_queue.pop(reinterpret_cast<uint8_t *>(&msg), sizeof(msg)) > 0) {
 				resend_message(&msg);
 			}
 		}
 
+#if defined(MAVLINK_UDP_SENDMMSG)
+		udp_batch_end();
+#endif // MAVLINK_UDP_SENDMMSG
+
 		/* update TX/RX rates*/
 		if (t > _bytes_timestamp + 1_s) {
 			if (_bytes_timestamp != 0) {
@@ -2419,10 +2629,13 @@ Mavlink::task_main(int argc, char *argv[])
 
 	_receiver.stop();
 
+	_sign_control.store_timestamp();
+
 	delete _subscribe_to_stream;
 	_subscribe_to_stream = nullptr;
 
 	/* delete streams */
+	_stream_scheduler.invalidate();
 	_streams.clear();
 
 	if (_uart_fd >= 0) {
@@ -2444,7 +2657,6 @@ Mavlink::task_main(int argc, char *argv[])
 
 	pthread_mutex_destroy(&_send_mutex);
 	pthread_mutex_destroy(&_radio_status_mutex);
-	pthread_mutex_destroy(&_message_buffer_mutex);
 
 	PX4_INFO("exiting channel %i", (int)_channel);
 
@@ -2703,6 +2915,7 @@ void Mavlink::publish_telemetry_status()
 	_tstatus.mode = _mode;
 	_tstatus.data_rate = _datarate;
 	_tstatus.rate_multiplier = _rate_mult;
+	_tstatus.rate_multiplier_high_rate = _rate_mult_high_rate;
 	_tstatus.flow_control = get_flow_control_enabled();
 	_tstatus.ftp = ftp_enabled();
 	_tstatus.forwarding = get_forwarding_on();
@@ -2906,7 +3119,7 @@ Mavlink::display_status()
 	printf("\trates:\n");
 	printf("\t  tx: %.1f B/s\n", (double)_tstatus.tx_rate_avg);
 	printf("\t  txerr: %.1f B/s\n", (double)_tstatus.tx_error_rate_avg);
-	printf("\t  tx rate mult: %.3f\n", (double)_rate_mult);
+	printf("\t  tx rate mult: %.3f (high rate streams: %.3f)\n", (double)_rate_mult, (double)_rate_mult_high_rate);
 	printf("\t  tx rate max: %i B/s\n", _datarate);
 	printf("\t  rx: %.1f B/s\n", (double)_tstatus.rx_rate_avg);
 	printf("\t  rx loss: %.1f%%\n", (double)_tstatus.rx_message_lost_rate);
@@ -2930,7 +3143,15 @@ Mavlink::display_status()
 	}
 
 	printf("\tForwarding: %s\n", get_forwarding_on() ? "On" : "Off");
+
+	if (get_forwarding_on()) {
+		printf("\t  queue dropped: %" PRIu32 ", producer retries: %" PRIu32 "\n",
+		       _message_queue.dropped(), _message_queue.contended());
+	}
+
+	printf("\ttx lock contention: %" PRIu32 " of %" PRIu32 " sends\n", _send_lock_contended, _send_lock_count);
 	printf("\tMAVLink version: %" PRId32 "\n", _protocol_version);
+	_sign_control.print_status();
 
 	printf("\ttransport protocol: ");
 
@@ -2975,8 +3196,6 @@ Mavlink::display_status_streams()
 {
 	printf("\t%-20s%-16s %s\n", "Name", "Rate Config (current) [Hz]", "Message Size (if active) [B]");
 
-	const float rate_mult = _rate_mult;
-
 	for (const auto &stream : _streams) {
 		const int interval = stream->get_interval();
 		const unsigned size = stream->get_size();
@@ -2989,7 +3208,7 @@ Mavlink::display_status_streams()
 			float rate = 1000000.0f / (float)interval;
 			// Note that the actual current rate can be lower if the associated uORB topic updates at a
 			// lower rate.
-			float rate_current = stream->const_rate() ? rate : rate * rate_mult;
+			float rate_current = stream->const_rate() ? rate : rate * get_rate_mult(stream->high_rate());
 			snprintf(rate_str, sizeof(rate_str), "%6.2f (%.3f)", (double)rate, (double)rate_current);
 		}
 
@@ -60,7 +60,6 @@
 
 #include <containers/List.hpp>
 #include <parameters/param.h>
-#include <lib/variable_length_ringbuffer/VariableLengthRingbuffer.hpp>
 #include <perf/perf_counter.h>
 #include <px4_platform_common/cli.h>
 #include <px4_platform_common/px4_config.h>
@@ -72,6 +71,7 @@
 #include <uORB/Publication.hpp>
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/SubscriptionInterval.hpp>
+#include <uORB/topics/load_shedding.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/radio_status.h>
 #include <uORB/topics/telemetry_status.h>
@@ -81,9 +81,12 @@
 
 #include "mavlink_command_sender.h"
 #include "mavlink_events.h"
+#include "MavlinkMessageQueue.hpp"
 #include "mavlink_messages.h"
 #include "mavlink_receiver.h"
 #include "mavlink_shell.h"
+#include "mavlink_sign_control.h"
+#include "mavlink_stream_scheduler.h"
 #include "mavlink_ulog.h"
 
 #define DEFAULT_BAUD_RATE       57600
@@ -96,6 +99,11 @@
 # define DEFAULT_REMOTE_PORT_UDP 14550 ///< GCS port per MAVLink spec
 #endif // CONFIG_NET || __PX4_POSIX
 
+#if defined(MAVLINK_UDP) && defined(__PX4_LINUX)
+# define MAVLINK_UDP_SENDMMSG ///< batch the UDP datagrams of a main loop iteration
+# define MAVLINK_UDP_RECVMMSG ///< receive multiple UDP datagrams per poll
+#endif // MAVLINK_UDP && __PX4_LINUX
+
 enum class Protocol {
 	SERIAL = 0,
 #if defined(MAVLINK_UDP)
@@ -409,7 +417,10 @@ public:
 
 	List<MavlinkStream *> &get_streams() { return _streams; }
 
-	float			get_rate_mult() const { return _rate_mult; }
+	/**
+	 * @param high_rate rate multiplier of the high rate streams, which are shed first on a congested link
+	 */
+	float			get_rate_mult(bool high_rate = false) const { return high_rate ? _rate_mult_high_rate : _rate_mult; }
 
 	float			get_baudrate() { return _baudrate; }
 
@@ -473,6 +484,8 @@ public:
 
 	bool			is_usb_uart() { return _is_usb_uart; }
 
+	MavlinkSignControl	&sign_control() { return _sign_control; }
+
 	int			get_data_rate()		{ return _datarate; }
 	void			set_data_rate(int rate) { if (rate > 0) { _datarate = rate; } }
 
@@ -499,6 +512,8 @@ public:
 	bool hash_check_enabled() const { return _param_mav_hash_chk_en.get(); }
 	bool forward_heartbeats_enabled() const { return _param_mav_hb_forw_en.get(); }
 
+	uint16_t mission_request_window() const { return _param_mav_mis_window.get() > 1 ? _param_mav_mis_window.get() : 1; }
+
 	bool failure_injection_enabled() const { return _param_sys_failure_injection_enabled.get(); }
 
 	struct ping_statistics_s {
@@ -539,6 +554,7 @@ private:
 	uORB::PublicationMulti<telemetry_status_s> _telemetry_status_pub{ORB_ID(telemetry_status)};
 
 	uORB::Subscription _event_sub{ORB_ID(event)};
+	uORB::Subscription _load_shedding_sub{ORB_ID(load_shedding)};
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 	uORB::Subscription _vehicle_command_sub{ORB_ID(vehicle_command)};
 	uORB::Subscription _vehicle_command_ack_sub{ORB_ID(vehicle_command_ack)};
@@ -553,6 +569,7 @@ private:
 
 	mavlink_message_t	_mavlink_buffer {};
 	mavlink_status_t	_mavlink_status {};
+	MavlinkSignControl	_sign_control{};
 
 	/* states */
 	bool			_hil_enabled{false};		/**< Hardware In the Loop mode */
@@ -565,6 +582,7 @@ private:
 	unsigned		_main_loop_delay{1000};	/**< mainloop delay, depends on data rate */
 
 	List<MavlinkStream *>		_streams;
+	MavlinkStreamScheduler		_stream_scheduler;
 
 	MavlinkShell		*_mavlink_shell{nullptr};
 	MavlinkULog		*_mavlink_ulog{nullptr};
@@ -584,6 +602,10 @@ private:
 	int			_baudrate{57600};
 	int			_datarate{1000};		///< data rate for normal streams (attitude, position, etc.)
 	float			_rate_mult{1.0f};
+	float			_rate_mult_high_rate{1.0f};	///< rate multiplier of the high rate streams (above 10 Hz)
+	float			_tx_buffer_mult{1.0f};		///< sheds high rate streams while the TX buffer is full
+	hrt_abstime		_rate_mult_last_update{0};
+	bool			_load_shedding{false};		///< stream rates halved by load_mon (SYS_SHED_MAV)
 	float			_high_latency_freq{0.015f};	///< frequency of HIGH_LATENCY2 stream
 
 	bool			_radio_status_available{false};
@@ -633,6 +655,17 @@ private:
 	uint8_t			_buf[MAVLINK_MAX_PACKET_LEN] {};
 	unsigned		_buf_fill{0};
 
+#if defined(MAVLINK_UDP_SENDMMSG)
+	static constexpr int UDP_BATCH_SIZE = 16;
+	static constexpr hrt_abstime UDP_BATCH_MAX_DELAY = 1_ms; ///< flush when the oldest queued datagram is older
+
+	uint8_t			_udp_batch_buf[UDP_BATCH_SIZE][MAVLINK_MAX_PACKET_LEN] {};
+	unsigned		_udp_batch_len[UDP_BATCH_SIZE] {};
+	int			_udp_batch_count{0};
+	hrt_abstime		_udp_batch_first{0};
+	bool			_udp_batching{false};
+#endif // MAVLINK_UDP_SENDMMSG
+
 	bool			_tx_buffer_low{false};
 
 	const char 		*_interface_name{nullptr};
@@ -646,10 +679,12 @@ private:
 
 	ping_statistics_s	_ping_stats {};
 
-	pthread_mutex_t		_message_buffer_mutex{};
-	VariableLengthRingbuffer _message_buffer{};
+	static constexpr size_t MESSAGE_QUEUE_SLOTS = 4;
+	MavlinkMessageQueue<sizeof(mavlink_message_t)> _message_queue{};	///< messages forwarded from other instances
 
 	pthread_mutex_t		_send_mutex {};
+	uint32_t		_send_lock_count{0};		///< number of send_start() calls, protected by _send_mutex
+	uint32_t		_send_lock_contended{0};	///< send_start() calls that had to wait for _send_mutex
 	pthread_mutex_t         _radio_status_mutex {};
 
 	DEFINE_PARAMETERS(
@@ -662,7 +697,9 @@ private:
 		(ParamBool<px4::params::MAV_FWDEXTSP>) _param_mav_fwdextsp,
 		(ParamBool<px4::params::MAV_HASH_CHK_EN>) _param_mav_hash_chk_en,
 		(ParamBool<px4::params::MAV_HB_FORW_EN>) _param_mav_hb_forw_en,
+		(ParamInt<px4::params::MAV_SIGN_CFG>) _param_mav_sign_cfg,
 		(ParamInt<px4::params::MAV_RADIO_TOUT>)      _param_mav_radio_timeout,
+		(ParamInt<px4::params::MAV_MIS_WINDOW>) _param_mav_mis_window,
 		(ParamInt<px4::params::SYS_HITL>) _param_sys_hitl,
 		(ParamBool<px4::params::SYS_FAILURE_EN>) _param_sys_failure_injection_enabled
 	)
@@ -731,6 +768,17 @@ private:
 	void init_udp();
 #endif // MAVLINK_UDP
 
+#if defined(MAVLINK_UDP_SENDMMSG)
+	/**
+	 * Queue the UDP datagrams sent until udp_batch_end() and send them with a single sendmmsg()
+	 */
+	void udp_batch_begin();
+	void udp_batch_end();
+
+	void udp_batch_queue();
+	void udp_batch_flush();
+#endif // MAVLINK_UDP_SENDMMSG
+
 
 	bool set_channel();
 
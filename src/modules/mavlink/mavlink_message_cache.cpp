@@ -0,0 +1,133 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_message_cache.cpp
+ * Packed message payloads shared by all mavlink instances.
+ */
+
+#include "mavlink_message_cache.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <containers/LockGuard.hpp>
+
+pthread_mutex_t MavlinkMessageCache::_mutex = PTHREAD_MUTEX_INITIALIZER;
+MavlinkMessageCache::Slot MavlinkMessageCache::_slots[MavlinkMessageCache::NUM_SLOTS] {};
+uint32_t MavlinkMessageCache::_hits = 0;
+uint32_t MavlinkMessageCache::_misses = 0;
+
+MavlinkMessageCache::Slot *
+MavlinkMessageCache::find(uint32_t msgid)
+{
+	for (Slot &slot : _slots) {
+		if (slot.valid && (slot.msgid == msgid)) {
+			return &slot;
+		}
+	}
+
+	return nullptr;
+}
+
+bool
+MavlinkMessageCache::send(mavlink_channel_t chan, uint32_t msgid, unsigned generation)
+{
+	const mavlink_msg_entry_t *entry = mavlink_get_msg_entry(msgid);
+
+	if (entry == nullptr || entry->max_msg_len > MAX_PAYLOAD_LEN) {
+		return false;
+	}
+
+	uint8_t payload[MAX_PAYLOAD_LEN];
+
+	{
+		LockGuard lg{_mutex};
+
+		const Slot *slot = find(msgid);
+
+		if (slot == nullptr || slot->generation != generation) {
+			_misses++;
+			return false;
+		}
+
+		memcpy(payload, slot->payload, entry->max_msg_len);
+		_hits++;
+	}
+
+	// the payload is independent of the link, only header, sequence and CRC are per channel
+	_mav_finalize_message_chan_send(chan, msgid, (const char *)payload, entry->min_msg_len, entry->max_msg_len,
+					entry->crc_extra);
+
+	return true;
+}
+
+void
+MavlinkMessageCache::store(uint32_t msgid, unsigned generation, const void *payload, size_t len)
+{
+	const mavlink_msg_entry_t *entry = mavlink_get_msg_entry(msgid);
+
+	if (entry == nullptr || entry->max_msg_len > MAX_PAYLOAD_LEN || len != entry->max_msg_len) {
+		return;
+	}
+
+	LockGuard lg{_mutex};
+
+	Slot *slot = find(msgid);
+
+	if (slot == nullptr) {
+		// take a free slot or replace one, the table is small and the cached message ids fixed
+		slot = &_slots[msgid % NUM_SLOTS];
+
+		for (Slot &s : _slots) {
+			if (!s.valid) {
+				slot = &s;
+				break;
+			}
+		}
+	}
+
+	slot->msgid = msgid;
+	slot->generation = generation;
+	slot->valid = true;
+	memcpy(slot->payload, payload, len);
+}
+
+void
+MavlinkMessageCache::print_status()
+{
+	LockGuard lg{_mutex};
+
+	printf("message cache: %" PRIu32 " hits, %" PRIu32 " misses\n", _hits, _misses);
+}
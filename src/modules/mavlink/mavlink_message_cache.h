@@ -0,0 +1,94 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_message_cache.h
+ * Packed message payloads shared by all mavlink instances.
+ *
+ * Streams that are active on several links pack the same uORB sample once per link.
+ * The first instance stores the packed payload together with the uORB generation it
+ * was created from, the other instances then only finalize it for their channel
+ * (header, sequence and CRC) instead of converting and packing it again.
+ */
+
+#pragma once
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mavlink_bridge_header.h"
+
+class MavlinkMessageCache
+{
+public:
+	static constexpr size_t MAX_PAYLOAD_LEN = 64; ///< larger messages are not cached
+	static constexpr int NUM_SLOTS = 8;
+
+	/**
+	 * Send a cached message on a channel
+	 *
+	 * @param chan channel to send on
+	 * @param msgid message id
+	 * @param generation uORB generation of the sample the message is created from
+	 * @return true if the message was cached and sent, false if the caller has to pack and send it itself
+	 */
+	static bool send(mavlink_channel_t chan, uint32_t msgid, unsigned generation);
+
+	/**
+	 * Store a packed payload after it was sent
+	 *
+	 * @param msgid message id
+	 * @param generation uORB generation of the sample the message was created from
+	 * @param payload message struct (mavlink_xxx_t) as passed to mavlink_msg_xxx_send_struct()
+	 * @param len size of the message struct
+	 */
+	static void store(uint32_t msgid, unsigned generation, const void *payload, size_t len);
+
+	static void print_status();
+
+private:
+	struct Slot {
+		uint32_t msgid;
+		unsigned generation;
+		bool valid;
+		uint8_t payload[MAX_PAYLOAD_LEN];
+	};
+
+	static Slot *find(uint32_t msgid);
+
+	static pthread_mutex_t _mutex;
+	static Slot _slots[NUM_SLOTS];
+	static uint32_t _hits;
+	static uint32_t _misses;
+};
@@ -40,6 +40,7 @@
  */
 
 #include "mavlink_main.h"
+#include "mavlink_message_cache.h"
 #include "mavlink_messages.h"
 #include "mavlink_command_sender.h"
 #include "mavlink_simple_analyzer.h"
@@ -436,6 +436,23 @@ MavlinkMissionManager::get_current_mission_type_crc()
 	return _crc32[_mission_type];
 }
 
+void
+MavlinkMissionManager::request_mission_items(bool restart)
+{
+	if (restart || (_transfer_requested_seq < _transfer_seq)) {
+		_transfer_requested_seq = _transfer_seq;
+	}
+
+	// a restart only re-requests the missing item, the window refills once it arrives
+	const uint32_t window = restart ? 1 : _mavlink.mission_request_window();
+	const uint32_t end = math::min(static_cast<uint32_t>(_transfer_count), _transfer_seq + window);
+
+	while (_transfer_requested_seq < end) {
+		send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_requested_seq);
+		_transfer_requested_seq++;
+	}
+}
+
 void
 MavlinkMissionManager::send_mission_request(uint8_t sysid, uint8_t compid, uint16_t seq)
 {
@@ -557,7 +574,7 @@ MavlinkMissionManager::send()
 	    && hrt_elapsed_time(&_time_last_sent) > MAVLINK_MISSION_RETRY_TIMEOUT_DEFAULT) {
 
 		// try to request item again after timeout
-		send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_seq);
+		request_mission_items(true);
 
 	} else if (_state != MAVLINK_WPM_STATE_IDLE && (_time_last_recv > 0)
 		   && hrt_elapsed_time(&_time_last_recv) > MAVLINK_MISSION_PROTOCOL_TIMEOUT_DEFAULT) {
@@ -656,11 +673,11 @@ MavlinkMissionManager::handle_mission_ack(const mavlink_message_t *msg)
 
 					if (_int_mode) {
 						_int_mode = false;
-						send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_seq);
+						request_mission_items(true);
 
 					} else {
 						_int_mode = true;
-						send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_seq);
+						request_mission_items(true);
 					}
 
 				} else if (wpa.type == MAV_MISSION_OPERATION_CANCELLED) {
@@ -983,6 +1000,8 @@ MavlinkMissionManager::handle_mission_count(const mavlink_message_t *msg)
 
 			_state = MAVLINK_WPM_STATE_GETLIST;
 			_transfer_seq = 0;
+			_transfer_requested_seq = 0;
+			_transfer_batch_count = 0;
 			_transfer_partner_sysid = msg->sysid;
 			_transfer_partner_compid = msg->compid;
 			_transfer_count = wpc.count;
@@ -1018,7 +1037,8 @@ MavlinkMissionManager::handle_mission_count(const mavlink_message_t *msg)
 			return;
 		}
 
-		send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_seq);
+		// start with a full window, a repeated MISSION_COUNT means the first requests got lost
+		request_mission_items(_transfer_requested_seq > 0);
 	}
 }
 
@@ -1142,9 +1162,14 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 
 				} else {
 
-					write_failed = !_dataman_client.writeSync(_transfer_dataman_id, wp.seq,
-							reinterpret_cast<uint8_t *>(&mission_item),
-							sizeof(struct mission_item_s));
+					// write the items in batches, the last one completes the transfer
+					_transfer_batch[_transfer_batch_count++] = mission_item;
+
+					if ((_transfer_batch_count == TRANSFER_BATCH_SIZE) || (wp.seq + 1 == _transfer_count)) {
+						write_failed = !_dataman_client.writeBatchSync(_transfer_dataman_id, wp.seq + 1 - _transfer_batch_count,
+								_transfer_batch_count, reinterpret_cast<uint8_t *>(_transfer_batch), sizeof(struct mission_item_s));
+						_transfer_batch_count = 0;
+					}
 
 					// Check for land start marker
 					if ((mission_item.nav_cmd == MAV_CMD_DO_LAND_START) && (_transfer_land_start_marker == -1)) {
@@ -1295,8 +1320,8 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 			_transfer_in_progress = false;
 
 		} else {
-			/* request next item */
-			send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_seq);
+			/* request next items */
+			request_mission_items();
 		}
 	}
 }
@@ -126,6 +126,7 @@ private:
 	uint16_t		_transfer_count{0};			///< Items count in current transmission
 	uint32_t		_transfer_current_crc32{0};		///< Current CRC32 checksum of current transmission
 	uint16_t		_transfer_seq{0};			///< Item sequence in current transmission
+	uint16_t		_transfer_requested_seq{0};		///< One past the highest item requested in current transmission
 
 	int32_t			_transfer_current_seq{-1};		///< Current item ID for current transmission (-1 means not initialized)
 
@@ -134,6 +135,10 @@ private:
 	int32_t 		_transfer_land_start_marker{-1}; 	///< index of land start mission item in current transmission (if unavailable, index of land mission item, -1 otherwise)
 	int32_t 		_transfer_land_marker{-1}; 		///< index of land mission item in current transmission (-1 if unavailable)
 
+	static constexpr uint16_t TRANSFER_BATCH_SIZE = 16;		///< Number of received mission items written to dataman at once
+	mission_item_s		_transfer_batch[TRANSFER_BATCH_SIZE] {};	///< Received mission items not written yet
+	uint16_t		_transfer_batch_count{0};		///< Number of items in _transfer_batch
+
 	static bool		_transfer_in_progress;			///< Global variable checking for current transmission
 
 	uORB::Subscription	_mission_result_sub{ORB_ID(mission_result)};
@@ -210,6 +215,16 @@ private:
 
 	void send_mission_request(uint8_t sysid, uint8_t compid, uint16_t seq);
 
+	/**
+	 *  @brief Requests the next items of an upload, keeping up to MAV_MIS_WINDOW requests outstanding
+	 *
+	 *  Items are only accepted in order, so after a retry or loss the items requested after
+	 *  the missing one are dropped and requested again (go-back-N).
+	 *
+	 *  @param restart Request only the next expected item again, e.g. after a retry timeout
+	 */
+	void request_mission_items(bool restart = false);
+
 	/**
 	 *  @brief emits a message that a waypoint reached
 	 *
@@ -131,6 +131,20 @@ PARAM_DEFINE_INT32(MAV_FWDEXTSP, 1);
  */
 PARAM_DEFINE_INT32(MAV_HASH_CHK_EN, 1);
 
+/**
+ * MAVLink message signing.
+ *
+ * Sign outgoing MAVLink 2 messages and only accept signed incoming messages (except RADIO_STATUS).
+ * The key is set with the SETUP_SIGNING message over USB (or over a link already signed with the
+ * previous key) and stored on the SD card. Signing is only active once a key is stored.
+ *
+ * @value 0 Disabled
+ * @value 1 Enabled on all links except USB
+ * @value 2 Enabled on all links
+ * @group MAVLink
+ */
+PARAM_DEFINE_INT32(MAV_SIGN_CFG, 0);
+
 /**
  * Heartbeat message forwarding.
  *
@@ -155,3 +169,18 @@ PARAM_DEFINE_INT32(MAV_HB_FORW_EN, 1);
  * @max 250
  */
 PARAM_DEFINE_INT32(MAV_RADIO_TOUT, 5);
+
+/**
+ * Mission upload request window
+ *
+ * Number of mission items the vehicle requests ahead during a mission upload
+ * without waiting for the previous item to arrive. A window of 1 is the classic
+ * one-request-per-item protocol, larger windows hide the link round trip time and
+ * speed up the upload of large missions over slow telemetry radios.
+ * The ground station has to answer every MISSION_REQUEST_INT it receives.
+ *
+ * @group MAVLink
+ * @min 1
+ * @max 32
+ */
+PARAM_DEFINE_INT32(MAV_MIS_WINDOW, 1);
@@ -156,6 +156,10 @@ MavlinkReceiver::handle_message(mavlink_message_t *msg)
 		handle_message_ping(msg);
 		break;
 
+	case MAVLINK_MSG_ID_SETUP_SIGNING:
+		_mavlink->sign_control().setup_signing(msg);
+		break;
+
 	case MAVLINK_MSG_ID_SET_MODE:
 		handle_message_set_mode(msg);
 		break;
@@ -2587,6 +2591,15 @@ MavlinkReceiver::handle_message_gps_rtcm_data(mavlink_message_t *msg)
 	mavlink_gps_rtcm_data_t gps_rtcm_data_msg;
 	mavlink_msg_gps_rtcm_data_decode(msg, &gps_rtcm_data_msg);
 
+	// pass the data to the GPS drivers without a uORB message per fragment
+	RtcmStream *rtcm_stream = RtcmStream::instance();
+
+	if (rtcm_stream != nullptr) {
+		rtcm_stream->write(_mavlink->get_instance_id(), gps_rtcm_data_msg.data,
+				   math::min((int)sizeof(gps_rtcm_data_msg.data), (int)gps_rtcm_data_msg.len));
+		return;
+	}
+
 	gps_inject_data_s gps_inject_data_topic{};
 
 	gps_inject_data_topic.timestamp = hrt_absolute_time();
@@ -3075,8 +3088,6 @@ MavlinkReceiver::run()
 	/* the serial port buffers internally as well, we just need to fit a small chunk */
 	uint8_t buf[64];
 #endif
-	mavlink_message_t msg;
-
 	struct pollfd fds[1] = {};
 
 	if (_mavlink.get_protocol() == Protocol::SERIAL) {
@@ -3085,8 +3096,30 @@ MavlinkReceiver::run()
 	}
 
 #if defined(MAVLINK_UDP)
-	struct sockaddr_in srcaddr = {};
-	socklen_t addrlen = sizeof(srcaddr);
+# if defined(MAVLINK_UDP_RECVMMSG)
+	// receive up to one datagram per MTU sized part of the buffer
+	static constexpr int UDP_RECV_BATCH = 5;
+# else
+	static constexpr int UDP_RECV_BATCH = 1;
+# endif // MAVLINK_UDP_RECVMMSG
+	static constexpr size_t UDP_DATAGRAM_SIZE = sizeof(buf) / UDP_RECV_BATCH;
+
+	struct sockaddr_in srcaddr[UDP_RECV_BATCH] = {};
+	ssize_t datagram_len[UDP_RECV_BATCH] = {};
+
+# if defined(MAVLINK_UDP_RECVMMSG)
+	struct iovec iov[UDP_RECV_BATCH] = {};
+	struct mmsghdr datagrams[UDP_RECV_BATCH] = {};
+
+	for (int i = 0; i < UDP_RECV_BATCH; i++) {
+		iov[i].iov_base = &buf[i * UDP_DATAGRAM_SIZE];
+		iov[i].iov_len = UDP_DATAGRAM_SIZE;
+		datagrams[i].msg_hdr.msg_iov = &iov[i];
+		datagrams[i].msg_hdr.msg_iovlen = 1;
+		datagrams[i].msg_hdr.msg_name = &srcaddr[i];
+	}
+
+# endif // MAVLINK_UDP_RECVMMSG
 
 	if (_mavlink.get_protocol() == Protocol::UDP) {
 		fds[0].fd = _mavlink.get_socket_fd();
@@ -3095,7 +3128,6 @@ MavlinkReceiver::run()
 
 #endif // MAVLINK_UDP
 
-	ssize_t nread = 0;
 	hrt_abstime last_send_update = 0;
 
 	while (!_mavlink.should_exit()) {
@@ -3115,94 +3147,66 @@ MavlinkReceiver::run()
 		if (ret > 0) {
 			if (_mavlink.get_protocol() == Protocol::SERIAL) {
 				/* non-blocking read. read may return negative values */
-				nread = ::read(fds[0].fd, buf, sizeof(buf));
+				const ssize_t nread = ::read(fds[0].fd, buf, sizeof(buf));
 
 				if (nread == -1 && errno == ENOTCONN) { // Not connected (can happen for USB)
 					usleep(100000);
 				}
+
+				handle_received_bytes(buf, nread, false);
 			}
 
 #if defined(MAVLINK_UDP)
 
-			else if (_mavlink.get_protocol() == Protocol::UDP) {
-				if (fds[0].revents & POLLIN) {
-					nread = recvfrom(_mavlink.get_socket_fd(), buf, sizeof(buf), 0, (struct sockaddr *)&srcaddr, &addrlen);
-				}
-
-				struct sockaddr_in &srcaddr_last = _mavlink.get_client_source_address();
-
-				int localhost = (127 << 24) + 1;
-
-				if (!_mavlink.get_client_source_initialized()) {
+			else if ((_mavlink.get_protocol() == Protocol::UDP) && (fds[0].revents & POLLIN)) {
+# if defined(MAVLINK_UDP_RECVMMSG)
 
-					// set the address either if localhost or if 3 seconds have passed
-					// this ensures that a GCS running on localhost can get a hold of
-					// the system within the first N seconds
-					hrt_abstime stime = _mavlink.get_start_time();
-
-					if ((stime != 0 && (hrt_elapsed_time(&stime) > 3_s))
-					    || (srcaddr_last.sin_addr.s_addr == htonl(localhost))) {
-
-						srcaddr_last.sin_addr.s_addr = srcaddr.sin_addr.s_addr;
-						srcaddr_last.sin_port = srcaddr.sin_port;
+				for (int i = 0; i < UDP_RECV_BATCH; i++) {
+					datagrams[i].msg_hdr.msg_namelen = sizeof(srcaddr[i]);
+				}
 
-						_mavlink.set_client_source_initialized();
+				const int num_datagrams = recvmmsg(_mavlink.get_socket_fd(), datagrams, UDP_RECV_BATCH, MSG_DONTWAIT, nullptr);
 
-						PX4_INFO("partner IP: %s", inet_ntoa(srcaddr.sin_addr));
-					}
+				for (int i = 0; i < num_datagrams; i++) {
+					datagram_len[i] = datagrams[i].msg_len;
 				}
-			}
 
-			// only start accepting messages on UDP once we're sure who we talk to
-			if (_mavlink.get_protocol() != Protocol::UDP || _mavlink.get_client_source_initialized()) {
-#endif // MAVLINK_UDP
+# else
+				socklen_t addrlen = sizeof(srcaddr[0]);
+				datagram_len[0] = recvfrom(_mavlink.get_socket_fd(), buf, sizeof(buf), 0, (struct sockaddr *)&srcaddr[0], &addrlen);
+				const int num_datagrams = 1;
+# endif // MAVLINK_UDP_RECVMMSG
 
-				/* if read failed, this loop won't execute */
-				for (ssize_t i = 0; i < nread; i++) {
-					if (mavlink_parse_char(_mavlink.get_channel(), buf[i], &msg, &_status)) {
+				for (int i = 0; i < num_datagrams; i++) {
+					struct sockaddr_in &srcaddr_last = _mavlink.get_client_source_address();
 
-						/* check if we received version 2 and request a switch. */
-						if (!(_mavlink.get_status()->flags & MAVLINK_STATUS_FLAG_IN_MAVLINK1)) {
-							/* this will only switch to proto version 2 if allowed in settings */
-							_mavlink.set_proto_version(2);
-						}
+					int localhost = (127 << 24) + 1;
 
-						handle_message(&msg);
-						_mavlink.set_has_received_messages(true); // Received first message, unlock wait to transmit '-w' command-line flag
-						update_rx_stats(msg);
+					if (!_mavlink.get_client_source_initialized()) {
 
-						if (_message_statistics_enabled) {
-							update_message_statistics(msg);
-						}
-					}
-				}
+						// set the address either if localhost or if 3 seconds have passed
+						// this ensures that a GCS running on localhost can get a hold of
+						// the system within the first N seconds
+						hrt_abstime stime = _mavlink.get_start_time();
 
-				/* count received bytes (nread will be -1 on read error) */
-				if (nread > 0) {
-					_mavlink.count_rxbytes(nread);
+						if ((stime != 0 && (hrt_elapsed_time(&stime) > 3_s))
+						    || (srcaddr_last.sin_addr.s_addr == htonl(localhost))) {
 
-					telemetry_status_s &tstatus = _mavlink.telemetry_status();
-					tstatus.rx_message_count = _total_received_counter;
-					tstatus.rx_message_lost_count = _total_lost_counter;
-					tstatus.rx_message_lost_rate = static_cast<float>(_total_lost_counter) / static_cast<float>(_total_received_counter);
+							srcaddr_last.sin_addr.s_addr = srcaddr[i].sin_addr.s_addr;
+							srcaddr_last.sin_port = srcaddr[i].sin_port;
 
-					if (_mavlink_status_last_buffer_overrun != _status.buffer_overrun) {
-						tstatus.rx_buffer_overruns++;
-						_mavlink_status_last_buffer_overrun = _status.buffer_overrun;
-					}
+							_mavlink.set_client_source_initialized();
 
-					if (_mavlink_status_last_parse_error != _status.parse_error) {
-						tstatus.rx_parse_errors++;
-						_mavlink_status_last_parse_error = _status.parse_error;
+							PX4_INFO("partner IP: %s", inet_ntoa(srcaddr[i].sin_addr));
+						}
 					}
 
-					if (_mavlink_status_last_packet_rx_drop_count != _status.packet_rx_drop_count) {
-						tstatus.rx_packet_drop_count++;
-						_mavlink_status_last_packet_rx_drop_count = _status.packet_rx_drop_count;
+					// only start accepting messages on UDP once we're sure who we talk to
+					if (_mavlink.get_client_source_initialized()) {
+						// every datagram starts with a frame
+						handle_received_bytes(&buf[i * UDP_DATAGRAM_SIZE], datagram_len[i], true);
 					}
 				}
-
-#if defined(MAVLINK_UDP)
 			}
 
 #endif // MAVLINK_UDP
@@ -3237,6 +3241,150 @@ MavlinkReceiver::run()
 	}
 }
 
+void
+MavlinkReceiver::handle_received_bytes(const uint8_t *buf, ssize_t nread, bool message_aligned)
+{
+	/* if read failed, nread is -1 */
+	if (nread <= 0) {
+		return;
+	}
+
+	mavlink_message_t msg;
+	ssize_t i = 0;
+
+	if (message_aligned) {
+		// parse complete frames at once as long as the byte wise parser is not in the middle of a frame
+		while (i < nread) {
+			const uint8_t parse_state = _mavlink.get_status()->parse_state;
+
+			if ((parse_state != MAVLINK_PARSE_STATE_UNINIT) && (parse_state != MAVLINK_PARSE_STATE_IDLE)) {
+				break;
+			}
+
+			const size_t frame_len = parse_frame(&buf[i], nread - i, msg);
+
+			if (frame_len == 0) {
+				break;
+			}
+
+			handle_parsed_message(msg);
+			i += frame_len;
+		}
+	}
+
+	// remaining bytes
+	for (; i < nread; i++) {
+		if (mavlink_parse_char(_mavlink.get_channel(), buf[i], &msg, &_status)) {
+			handle_parsed_message(msg);
+		}
+	}
+
+	/* count received bytes */
+	_mavlink.count_rxbytes(nread);
+
+	telemetry_status_s &tstatus = _mavlink.telemetry_status();
+	tstatus.rx_message_count = _total_received_counter;
+	tstatus.rx_message_lost_count = _total_lost_counter;
+	tstatus.rx_message_lost_rate = static_cast<float>(_total_lost_counter) / static_cast<float>(_total_received_counter);
+
+	if (_mavlink_status_last_buffer_overrun != _status.buffer_overrun) {
+		tstatus.rx_buffer_overruns++;
+		_mavlink_status_last_buffer_overrun = _status.buffer_overrun;
+	}
+
+	if (_mavlink_status_last_parse_error != _status.parse_error) {
+		tstatus.rx_parse_errors++;
+		_mavlink_status_last_parse_error = _status.parse_error;
+	}
+
+	if (_mavlink_status_last_packet_rx_drop_count != _status.packet_rx_drop_count) {
+		tstatus.rx_packet_drop_count++;
+		_mavlink_status_last_packet_rx_drop_count = _status.packet_rx_drop_count;
+	}
+}
+
+size_t
+MavlinkReceiver::parse_frame(const uint8_t *buf, size_t len, mavlink_message_t &msg)
+{
+	if ((len < MAVLINK_NUM_NON_PAYLOAD_BYTES) || (buf[0] != MAVLINK_STX)) {
+		return 0;
+	}
+
+	const uint8_t payload_len = buf[1];
+	const uint8_t incompat_flags = buf[2];
+	const size_t frame_len = MAVLINK_NUM_NON_PAYLOAD_BYTES + payload_len;
+
+	// signed frames (and unknown flags) are left to the byte wise parser
+	if ((incompat_flags != 0) || (frame_len > len)) {
+		return 0;
+	}
+
+	const uint32_t msgid = buf[7] | (buf[8] << 8) | ((uint32_t)buf[9] << 16);
+	const mavlink_msg_entry_t *entry = mavlink_get_msg_entry(msgid);
+
+	if ((entry == nullptr) || (payload_len > entry->max_msg_len)) {
+		return 0;
+	}
+
+	uint16_t crc;
+	crc_init(&crc);
+	crc_accumulate_buffer(&crc, (const char *)&buf[1], MAVLINK_CORE_HEADER_LEN + payload_len);
+	crc_accumulate(entry->crc_extra, &crc);
+
+	const uint8_t *ck = &buf[MAVLINK_NUM_HEADER_BYTES + payload_len];
+
+	if ((ck[0] != (crc & 0xFF)) || (ck[1] != (crc >> 8))) {
+		return 0;
+	}
+
+	msg.checksum = crc;
+	msg.magic = MAVLINK_STX;
+	msg.len = payload_len;
+	msg.incompat_flags = incompat_flags;
+	msg.compat_flags = buf[3];
+	msg.seq = buf[4];
+	msg.sysid = buf[5];
+	msg.compid = buf[6];
+	msg.msgid = msgid;
+	msg.ck[0] = ck[0];
+	msg.ck[1] = ck[1];
+
+	// zero the truncated part of the payload like mavlink_parse_char()
+	memcpy(_MAV_PAYLOAD_NON_CONST(&msg), &buf[MAVLINK_NUM_HEADER_BYTES], payload_len);
+	memset(&_MAV_PAYLOAD_NON_CONST(&msg)[payload_len], 0, entry->max_msg_len - payload_len);
+
+	// same channel status updates as a frame received by mavlink_parse_char()
+	mavlink_status_t *status = _mavlink.get_status();
+	status->flags &= ~MAVLINK_STATUS_FLAG_IN_MAVLINK1;
+	status->current_rx_seq = msg.seq;
+
+	if (status->packet_rx_success_count == 0) {
+		status->packet_rx_drop_count = 0;
+	}
+
+	status->packet_rx_success_count++;
+
+	return frame_len;
+}
+
+void
+MavlinkReceiver::handle_parsed_message(mavlink_message_t &msg)
+{
+	/* check if we received version 2 and request a switch. */
+	if (!(_mavlink.get_status()->flags & MAVLINK_STATUS_FLAG_IN_MAVLINK1)) {
+		/* this will only switch to proto version 2 if allowed in settings */
+		_mavlink.set_proto_version(2);
+	}
+
+	handle_message(&msg);
+	_mavlink.set_has_received_messages(true); // Received first message, unlock wait to transmit '-w' command-line flag
+	update_rx_stats(msg);
+
+	if (_message_statistics_enabled) {
+		update_message_statistics(msg);
+	}
+}
+
 bool MavlinkReceiver::component_was_seen(int system_id, int component_id)
 {
 	// For system broadcast messages return true if at least one component was seen before
@@ -55,6 +55,7 @@
 #include <lib/drivers/accelerometer/PX4Accelerometer.hpp>
 #include <lib/drivers/gyroscope/PX4Gyroscope.hpp>
 #include <lib/drivers/magnetometer/PX4Magnetometer.hpp>
+#include <lib/rtcm_stream/RtcmStream.hpp>
 #include <lib/systemlib/mavlink_log.h>
 #include <px4_platform_common/module_params.h>
 #include <uORB/Publication.hpp>
@@ -239,6 +240,22 @@ private:
 	void update_message_statistics(const mavlink_message_t &message);
 	void update_rx_stats(const mavlink_message_t &message);
 
+	/**
+	 * Parse and handle received bytes
+	 *
+	 * @param message_aligned the buffer starts with a frame (UDP datagram), complete frames are parsed at once
+	 */
+	void handle_received_bytes(const uint8_t *buf, ssize_t nread, bool message_aligned);
+
+	/**
+	 * Parse a complete MAVLink 2 frame at the start of a buffer without going through the byte wise parser
+	 *
+	 * @return length of the frame, 0 if the frame has to be parsed byte wise (incomplete, MAVLink 1, signed or invalid)
+	 */
+	size_t parse_frame(const uint8_t *buf, size_t len, mavlink_message_t &msg);
+
+	void handle_parsed_message(mavlink_message_t &msg);
+
 	px4::atomic_bool 	_should_exit{false};
 	pthread_t		_thread {};
 	/**
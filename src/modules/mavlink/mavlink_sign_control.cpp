@@ -0,0 +1,555 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_sign_control.cpp
+ * MAVLink 2 message signing.
+ */
+
+#include "mavlink_sign_control.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/log.h>
+
+#define MAVLINK_SIGNING_DIR PX4_STORAGEDIR "/mavlink"
+#define MAVLINK_SIGNING_KEY_FILE MAVLINK_SIGNING_DIR "/mavlink-signing-key.bin"
+
+px4::atomic<uint32_t> MavlinkSignControl::_global_key_generation{0};
+
+namespace
+{
+
+// the data following the key: header, payload, crc and signature (link ID + timestamp), plus the SHA-256 padding
+static constexpr size_t SIGN_BUFFER_SIZE = 5 * 64 - 32;
+static_assert(MAVLINK_NUM_HEADER_BYTES + MAVLINK_MAX_PAYLOAD_LEN + 2 + 7 + 9 <= SIGN_BUFFER_SIZE, "buffer too small");
+
+// 1.1.2015, the epoch of the signing timestamps
+static constexpr time_t SIGNING_EPOCH = 1420070400;
+
+static constexpr uint32_t sha256_initial[8] = {
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static constexpr uint32_t sha256_k[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static inline uint32_t ror(uint32_t x, int n)
+{
+	return (x >> n) | (x << (32 - n));
+}
+
+static inline uint32_t load_be32(const uint8_t *p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+/** SHA-256 rounds [first, last) on the working variables v */
+static inline void sha256_rounds(uint32_t v[8], const uint32_t w[64], int first, int last)
+{
+	uint32_t a = v[0], b = v[1], c = v[2], d = v[3], e = v[4], f = v[5], g = v[6], h = v[7];
+
+	for (int t = first; t < last; t++) {
+		const uint32_t s1 = ror(e, 6) ^ ror(e, 11) ^ ror(e, 25);
+		const uint32_t ch = (e & f) ^ (~e & g);
+		const uint32_t t1 = h + s1 + ch + sha256_k[t] + w[t];
+		const uint32_t s0 = ror(a, 2) ^ ror(a, 13) ^ ror(a, 22);
+		const uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+		const uint32_t t2 = s0 + maj;
+		h = g;
+		g = f;
+		f = e;
+		e = d + t1;
+		d = c;
+		c = b;
+		b = a;
+		a = t1 + t2;
+	}
+
+	v[0] = a;
+	v[1] = b;
+	v[2] = c;
+	v[3] = d;
+	v[4] = e;
+	v[5] = f;
+	v[6] = g;
+	v[7] = h;
+}
+
+/**
+ * Compress one block, with w[0..15] set. The rounds before first_round have already been
+ * applied to the working variables vars.
+ */
+static void sha256_compress(uint32_t state[8], uint32_t w[64], const uint32_t vars[8], int first_round)
+{
+	for (int t = 16; t < 64; t++) {
+		const uint32_t s0 = ror(w[t - 15], 7) ^ ror(w[t - 15], 18) ^ (w[t - 15] >> 3);
+		const uint32_t s1 = ror(w[t - 2], 17) ^ ror(w[t - 2], 19) ^ (w[t - 2] >> 10);
+		w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+	}
+
+	uint32_t v[8];
+	memcpy(v, vars, sizeof(v));
+	sha256_rounds(v, w, first_round, 64);
+
+	for (int i = 0; i < 8; i++) {
+		state[i] += v[i];
+	}
+}
+
+} // namespace
+
+void MavlinkSignControl::Signing::set_key(const uint8_t key[32])
+{
+	memcpy(signing.secret_key, key, sizeof(signing.secret_key));
+
+	uint32_t w[64];
+
+	for (int i = 0; i < 8; i++) {
+		key_words[i] = load_be32(&key[i * 4]);
+		w[i] = key_words[i];
+	}
+
+	// the first 8 rounds only use the message words of the key
+	memcpy(key_rounds, sha256_initial, sizeof(key_rounds));
+	sha256_rounds(key_rounds, w, 0, 8);
+}
+
+void MavlinkSignControl::Signing::hash48(uint8_t *data, size_t len, size_t buffer_size, uint8_t out[6]) const
+{
+	// SHA-256 padding of the whole message (key + data), appended to data
+	const size_t total = sizeof(signing.secret_key) + len;
+	const size_t blocks = (total + 9 + 63) / 64;
+	const size_t padded = blocks * 64 - sizeof(signing.secret_key);
+
+	if (padded > buffer_size) {
+		memset(out, 0, 6);
+		return;
+	}
+
+	data[len] = 0x80;
+	memset(&data[len + 1], 0, padded - len - 1 - 8);
+	const uint64_t bits = (uint64_t)total * 8;
+
+	for (int i = 0; i < 8; i++) {
+		data[padded - 1 - i] = (uint8_t)(bits >> (8 * i));
+	}
+
+	uint32_t state[8];
+	memcpy(state, sha256_initial, sizeof(state));
+
+	uint32_t w[64];
+
+	// first block: the key followed by the first 32 bytes of data
+	memcpy(w, key_words, sizeof(key_words));
+
+	for (int i = 0; i < 8; i++) {
+		w[8 + i] = load_be32(&data[i * 4]);
+	}
+
+	sha256_compress(state, w, key_rounds, 8);
+
+	for (size_t block = 1; block < blocks; block++) {
+		const uint8_t *p = &data[32 + (block - 1) * 64];
+
+		for (int i = 0; i < 16; i++) {
+			w[i] = load_be32(&p[i * 4]);
+		}
+
+		sha256_compress(state, w, state, 0);
+	}
+
+	for (int i = 0; i < 4; i++) {
+		out[i] = (uint8_t)(state[0] >> (24 - 8 * i));
+	}
+
+	out[4] = (uint8_t)(state[1] >> 24);
+	out[5] = (uint8_t)(state[1] >> 16);
+}
+
+uint8_t mavlink_sign_packet(mavlink_signing_t *signing, uint8_t signature[MAVLINK_SIGNATURE_BLOCK_LEN],
+			    const uint8_t *header, uint8_t header_len,
+			    const uint8_t *packet, uint8_t packet_len,
+			    const uint8_t crc[2])
+{
+	if (signing == nullptr || !(signing->flags & MAVLINK_SIGNING_FLAG_SIGN_OUTGOING)) {
+		return 0;
+	}
+
+	MavlinkSignControl::Signing *s = reinterpret_cast<MavlinkSignControl::Signing *>(signing);
+	const hrt_abstime start = hrt_absolute_time();
+
+	signature[0] = signing->link_id;
+	const uint64_t timestamp = signing->timestamp++;
+
+	for (int i = 0; i < 6; i++) {
+		signature[1 + i] = (uint8_t)(timestamp >> (8 * i));
+	}
+
+	uint8_t buffer[SIGN_BUFFER_SIZE];
+	size_t len = 0;
+	memcpy(&buffer[len], header, header_len);
+	len += header_len;
+	memcpy(&buffer[len], packet, packet_len);
+	len += packet_len;
+	memcpy(&buffer[len], crc, 2);
+	len += 2;
+	memcpy(&buffer[len], signature, 7);
+	len += 7;
+
+	s->hash48(buffer, len, sizeof(buffer), &signature[7]);
+
+	s->signed_count++;
+	s->signed_bytes += len;
+	s->sign_time_us += hrt_elapsed_time(&start);
+
+	return MAVLINK_SIGNATURE_BLOCK_LEN;
+}
+
+bool mavlink_signature_check(mavlink_signing_t *signing, mavlink_signing_streams_t *signing_streams,
+			     const mavlink_message_t *msg)
+{
+	if (signing == nullptr) {
+		return true;
+	}
+
+	MavlinkSignControl::Signing *s = reinterpret_cast<MavlinkSignControl::Signing *>(signing);
+	const hrt_abstime start = hrt_absolute_time();
+
+	const uint8_t *psig = msg->signature;
+
+	uint8_t buffer[SIGN_BUFFER_SIZE];
+	size_t len = 0;
+	memcpy(&buffer[len], &msg->magic, MAVLINK_NUM_HEADER_BYTES);
+	len += MAVLINK_NUM_HEADER_BYTES;
+	memcpy(&buffer[len], _MAV_PAYLOAD(msg), msg->len);
+	len += msg->len;
+	memcpy(&buffer[len], msg->ck, 2);
+	len += 2;
+	memcpy(&buffer[len], psig, 7);
+	len += 7;
+
+	uint8_t signature[6];
+	s->hash48(buffer, len, sizeof(buffer), signature);
+
+	s->verify_time_us += hrt_elapsed_time(&start);
+
+	if (memcmp(signature, &psig[7], 6) != 0) {
+		signing->last_status = MAVLINK_SIGNING_STATUS_BAD_SIGNATURE;
+		s->rejected_count++;
+		return false;
+	}
+
+	// the timestamp needs to increase per stream (sysid, compid, link ID)
+	const uint8_t link_id = psig[0];
+	uint64_t timestamp = 0;
+	memcpy(&timestamp, &psig[1], 6);
+
+	if (signing_streams == nullptr) {
+		signing->last_status = MAVLINK_SIGNING_STATUS_NO_STREAMS;
+		s->rejected_count++;
+		return false;
+	}
+
+	uint16_t i;
+
+	for (i = 0; i < signing_streams->num_signing_streams; i++) {
+		if (msg->sysid == signing_streams->stream[i].sysid &&
+		    msg->compid == signing_streams->stream[i].compid &&
+		    link_id == signing_streams->stream[i].link_id) {
+			break;
+		}
+	}
+
+	if (i == signing_streams->num_signing_streams) {
+		if (signing_streams->num_signing_streams >= MAVLINK_MAX_SIGNING_STREAMS) {
+			signing->last_status = MAVLINK_SIGNING_STATUS_TOO_MANY_STREAMS;
+			s->rejected_count++;
+			return false;
+		}
+
+		// new stream, only accept it if the timestamp is not more than 1 minute old
+		if (timestamp + 6000 * 1000UL < signing->timestamp) {
+			signing->last_status = MAVLINK_SIGNING_STATUS_OLD_TIMESTAMP;
+			s->rejected_count++;
+			return false;
+		}
+
+		signing_streams->stream[i].sysid = msg->sysid;
+		signing_streams->stream[i].compid = msg->compid;
+		signing_streams->stream[i].link_id = link_id;
+		signing_streams->num_signing_streams++;
+
+	} else {
+		uint64_t last_timestamp = 0;
+		memcpy(&last_timestamp, signing_streams->stream[i].timestamp_bytes, 6);
+
+		if (timestamp <= last_timestamp) {
+			signing->last_status = MAVLINK_SIGNING_STATUS_REPLAY;
+			s->rejected_count++;
+			return false;
+		}
+	}
+
+	memcpy(signing_streams->stream[i].timestamp_bytes, &psig[1], 6);
+
+	// our next timestamp must be at least this one
+	if (timestamp > signing->timestamp) {
+		signing->timestamp = timestamp;
+	}
+
+	signing->last_status = MAVLINK_SIGNING_STATUS_OK;
+	s->verified_count++;
+	return true;
+}
+
+void MavlinkSignControl::start(uint8_t link_id, mavlink_status_t *status, bool is_usb, int32_t config)
+{
+	_status = status;
+	_is_usb = is_usb;
+	_config = static_cast<Config>(config);
+	_start_time = hrt_absolute_time();
+
+	_signing.signing.link_id = link_id;
+	_signing.signing.accept_unsigned_callback = &MavlinkSignControl::accept_unsigned;
+
+	_key_generation = _global_key_generation.load();
+
+	uint8_t key[32];
+	uint64_t timestamp;
+	_have_key = load_key(key, timestamp);
+
+	if (_have_key) {
+		_signing.set_key(key);
+		const uint64_t now = current_timestamp();
+		_signing.signing.timestamp = now > timestamp ? now : timestamp;
+	}
+
+	configure();
+}
+
+void MavlinkSignControl::update(int32_t config)
+{
+	const uint32_t key_generation = _global_key_generation.load();
+
+	if (key_generation != _key_generation) {
+		_key_generation = key_generation;
+
+		uint8_t key[32];
+		uint64_t timestamp;
+		_have_key = load_key(key, timestamp);
+
+		if (_have_key) {
+			_signing.set_key(key);
+
+			if (timestamp > _signing.signing.timestamp) {
+				_signing.signing.timestamp = timestamp;
+			}
+		}
+
+		// the streams of the old key are meaningless now
+		_streams.num_signing_streams = 0;
+
+	} else if (static_cast<Config>(config) == _config) {
+		return;
+	}
+
+	_config = static_cast<Config>(config);
+	configure();
+}
+
+void MavlinkSignControl::configure()
+{
+	if (_status == nullptr) {
+		return;
+	}
+
+	const bool enable = _have_key && (_config == Config::All || (_config == Config::NonUsb && !_is_usb));
+
+	if (enable) {
+		_signing.signing.flags = MAVLINK_SIGNING_FLAG_SIGN_OUTGOING;
+		_status->signing_streams = &_streams;
+		_status->signing = &_signing.signing;
+
+	} else {
+		_status->signing = nullptr;
+		_status->signing_streams = nullptr;
+	}
+}
+
+bool MavlinkSignControl::setup_signing(const mavlink_message_t *msg)
+{
+	mavlink_setup_signing_t setup;
+	mavlink_msg_setup_signing_decode(msg, &setup);
+
+	if (setup.target_system != mavlink_system.sysid) {
+		return false;
+	}
+
+	if (!_is_usb && !active()) {
+		PX4_WARN("SETUP_SIGNING rejected, only accepted on USB or on a signed link");
+		return false;
+	}
+
+	bool zero_key = true;
+
+	for (unsigned i = 0; i < sizeof(setup.secret_key); i++) {
+		if (setup.secret_key[i] != 0) {
+			zero_key = false;
+			break;
+		}
+	}
+
+	if (zero_key) {
+		unlink(MAVLINK_SIGNING_KEY_FILE);
+		PX4_INFO("signing key removed");
+
+	} else {
+		const uint64_t now = current_timestamp();
+
+		if (!store_key(setup.secret_key, setup.initial_timestamp > now ? setup.initial_timestamp : now)) {
+			PX4_ERR("failed to store signing key");
+			return false;
+		}
+
+		PX4_INFO("signing key stored");
+	}
+
+	// all instances (including this one) reload the key in update()
+	_global_key_generation.fetch_add(1);
+	return true;
+}
+
+void MavlinkSignControl::store_timestamp()
+{
+	uint8_t key[32];
+	uint64_t timestamp;
+
+	if (_have_key && load_key(key, timestamp) && memcmp(key, _signing.signing.secret_key, sizeof(key)) == 0
+	    && _signing.signing.timestamp > timestamp) {
+		store_key(key, _signing.signing.timestamp);
+	}
+}
+
+bool MavlinkSignControl::load_key(uint8_t key[32], uint64_t &timestamp)
+{
+	int fd = ::open(MAVLINK_SIGNING_KEY_FILE, O_RDONLY);
+
+	if (fd < 0) {
+		return false;
+	}
+
+	// file format: 64 bit timestamp (little-endian) followed by the key
+	uint8_t buffer[8 + 32];
+	const bool ret = ::read(fd, buffer, sizeof(buffer)) == (ssize_t)sizeof(buffer);
+	::close(fd);
+
+	if (ret) {
+		memcpy(&timestamp, buffer, 8);
+		memcpy(key, &buffer[8], 32);
+	}
+
+	return ret;
+}
+
+bool MavlinkSignControl::store_key(const uint8_t key[32], uint64_t timestamp)
+{
+	if (mkdir(MAVLINK_SIGNING_DIR, S_IRWXU) != 0 && errno != EEXIST) {
+		return false;
+	}
+
+	int fd = ::open(MAVLINK_SIGNING_KEY_FILE, O_WRONLY | O_CREAT | O_TRUNC, PX4_O_MODE_600);
+
+	if (fd < 0) {
+		return false;
+	}
+
+	uint8_t buffer[8 + 32];
+	memcpy(buffer, &timestamp, 8);
+	memcpy(&buffer[8], key, 32);
+	const bool ret = ::write(fd, buffer, sizeof(buffer)) == (ssize_t)sizeof(buffer);
+	::close(fd);
+
+	return ret;
+}
+
+bool MavlinkSignControl::accept_unsigned(const mavlink_status_t *status, uint32_t msgid)
+{
+	// radios inject RADIO_STATUS without a signature
+	return msgid == MAVLINK_MSG_ID_RADIO_STATUS;
+}
+
+uint64_t MavlinkSignControl::current_timestamp()
+{
+	timespec ts{};
+	clock_gettime(CLOCK_REALTIME, &ts);
+
+	if (ts.tv_sec <= SIGNING_EPOCH) {
+		return 0;
+	}
+
+	return ((uint64_t)(ts.tv_sec - SIGNING_EPOCH) * 1000000ULL + ts.tv_nsec / 1000) / 10;
+}
+
+void MavlinkSignControl::print_status() const
+{
+	if (!active()) {
+		printf("\tsigning: %s\n", _have_key ? "disabled" : "no key");
+		return;
+	}
+
+	const float elapsed_s = hrt_elapsed_time(&_start_time) * 1e-6f;
+	const uint32_t signed_count = _signing.signed_count;
+	const uint32_t checked_count = _signing.verified_count + _signing.rejected_count;
+
+	printf("\tsigning: active (link ID %" PRIu8 ")\n", _signing.signing.link_id);
+	printf("\t  signed: %" PRIu32 " msgs, %.1f msgs/s, %.1f kB/s, %.2f us/msg\n", signed_count,
+	       (double)(signed_count / elapsed_s), (double)(_signing.signed_bytes / elapsed_s / 1000.f),
+	       signed_count > 0 ? (double)_signing.sign_time_us / signed_count : 0.);
+	printf("\t  verified: %" PRIu32 ", rejected: %" PRIu32 ", %.2f us/msg\n", _signing.verified_count,
+	       _signing.rejected_count, checked_count > 0 ? (double)_signing.verify_time_us / checked_count : 0.);
+}
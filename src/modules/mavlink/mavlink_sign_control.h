@@ -0,0 +1,144 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_sign_control.h
+ * MAVLink 2 message signing.
+ *
+ * The signature is the first 48 bits of SHA-256(secret_key + header + payload + crc + link_id + timestamp).
+ * The 32 byte key is the same for every message, so the SHA-256 message words of the key and the
+ * first 8 compression rounds of the first block, which only depend on them, are computed once when the
+ * key is loaded. The signing functions of the MAVLink library are replaced by this implementation
+ * (MAVLINK_NO_SIGN_PACKET and MAVLINK_NO_SIGNATURE_CHECK in mavlink_bridge_header.h).
+ */
+
+#pragma once
+
+#include "mavlink_bridge_header.h"
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/atomic.h>
+
+class MavlinkSignControl
+{
+public:
+	MavlinkSignControl() = default;
+	~MavlinkSignControl() = default;
+
+	/**
+	 * Signing configuration (MAV_SIGN_CFG)
+	 */
+	enum class Config : int32_t {
+		Disabled = 0,
+		NonUsb = 1, ///< enabled on all links except USB
+		All = 2,
+	};
+
+	/**
+	 * Load the key and enable signing on the channel if configured.
+	 * Needs to be called before the receiver is started.
+	 * @param link_id link ID used in outgoing signatures
+	 */
+	void start(uint8_t link_id, mavlink_status_t *status, bool is_usb, int32_t config);
+
+	/**
+	 * Apply a configuration change, or a key change from another instance
+	 */
+	void update(int32_t config);
+
+	/**
+	 * Handle SETUP_SIGNING. The key is only accepted on USB, or if signing is already active on
+	 * the link (so the message was signed with the old key). An all zero key disables signing.
+	 * @return true if the key was stored
+	 */
+	bool setup_signing(const mavlink_message_t *msg);
+
+	/**
+	 * Store the current timestamp with the key, so that it keeps increasing after a reboot
+	 */
+	void store_timestamp();
+
+	void print_status() const;
+
+	bool active() const { return _status != nullptr && _status->signing != nullptr; }
+
+	/**
+	 * State of a signed link. The MAVLink library only passes around the mavlink_signing_t,
+	 * which is the first member, so the signing functions can get to the rest.
+	 */
+	struct Signing {
+		mavlink_signing_t signing;
+
+		uint32_t key_words[8];          ///< big-endian words of the secret key
+		uint32_t key_rounds[8];         ///< SHA-256 working variables after the rounds over key_words
+
+		// statistics
+		uint32_t signed_count;
+		uint32_t verified_count;
+		uint32_t rejected_count;
+		uint64_t signed_bytes;
+		uint64_t sign_time_us;
+		uint64_t verify_time_us;
+
+		/** set the secret key and precompute the key dependent part of the hash */
+		void set_key(const uint8_t key[32]);
+
+		/** first 48 bits of SHA-256(secret_key + data) */
+		void hash48(uint8_t *data, size_t len, size_t buffer_size, uint8_t out[6]) const;
+	};
+
+private:
+	bool load_key(uint8_t key[32], uint64_t &timestamp);
+	bool store_key(const uint8_t key[32], uint64_t timestamp);
+
+	/** enable or disable signing on the channel according to the configuration and the stored key */
+	void configure();
+
+	static bool accept_unsigned(const mavlink_status_t *status, uint32_t msgid);
+
+	/** current time in the MAVLink signing timestamp units (10us since 1.1.2015), 0 if unknown */
+	static uint64_t current_timestamp();
+
+	Signing _signing{};
+	mavlink_signing_streams_t _streams{};
+
+	mavlink_status_t *_status{nullptr};
+	bool _is_usb{false};
+	Config _config{Config::Disabled};
+	bool _have_key{false};
+	uint32_t _key_generation{0};
+	hrt_abstime _start_time{0};
+
+	/** incremented on every key change, so that all instances reload it */
+	static px4::atomic<uint32_t> _global_key_generation;
+};
@@ -85,7 +85,7 @@ MavlinkStream::update(const hrt_abstime &t)
 	int interval = _interval;
 
 	if (!const_rate()) {
-		interval /= _mavlink->get_rate_mult();
+		interval /= _mavlink->get_rate_mult(high_rate());
 	}
 
 	// We don't need to send anything if the inverval is 0. send() will be called manually.
@@ -128,3 +128,33 @@ MavlinkStream::update(const hrt_abstime &t)
 
 	return -1;
 }
+
+hrt_abstime
+MavlinkStream::next_update()
+{
+	// never sent, send immediately
+	if (_last_sent == 0) {
+		return 0;
+	}
+
+	int interval = _interval;
+
+	if (!const_rate()) {
+		interval /= _mavlink->get_rate_mult(high_rate());
+	}
+
+	// unlimited rate
+	if (interval < 0) {
+		return 0;
+	}
+
+	// send() is called manually
+	if (interval == 0) {
+		return UINT64_MAX;
+	}
+
+	// first time update() sends, see the tolerance there
+	const int64_t threshold = interval - (_mavlink->get_main_loop_delay() / 10) * 3;
+
+	return _last_sent + ((threshold > 0) ? threshold : 0) + 1;
+}
@@ -79,6 +79,19 @@ public:
 	 * @return 0 if updated / sent, -1 if unchanged
 	 */
 	int update(const hrt_abstime &t);
+
+	/**
+	 * Get the time update() has to be called next to keep the stream rate
+	 *
+	 * @return time the stream is due, 0 if due immediately, UINT64_MAX if only sent on request
+	 */
+	hrt_abstime next_update();
+
+	/**
+	 * @return true if update() has to be called on every iteration, as the stream collects data in update_data()
+	 */
+	virtual bool update_data_required() const { return false; }
+
 	virtual const char *get_name() const = 0;
 	virtual uint16_t get_id() = 0;
 
@@ -87,6 +100,13 @@ public:
 	 */
 	virtual bool const_rate() { return false; }
 
+	/**
+	 * @return true if the stream is shed first when the link is congested (configured above 10 Hz)
+	 */
+	bool high_rate() const { return (_interval < 0) || ((_interval > 0) && (_interval < HIGH_RATE_INTERVAL)); }
+
+	static constexpr int HIGH_RATE_INTERVAL = 100000;
+
 	/**
 	 * Get maximal total messages size on update
 	 */
@@ -132,7 +152,8 @@ protected:
 	 * Function to collect/update data for the streams at a high rate independent of
 	 * actual stream rate.
 	 *
-	 * This function is called at every iteration of the mavlink module.
+	 * This function is called at every iteration of the mavlink module, streams implementing it
+	 * have to return true from update_data_required().
 	 */
 	virtual void update_data() { }
 
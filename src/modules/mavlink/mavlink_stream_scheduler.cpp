@@ -0,0 +1,173 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_stream_scheduler.cpp
+ * Deadline based scheduling of the mavlink streams.
+ */
+
+#include "mavlink_stream_scheduler.h"
+#include "mavlink_stream.h"
+
+MavlinkStreamScheduler::~MavlinkStreamScheduler()
+{
+	delete[] _heap;
+	delete[] _every_iteration;
+	delete[] _due;
+}
+
+bool
+MavlinkStreamScheduler::rebuild(List<MavlinkStream *> &streams)
+{
+	const int num_streams = streams.size();
+
+	if (num_streams > _capacity) {
+		delete[] _heap;
+		delete[] _every_iteration;
+		delete[] _due;
+
+		_heap = new Entry[num_streams];
+		_every_iteration = new MavlinkStream *[num_streams];
+		_due = new Entry[num_streams];
+
+		if (!_heap || !_every_iteration || !_due) {
+			_capacity = 0;
+			return false;
+		}
+
+		_capacity = num_streams;
+	}
+
+	_size = 0;
+	_num_every_iteration = 0;
+
+	for (MavlinkStream *stream : streams) {
+		if (stream->update_data_required()) {
+			_every_iteration[_num_every_iteration++] = stream;
+
+		} else {
+			push(Entry{stream->next_update(), stream});
+		}
+	}
+
+	_valid = true;
+	return true;
+}
+
+hrt_abstime
+MavlinkStreamScheduler::update(List<MavlinkStream *> &streams, const hrt_abstime &t)
+{
+	if (!_valid && !rebuild(streams)) {
+		// no memory for the schedule, update every stream
+		for (MavlinkStream *stream : streams) {
+			stream->update(t);
+		}
+
+		return 0;
+	}
+
+	for (int i = 0; i < _num_every_iteration; i++) {
+		_every_iteration[i]->update(t);
+	}
+
+	// take all due streams first, a stream that could not send is due again right away
+	int num_due = 0;
+
+	while ((_size > 0) && (_heap[0].due <= t)) {
+		_due[num_due++] = pop();
+	}
+
+	for (int i = 0; i < num_due; i++) {
+		MavlinkStream *stream = _due[i].stream;
+		stream->update(t);
+		push(Entry{stream->next_update(), stream});
+	}
+
+	if (_num_every_iteration > 0 || _size == 0) {
+		return 0;
+	}
+
+	return _heap[0].due;
+}
+
+void
+MavlinkStreamScheduler::push(const Entry &entry)
+{
+	int i = _size++;
+
+	while (i > 0) {
+		const int parent = (i - 1) / 2;
+
+		if (_heap[parent].due <= entry.due) {
+			break;
+		}
+
+		_heap[i] = _heap[parent];
+		i = parent;
+	}
+
+	_heap[i] = entry;
+}
+
+MavlinkStreamScheduler::Entry
+MavlinkStreamScheduler::pop()
+{
+	const Entry top = _heap[0];
+	const Entry last = _heap[--_size];
+	int i = 0;
+
+	while (true) {
+		int child = 2 * i + 1;
+
+		if (child >= _size) {
+			break;
+		}
+
+		if ((child + 1 < _size) && (_heap[child + 1].due < _heap[child].due)) {
+			child++;
+		}
+
+		if (last.due <= _heap[child].due) {
+			break;
+		}
+
+		_heap[i] = _heap[child];
+		i = child;
+	}
+
+	if (_size > 0) {
+		_heap[i] = last;
+	}
+
+	return top;
+}
@@ -0,0 +1,97 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_stream_scheduler.h
+ * Deadline based scheduling of the mavlink streams.
+ *
+ * The streams are kept in a min-heap ordered by the time they are due next,
+ * so that a main loop iteration only visits the streams that are due and
+ * knows how long it can sleep.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <containers/List.hpp>
+
+class MavlinkStream;
+
+class MavlinkStreamScheduler
+{
+public:
+	MavlinkStreamScheduler() = default;
+	~MavlinkStreamScheduler();
+
+	// no copy, assignment, move, move assignment
+	MavlinkStreamScheduler(const MavlinkStreamScheduler &) = delete;
+	MavlinkStreamScheduler &operator=(const MavlinkStreamScheduler &) = delete;
+	MavlinkStreamScheduler(MavlinkStreamScheduler &&) = delete;
+	MavlinkStreamScheduler &operator=(MavlinkStreamScheduler &&) = delete;
+
+	/**
+	 * Rebuild the schedule before the next update, required after streams were added, removed
+	 * or reconfigured and when the rate multiplier changed.
+	 */
+	void invalidate() { _valid = false; }
+
+	/**
+	 * Update all streams that are due
+	 *
+	 * @param streams all streams of the instance
+	 * @param t time of this main loop iteration
+	 * @return time the next stream is due, 0 if a stream is due on every iteration
+	 */
+	hrt_abstime update(List<MavlinkStream *> &streams, const hrt_abstime &t);
+
+private:
+	struct Entry {
+		hrt_abstime due;
+		MavlinkStream *stream;
+	};
+
+	bool rebuild(List<MavlinkStream *> &streams);
+
+	void push(const Entry &entry);
+	Entry pop();
+
+	Entry *_heap{nullptr};
+	MavlinkStream **_every_iteration{nullptr}; ///< streams updating their data on every iteration
+	Entry *_due{nullptr}; ///< streams taken from the heap in the current iteration
+
+	int _size{0};
+	int _capacity{0};
+	int _num_every_iteration{0};
+
+	bool _valid{false};
+};
@@ -66,6 +66,10 @@ private:
 		vehicle_attitude_s att;
 
 		if (_att_sub.update(&att)) {
+			if (MavlinkMessageCache::send(_mavlink->get_channel(), get_id_static(), _att_sub.get_last_generation())) {
+				return true;
+			}
+
 			vehicle_angular_velocity_s angular_velocity{};
 			_angular_velocity_sub.copy(&angular_velocity);
 
@@ -101,6 +105,7 @@ private:
 			}
 
 			mavlink_msg_attitude_quaternion_send_struct(_mavlink->get_channel(), &msg);
+			MavlinkMessageCache::store(get_id_static(), _att_sub.get_last_generation(), &msg, sizeof(msg));
 
 			return true;
 		}
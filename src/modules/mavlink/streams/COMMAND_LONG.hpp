@@ -62,40 +62,47 @@ private:
 		bool sent = false;
 
 		static constexpr size_t COMMAND_LONG_SIZE = MAVLINK_MSG_ID_COMMAND_LONG_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES;
-		int vehicle_command_updates = 0;
 
-		while ((_mavlink->get_free_tx_buf() >= COMMAND_LONG_SIZE)
-		       && _vehicle_command_sub.updated() && (vehicle_command_updates < vehicle_command_s::ORB_QUEUE_LENGTH)) {
+		// read all pending commands that fit into the tx buffer at once
+		unsigned max_commands = _mavlink->get_free_tx_buf() / COMMAND_LONG_SIZE;
 
-			vehicle_command_updates++;
+		if (max_commands > vehicle_command_s::ORB_QUEUE_LENGTH) {
+			max_commands = vehicle_command_s::ORB_QUEUE_LENGTH;
+		}
+
+		vehicle_command_s cmds[vehicle_command_s::ORB_QUEUE_LENGTH];
+		unsigned num_commands = 0;
 
+		if ((max_commands > 0) && _vehicle_command_sub.updated()) {
 			const unsigned last_generation = _vehicle_command_sub.get_last_generation();
-			vehicle_command_s cmd;
+			num_commands = _vehicle_command_sub.update_batch(cmds, max_commands);
+
+			if (_vehicle_command_sub.get_last_generation() != last_generation + num_commands) {
+				PX4_ERR("COMMAND_LONG vehicle_command lost, generation %d -> %d", last_generation,
+					_vehicle_command_sub.get_last_generation());
+			}
+		}
 
-			if (_vehicle_command_sub.update(&cmd)) {
-				if (_vehicle_command_sub.get_last_generation() != last_generation + 1) {
-					PX4_ERR("COMMAND_LONG vehicle_command lost, generation %d -> %d", last_generation,
-						_vehicle_command_sub.get_last_generation());
-				}
+		for (unsigned i = 0; i < num_commands; i++) {
+			const vehicle_command_s &cmd = cmds[i];
 
-				// mavlink mavlink commands are <= UINT16_MAX
-				const bool px4_internal_cmd = (cmd.command >= vehicle_command_s::VEHICLE_CMD_PX4_INTERNAL_START);
+			// mavlink mavlink commands are <= UINT16_MAX
+			const bool px4_internal_cmd = (cmd.command >= vehicle_command_s::VEHICLE_CMD_PX4_INTERNAL_START);
 
-				// internal commands
-				const bool target_system_internal = (cmd.target_system == _mavlink->get_system_id())
-								    && (cmd.target_component == _mavlink->get_component_id())
-								    && (cmd.source_system == cmd.target_system)
-								    && (cmd.source_component == cmd.target_component);
+			// internal commands
+			const bool target_system_internal = (cmd.target_system == _mavlink->get_system_id())
+							    && (cmd.target_component == _mavlink->get_component_id())
+							    && (cmd.source_system == cmd.target_system)
+							    && (cmd.source_component == cmd.target_component);
 
-				if (!cmd.from_external && !px4_internal_cmd && !target_system_internal) {
-					PX4_DEBUG("sending command %ld to %d/%d", cmd.command, cmd.target_system, cmd.target_component);
+			if (!cmd.from_external && !px4_internal_cmd && !target_system_internal) {
+				PX4_DEBUG("sending command %ld to %d/%d", cmd.command, cmd.target_system, cmd.target_component);
 
-					MavlinkCommandSender::instance().handle_vehicle_command(cmd, _mavlink->get_channel());
-					sent = true;
+				MavlinkCommandSender::instance().handle_vehicle_command(cmd, _mavlink->get_channel());
+				sent = true;
 
-				} else {
-					PX4_DEBUG("not forwarding command %ld to %d/%d", cmd.command, cmd.target_system, cmd.target_component);
-				}
+			} else {
+				PX4_DEBUG("not forwarding command %ld to %d/%d", cmd.command, cmd.target_system, cmd.target_component);
 			}
 		}
 
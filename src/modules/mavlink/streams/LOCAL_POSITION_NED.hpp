@@ -62,6 +62,10 @@ private:
 		vehicle_local_position_s lpos;
 
 		if (_lpos_sub.update(&lpos)) {
+			if (MavlinkMessageCache::send(_mavlink->get_channel(), get_id_static(), _lpos_sub.get_last_generation())) {
+				return true;
+			}
+
 			mavlink_local_position_ned_t msg{};
 
 			msg.time_boot_ms = lpos.timestamp / 1000;
@@ -73,6 +77,7 @@ private:
 			msg.vz = lpos.vz;
 
 			mavlink_msg_local_position_ned_send_struct(_mavlink->get_channel(), &msg);
+			MavlinkMessageCache::store(get_id_static(), _lpos_sub.get_last_generation(), &msg, sizeof(msg));
 
 			return true;
 
@@ -94,6 +94,18 @@ private:
 	 */
 	void generate_attitude_setpoint(const matrix::Quatf &q, float dt, bool reset_yaw_sp);
 
+	/**
+	 * Reduce the attitude callback rate while disarmed, landed or in steady hover (MC_ATT_IDLE_RATE).
+	 */
+	void updateAdaptiveRate(const vehicle_attitude_s &v_att, bool attitude_setpoint_generated);
+
+	/**
+	 * Restore the full rate if the attitude setpoint changed since the beginning of the idle period.
+	 */
+	void checkSetpointWakeup();
+
+	void setControlInterval(uint32_t interval_us);
+
 	AttitudeControl _attitude_control; /**< class for attitude control calculations */
 
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
@@ -107,6 +119,7 @@ private:
 	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
 
 	uORB::SubscriptionCallbackWorkItem _vehicle_attitude_sub{this, ORB_ID(vehicle_attitude)};
+	uORB::SubscriptionCallbackWorkItem _vehicle_attitude_setpoint_wakeup_sub{this, ORB_ID(vehicle_attitude_setpoint)}; /**< restores the full rate on setpoint changes (MC_ATT_IDLE_RATE) */
 
 	uORB::Publication<vehicle_rates_setpoint_s>     _vehicle_rates_setpoint_pub{ORB_ID(vehicle_rates_setpoint)};    /**< rate setpoint publication */
 	uORB::Publication<vehicle_attitude_setpoint_s>  _vehicle_attitude_setpoint_pub;
@@ -140,6 +153,17 @@ private:
 
 	uint8_t _quat_reset_counter{0};
 
+	// adaptive rate (MC_ATT_IDLE_RATE)
+	matrix::Quatf _steady_q_d{};            /**< attitude setpoint at the beginning of a steady hover */
+	float _steady_thrust{0.f};
+	hrt_abstime _steady_setpoint_since{0};
+	uint32_t _reduced_interval_us{0};       /**< current interval of the attitude callback, 0 at full rate */
+
+	static constexpr float IDLE_HOVER_RATE_MIN = 100.f;    /**< lower rate limit in hover [Hz] */
+	static constexpr hrt_abstime IDLE_HOVER_TIME = 1_s;    /**< time of unchanged setpoint before reducing the rate */
+	static constexpr float IDLE_SETPOINT_ANGLE = 0.0175f;  /**< attitude setpoint change considered steady [rad] */
+	static constexpr float IDLE_SETPOINT_THRUST = 0.02f;   /**< thrust setpoint change considered steady */
+
 	DEFINE_PARAMETERS(
 		(ParamInt<px4::params::MC_AIRMODE>)         _param_mc_airmode,
 		(ParamFloat<px4::params::MC_MAN_TILT_TAU>)  _param_mc_man_tilt_tau,
@@ -161,7 +185,9 @@ private:
 		(ParamFloat<px4::params::MPC_THR_HOVER>)    _param_mpc_thr_hover,       /**< throttle at stationary hover */
 		(ParamInt<px4::params::MPC_THR_CURVE>)      _param_mpc_thr_curve,       /**< throttle curve behavior */
 
-		(ParamFloat<px4::params::COM_SPOOLUP_TIME>) _param_com_spoolup_time
+		(ParamFloat<px4::params::COM_SPOOLUP_TIME>) _param_com_spoolup_time,
+
+		(ParamFloat<px4::params::MC_ATT_IDLE_RATE>) _param_mc_att_idle_rate
 	)
 };
 
@@ -96,6 +96,15 @@ MulticopterAttitudeControl::parameters_updated()
 						radians(_param_mc_yawrate_max.get())));
 
 	_man_tilt_max = math::radians(_param_mpc_man_tilt_max.get());
+
+	// setpoint changes only need to wake up the controller while its rate can be reduced
+	if (_param_mc_att_idle_rate.get() > 0.f) {
+		_vehicle_attitude_setpoint_wakeup_sub.registerCallback();
+
+	} else {
+		_vehicle_attitude_setpoint_wakeup_sub.unregisterCallback();
+		setControlInterval(0);
+	}
 }
 
 float
@@ -199,6 +208,7 @@ MulticopterAttitudeControl::Run()
 {
 	if (should_exit()) {
 		_vehicle_attitude_sub.unregisterCallback();
+		_vehicle_attitude_setpoint_wakeup_sub.unregisterCallback();
 		exit_and_cleanup();
 		return;
 	}
@@ -215,6 +225,8 @@ MulticopterAttitudeControl::Run()
 		parameters_updated();
 	}
 
+	checkSetpointWakeup();
+
 	// run controller on attitude updates
 	vehicle_attitude_s v_att;
 
@@ -357,11 +369,68 @@ MulticopterAttitudeControl::Run()
 		// reset yaw setpoint during transitions, tailsitter.cpp generates
 		// attitude setpoint for the transition
 		_reset_yaw_sp = !attitude_setpoint_generated || !_heading_good_for_control || (_vtol && _vtol_in_transition_mode);
+
+		if (_param_mc_att_idle_rate.get() > 0.f) {
+			updateAdaptiveRate(v_att, attitude_setpoint_generated);
+		}
 	}
 
 	perf_end(_loop_perf);
 }
 
+void
+MulticopterAttitudeControl::setControlInterval(uint32_t interval_us)
+{
+	if (interval_us != _reduced_interval_us) {
+		_vehicle_attitude_sub.set_interval_us(interval_us);
+		_reduced_interval_us = interval_us;
+	}
+}
+
+void
+MulticopterAttitudeControl::checkSetpointWakeup()
+{
+	vehicle_attitude_setpoint_s setpoint;
+
+	// separate subscription, the control loop still receives every setpoint
+	if (_vehicle_attitude_setpoint_wakeup_sub.update(&setpoint)) {
+		const Quatf q_d(setpoint.q_d);
+		const float thrust = Vector3f(setpoint.thrust_body).norm();
+		const float angle = 2.f * acosf(math::constrain(fabsf(_steady_q_d.dot(q_d)), 0.f, 1.f));
+
+		if ((angle > IDLE_SETPOINT_ANGLE)
+		    || (fabsf(thrust - _steady_thrust) > IDLE_SETPOINT_THRUST)) {
+			_steady_q_d = q_d;
+			_steady_thrust = thrust;
+			_steady_setpoint_since = setpoint.timestamp;
+
+			// the pending attitude is processed in this cycle
+			setControlInterval(0);
+		}
+	}
+}
+
+void
+MulticopterAttitudeControl::updateAdaptiveRate(const vehicle_attitude_s &v_att, bool attitude_setpoint_generated)
+{
+	// setpoints generated from the sticks are not published before the attitude arrives and cannot wake up the controller
+	const bool steady_setpoint = !attitude_setpoint_generated
+				     && (v_att.timestamp_sample > _steady_setpoint_since + IDLE_HOVER_TIME);
+
+	// armed on ground only with an unchanged setpoint, a takeoff needs the full rate before the land detector reacts
+	const bool on_ground = !_vehicle_control_mode.flag_armed || (_landed && steady_setpoint);
+
+	if (on_ground) {
+		setControlInterval(1e6f / _param_mc_att_idle_rate.get());
+
+	} else if (steady_setpoint) {
+		setControlInterval(1e6f / math::max(_param_mc_att_idle_rate.get(), IDLE_HOVER_RATE_MIN));
+
+	} else {
+		setControlInterval(0);
+	}
+}
+
 int MulticopterAttitudeControl::task_spawn(int argc, char *argv[])
 {
 	bool vtol = false;
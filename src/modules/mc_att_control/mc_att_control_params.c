@@ -158,3 +158,23 @@ PARAM_DEFINE_FLOAT(MC_YAWRATE_MAX, 200.0f);
  * @group Multicopter Position Control
  */
 PARAM_DEFINE_FLOAT(MC_MAN_TILT_TAU, 0.0f);
+
+/**
+ * Reduced attitude control rate when idle
+ *
+ * If enabled, the attitude controller runs at this rate instead of every
+ * vehicle_attitude update while disarmed, landed or hovering with an
+ * unchanged attitude setpoint that is not generated from the sticks.
+ * The full rate is restored with the next attitude on any setpoint change.
+ * In hover the rate is not reduced below 100 Hz.
+ *
+ * Set to 0 to always run at the attitude estimate rate.
+ *
+ * @unit Hz
+ * @min 0
+ * @max 50
+ * @decimal 0
+ * @increment 5
+ * @group Multicopter Attitude Control
+ */
+PARAM_DEFINE_FLOAT(MC_ATT_IDLE_RATE, 0.f);
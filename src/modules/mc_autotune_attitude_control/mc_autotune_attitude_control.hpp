@@ -169,7 +169,7 @@ private:
 
 	AlphaFilter<float> _signal_filter; ///< used to create a wash-out filter
 
-	static constexpr float _model_dt_min{2e-3f}; // 2ms = 500Hz
+	static constexpr float _model_dt_min{1e-3f}; // 1ms = 1kHz
 	static constexpr float _model_dt_max{10e-3f}; // 10ms = 100Hz
 	int _model_update_scaler{1};
 	int _model_update_counter{0};
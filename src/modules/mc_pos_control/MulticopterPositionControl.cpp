@@ -139,6 +139,15 @@ void MulticopterPositionControl::parameters_update(bool force)
 			param_notify_changes();
 		}
 
+		// setpoint changes only need to wake up the controller while its rate can be reduced
+		if (_param_mpc_idle_rate.get() > 0.f) {
+			_trajectory_setpoint_wakeup_sub.registerCallback();
+
+		} else {
+			_trajectory_setpoint_wakeup_sub.unregisterCallback();
+			setControlInterval(0);
+		}
+
 		if (_param_mpc_tiltmax_air.get() > MAX_SAFE_TILT_DEG) {
 			_param_mpc_tiltmax_air.set(MAX_SAFE_TILT_DEG);
 			_param_mpc_tiltmax_air.commit();
@@ -334,6 +343,7 @@ void MulticopterPositionControl::Run()
 {
 	if (should_exit()) {
 		_local_pos_sub.unregisterCallback();
+		_trajectory_setpoint_wakeup_sub.unregisterCallback();
 		exit_and_cleanup();
 		return;
 	}
@@ -344,6 +354,9 @@ void MulticopterPositionControl::Run()
 	parameters_update(false);
 
 	perf_begin(_cycle_perf);
+
+	checkSetpointWakeup();
+
 	vehicle_local_position_s vehicle_local_position;
 
 	if (_local_pos_sub.update(&vehicle_local_position)) {
@@ -554,11 +567,71 @@ void MulticopterPositionControl::Run()
 			_takeoff_status_pub.get().timestamp = hrt_absolute_time();
 			_takeoff_status_pub.update();
 		}
+
+		if (_param_mpc_idle_rate.get() > 0.f) {
+			updateAdaptiveRate(vehicle_local_position);
+		}
 	}
 
 	perf_end(_cycle_perf);
 }
 
+bool MulticopterPositionControl::trajectorySetpointEqual(const trajectory_setpoint_s &a, const trajectory_setpoint_s &b)
+{
+	// bitwise, unset (NAN) fields compare equal
+	return (memcmp(a.position, b.position, sizeof(a.position)) == 0)
+	       && (memcmp(a.velocity, b.velocity, sizeof(a.velocity)) == 0)
+	       && (memcmp(a.acceleration, b.acceleration, sizeof(a.acceleration)) == 0)
+	       && (memcmp(&a.yaw, &b.yaw, sizeof(a.yaw)) == 0)
+	       && (memcmp(&a.yawspeed, &b.yawspeed, sizeof(a.yawspeed)) == 0);
+}
+
+void MulticopterPositionControl::setControlInterval(uint32_t interval_us)
+{
+	if (interval_us != _reduced_interval_us) {
+		_local_pos_sub.set_interval_us(interval_us);
+		_reduced_interval_us = interval_us;
+	}
+}
+
+void MulticopterPositionControl::checkSetpointWakeup()
+{
+	trajectory_setpoint_s setpoint;
+
+	// separate subscription, the control loop still receives every setpoint
+	if (_trajectory_setpoint_wakeup_sub.update(&setpoint)) {
+		if (!trajectorySetpointEqual(setpoint, _steady_setpoint)) {
+			_steady_setpoint = setpoint;
+			_steady_setpoint_since = setpoint.timestamp;
+
+			// the pending estimate is processed in this cycle
+			setControlInterval(0);
+		}
+	}
+}
+
+void MulticopterPositionControl::updateAdaptiveRate(const vehicle_local_position_s &local_pos)
+{
+	const bool steady_setpoint = (local_pos.timestamp_sample > _steady_setpoint_since + IDLE_HOVER_TIME);
+
+	// armed on ground only with an unchanged setpoint, a takeoff needs the full rate before the land detector reacts
+	const bool on_ground = !_vehicle_control_mode.flag_armed || (_vehicle_land_detected.landed && steady_setpoint);
+
+	const bool steady_hover = steady_setpoint && _vehicle_control_mode.flag_multicopter_position_control_enabled
+				  && local_pos.v_xy_valid && local_pos.v_z_valid
+				  && !Vector3f(local_pos.vx, local_pos.vy, local_pos.vz).longerThan(IDLE_HOVER_VELOCITY);
+
+	if (on_ground) {
+		setControlInterval(1e6f / _param_mpc_idle_rate.get());
+
+	} else if (steady_hover) {
+		setControlInterval(1e6f / math::max(_param_mpc_idle_rate.get(), IDLE_HOVER_RATE_MIN));
+
+	} else {
+		setControlInterval(0);
+	}
+}
+
 trajectory_setpoint_s MulticopterPositionControl::generateFailsafeSetpoint(const hrt_abstime &now,
 		const PositionControlStates &states, bool warn)
 {
@@ -98,6 +98,7 @@ private:
 	uORB::Publication<vehicle_local_position_setpoint_s> _local_pos_sp_pub{ORB_ID(vehicle_local_position_setpoint)};	/**< vehicle local position setpoint publication */
 
 	uORB::SubscriptionCallbackWorkItem _local_pos_sub{this, ORB_ID(vehicle_local_position)};	/**< vehicle local position */
+	uORB::SubscriptionCallbackWorkItem _trajectory_setpoint_wakeup_sub{this, ORB_ID(trajectory_setpoint)};	/**< restores the full rate on setpoint changes (MPC_IDLE_RATE) */
 
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 
@@ -182,7 +183,8 @@ private:
 
 		(ParamFloat<px4::params::MPC_XY_ERR_MAX>) _param_mpc_xy_err_max,
 		(ParamFloat<px4::params::MPC_YAWRAUTO_MAX>) _param_mpc_yawrauto_max,
-		(ParamFloat<px4::params::MPC_YAWRAUTO_ACC>) _param_mpc_yawrauto_acc
+		(ParamFloat<px4::params::MPC_YAWRAUTO_ACC>) _param_mpc_yawrauto_acc,
+		(ParamFloat<px4::params::MPC_IDLE_RATE>)    _param_mpc_idle_rate
 	);
 
 	control::BlockDerivative _vel_x_deriv; /**< velocity derivative in x */
@@ -196,6 +198,15 @@ private:
 
 	bool _hover_thrust_initialized{false};
 
+	// adaptive rate (MPC_IDLE_RATE)
+	trajectory_setpoint_s _steady_setpoint{};	/**< setpoint at the beginning of a steady hover */
+	hrt_abstime _steady_setpoint_since{0};
+	uint32_t _reduced_interval_us{0};		/**< current interval of the local position callback, 0 at full rate */
+
+	static constexpr float IDLE_HOVER_RATE_MIN = 25.f;	/**< lower rate limit in hover, the controller dt is limited to 40 ms */
+	static constexpr hrt_abstime IDLE_HOVER_TIME = 1_s;	/**< time of unchanged setpoint before reducing the rate in hover */
+	static constexpr float IDLE_HOVER_VELOCITY = 0.3f;	/**< maximum velocity in steady hover [m/s] */
+
 	/** Timeout in us for trajectory data to get considered invalid */
 	static constexpr uint64_t TRAJECTORY_STREAM_TIMEOUT_US = 500_ms;
 
@@ -221,6 +232,20 @@ private:
 	 */
 	void parameters_update(bool force);
 
+	/**
+	 * Reduce the local position callback rate while disarmed, landed or in steady hover (MPC_IDLE_RATE).
+	 */
+	void updateAdaptiveRate(const vehicle_local_position_s &local_pos);
+
+	/**
+	 * Restore the full rate if the trajectory setpoint changed since the beginning of the idle period.
+	 */
+	void checkSetpointWakeup();
+
+	static bool trajectorySetpointEqual(const trajectory_setpoint_s &a, const trajectory_setpoint_s &b);
+
+	void setControlInterval(uint32_t interval_us);
+
 	/**
 	 * Check for validity of positon/velocity states.
 	 */
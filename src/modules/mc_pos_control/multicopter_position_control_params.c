@@ -85,3 +85,23 @@ PARAM_DEFINE_FLOAT(MPC_THR_XY_MARG, 0.3f);
  * @group Multicopter Position Control
  */
 PARAM_DEFINE_FLOAT(MPC_VELD_LP, 5.0f);
+
+/**
+ * Reduced position control rate when idle
+ *
+ * If enabled, the position controller runs at this rate instead of every
+ * vehicle_local_position update while disarmed, landed or hovering with
+ * an unchanged trajectory setpoint at low velocity. The full rate is restored
+ * with the next estimate on any setpoint change.
+ * In hover the rate is not reduced below 25 Hz.
+ *
+ * Set to 0 to always run at the estimator rate.
+ *
+ * @unit Hz
+ * @min 0
+ * @max 50
+ * @decimal 0
+ * @increment 5
+ * @group Multicopter Position Control
+ */
+PARAM_DEFINE_FLOAT(MPC_IDLE_RATE, 0.f);
@@ -48,7 +48,8 @@ MulticopterRateControl::MulticopterRateControl(bool vtol) :
 	WorkItem(MODULE_NAME, px4::wq_configurations::rate_ctrl),
 	_vehicle_torque_setpoint_pub(vtol ? ORB_ID(vehicle_torque_setpoint_virtual_mc) : ORB_ID(vehicle_torque_setpoint)),
 	_vehicle_thrust_setpoint_pub(vtol ? ORB_ID(vehicle_thrust_setpoint_virtual_mc) : ORB_ID(vehicle_thrust_setpoint)),
-	_loop_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": cycle"))
+	_loop_perf(perf_alloc(PC_HISTOGRAM, MODULE_NAME": cycle")),
+	_latency_perf(perf_alloc(PC_HISTOGRAM, PERF_LATENCY_PREFIX "2 vehicle_torque_setpoint"))
 {
 	_vehicle_status.vehicle_type = vehicle_status_s::VEHICLE_TYPE_ROTARY_WING;
 
@@ -59,6 +60,7 @@ MulticopterRateControl::MulticopterRateControl(bool vtol) :
 MulticopterRateControl::~MulticopterRateControl()
 {
 	perf_free(_loop_perf);
+	perf_free(_latency_perf);
 }
 
 bool
@@ -95,6 +97,14 @@ MulticopterRateControl::parameters_updated()
 	// manual rate control acro mode rate limits
 	_acro_rate_max = Vector3f(radians(_param_mc_acro_r_max.get()), radians(_param_mc_acro_p_max.get()),
 				  radians(_param_mc_acro_y_max.get()));
+
+	// the gyro sub-samples are only published while subscribed
+	if (_param_mc_rate_substep.get()) {
+		_vehicle_angular_velocity_substeps_sub.subscribe();
+
+	} else {
+		_vehicle_angular_velocity_substeps_sub.unsubscribe();
+	}
 }
 
 void
@@ -114,8 +124,9 @@ MulticopterRateControl::Run()
 		parameter_update_s param_update;
 		_parameter_update_sub.copy(&param_update);
 
-		updateParams();
-		parameters_updated();
+		if (updateParamsIfChanged(param_update)) {
+			parameters_updated();
+		}
 	}
 
 	/* run controller on gyro changes */
@@ -213,13 +224,49 @@ MulticopterRateControl::Run()
 				_rate_control.setSaturationStatus(saturation_positive, saturation_negative);
 			}
 
-			// run rate controller
-			const Vector3f att_control = _rate_control.update(rates, _rates_setpoint, angular_accel, dt, _maybe_landed || _landed);
+			// add the frequency response analyzer excitation, evaluated at the gyro sample time
+			Vector3f rates_setpoint{_rates_setpoint};
+			_rate_loop_excitation_sub.update(&_rate_loop_excitation);
+
+			if ((_rate_loop_excitation.start_time != 0) && (now >= _rate_loop_excitation.start_time)
+			    && (hrt_elapsed_time(&_rate_loop_excitation.timestamp) < 1_s) && (_rate_loop_excitation.axis < 3)) {
+				const float t = (now - _rate_loop_excitation.start_time) * 1e-6f;
+				rates_setpoint(_rate_loop_excitation.axis) += _rate_loop_excitation.amplitude * signal_generator::getSignal(
+							static_cast<signal_generator::SignalType>(_rate_loop_excitation.signal),
+							_rate_loop_excitation.frequency_start, _rate_loop_excitation.frequency_end,
+							_rate_loop_excitation.duration, t);
+			}
+
+			// run rate controller, on every gyro sub-sample if available
+			Vector3f att_control;
+			vehicle_angular_velocity_substeps_s substeps;
+
+			if (_param_mc_rate_substep.get() && _vehicle_angular_velocity_substeps_sub.update(&substeps)
+			    && (substeps.timestamp_sample == angular_velocity.timestamp_sample)
+			    && (substeps.samples > 0) && (substeps.samples <= sizeof(substeps.x) / sizeof(substeps.x[0]))
+			    && (substeps.dt > 0.f)) {
+
+				const float *const substep_rates[3] {substeps.x, substeps.y, substeps.z};
+				const float *const substep_angular_accel[3] {substeps.x_derivative, substeps.y_derivative, substeps.z_derivative};
+
+				att_control = _rate_control.update(substep_rates, substep_angular_accel, substeps.samples, rates_setpoint,
+								   substeps.dt, _maybe_landed || _landed);
+
+			} else {
+				att_control = _rate_control.update(rates, rates_setpoint, angular_accel, dt, _maybe_landed || _landed);
+			}
 
 			// publish rate controller status
 			rate_ctrl_status_s rate_ctrl_status{};
 			_rate_control.getRateControlStatus(rate_ctrl_status);
 			rate_ctrl_status.timestamp = hrt_absolute_time();
+
+			// deadline missed if the next gyro sample was already due when the output is ready
+			if (rate_ctrl_status.timestamp - angular_velocity.timestamp_sample > dt * 1e6f) {
+				_deadline_miss_count++;
+			}
+
+			rate_ctrl_status.deadline_miss_count = _deadline_miss_count;
 			_controller_status_pub.publish(rate_ctrl_status);
 
 			// publish thrust and torque setpoints
@@ -257,6 +304,8 @@ MulticopterRateControl::Run()
 			vehicle_torque_setpoint.timestamp = hrt_absolute_time();
 			_vehicle_torque_setpoint_pub.publish(vehicle_torque_setpoint);
 
+			perf_set_elapsed(_latency_perf, vehicle_torque_setpoint.timestamp - vehicle_torque_setpoint.timestamp_sample);
+
 			updateActuatorControlsStatus(vehicle_torque_setpoint, dt);
 
 		}
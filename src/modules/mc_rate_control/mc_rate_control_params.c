@@ -292,3 +292,17 @@ PARAM_DEFINE_FLOAT(MC_YAWRATE_K, 1.0f);
  * @group Multicopter Rate Control
  */
 PARAM_DEFINE_INT32(MC_BAT_SCALE_EN, 0);
+
+/**
+ * Run the rate controller on every gyro FIFO sample
+ *
+ * If enabled, the rate PID is evaluated for each filtered gyro FIFO sample
+ * (vehicle_angular_velocity_substeps) since the last vehicle_angular_velocity
+ * publication, so the integral and derivative terms run at the full sensor rate
+ * while torque setpoints, allocation and outputs keep running at IMU_GYRO_RATEMAX.
+ * Requires a gyro with FIFO. Without sub-samples the controller runs once per update.
+ *
+ * @boolean
+ * @group Multicopter Rate Control
+ */
+PARAM_DEFINE_INT32(MC_RATE_SUBSTEP, 0);
@@ -32,19 +32,11 @@
  ****************************************************************************/
 
 #include <px4_platform_common/log.h>
+#include <uORB/topics/uORBTopics.hpp>
 #include "mUORBAggregator.hpp"
 
 const bool mUORB::Aggregator::debugFlag = false;
 
-bool mUORB::Aggregator::NewRecordOverflows(const char *messageName, int32_t length)
-{
-	if (! messageName) { return false; }
-
-	uint32_t messageNameLength = strlen(messageName);
-	uint32_t newMessageRecordTotalLength = headerSize + messageNameLength + length;
-	return ((bufferWriteIndex + newMessageRecordTotalLength) > bufferSize);
-}
-
 void mUORB::Aggregator::MoveToNextBuffer()
 {
 	bufferWriteIndex = 0;
@@ -52,21 +44,63 @@ void mUORB::Aggregator::MoveToNextBuffer()
 	bufferId %= numBuffers;
 }
 
-void mUORB::Aggregator::AddRecordToBuffer(const char *messageName, int32_t length, const uint8_t *data)
+void mUORB::Aggregator::AddRecordToBuffer(uint8_t sync, uint8_t id, uint32_t length, const uint8_t *data)
 {
-	if (! messageName) { return; }
-
-	uint32_t messageNameLength = strlen(messageName);
-	memcpy(&buffer[bufferId][bufferWriteIndex], (uint8_t *) &syncFlag, syncFlagSize);
-	bufferWriteIndex += syncFlagSize;
-	memcpy(&buffer[bufferId][bufferWriteIndex], (uint8_t *) &messageNameLength, topicNameLengthSize);
-	bufferWriteIndex += topicNameLengthSize;
-	memcpy(&buffer[bufferId][bufferWriteIndex], (uint8_t *) &length, dataLengthSize);
-	bufferWriteIndex += dataLengthSize;
-	memcpy(&buffer[bufferId][bufferWriteIndex], (uint8_t *) messageName, messageNameLength);
-	bufferWriteIndex += messageNameLength;
-	memcpy(&buffer[bufferId][bufferWriteIndex], data, length);
-	bufferWriteIndex += length;
+	if (bufferWriteIndex == 0) {
+		bufferFirstRecordTime = hrt_absolute_time();
+	}
+
+	const uint16_t record_length = length;
+	uint8_t *record = &buffer[bufferId][bufferWriteIndex];
+	record[0] = sync;
+	record[1] = id;
+	memcpy(&record[2], &record_length, sizeof(record_length));
+	memcpy(&record[headerSize], data, length);
+	bufferWriteIndex += headerSize + length;
+}
+
+const char *mUORB::Aggregator::FindLocalTopic(const char *name, uint32_t name_length)
+{
+	const orb_metadata *const *topics = orb_get_topics();
+
+	for (size_t i = 0; i < orb_topics_count(); i++) {
+		if ((strncmp(name, topics[i]->o_name, name_length) == 0) && (topics[i]->o_name[name_length] == '\0')) {
+			return topics[i]->o_name;
+		}
+	}
+
+	return nullptr;
+}
+
+int mUORB::Aggregator::GetTxTopicId(const char *topic)
+{
+	// topic normally is the uORB metadata string, so a pointer compare is enough
+	for (int i = 0; i < numTxTopics; i++) {
+		if (txTopics[i] == topic) {
+			return i;
+		}
+	}
+
+	for (int i = 0; i < numTxTopics; i++) {
+		if (strcmp(txTopics[i], topic) == 0) {
+			return i;
+		}
+	}
+
+	if (numTxTopics >= maxTopics) {
+		return -1;
+	}
+
+	// only register uORB topics, as the stored name has to remain valid
+	const char *local_topic = FindLocalTopic(topic, strlen(topic));
+
+	if (!local_topic) {
+		return -1;
+	}
+
+	txTopics[numTxTopics] = local_topic;
+	txAnnounced[numTxTopics] = false;
+	return numTxTopics++;
 }
 
 int16_t mUORB::Aggregator::SendData()
@@ -85,23 +119,50 @@ int16_t mUORB::Aggregator::SendData()
 	return rc;
 }
 
+int16_t mUORB::Aggregator::SendDueData()
+{
+	if (bufferWriteIndex && (hrt_elapsed_time(&bufferFirstRecordTime) >= flushDeadlineUs)) {
+		return SendData();
+	}
+
+	return 0;
+}
+
 int16_t mUORB::Aggregator::ProcessTransmitTopic(const char *topic, const uint8_t *data, uint32_t length_in_bytes)
 {
 	int16_t rc = 0;
 
-	if (sendFunc) {
-		if (aggregationEnabled) {
-			if (NewRecordOverflows(topic, length_in_bytes)) {
-				rc = SendData();
-			}
+	if (!sendFunc || !topic) {
+		return rc;
+	}
 
-			AddRecordToBuffer(topic, length_in_bytes, data);
+	const int id = aggregationEnabled ? GetTxTopicId(topic) : -1;
+	const uint32_t name_length = strlen(topic);
 
-		} else if (topic) {
-			rc = sendFunc(topic, data, length_in_bytes);
-		}
+	if ((id < 0) || (headerSize + name_length + headerSize + length_in_bytes > bufferSize)) {
+		// cannot be aggregated, send it on its own
+		return sendFunc(topic, data, length_in_bytes);
 	}
 
+	if (hrt_elapsed_time(&lastAnnounceTime) >= announceIntervalUs) {
+		// periodically repeat the definitions in case the receiver restarted
+		memset(txAnnounced, 0, sizeof(txAnnounced));
+		lastAnnounceTime = hrt_absolute_time();
+	}
+
+	const uint32_t definition_length = txAnnounced[id] ? 0 : headerSize + name_length;
+
+	if (NewRecordOverflows(definition_length + length_in_bytes)) {
+		rc = SendData();
+	}
+
+	if (!txAnnounced[id]) {
+		AddRecordToBuffer(definitionSyncFlag, id, name_length, (const uint8_t *) topic);
+		txAnnounced[id] = true;
+	}
+
+	AddRecordToBuffer(dataSyncFlag, id, length_in_bytes, data);
+
 	return rc;
 }
 
@@ -111,51 +172,53 @@ void mUORB::Aggregator::ProcessReceivedTopic(const char *topic, const uint8_t *d
 		if (debugFlag) { PX4_INFO("Parsing aggregate buffer of length %u", length_in_bytes); }
 
 		uint32_t current_index = 0;
-		const uint32_t name_buffer_length = 80;
-		char name_buffer[name_buffer_length];
 
-		while ((current_index + headerSize) < length_in_bytes) {
-			uint32_t sync_flag = *((uint32_t *) &data[current_index]);
+		while ((current_index + headerSize) <= length_in_bytes) {
+			const uint8_t sync_flag = data[current_index];
+			const uint8_t id = data[current_index + 1];
+			uint16_t record_length;
+			memcpy(&record_length, &data[current_index + 2], sizeof(record_length));
 
-			if (sync_flag != syncFlag) {
+			if ((sync_flag != dataSyncFlag) && (sync_flag != definitionSyncFlag)) {
 				PX4_ERR("Expected sync flag but got 0x%X", sync_flag);
 				break;
 			}
 
-			current_index += syncFlagSize;
+			current_index += headerSize;
 
-			uint32_t name_length = *((uint32_t *) &data[current_index]);
+			const uint32_t remaining_bytes = length_in_bytes - current_index;
 
-			// Make sure name plus a terminating null can fit into our buffer
-			if (name_length > (name_buffer_length - 1)) {
-				PX4_ERR("Name length too long %u", name_length);
+			if (record_length > remaining_bytes) {
+				PX4_ERR("Payload too big %u. Remaining bytes %u", record_length, remaining_bytes);
 				break;
 			}
 
-			current_index += topicNameLengthSize;
+			const uint8_t *payload = &data[current_index];
+			current_index += record_length;
+
+			if (id >= maxTopics) {
+				PX4_ERR("Invalid topic ID %u", id);
+				break;
+			}
 
-			uint32_t data_length = *((uint32_t *) &data[current_index]);
-			current_index += dataLengthSize;
+			if (sync_flag == definitionSyncFlag) {
+				rxTopics[id] = FindLocalTopic((const char *) payload, record_length);
 
-			int32_t payload_size = name_length + data_length;
-			int32_t remaining_bytes = length_in_bytes - current_index;
+				if (debugFlag) { PX4_INFO("Topic ID %u: %.*s", id, (int) record_length, (const char *) payload); }
 
-			if (payload_size > remaining_bytes) {
-				PX4_ERR("Payload too big %u. Remaining bytes %d", payload_size, remaining_bytes);
-				break;
+				continue;
 			}
 
-			memcpy(name_buffer, &data[current_index], name_length);
-			name_buffer[name_length] = 0;
+			if (!rxTopics[id]) {
+				// definition not received yet (or topic unknown locally), it is repeated periodically
+				if (debugFlag) { PX4_INFO("Dropping data for unknown topic ID %u", id); }
 
-			current_index += name_length;
+				continue;
+			}
 
-			if (debugFlag) { PX4_INFO("Parsed topic: %s, name length %u, data length: %u", name_buffer, name_length, data_length); }
+			if (debugFlag) { PX4_INFO("Parsed topic: %s, data length: %u", rxTopics[id], record_length); }
 
-			_RxHandler->process_received_message(name_buffer,
-							     data_length,
-							     const_cast<uint8_t *>(&data[current_index]));
-			current_index += data_length;
+			_RxHandler->process_received_message(rxTopics[id], record_length, const_cast<uint8_t *>(payload));
 		}
 
 	} else {
@@ -35,11 +35,24 @@
 
 #include <string>
 #include <string.h>
+#include <drivers/drv_hrt.h>
 #include "uORB/uORBCommunicator.hpp"
 
 namespace mUORB
 {
 
+/**
+ * Packs topic data into buffers that are sent as a single "aggregation" message.
+ *
+ * Records are framed with a compact topic ID instead of the topic name. The ID
+ * table is negotiated in-band: the first record of a topic (and again every
+ * announceIntervalUs, so that a restarted receiver recovers) is preceded by a
+ * definition record that maps the ID to the topic name.
+ *
+ * Record layout (host byte order, both sides run on the same architecture):
+ *   uint8_t sync, uint8_t topic_id, uint16_t length, payload
+ * For a definition record the payload is the topic name (not null-terminated).
+ */
 class Aggregator
 {
 public:
@@ -53,8 +66,19 @@ public:
 
 	void ProcessReceivedTopic(const char *topic, const uint8_t *data, uint32_t length_in_bytes);
 
+	/**
+	 * Send the current buffer (if not empty).
+	 */
 	int16_t SendData();
 
+	/**
+	 * Send the current buffer if its oldest record is older than the flush deadline.
+	 * Meant to be called periodically, at a fraction of flushDeadlineUs.
+	 */
+	int16_t SendDueData();
+
+	static constexpr hrt_abstime flushDeadlineUs = 1000;
+
 private:
 	static const bool debugFlag;
 
@@ -63,29 +87,51 @@ private:
 	// Master flag to enable aggregation
 	const bool aggregationEnabled = true;
 
-	const uint32_t syncFlag = 0x5A01FF00;
-	const uint32_t syncFlagSize = 4;
-	const uint32_t topicNameLengthSize = 4;
-	const uint32_t dataLengthSize = 4;
-	const uint32_t headerSize = syncFlagSize + topicNameLengthSize + dataLengthSize;
+	static constexpr uint8_t dataSyncFlag = 0xA5;
+	static constexpr uint8_t definitionSyncFlag = 0xA6;
+	static constexpr uint32_t headerSize = 4;
 	static const uint32_t numBuffers = 2;
 	static const uint32_t bufferSize = 2048;
 
-	uint32_t bufferId;
-	uint32_t bufferWriteIndex;
+	static constexpr int maxTopics = 255;
+	static constexpr hrt_abstime announceIntervalUs = 1000000;
+
+	uint32_t bufferId{0};
+	uint32_t bufferWriteIndex{0};
 	uint8_t  buffer[numBuffers][bufferSize];
+	hrt_abstime bufferFirstRecordTime{0};
 
-	uORBCommunicator::IChannelRxHandler *_RxHandler;
+	// transmit side: topic name (uORB metadata string) for each ID
+	const char *txTopics[maxTopics] {};
+	bool txAnnounced[maxTopics] {};
+	int numTxTopics{0};
+	hrt_abstime lastAnnounceTime{0};
 
-	sendFuncPtr sendFunc;
+	// receive side: local topic name for each remote ID
+	const char *rxTopics[maxTopics] {};
+
+	uORBCommunicator::IChannelRxHandler *_RxHandler{nullptr};
+
+	sendFuncPtr sendFunc{nullptr};
 
 	bool isAggregate(const char *name) { return (strcmp(name, topicName.c_str()) == 0); }
 
-	bool NewRecordOverflows(const char *messageName, int32_t length);
+	/**
+	 * Get the ID of a topic to transmit, registering it if needed.
+	 * @return ID or -1 if the topic cannot be aggregated
+	 */
+	int GetTxTopicId(const char *topic);
+
+	/**
+	 * Find the local uORB topic name matching a name received from remote.
+	 */
+	static const char *FindLocalTopic(const char *name, uint32_t name_length);
+
+	bool NewRecordOverflows(uint32_t length) const { return (bufferWriteIndex + headerSize + length) > bufferSize; }
 
 	void MoveToNextBuffer();
 
-	void AddRecordToBuffer(const char *messageName, int32_t length, const uint8_t *data);
+	void AddRecordToBuffer(uint8_t sync, uint8_t id, uint32_t length, const uint8_t *data);
 };
 
 }
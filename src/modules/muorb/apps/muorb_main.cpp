@@ -45,6 +45,16 @@ static bool enable_debug = false;
 int
 muorb_main(int argc, char *argv[])
 {
+	if ((argc > 1) && (strcmp(argv[1], "status") == 0)) {
+		if (uORB::AppsProtobufChannel::isInstance()) {
+			uORB::AppsProtobufChannel::GetInstance()->PrintStatus();
+			return OK;
+		}
+
+		PX4_INFO("not running");
+		return OK;
+	}
+
 	return muorb_init();
 }
 
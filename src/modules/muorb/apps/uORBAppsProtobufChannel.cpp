@@ -36,6 +36,11 @@
 
 #include "fc_sensor.h"
 
+#ifdef CONFIG_MUORB_SHM
+#include <rpcmem.h>
+#include <unistd.h>
+#endif
+
 bool uORB::AppsProtobufChannel::test_flag = false;
 
 // Initialize the static members
@@ -47,6 +52,23 @@ pthread_mutex_t uORB::AppsProtobufChannel::_tx_mutex = PTHREAD_MUTEX_INITIALIZER
 pthread_mutex_t uORB::AppsProtobufChannel::_rx_mutex = PTHREAD_MUTEX_INITIALIZER;
 bool uORB::AppsProtobufChannel::_Debug = false;
 
+#ifdef CONFIG_MUORB_SHM
+mUORB::Shm uORB::AppsProtobufChannel::_Shm;
+
+// High rate topics published on the DSP that are passed through shared memory
+static const char *const shm_topics[] = {
+	"sensor_gyro_fifo",
+	"sensor_accel_fifo",
+	"sensor_gyro",
+	"sensor_accel",
+	"actuator_outputs",
+	"esc_status",
+};
+
+// Polling interval of the shared memory rings
+static constexpr useconds_t shm_poll_interval_us = 500;
+#endif
+
 
 void uORB::AppsProtobufChannel::ReceiveCallback(const char *topic,
 		const uint8_t *data,
@@ -234,6 +256,10 @@ bool uORB::AppsProtobufChannel::Initialize(bool enable_debug)
 		} else {
 			PX4_INFO("muorb protobuf initalize method succeeded");
 			_Initialized = true;
+
+#ifdef CONFIG_MUORB_SHM
+			SetupShm();
+#endif
 		}
 
 	} else {
@@ -326,3 +352,70 @@ int16_t uORB::AppsProtobufChannel::send_message(const char *messageName, int len
 
 	return -1;
 }
+
+void uORB::AppsProtobufChannel::PrintStatus()
+{
+#ifdef CONFIG_MUORB_SHM
+	_Shm.PrintStatus();
+#else
+	PX4_INFO("shared memory transport not enabled");
+#endif
+}
+
+#ifdef CONFIG_MUORB_SHM
+void uORB::AppsProtobufChannel::SetupShm()
+{
+	const int num_topics = sizeof(shm_topics) / sizeof(shm_topics[0]);
+	const size_t size = mUORB::Shm::RequiredSize(shm_topics, num_topics);
+
+	// uncached, so that no cache maintenance is needed between the processors
+	void *mem = rpcmem_alloc(RPCMEM_HEAP_ID_SYSTEM, RPCMEM_DEFAULT_FLAGS | RPCMEM_FLAG_UNCACHED, size);
+
+	if (mem == nullptr) {
+		PX4_ERR("shm: rpcmem_alloc failed, using the regular channel");
+		return;
+	}
+
+	memset(mem, 0, size);
+
+	mUORB::Shm::Setup setup{};
+	setup.fd = rpcmem_to_fd(mem);
+	setup.size = size;
+
+	if ((setup.fd < 0) || !_Shm.Init(mem, size, shm_topics, num_topics)) {
+		PX4_ERR("shm: init failed, using the regular channel");
+		rpcmem_free(mem);
+		return;
+	}
+
+	// start reading before the DSP switches over, so nothing is missed
+	if (pthread_create(&_ShmThread, nullptr, &ShmThread, nullptr) != 0) {
+		PX4_ERR("shm: thread create failed, using the regular channel");
+		return;
+	}
+
+	pthread_mutex_lock(&_tx_mutex);
+	int rc = fc_sensor_send_data(mUORB::Shm::setupTopicName, (const uint8_t *) &setup, sizeof(setup));
+	pthread_mutex_unlock(&_tx_mutex);
+
+	if (rc != 0) {
+		PX4_ERR("shm: sending setup failed (%d)", rc);
+
+	} else {
+		PX4_INFO("shm: %u bytes shared with the DSP", (unsigned) size);
+	}
+}
+
+void *uORB::AppsProtobufChannel::ShmThread(void *arg)
+{
+	while (true) {
+		if (_RxHandler) {
+			_Shm.Poll(_RxHandler);
+		}
+
+		usleep(shm_poll_interval_us);
+	}
+
+	return nullptr;
+}
+#endif
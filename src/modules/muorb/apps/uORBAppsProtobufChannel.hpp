@@ -44,6 +44,10 @@
 #include "uORB/uORBCommunicator.hpp"
 #include "mUORBAggregator.hpp"
 
+#ifdef CONFIG_MUORB_SHM
+#include "mUORBShm.hpp"
+#endif
+
 namespace uORB
 {
 class AppsProtobufChannel;
@@ -156,6 +160,11 @@ public:
 	 */
 	bool Test();
 
+	/**
+	 * Print the status of the shared memory transport.
+	 */
+	void PrintStatus();
+
 private:
 	/**
 	 * Data Members
@@ -171,6 +180,18 @@ private:
 	bool                                        _Initialized;
 	uint32_t                                    _MessageCounter;
 
+#ifdef CONFIG_MUORB_SHM
+	static mUORB::Shm                           _Shm;
+	pthread_t                                   _ShmThread;
+
+	/**
+	 * Allocate the shared memory region, pass it to the DSP and start polling it.
+	 */
+	void SetupShm();
+
+	static void *ShmThread(void *arg);
+#endif
+
 private:
 	/**
 	 * Class Members
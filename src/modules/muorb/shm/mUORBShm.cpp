@@ -0,0 +1,253 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <px4_platform_common/log.h>
+#include <uORB/topics/uORBTopics.hpp>
+#include <inttypes.h>
+#include <string.h>
+#include "mUORBShm.hpp"
+
+const struct orb_metadata *mUORB::Shm::FindMeta(const char *name)
+{
+	const orb_metadata *const *topics = orb_get_topics();
+
+	for (size_t i = 0; i < orb_topics_count(); i++) {
+		if (strcmp(name, topics[i]->o_name) == 0) {
+			return topics[i];
+		}
+	}
+
+	return nullptr;
+}
+
+size_t mUORB::Shm::RequiredSize(const char *const topics[], int num_topics)
+{
+	size_t size = sizeof(RegionHeader);
+
+	for (int i = 0; i < num_topics && i < maxTopics; i++) {
+		const orb_metadata *meta = FindMeta(topics[i]);
+
+		if (meta && meta->o_size <= maxDataSize) {
+			size = (size + 7) & ~(size_t)7;
+			size += sizeof(uorb_shm_header) + queueLength * SlotSize(meta->o_size);
+		}
+	}
+
+	return size;
+}
+
+bool mUORB::Shm::Init(void *mem, size_t size, const char *const topics[], int num_topics)
+{
+	if (!mem || (size < RequiredSize(topics, num_topics))) {
+		return false;
+	}
+
+	RegionHeader *region = static_cast<RegionHeader *>(mem);
+	size_t offset = sizeof(RegionHeader);
+	_num_topics = 0;
+
+	for (int i = 0; i < num_topics && i < maxTopics; i++) {
+		const orb_metadata *meta = FindMeta(topics[i]);
+
+		if (!meta || meta->o_size > maxDataSize) {
+			PX4_WARN("shm: skipping topic %s", topics[i]);
+			continue;
+		}
+
+		offset = (offset + 7) & ~(size_t)7;
+
+		// the region is zeroed, so all slot sequences are 0 (no message)
+		uorb_shm_header *header = reinterpret_cast<uorb_shm_header *>(static_cast<uint8_t *>(mem) + offset);
+		header->version = UORB_SHM_VERSION;
+		header->message_hash = meta->message_hash;
+		header->data_size = meta->o_size;
+		header->slot_size = SlotSize(meta->o_size);
+		header->queue_length = queueLength;
+		header->write_count = 0;
+		strncpy(header->name, meta->o_name, sizeof(header->name) - 1);
+		header->magic = UORB_SHM_MAGIC;
+
+		region->topic_offset[_num_topics] = offset;
+
+		Topic &topic = _topics[_num_topics++];
+		topic.name = meta->o_name;
+		topic.header = header;
+		topic.slots = reinterpret_cast<uint8_t *>(header + 1);
+		topic.next_index = 0;
+		topic.lost = 0;
+
+		offset += sizeof(uorb_shm_header) + queueLength * header->slot_size;
+	}
+
+	region->version = regionVersion;
+	region->size = size;
+	region->num_topics = _num_topics;
+	__atomic_store_n(&region->magic, regionMagic, __ATOMIC_RELEASE);
+
+	_region = region;
+	return true;
+}
+
+bool mUORB::Shm::Attach(void *mem, size_t size)
+{
+	RegionHeader *region = static_cast<RegionHeader *>(mem);
+
+	if (!mem || (size < sizeof(RegionHeader))
+	    || (__atomic_load_n(&region->magic, __ATOMIC_ACQUIRE) != regionMagic)
+	    || (region->version != regionVersion) || (region->size > size) || (region->num_topics > maxTopics)) {
+		PX4_ERR("shm: invalid region");
+		return false;
+	}
+
+	_num_topics = 0;
+
+	for (uint32_t i = 0; i < region->num_topics; i++) {
+		const uint32_t offset = region->topic_offset[i];
+
+		if ((offset + sizeof(uorb_shm_header) > size) || (offset & 7)) {
+			PX4_ERR("shm: invalid topic offset %" PRIu32, offset);
+			return false;
+		}
+
+		uorb_shm_header *header = reinterpret_cast<uorb_shm_header *>(static_cast<uint8_t *>(mem) + offset);
+		char name[UORB_SHM_NAME_LEN];
+		memcpy(name, header->name, sizeof(name));
+		name[sizeof(name) - 1] = '\0';
+
+		const orb_metadata *meta = FindMeta(name);
+
+		if (!meta || (header->magic != UORB_SHM_MAGIC) || (header->message_hash != meta->message_hash)
+		    || (header->data_size != meta->o_size) || (header->slot_size != SlotSize(meta->o_size))
+		    || (offset + sizeof(uorb_shm_header) + header->queue_length * header->slot_size > size)) {
+			// keep using the regular channel for this topic
+			PX4_WARN("shm: topic %s mismatch", name);
+			continue;
+		}
+
+		Topic &topic = _topics[_num_topics++];
+		topic.name = meta->o_name;
+		topic.header = header;
+		topic.slots = reinterpret_cast<uint8_t *>(header + 1);
+		topic.next_index = __atomic_load_n(&header->write_count, __ATOMIC_ACQUIRE);
+		topic.lost = 0;
+	}
+
+	_region = region;
+	return true;
+}
+
+bool mUORB::Shm::Write(const char *topic_name, const uint8_t *data, uint32_t length_in_bytes)
+{
+	if (!_region) {
+		return false;
+	}
+
+	Topic *topic = nullptr;
+
+	// topic_name normally is the uORB metadata string, so a pointer compare is enough
+	for (int i = 0; i < _num_topics; i++) {
+		if (_topics[i].name == topic_name) {
+			topic = &_topics[i];
+			break;
+		}
+	}
+
+	if (!topic || (length_in_bytes != topic->header->data_size)) {
+		return false;
+	}
+
+	// same protocol as the uorb_shm_bridge writer
+	const uint64_t index = topic->next_index;
+	uint8_t *slot = topic->slots + (index % topic->header->queue_length) * topic->header->slot_size;
+	uint64_t *sequence = reinterpret_cast<uint64_t *>(slot);
+
+	__atomic_store_n(sequence, 2 * index + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	memcpy(slot + sizeof(uint64_t), data, length_in_bytes);
+
+	__atomic_store_n(sequence, 2 * index + 2, __ATOMIC_RELEASE);
+
+	topic->next_index++;
+	__atomic_store_n(&topic->header->write_count, topic->next_index, __ATOMIC_RELEASE);
+
+	return true;
+}
+
+int mUORB::Shm::Poll(uORBCommunicator::IChannelRxHandler *handler)
+{
+	int num_messages = 0;
+
+	if (!_region || !handler) {
+		return 0;
+	}
+
+	for (int i = 0; i < _num_topics; i++) {
+		Topic &topic = _topics[i];
+		const uint64_t write_count = uorb_shm_write_count(topic.header);
+
+		if (write_count - topic.next_index > topic.header->queue_length) {
+			// the DSP lapped us
+			topic.lost += write_count - topic.header->queue_length - topic.next_index;
+			topic.next_index = write_count - topic.header->queue_length;
+		}
+
+		while (topic.next_index < write_count) {
+			if (uorb_shm_read(topic.header, topic.next_index, _buffer) == 0) {
+				handler->process_received_message(topic.name, topic.header->data_size, _buffer);
+				++num_messages;
+
+			} else {
+				++topic.lost;
+			}
+
+			++topic.next_index;
+		}
+	}
+
+	return num_messages;
+}
+
+void mUORB::Shm::PrintStatus() const
+{
+	if (!_region) {
+		PX4_INFO("shm: not active");
+		return;
+	}
+
+	for (int i = 0; i < _num_topics; i++) {
+		PX4_INFO_RAW("shm %s: %" PRIu64 " messages, %" PRIu64 " lost\n", _topics[i].name,
+			     uorb_shm_write_count(_topics[i].header), _topics[i].lost);
+	}
+}
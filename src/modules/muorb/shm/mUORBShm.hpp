@@ -0,0 +1,135 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <modules/uorb_shm_bridge/uorb_shm.h>
+#include "uORB/uORBCommunicator.hpp"
+
+namespace mUORB
+{
+
+/**
+ * Shared memory transport for high rate topics between the DSP and the apps processor.
+ *
+ * The apps side allocates a buffer that is mapped on both processors, formats it with
+ * one ring per topic and passes it to the DSP over the regular channel (setup topic).
+ * The DSP then writes these topics into the rings instead of sending them through the
+ * aggregator, and the apps side polls the rings. Control messages (advertise, subscribe)
+ * keep using the regular channel.
+ *
+ * Each ring has the layout of the uorb_shm_bridge (uorb_shm.h): a header followed by
+ * slots protected by a sequence number, so the writer never waits for the reader.
+ */
+class Shm
+{
+public:
+	static constexpr uint32_t regionMagic = 0x4d48534du; ///< "MSHM"
+	static constexpr uint32_t regionVersion = 1;
+	static constexpr int maxTopics = 8;
+	static constexpr uint32_t queueLength = 16;
+	static constexpr uint32_t maxDataSize = 1024;
+
+	/// name of the topic used to pass the region to the DSP
+	static constexpr const char *setupTopicName = "muorb_shm";
+
+	struct RegionHeader {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t size;
+		uint32_t num_topics;
+		uint32_t topic_offset[maxTopics]; ///< offset of each uorb_shm_header from the region start
+	};
+
+	/// payload of the setup topic
+	struct Setup {
+		int32_t fd;
+		uint32_t size;
+	};
+
+	/**
+	 * Size of the region needed for a list of topics (apps side).
+	 */
+	static size_t RequiredSize(const char *const topics[], int num_topics);
+
+	/**
+	 * Format a zeroed region for a list of topics (apps side).
+	 * Topics that do not exist locally are skipped.
+	 */
+	bool Init(void *mem, size_t size, const char *const topics[], int num_topics);
+
+	/**
+	 * Use a region formatted by the apps side (DSP side).
+	 * Topics with a different message definition are not used.
+	 */
+	bool Attach(void *mem, size_t size);
+
+	bool Active() const { return _region != nullptr; }
+
+	/**
+	 * Write a topic into its ring (DSP side). Calls for one topic must be serialized.
+	 * @return true if the topic is handled by the shared memory transport
+	 */
+	bool Write(const char *topic, const uint8_t *data, uint32_t length_in_bytes);
+
+	/**
+	 * Forward all new messages from the rings to the handler (apps side).
+	 * @return number of messages forwarded
+	 */
+	int Poll(uORBCommunicator::IChannelRxHandler *handler);
+
+	void PrintStatus() const;
+
+private:
+	struct Topic {
+		const char *name{nullptr}; ///< local uORB metadata string
+		uorb_shm_header *header{nullptr};
+		uint8_t *slots{nullptr};
+		uint64_t next_index{0};    ///< apps: next message to read, DSP: number of messages written
+		uint64_t lost{0};
+	};
+
+	static const struct orb_metadata *FindMeta(const char *name);
+
+	static uint32_t SlotSize(uint32_t data_size) { return (sizeof(uint64_t) + data_size + 7) & ~7u; }
+
+	RegionHeader *_region{nullptr};
+	Topic _topics[maxTopics] {};
+	int _num_topics{0};
+	uint8_t _buffer[maxDataSize] __attribute__((aligned(8))); ///< read buffer (apps)
+};
+
+}
@@ -47,6 +47,10 @@
 #include <px4_platform_common/px4_work_queue/WorkQueueManager.hpp>
 #include <qurt.h>
 
+#ifdef CONFIG_MUORB_SHM
+#include <HAP_mem.h>
+#endif
+
 #include "hrt_work.h"
 
 // Definition of test to run when in muorb test mode
@@ -58,6 +62,9 @@ fc_func_ptrs muorb_func_ptrs;
 uORB::ProtobufChannel uORB::ProtobufChannel::_Instance;
 uORBCommunicator::IChannelRxHandler *uORB::ProtobufChannel::_RxHandler;
 mUORB::Aggregator uORB::ProtobufChannel::_Aggregator;
+#ifdef CONFIG_MUORB_SHM
+mUORB::Shm uORB::ProtobufChannel::_Shm;
+#endif
 std::map<std::string, int> uORB::ProtobufChannel::_AppsSubscriberCache;
 pthread_mutex_t uORB::ProtobufChannel::_rx_mutex = PTHREAD_MUTEX_INITIALIZER;
 pthread_mutex_t uORB::ProtobufChannel::_tx_mutex = PTHREAD_MUTEX_INITIALIZER;
@@ -81,10 +88,10 @@ static void aggregator_thread_func(void *ptr)
 	uORB::ProtobufChannel *muorb = uORB::ProtobufChannel::GetInstance();
 
 	while (true) {
-		// Check for timeout. Send buffer if timeout happened.
+		// Check for timeout. Send buffer if its oldest record is due.
 		muorb->SendAggregateData();
 
-		qurt_timer_sleep(2000);
+		qurt_timer_sleep(mUORB::Aggregator::flushDeadlineUs / 2);
 	}
 
 	qurt_thread_exit(QURT_EOK);
@@ -143,6 +150,28 @@ int16_t uORB::ProtobufChannel::register_handler(uORBCommunicator::IChannelRxHand
 	return 0;
 }
 
+#ifdef CONFIG_MUORB_SHM
+bool uORB::ProtobufChannel::AttachShm(const mUORB::Shm::Setup &setup)
+{
+	void *mem = HAP_mmap(nullptr, setup.size, HAP_PROT_READ | HAP_PROT_WRITE, 0, setup.fd, 0);
+
+	if ((mem == nullptr) || (mem == (void *) -1)) {
+		PX4_ERR("shm: HAP_mmap of fd %d failed", (int) setup.fd);
+		return false;
+	}
+
+	pthread_mutex_lock(&_tx_mutex);
+	bool ret = _Shm.Attach(mem, setup.size);
+	pthread_mutex_unlock(&_tx_mutex);
+
+	if (!ret) {
+		HAP_munmap(mem, setup.size);
+	}
+
+	return ret;
+}
+#endif
+
 int16_t uORB::ProtobufChannel::send_message(const char *messageName, int32_t length, uint8_t *data)
 {
 	// This function can be called from the PX4 log function so we have to make
@@ -174,6 +203,15 @@ int16_t uORB::ProtobufChannel::send_message(const char *messageName, int32_t len
 			pthread_mutex_lock(&_tx_mutex);
 
 			if (is_not_slpi_log) {
+#ifdef CONFIG_MUORB_SHM
+
+				// high rate topics go through shared memory once the apps side set it up
+				if (_Shm.Write(messageName, data, length)) {
+					pthread_mutex_unlock(&_tx_mutex);
+					return 0;
+				}
+
+#endif
 				rc = _Aggregator.ProcessTransmitTopic(messageName, data, length);
 
 			} else {
@@ -463,6 +501,21 @@ int px4muorb_send_topic_data(const char *topic_name, const uint8_t *data,
 
 	uORB::ProtobufChannel *channel = uORB::ProtobufChannel::GetInstance();
 
+#ifdef CONFIG_MUORB_SHM
+
+	if (channel && (strcmp(topic_name, mUORB::Shm::setupTopicName) == 0)) {
+		if (data_len_in_bytes != sizeof(mUORB::Shm::Setup)) {
+			PX4_ERR("shm: invalid setup length %d", data_len_in_bytes);
+			return -1;
+		}
+
+		mUORB::Shm::Setup setup;
+		memcpy(&setup, data, sizeof(setup));
+		return channel->AttachShm(setup) ? 0 : -1;
+	}
+
+#endif
+
 	if (channel) {
 		uORBCommunicator::IChannelRxHandler *rxHandler = channel->GetRxHandler();
 
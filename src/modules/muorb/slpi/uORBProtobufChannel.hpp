@@ -43,6 +43,10 @@
 #include "uORB/uORBCommunicator.hpp"
 #include "mUORBAggregator.hpp"
 
+#ifdef CONFIG_MUORB_SHM
+#include "mUORBShm.hpp"
+#endif
+
 namespace uORB
 {
 class ProtobufChannel;
@@ -154,10 +158,17 @@ public:
 
 	bool DebugEnabled()	{ return _debug; }
 
+#ifdef CONFIG_MUORB_SHM
+	/**
+	 * Map the shared memory region passed by the apps side and use it for its topics.
+	 */
+	bool AttachShm(const mUORB::Shm::Setup &setup);
+#endif
+
 	void SendAggregateData()
 	{
 		pthread_mutex_lock(&_tx_mutex);
-		_Aggregator.SendData();
+		_Aggregator.SendDueData();
 		pthread_mutex_unlock(&_tx_mutex);
 	}
 
@@ -168,6 +179,9 @@ private:
 	static uORB::ProtobufChannel                _Instance;
 	static uORBCommunicator::IChannelRxHandler *_RxHandler;
 	static mUORB::Aggregator					_Aggregator;
+#ifdef CONFIG_MUORB_SHM
+	static mUORB::Shm                           _Shm;
+#endif
 	static std::map<std::string, int>           _AppsSubscriberCache;
 	static pthread_mutex_t                      _tx_mutex;
 	static pthread_mutex_t                      _rx_mutex;
@@ -90,6 +90,10 @@ Geofence::~Geofence()
 	if (_polygons) {
 		delete[](_polygons);
 	}
+
+	delete[] _vertices;
+	delete[] _slab_start;
+	delete[] _slab_edges;
 }
 
 void Geofence::run()
@@ -214,6 +218,24 @@ void Geofence::_updateFence()
 	_num_polygons = 0;
 	int current_seq = 0;
 
+	// the vertices in the local frame and the edge index are rebuilt along with the polygons
+	delete[] _vertices;
+	delete[] _slab_start;
+	delete[] _slab_edges;
+	_num_slab_start = 0;
+	_num_slab_edges = 0;
+
+	// every polygon has at most one slab per vertex and every edge overlaps at most all slabs of its polygon
+	const int num_items = _dataman_cache.size();
+	_vertices = (num_items > 0) ? new matrix::Vector2f[num_items] : nullptr;
+	_slab_start = (num_items > 0) ? new uint16_t[2 * num_items] : nullptr;
+	_slab_edges = (num_items > 0) ? new uint16_t[num_items * MAX_SLABS] : nullptr;
+
+	if ((num_items > 0) && (!_vertices || !_slab_start || !_slab_edges)) {
+		PX4_ERR("alloc failed");
+		return;
+	}
+
 	while (current_seq < _dataman_cache.size()) {
 
 		bool success = _dataman_cache.loadWait(static_cast<dm_item_t>(_stats.dataman_id), current_seq,
@@ -277,6 +299,10 @@ void Geofence::_updateFence()
 					current_seq += mission_fence_point.vertex_count;
 				}
 
+				const int num_slab_start = _num_slab_start;
+				const int num_slab_edges = _num_slab_edges;
+				polygon.indexed = indexPolygon(polygon);
+
 				// check if requiremetns for Home location are met
 				const bool home_check_okay = checkHomeRequirementsForGeofence(polygon);
 
@@ -287,6 +313,10 @@ void Geofence::_updateFence()
 				if (home_check_okay && current_position_check_okay) {
 					++_num_polygons;
 
+				} else {
+					// release the index entries of the discarded polygon
+					_num_slab_start = num_slab_start;
+					_num_slab_edges = num_slab_edges;
 				}
 			}
 
@@ -300,6 +330,128 @@ void Geofence::_updateFence()
 	}
 }
 
+bool Geofence::indexPolygon(PolygonInfo &polygon)
+{
+	const bool is_circle = (polygon.fence_type == NAV_CMD_FENCE_CIRCLE_INCLUSION)
+			       || (polygon.fence_type == NAV_CMD_FENCE_CIRCLE_EXCLUSION);
+	const int vertex_count = is_circle ? 1 : polygon.vertex_count;
+
+	polygon.num_slabs = 0;
+
+	if (!_vertices || (polygon.dataman_index + vertex_count > _dataman_cache.size())) {
+		return false;
+	}
+
+	// load the vertices in chunks and project each chunk at once
+	static constexpr int CHUNK_SIZE = 8;
+	double lat[CHUNK_SIZE];
+	double lon[CHUNK_SIZE];
+
+	for (int chunk_start = 0; chunk_start < vertex_count; chunk_start += CHUNK_SIZE) {
+		const int chunk_count = math::min(vertex_count - chunk_start, CHUNK_SIZE);
+
+		for (int k = 0; k < chunk_count; k++) {
+			mission_fence_point_s vertex{};
+			const bool success = _dataman_cache.loadWait(static_cast<dm_item_t>(_stats.dataman_id),
+					     polygon.dataman_index + chunk_start + k,
+					     reinterpret_cast<uint8_t *>(&vertex), sizeof(mission_fence_point_s));
+
+			if (!success) {
+				PX4_ERR("dm_read failed");
+				return false;
+			}
+
+			if (vertex.frame != NAV_FRAME_GLOBAL && vertex.frame != NAV_FRAME_GLOBAL_INT
+			    && vertex.frame != NAV_FRAME_GLOBAL_RELATIVE_ALT
+			    && vertex.frame != NAV_FRAME_GLOBAL_RELATIVE_ALT_INT) {
+				// TODO: handle different frames
+				PX4_ERR("Frame type %i not supported", (int)vertex.frame);
+				return false;
+			}
+
+			if (!_projection_reference.isInitialized()) {
+				_projection_reference.initReference(vertex.lat, vertex.lon);
+			}
+
+			lat[k] = vertex.lat;
+			lon[k] = vertex.lon;
+		}
+
+		matrix::Vector2f *local = &_vertices[polygon.dataman_index + chunk_start];
+		_projection_reference.project(lat, lon, local, chunk_count);
+
+		for (int k = 0; k < chunk_count; k++) {
+			if (chunk_start + k == 0) {
+				polygon.min_x = polygon.max_x = local[k](0);
+				polygon.min_y = polygon.max_y = local[k](1);
+
+			} else {
+				polygon.min_x = math::min(polygon.min_x, local[k](0));
+				polygon.max_x = math::max(polygon.max_x, local[k](0));
+				polygon.min_y = math::min(polygon.min_y, local[k](1));
+				polygon.max_y = math::max(polygon.max_y, local[k](1));
+			}
+		}
+	}
+
+	if (is_circle) {
+		return true;
+	}
+
+	const uint16_t num_slabs = math::min(polygon.vertex_count, MAX_SLABS);
+	const matrix::Vector2f *vertices = &_vertices[polygon.dataman_index];
+
+	polygon.slab_offset = _num_slab_start;
+	polygon.num_slabs = num_slabs;
+	uint16_t *slab_start = &_slab_start[polygon.slab_offset];
+
+	// count the edges overlapping each slab
+	uint16_t slab_count[MAX_SLABS] {};
+
+	for (unsigned i = 0, j = polygon.vertex_count - 1; i < polygon.vertex_count; j = i++) {
+		const int first = slabIndex(polygon, math::min(vertices[i](1), vertices[j](1)));
+		const int last = slabIndex(polygon, math::max(vertices[i](1), vertices[j](1)));
+
+		for (int slab = first; slab <= last; slab++) {
+			slab_count[slab]++;
+		}
+	}
+
+	slab_start[0] = _num_slab_edges;
+
+	for (int slab = 0; slab < num_slabs; slab++) {
+		slab_start[slab + 1] = slab_start[slab] + slab_count[slab];
+		slab_count[slab] = 0;
+	}
+
+	// fill in the edges
+	for (unsigned i = 0, j = polygon.vertex_count - 1; i < polygon.vertex_count; j = i++) {
+		const int first = slabIndex(polygon, math::min(vertices[i](1), vertices[j](1)));
+		const int last = slabIndex(polygon, math::max(vertices[i](1), vertices[j](1)));
+
+		for (int slab = first; slab <= last; slab++) {
+			_slab_edges[slab_start[slab] + slab_count[slab]++] = i;
+		}
+	}
+
+	_num_slab_start += num_slabs + 1;
+	_num_slab_edges = slab_start[num_slabs];
+
+	return true;
+}
+
+int Geofence::slabIndex(const PolygonInfo &polygon, float y)
+{
+	const float width = polygon.max_y - polygon.min_y;
+
+	if (width < FLT_EPSILON) {
+		return 0;
+	}
+
+	const int slab = static_cast<int>((y - polygon.min_y) * polygon.num_slabs / width);
+	return math::constrain(slab, 0, polygon.num_slabs - 1);
+}
+
 bool Geofence::checkHomeRequirementsForGeofence(const PolygonInfo &polygon)
 {
 	bool checks_pass = true;
@@ -431,38 +583,32 @@ bool Geofence::insidePolygon(const PolygonInfo &polygon, double lat, double lon,
 	 * Only supports non-complex polygons (not self intersecting)
 	 */
 
-	mission_fence_point_s temp_vertex_i{};
-	mission_fence_point_s temp_vertex_j{};
-	bool c = false;
-
-	for (unsigned i = 0, j = polygon.vertex_count - 1; i < polygon.vertex_count; j = i++) {
-
-		dm_item_t fence_dataman_id{static_cast<dm_item_t>(_stats.dataman_id)};
-		bool success = _dataman_cache.loadWait(fence_dataman_id, polygon.dataman_index + i,
-						       reinterpret_cast<uint8_t *>(&temp_vertex_i), sizeof(mission_fence_point_s));
+	if (!polygon.indexed || (polygon.num_slabs == 0)) {
+		return false;
+	}
 
-		if (!success) {
-			break;
-		}
+	float x, y;
+	_projection_reference.project(lat, lon, x, y);
 
-		success = _dataman_cache.loadWait(fence_dataman_id, polygon.dataman_index + j,
-						  reinterpret_cast<uint8_t *>(&temp_vertex_j), sizeof(mission_fence_point_s));
+	// a point outside of the bounding box crosses no or an even number of edges
+	if ((x < polygon.min_x) || (x > polygon.max_x) || (y < polygon.min_y) || (y > polygon.max_y)) {
+		return false;
+	}
 
-		if (!success) {
-			break;
-		}
+	const matrix::Vector2f *vertices = &_vertices[polygon.dataman_index];
+	const uint16_t *slab_start = &_slab_start[polygon.slab_offset];
+	const int slab = slabIndex(polygon, y);
+	bool c = false;
 
-		if (temp_vertex_i.frame != NAV_FRAME_GLOBAL && temp_vertex_i.frame != NAV_FRAME_GLOBAL_INT
-		    && temp_vertex_i.frame != NAV_FRAME_GLOBAL_RELATIVE_ALT
-		    && temp_vertex_i.frame != NAV_FRAME_GLOBAL_RELATIVE_ALT_INT) {
-			// TODO: handle different frames
-			PX4_ERR("Frame type %i not supported", (int)temp_vertex_i.frame);
-			break;
-		}
+	// only the edges of the slab can span the point along y
+	for (unsigned k = slab_start[slab]; k < slab_start[slab + 1]; k++) {
+		const unsigned i = _slab_edges[k];
+		const unsigned j = (i == 0) ? polygon.vertex_count - 1 : i - 1;
+		const matrix::Vector2f &vertex_i = vertices[i];
+		const matrix::Vector2f &vertex_j = vertices[j];
 
-		if (((double)temp_vertex_i.lon >= lon) != ((double)temp_vertex_j.lon >= lon) &&
-		    (lat <= (double)(temp_vertex_j.lat - temp_vertex_i.lat) * (lon - (double)temp_vertex_i.lon) /
-		     (double)(temp_vertex_j.lon - temp_vertex_i.lon) + (double)temp_vertex_i.lat)) {
+		if ((vertex_i(1) >= y) != (vertex_j(1) >= y) &&
+		    (x <= (vertex_j(0) - vertex_i(0)) * (y - vertex_i(1)) / (vertex_j(1) - vertex_i(1)) + vertex_i(0))) {
 			c = !c;
 		}
 	}
@@ -472,33 +618,15 @@ bool Geofence::insidePolygon(const PolygonInfo &polygon, double lat, double lon,
 
 bool Geofence::insideCircle(const PolygonInfo &polygon, double lat, double lon, float altitude)
 {
-
-	mission_fence_point_s circle_point{};
-	bool success = _dataman_cache.loadWait(static_cast<dm_item_t>(_stats.dataman_id), polygon.dataman_index,
-					       reinterpret_cast<uint8_t *>(&circle_point), sizeof(mission_fence_point_s));
-
-	if (!success) {
-		PX4_ERR("dm_read failed");
+	if (!polygon.indexed) {
 		return false;
 	}
 
-	if (circle_point.frame != NAV_FRAME_GLOBAL && circle_point.frame != NAV_FRAME_GLOBAL_INT
-	    && circle_point.frame != NAV_FRAME_GLOBAL_RELATIVE_ALT
-	    && circle_point.frame != NAV_FRAME_GLOBAL_RELATIVE_ALT_INT) {
-		// TODO: handle different frames
-		PX4_ERR("Frame type %i not supported", (int)circle_point.frame);
-		return false;
-	}
-
-	if (!_projection_reference.isInitialized()) {
-		_projection_reference.initReference(lat, lon);
-	}
-
-	float x1, y1, x2, y2;
-	_projection_reference.project(lat, lon, x1, y1);
-	_projection_reference.project(circle_point.lat, circle_point.lon, x2, y2);
-	float dx = x1 - x2, dy = y1 - y2;
-	return dx * dx + dy * dy < circle_point.circle_radius * circle_point.circle_radius;
+	float x, y;
+	_projection_reference.project(lat, lon, x, y);
+	const matrix::Vector2f &center = _vertices[polygon.dataman_index];
+	const float dx = x - center(0), dy = y - center(1);
+	return dx * dx + dy * dy < polygon.circle_radius * polygon.circle_radius;
 }
 
 bool
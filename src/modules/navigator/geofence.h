@@ -164,8 +164,16 @@ private:
 			uint16_t vertex_count;
 			float circle_radius;
 		};
+		bool indexed; ///< vertices (or circle center) are in _vertices, polygons also have their edge index
+
+		// polygon edge index: the bounding box is split into slabs along y, each slab lists the edges overlapping it
+		float min_x, min_y, max_x, max_y; ///< bounding box in the local frame [m]
+		uint16_t slab_offset; ///< first entry of the polygon in _slab_start
+		uint16_t num_slabs;
 	};
 
+	static constexpr uint16_t MAX_SLABS = 16;
+
 	Navigator   *_navigator{nullptr};
 	PolygonInfo *_polygons{nullptr};
 
@@ -182,6 +190,12 @@ private:
 
 	MapProjection _projection_reference{}; ///< class to convert (lon, lat) to local [m]
 
+	matrix::Vector2f *_vertices{nullptr}; ///< local frame position of each fence point, by dataman index
+	uint16_t *_slab_start{nullptr}; ///< per polygon num_slabs + 1 offsets into _slab_edges
+	uint16_t *_slab_edges{nullptr}; ///< edges overlapping each slab, edge i connects vertex i and its predecessor
+	int _num_slab_start{0};
+	int _num_slab_edges{0};
+
 	uint32_t _opaque_id{0}; ///< dataman geofence id: if it does not match, the polygon data was updated
 	bool _fence_updated{true};  ///< flag indicating if fence are updated to dataman cache
 	bool _initiate_fence_updated{true}; ///< flag indicating if fence updated is needed
@@ -193,9 +207,20 @@ private:
 	 */
 	void _updateFence();
 
+	/**
+	 * Read the vertices of a polygon or the center of a circle into the local frame and build the polygon edge index
+	 * @return true if the polygon can be checked
+	 */
+	bool indexPolygon(PolygonInfo &polygon);
+
+	/**
+	 * Slab of a polygon containing the local position y
+	 */
+	static int slabIndex(const PolygonInfo &polygon, float y);
+
 
 	/**
-	 * Check if a single point is within a polygon
+	 * Check if a single point is within a polygon, only visiting the edges of the slab containing the point
 	 * @return true if within polygon
 	 */
 	bool insidePolygon(const PolygonInfo &polygon, double lat, double lon, float altitude);
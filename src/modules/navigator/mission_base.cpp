@@ -43,7 +43,6 @@
 
 #include "px4_platform_common/defines.h"
 
-#include "mission_feasibility_checker.h"
 #include "navigator.h"
 
 MissionBase::MissionBase(Navigator *navigator, int32_t dataman_cache_size_signed) :
@@ -68,6 +67,14 @@ MissionBase::MissionBase(Navigator *navigator, int32_t dataman_cache_size_signed
 	_mission_pub.advertise();
 }
 
+MissionBase::~MissionBase()
+{
+	if (_mission_checker.isRunning()) {
+		// the mission result refers to a check that will not complete, have it rechecked
+		_navigator->get_mission_result()->home_position_counter = 0;
+	}
+}
+
 void
 MissionBase::updateDatamanCache()
 {
@@ -163,7 +170,7 @@ MissionBase::on_inactive()
 	updateMavlinkMission();
 
 	/* Check the mission */
-	if (!_mission_checked && canRunMissionFeasibility()) {
+	if ((!_mission_checked || _mission_checker.isRunning()) && canRunMissionFeasibility()) {
 		_mission_checked = true;
 		check_mission_valid();
 		_is_current_planned_mission_item_valid = isMissionValid();
@@ -256,12 +263,15 @@ MissionBase::on_active()
 	updateMissionAltAfterHomeChanged();
 
 	/* Check the mission */
-	if (!_mission_checked && canRunMissionFeasibility()) {
+	if ((!_mission_checked || _mission_checker.isRunning()) && canRunMissionFeasibility()) {
 		_mission_checked = true;
 		check_mission_valid();
-		_is_current_planned_mission_item_valid = isMissionValid();
-		update_mission();
-		set_mission_items();
+
+		if (!_mission_checker.isRunning()) {
+			_is_current_planned_mission_item_valid = isMissionValid();
+			update_mission();
+			set_mission_items();
+		}
 	}
 
 	// check if heading alignment is necessary, and add it to the current mission item if necessary
@@ -699,29 +709,39 @@ MissionBase::checkMissionRestart()
 void
 MissionBase::check_mission_valid(bool forced)
 {
+	mission_result_s *mission_result = _navigator->get_mission_result();
+
+	const bool mission_changed = (mission_result->mission_id != _mission.mission_id);
+	const bool home_changed = (mission_result->home_position_counter != _navigator->get_home_position()->update_count);
+
 	// Allow forcing it, since we currently not rechecking if parameters have changed.
-	if (forced ||
-	    (_navigator->get_mission_result()->mission_id != _mission.mission_id) ||
-	    (_navigator->get_mission_result()->geofence_id != _mission.geofence_id) ||
-	    (_navigator->get_mission_result()->home_position_counter != _navigator->get_home_position()->update_count)) {
+	if (forced || mission_changed || home_changed || (mission_result->geofence_id != _mission.geofence_id)) {
 
-		_navigator->get_mission_result()->mission_id = _mission.mission_id;
-		_navigator->get_mission_result()->geofence_id = _mission.geofence_id;
-		_navigator->get_mission_result()->home_position_counter = _navigator->get_home_position()->update_count;
+		mission_result->mission_id = _mission.mission_id;
+		mission_result->geofence_id = _mission.geofence_id;
+		mission_result->home_position_counter = _navigator->get_home_position()->update_count;
 
-		MissionFeasibilityChecker missionFeasibilityChecker(_navigator, _dataman_client);
-		_navigator->get_mission_result()->valid = missionFeasibilityChecker.checkMissionFeasible(_mission);
-		_navigator->get_mission_result()->seq_total = _mission.count;
-		_navigator->get_mission_result()->seq_reached = -1;
-		_navigator->get_mission_result()->failure = false;
+		// a geofence update only requires the items to be checked against the new geofence
+		_mission_checker.start(_mission, !forced && !mission_changed && !home_changed);
 
-		set_mission_result();
+	} else if (!_mission_checker.isRunning()) {
+		return;
+	}
 
-		// only warn if the check failed on merit
-		if ((!_navigator->get_mission_result()->valid) && _mission.count > 0U) {
-			PX4_WARN("mission check failed");
-		}
+	// the check is spread over multiple navigator iterations, unless the result is needed right away
+	const bool completed = _mission_checker.run(forced ? 0 : MISSION_CHECK_TIME_SLICE);
+
+	mission_result->valid = completed && _mission_checker.isFeasible();
+	mission_result->check_progress = _mission_checker.progress();
+	mission_result->seq_total = _mission.count;
+	mission_result->seq_reached = -1;
+	mission_result->failure = false;
+
+	set_mission_result();
 
+	// only warn if the check failed on merit
+	if (completed && (!mission_result->valid) && _mission.count > 0U) {
+		PX4_WARN("mission check failed");
 	}
 }
 
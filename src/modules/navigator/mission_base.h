@@ -56,6 +56,7 @@
 #include <uORB/Publication.hpp>
 
 #include "mission_block.h"
+#include "mission_feasibility_checker.h"
 #include "navigation.h"
 
 using namespace time_literals;
@@ -66,7 +67,7 @@ class MissionBase : public MissionBlock, public ModuleParams
 {
 public:
 	MissionBase(Navigator *navigator, int32_t dataman_cache_size_signed);
-	~MissionBase() override = default;
+	~MissionBase() override;
 
 	virtual void on_inactive() override;
 	virtual void on_inactivation() override;
@@ -217,7 +218,10 @@ protected:
 
 	/**
 	 * @brief Check whether a mission is ready to go
-	 * @param[in] forced flag if the check has to be run irregardles of any updates.
+	 *
+	 * The check runs incrementally, a started check is continued on every call until it has completed.
+	 * The mission result is not valid while the check is running.
+	 * @param[in] forced flag if the check has to be run irregardles of any updates, it is then completed right away.
 	 */
 	void check_mission_valid(bool forced = false);
 
@@ -335,6 +339,9 @@ protected:
 	DatamanCache _dataman_cache{"mission_dm_cache_miss", 10}; /**< Dataman cache of mission items*/
 	DatamanClient	&_dataman_client = _dataman_cache.client(); /**< Dataman client*/
 
+	static constexpr hrt_abstime MISSION_CHECK_TIME_SLICE = 5_ms; /**< Maximum duration of the mission check per navigator iteration*/
+	MissionFeasibilityChecker _mission_checker{_navigator, _dataman_client}; /**< Incremental mission feasibility check*/
+
 	uORB::Subscription _mission_sub{ORB_ID(mission)};	/**< mission subscription*/
 	uORB::SubscriptionData<vehicle_land_detected_s> _land_detected_sub{ORB_ID(vehicle_land_detected)};	/**< vehicle land detected subscription */
 	uORB::SubscriptionData<vehicle_status_s> _vehicle_status_sub{ORB_ID(vehicle_status)};	/**< vehicle status subscription */
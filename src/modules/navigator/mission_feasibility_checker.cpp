@@ -55,101 +55,221 @@
 
 bool
 MissionFeasibilityChecker::checkMissionFeasible(const mission_s &mission)
+{
+	start(mission);
+	run(0);
+
+	return _feasible;
+}
+
+void
+MissionFeasibilityChecker::start(const mission_s &mission, bool items_unchanged)
 {
 	// Reset warning flag
 	_navigator->get_mission_result()->warning = false;
 
+	const bool reuse_items = items_unchanged && _items_checked &&
+				 (mission.mission_id == _mission.mission_id) &&
+				 (mission.mission_dataman_id == _mission.mission_dataman_id) &&
+				 (mission.count == _mission.count);
+
+	_mission = mission;
+	_feasible = false;
+	_geofence_failed = false;
+	_read_batch_count = 0;
+	_work_done = 0;
+
 	// first check if we have a valid position
-	const bool home_valid = _navigator->home_global_position_valid();
+	_home_valid = _navigator->home_global_position_valid();
+	_home_alt = _navigator->get_home_position()->alt;
 	const bool home_alt_valid = _navigator->home_alt_valid();
 
 	// trivial case: A mission with length zero cannot be valid
 	if ((int)mission.count <= 0) {
-		return false;
+		_items_checked = false;
+		_stage = Stage::Done;
+		return;
 	}
 
 	if (!home_alt_valid) {
 		mavlink_log_info(_navigator->get_mavlink_log_pub(), "Not yet ready for mission, no position lock.\t");
 		events::send(events::ID("navigator_mis_no_pos_lock"), events::Log::Info, "Not yet ready for mission, no position lock");
-		return false;
+		_items_checked = false;
+		_stage = Stage::Done;
+		return;
 	}
 
-	bool failed = false;
+	if (reuse_items) {
+		_work_total = mission.count;
+		startGeofenceCheck();
 
-	for (size_t i = 0; i < mission.count; i++) {
-		struct mission_item_s missionitem = {};
+	} else {
+		_items_checked = false;
+		_items_failed = false;
+		_work_total = 2 * mission.count;
+		_index = 0;
+		_stage = Stage::Items;
+	}
+}
 
-		bool success = _dataman_client.readSync((dm_item_t)mission.mission_dataman_id, i,
-							reinterpret_cast<uint8_t *>(&missionitem),
-							sizeof(mission_item_s));
+bool
+MissionFeasibilityChecker::run(hrt_abstime max_duration)
+{
+	const hrt_abstime start_time = hrt_absolute_time();
 
-		if (!success) {
-			_navigator->get_mission_result()->warning = true;
-			/* not supposed to happen unless the datamanager can't access the SD card, etc. */
+	while (isRunning()) {
+		if ((max_duration > 0) && (hrt_elapsed_time(&start_time) > max_duration)) {
 			return false;
 		}
 
-		if (!_feasibility_checker.processNextItem(missionitem, i, mission.count)) {
-			failed = true;
-			break;
+		if (_stage == Stage::Items) {
+			checkNextItem();
+
+		} else {
+			checkNextItemAgainstGeofence();
 		}
+	}
+
+	return true;
+}
 
+uint8_t
+MissionFeasibilityChecker::progress() const
+{
+	if (!isRunning() || (_work_total == 0)) {
+		return 100;
 	}
 
-	failed |= _feasibility_checker.someCheckFailed();
+	return static_cast<uint8_t>(math::min((100 * _work_done) / _work_total, (uint32_t)99));
+}
 
-	failed |= !checkMissionAgainstGeofence(mission, _navigator->get_home_position()->alt, home_valid);
+void
+MissionFeasibilityChecker::checkNextItem()
+{
+	struct mission_item_s missionitem = {};
 
-	_navigator->get_mission_result()->warning = failed;
+	bool success = readMissionItem(_mission, _index, missionitem);
+
+	if (!success) {
+		/* not supposed to happen unless the datamanager can't access the SD card, etc. */
+		_stage = Stage::Done;
+		_feasible = false;
+		_navigator->get_mission_result()->warning = true;
+		return;
+	}
+
+	_work_done++;
+
+	if (!_feasibility_checker.processNextItem(missionitem, _index, _mission.count)) {
+		_items_failed = true;
 
-	return !failed;
+	} else if (++_index < _mission.count) {
+		return;
+	}
+
+	_items_failed |= _feasibility_checker.someCheckFailed();
+	_items_checked = true;
+
+	_work_done = _mission.count;
+	startGeofenceCheck();
 }
 
-bool
-MissionFeasibilityChecker::checkMissionAgainstGeofence(const mission_s &mission, float home_alt, bool home_valid)
+void
+MissionFeasibilityChecker::startGeofenceCheck()
 {
-	if (_navigator->get_geofence().isHomeRequired() && !home_valid) {
+	_index = 0;
+	_read_batch_count = 0;
+
+	if (_navigator->get_geofence().isHomeRequired() && !_home_valid) {
 		mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence requires valid home position\t");
 		events::send(events::ID("navigator_mis_geofence_no_home"), {events::Log::Error, events::LogInternal::Info},
 			     "Geofence requires a valid home position");
-		return false;
+		_geofence_failed = true;
+		finish();
+		return;
 	}
 
 	/* Check if all mission items are inside the geofence (if we have a valid geofence) */
 	if (_navigator->get_geofence().valid()) {
-		for (size_t i = 0; i < mission.count; i++) {
-			struct mission_item_s missionitem = {};
-
-			bool success = _dataman_client.readSync((dm_item_t)mission.mission_dataman_id, i,
-								reinterpret_cast<uint8_t *>(&missionitem),
-								sizeof(mission_item_s));
-
-			if (!success) {
-				/* not supposed to happen unless the datamanager can't access the SD card, etc. */
-				return false;
-			}
-
-			if (missionitem.altitude_is_relative && !home_valid) {
-				mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence requires valid home position\t");
-				events::send(events::ID("navigator_mis_geofence_no_home2"), {events::Log::Error, events::LogInternal::Info},
-					     "Geofence requires a valid home position");
-				return false;
-			}
-
-			// Geofence function checks against home altitude amsl
-			missionitem.altitude = missionitem.altitude_is_relative ? missionitem.altitude + home_alt : missionitem.altitude;
-
-			if (MissionBlock::item_contains_position(missionitem) && !_navigator->get_geofence().checkPointAgainstAllGeofences(
-				    missionitem.lat, missionitem.lon, missionitem.altitude)) {
-
-				mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence violation for waypoint %zu\t", i + 1);
-				events::send<int16_t>(events::ID("navigator_mis_geofence_violation"), {events::Log::Error, events::LogInternal::Info},
-						      "Geofence violation for waypoint {1}",
-						      i + 1);
-				return false;
-			}
+		_stage = Stage::Geofence;
+
+	} else {
+		finish();
+	}
+}
+
+void
+MissionFeasibilityChecker::checkNextItemAgainstGeofence()
+{
+	struct mission_item_s missionitem = {};
+
+	bool success = readMissionItem(_mission, _index, missionitem);
+
+	if (!success) {
+		/* not supposed to happen unless the datamanager can't access the SD card, etc. */
+		_geofence_failed = true;
+		finish();
+		return;
+	}
+
+	_work_done++;
+
+	if (missionitem.altitude_is_relative && !_home_valid) {
+		mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence requires valid home position\t");
+		events::send(events::ID("navigator_mis_geofence_no_home2"), {events::Log::Error, events::LogInternal::Info},
+			     "Geofence requires a valid home position");
+		_geofence_failed = true;
+		finish();
+		return;
+	}
+
+	// Geofence function checks against home altitude amsl
+	missionitem.altitude = missionitem.altitude_is_relative ? missionitem.altitude + _home_alt : missionitem.altitude;
+
+	if (MissionBlock::item_contains_position(missionitem) && !_navigator->get_geofence().checkPointAgainstAllGeofences(
+		    missionitem.lat, missionitem.lon, missionitem.altitude)) {
+
+		mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence violation for waypoint %u\t",
+				     (unsigned)(_index + 1));
+		events::send<int16_t>(events::ID("navigator_mis_geofence_violation"), {events::Log::Error, events::LogInternal::Info},
+				      "Geofence violation for waypoint {1}",
+				      _index + 1);
+		_geofence_failed = true;
+		finish();
+		return;
+	}
+
+	if (++_index >= _mission.count) {
+		finish();
+	}
+}
+
+void
+MissionFeasibilityChecker::finish()
+{
+	const bool failed = _items_failed || _geofence_failed;
+
+	_navigator->get_mission_result()->warning = failed;
+	_feasible = !failed;
+	_stage = Stage::Done;
+}
+
+bool
+MissionFeasibilityChecker::readMissionItem(const mission_s &mission, uint32_t index, mission_item_s &mission_item)
+{
+	if ((index < _read_batch_start) || (index >= _read_batch_start + _read_batch_count)) {
+		const uint32_t count = math::min(READ_BATCH_SIZE, mission.count - index);
+		_read_batch_count = 0;
+
+		if (!_dataman_client.readBatchSync((dm_item_t)mission.mission_dataman_id, index, count,
+						   reinterpret_cast<uint8_t *>(_read_batch), sizeof(mission_item_s))) {
+			return false;
 		}
+
+		_read_batch_start = index;
+		_read_batch_count = count;
 	}
 
+	mission_item = _read_batch[index - _read_batch_start];
 	return true;
 }
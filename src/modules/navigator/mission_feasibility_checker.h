@@ -43,6 +43,7 @@
 #pragma once
 
 #include <dataman_client/DatamanClient.hpp>
+#include <drivers/drv_hrt.h>
 #include <uORB/topics/mission.h>
 #include <px4_platform_common/module_params.h>
 #include "MissionFeasibility/FeasibilityChecker.hpp"
@@ -52,11 +53,43 @@ class Navigator;
 class MissionFeasibilityChecker: public ModuleParams
 {
 private:
+	enum class Stage {
+		Idle,
+		Items,
+		Geofence,
+		Done
+	};
+
 	Navigator *_navigator{nullptr};
 	DatamanClient &_dataman_client;
 	FeasibilityChecker _feasibility_checker;
 
-	bool checkMissionAgainstGeofence(const mission_s &mission, float home_alt, bool home_valid);
+	static constexpr uint32_t READ_BATCH_SIZE = 8; ///< Number of mission items read from dataman at once
+
+	mission_item_s _read_batch[READ_BATCH_SIZE] {};
+	uint32_t _read_batch_start{0};
+	uint32_t _read_batch_count{0};
+
+	mission_s _mission{};		///< Mission being checked
+	Stage _stage{Stage::Idle};
+	uint32_t _index{0};		///< Next item to check in the current stage
+	uint32_t _work_done{0};		///< Number of item checks done, over all stages
+	uint32_t _work_total{0};
+	bool _home_valid{false};
+	float _home_alt{NAN};
+
+	bool _items_checked{false};	///< The item checks have completed for _mission, their result can be reused
+	bool _items_failed{false};
+	bool _geofence_failed{false};
+	bool _feasible{false};
+
+	void checkNextItem();
+	void startGeofenceCheck();
+	void checkNextItemAgainstGeofence();
+	void finish();
+
+	/* Read a mission item, the following items are read ahead in the same dataman request */
+	bool readMissionItem(const mission_s &mission, uint32_t index, mission_item_s &mission_item);
 
 public:
 	MissionFeasibilityChecker(Navigator *navigator, DatamanClient &dataman_client) :
@@ -76,4 +109,30 @@ public:
 	 * Returns true if mission is feasible and false otherwise
 	 */
 	bool checkMissionFeasible(const mission_s &mission);
+
+	/**
+	 * Start checking a mission, the checks are then run incrementally with run().
+	 * A running check is restarted.
+	 *
+	 * @param mission mission to check
+	 * @param items_unchanged the mission items and home position did not change since the last completed check,
+	 *        only the geofence is checked again and the result of the item checks is reused
+	 */
+	void start(const mission_s &mission, bool items_unchanged = false);
+
+	/**
+	 * Continue the started check
+	 *
+	 * @param max_duration time after which the check is paused [us], 0 to run it to completion
+	 * @return true if the check has completed, the result is then available with isFeasible()
+	 */
+	bool run(hrt_abstime max_duration);
+
+	bool isRunning() const { return (_stage == Stage::Items) || (_stage == Stage::Geofence); }
+
+	/* Result of the last completed check */
+	bool isFeasible() const { return _feasible; }
+
+	/* Progress of the running check [%] */
+	uint8_t progress() const;
 };
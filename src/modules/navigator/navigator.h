@@ -64,6 +64,7 @@
 #include <uORB/Publication.hpp>
 #include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionInterval.hpp>
+#include <uORB/SubscriptionUpdateSet.hpp>
 #include <uORB/topics/geofence_result.h>
 #include <uORB/topics/gimbal_manager_set_attitude.h>
 #include <uORB/topics/home_position.h>
@@ -294,10 +295,12 @@ private:
 
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 
-	uORB::Subscription _global_pos_sub{ORB_ID(vehicle_global_position)};	/**< global position subscription */
-	uORB::Subscription _gps_pos_sub{ORB_ID(vehicle_gps_position)};		/**< gps position subscription */
-	uORB::Subscription _home_pos_sub{ORB_ID(home_position)};		/**< home position subscription */
-	uORB::Subscription _land_detected_sub{ORB_ID(vehicle_land_detected)};	/**< vehicle land detected subscription */
+	// topics checked every cycle, marked on publication in _subscription_updates
+	uORB::SubscriptionUpdateSet _subscription_updates;
+	uORB::SubscriptionFlagged _global_pos_sub{_subscription_updates, 0, ORB_ID(vehicle_global_position)};	/**< global position subscription */
+	uORB::SubscriptionFlagged _gps_pos_sub{_subscription_updates, 1, ORB_ID(vehicle_gps_position)};		/**< gps position subscription */
+	uORB::SubscriptionFlagged _home_pos_sub{_subscription_updates, 2, ORB_ID(home_position)};		/**< home position subscription */
+	uORB::SubscriptionFlagged _land_detected_sub{_subscription_updates, 3, ORB_ID(vehicle_land_detected)};	/**< vehicle land detected subscription */
 	uORB::Subscription _pos_ctrl_landing_status_sub{ORB_ID(position_controller_landing_status)};	/**< position controller landing status subscription */
 	uORB::Subscription _traffic_sub{ORB_ID(transponder_report)};		/**< traffic subscription */
 	uORB::Subscription _vehicle_command_sub{ORB_ID(vehicle_command)};	/**< vehicle commands (onboard and offboard) */
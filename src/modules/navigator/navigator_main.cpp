@@ -177,6 +177,11 @@ void Navigator::run()
 	/* rate-limit position subscription to 20 Hz / 50 ms */
 	orb_set_interval(_local_pos_sub, 50);
 
+	_global_pos_sub.registerCallback();
+	_gps_pos_sub.registerCallback();
+	_home_pos_sub.registerCallback();
+	_land_detected_sub.registerCallback();
+
 	while (!should_exit()) {
 
 		/* wait for up to 1000ms for data */
@@ -212,15 +217,11 @@ void Navigator::run()
 			}
 		}
 
-		/* gps updated */
-		if (_gps_pos_sub.updated()) {
-			_gps_pos_sub.copy(&_gps_pos);
-		}
+		// topics published since the last cycle
+		const uint32_t updates = _subscription_updates.fetch();
 
-		/* global position updated */
-		if (_global_pos_sub.updated()) {
-			_global_pos_sub.copy(&_global_pos);
-		}
+		_gps_pos_sub.update(updates, &_gps_pos);
+		_global_pos_sub.update(updates, &_global_pos);
 
 		/* check for parameter updates */
 		if (_parameter_update_sub.updated()) {
@@ -232,9 +233,9 @@ void Navigator::run()
 			params_update();
 		}
 
-		_land_detected_sub.update(&_land_detected);
+		_land_detected_sub.update(updates, &_land_detected);
 		_position_controller_status_sub.update();
-		_home_pos_sub.update(&_home_pos);
+		_home_pos_sub.update(updates, &_home_pos);
 
 		// Handle Vehicle commands
 		int vehicle_command_updates = 0;
@@ -1254,26 +1255,24 @@ void Navigator::run_fake_traffic()
 
 void Navigator::check_traffic()
 {
+	const uint16_t required_flags = transponder_report_s::PX4_ADSB_FLAGS_VALID_COORDS |
+					transponder_report_s::PX4_ADSB_FLAGS_VALID_HEADING |
+					transponder_report_s::PX4_ADSB_FLAGS_VALID_VELOCITY | transponder_report_s::PX4_ADSB_FLAGS_VALID_ALTITUDE;
 
-	if (_traffic_sub.updated()) {
-
-		_traffic_sub.copy(&_adsb_conflict._transponder_report);
-
-		uint16_t required_flags = transponder_report_s::PX4_ADSB_FLAGS_VALID_COORDS |
-					  transponder_report_s::PX4_ADSB_FLAGS_VALID_HEADING |
-					  transponder_report_s::PX4_ADSB_FLAGS_VALID_VELOCITY | transponder_report_s::PX4_ADSB_FLAGS_VALID_ALTITUDE;
+	// collect all queued reports, multiple reports of the same target are merged in the traffic table
+	transponder_report_s transponder_report;
 
-		if ((_adsb_conflict._transponder_report.flags & required_flags) == required_flags) {
-
-			_adsb_conflict.detect_traffic_conflict(get_global_position()->lat, get_global_position()->lon,
-							       get_global_position()->alt, _local_pos.vx, _local_pos.vy, _local_pos.vz);
-
-			if (_adsb_conflict.handle_traffic_conflict()) {
-				take_traffic_conflict_action();
-			}
+	while (_traffic_sub.update(&transponder_report)) {
+		if ((transponder_report.flags & required_flags) == required_flags) {
+			_adsb_conflict.add_traffic(transponder_report);
 		}
 	}
 
+	if (_adsb_conflict.handle_traffic_conflicts(get_global_position()->lat, get_global_position()->lon,
+			get_global_position()->alt, _local_pos.vx, _local_pos.vy, _local_pos.vz)) {
+		take_traffic_conflict_action();
+	}
+
 	_adsb_conflict.remove_expired_conflicts();
 
 }
@@ -248,9 +248,10 @@ rtl_time_estimate_s RtlDirectMissionLand::calc_rtl_time_estimate()
 			is_in_climbing_submode = checkNeedsToClimb();
 		}
 
-		if (start_item_index >= 0 && start_item_index < static_cast<int32_t>(_mission.count)) {
+		if (start_item_index >= 0 && start_item_index < static_cast<int32_t>(_mission.count) && updateReturnPath()) {
+			updateReturnPathTimes();
+
 			float altitude_at_calculation_point;
-			matrix::Vector2d hor_position_at_calculation_point{_global_pos_sub.get().lat, _global_pos_sub.get().lon};
 
 			if (is_in_climbing_submode) {
 				if (_enforce_rtl_alt) {
@@ -269,121 +270,244 @@ rtl_time_estimate_s RtlDirectMissionLand::calc_rtl_time_estimate()
 				altitude_at_calculation_point = _global_pos_sub.get().alt;
 			}
 
-			while (start_item_index < _mission.count && start_item_index >= 0) {
-				int32_t next_mission_item_index;
-				size_t num_found_items{0U};
-				getNextPositionItems(start_item_index, &next_mission_item_index, num_found_items, 1U);
+			// find the first position item at or after the start index
+			int32_t first{0};
+			int32_t last{_return_path_size};
+
+			while (first < last) {
+				const int32_t middle = first + (last - first) / 2;
+
+				if (_return_path[middle].index < start_item_index) {
+					first = middle + 1;
+
+				} else {
+					last = middle;
+				}
+			}
+
+			if (first < _return_path_size) {
+				// the leg from the current position is computed live, the remaining legs come from the table
+				const ReturnPathItem &item = _return_path[first];
+
+				matrix::Vector2f direction{};
+				get_vector_to_next_waypoint(_global_pos_sub.get().lat, _global_pos_sub.get().lon, item.lat, item.lon,
+							    &direction(0), &direction(1));
 
-				if (num_found_items > 0U) {
-					mission_item_s next_position_mission_item;
-					const dm_item_t dataman_id = static_cast<dm_item_t>(_mission.mission_dataman_id);
-					bool success = _dataman_cache.loadWait(dataman_id, next_mission_item_index,
-									       reinterpret_cast<uint8_t *>(&next_position_mission_item), sizeof(next_position_mission_item), MAX_DATAMAN_LOAD_WAIT);
+				const float hor_dist = get_distance_to_next_waypoint(_global_pos_sub.get().lat, _global_pos_sub.get().lon,
+						       item.lat, item.lon);
 
-					if (!success) {
-						// Could not load the mission item, mark time estimate as invalid.
+				addLegToEstimate(item, hor_dist, direction, item.altitude - altitude_at_calculation_point);
+
+				if (first + 1 < _return_path_size) {
+					const ReturnPathItem &next_item = _return_path[first + 1];
+
+					if (next_item.resets) {
 						_rtl_time_estimator.reset();
-						break;
-					}
 
-					switch (next_position_mission_item.nav_cmd) {
-					case NAV_CMD_LOITER_UNLIMITED: {
-							_rtl_time_estimator.reset();
-							break;
+						if (next_item.valid) {
+							_rtl_time_estimator.addEstimate(next_item.time_to_end);
 						}
 
-					case NAV_CMD_LOITER_TIME_LIMIT: {
-							// Go to loiter
-							matrix::Vector2f direction{};
-							get_vector_to_next_waypoint(hor_position_at_calculation_point(0), hor_position_at_calculation_point(1),
-										    next_position_mission_item.lat, next_position_mission_item.lon, &direction(0), &direction(1));
+					} else {
+						_rtl_time_estimator.addEstimate(next_item.time_to_end);
+					}
+				}
+			}
 
-							float hor_dist = get_distance_to_next_waypoint(hor_position_at_calculation_point(0),
-									 hor_position_at_calculation_point(1), next_position_mission_item.lat, next_position_mission_item.lon);
+		} else {
+			// Could not load the mission items, mark time estimate as invalid.
+			_rtl_time_estimator.reset();
+		}
+	}
 
-							_rtl_time_estimator.addDistance(hor_dist, direction, 0.f);
+	return _rtl_time_estimator.getEstimate();
+}
 
-							// add time
-							_rtl_time_estimator.addWait(next_position_mission_item.time_inside);
-							break;
-						}
+bool RtlDirectMissionLand::updateReturnPath()
+{
+	const float home_alt = _navigator->get_home_position()->alt;
+
+	if (_return_path_valid
+	    && (_return_path_mission_id == _mission.mission_id)
+	    && (_return_path_land_start_index == _mission.land_start_index)
+	    && (_return_path_count == _mission.count)
+	    && (_return_path_dataman_id == _mission.mission_dataman_id)
+	    && (fabsf(_return_path_home_alt - home_alt) < FLT_EPSILON)) {
+		return true;
+	}
 
-					case NAV_CMD_LOITER_TO_ALT: {
-							// Go to point horizontally
-							matrix::Vector2f direction{};
-							get_vector_to_next_waypoint(hor_position_at_calculation_point(0), hor_position_at_calculation_point(1),
-										    next_position_mission_item.lat, next_position_mission_item.lon, &direction(0), &direction(1));
+	_return_path_valid = false;
+	_return_path_times_valid = false;
+	_return_path_size = 0;
 
-							float hor_dist = get_distance_to_next_waypoint(hor_position_at_calculation_point(0),
-									 hor_position_at_calculation_point(1), next_position_mission_item.lat, next_position_mission_item.lon);
+	const int32_t max_size = static_cast<int32_t>(_mission.count) - _mission.land_start_index;
 
-							_rtl_time_estimator.addDistance(hor_dist, direction, 0.f);
+	if (max_size <= 0) {
+		return false;
+	}
 
-							// Add the vertical loiter
-							_rtl_time_estimator.addVertDistance(get_absolute_altitude_for_item(next_position_mission_item) -
-											    altitude_at_calculation_point);
+	if (max_size > _return_path_capacity) {
+		delete[] _return_path;
+		_return_path = new ReturnPathItem[max_size];
 
-							break;
-						}
+		if (_return_path == nullptr) {
+			PX4_ERR("return path alloc failed");
+			_return_path_capacity = 0;
+			return false;
+		}
 
-					case NAV_CMD_LAND: // Fallthrough
-					case NAV_CMD_VTOL_LAND: {
+		_return_path_capacity = max_size;
+	}
 
-							matrix::Vector2f direction{};
-							get_vector_to_next_waypoint(hor_position_at_calculation_point(0), hor_position_at_calculation_point(1),
-										    next_position_mission_item.lat, next_position_mission_item.lon, &direction(0), &direction(1));
+	int32_t start_item_index = _mission.land_start_index;
 
-							float hor_dist = get_distance_to_next_waypoint(hor_position_at_calculation_point(0),
-									 hor_position_at_calculation_point(1), next_position_mission_item.lat, next_position_mission_item.lon);
+	while (start_item_index < _mission.count && start_item_index >= 0 && _return_path_size < _return_path_capacity) {
+		int32_t next_mission_item_index;
+		size_t num_found_items{0U};
+		getNextPositionItems(start_item_index, &next_mission_item_index, num_found_items, 1U);
 
-							// For fixed wing, add diagonal line
-							if ((_vehicle_status_sub.get().vehicle_type != vehicle_status_s::VEHICLE_TYPE_FIXED_WING)
-							    && (!_vehicle_status_sub.get().is_vtol)) {
+		if (num_found_items == 0U) {
+			break;
+		}
 
+		mission_item_s next_position_mission_item;
+		const dm_item_t dataman_id = static_cast<dm_item_t>(_mission.mission_dataman_id);
+		bool success = _dataman_cache.loadWait(dataman_id, next_mission_item_index,
+						       reinterpret_cast<uint8_t *>(&next_position_mission_item), sizeof(next_position_mission_item), MAX_DATAMAN_LOAD_WAIT);
 
-								_rtl_time_estimator.addDistance(hor_dist, direction,
-												get_absolute_altitude_for_item(next_position_mission_item) - altitude_at_calculation_point);
+		if (!success) {
+			_return_path_size = 0;
+			return false;
+		}
 
-							} else {
-								// For VTOL, Rotary, go there horizontally first, then land
-								_rtl_time_estimator.addDistance(hor_dist, direction, 0.f);
+		ReturnPathItem &item = _return_path[_return_path_size];
+		item.index = next_mission_item_index;
+		item.nav_cmd = next_position_mission_item.nav_cmd;
+		item.time_inside = next_position_mission_item.time_inside;
+		item.lat = next_position_mission_item.lat;
+		item.lon = next_position_mission_item.lon;
+		item.altitude = get_absolute_altitude_for_item(next_position_mission_item, home_alt);
+		item.direction.zero();
+		item.hor_dist = 0.f;
+
+		if (_return_path_size > 0) {
+			const ReturnPathItem &previous_item = _return_path[_return_path_size - 1];
+			get_vector_to_next_waypoint(previous_item.lat, previous_item.lon, item.lat, item.lon,
+						    &item.direction(0), &item.direction(1));
+			item.hor_dist = get_distance_to_next_waypoint(previous_item.lat, previous_item.lon, item.lat, item.lon);
+		}
 
-								_rtl_time_estimator.addDescendMCLand(get_absolute_altitude_for_item(next_position_mission_item) -
-												     altitude_at_calculation_point);
-							}
+		_return_path_size++;
+		start_item_index = next_mission_item_index + 1;
+	}
 
-							break;
-						}
+	_return_path_mission_id = _mission.mission_id;
+	_return_path_land_start_index = _mission.land_start_index;
+	_return_path_count = _mission.count;
+	_return_path_dataman_id = _mission.mission_dataman_id;
+	_return_path_home_alt = home_alt;
+	_return_path_valid = true;
 
-					default: {
-							// Default assume can go to the location directly
-							matrix::Vector2f direction{};
-							get_vector_to_next_waypoint(hor_position_at_calculation_point(0), hor_position_at_calculation_point(1),
-										    next_position_mission_item.lat, next_position_mission_item.lon, &direction(0), &direction(1));
+	return true;
+}
 
-							float hor_dist = get_distance_to_next_waypoint(hor_position_at_calculation_point(0),
-									 hor_position_at_calculation_point(1), next_position_mission_item.lat, next_position_mission_item.lon);
+void RtlDirectMissionLand::updateReturnPathTimes()
+{
+	const bool land_separate = (_vehicle_status_sub.get().vehicle_type == vehicle_status_s::VEHICLE_TYPE_FIXED_WING)
+				   || _vehicle_status_sub.get().is_vtol;
 
-							_rtl_time_estimator.addDistance(hor_dist, direction,
-											get_absolute_altitude_for_item(next_position_mission_item) - altitude_at_calculation_point);
-							break;
-						}
-					}
+	if (_return_path_times_valid
+	    && (_return_path_times_generation == _rtl_time_estimator.inputsGeneration())
+	    && (_return_path_times_land_separate == land_separate)) {
+		return;
+	}
 
-					start_item_index = next_mission_item_index + 1;
-					hor_position_at_calculation_point(0) = next_position_mission_item.lat;
-					hor_position_at_calculation_point(1) = next_position_mission_item.lon;
-					altitude_at_calculation_point = get_absolute_altitude_for_item(next_position_mission_item);
+	// Accumulate the legs backwards from the end of the mission. An unlimited loiter restarts the
+	// estimate, so only the legs after the last one count.
+	float time_to_end{0.f};
+	bool resets{false};
+	bool valid{false};
 
+	for (int32_t i = _return_path_size - 1; i > 0; i--) {
+		ReturnPathItem &item = _return_path[i];
 
-				} else {
-					start_item_index = -1;
-				}
+		if (item.nav_cmd == NAV_CMD_LOITER_UNLIMITED) {
+			if (!resets) {
+				valid = (i + 1 < _return_path_size);
 			}
+
+			resets = true;
+
+		} else if (!resets) {
+			_rtl_time_estimator.reset();
+			addLegToEstimate(item, item.hor_dist, item.direction, item.altitude - _return_path[i - 1].altitude);
+			time_to_end += _rtl_time_estimator.getTimeEstimate();
+			valid = true;
 		}
+
+		item.time_to_end = time_to_end;
+		item.resets = resets;
+		item.valid = valid;
 	}
 
-	return _rtl_time_estimator.getEstimate();
+	_rtl_time_estimator.reset();
+
+	_return_path_times_generation = _rtl_time_estimator.inputsGeneration();
+	_return_path_times_land_separate = land_separate;
+	_return_path_times_valid = true;
+}
+
+void RtlDirectMissionLand::addLegToEstimate(const ReturnPathItem &item, float hor_dist,
+		const matrix::Vector2f &direction, float vert_dist)
+{
+	switch (item.nav_cmd) {
+	case NAV_CMD_LOITER_UNLIMITED: {
+			_rtl_time_estimator.reset();
+			break;
+		}
+
+	case NAV_CMD_LOITER_TIME_LIMIT: {
+			// Go to loiter
+			_rtl_time_estimator.addDistance(hor_dist, direction, 0.f);
+
+			// add time
+			_rtl_time_estimator.addWait(item.time_inside);
+			break;
+		}
+
+	case NAV_CMD_LOITER_TO_ALT: {
+			// Go to point horizontally
+			_rtl_time_estimator.addDistance(hor_dist, direction, 0.f);
+
+			// Add the vertical loiter
+			_rtl_time_estimator.addVertDistance(vert_dist);
+			break;
+		}
+
+	case NAV_CMD_LAND: // Fallthrough
+	case NAV_CMD_VTOL_LAND: {
+			// For fixed wing, add diagonal line
+			if ((_vehicle_status_sub.get().vehicle_type != vehicle_status_s::VEHICLE_TYPE_FIXED_WING)
+			    && (!_vehicle_status_sub.get().is_vtol)) {
+
+				_rtl_time_estimator.addDistance(hor_dist, direction, vert_dist);
+
+			} else {
+				// For VTOL, Rotary, go there horizontally first, then land
+				_rtl_time_estimator.addDistance(hor_dist, direction, 0.f);
+
+				_rtl_time_estimator.addDescendMCLand(vert_dist);
+			}
+
+			break;
+		}
+
+	default: {
+			// Default assume can go to the location directly
+			_rtl_time_estimator.addDistance(hor_dist, direction, vert_dist);
+			break;
+		}
+	}
 }
 
 bool RtlDirectMissionLand::checkNeedsToClimb()
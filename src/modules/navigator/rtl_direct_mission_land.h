@@ -55,7 +55,7 @@ class RtlDirectMissionLand : public RtlBase
 {
 public:
 	RtlDirectMissionLand(Navigator *navigator);
-	~RtlDirectMissionLand() = default;
+	~RtlDirectMissionLand() { delete[] _return_path; }
 
 	void on_activation() override;
 	void on_inactive() override;
@@ -71,9 +71,64 @@ private:
 	void updateDatamanCache() override;
 	bool checkNeedsToClimb();
 
+	/**
+	 * @brief Position item on the return path, together with the leg from the previous position item
+	 */
+	struct ReturnPathItem {
+		int32_t index;			///< mission index of the position item
+		uint16_t nav_cmd;		///< navigation command of the item
+		float time_inside;		///< loiter time of the item [s]
+		double lat;			///< latitude of the item [deg]
+		double lon;			///< longitude of the item [deg]
+		float altitude;			///< absolute altitude of the item [m AMSL]
+		matrix::Vector2f direction;	///< horizontal direction of the leg from the previous item
+		float hor_dist;			///< horizontal length of the leg from the previous item [m]
+		float time_to_end;		///< time estimate of the legs from this item to the end of the mission [s]
+		bool resets;			///< an unlimited loiter at or after this item restarts the estimate
+		bool valid;			///< time_to_end is valid even if the estimate is restarted
+	};
+
+	/**
+	 * @brief Load the position items from the land start to the end of the mission into the return path table
+	 *
+	 * The table is only rebuilt if the mission or the home altitude changed.
+	 *
+	 * @return true if the return path table is valid
+	 */
+	bool updateReturnPath();
+
+	/**
+	 * @brief Recompute the cumulative leg times of the return path table if the estimator inputs changed
+	 */
+	void updateReturnPathTimes();
+
+	/**
+	 * @brief Add the time estimate of a leg to the given item to the time estimator
+	 *
+	 * @param item target position item of the leg
+	 * @param hor_dist horizontal length of the leg [m]
+	 * @param direction horizontal direction of the leg
+	 * @param vert_dist altitude difference of the leg [m]
+	 */
+	void addLegToEstimate(const ReturnPathItem &item, float hor_dist, const matrix::Vector2f &direction,
+			      float vert_dist);
+
 	bool _needs_climbing{false}; 	//< Flag if climbing is required at the start
 	bool _enforce_rtl_alt{false};
 	float _rtl_alt{0.0f};	///< AMSL altitude at which the vehicle should return to the land position
 
 	RtlTimeEstimator _rtl_time_estimator;
+
+	ReturnPathItem *_return_path{nullptr};		///< position items from the land start to the end of the mission
+	int32_t _return_path_size{0};			///< number of items in the return path table
+	int32_t _return_path_capacity{0};		///< allocated number of items of the return path table
+	bool _return_path_valid{false};			///< return path table matches the current mission
+	uint32_t _return_path_mission_id{0};		///< mission id of the return path table
+	int32_t _return_path_land_start_index{-1};	///< land start index of the return path table
+	uint16_t _return_path_count{0};			///< mission count of the return path table
+	uint8_t _return_path_dataman_id{0};		///< mission dataman id of the return path table
+	float _return_path_home_alt{NAN};		///< home altitude used for the relative items of the table [m AMSL]
+	uint32_t _return_path_times_generation{0};	///< estimator inputs generation of the leg times
+	bool _return_path_times_valid{false};		///< leg times are computed for the current table
+	bool _return_path_times_land_separate{false};	///< landing legs of the table descend after the horizontal approach
 };
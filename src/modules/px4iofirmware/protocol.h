@@ -77,7 +77,9 @@
 
 #define REG_TO_BOOL(_reg) 	((bool)(_reg))
 
-#define PX4IO_PROTOCOL_VERSION		5
+#define PX4IO_PROTOCOL_VERSION		6
+#define PX4IO_PROTOCOL_VERSION_MIN	5	/**< oldest protocol version the FMU still talks to */
+#define PX4IO_PROTOCOL_VERSION_CYCLE	6	/**< first protocol version with PX4IO_PAGE_CYCLE */
 
 /* maximum allowable sizes on this protocol version */
 #define PX4IO_PROTOCOL_MAX_CONTROL_COUNT	8	/**< The protocol does not support more than set here, individual units might support less - see PX4IO_P_CONFIG_CONTROL_COUNT */
@@ -202,6 +204,19 @@ enum {							/* DSM bind states */
 /* PWM output */
 #define PX4IO_PAGE_DIRECT_PWM			54		/**< 0..CONFIG_ACTUATOR_COUNT-1 */
 
+/*
+ * Output/input cycle, a write of the PWM outputs (as PX4IO_PAGE_DIRECT_PWM)
+ * that is answered with the registers below instead of an empty reply, so a
+ * single transaction per output update also carries status and R/C input.
+ */
+#define PX4IO_PAGE_CYCLE			60
+#define PX4IO_P_CYCLE_STATUS_FLAGS		0	/* PX4IO_P_STATUS_FLAGS */
+#define PX4IO_P_CYCLE_STATUS_ALARMS		1	/* PX4IO_P_STATUS_ALARMS */
+#define PX4IO_P_CYCLE_VSERVO			2	/* PX4IO_P_STATUS_VSERVO */
+#define PX4IO_P_CYCLE_VRSSI			3	/* PX4IO_P_STATUS_VRSSI */
+#define PX4IO_P_CYCLE_SETUP_ARMING		4	/* PX4IO_P_SETUP_ARMING */
+#define PX4IO_P_CYCLE_RAW_RC			5	/* PX4IO_PAGE_RAW_RC_INPUT from PX4IO_P_RAW_RC_COUNT, valid channels only */
+
 /* PWM failsafe values - zero disables the output */
 #define PX4IO_PAGE_FAILSAFE_PWM			55		/**< 0..CONFIG_ACTUATOR_COUNT-1 */
 
@@ -639,6 +639,37 @@ registers_get(uint8_t page, uint8_t offset, uint16_t **values, unsigned *num_val
 	return 0;
 }
 
+unsigned
+registers_get_cycle(uint16_t *values, unsigned max_values)
+{
+	uint16_t *status;
+	unsigned num_status;
+
+	/* refresh the status page values that are measured at read time */
+	registers_get(PX4IO_PAGE_STATUS, 0, &status, &num_status);
+
+	values[PX4IO_P_CYCLE_STATUS_FLAGS] = r_page_status[PX4IO_P_STATUS_FLAGS];
+	values[PX4IO_P_CYCLE_STATUS_ALARMS] = r_page_status[PX4IO_P_STATUS_ALARMS];
+	values[PX4IO_P_CYCLE_VSERVO] = r_page_status[PX4IO_P_STATUS_VSERVO];
+	values[PX4IO_P_CYCLE_VRSSI] = r_page_status[PX4IO_P_STATUS_VRSSI];
+	values[PX4IO_P_CYCLE_SETUP_ARMING] = r_page_setup[PX4IO_P_SETUP_ARMING];
+
+	/* the R/C prolog and only the valid channels */
+	unsigned count = PX4IO_P_RAW_RC_BASE + r_page_raw_rc_input[PX4IO_P_RAW_RC_COUNT];
+
+	if (count > sizeof(r_page_raw_rc_input) / sizeof(r_page_raw_rc_input[0])) {
+		count = sizeof(r_page_raw_rc_input) / sizeof(r_page_raw_rc_input[0]);
+	}
+
+	if (PX4IO_P_CYCLE_RAW_RC + count > max_values) {
+		count = max_values - PX4IO_P_CYCLE_RAW_RC;
+	}
+
+	memcpy(&values[PX4IO_P_CYCLE_RAW_RC], r_page_raw_rc_input, count * sizeof(uint16_t));
+
+	return PX4IO_P_CYCLE_RAW_RC + count;
+}
+
 /*
  * Helper function to handle changes to the PWM rate control registers.
  */
@@ -177,6 +177,24 @@ rx_handle_packet(void)
 		return;
 	}
 
+	if ((PKT_CODE(dma_packet) == PKT_CODE_WRITE) && (dma_packet.page == PX4IO_PAGE_CYCLE)) {
+
+		/* outputs in, status and R/C input out in the same transaction */
+		if (registers_set(PX4IO_PAGE_DIRECT_PWM, dma_packet.offset, &dma_packet.regs[0], PKT_COUNT(dma_packet))) {
+#if defined(PX4IO_PERF)
+			perf_count(pc_regerr);
+#endif
+
+			dma_packet.count_code = PKT_CODE_ERROR;
+
+		} else {
+			unsigned count = registers_get_cycle(&dma_packet.regs[0], PKT_MAX_REGS);
+			dma_packet.count_code = count | PKT_CODE_SUCCESS;
+		}
+
+		return;
+	}
+
 	if (PKT_CODE(dma_packet) == PKT_CODE_WRITE) {
 
 		/* it's a blind write - pass it on */
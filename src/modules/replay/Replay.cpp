@@ -298,7 +298,7 @@ Replay::readFileDefinitions(std::ifstream &file)
 			break;
 
 		case (int)ULogMessageType::ADD_LOGGED_MSG:
-			_data_section_start = file.tellg() - (streamoff)ULOG_MSG_HEADER_LEN;
+			_data_section_start = (streamoff)file.tellg() - ULOG_MSG_HEADER_LEN;
 			return true;
 
 		case (int)ULogMessageType::INFO: //skip
@@ -418,33 +418,24 @@ string Replay::getOrbFields(const orb_metadata *meta)
 	return format;
 }
 
-bool
-Replay::readAndAddSubscription(std::ifstream &file, uint16_t msg_size)
+void
+Replay::addSubscription(uint64_t offset)
 {
-	_read_buffer.reserve(msg_size + 1);
-	uint8_t *message = _read_buffer.data();
-	streampos this_message_pos = file.tellg() - (streamoff)ULOG_MSG_HEADER_LEN;
-	file.read((char *)message, msg_size);
-	message[msg_size] = 0;
-
-	if (!file) {
-		return false;
-	}
+	const uint16_t msg_size = _ulog_file.header(offset).msg_size;
+	const uint8_t *message = _ulog_file.payload(offset);
 
-	if (file.tellg() <= _subscription_file_pos) { //already read this subscription
-		return true;
+	if (msg_size < 3) {
+		return;
 	}
 
-	_subscription_file_pos = file.tellg();
-
 	uint8_t multi_id = *(uint8_t *)message;
 	uint16_t msg_id = ((uint16_t)message[1]) | (((uint16_t)message[2]) << 8);
-	string topic_name((char *)message + 3);
+	string topic_name((const char *)message + 3, strnlen((const char *)message + 3, msg_size - 3));
 	const orb_metadata *orb_meta = findTopic(topic_name);
 
 	if (!orb_meta) {
 		PX4_WARN("Topic %s not found internally. Will ignore it", topic_name.c_str());
-		return true;
+		return;
 	}
 
 	CompatBase *compat = nullptr;
@@ -520,7 +511,7 @@ Replay::readAndAddSubscription(std::ifstream &file, uint16_t msg_size)
 				}
 			}
 
-			return true; // not a fatal error
+			return; // not a fatal error
 		}
 	}
 
@@ -535,30 +526,23 @@ Replay::readAndAddSubscription(std::ifstream &file, uint16_t msg_size)
 
 	if (!timestamp_found) {
 		delete subscription;
-		return true;
+		return;
 	}
 
 	if (field_size != 8) {
 		PX4_ERR("Unsupported timestamp with size %i, ignoring the topic %s", field_size, orb_meta->o_name);
 		delete subscription;
-		return true;
-	}
-
-	//find first data message (and the timestamp)
-	streampos cur_pos = file.tellg();
-	subscription->next_read_pos = this_message_pos; //this will be skipped
-
-	if (!nextDataMessage(file, *subscription, msg_id)) {
-		delete subscription;
-		return false;
+		return;
 	}
 
-	file.seekg(cur_pos);
+	//find first data message after the subscription (and the timestamp)
+	const std::vector<uint64_t> &data_messages = _ulog_file.dataMessages(msg_id);
+	subscription->next_index = std::lower_bound(data_messages.begin(), data_messages.end(), offset) - data_messages.begin();
 
-	if (!subscription->orb_meta) {
+	if (!nextDataMessage(*subscription, msg_id)) {
 		//no message found. This is not a fatal error
 		delete subscription;
-		return true;
+		return;
 	}
 
 	PX4_DEBUG("adding subscription for %s (msg_id %i)", subscription->orb_meta->o_name, msg_id);
@@ -571,8 +555,6 @@ Replay::readAndAddSubscription(std::ifstream &file, uint16_t msg_size)
 	_subscriptions[msg_id] = subscription;
 
 	onSubscriptionAdded(*_subscriptions[msg_id], msg_id);
-
-	return true;
 }
 
 bool
@@ -606,37 +588,27 @@ Replay::findFieldOffset(const string &format, const string &field_name, int &off
 	return false;
 }
 
-bool
-Replay::readAndHandleAdditionalMessages(std::ifstream &file, std::streampos end_position)
+void
+Replay::handleAdditionalMessages(uint64_t end_position)
 {
-	ulog_message_header_s message_header;
+	const std::vector<uint64_t> &additional_messages = _ulog_file.additionalMessages();
 
-	while (file.tellg() < end_position) {
-		file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
+	while (_next_additional_message < additional_messages.size()
+	       && additional_messages[_next_additional_message] < end_position) {
 
-		if (!file) {
-			return false;
-		}
+		const uint64_t offset = additional_messages[_next_additional_message++];
+		const ulog_message_header_s message_header = _ulog_file.header(offset);
 
 		switch (message_header.msg_type) {
 		case (int)ULogMessageType::PARAMETER:
-			if (!readAndApplyParameter(file, message_header.msg_size)) {
-				return false;
-			}
-
+			applyParameter(_ulog_file.payload(offset), message_header.msg_size);
 			break;
 
 		case (int)ULogMessageType::DROPOUT:
-			readDropout(file, message_header.msg_size);
-			break;
-
-		default: //skip all others
-			file.seekg(message_header.msg_size, ios::cur);
+			handleDropout(_ulog_file.payload(offset), message_header.msg_size);
 			break;
 		}
 	}
-
-	return true;
 }
 
 bool
@@ -650,8 +622,19 @@ Replay::readAndApplyParameter(std::ifstream &file, uint16_t msg_size)
 		return false;
 	}
 
+	return applyParameter(message, msg_size);
+}
+
+bool
+Replay::applyParameter(const uint8_t *message, uint16_t msg_size)
+{
 	uint8_t key_len = message[0];
-	string key((char *)message + 1, key_len);
+
+	if (msg_size < 1 + key_len) {
+		return false;
+	}
+
+	string key((const char *)message + 1, key_len);
 
 	size_t pos = key.find(' ');
 
@@ -682,100 +665,63 @@ Replay::readAndApplyParameter(std::ifstream &file, uint16_t msg_size)
 	return true;
 }
 
-bool
-Replay::readDropout(std::ifstream &file, uint16_t msg_size)
+void
+Replay::handleDropout(const uint8_t *message, uint16_t msg_size)
 {
-	uint16_t duration;
-	file.read((char *)&duration, sizeof(duration));
+	uint16_t duration = 0;
+
+	if (msg_size >= sizeof(duration)) {
+		memcpy(&duration, message, sizeof(duration));
+	}
 
 	PX4_ERR("Dropout in replayed log, %i ms", (int)duration);
-	return file.good();
 }
 
 bool
-Replay::nextDataMessage(std::ifstream &file, Subscription &subscription, int msg_id)
+Replay::nextDataMessage(Subscription &subscription, int msg_id)
 {
-	ulog_message_header_s message_header;
-	file.seekg(subscription.next_read_pos);
-	//ignore the first message (it's data we already read)
-	file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
-
-	if (file) {
-		file.seekg(message_header.msg_size, ios::cur);
-	}
+	const std::vector<uint64_t> &data_messages = _ulog_file.dataMessages(msg_id);
 
-	uint16_t file_msg_id;
-	bool done = false;
+	while (subscription.next_index < data_messages.size()) {
+		const uint64_t offset = data_messages[subscription.next_index++];
+		const uint16_t msg_size = _ulog_file.header(offset).msg_size;
 
-	while (file && !done) {
-		streampos cur_pos = file.tellg();
-		file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
-
-		if (!file) {
-			break;
-		}
-
-		if (((streamoff)cur_pos) + ULOG_MSG_HEADER_LEN + message_header.msg_size > _read_until_file_position) {
-			file.setstate(std::ios::eofbit);
-			break;
+		if (msg_size == subscription.orb_meta->o_size_no_padding + 2) {
+			subscription.next_read_pos = offset;
+			memcpy(&subscription.next_timestamp, _ulog_file.payload(offset) + 2 + subscription.timestamp_offset,
+			       sizeof(subscription.next_timestamp));
+			return true;
 		}
 
-		switch (message_header.msg_type) {
-		case (int)ULogMessageType::ADD_LOGGED_MSG:
-			readAndAddSubscription(file, message_header.msg_size);
-			break;
-
-		case (int)ULogMessageType::DATA:
-			file.read((char *)&file_msg_id, sizeof(file_msg_id));
-
-			if (file) {
-				if (msg_id == file_msg_id) {
-					if (message_header.msg_size == subscription.orb_meta->o_size_no_padding + 2) {
-						subscription.next_read_pos = cur_pos;
-						file.seekg(subscription.timestamp_offset, ios::cur);
-						file.read((char *)&subscription.next_timestamp, sizeof(subscription.next_timestamp));
-						done = true;
-
-					} else { //sanity check failed!
-						PX4_ERR("data message %s has wrong size %i (expected %i). Skipping",
-							subscription.orb_meta->o_name, message_header.msg_size,
-							subscription.orb_meta->o_size_no_padding + 2);
-						file.seekg(message_header.msg_size - sizeof(file_msg_id), ios::cur);
-					}
-
-				} else { //not the one we are looking for
-					file.seekg(message_header.msg_size - sizeof(file_msg_id), ios::cur);
-				}
-			}
-
-			break;
+		//sanity check failed!
+		PX4_ERR("data message %s has wrong size %i (expected %i). Skipping",
+			subscription.orb_meta->o_name, msg_size, subscription.orb_meta->o_size_no_padding + 2);
+	}
 
-		case (int)ULogMessageType::REMOVE_LOGGED_MSG: //skip these
-		case (int)ULogMessageType::PARAMETER:
-		case (int)ULogMessageType::DROPOUT:
-		case (int)ULogMessageType::INFO:
-		case (int)ULogMessageType::INFO_MULTIPLE:
-		case (int)ULogMessageType::SYNC:
-		case (int)ULogMessageType::LOGGING:
-		case (int)ULogMessageType::PARAMETER_DEFAULT:
-			file.seekg(message_header.msg_size, ios::cur);
-			break;
+	//no more data messages for this subscription
+	subscription.orb_meta = nullptr;
+	return false;
+}
 
-		default:
-			//this really should not happen
-			PX4_ERR("unknown log message type %i, size %i (offset %i)",
-				(int)message_header.msg_type, (int)message_header.msg_size, (int)file.tellg());
-			file.seekg(message_header.msg_size, ios::cur);
-			break;
-		}
+void
+Replay::seekSubscription(Subscription &subscription, int msg_id, uint64_t seek_time)
+{
+	if (!subscription.orb_meta || subscription.next_timestamp >= seek_time) {
+		return;
 	}
 
-	if (file.eof()) { //no more data messages for this subscription
-		subscription.orb_meta = nullptr;
-		file.clear();
-	}
+	//binary search through the remaining messages (timestamps are monotonic per topic)
+	const std::vector<uint64_t> &data_messages = _ulog_file.dataMessages(msg_id);
+	const auto first = data_messages.begin() + subscription.next_index;
+	const auto after_seek = std::lower_bound(first, data_messages.end(), seek_time,
+	[&](uint64_t offset, uint64_t t) {
+		return _ulog_file.header(offset).msg_size != subscription.orb_meta->o_size_no_padding + 2
+		       || readTimestamp(subscription, offset) < t;
+	});
 
-	return file.good();
+	//the message before after_seek is the last one before the seek time (it comes after the current one)
+	subscription.next_index = (after_seek - data_messages.begin()) - 1;
+	nextDataMessage(subscription, msg_id);
 }
 
 const orb_metadata *
@@ -898,28 +844,44 @@ Replay::run()
 		_speed_factor = atof(speedup);
 	}
 
-	onEnterMainLoop();
+	replay_file.close();
 
-	_replay_start_time = hrt_absolute_time();
+	if (!_ulog_file.open(_replay_file)) {
+		return;
+	}
 
-	PX4_INFO("Replay in progress...");
+	const size_t nr_data_messages = _ulog_file.buildIndex(_data_section_start, _read_until_file_position);
+	PX4_INFO("Indexed %zu data messages", nr_data_messages);
 
-	ulog_message_header_s message_header;
-	replay_file.seekg(_data_section_start);
+	for (const uint64_t offset : _ulog_file.subscriptionMessages()) {
+		addSubscription(offset);
+	}
 
-	//we know the next message must be an ADD_LOGGED_MSG
-	replay_file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
+	_seek_time = _file_start_time;
+	const char *start_time = getenv(replay::ENV_START_TIME);
 
-	if (!readAndAddSubscription(replay_file, message_header.msg_size)) {
-		PX4_ERR("Failed to read subscription");
-		return;
+	if (start_time && atof(start_time) > 0.) {
+		_seek_time = onSeek(_file_start_time + (uint64_t)(atof(start_time) * 1.e6));
+
+		for (size_t i = 0; i < _subscriptions.size(); ++i) {
+			if (_subscriptions[i]) {
+				seekSubscription(*_subscriptions[i], i, _seek_time);
+			}
+		}
+
+		PX4_INFO("Starting replay at %.3lf s", (double)(_seek_time - _file_start_time) / 1.e6);
 	}
 
+	onEnterMainLoop();
+
+	_replay_start_time = hrt_absolute_time();
+
+	PX4_INFO("Replay in progress...");
+
 	const uint64_t timestamp_offset = getTimestampOffset();
 	uint32_t nr_published_messages = 0;
-	streampos last_additional_message_pos = _data_section_start;
 
-	while (!should_exit() && replay_file) {
+	while (!should_exit()) {
 
 		//Find the next message to publish. Messages from different subscriptions don't need
 		//to be in chronological order, so we need to check all subscriptions
@@ -951,15 +913,12 @@ Replay::run()
 
 		if (next_file_time == 0 || next_file_time < _file_start_time) {
 			//someone didn't set the timestamp properly. Consider the message invalid
-			nextDataMessage(replay_file, sub, next_msg_id);
+			nextDataMessage(sub, next_msg_id);
 			continue;
 		}
 
 		//handle additional messages between last and next published data
-		replay_file.seekg(last_additional_message_pos);
-		streampos next_additional_message_pos = sub.next_read_pos;
-		readAndHandleAdditionalMessages(replay_file, next_additional_message_pos);
-		last_additional_message_pos = next_additional_message_pos;
+		handleAdditionalMessages(sub.next_read_pos);
 
 		// Perform scheduled parameter changes
 		while (_next_param_change < _dynamic_parameter_schedule.size() &&
@@ -975,14 +934,14 @@ Replay::run()
 		const uint64_t publish_timestamp = handleTopicDelay(next_file_time, timestamp_offset);
 
 		// It's time to publish
-		readTopicDataToBuffer(sub, replay_file);
+		readTopicDataToBuffer(sub);
 		memcpy(_read_buffer.data() + sub.timestamp_offset, &publish_timestamp, sizeof(uint64_t)); //adjust the timestamp
 
-		if (handleTopicUpdate(sub, _read_buffer.data(), replay_file)) {
+		if (handleTopicUpdate(sub, _read_buffer.data())) {
 			++nr_published_messages;
 		}
 
-		nextDataMessage(replay_file, sub, next_msg_id);
+		nextDataMessage(sub, next_msg_id);
 
 		// TODO: output status (eg. every sec), including total duration...
 	}
@@ -1010,8 +969,9 @@ Replay::run()
 
 	onExitMainLoop();
 
+	_ulog_file.close();
+
 	if (!should_exit()) {
-		replay_file.close();
 		px4_shutdown_request();
 		// we need to ensure the shutdown logic gets updated and eventually triggers shutdown
 		hrt_abstime t = hrt_absolute_time();
@@ -1026,17 +986,16 @@ Replay::run()
 }
 
 void
-Replay::readTopicDataToBuffer(const Subscription &sub, std::ifstream &replay_file)
+Replay::readTopicDataToBuffer(const Subscription &sub)
 {
 	const size_t msg_read_size = sub.orb_meta->o_size_no_padding;
 	const size_t msg_write_size = sub.orb_meta->o_size;
 	_read_buffer.reserve(msg_write_size);
-	replay_file.seekg(sub.next_read_pos + (streamoff)(ULOG_MSG_HEADER_LEN + 2)); //skip header & msg id
-	replay_file.read((char *)_read_buffer.data(), msg_read_size);
+	memcpy(_read_buffer.data(), _ulog_file.payload(sub.next_read_pos) + 2, msg_read_size); //skip msg id
 }
 
 bool
-Replay::handleTopicUpdate(Subscription &sub, void *data, std::ifstream &replay_file)
+Replay::handleTopicUpdate(Subscription &sub, void *data)
 {
 	return publishTopic(sub, data);
 }
@@ -1205,6 +1164,10 @@ Replay::instantiate(int argc, char *argv[])
 		PX4_INFO("Ekf2 replay mode");
 		instance = new ReplayEkf2();
 
+	} else if (replay_mode && strcmp(replay_mode, "bench") == 0) {
+		PX4_INFO("Benchmark replay mode");
+		instance = new ReplayBench();
+
 	} else {
 		instance = new Replay();
 	}
@@ -1228,9 +1191,16 @@ There are 2 environment variables used for configuration: `replay`, which must b
 the log file to be replayed. The second is the mode, specified via `replay_mode`:
 - `replay_mode=ekf2`: specific EKF2 replay mode. It can only be used with the ekf2 module, but allows the replay
   to run as fast as possible.
+- `replay_mode=bench`: generic replay as fast as possible, waiting for all work queues to go idle after each
+  publication (requires lockstep). At the end a JSON report with the processing time of all elapsed and histogram
+  perf counters, the per-publication cycle time, wall/simulated time and memory is written to the file given by
+  `replay_bench` (default `replay_bench.json`).
 - Generic otherwise: this can be used to replay any module(s), but the replay will be done with the same speed as the
   log was recorded.
 
+Optionally `replay_start` sets the time (in seconds since the start of the log) to start the replay at. In ekf2 mode
+the filter is initialized from the last `estimator_snapshot` before that time (see EKF2_SNAP_INT).
+
 The module is typically used together with uORB publisher rules, to specify which messages should be replayed.
 The replay module will just publish all messages that are found in the log. It also applies the parameters from
 the log.
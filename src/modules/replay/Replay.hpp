@@ -41,6 +41,7 @@
 #include <string>
 
 #include "definitions.hpp"
+#include "ULogMappedFile.hpp"
 
 #include <px4_platform_common/module.h>
 #include <uORB/topics/uORBTopics.hpp>
@@ -52,9 +53,9 @@ namespace px4
 /**
  * @class Replay
  * Parses an ULog file and replays it in 'real-time'. The timestamp of each replayed message is offset
- * to match the starting time of replay. It keeps a stream for each subscription to find the next message
- * to replay. This is necessary because data messages from different subscriptions don't need to be in
- * monotonic increasing order.
+ * to match the starting time of replay. The data section is memory mapped and indexed once, and each
+ * subscription keeps its position in the index of its msg_id to find the next message to replay. This is
+ * necessary because data messages from different subscriptions don't need to be in monotonic increasing order.
  */
 class Replay : public ModuleBase<Replay>
 {
@@ -135,7 +136,8 @@ protected:
 
 		bool ignored = false; ///< if true, it will not be considered for publication in the main loop
 
-		std::streampos next_read_pos;
+		uint64_t next_read_pos; ///< file offset of the next message to publish
+		size_t next_index = 0; ///< index (in the data messages of this msg_id) where the search for the next message continues
 		uint64_t next_timestamp; ///< timestamp of the file
 
 		CompatBase *compat = nullptr;
@@ -190,33 +192,53 @@ protected:
 	 * handle the publication of a topic update
 	 * @return true if published, false otherwise
 	 */
-	virtual bool handleTopicUpdate(Subscription &sub, void *data, std::ifstream &replay_file);
+	virtual bool handleTopicUpdate(Subscription &sub, void *data);
 
 	/**
-	 * read a topic from the file (offset given by the subscription) into _read_buffer
+	 * copy a topic from the mapped file (offset given by the subscription) into _read_buffer
 	 */
-	void readTopicDataToBuffer(const Subscription &sub, std::ifstream &replay_file);
+	void readTopicDataToBuffer(const Subscription &sub);
 
 	/**
-	 * Find next data message for this subscription, starting with the stored file offset.
-	 * Skip the first message, and if found, read the timestamp and store the new file offset.
-	 * This also takes care of new subscriptions and parameter updates. When reaching EOF,
-	 * the subscription is set to invalid.
-	 * File seek position is arbitrary after this call.
-	 * @return false on file error
+	 * Find next data message for this subscription in the index, and if found, read the timestamp
+	 * and store the file offset. When reaching the end, the subscription is set to invalid.
+	 * @return false if there are no more messages
 	 */
-	bool nextDataMessage(std::ifstream &file, Subscription &subscription, int msg_id);
+	bool nextDataMessage(Subscription &subscription, int msg_id);
+
+	/**
+	 * called before seeking to a start time in the log (ENV_START_TIME)
+	 * @param requested_time file time requested by the user
+	 * @return file time to seek to
+	 */
+	virtual uint64_t onSeek(uint64_t requested_time) { return requested_time; }
+
+	/**
+	 * Move a subscription to the last message before seek_time (so that the current state of
+	 * the topic is known), or to the first message if there is none before.
+	 */
+	void seekSubscription(Subscription &subscription, int msg_id, uint64_t seek_time);
+
+	/** read the timestamp of a data message of a subscription */
+	uint64_t readTimestamp(const Subscription &subscription, uint64_t offset) const
+	{
+		uint64_t timestamp;
+		memcpy(&timestamp, _ulog_file.payload(offset) + 2 + subscription.timestamp_offset, sizeof(timestamp));
+		return timestamp;
+	}
 
 	virtual uint64_t getTimestampOffset()
 	{
 		//we update the timestamps from the file by a constant offset to match
 		//the current replay time
-		return _replay_start_time - _file_start_time;
+		return _replay_start_time - _seek_time;
 	}
 
 	std::vector<Subscription *> _subscriptions;
 	std::vector<uint8_t> _read_buffer;
 
+	ULogMappedFile _ulog_file;
+
 	float _speed_factor{1.f}; ///< from PX4_SIM_SPEED_FACTOR env variable (set to 0 to avoid usleep = unlimited rate)
 
 private:
@@ -241,11 +263,10 @@ private:
 	std::map<std::string, std::string> _file_formats; ///< all formats we read from the file
 
 	uint64_t _file_start_time;
+	uint64_t _seek_time; ///< file time the replay starts at (_file_start_time or ENV_START_TIME)
 	uint64_t _replay_start_time;
-	std::streampos _data_section_start; ///< first ADD_LOGGED_MSG message
-
-	/** keep track of file position to avoid adding a subscription multiple times. */
-	std::streampos _subscription_file_pos = 0;
+	uint64_t _data_section_start; ///< first ADD_LOGGED_MSG message
+	size_t _next_additional_message{0}; ///< next entry in the indexed parameter and dropout messages
 
 	int64_t _read_until_file_position = 1ULL << 60; ///< read limit if log contains appended data
 
@@ -262,9 +283,14 @@ private:
 
 	///file parsing methods. They return false, when further parsing should be aborted.
 	bool readFormat(std::ifstream &file, uint16_t msg_size);
-	bool readAndAddSubscription(std::ifstream &file, uint16_t msg_size);
 	bool readFlagBits(std::ifstream &file, uint16_t msg_size);
 
+	/**
+	 * Add a subscription from an ADD_LOGGED_MSG message of the mapped file.
+	 * @param offset file offset of the message
+	 */
+	void addSubscription(uint64_t offset);
+
 	/**
 	 * Read the file header and definitions sections. Apply the parameters from this section
 	 * and apply user-defined overridden parameters.
@@ -273,14 +299,14 @@ private:
 	bool readDefinitionsAndApplyParams(std::ifstream &file);
 
 	/**
-	 * Read and handle additional messages starting at current file position, while position < end_position.
+	 * Handle the indexed additional messages that come before end_position in the file.
 	 * This handles dropout and parameter update messages.
 	 * We need to handle these separately, because they have no timestamp. We look at the file position instead.
-	 * @return false on file error
 	 */
-	bool readAndHandleAdditionalMessages(std::ifstream &file, std::streampos end_position);
-	bool readDropout(std::ifstream &file, uint16_t msg_size);
+	void handleAdditionalMessages(uint64_t end_position);
+	void handleDropout(const uint8_t *message, uint16_t msg_size);
 	bool readAndApplyParameter(std::ifstream &file, uint16_t msg_size);
+	bool applyParameter(const uint8_t *message, uint16_t msg_size);
 
 	static const orb_metadata *findTopic(const std::string &name);
 
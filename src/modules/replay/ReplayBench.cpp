@@ -0,0 +1,200 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/posix.h>
+#include <lib/parameters/param.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#include "definitions.hpp"
+#include "ReplayBench.hpp"
+
+namespace px4
+{
+
+struct ReplayBenchReport {
+	FILE *file;
+	bool first;
+};
+
+static uint64_t wall_time_us()
+{
+	struct timespec ts;
+	system_clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts_to_abstime(&ts);
+}
+
+ReplayBench::ReplayBench()
+{
+	_speed_factor = 0.f; // iterate as fast as possible
+}
+
+ReplayBench::~ReplayBench()
+{
+	perf_free(_cycle_perf);
+}
+
+void
+ReplayBench::onEnterMainLoop()
+{
+	_speed_factor = 0.f;
+
+	// disable parameter auto save
+	param_control_autosave(false);
+
+	// let the modules settle on the initial state before the measurement starts
+	px4_lockstep_wait_for_components();
+	perf_reset_all();
+
+	_wall_start_us = wall_time_us();
+	_sim_start_us = hrt_absolute_time();
+}
+
+bool
+ReplayBench::handleTopicUpdate(Subscription &sub, void *data)
+{
+	// measure the time until everything triggered by the publication has run
+	perf_begin(_cycle_perf);
+	const bool published = publishTopic(sub, data);
+	px4_lockstep_wait_for_components();
+	perf_end(_cycle_perf);
+
+	if (published) {
+		_published++;
+	}
+
+	return published;
+}
+
+void
+ReplayBench::onExitMainLoop()
+{
+	px4_lockstep_wait_for_components();
+
+	const char *filename = getenv(replay::ENV_BENCH_REPORT);
+
+	if (!filename || filename[0] == '\0') {
+		filename = "replay_bench.json";
+	}
+
+	if (writeReport(filename)) {
+		PX4_INFO("Benchmark report written to %s", filename);
+
+	} else {
+		PX4_ERR("failed to write benchmark report %s", filename);
+	}
+
+	perf_print_counter(_cycle_perf);
+}
+
+void
+ReplayBench::writeCounter(perf_counter_t handle, void *user)
+{
+	ReplayBenchReport *report = static_cast<ReplayBenchReport *>(user);
+	const enum perf_counter_type type = perf_type(handle);
+
+	if ((type != PC_ELAPSED) && (type != PC_HISTOGRAM)) {
+		return;
+	}
+
+	const uint64_t events = perf_event_count(handle);
+
+	if (events == 0) {
+		return;
+	}
+
+	// perf_mean() is in seconds
+	const double mean_us = (double)perf_mean(handle) * 1e6;
+
+	fprintf(report->file, "%s\n    {\"name\": \"%s\", \"events\": %llu, \"mean_us\": %.3f, \"total_us\": %.0f",
+		report->first ? "" : ",", perf_name(handle), (unsigned long long)events, mean_us, mean_us * (double)events);
+
+	if (type == PC_HISTOGRAM) {
+		fprintf(report->file, ", \"p50_us\": %u, \"p90_us\": %u, \"p99_us\": %u, \"p99_9_us\": %u, \"max_us\": %u",
+			(unsigned)perf_percentile(handle, 50.f), (unsigned)perf_percentile(handle, 90.f),
+			(unsigned)perf_percentile(handle, 99.f), (unsigned)perf_percentile(handle, 99.9f),
+			(unsigned)perf_percentile(handle, 100.f));
+	}
+
+	fprintf(report->file, "}");
+	report->first = false;
+}
+
+bool
+ReplayBench::writeReport(const char *filename)
+{
+	FILE *file = fopen(filename, "w");
+
+	if (!file) {
+		return false;
+	}
+
+	const double wall_s = (double)(wall_time_us() - _wall_start_us) / 1e6;
+	const double sim_s = (double)(hrt_absolute_time() - _sim_start_us) / 1e6;
+
+	struct rusage usage {};
+	getrusage(RUSAGE_SELF, &usage);
+
+	const double cpu_s = (double)usage.ru_utime.tv_sec + (double)usage.ru_utime.tv_usec / 1e6
+			     + (double)usage.ru_stime.tv_sec + (double)usage.ru_stime.tv_usec / 1e6;
+
+#if defined(__PX4_DARWIN)
+	const long max_rss_kb = usage.ru_maxrss / 1024; // bytes on macOS
+#else
+	const long max_rss_kb = usage.ru_maxrss;
+#endif
+
+	fprintf(file, "{\n");
+	fprintf(file, "  \"log\": \"%s\",\n", getenv(replay::ENV_FILENAME));
+	fprintf(file, "  \"published_msgs\": %u,\n", (unsigned)_published);
+	fprintf(file, "  \"sim_time_s\": %.3f,\n", sim_s);
+	fprintf(file, "  \"wall_time_s\": %.3f,\n", wall_s);
+	fprintf(file, "  \"realtime_factor\": %.2f,\n", (wall_s > 0.) ? sim_s / wall_s : 0.);
+	fprintf(file, "  \"process_cpu_time_s\": %.3f,\n", cpu_s);
+	fprintf(file, "  \"max_rss_kb\": %ld,\n", max_rss_kb);
+	fprintf(file, "  \"counters\": [");
+
+	ReplayBenchReport report{file, true};
+	perf_iterate_all(writeCounter, &report);
+
+	fprintf(file, "\n  ]\n}\n");
+
+	return fclose(file) == 0;
+}
+
+} //namespace px4
@@ -0,0 +1,75 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "Replay.hpp"
+
+#include <perf/perf_counter.h>
+
+namespace px4
+{
+
+/**
+ * @class ReplayBench
+ * replay specialization to benchmark the CPU cost of the modules processing the replayed topics.
+ * The log is replayed as fast as possible, waiting for all work queues to finish after each
+ * publication, and a JSON report is written at the end.
+ */
+class ReplayBench : public Replay
+{
+public:
+	ReplayBench();
+	~ReplayBench() override;
+
+protected:
+
+	void onEnterMainLoop() override;
+	void onExitMainLoop() override;
+
+	bool handleTopicUpdate(Subscription &sub, void *data) override;
+
+private:
+
+	bool writeReport(const char *filename);
+
+	static void writeCounter(perf_counter_t handle, void *user);
+
+	perf_counter_t _cycle_perf{perf_alloc(PC_HISTOGRAM, "replay_bench: cycle")};
+
+	uint64_t _wall_start_us{0};
+	uint64_t _sim_start_us{0};
+	uint32_t _published{0};
+};
+
+} //namespace px4
@@ -59,13 +59,13 @@ namespace px4
 {
 
 bool
-ReplayEkf2::handleTopicUpdate(Subscription &sub, void *data, std::ifstream &replay_file)
+ReplayEkf2::handleTopicUpdate(Subscription &sub, void *data)
 {
 	if (sub.orb_meta == ORB_ID(ekf2_timestamps)) {
 		ekf2_timestamps_s ekf2_timestamps;
 		memcpy(&ekf2_timestamps, data, sub.orb_meta->o_size);
 
-		if (!publishEkf2Topics(ekf2_timestamps, replay_file)) {
+		if (!publishEkf2Topics(ekf2_timestamps)) {
 			return false;
 		}
 
@@ -108,6 +108,9 @@ ReplayEkf2::onSubscriptionAdded(Subscription &sub, uint16_t msg_id)
 
 	} else if (sub.orb_meta == ORB_ID(aux_global_position)) {
 		_aux_global_position_msg_id = msg_id;
+
+	} else if (sub.orb_meta == ORB_ID(estimator_snapshot)) {
+		_estimator_snapshot_msg_id = msg_id;
 	}
 
 	// the main loop should only handle publication of the following topics, the sensor topics are
@@ -117,14 +120,60 @@ ReplayEkf2::onSubscriptionAdded(Subscription &sub, uint16_t msg_id)
 		      && sub.orb_meta != ORB_ID(vehicle_land_detected) && sub.orb_meta != ORB_ID(vehicle_gps_position);
 }
 
+uint64_t
+ReplayEkf2::onSeek(uint64_t requested_time)
+{
+	if (_estimator_snapshot_msg_id == msg_id_invalid) {
+		PX4_WARN("no estimator_snapshot in the log (EKF2_SNAP_INT), ekf2 starts uninitialized");
+		return requested_time;
+	}
+
+	const Subscription &sub = *_subscriptions[_estimator_snapshot_msg_id];
+	const std::vector<uint64_t> &data_messages = _ulog_file.dataMessages(_estimator_snapshot_msg_id);
+	bool found = false;
+
+	// snapshots are rare, a linear search is fine
+	for (size_t i = sub.next_index - 1; i < data_messages.size(); ++i) {
+		const uint64_t offset = data_messages[i];
+
+		if (_ulog_file.header(offset).msg_size != sub.orb_meta->o_size_no_padding + 2) {
+			continue;
+		}
+
+		if (readTimestamp(sub, offset) > requested_time) {
+			break;
+		}
+
+		memcpy(&_snapshot, _ulog_file.payload(offset) + 2, sub.orb_meta->o_size_no_padding);
+		found = true;
+	}
+
+	if (!found) {
+		PX4_WARN("no estimator_snapshot before the requested start time, ekf2 starts uninitialized");
+		return requested_time;
+	}
+
+	PX4_INFO("restoring ekf2 from snapshot at %" PRIu64, _snapshot.timestamp_sample);
+	_snapshot_restore_pending = true;
+
+	return _snapshot.timestamp_sample;
+}
+
 bool
-ReplayEkf2::publishEkf2Topics(const ekf2_timestamps_s &ekf2_timestamps, std::ifstream &replay_file)
+ReplayEkf2::publishEkf2Topics(const ekf2_timestamps_s &ekf2_timestamps)
 {
+	if (_snapshot_restore_pending) {
+		// ekf2 restores the state with the next IMU sample
+		_snapshot.timestamp = ekf2_timestamps.timestamp;
+		_estimator_snapshot_restore_pub.publish(_snapshot);
+		_snapshot_restore_pending = false;
+	}
+
 	auto handle_sensor_publication = [&](int16_t timestamp_relative, uint16_t msg_id) {
 		if (timestamp_relative != ekf2_timestamps_s::RELATIVE_TIMESTAMP_INVALID) {
 			// timestamp_relative is already given in 0.1 ms
 			uint64_t t = timestamp_relative + ekf2_timestamps.timestamp / 100; // in 0.1 ms
-			findTimestampAndPublish(t, msg_id, replay_file);
+			findTimestampAndPublish(t, msg_id);
 		}
 	};
 
@@ -137,7 +186,7 @@ ReplayEkf2::publishEkf2Topics(const ekf2_timestamps_s &ekf2_timestamps, std::ifs
 	handle_sensor_publication(0, _aux_global_position_msg_id);
 
 	// sensor_combined: publish last because ekf2 is polling on this
-	if (!findTimestampAndPublish(ekf2_timestamps.timestamp / 100, _sensor_combined_msg_id, replay_file)) {
+	if (!findTimestampAndPublish(ekf2_timestamps.timestamp / 100, _sensor_combined_msg_id)) {
 		if (_sensor_combined_msg_id == msg_id_invalid) {
 			// subscription not found yet or sensor_combined not contained in log
 			return false;
@@ -147,7 +196,7 @@ ReplayEkf2::publishEkf2Topics(const ekf2_timestamps_s &ekf2_timestamps, std::ifs
 
 		} else {
 			// we should publish a topic, just publish the same again
-			readTopicDataToBuffer(*_subscriptions[_sensor_combined_msg_id], replay_file);
+			readTopicDataToBuffer(*_subscriptions[_sensor_combined_msg_id]);
 			publishTopic(*_subscriptions[_sensor_combined_msg_id], _read_buffer.data());
 		}
 	}
@@ -156,7 +205,7 @@ ReplayEkf2::publishEkf2Topics(const ekf2_timestamps_s &ekf2_timestamps, std::ifs
 }
 
 bool
-ReplayEkf2::findTimestampAndPublish(uint64_t timestamp, uint16_t msg_id, std::ifstream &replay_file)
+ReplayEkf2::findTimestampAndPublish(uint64_t timestamp, uint16_t msg_id)
 {
 	if (msg_id == msg_id_invalid) {
 		// could happen if a topic is not logged
@@ -166,7 +215,7 @@ ReplayEkf2::findTimestampAndPublish(uint64_t timestamp, uint16_t msg_id, std::if
 	Subscription &sub = *_subscriptions[msg_id];
 
 	while (sub.next_timestamp / 100 < timestamp && sub.orb_meta) {
-		nextDataMessage(replay_file, sub, msg_id);
+		nextDataMessage(sub, msg_id);
 	}
 
 	if (!sub.orb_meta) { // no messages anymore
@@ -181,7 +230,7 @@ ReplayEkf2::findTimestampAndPublish(uint64_t timestamp, uint16_t msg_id, std::if
 		return false;
 	}
 
-	readTopicDataToBuffer(sub, replay_file);
+	readTopicDataToBuffer(sub);
 	publishTopic(sub, _read_buffer.data());
 	return true;
 }
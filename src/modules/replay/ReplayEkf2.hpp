@@ -35,6 +35,9 @@
 
 #include "Replay.hpp"
 
+#include <uORB/Publication.hpp>
+#include <uORB/topics/estimator_snapshot.h>
+
 namespace px4
 {
 
@@ -54,13 +57,18 @@ protected:
 	 * handle ekf2 topic publication in ekf2 replay mode
 	 * @param sub
 	 * @param data
-	 * @param replay_file file currently replayed (file seek position should be considered arbitrary after this call)
 	 * @return true if published, false otherwise
 	 */
-	bool handleTopicUpdate(Subscription &sub, void *data, std::ifstream &replay_file) override;
+	bool handleTopicUpdate(Subscription &sub, void *data) override;
 
 	void onSubscriptionAdded(Subscription &sub, uint16_t msg_id) override;
 
+	/**
+	 * find the last estimator snapshot before the requested time, ekf2 is restored from it
+	 * @return timestamp of the snapshot state (the replay starts there)
+	 */
+	uint64_t onSeek(uint64_t requested_time) override;
+
 	uint64_t getTimestampOffset() override
 	{
 		// avoid offsetting timestamps as we use them to compare against the log
@@ -68,16 +76,15 @@ protected:
 	}
 private:
 
-	bool publishEkf2Topics(const ekf2_timestamps_s &ekf2_timestamps, std::ifstream &replay_file);
+	bool publishEkf2Topics(const ekf2_timestamps_s &ekf2_timestamps);
 
 	/**
 	 * find the next message for a subscription that matches a given timestamp and publish it
 	 * @param timestamp in 0.1 ms
 	 * @param msg_id
-	 * @param replay_file file currently replayed (file seek position should be considered arbitrary after this call)
 	 * @return true if timestamp found and published
 	 */
-	bool findTimestampAndPublish(uint64_t timestamp, uint16_t msg_id, std::ifstream &replay_file);
+	bool findTimestampAndPublish(uint64_t timestamp, uint16_t msg_id);
 
 	static constexpr uint16_t msg_id_invalid = 0xffff;
 
@@ -89,6 +96,11 @@ private:
 	uint16_t _vehicle_magnetometer_msg_id = msg_id_invalid;
 	uint16_t _vehicle_visual_odometry_msg_id = msg_id_invalid;
 	uint16_t _aux_global_position_msg_id = msg_id_invalid;
+	uint16_t _estimator_snapshot_msg_id = msg_id_invalid;
+
+	estimator_snapshot_s _snapshot{};
+	bool _snapshot_restore_pending{false};
+	uORB::Publication<estimator_snapshot_s> _estimator_snapshot_restore_pub{ORB_ID(estimator_snapshot_restore)};
 };
 
 } //namespace px4
@@ -0,0 +1,167 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "ULogMappedFile.hpp"
+
+#include <px4_platform_common/log.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace px4
+{
+
+const std::vector<uint64_t> ULogMappedFile::_empty{};
+
+bool
+ULogMappedFile::open(const char *file_name)
+{
+	close();
+
+	int fd = ::open(file_name, O_RDONLY);
+
+	if (fd < 0) {
+		PX4_ERR("failed to open %s (%i)", file_name, errno);
+		return false;
+	}
+
+	struct stat st;
+
+	if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+		PX4_ERR("failed to get size of %s", file_name);
+		::close(fd);
+		return false;
+	}
+
+	void *mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	// the mapping stays valid after closing the descriptor
+	::close(fd);
+
+	if (mapped == MAP_FAILED) {
+		PX4_ERR("failed to map %s (%i)", file_name, errno);
+		return false;
+	}
+
+	// messages are mostly accessed in file order
+	madvise(mapped, st.st_size, MADV_SEQUENTIAL);
+
+	_data = static_cast<const uint8_t *>(mapped);
+	_size = st.st_size;
+	return true;
+}
+
+void
+ULogMappedFile::close()
+{
+	if (_data) {
+		munmap(const_cast<uint8_t *>(_data), _size);
+		_data = nullptr;
+		_size = 0;
+	}
+
+	_data_messages.clear();
+	_subscription_messages.clear();
+	_additional_messages.clear();
+}
+
+size_t
+ULogMappedFile::buildIndex(uint64_t start, uint64_t end)
+{
+	size_t num_data_messages = 0;
+
+	if (end > _size) {
+		end = _size;
+	}
+
+	uint64_t offset = start;
+
+	while (offset + ULOG_MSG_HEADER_LEN <= end) {
+		const ulog_message_header_s message_header = header(offset);
+
+		if (offset + ULOG_MSG_HEADER_LEN + message_header.msg_size > end) {
+			break; // incomplete message (e.g. log not closed properly)
+		}
+
+		switch (message_header.msg_type) {
+		case (int)ULogMessageType::DATA:
+			if (message_header.msg_size >= sizeof(uint16_t)) {
+				uint16_t msg_id;
+				memcpy(&msg_id, payload(offset), sizeof(msg_id));
+
+				if (_data_messages.size() <= msg_id) {
+					_data_messages.resize(msg_id + 1);
+				}
+
+				_data_messages[msg_id].push_back(offset);
+				++num_data_messages;
+			}
+
+			break;
+
+		case (int)ULogMessageType::ADD_LOGGED_MSG:
+			_subscription_messages.push_back(offset);
+			break;
+
+		case (int)ULogMessageType::PARAMETER:
+		case (int)ULogMessageType::DROPOUT:
+			_additional_messages.push_back(offset);
+			break;
+
+		case (int)ULogMessageType::REMOVE_LOGGED_MSG: //skip these
+		case (int)ULogMessageType::INFO:
+		case (int)ULogMessageType::INFO_MULTIPLE:
+		case (int)ULogMessageType::SYNC:
+		case (int)ULogMessageType::LOGGING:
+		case (int)ULogMessageType::LOGGING_TAGGED:
+		case (int)ULogMessageType::PARAMETER_DEFAULT:
+			break;
+
+		default:
+			//this really should not happen
+			PX4_ERR("unknown log message type %i, size %i (offset %llu)",
+				(int)message_header.msg_type, (int)message_header.msg_size, (unsigned long long)offset);
+			break;
+		}
+
+		offset += ULOG_MSG_HEADER_LEN + message_header.msg_size;
+	}
+
+	return num_data_messages;
+}
+
+} // namespace px4
@@ -0,0 +1,109 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+#include <logger/messages.h>
+
+namespace px4
+{
+
+/**
+ * @class ULogMappedFile
+ * Read-only memory mapping of an ULog file together with a one-pass index of the data section:
+ * the file offsets of all data messages per msg_id, of all ADD_LOGGED_MSG messages and of the
+ * messages that are handled in between data messages (parameter changes and dropouts).
+ * All offsets point to the start of the message header, in file order.
+ */
+class ULogMappedFile
+{
+public:
+	ULogMappedFile() = default;
+	~ULogMappedFile() { close(); }
+
+	ULogMappedFile(const ULogMappedFile &) = delete;
+	ULogMappedFile &operator=(const ULogMappedFile &) = delete;
+
+	/**
+	 * map a file
+	 * @return true on success
+	 */
+	bool open(const char *file_name);
+
+	void close();
+
+	/**
+	 * Index all messages in [start, end). Parsing stops at the first incomplete message.
+	 * @return number of indexed data messages
+	 */
+	size_t buildIndex(uint64_t start, uint64_t end);
+
+	size_t size() const { return _size; }
+
+	/** message header at offset (must be a message start returned by the index) */
+	ulog_message_header_s header(uint64_t offset) const
+	{
+		ulog_message_header_s message_header;
+		memcpy(&message_header, _data + offset, ULOG_MSG_HEADER_LEN);
+		return message_header;
+	}
+
+	/** pointer to the message content following the header */
+	const uint8_t *payload(uint64_t offset) const { return _data + offset + ULOG_MSG_HEADER_LEN; }
+
+	const std::vector<uint64_t> &dataMessages(uint16_t msg_id) const
+	{
+		return (msg_id < _data_messages.size()) ? _data_messages[msg_id] : _empty;
+	}
+
+	const std::vector<uint64_t> &subscriptionMessages() const { return _subscription_messages; }
+	const std::vector<uint64_t> &additionalMessages() const { return _additional_messages; }
+
+private:
+	const uint8_t *_data{nullptr};
+	size_t _size{0};
+
+	std::vector<std::vector<uint64_t>> _data_messages; ///< DATA message offsets per msg_id
+	std::vector<uint64_t> _subscription_messages; ///< ADD_LOGGED_MSG offsets
+	std::vector<uint64_t> _additional_messages; ///< PARAMETER and DROPOUT offsets
+
+	static const std::vector<uint64_t> _empty;
+};
+
+} // namespace px4
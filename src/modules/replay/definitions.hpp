@@ -40,6 +40,8 @@ namespace replay
 
 static const char __attribute__((unused)) *ENV_FILENAME = "replay"; ///< name for getenv()
 static const char __attribute__((unused)) *ENV_MODE = "replay_mode";  ///< name for getenv()
+static const char __attribute__((unused)) *ENV_START_TIME = "replay_start";  ///< name for getenv()
+static const char __attribute__((unused)) *ENV_BENCH_REPORT = "replay_bench";  ///< name for getenv()
 
 
 } //namespace replay
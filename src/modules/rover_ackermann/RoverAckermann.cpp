@@ -45,7 +45,23 @@ RoverAckermann::RoverAckermann() :
 
 bool RoverAckermann::init()
 {
-	ScheduleOnInterval(10_ms); // 100 Hz
+	// run on estimator updates instead of a fixed interval to minimize the steering latency
+	_vehicle_angular_velocity_sub.set_interval_us(CONTROL_INTERVAL_MIN);
+
+	if (!_vehicle_angular_velocity_sub.registerCallback()) {
+		PX4_ERR("callback registration failed");
+		return false;
+	}
+
+	if (!_vehicle_local_position_sub.registerCallback()) {
+		PX4_ERR("callback registration failed");
+		return false;
+	}
+
+#ifndef ENABLE_LOCKSTEP_SCHEDULER // Backup schedule would interfere with lockstep
+	ScheduleDelayed(CONTROL_INTERVAL_BACKUP);
+#endif
+
 	return true;
 }
 
@@ -57,10 +73,24 @@ void RoverAckermann::updateParams()
 void RoverAckermann::Run()
 {
 	if (should_exit()) {
+		_vehicle_angular_velocity_sub.unregisterCallback();
+		_vehicle_local_position_sub.unregisterCallback();
 		ScheduleClear();
 		exit_and_cleanup();
+		return;
 	}
 
+#ifndef ENABLE_LOCKSTEP_SCHEDULER // Backup schedule would interfere with lockstep
+	ScheduleDelayed(CONTROL_INTERVAL_BACKUP);
+#endif
+
+	// clear the trigger updates, the guidance copies the latest data itself
+	vehicle_angular_velocity_s vehicle_angular_velocity;
+	_vehicle_angular_velocity_sub.update(&vehicle_angular_velocity);
+
+	vehicle_local_position_s vehicle_local_position;
+	_vehicle_local_position_sub.update(&vehicle_local_position);
+
 	// uORB subscriber updates
 	if (_parameter_update_sub.updated()) {
 		updateParams();
@@ -44,11 +44,14 @@
 #include <uORB/Publication.hpp>
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
 #include <uORB/topics/manual_control_setpoint.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/vehicle_status.h>
 #include <uORB/topics/actuator_motors.h>
 #include <uORB/topics/actuator_servos.h>
+#include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_local_position.h>
 
 // Standard library includes
 #include <math.h>
@@ -85,6 +88,13 @@ protected:
 private:
 	void Run() override;
 
+	static constexpr hrt_abstime CONTROL_INTERVAL_MIN{2500}; // 400 Hz maximum rate of the estimator triggered loop
+	static constexpr hrt_abstime CONTROL_INTERVAL_BACKUP{100_ms}; // keep running without estimator updates
+
+	// uORB subscriptions triggering the control loop
+	uORB::SubscriptionCallbackWorkItem _vehicle_angular_velocity_sub{this, ORB_ID(vehicle_angular_velocity)};
+	uORB::SubscriptionCallbackWorkItem _vehicle_local_position_sub{this, ORB_ID(vehicle_local_position)};
+
 	// uORB subscriptions
 	uORB::Subscription _manual_control_setpoint_sub{ORB_ID(manual_control_setpoint)};
 	uORB::Subscription _parameter_update_sub{ORB_ID(parameter_update)};
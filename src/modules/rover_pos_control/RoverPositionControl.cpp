@@ -479,23 +479,64 @@ RoverPositionControl::Run()
 		    _control_mode.flag_control_position_enabled ||
 		    _control_mode.flag_control_manual_enabled) {
 
-			vehicle_thrust_setpoint_s v_thrust_sp{};
-			v_thrust_sp.timestamp = hrt_absolute_time();
-			v_thrust_sp.xyz[0] = _throttle_control;
-			v_thrust_sp.xyz[1] = 0.0f;
-			v_thrust_sp.xyz[2] = 0.0f;
-			_vehicle_thrust_setpoint_pub.publish(v_thrust_sp);
-
-			vehicle_torque_setpoint_s v_torque_sp{};
-			v_torque_sp.timestamp = hrt_absolute_time();
-			v_torque_sp.xyz[0] = 0.f;
-			v_torque_sp.xyz[1] = 0.f;
-			v_torque_sp.xyz[2] = _yaw_control;
-			_vehicle_torque_setpoint_pub.publish(v_torque_sp);
+			publish_control(angular_velocity.timestamp_sample);
 		}
 	}
 }
 
+void
+RoverPositionControl::publish_control(const hrt_abstime &timestamp_sample)
+{
+	if (_param_fused_alloc.get()) {
+		// allocate in this loop instead of waiting for the control allocator to be scheduled
+		float motor = NAN;
+		float servo = 0.f;
+		ActuatorEffectivenessRoverAckermann::allocateDirect(_throttle_control, _yaw_control, _param_r_rev.get() & 1,
+				motor, servo);
+
+		const hrt_abstime now = hrt_absolute_time();
+
+		actuator_motors_s actuator_motors{};
+		actuator_motors.timestamp_sample = timestamp_sample;
+		actuator_motors.reversible_flags = _param_r_rev.get();
+		actuator_motors.control[0] = motor;
+
+		for (int i = 1; i < actuator_motors_s::NUM_CONTROLS; i++) {
+			actuator_motors.control[i] = NAN;
+		}
+
+		actuator_motors.timestamp = now;
+		_actuator_motors_pub.publish(actuator_motors);
+
+		actuator_servos_s actuator_servos{};
+		actuator_servos.timestamp_sample = timestamp_sample;
+		actuator_servos.control[0] = servo;
+
+		for (int i = 1; i < actuator_servos_s::NUM_CONTROLS; i++) {
+			actuator_servos.control[i] = NAN;
+		}
+
+		actuator_servos.timestamp = now;
+		_actuator_servos_pub.publish(actuator_servos);
+
+		return;
+	}
+
+	vehicle_thrust_setpoint_s v_thrust_sp{};
+	v_thrust_sp.timestamp = hrt_absolute_time();
+	v_thrust_sp.xyz[0] = _throttle_control;
+	v_thrust_sp.xyz[1] = 0.0f;
+	v_thrust_sp.xyz[2] = 0.0f;
+	_vehicle_thrust_setpoint_pub.publish(v_thrust_sp);
+
+	vehicle_torque_setpoint_s v_torque_sp{};
+	v_torque_sp.timestamp = hrt_absolute_time();
+	v_torque_sp.xyz[0] = 0.f;
+	v_torque_sp.xyz[1] = 0.f;
+	v_torque_sp.xyz[2] = _yaw_control;
+	_vehicle_torque_setpoint_pub.publish(v_torque_sp);
+}
+
 int RoverPositionControl::task_spawn(int argc, char *argv[])
 {
 	RoverPositionControl *instance = new RoverPositionControl();
@@ -43,6 +43,8 @@
 
 #include <float.h>
 
+#include <ActuatorEffectivenessRoverAckermann.hpp>
+
 #include <drivers/drv_hrt.h>
 #include <lib/geo/geo.h>
 #include <lib/l1/ECL_L1_Pos_Controller.hpp>
@@ -60,6 +62,9 @@
 #include <uORB/SubscriptionCallback.hpp>
 #include <uORB/SubscriptionInterval.hpp>
 #include <uORB/Publication.hpp>
+#include <uORB/PublicationMulti.hpp>
+#include <uORB/topics/actuator_motors.h>
+#include <uORB/topics/actuator_servos.h>
 #include <uORB/topics/manual_control_setpoint.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/position_controller_status.h>
@@ -128,6 +133,10 @@ private:
 	uORB::Publication<vehicle_thrust_setpoint_s>	_vehicle_thrust_setpoint_pub{ORB_ID(vehicle_thrust_setpoint)};
 	uORB::Publication<vehicle_torque_setpoint_s>	_vehicle_torque_setpoint_pub{ORB_ID(vehicle_torque_setpoint)};
 
+	// fused allocation (GND_FUSED_ALLOC)
+	uORB::PublicationMulti<actuator_motors_s>	_actuator_motors_pub{ORB_ID(actuator_motors)};
+	uORB::Publication<actuator_servos_s>		_actuator_servos_pub{ORB_ID(actuator_servos)};
+
 	uORB::SubscriptionData<vehicle_acceleration_s>		_vehicle_acceleration_sub{ORB_ID(vehicle_acceleration)};
 
 	perf_counter_t	_loop_perf;			/**< loop performance counter */
@@ -192,9 +201,17 @@ private:
 		(ParamFloat<px4::params::GND_WHEEL_BASE>) _param_wheel_base,
 		(ParamFloat<px4::params::GND_MAX_ANG>) _param_max_turn_angle,
 		(ParamFloat<px4::params::GND_MAN_Y_MAX>) _param_gnd_man_y_max,
-		(ParamFloat<px4::params::NAV_LOITER_RAD>) _param_nav_loiter_rad	/**< loiter radius for Rover */
+		(ParamFloat<px4::params::NAV_LOITER_RAD>) _param_nav_loiter_rad,	/**< loiter radius for Rover */
+
+		(ParamBool<px4::params::GND_FUSED_ALLOC>) _param_fused_alloc,
+		(ParamInt<px4::params::CA_R_REV>) _param_r_rev
 	)
 
+	/**
+	 * Publish the throttle and yaw control, to the control allocator or directly to the actuators.
+	 */
+	void		publish_control(const hrt_abstime &timestamp_sample);
+
 	/**
 	 * Update our local parameter cache.
 	 */
@@ -285,3 +285,18 @@ PARAM_DEFINE_FLOAT(GND_MAX_ANG, 0.7854f);
  * @group Rover Position Control
  */
 PARAM_DEFINE_FLOAT(GND_MAN_Y_MAX, 150.0f);
+
+/**
+ * Fused actuator allocation
+ *
+ * If enabled, the controller allocates its throttle and steering outputs
+ * directly to the drive motor and steering servo (Ackermann geometry)
+ * in the same loop, instead of publishing thrust and torque setpoints
+ * to the control allocator. This removes a scheduling step from the
+ * steering path. The control allocator is not started in this case.
+ *
+ * @boolean
+ * @reboot_required true
+ * @group Rover Position Control
+ */
+PARAM_DEFINE_INT32(GND_FUSED_ALLOC, 0);
@@ -75,6 +75,42 @@ public:
 		}
 	}
 
+	/**
+	 * Put a batch of equally spaced raw FIFO samples into the integral.
+	 * The whole batch counts as a single sample towards the reset samples.
+	 *
+	 * @param x		Raw X-axis samples.
+	 * @param y		Raw Y-axis samples.
+	 * @param z		Raw Z-axis samples.
+	 * @param N		Number of samples.
+	 * @param scale		Scale from raw samples to the integrated unit.
+	 * @param dt		Time span of the whole batch in seconds.
+	 */
+	inline void put(const int16_t x[], const int16_t y[], const int16_t z[], const int N, const float scale,
+			const float dt)
+	{
+		if (N <= 0) {
+			return;
+		}
+
+		if ((dt > DT_MIN) && (_integral_dt + dt < DT_MAX)) {
+			const float half_dt_sample = 0.5f * dt / N;
+
+			for (int n = 0; n < N; n++) {
+				const matrix::Vector3f val{x[n] * scale, y[n] * scale, z[n] * scale};
+				_alpha += (val + _last_val) * half_dt_sample;
+				_last_val = val;
+			}
+
+			_integrated_samples++;
+			_integral_dt += dt;
+
+		} else {
+			reset();
+			_last_val = matrix::Vector3f{x[N - 1] * scale, y[N - 1] * scale, z[N - 1] * scale};
+		}
+	}
+
 	/**
 	 * Set reset interval during runtime. This won't reset the integrator.
 	 *
@@ -186,6 +222,63 @@ public:
 		}
 	}
 
+	/**
+	 * Put a batch of equally spaced raw FIFO samples into the integral, applying the
+	 * coning corrections at the full sensor rate.
+	 * The whole batch counts as a single sample towards the reset samples.
+	 *
+	 * @param x		Raw X-axis samples.
+	 * @param y		Raw Y-axis samples.
+	 * @param z		Raw Z-axis samples.
+	 * @param N		Number of samples.
+	 * @param scale		Scale from raw samples to the integrated unit.
+	 * @param dt		Time span of the whole batch in seconds.
+	 */
+	inline void put(const int16_t x[], const int16_t y[], const int16_t z[], const int N, const float scale,
+			const float dt)
+	{
+		if (N <= 0) {
+			return;
+		}
+
+		if ((dt > DT_MIN) && (_integral_dt + dt < DT_MAX)) {
+			const float half_dt_sample = 0.5f * dt / N;
+
+			// the coning terms depend on the previous sample, keep the state local for the whole batch
+			matrix::Vector3f alpha{_alpha};
+			matrix::Vector3f beta{_beta};
+			matrix::Vector3f last_alpha{_last_alpha};
+			matrix::Vector3f last_delta_alpha{_last_delta_alpha};
+			matrix::Vector3f last_val{_last_val};
+
+			for (int n = 0; n < N; n++) {
+				const matrix::Vector3f val{x[n] * scale, y[n] * scale, z[n] * scale};
+				const matrix::Vector3f delta_alpha{(val + last_val) * half_dt_sample};
+				last_val = val;
+
+				// same coning corrections as put() for every sample
+				beta += ((last_alpha + last_delta_alpha * (1.f / 6.f)) % delta_alpha) * 0.5f;
+				last_delta_alpha = delta_alpha;
+				last_alpha = alpha;
+
+				alpha += delta_alpha;
+			}
+
+			_alpha = alpha;
+			_beta = beta;
+			_last_alpha = last_alpha;
+			_last_delta_alpha = last_delta_alpha;
+			_last_val = last_val;
+
+			_integrated_samples++;
+			_integral_dt += dt;
+
+		} else {
+			reset();
+			_last_val = matrix::Vector3f{x[N - 1] * scale, y[N - 1] * scale, z[N - 1] * scale};
+		}
+	}
+
 	void reset()
 	{
 		Integrator::reset();
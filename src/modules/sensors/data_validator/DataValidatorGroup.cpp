@@ -42,105 +42,203 @@
 #include "DataValidatorGroup.hpp"
 
 #include <px4_platform_common/log.h>
+#include <drivers/drv_hrt.h>
+#include <matrix/simd.hpp>
 
 #include <float.h>
 
 DataValidatorGroup::DataValidatorGroup(unsigned siblings)
 {
-
-	DataValidator *next = nullptr;
-	DataValidator *prev = nullptr;
-
 	for (unsigned i = 0; i < siblings; i++) {
-		next = new DataValidator();
-
-		if (i == 0) {
-			_first = next;
-
-		} else {
-			prev->setSibling(next);
-		}
-
-		prev = next;
+		add_new_validator();
 	}
+}
 
-	_last = next;
-
-	if (_first) {
-		_timeout_interval_us = _first->get_timeout();
+bool DataValidatorGroup::add_new_validator()
+{
+	if (_num_validators >= MAX_VALIDATORS) {
+		return false;
 	}
+
+	_value_equal_count_threshold[_num_validators] = VALUE_EQUAL_COUNT_DEFAULT;
+	_num_validators++;
+	return true;
 }
 
-DataValidatorGroup::~DataValidatorGroup()
+void DataValidatorGroup::set_equal_value_threshold(uint32_t threshold)
 {
-	while (_first) {
-		DataValidator *next = _first->sibling();
-		delete (_first);
-		_first = next;
+	for (unsigned i = 0; i < _num_validators; i++) {
+		_value_equal_count_threshold[i] = threshold;
 	}
 }
 
-DataValidator *DataValidatorGroup::add_new_validator()
+void DataValidatorGroup::put(unsigned index, uint64_t timestamp, const float val[3], uint32_t error_count,
+			     uint8_t priority)
 {
+	if (index >= _num_validators) {
+		return;
+	}
+
+	_event_count[index]++;
+
+	if (error_count > _error_count[index]) {
+		_error_density[index] += (error_count - _error_count[index]);
+
+	} else if (_error_density[index] > 0) {
+		_error_density[index]--;
+	}
 
-	DataValidator *validator = new DataValidator();
+	_error_count[index] = error_count;
+	_priority[index] = priority;
 
-	if (!validator) {
-		return nullptr;
+	if ((_time_last[index] != 0) && PX4_ISFINITE(val[0]) && PX4_ISFINITE(val[1]) && PX4_ISFINITE(val[2])) {
+		update_statistics_all_axes(index, val);
+
+	} else {
+		update_statistics(index, val);
 	}
 
-	_last->setSibling(validator);
-	_last = validator;
-	_last->set_timeout(_timeout_interval_us);
-	return _last;
+	_time_last[index] = timestamp;
 }
 
-void DataValidatorGroup::set_timeout(uint32_t timeout_interval_us)
+void DataValidatorGroup::update_statistics(unsigned index, const float val[AXES])
 {
+	const float count_inv = 1.f / _event_count[index];
 
-	DataValidator *next = _first;
+	for (unsigned i = 0; i < AXES; i++) {
+		if (PX4_ISFINITE(val[i])) {
+			if (_time_last[index] == 0) {
+				_mean[index][i] = 0;
+				_lp[index][i] = val[i];
+				_M2[index][i] = 0;
 
-	while (next != nullptr) {
-		next->set_timeout(timeout_interval_us);
-		next = next->sibling();
-	}
+			} else {
+				float lp_val = val[i] - _lp[index][i];
+
+				float delta_val = lp_val - _mean[index][i];
+				_mean[index][i] += delta_val * count_inv;
+				_M2[index][i] += delta_val * (lp_val - _mean[index][i]);
+
+				if (fabsf(_value[index][i] - val[i]) < 0.000001f) {
+					_value_equal_count[index]++;
+
+				} else {
+					_value_equal_count[index] = 0;
+				}
+			}
+
+			// XXX replace with better filter, make it auto-tune to update rate
+			_lp[index][i] = _lp[index][i] * 0.99f + 0.01f * val[i];
 
-	_timeout_interval_us = timeout_interval_us;
+			_value[index][i] = val[i];
+		}
+	}
 }
 
-void DataValidatorGroup::set_equal_value_threshold(uint32_t threshold)
+void DataValidatorGroup::update_statistics_all_axes(unsigned index, const float val[AXES])
 {
+	// equal value count, accumulated over the axes in order
+	for (unsigned i = 0; i < AXES; i++) {
+		if (fabsf(_value[index][i] - val[i]) < 0.000001f) {
+			_value_equal_count[index]++;
+
+		} else {
+			_value_equal_count[index] = 0;
+		}
+	}
+
+	alignas(16) const float v[LANES] {val[0], val[1], val[2], 0.f};
+	const float count_inv = 1.f / _event_count[index];
+
+#if defined(MATRIX_SIMD_ARM) || defined(MATRIX_SIMD_SSE)
+	using namespace matrix::simd;
+
+	const float4 x = load(v);
+	float4 lp = load(_lp[index]);
+	float4 mean = load(_mean[index]);
+
+	const float4 lp_val = sub(x, lp);
+	const float4 delta_val = sub(lp_val, mean);
+	mean = add(mean, mul(delta_val, set1(count_inv)));
 
-	DataValidator *next = _first;
+	store(_M2[index], add(load(_M2[index]), mul(delta_val, sub(lp_val, mean))));
+	store(_mean[index], mean);
 
-	while (next != nullptr) {
-		next->set_equal_value_threshold(threshold);
-		next = next->sibling();
+	lp = add(mul(lp, set1(0.99f)), mul(set1(0.01f), x));
+	store(_lp[index], lp);
+	store(_value[index], x);
+#else
+
+	for (unsigned i = 0; i < LANES; i++) {
+		const float lp_val = v[i] - _lp[index][i];
+		const float delta_val = lp_val - _mean[index][i];
+		_mean[index][i] += delta_val * count_inv;
+		_M2[index][i] += delta_val * (lp_val - _mean[index][i]);
+		_lp[index][i] = _lp[index][i] * 0.99f + 0.01f * v[i];
+		_value[index][i] = v[i];
 	}
+
+#endif
 }
 
-void DataValidatorGroup::put(unsigned index, uint64_t timestamp, const float val[3], uint32_t error_count,
-			     uint8_t priority)
+void DataValidatorGroup::update_confidence(uint64_t timestamp)
 {
+	for (unsigned i = 0; i < _num_validators; i++) {
+		float ret = 1.0f;
+
+		/* check if we have any data */
+		if (_time_last[i] == 0) {
+			_error_mask[i] |= DataValidator::ERROR_FLAG_NO_DATA;
+			ret = 0.0f;
+
+		} else if (timestamp > _time_last[i] + _timeout_interval_us) {
+			/* timed out - that's it */
+			_error_mask[i] |= DataValidator::ERROR_FLAG_TIMEOUT;
+			ret = 0.0f;
+
+		} else if (_value_equal_count[i] > _value_equal_count_threshold[i]) {
+			/* we got the exact same sensor value N times in a row */
+			_error_mask[i] |= DataValidator::ERROR_FLAG_STALE_DATA;
+			ret = 0.0f;
+
+		} else if (_error_count[i] > NORETURN_ERRCOUNT) {
+			/* check error count limit */
+			_error_mask[i] |= DataValidator::ERROR_FLAG_HIGH_ERRCOUNT;
+			ret = 0.0f;
+
+		} else if (_error_density[i] > ERROR_DENSITY_WINDOW) {
+			/* cap error density counter at window size */
+			_error_mask[i] |= DataValidator::ERROR_FLAG_HIGH_ERRDENSITY;
+			_error_density[i] = ERROR_DENSITY_WINDOW;
+		}
 
-	DataValidator *next = _first;
-	unsigned i = 0;
+		/* no critical errors */
+		if (ret > 0.0f) {
+			/* return local error density for last N measurements */
+			ret = 1.0f - (_error_density[i] / ERROR_DENSITY_WINDOW);
 
-	while (next != nullptr) {
-		if (i == index) {
-			next->put(timestamp, val, error_count, priority);
-			break;
+			if (ret > 0.0f) {
+				_error_mask[i] = DataValidator::ERROR_FLAG_NO_ERROR;
+			}
 		}
 
-		next = next->sibling();
-		i++;
+		_confidence[i] = ret;
 	}
 }
 
-float *DataValidatorGroup::get_best(uint64_t timestamp, int *index)
+float DataValidatorGroup::rms(unsigned index, unsigned axis) const
 {
+	if (_event_count[index] < 2) {
+		return 0.f;
+	}
 
-	DataValidator *next = _first;
+	return sqrtf(_M2[index][axis] / (_event_count[index] - 1));
+}
+
+float *DataValidatorGroup::get_best(uint64_t timestamp, int *index)
+{
+	// evaluate all validators once
+	update_confidence(timestamp);
 
 	// XXX This should eventually also include voting
 	int pre_check_best = _curr_best;
@@ -149,35 +247,19 @@ float *DataValidatorGroup::get_best(uint64_t timestamp, int *index)
 	float max_confidence = -1.0f;
 	int max_priority = -1000;
 	int max_index = -1;
-	DataValidator *best = nullptr;
-
-	int i = 0;
 
 	// First find the current selected sensor
-	while (next != nullptr) {
-		if (i == pre_check_best) {
-			const int prio = next->priority();
-			const float confidence = next->confidence(timestamp);
+	if ((pre_check_best >= 0) && (pre_check_best < (int)_num_validators)) {
+		pre_check_prio = _priority[pre_check_best];
+		pre_check_confidence = _confidence[pre_check_best];
 
-			pre_check_prio = prio;
-			pre_check_confidence = confidence;
-
-			max_index = i;
-			max_confidence = confidence;
-			max_priority = prio;
-			best = next;
-			break;
-		}
-
-		next = next->sibling();
-		i++;
+		max_index = pre_check_best;
+		max_confidence = pre_check_confidence;
+		max_priority = pre_check_prio;
 	}
 
-	i = 0;
-	next = _first;
-
-	while (next != nullptr) {
-		float confidence = next->confidence(timestamp);
+	for (unsigned i = 0; i < _num_validators; i++) {
+		const float confidence = _confidence[i];
 
 		/*
 		 * Switch if:
@@ -185,17 +267,13 @@ float *DataValidatorGroup::get_best(uint64_t timestamp, int *index)
 		 * 2) the confidence is less than 1% different and the priority is higher
 		 */
 		if ((((max_confidence < MIN_REGULAR_CONFIDENCE) && (confidence >= MIN_REGULAR_CONFIDENCE)) ||
-		     (confidence > max_confidence && (next->priority() >= max_priority)) ||
-		     (fabsf(confidence - max_confidence) < 0.01f && (next->priority() > max_priority))) &&
+		     (confidence > max_confidence && (_priority[i] >= max_priority)) ||
+		     (fabsf(confidence - max_confidence) < 0.01f && (_priority[i] > max_priority))) &&
 		    (confidence > 0.0f)) {
 			max_index = i;
 			max_confidence = confidence;
-			max_priority = next->priority();
-			best = next;
+			max_priority = _priority[i];
 		}
-
-		next = next->sibling();
-		i++;
 	}
 
 	/* the current best sensor is not matching the previous best sensor,
@@ -210,8 +288,8 @@ float *DataValidatorGroup::get_best(uint64_t timestamp, int *index)
 			true_failsafe = false;
 
 			/* reset error flags, this is likely a hotplug sensor coming online late */
-			if (best != nullptr) {
-				best->reset_state();
+			if (max_index >= 0) {
+				_error_mask[max_index] = DataValidator::ERROR_FLAG_NO_ERROR;
 			}
 		}
 
@@ -238,7 +316,7 @@ float *DataValidatorGroup::get_best(uint64_t timestamp, int *index)
 	}
 
 	*index = max_index;
-	return (best) ? best->value() : nullptr;
+	return (max_index >= 0) ? _value[max_index] : nullptr;
 }
 
 void DataValidatorGroup::print()
@@ -246,14 +324,13 @@ void DataValidatorGroup::print()
 	PX4_INFO_RAW("validator: best: %d, prev best: %d, failsafe: %s (%u events)\n", _curr_best, _prev_best,
 		     (_toggle_count > 0) ? "YES" : "NO", _toggle_count);
 
-	DataValidator *next = _first;
-	unsigned i = 0;
+	update_confidence(hrt_absolute_time());
 
-	while (next != nullptr) {
-		if (next->used()) {
-			uint32_t flags = next->state();
+	for (unsigned i = 0; i < _num_validators; i++) {
+		if (_time_last[i] > 0) {
+			uint32_t flags = _error_mask[i];
 
-			PX4_INFO_RAW("sensor #%u, prio: %d, state:%s%s%s%s%s%s\n", i, next->priority(),
+			PX4_INFO_RAW("sensor #%u, prio: %d, state:%s%s%s%s%s%s\n", i, _priority[i],
 				     ((flags & DataValidator::ERROR_FLAG_NO_DATA) ? " OFF" : ""),
 				     ((flags & DataValidator::ERROR_FLAG_STALE_DATA) ? " STALE" : ""),
 				     ((flags & DataValidator::ERROR_FLAG_TIMEOUT) ? " TOUT" : ""),
@@ -261,27 +338,19 @@ void DataValidatorGroup::print()
 				     ((flags & DataValidator::ERROR_FLAG_HIGH_ERRDENSITY) ? " EDNST" : ""),
 				     ((flags == DataValidator::ERROR_FLAG_NO_ERROR) ? " OK" : ""));
 
-			next->print();
+			for (unsigned axis = 0; axis < AXES; axis++) {
+				PX4_INFO_RAW("\tval: %8.4f, lp: %8.4f mean dev: %8.4f RMS: %8.4f conf: %8.4f\n", (double)_value[i][axis],
+					     (double)_lp[i][axis], (double)_mean[i][axis], (double)rms(i, axis), (double)_confidence[i]);
+			}
 		}
-
-		next = next->sibling();
-		i++;
 	}
 }
 
 int DataValidatorGroup::failover_index()
 {
-	DataValidator *next = _first;
-	unsigned i = 0;
-
-	while (next != nullptr) {
-		if (next->used() && (next->state() != DataValidator::ERROR_FLAG_NO_ERROR) &&
-		    (i == (unsigned)_prev_best)) {
-			return i;
-		}
-
-		next = next->sibling();
-		i++;
+	if ((_prev_best >= 0) && (_prev_best < (int)_num_validators) && (_time_last[_prev_best] > 0)
+	    && (_error_mask[_prev_best] != DataValidator::ERROR_FLAG_NO_ERROR)) {
+		return _prev_best;
 	}
 
 	return -1;
@@ -289,35 +358,14 @@ int DataValidatorGroup::failover_index()
 
 uint32_t DataValidatorGroup::failover_state()
 {
-
-	DataValidator *next = _first;
-	unsigned i = 0;
-
-	while (next != nullptr) {
-		if (next->used() && (next->state() != DataValidator::ERROR_FLAG_NO_ERROR) &&
-		    (i == (unsigned)_prev_best)) {
-			return next->state();
-		}
-
-		next = next->sibling();
-		i++;
-	}
-
-	return DataValidator::ERROR_FLAG_NO_ERROR;
+	const int index = failover_index();
+	return (index >= 0) ? _error_mask[index] : DataValidator::ERROR_FLAG_NO_ERROR;
 }
 
 uint32_t DataValidatorGroup::get_sensor_state(unsigned index)
 {
-	DataValidator *next = _first;
-	unsigned i = 0;
-
-	while (next != nullptr) {
-		if (i == index) {
-			return next->state();
-		}
-
-		next = next->sibling();
-		i++;
+	if (index < _num_validators) {
+		return _error_mask[index];
 	}
 
 	// sensor index not found
@@ -326,16 +374,8 @@ uint32_t DataValidatorGroup::get_sensor_state(unsigned index)
 
 uint8_t DataValidatorGroup::get_sensor_priority(unsigned index)
 {
-	DataValidator *next = _first;
-	unsigned i = 0;
-
-	while (next != nullptr) {
-		if (i == index) {
-			return next->priority();
-		}
-
-		next = next->sibling();
-		i++;
+	if (index < _num_validators) {
+		return _priority[index];
 	}
 
 	// sensor index not found
@@ -43,20 +43,27 @@
 
 #include "DataValidator.hpp"
 
+/**
+ * The state of all validators is stored as structure of arrays, one entry per validator
+ * and one (SIMD) lane per axis. The confidence of all validators is evaluated once per
+ * get_best() call, the RMS values are only computed when printed.
+ */
 class DataValidatorGroup
 {
 public:
+	static constexpr unsigned MAX_VALIDATORS = 4; /**< maximum number of validators (sensor instances) per group */
+
 	/**
-	 * @param siblings initial number of DataValidator's. Must be > 0.
+	 * @param siblings initial number of validators. Must be > 0 and <= MAX_VALIDATORS.
 	 */
 	DataValidatorGroup(unsigned siblings);
-	~DataValidatorGroup();
+	~DataValidatorGroup() = default;
 
 	/**
-	 * Create a new Validator (with index equal to the number of currently existing validators)
-	 * @return the newly created DataValidator or nullptr on error
+	 * Create a new validator (with index equal to the number of currently existing validators)
+	 * @return true on success, false if the group is full
 	 */
-	DataValidator *add_new_validator();
+	bool add_new_validator();
 
 	/**
 	 * Put an item into the validator group.
@@ -111,6 +118,13 @@ public:
 	 */
 	uint8_t get_sensor_priority(unsigned index);
 
+	/**
+	 * Get the last values of the sensor with the specified index
+	 *
+	 * @return		pointer to the values or nullptr if the index is invalid
+	 */
+	float *value(unsigned index) { return (index < _num_validators) ? _value[index] : nullptr; }
+
 	/**
 	 * Print the validator value
 	 *
@@ -122,20 +136,62 @@ public:
 	 *
 	 * @param timeout_interval_us The timeout interval in microseconds
 	 */
-	void set_timeout(uint32_t timeout_interval_us);
+	void set_timeout(uint32_t timeout_interval_us) { _timeout_interval_us = timeout_interval_us; }
 
 	/**
-	 * Set the equal count threshold for the whole group
+	 * Get the timeout value of the group
+	 *
+	 * @return The timeout interval in microseconds
+	 */
+	uint32_t get_timeout() const { return _timeout_interval_us; }
+
+	/**
+	 * Set the equal count threshold for all current validators of the group
 	 *
 	 * @param threshold The number of equal values before considering the sensor stale
 	 */
 	void set_equal_value_threshold(uint32_t threshold);
 
 private:
-	DataValidator *_first{nullptr}; /**< first node in the group */
-	DataValidator *_last{nullptr};  /**< last node in the group */
+	static constexpr unsigned AXES = DataValidator::dimensions;
+	static constexpr unsigned LANES = 4; /**< axes padded to the SIMD width */
 
-	uint32_t _timeout_interval_us{0}; /**< currently set timeout */
+	/**
+	 * Update the statistics of one validator, separately for each axis, skipping non-finite values
+	 */
+	void update_statistics(unsigned index, const float val[AXES]);
+
+	/**
+	 * Update the statistics of one validator, all axes at once
+	 */
+	void update_statistics_all_axes(unsigned index, const float val[AXES]);
+
+	/**
+	 * Evaluate the confidence of all validators (see DataValidator::confidence())
+	 */
+	void update_confidence(uint64_t timestamp);
+
+	float rms(unsigned index, unsigned axis) const;
+
+	unsigned _num_validators{0};
+
+	uint32_t _timeout_interval_us{40000}; /**< interval in which the datastream times out in us */
+
+	// validator state, one entry per validator
+	uint64_t _time_last[MAX_VALIDATORS] {};   /**< last timestamp */
+	uint64_t _event_count[MAX_VALIDATORS] {}; /**< total data counter */
+	uint32_t _error_count[MAX_VALIDATORS] {}; /**< error count */
+	int _error_density[MAX_VALIDATORS] {};    /**< ratio between successful reads and errors */
+	uint32_t _error_mask[MAX_VALIDATORS] {};  /**< sensor error state */
+	unsigned _value_equal_count[MAX_VALIDATORS] {}; /**< equal values in a row */
+	unsigned _value_equal_count_threshold[MAX_VALIDATORS] {}; /**< when to consider an equal count as a problem */
+	uint8_t _priority[MAX_VALIDATORS] {};     /**< sensor nominal priority */
+	float _confidence[MAX_VALIDATORS] {};     /**< confidence of the last get_best() */
+
+	alignas(16) float _mean[MAX_VALIDATORS][LANES] {};  /**< mean of value */
+	alignas(16) float _lp[MAX_VALIDATORS][LANES] {};    /**< low pass value */
+	alignas(16) float _M2[MAX_VALIDATORS][LANES] {};    /**< RMS component value */
+	alignas(16) float _value[MAX_VALIDATORS][LANES] {}; /**< last value */
 
 	int _curr_best{-1}; /**< currently best index */
 	int _prev_best{-1}; /**< the previous best index */
@@ -146,7 +202,11 @@ private:
 
 	static constexpr float MIN_REGULAR_CONFIDENCE = 0.9f;
 
+	static constexpr unsigned NORETURN_ERRCOUNT = 10000; /**< if the error count reaches this value, return sensor as invalid */
+	static constexpr float ERROR_DENSITY_WINDOW = 100.0f; /**< window in measurement counts for errors */
+	static constexpr unsigned VALUE_EQUAL_COUNT_DEFAULT = 100; /**< if the sensor value is the same (accumulated also between axes) this many times, flag it */
+
 	/* we don't want this class to be copied */
-	DataValidatorGroup(const DataValidatorGroup &);
-	DataValidatorGroup operator=(const DataValidatorGroup &);
+	DataValidatorGroup(const DataValidatorGroup &) = delete;
+	DataValidatorGroup operator=(const DataValidatorGroup &) = delete;
 };
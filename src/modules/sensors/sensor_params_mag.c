@@ -93,9 +93,11 @@ PARAM_DEFINE_INT32(SENS_MAG_AUTOROT, 1);
  *
  * Magnetometer data maximum publication rate. This is an upper bound,
  * actual magnetometer data rate is still dependent on the sensor.
+ * Sensors with FIFO (burst) readout contribute all samples of a burst,
+ * but are published at most once per burst.
  *
  * @min 1
- * @max 200
+ * @max 400
  * @group Sensors
  * @unit Hz
  *
@@ -144,6 +144,9 @@ void VehicleAirData::Run()
 
 	bool updated[MAX_SENSOR_COUNT] {};
 
+	const float pressure_sealevel_pa = _param_sens_baro_qnh.get() * 100.f;
+	int voter_sample_count = 0;
+
 	for (int uorb_index = 0; uorb_index < MAX_SENSOR_COUNT; uorb_index++) {
 
 		const bool was_advertised = _advertised[uorb_index];
@@ -194,10 +197,17 @@ void VehicleAirData::Run()
 					// pressure corrected with offset (if available)
 					_calibration[uorb_index].SensorCorrectionsUpdate();
 					const float pressure_corrected = _calibration[uorb_index].Correct(report.pressure);
-					const float pressure_sealevel_pa = _param_sens_baro_qnh.get() * 100.f;
 
-					float data_array[3] {pressure_corrected, report.temperature, getAltitudeFromPressure(pressure_corrected, pressure_sealevel_pa)};
-					_voter.put(uorb_index, report.timestamp, data_array, report.error_count, _priority[uorb_index]);
+					// voted after all instances are drained, with the altitudes converted at once
+					if (voter_sample_count < MAX_VOTER_SAMPLES) {
+						VoterSample &sample = _voter_samples[voter_sample_count];
+						sample.timestamp = report.timestamp;
+						sample.temperature = report.temperature;
+						sample.error_count = report.error_count;
+						sample.uorb_index = uorb_index;
+						_voter_pressure[voter_sample_count] = pressure_corrected;
+						voter_sample_count++;
+					}
 
 					_timestamp_sample_sum[uorb_index] += report.timestamp_sample;
 					_data_sum[uorb_index] += pressure_corrected;
@@ -212,6 +222,16 @@ void VehicleAirData::Run()
 		}
 	}
 
+	if (voter_sample_count > 0) {
+		getAltitudeFromPressure(_voter_pressure, _voter_altitude, voter_sample_count, pressure_sealevel_pa);
+
+		for (int i = 0; i < voter_sample_count; i++) {
+			const VoterSample &sample = _voter_samples[i];
+			float data_array[3] {_voter_pressure[i], sample.temperature, _voter_altitude[i]};
+			_voter.put(sample.uorb_index, sample.timestamp, data_array, sample.error_count, _priority[sample.uorb_index]);
+		}
+	}
+
 	// check for the current best sensor
 	int best_index = 0;
 	_voter.get_best(time_now_us, &best_index);
@@ -257,7 +277,6 @@ void VehicleAirData::Run()
 						const float pressure_pa = _data_sum[instance] / _data_sum_count[instance];
 						const float temperature = _temperature_sum[instance] / _data_sum_count[instance];
 
-						const float pressure_sealevel_pa = _param_sens_baro_qnh.get() * 100.f;
 						const float altitude = getAltitudeFromPressure(pressure_pa, pressure_sealevel_pa);
 
 						// calculate air density
@@ -117,6 +117,20 @@ private:
 
 	float _sensor_diff[MAX_SENSOR_COUNT] {}; // filtered differences between sensor instances
 
+	// reports of all instances drained in one cycle, voted after the batched altitude conversion
+	static constexpr int MAX_VOTER_SAMPLES = MAX_SENSOR_COUNT * sensor_baro_s::ORB_QUEUE_LENGTH;
+
+	struct VoterSample {
+		hrt_abstime timestamp;
+		float temperature;
+		uint32_t error_count;
+		int uorb_index;
+	};
+
+	VoterSample _voter_samples[MAX_VOTER_SAMPLES] {};
+	float _voter_pressure[MAX_VOTER_SAMPLES] {};
+	float _voter_altitude[MAX_VOTER_SAMPLES] {};
+
 	uint8_t _priority[MAX_SENSOR_COUNT] {};
 
 	int8_t _selected_sensor_sub_index{-1};
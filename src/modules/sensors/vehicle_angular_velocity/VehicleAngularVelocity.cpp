@@ -56,6 +56,7 @@ VehicleAngularVelocity::~VehicleAngularVelocity()
 	perf_free(_cycle_perf);
 	perf_free(_filter_reset_perf);
 	perf_free(_selection_changed_perf);
+	perf_free(_latency_perf);
 
 #if !defined(CONSTRAINED_FLASH)
 	delete[] _dynamic_notch_filter_esc_rpm;
@@ -198,6 +199,7 @@ void VehicleAngularVelocity::ResetFilters(const hrt_abstime &time_now_us)
 
 		_angular_velocity_raw_prev = angular_velocity_uncalibrated;
 
+		_substeps.samples = 0;
 		_reset_filters = false;
 		perf_count(_filter_reset_perf);
 	}
@@ -722,8 +724,11 @@ void VehicleAngularVelocity::UpdateDynamicNotchFFT(const hrt_abstime &time_now_u
 #endif // !CONSTRAINED_FLASH
 }
 
-float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int N)
+Vector3f VehicleAngularVelocity::FilterAngularVelocity(float *const data[3], int N)
 {
+	// all axes are filtered at once by the same cascade of filters
+	_filter_bank.load(data, N);
+
 #if !defined(CONSTRAINED_FLASH)
 
 	// Apply dynamic notch filter from ESC RPM
@@ -731,9 +736,9 @@ float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int
 		for (int esc = 0; esc < MAX_NUM_ESCS; esc++) {
 			if (_esc_available[esc]) {
 				for (int harmonic = 0; harmonic < _esc_rpm_harmonics; harmonic++) {
-					if (_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].getNotchFreq() > 0.f) {
-						_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].applyArray(data, N);
-					}
+					_filter_bank.apply(_dynamic_notch_filter_esc_rpm[harmonic][0][esc],
+							   _dynamic_notch_filter_esc_rpm[harmonic][1][esc],
+							   _dynamic_notch_filter_esc_rpm[harmonic][2][esc]);
 				}
 			}
 		}
@@ -742,32 +747,31 @@ float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int
 	// Apply dynamic notch filter from FFT
 	if (_dynamic_notch_fft_available) {
 		for (int peak = MAX_NUM_FFT_PEAKS - 1; peak >= 0; peak--) {
-			if (_dynamic_notch_filter_fft[axis][peak].getNotchFreq() > 0.f) {
-				_dynamic_notch_filter_fft[axis][peak].applyArray(data, N);
-			}
+			_filter_bank.apply(_dynamic_notch_filter_fft[0][peak], _dynamic_notch_filter_fft[1][peak],
+					   _dynamic_notch_filter_fft[2][peak]);
 		}
 	}
 
 #endif // !CONSTRAINED_FLASH
 
 	// Apply general notch filter 0 (IMU_GYRO_NF0_FRQ)
-	if (_notch_filter0_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter0_velocity[axis].applyArray(data, N);
-	}
+	_filter_bank.apply(_notch_filter0_velocity[0], _notch_filter0_velocity[1], _notch_filter0_velocity[2]);
 
 	// Apply general notch filter 1 (IMU_GYRO_NF1_FRQ)
-	if (_notch_filter1_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter1_velocity[axis].applyArray(data, N);
-	}
+	_filter_bank.apply(_notch_filter1_velocity[0], _notch_filter1_velocity[1], _notch_filter1_velocity[2]);
 
 	// Apply general low-pass filter (IMU_GYRO_CUTOFF)
-	_lp_filter_velocity[axis].applyArray(data, N);
+	math::LowPassFilter2p<float> *const lp_filter_velocity[3] {&_lp_filter_velocity[0], &_lp_filter_velocity[1], &_lp_filter_velocity[2]};
+	_filter_bank.apply(lp_filter_velocity);
+
+	_filter_bank.store(data);
 
 	// return last filtered sample
-	return data[N - 1];
+	return Vector3f{_filter_bank.newest(0), _filter_bank.newest(1), _filter_bank.newest(2)};
 }
 
-float VehicleAngularVelocity::FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N)
+float VehicleAngularVelocity::FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N,
+		float acceleration[])
 {
 	// angular acceleration: Differentiate & apply specific angular acceleration (D-term) low-pass (IMU_DGYRO_CUTOFF)
 	float angular_acceleration_filtered = 0.f;
@@ -776,11 +780,49 @@ float VehicleAngularVelocity::FilterAngularAcceleration(int axis, float inverse_
 		const float angular_acceleration = (data[n] - _angular_velocity_raw_prev(axis)) * inverse_dt_s;
 		angular_acceleration_filtered = _lp_filter_acceleration[axis].update(angular_acceleration);
 		_angular_velocity_raw_prev(axis) = data[n];
+
+		if (acceleration) {
+			acceleration[n] = angular_acceleration_filtered;
+		}
 	}
 
 	return angular_acceleration_filtered;
 }
 
+void VehicleAngularVelocity::AppendSubsteps(float *const data[3], float *const acceleration[3], int N, float dt_s)
+{
+	// keep the newest samples if there are more than fit into a message
+	const int first = math::max(N - SUBSTEPS_MAX, 0);
+	const int keep = math::min((int)_substeps.samples, SUBSTEPS_MAX - (N - first));
+	const int drop = _substeps.samples - keep;
+
+	if (drop > 0) {
+		float *const arrays[6] {_substeps.x, _substeps.y, _substeps.z, _substeps.x_derivative, _substeps.y_derivative, _substeps.z_derivative};
+
+		for (float *array : arrays) {
+			memmove(array, array + drop, keep * sizeof(float));
+		}
+	}
+
+	_substeps.samples = keep;
+	_substeps.dt = dt_s;
+
+	for (int n = first; n < N; n++) {
+		const int i = _substeps.samples++;
+
+		// same corrections as the published angular velocity and acceleration
+		const Vector3f angular_velocity{_calibration.Correct(Vector3f{data[0][n], data[1][n], data[2][n]}) - _bias};
+		const Vector3f angular_acceleration{_calibration.rotation() * Vector3f{acceleration[0][n], acceleration[1][n], acceleration[2][n]}};
+
+		_substeps.x[i] = angular_velocity(0);
+		_substeps.y[i] = angular_velocity(1);
+		_substeps.z[i] = angular_velocity(2);
+		_substeps.x_derivative[i] = angular_acceleration(0);
+		_substeps.y_derivative[i] = angular_acceleration(1);
+		_substeps.z_derivative[i] = angular_acceleration(2);
+	}
+}
+
 void VehicleAngularVelocity::Run()
 {
 	perf_begin(_cycle_perf);
@@ -821,6 +863,13 @@ void VehicleAngularVelocity::Run()
 	UpdateDynamicNotchFFT(time_now_us);
 
 	if (_fifo_available) {
+		// collect all filtered samples if requested (vehicle_angular_velocity_substeps subscribed)
+		_substeps_enabled = _vehicle_angular_velocity_substeps_pub.has_subscribers();
+
+		if (!_substeps_enabled) {
+			_substeps.samples = 0;
+		}
+
 		// process all outstanding fifo messages
 		int sensor_sub_updates = 0;
 		sensor_gyro_fifo_s sensor_fifo_data;
@@ -830,25 +879,39 @@ void VehicleAngularVelocity::Run()
 
 			const float inverse_dt_s = 1e6f / sensor_fifo_data.dt;
 			const int N = sensor_fifo_data.samples;
-			static constexpr int FIFO_SIZE_MAX = sizeof(sensor_fifo_data.x) / sizeof(sensor_fifo_data.x[0]);
-
 			if ((sensor_fifo_data.dt > 0) && (N > 0) && (N <= FIFO_SIZE_MAX)) {
-				Vector3f angular_velocity_uncalibrated;
-				Vector3f angular_acceleration_uncalibrated;
-
 				int16_t *raw_data_array[] {sensor_fifo_data.x, sensor_fifo_data.y, sensor_fifo_data.z};
 
-				for (int axis = 0; axis < 3; axis++) {
-					// copy raw int16 sensor samples to float array for filtering
-					float data[FIFO_SIZE_MAX];
+				// copy raw int16 sensor samples to float array for filtering
+				float data[3][FIFO_SIZE_MAX];
 
+				for (int axis = 0; axis < 3; axis++) {
 					for (int n = 0; n < N; n++) {
-						data[n] = sensor_fifo_data.scale * raw_data_array[axis][n];
+						data[axis][n] = sensor_fifo_data.scale * raw_data_array[axis][n];
+					}
+				}
+
+				float *const data_axes[3] {data[0], data[1], data[2]};
+
+				// save last filtered sample
+				const Vector3f angular_velocity_uncalibrated{FilterAngularVelocity(data_axes, N)};
+				Vector3f angular_acceleration_uncalibrated;
+
+				if (_substeps_enabled) {
+					float acceleration[3][FIFO_SIZE_MAX];
+					float *const acceleration_axes[3] {acceleration[0], acceleration[1], acceleration[2]};
+
+					for (int axis = 0; axis < 3; axis++) {
+						angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data[axis], N,
+								acceleration[axis]);
 					}
 
-					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data, N);
-					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data, N);
+					AppendSubsteps(data_axes, acceleration_axes, N, sensor_fifo_data.dt * 1e-6f);
+
+				} else {
+					for (int axis = 0; axis < 3; axis++) {
+						angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data[axis], N);
+					}
 				}
 
 				// Publish
@@ -882,18 +945,16 @@ void VehicleAngularVelocity::Run()
 							   0.00002f, 0.02f);
 				_timestamp_sample_last = sensor_data.timestamp_sample;
 
-				Vector3f angular_velocity_uncalibrated;
-				Vector3f angular_acceleration_uncalibrated;
+				// copy sensor sample to float array for filtering
+				float data[3][1] {{sensor_data.x}, {sensor_data.y}, {sensor_data.z}};
+				float *const data_axes[3] {data[0], data[1], data[2]};
 
-				float raw_data_array[] {sensor_data.x, sensor_data.y, sensor_data.z};
+				// save last filtered sample
+				const Vector3f angular_velocity_uncalibrated{FilterAngularVelocity(data_axes)};
+				Vector3f angular_acceleration_uncalibrated;
 
 				for (int axis = 0; axis < 3; axis++) {
-					// copy sensor sample to float array for filtering
-					float data[1] {raw_data_array[axis]};
-
-					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data);
-					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data);
+					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data[axis]);
 				}
 
 				// Publish
@@ -937,8 +998,19 @@ bool VehicleAngularVelocity::CalibrateAndPublish(const hrt_abstime &timestamp_sa
 		_angular_acceleration.copyTo(angular_velocity.xyz_derivative);
 
 		angular_velocity.timestamp = hrt_absolute_time();
+
+		// sub-samples first, they are consumed on the vehicle_angular_velocity callback
+		if (_substeps_enabled && (_substeps.samples > 0)) {
+			_substeps.timestamp_sample = timestamp_sample;
+			_substeps.timestamp = angular_velocity.timestamp;
+			_vehicle_angular_velocity_substeps_pub.publish(_substeps);
+			_substeps.samples = 0;
+		}
+
 		_vehicle_angular_velocity_pub.publish(angular_velocity);
 
+		perf_set_elapsed(_latency_perf, angular_velocity.timestamp - timestamp_sample);
+
 		// shift last publish time forward, but don't let it get further behind than the interval
 		_last_publish = math::constrain(_last_publish + _publish_interval_min_us,
 						timestamp_sample - _publish_interval_min_us, timestamp_sample);
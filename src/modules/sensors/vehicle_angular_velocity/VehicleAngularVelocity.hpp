@@ -38,6 +38,7 @@
 #include <lib/mathlib/math/Limits.hpp>
 #include <lib/matrix/matrix/math.hpp>
 #include <lib/mathlib/math/filter/AlphaFilter.hpp>
+#include <lib/mathlib/math/filter/BiquadFilterBank.hpp>
 #include <lib/mathlib/math/filter/LowPassFilter2p.hpp>
 #include <lib/mathlib/math/filter/NotchFilter.hpp>
 #include <px4_platform_common/log.h>
@@ -56,6 +57,7 @@
 #include <uORB/topics/sensor_gyro_fifo.h>
 #include <uORB/topics/sensor_selection.h>
 #include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_angular_velocity_substeps.h>
 
 using namespace time_literals;
 
@@ -78,8 +80,11 @@ private:
 	bool CalibrateAndPublish(const hrt_abstime &timestamp_sample, const matrix::Vector3f &angular_velocity_uncalibrated,
 				 const matrix::Vector3f &angular_acceleration_uncalibrated);
 
-	inline float FilterAngularVelocity(int axis, float data[], int N = 1);
-	inline float FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N = 1);
+	inline matrix::Vector3f FilterAngularVelocity(float *const data[3], int N = 1);
+	inline float FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N = 1,
+					       float acceleration[] = nullptr);
+
+	void AppendSubsteps(float *const data[3], float *const acceleration[3], int N, float dt_s);
 
 	void DisableDynamicNotchEscRpm();
 	void DisableDynamicNotchFFT();
@@ -99,6 +104,7 @@ private:
 	static constexpr int MAX_SENSOR_COUNT = 4;
 
 	uORB::Publication<vehicle_angular_velocity_s>     _vehicle_angular_velocity_pub{ORB_ID(vehicle_angular_velocity)};
+	uORB::Publication<vehicle_angular_velocity_substeps_s> _vehicle_angular_velocity_substeps_pub{ORB_ID(vehicle_angular_velocity_substeps)};
 
 	uORB::Subscription _estimator_selector_status_sub{ORB_ID(estimator_selector_status)};
 	uORB::Subscription _estimator_sensor_bias_sub{ORB_ID(estimator_sensor_bias)};
@@ -129,6 +135,11 @@ private:
 	float _filter_sample_rate_hz{NAN};
 
 	// angular velocity filters
+	static constexpr int FIFO_SIZE_MAX = sizeof(sensor_gyro_fifo_s::x) / sizeof(sensor_gyro_fifo_s::x[0]);
+
+	// runs the angular velocity filters of all axes at once
+	math::BiquadFilterBank<FIFO_SIZE_MAX> _filter_bank{};
+
 	math::LowPassFilter2p<float> _lp_filter_velocity[3] {};
 	math::NotchFilter<float> _notch_filter0_velocity[3] {};
 	math::NotchFilter<float> _notch_filter1_velocity[3] {};
@@ -173,6 +184,12 @@ private:
 
 	uint32_t _selected_sensor_device_id{0};
 
+	// filtered FIFO samples since the last publication, only collected while vehicle_angular_velocity_substeps has subscribers
+	static constexpr int SUBSTEPS_MAX = sizeof(vehicle_angular_velocity_substeps_s::x) / sizeof(
+			vehicle_angular_velocity_substeps_s::x[0]);
+	vehicle_angular_velocity_substeps_s _substeps{};
+	bool _substeps_enabled{false};
+
 	bool _reset_filters{true};
 	bool _fifo_available{false};
 	bool _update_sample_rate{true};
@@ -180,6 +197,7 @@ private:
 	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": gyro filter")};
 	perf_counter_t _filter_reset_perf{perf_alloc(PC_COUNT, MODULE_NAME": gyro filter reset")};
 	perf_counter_t _selection_changed_perf{perf_alloc(PC_COUNT, MODULE_NAME": gyro selection changed")};
+	perf_counter_t _latency_perf{perf_alloc(PC_HISTOGRAM, PERF_LATENCY_PREFIX "1 vehicle_angular_velocity")};
 
 	DEFINE_PARAMETERS(
 #if !defined(CONSTRAINED_FLASH)
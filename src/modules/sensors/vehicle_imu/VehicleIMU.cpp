@@ -52,6 +52,8 @@ VehicleIMU::VehicleIMU(int instance, uint8_t accel_index, uint8_t gyro_index, co
 	ScheduledWorkItem(MODULE_NAME, config),
 	_sensor_accel_sub(ORB_ID(sensor_accel), accel_index),
 	_sensor_gyro_sub(this, ORB_ID(sensor_gyro), gyro_index),
+	_sensor_accel_fifo_sub(ORB_ID(sensor_accel_fifo), accel_index),
+	_sensor_gyro_fifo_sub(ORB_ID(sensor_gyro_fifo), gyro_index),
 	_instance(instance)
 {
 	_imu_integration_interval_us = 1e6f / _param_imu_integ_rate.get();
@@ -354,7 +356,14 @@ bool VehicleIMU::UpdateAccel()
 
 		const Vector3f accel_raw{accel.x, accel.y, accel.z};
 		_raw_accel_mean.update(accel_raw);
-		_accel_integrator.put(accel_raw, dt);
+
+		if (UpdateFifo(_sensor_accel_fifo_sub, _accel_fifo, accel.device_id, accel.timestamp_sample)) {
+			// integrate every raw sample of the batch instead of the batch average
+			_accel_integrator.put(_accel_fifo.x, _accel_fifo.y, _accel_fifo.z, _accel_fifo.samples, _accel_fifo.scale, dt);
+
+		} else {
+			_accel_integrator.put(accel_raw, dt);
+		}
 
 		updated = true;
 
@@ -483,7 +492,14 @@ bool VehicleIMU::UpdateGyro()
 
 		const Vector3f gyro_raw{gyro.x, gyro.y, gyro.z};
 		_raw_gyro_mean.update(gyro_raw);
-		_gyro_integrator.put(gyro_raw, dt);
+
+		if (UpdateFifo(_sensor_gyro_fifo_sub, _gyro_fifo, gyro.device_id, gyro.timestamp_sample)) {
+			// integrate every raw sample of the batch, coning corrections at the full sensor rate
+			_gyro_integrator.put(_gyro_fifo.x, _gyro_fifo.y, _gyro_fifo.z, _gyro_fifo.samples, _gyro_fifo.scale, dt);
+
+		} else {
+			_gyro_integrator.put(gyro_raw, dt);
+		}
 
 		updated = true;
 
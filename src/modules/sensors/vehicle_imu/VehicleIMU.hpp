@@ -53,7 +53,9 @@
 #include <uORB/topics/estimator_sensor_bias.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_accel.h>
+#include <uORB/topics/sensor_accel_fifo.h>
 #include <uORB/topics/sensor_gyro.h>
+#include <uORB/topics/sensor_gyro_fifo.h>
 #include <uORB/topics/vehicle_control_mode.h>
 #include <uORB/topics/vehicle_imu.h>
 #include <uORB/topics/vehicle_imu_status.h>
@@ -86,6 +88,19 @@ private:
 
 	void UpdateIntegratorConfiguration();
 
+	/**
+	 * Find the FIFO batch a sensor_accel or sensor_gyro sample was averaged from.
+	 * Drivers publish the FIFO right before the averaged sample, older batches are skipped.
+	 */
+	template<typename T>
+	static bool UpdateFifo(uORB::Subscription &sub, T &fifo, uint32_t device_id, hrt_abstime timestamp_sample)
+	{
+		while ((fifo.timestamp_sample < timestamp_sample) && sub.update(&fifo)) {}
+
+		return (fifo.timestamp_sample == timestamp_sample) && (fifo.device_id == device_id)
+		       && (fifo.samples > 0) && (fifo.samples <= (sizeof(fifo.x) / sizeof(fifo.x[0])));
+	}
+
 	inline void UpdateAccelVibrationMetrics(const matrix::Vector3f &acceleration);
 	inline void UpdateGyroVibrationMetrics(const matrix::Vector3f &angular_velocity);
 
@@ -109,6 +124,13 @@ private:
 	uORB::Subscription _sensor_accel_sub;
 	uORB::SubscriptionCallbackWorkItem _sensor_gyro_sub;
 
+	// raw FIFO batches (if published) for full rate integration
+	uORB::Subscription _sensor_accel_fifo_sub;
+	uORB::Subscription _sensor_gyro_fifo_sub;
+
+	sensor_accel_fifo_s _accel_fifo{};
+	sensor_gyro_fifo_s _gyro_fifo{};
+
 	uORB::Subscription _vehicle_control_mode_sub{ORB_ID(vehicle_control_mode)};
 
 	calibration::Accelerometer _accel_calibration{};
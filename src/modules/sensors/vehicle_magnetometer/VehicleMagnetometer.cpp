@@ -415,6 +415,78 @@ void VehicleMagnetometer::UpdatePowerCompensation()
 	}
 }
 
+int8_t VehicleMagnetometer::FindFIFOInstance(uint32_t device_id)
+{
+	// FIFO capable drivers publish sensor_mag_fifo before sensor_mag, the instances don't need to match
+	for (int i = 0; i < MAX_SENSOR_COUNT; i++) {
+		sensor_mag_fifo_s sensor_mag_fifo;
+
+		if (_sensor_fifo_sub[i].copy(&sensor_mag_fifo) && (sensor_mag_fifo.device_id == device_id)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+bool VehicleMagnetometer::UpdateFIFO(int uorb_index)
+{
+	uORB::Subscription &sensor_fifo_sub = _sensor_fifo_sub[_sensor_fifo_index[uorb_index]];
+
+	bool updated = false;
+	int sensor_mag_fifo_updates = 0;
+	sensor_mag_fifo_s sensor_mag_fifo;
+
+	while ((sensor_mag_fifo_updates < sensor_mag_fifo_s::ORB_QUEUE_LENGTH) && sensor_fifo_sub.update(&sensor_mag_fifo)) {
+		sensor_mag_fifo_updates++;
+
+		if (sensor_mag_fifo.device_id != _calibration[uorb_index].device_id()) {
+			// driver restarted, fall back to sensor_mag until the device is seen again
+			_sensor_fifo_index[uorb_index] = -1;
+			break;
+		}
+
+		const int N = math::min((int)sensor_mag_fifo.samples, (int)(sizeof(sensor_mag_fifo.x) / sizeof(sensor_mag_fifo.x[0])));
+
+		if (N == 0) {
+			continue;
+		}
+
+		// the calibration is affine, so it's applied once to the sum of the raw samples of the burst
+		Matrix3f A;
+		Vector3f b;
+		_calibration[uorb_index].CorrectionAffine(A, b);
+		A *= sensor_mag_fifo.scale;
+		b -= _calibration_estimator_bias[uorb_index];
+
+		int32_t sum[3] {};
+
+		for (int n = 0; n < N; n++) {
+			sum[0] += sensor_mag_fifo.x[n];
+			sum[1] += sensor_mag_fifo.y[n];
+			sum[2] += sensor_mag_fifo.z[n];
+		}
+
+		const Vector3f vect_sum{A * Vector3f{(float)sum[0], (float)sum[1], (float)sum[2]} + b * N};
+		const Vector3f vect{vect_sum / N};
+
+		float mag_array[3] {vect(0), vect(1), vect(2)};
+		_voter.put(uorb_index, sensor_mag_fifo.timestamp, mag_array, sensor_mag_fifo.error_count, _priority[uorb_index]);
+
+		// samples are dt apart, the last one at timestamp_sample
+		_timestamp_sample_sum[uorb_index] += N * sensor_mag_fifo.timestamp_sample
+						     - static_cast<hrt_abstime>(0.5f * N * (N - 1) * sensor_mag_fifo.dt);
+		_data_sum[uorb_index] += vect_sum;
+		_data_sum_count[uorb_index] += N;
+
+		_last_data[uorb_index] = A * Vector3f{(float)sensor_mag_fifo.x[N - 1], (float)sensor_mag_fifo.y[N - 1], (float)sensor_mag_fifo.z[N - 1]} + b;
+
+		updated = true;
+	}
+
+	return updated;
+}
+
 void VehicleMagnetometer::Run()
 {
 	perf_begin(_cycle_perf);
@@ -470,6 +542,7 @@ void VehicleMagnetometer::Run()
 				if (_calibration[uorb_index].device_id() != report.device_id) {
 					_calibration[uorb_index].set_device_id(report.device_id);
 					_priority[uorb_index] = _calibration[uorb_index].priority();
+					_sensor_fifo_index[uorb_index] = FindFIFOInstance(report.device_id);
 				}
 
 				if (_calibration[uorb_index].enabled()) {
@@ -489,6 +562,11 @@ void VehicleMagnetometer::Run()
 						ParametersUpdate(true);
 					}
 
+					if (_sensor_fifo_index[uorb_index] >= 0) {
+						// the samples of the burst are taken from sensor_mag_fifo below
+						continue;
+					}
+
 					const Vector3f vect{_calibration[uorb_index].Correct(Vector3f{report.x, report.y, report.z}) - _calibration_estimator_bias[uorb_index]};
 
 					float mag_array[3] {vect(0), vect(1), vect(2)};
@@ -503,6 +581,12 @@ void VehicleMagnetometer::Run()
 					updated[uorb_index] = true;
 				}
 			}
+
+			if ((_sensor_fifo_index[uorb_index] >= 0) && _calibration[uorb_index].enabled()) {
+				if (UpdateFIFO(uorb_index)) {
+					updated[uorb_index] = true;
+				}
+			}
 		}
 	}
 
@@ -55,6 +55,7 @@
 #include <uORB/topics/magnetometer_bias_estimate.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_mag.h>
+#include <uORB/topics/sensor_mag_fifo.h>
 #include <uORB/topics/sensor_preflight_mag.h>
 #include <uORB/topics/sensors_status.h>
 #include <uORB/topics/vehicle_control_mode.h>
@@ -95,6 +96,9 @@ private:
 	void UpdateMagCalibration();
 	void UpdatePowerCompensation();
 
+	int8_t FindFIFOInstance(uint32_t device_id);
+	bool UpdateFIFO(int uorb_index);
+
 	static constexpr int MAX_SENSOR_COUNT = 4;
 
 	uORB::Publication<sensors_status_s> _sensors_status_mag_pub{ORB_ID(sensors_status_mag)};
@@ -133,6 +137,16 @@ private:
 		{this, ORB_ID(sensor_mag), 3}
 	};
 
+	// bursts of FIFO capable drivers, used instead of the sensor_mag averages when available
+	uORB::Subscription _sensor_fifo_sub[MAX_SENSOR_COUNT] {
+		{ORB_ID(sensor_mag_fifo), 0},
+		{ORB_ID(sensor_mag_fifo), 1},
+		{ORB_ID(sensor_mag_fifo), 2},
+		{ORB_ID(sensor_mag_fifo), 3}
+	};
+
+	int8_t _sensor_fifo_index[MAX_SENSOR_COUNT] {-1, -1, -1, -1}; // sensor_mag_fifo instance of each sensor_mag instance
+
 	hrt_abstime _last_calibration_update{0};
 
 	matrix::Vector3f _calibration_estimator_bias[MAX_SENSOR_COUNT] {};
@@ -0,0 +1,138 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file DeltaAngleBuffer.hpp
+ *
+ * Time indexed buffer of gyro delta angle blocks. Each block holds the delta angle
+ * integrated over (time_us - dt_us, time_us]. The integral over an arbitrary interval is
+ * obtained by summing the covered blocks and linearly apportioning partially covered ones.
+ */
+
+#pragma once
+
+#include <lib/matrix/matrix/math.hpp>
+#include <stdint.h>
+
+template <size_t SIZE>
+class DeltaAngleBuffer
+{
+public:
+	void reset()
+	{
+		_head = 0;
+		_count = 0;
+	}
+
+	void push(uint64_t time_us, uint32_t dt_us, const matrix::Vector3f &delta_angle)
+	{
+		if (dt_us == 0) {
+			return;
+		}
+
+		if ((_count > 0) && (time_us <= _buffer[_head].time_us)) {
+			// time going backwards or duplicate data, start over
+			reset();
+		}
+
+		_head = (_count == 0) ? 0 : (_head + 1) % SIZE;
+		_buffer[_head] = block{time_us, dt_us, delta_angle};
+
+		if (_count < SIZE) {
+			_count++;
+		}
+	}
+
+	/**
+	 * Integrate delta angle over (start_us, end_us].
+	 *
+	 * @param start_us start of the interval (exclusive)
+	 * @param end_us end of the interval (inclusive)
+	 * @param delta_angle integrated delta angle (rad)
+	 * @return time covered by buffered data in microseconds
+	 */
+	uint32_t integrate(uint64_t start_us, uint64_t end_us, matrix::Vector3f &delta_angle) const
+	{
+		delta_angle.zero();
+		uint32_t covered_us = 0;
+
+		if (end_us <= start_us) {
+			return 0;
+		}
+
+		// walk back from the newest block until the interval start is reached
+		for (size_t i = 0; i < _count; i++) {
+			const block &b = _buffer[(_head + SIZE - i) % SIZE];
+			const uint64_t block_start = (b.time_us > b.dt_us) ? b.time_us - b.dt_us : 0;
+
+			if (b.time_us <= start_us) {
+				break;
+			}
+
+			if (block_start >= end_us) {
+				continue;
+			}
+
+			const uint64_t overlap_start = (block_start > start_us) ? block_start : start_us;
+			const uint64_t overlap_end = (b.time_us < end_us) ? b.time_us : end_us;
+			const uint32_t overlap_us = static_cast<uint32_t>(overlap_end - overlap_start);
+
+			if (overlap_us == b.dt_us) {
+				delta_angle += b.delta_angle;
+
+			} else {
+				delta_angle += b.delta_angle * (static_cast<float>(overlap_us) / static_cast<float>(b.dt_us));
+			}
+
+			covered_us += overlap_us;
+		}
+
+		return covered_us;
+	}
+
+	uint64_t newest_time_us() const { return (_count > 0) ? _buffer[_head].time_us : 0; }
+
+	size_t entries() const { return _count; }
+
+private:
+	struct block {
+		uint64_t time_us;
+		uint32_t dt_us;
+		matrix::Vector3f delta_angle;
+	};
+
+	block _buffer[SIZE] {};
+
+	size_t _head{0};
+	size_t _count{0};
+};
@@ -48,8 +48,6 @@ VehicleOpticalFlow::VehicleOpticalFlow() :
 	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::nav_and_controllers)
 {
 	_vehicle_optical_flow_pub.advertise();
-
-	_gyro_integrator.set_reset_samples(1);
 }
 
 VehicleOpticalFlow::~VehicleOpticalFlow()
@@ -78,6 +76,7 @@ void VehicleOpticalFlow::Stop()
 	// clear all registered callbacks
 	_sensor_flow_sub.unregisterCallback();
 	_sensor_gyro_sub.unregisterCallback();
+	_sensor_gyro_fifo_sub.unregisterCallback();
 	_sensor_selection_sub.unregisterCallback();
 }
 
@@ -121,9 +120,6 @@ void VehicleOpticalFlow::Run()
 		}
 
 
-		const hrt_abstime timestamp_oldest = sensor_optical_flow.timestamp_sample - sensor_optical_flow.integration_timespan_us;
-		const hrt_abstime timestamp_newest = sensor_optical_flow.timestamp;
-
 		// delta angle
 		//  - from sensor_optical_flow if available, otherwise use synchronized sensor_gyro if available
 		if (sensor_optical_flow.delta_angle_available && Vector2f(sensor_optical_flow.delta_angle).isAllFinite()) {
@@ -145,30 +141,19 @@ void VehicleOpticalFlow::Run()
 		} else {
 			_delta_angle_available = false;
 
-			// integrate synchronized gyro
-			gyroSample gyro_sample;
-
-			while (_gyro_buffer.pop_oldest(timestamp_oldest, timestamp_newest, &gyro_sample)) {
-
-				_gyro_integrator.put(gyro_sample.data, gyro_sample.dt);
-
-				float min_interval_s = (sensor_optical_flow.integration_timespan_us * 1e-6f) * 0.99f;
-
-				if (_gyro_integrator.integral_dt() > min_interval_s) {
-					//PX4_INFO("integral dt: %.6f, min interval: %.6f", (double)_gyro_integrator.integral_dt(),(double) min_interval_s);
-					break;
-				}
-			}
+			// integrate buffered gyro over the exact flow integration interval
+			const uint32_t timespan_us = sensor_optical_flow.integration_timespan_us;
+			const hrt_abstime timestamp_oldest = sensor_optical_flow.timestamp_sample - timespan_us;
 
-			Vector3f delta_angle{NAN, NAN, NAN};
-			uint16_t delta_angle_dt;
+			Vector3f delta_angle;
+			_gyro_coverage_us = _gyro_buffer.integrate(timestamp_oldest, sensor_optical_flow.timestamp_sample, delta_angle);
 
-			if (_gyro_integrator.reset(delta_angle, delta_angle_dt)) {
+			if (_gyro_coverage_us >= timespan_us * 0.99f) {
 				_delta_angle += delta_angle;
 
-			} else {
-				// force integrator reset
-				_gyro_integrator.reset();
+			} else if (_gyro_coverage_us >= timespan_us / 2) {
+				// gyro hasn't caught up with the end of the interval yet, extrapolate the mean rate
+				_delta_angle += delta_angle * (static_cast<float>(timespan_us) / _gyro_coverage_us);
 			}
 		}
 
@@ -403,33 +388,119 @@ void VehicleOpticalFlow::UpdateDistanceSensor()
 	}
 }
 
+void VehicleOpticalFlow::SelectSensorGyro(uint32_t device_id)
+{
+	// prefer sensor_gyro_fifo to integrate every gyro sample, otherwise fall back to sensor_gyro
+	for (uint8_t i = 0; i < MAX_SENSOR_COUNT; i++) {
+		uORB::SubscriptionData<sensor_gyro_fifo_s> sensor_gyro_fifo_sub{ORB_ID(sensor_gyro_fifo), i};
+
+		if (sensor_gyro_fifo_sub.advertised()
+		    && (sensor_gyro_fifo_sub.get().timestamp != 0)
+		    && (sensor_gyro_fifo_sub.get().device_id == device_id)
+		    && (hrt_elapsed_time(&sensor_gyro_fifo_sub.get().timestamp) < 1_s)) {
+
+			if (_sensor_gyro_fifo_sub.ChangeInstance(i) && _sensor_gyro_fifo_sub.registerCallback()) {
+				_sensor_gyro_fifo_sub.set_required_updates(sensor_gyro_fifo_s::ORB_QUEUE_LENGTH / 2);
+				_sensor_gyro_sub.unregisterCallback();
+
+				if (!_gyro_fifo_available || (_gyro_calibration.device_id() != device_id)) {
+					_gyro_buffer.reset();
+				}
+
+				_gyro_fifo_available = true;
+				_gyro_calibration.set_device_id(device_id);
+				PX4_DEBUG("selecting sensor_gyro_fifo:%" PRIu8 " %" PRIu32, i, device_id);
+				return;
+
+			} else {
+				PX4_ERR("unable to register callback for sensor_gyro_fifo:%" PRIu8 " %" PRIu32, i, device_id);
+			}
+		}
+	}
+
+	for (uint8_t i = 0; i < MAX_SENSOR_COUNT; i++) {
+		uORB::SubscriptionData<sensor_gyro_s> sensor_gyro_sub{ORB_ID(sensor_gyro), i};
+
+		if (sensor_gyro_sub.advertised()
+		    && (sensor_gyro_sub.get().timestamp != 0)
+		    && (sensor_gyro_sub.get().device_id != 0)
+		    && (hrt_elapsed_time(&sensor_gyro_sub.get().timestamp) < 1_s)) {
+
+			if (sensor_gyro_sub.get().device_id == device_id) {
+				if (_sensor_gyro_sub.ChangeInstance(i) && _sensor_gyro_sub.registerCallback()) {
+					_sensor_gyro_sub.set_required_updates(sensor_gyro_s::ORB_QUEUE_LENGTH / 2);
+					_sensor_gyro_fifo_sub.unregisterCallback();
+
+					if (_gyro_fifo_available || (_gyro_calibration.device_id() != device_id)) {
+						_gyro_buffer.reset();
+						_gyro_timestamp_sample_last = 0;
+					}
+
+					_gyro_fifo_available = false;
+					_gyro_calibration.set_device_id(device_id);
+					PX4_DEBUG("selecting sensor_gyro:%" PRIu8 " %" PRIu32, i, device_id);
+					break;
+
+				} else {
+					PX4_ERR("unable to register callback for sensor_gyro:%" PRIu8 " %" PRIu32, i, device_id);
+				}
+			}
+		}
+	}
+}
+
 void VehicleOpticalFlow::UpdateSensorGyro()
 {
 	if (_sensor_selection_sub.updated()) {
 		sensor_selection_s sensor_selection{};
 		_sensor_selection_sub.copy(&sensor_selection);
 
-		for (uint8_t i = 0; i < MAX_SENSOR_COUNT; i++) {
-			uORB::SubscriptionData<sensor_gyro_s> sensor_gyro_sub{ORB_ID(sensor_gyro), i};
+		SelectSensorGyro(sensor_selection.gyro_device_id);
+	}
+
+	if (_gyro_fifo_available) {
+		// split each FIFO message into blocks of at most GYRO_BLOCK_US
+		int fifo_updates = 0;
+		sensor_gyro_fifo_s sensor_gyro_fifo;
+
+		while ((fifo_updates < sensor_gyro_fifo_s::ORB_QUEUE_LENGTH) && _sensor_gyro_fifo_sub.update(&sensor_gyro_fifo)) {
+			fifo_updates++;
+
+			const int N = sensor_gyro_fifo.samples;
+			const int fifo_size = sizeof(sensor_gyro_fifo.x) / sizeof(sensor_gyro_fifo.x[0]);
 
-			if (sensor_gyro_sub.advertised()
-			    && (sensor_gyro_sub.get().timestamp != 0)
-			    && (sensor_gyro_sub.get().device_id != 0)
-			    && (hrt_elapsed_time(&sensor_gyro_sub.get().timestamp) < 1_s)) {
+			if ((sensor_gyro_fifo.dt > 0.f) && (N > 0) && (N <= fifo_size)) {
+				_gyro_calibration.set_device_id(sensor_gyro_fifo.device_id);
+				_gyro_calibration.SensorCorrectionsUpdate();
 
-				if (sensor_gyro_sub.get().device_id == sensor_selection.gyro_device_id) {
-					if (_sensor_gyro_sub.ChangeInstance(i) && _sensor_gyro_sub.registerCallback()) {
+				const int block_samples_max = math::max(static_cast<int>(GYRO_BLOCK_US / sensor_gyro_fifo.dt), 1);
 
-						_gyro_calibration.set_device_id(sensor_gyro_sub.get().device_id);
-						PX4_DEBUG("selecting sensor_gyro:%" PRIu8 " %" PRIu32, i, sensor_gyro_sub.get().device_id);
-						break;
+				for (int n = 0; n < N; n += block_samples_max) {
+					const int n_end = math::min(n + block_samples_max, N);
+					const int block_samples = n_end - n;
 
-					} else {
-						PX4_ERR("unable to register callback for sensor_gyro:%" PRIu8 " %" PRIu32, i, sensor_gyro_sub.get().device_id);
+					Vector3f sum{};
+
+					for (int k = n; k < n_end; k++) {
+						sum += Vector3f{(float)sensor_gyro_fifo.x[k], (float)sensor_gyro_fifo.y[k], (float)sensor_gyro_fifo.z[k]};
 					}
+
+					// the calibration is affine, correcting the block mean is equivalent to correcting every sample
+					const Vector3f angular_velocity = _gyro_calibration.Correct(sum * (sensor_gyro_fifo.scale / block_samples));
+
+					// the last sample of the message is at timestamp_sample, earlier ones are dt apart
+					const hrt_abstime block_end_us = sensor_gyro_fifo.timestamp_sample
+									 - static_cast<hrt_abstime>(roundf((N - n_end) * sensor_gyro_fifo.dt));
+					const float block_dt_us = block_samples * sensor_gyro_fifo.dt;
+
+					_gyro_buffer.push(block_end_us, static_cast<uint32_t>(roundf(block_dt_us)), angular_velocity * (block_dt_us * 1e-6f));
 				}
+
+				_gyro_timestamp_sample_last = sensor_gyro_fifo.timestamp_sample;
 			}
 		}
+
+		return;
 	}
 
 	// buffer
@@ -453,15 +524,16 @@ void VehicleOpticalFlow::UpdateSensorGyro()
 			_gyro_calibration.set_device_id(sensor_gyro.device_id);
 			_gyro_calibration.SensorCorrectionsUpdate();
 
-			const float dt_s = (sensor_gyro.timestamp_sample - _gyro_timestamp_sample_last) * 1e-6f;
-			_gyro_timestamp_sample_last = sensor_gyro.timestamp_sample;
+			if ((_gyro_timestamp_sample_last != 0) && (sensor_gyro.timestamp_sample > _gyro_timestamp_sample_last)) {
+				const uint32_t dt_us = sensor_gyro.timestamp_sample - _gyro_timestamp_sample_last;
 
-			gyroSample gyro_sample;
-			gyro_sample.time_us = sensor_gyro.timestamp_sample;
-			gyro_sample.data = _gyro_calibration.Correct(Vector3f{sensor_gyro.x, sensor_gyro.y, sensor_gyro.z});
-			gyro_sample.dt = dt_s;
+				if (dt_us < SENSOR_TIMEOUT) {
+					const Vector3f angular_velocity = _gyro_calibration.Correct(Vector3f{sensor_gyro.x, sensor_gyro.y, sensor_gyro.z});
+					_gyro_buffer.push(sensor_gyro.timestamp_sample, dt_us, angular_velocity * (dt_us * 1e-6f));
+				}
+			}
 
-			_gyro_buffer.push(gyro_sample);
+			_gyro_timestamp_sample_last = sensor_gyro.timestamp_sample;
 		}
 	}
 }
@@ -479,13 +551,14 @@ void VehicleOpticalFlow::ClearAccumulatedData()
 
 	_quality_sum = 0;
 	_accumulated_count = 0;
-
-	_gyro_integrator.reset();
 }
 
 void VehicleOpticalFlow::PrintStatus()
 {
-
+	if (!_delta_angle_available && (_gyro_calibration.device_id() != 0)) {
+		PX4_INFO_RAW("[vehicle_optical_flow] gyro %" PRIu32 " %s, coverage: %" PRIu32 " us\n", _gyro_calibration.device_id(),
+			     _gyro_fifo_available ? "(FIFO)" : "", _gyro_coverage_us);
+	}
 }
 
 }; // namespace sensors
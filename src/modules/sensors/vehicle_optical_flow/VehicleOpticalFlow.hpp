@@ -34,10 +34,9 @@
 #pragma once
 
 #include "data_validator/DataValidatorGroup.hpp"
+#include "DeltaAngleBuffer.hpp"
 #include "RingBuffer.hpp"
 
-#include <Integrator.hpp>
-
 #include <lib/mathlib/math/Limits.hpp>
 #include <lib/matrix/matrix/math.hpp>
 #include <lib/perf/perf_counter.h>
@@ -53,6 +52,7 @@
 #include <uORB/topics/distance_sensor.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_gyro.h>
+#include <uORB/topics/sensor_gyro_fifo.h>
 #include <uORB/topics/sensor_optical_flow.h>
 #include <uORB/topics/sensor_selection.h>
 #include <uORB/topics/vehicle_attitude.h>
@@ -77,6 +77,7 @@ private:
 	void ClearAccumulatedData();
 	void UpdateDistanceSensor();
 	void UpdateSensorGyro();
+	void SelectSensorGyro(uint32_t device_id);
 
 	void Run() override;
 
@@ -96,11 +97,11 @@ private:
 
 	uORB::SubscriptionCallbackWorkItem _sensor_flow_sub{this, ORB_ID(sensor_optical_flow)};
 	uORB::SubscriptionCallbackWorkItem _sensor_gyro_sub{this, ORB_ID(sensor_gyro)};
+	uORB::SubscriptionCallbackWorkItem _sensor_gyro_fifo_sub{this, ORB_ID(sensor_gyro_fifo)};
 	uORB::SubscriptionCallbackWorkItem _sensor_selection_sub{this, ORB_ID(sensor_selection)};
 
-	sensors::IntegratorConing _gyro_integrator{};
-
 	hrt_abstime _gyro_timestamp_sample_last{0};
+	bool _gyro_fifo_available{false};
 
 	calibration::Gyroscope _gyro_calibration{};
 
@@ -116,24 +117,21 @@ private:
 	uint8_t _distance_sum_count{0};
 	uint16_t _quality_sum{0};
 	uint8_t _accumulated_count{0};
+	uint32_t _gyro_coverage_us{0};
 
 	int _distance_sensor_selected{-1}; // because we can have several distance sensor instances with different orientations
 	hrt_abstime _last_range_sensor_update{0};
 
 	bool _delta_angle_available{false};
 
-	struct gyroSample {
-		uint64_t time_us{}; ///< timestamp of the measurement (uSec)
-		matrix::Vector3f data{};
-		float dt{0.f};
-	};
-
 	struct rangeSample {
 		uint64_t time_us{}; ///< timestamp of the measurement (uSec)
 		float data{};
 	};
 
-	RingBuffer<gyroSample, 32> _gyro_buffer{};
+	// gyro delta angle in blocks of at most GYRO_BLOCK_US, covering the flow integration interval and latency
+	static constexpr uint32_t GYRO_BLOCK_US = 1000;
+	DeltaAngleBuffer<96> _gyro_buffer{};
 	RingBuffer<rangeSample, 5> _range_buffer{};
 
 	DEFINE_PARAMETERS(
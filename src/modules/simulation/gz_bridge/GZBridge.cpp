@@ -64,6 +64,13 @@ GZBridge::~GZBridge()
 	for (auto &sub_topic : _node.SubscribedTopics()) {
 		_node.Unsubscribe(sub_topic);
 	}
+
+	perf_free(_clock_step_perf);
+	perf_free(_imu_callback_perf);
+	perf_free(_imu_publish_perf);
+	perf_free(_imu_queue_full_perf);
+	perf_free(_pose_callback_perf);
+	perf_free(_odometry_callback_perf);
 }
 
 int GZBridge::init()
@@ -375,6 +382,7 @@ bool GZBridge::updateClock(const uint64_t tv_sec, const uint64_t tv_nsec)
 
 	if (px4_clock_settime(CLOCK_MONOTONIC, &ts) == 0) {
 		_world_time_us.store(ts_to_abstime(&ts));
+		perf_count(_clock_step_perf);
 		return true;
 	}
 
@@ -453,14 +461,18 @@ void GZBridge::imuCallback(const gz::msgs::IMU &imu)
 		return;
 	}
 
-	pthread_mutex_lock(&_node_mutex);
+	perf_begin(_imu_callback_perf);
 
 	const uint64_t time_us = (imu.header().stamp().sec() * 1000000) + (imu.header().stamp().nsec() / 1000);
 
+	pthread_mutex_lock(&_node_mutex);
+
 	if (time_us > _world_time_us.load()) {
 		updateClock(imu.header().stamp().sec(), imu.header().stamp().nsec());
 	}
 
+	pthread_mutex_unlock(&_node_mutex);
+
 	// FLU -> FRD
 	static const auto q_FLU_to_FRD = gz::math::Quaterniond(0, 1, 0, 0);
 
@@ -469,47 +481,64 @@ void GZBridge::imuCallback(const gz::msgs::IMU &imu)
 					     imu.linear_acceleration().y(),
 					     imu.linear_acceleration().z()));
 
+	gz::math::Vector3d gyro_b = q_FLU_to_FRD.RotateVector(gz::math::Vector3d(
+					    imu.angular_velocity().x(),
+					    imu.angular_velocity().y(),
+					    imu.angular_velocity().z()));
+
+	// hand the decoded sample over to Run() instead of publishing from the gz-transport thread
+	ImuSample sample{};
+#if defined(ENABLE_LOCKSTEP_SCHEDULER)
+	sample.timestamp_sample = time_us;
+#else
+	sample.timestamp_sample = hrt_absolute_time();
+#endif
+	sample.accel[0] = accel_b.X();
+	sample.accel[1] = accel_b.Y();
+	sample.accel[2] = accel_b.Z();
+	sample.gyro[0] = gyro_b.X();
+	sample.gyro[1] = gyro_b.Y();
+	sample.gyro[2] = gyro_b.Z();
+
+	if (_imu_queue.push(sample)) {
+		ScheduleNow();
+
+	} else {
+		perf_count(_imu_queue_full_perf);
+	}
+
+	perf_end(_imu_callback_perf);
+}
+
+void GZBridge::publishImu(const ImuSample &imu)
+{
 	// publish accel
 	sensor_accel_s sensor_accel{};
+	sensor_accel.timestamp_sample = imu.timestamp_sample;
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
-	sensor_accel.timestamp_sample = time_us;
-	sensor_accel.timestamp = time_us;
+	sensor_accel.timestamp = imu.timestamp_sample;
 #else
-	sensor_accel.timestamp_sample = hrt_absolute_time();
 	sensor_accel.timestamp = hrt_absolute_time();
 #endif
 	sensor_accel.device_id = 1310988; // 1310988: DRV_IMU_DEVTYPE_SIM, BUS: 1, ADDR: 1, TYPE: SIMULATION
-	sensor_accel.x = accel_b.X();
-	sensor_accel.y = accel_b.Y();
-	sensor_accel.z = accel_b.Z();
+	sensor_accel.x = imu.accel[0];
+	sensor_accel.y = imu.accel[1];
+	sensor_accel.z = imu.accel[2];
 	sensor_accel.temperature = NAN;
 	sensor_accel.samples = 1;
 	_sensor_accel_pub.publish(sensor_accel);
 
-
-	gz::math::Vector3d gyro_b = q_FLU_to_FRD.RotateVector(gz::math::Vector3d(
-					    imu.angular_velocity().x(),
-					    imu.angular_velocity().y(),
-					    imu.angular_velocity().z()));
-
 	// publish gyro
 	sensor_gyro_s sensor_gyro{};
-#if defined(ENABLE_LOCKSTEP_SCHEDULER)
-	sensor_gyro.timestamp_sample = time_us;
-	sensor_gyro.timestamp = time_us;
-#else
-	sensor_gyro.timestamp_sample = hrt_absolute_time();
-	sensor_gyro.timestamp = hrt_absolute_time();
-#endif
+	sensor_gyro.timestamp_sample = imu.timestamp_sample;
+	sensor_gyro.timestamp = sensor_accel.timestamp;
 	sensor_gyro.device_id = 1310988; // 1310988: DRV_IMU_DEVTYPE_SIM, BUS: 1, ADDR: 1, TYPE: SIMULATION
-	sensor_gyro.x = gyro_b.X();
-	sensor_gyro.y = gyro_b.Y();
-	sensor_gyro.z = gyro_b.Z();
+	sensor_gyro.x = imu.gyro[0];
+	sensor_gyro.y = imu.gyro[1];
+	sensor_gyro.z = imu.gyro[2];
 	sensor_gyro.temperature = NAN;
 	sensor_gyro.samples = 1;
 	_sensor_gyro_pub.publish(sensor_gyro);
-
-	pthread_mutex_unlock(&_node_mutex);
 }
 
 void GZBridge::poseInfoCallback(const gz::msgs::Pose_V &pose)
@@ -518,6 +547,7 @@ void GZBridge::poseInfoCallback(const gz::msgs::Pose_V &pose)
 		return;
 	}
 
+	perf_begin(_pose_callback_perf);
 	pthread_mutex_lock(&_node_mutex);
 
 	for (int p = 0; p < pose.pose_size(); p++) {
@@ -622,11 +652,13 @@ void GZBridge::poseInfoCallback(const gz::msgs::Pose_V &pose)
 			_lpos_ground_truth_pub.publish(local_position_groundtruth);
 
 			pthread_mutex_unlock(&_node_mutex);
+			perf_end(_pose_callback_perf);
 			return;
 		}
 	}
 
 	pthread_mutex_unlock(&_node_mutex);
+	perf_end(_pose_callback_perf);
 }
 
 void GZBridge::odometryCallback(const gz::msgs::OdometryWithCovariance &odometry)
@@ -635,6 +667,7 @@ void GZBridge::odometryCallback(const gz::msgs::OdometryWithCovariance &odometry
 		return;
 	}
 
+	perf_begin(_odometry_callback_perf);
 	pthread_mutex_lock(&_node_mutex);
 
 	const uint64_t time_us = (odometry.header().stamp().sec() * 1000000) + (odometry.header().stamp().nsec() / 1000);
@@ -703,6 +736,7 @@ void GZBridge::odometryCallback(const gz::msgs::OdometryWithCovariance &odometry
 	_visual_odometry_pub.publish(odom);
 
 	pthread_mutex_unlock(&_node_mutex);
+	perf_end(_odometry_callback_perf);
 }
 
 void GZBridge::navSatCallback(const gz::msgs::NavSat &nav_sat)
@@ -772,7 +806,13 @@ void GZBridge::Run()
 		return;
 	}
 
-	pthread_mutex_lock(&_node_mutex);
+	ImuSample imu;
+
+	while (_imu_queue.pop(imu)) {
+		perf_begin(_imu_publish_perf);
+		publishImu(imu);
+		perf_end(_imu_publish_perf);
+	}
 
 	if (_parameter_update_sub.updated()) {
 		parameter_update_s pupdate;
@@ -786,8 +826,6 @@ void GZBridge::Run()
 	}
 
 	ScheduleDelayed(10_ms);
-
-	pthread_mutex_unlock(&_node_mutex);
 }
 
 int GZBridge::print_status()
@@ -801,6 +839,13 @@ int GZBridge::print_status()
 	PX4_INFO_RAW("Wheel outputs:\n");
 	_mixing_interface_wheel.mixingOutput().printStatus();
 
+	perf_print_counter(_clock_step_perf);
+	perf_print_counter(_imu_callback_perf);
+	perf_print_counter(_imu_publish_perf);
+	perf_print_counter(_imu_queue_full_perf);
+	perf_print_counter(_pose_callback_perf);
+	perf_print_counter(_odometry_callback_perf);
+
 	return 0;
 }
 
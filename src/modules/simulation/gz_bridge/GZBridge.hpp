@@ -37,6 +37,8 @@
 #include "GZMixingInterfaceServo.hpp"
 #include "GZMixingInterfaceWheel.hpp"
 
+#include <containers/SPSCQueue.hpp>
+#include <lib/perf/perf_counter.h>
 #include <px4_platform_common/atomic.h>
 #include <px4_platform_common/defines.h>
 #include <px4_platform_common/module.h>
@@ -107,6 +109,14 @@ private:
 	void odometryCallback(const gz::msgs::OdometryWithCovariance &odometry);
 	void navSatCallback(const gz::msgs::NavSat &nav_sat);
 
+	struct ImuSample {
+		hrt_abstime timestamp_sample;
+		float accel[3];
+		float gyro[3];
+	};
+
+	void publishImu(const ImuSample &imu);
+
 	/**
 	*
 	* Convert a quaterion from FLU_to_ENU frames (ROS convention)
@@ -131,14 +141,24 @@ private:
 	uORB::PublicationMulti<sensor_gyro_s>  _sensor_gyro_pub{ORB_ID(sensor_gyro)};
 	uORB::PublicationMulti<vehicle_odometry_s> _visual_odometry_pub{ORB_ID(vehicle_visual_odometry)};
 
-	GZMixingInterfaceESC   _mixing_interface_esc{_node, _node_mutex};
-	GZMixingInterfaceServo _mixing_interface_servo{_node, _node_mutex};
-	GZMixingInterfaceWheel _mixing_interface_wheel{_node, _node_mutex};
+	GZMixingInterfaceESC   _mixing_interface_esc{_node};
+	GZMixingInterfaceServo _mixing_interface_servo{_node};
+	GZMixingInterfaceWheel _mixing_interface_wheel{_node};
+
+	// IMU samples decoded on the gz-transport thread, published from Run()
+	SPSCQueue<ImuSample, 16> _imu_queue;
 
 	px4::atomic<uint64_t> _world_time_us{0};
 
 	pthread_mutex_t _node_mutex;
 
+	perf_counter_t _clock_step_perf{perf_alloc(PC_INTERVAL, MODULE_NAME": clock step")};
+	perf_counter_t _imu_callback_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": imu callback")};
+	perf_counter_t _imu_publish_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": imu publish")};
+	perf_counter_t _imu_queue_full_perf{perf_alloc(PC_COUNT, MODULE_NAME": imu queue full")};
+	perf_counter_t _pose_callback_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": pose callback")};
+	perf_counter_t _odometry_callback_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": odometry callback")};
+
 	MapProjection _pos_ref{};
 	double _alt_ref{}; // starting altitude reference
 
@@ -75,15 +75,14 @@ bool GZMixingInterfaceESC::updateOutputs(bool stop_motors, uint16_t outputs[MAX_
 	}
 
 	if (active_output_count > 0) {
-		gz::msgs::Actuators rotor_velocity_message;
-		rotor_velocity_message.mutable_velocity()->Resize(active_output_count, 0);
+		_rotor_velocity_message.mutable_velocity()->Resize(active_output_count, 0);
 
 		for (unsigned i = 0; i < active_output_count; i++) {
-			rotor_velocity_message.set_velocity(i, outputs[i]);
+			_rotor_velocity_message.set_velocity(i, outputs[i]);
 		}
 
 		if (_actuators_pub.Valid()) {
-			return _actuators_pub.Publish(rotor_velocity_message);
+			return _actuators_pub.Publish(_rotor_velocity_message);
 		}
 	}
 
@@ -92,10 +91,8 @@ bool GZMixingInterfaceESC::updateOutputs(bool stop_motors, uint16_t outputs[MAX_
 
 void GZMixingInterfaceESC::Run()
 {
-	pthread_mutex_lock(&_node_mutex);
 	_mixing_output.update();
 	_mixing_output.updateSubscriptions(false);
-	pthread_mutex_unlock(&_node_mutex);
 }
 
 void GZMixingInterfaceESC::motorSpeedCallback(const gz::msgs::Actuators &actuators)
@@ -104,8 +101,6 @@ void GZMixingInterfaceESC::motorSpeedCallback(const gz::msgs::Actuators &actuato
 		return;
 	}
 
-	pthread_mutex_lock(&_node_mutex);
-
 	esc_status_s esc_status{};
 	esc_status.esc_count = actuators.velocity_size();
 
@@ -123,6 +118,4 @@ void GZMixingInterfaceESC::motorSpeedCallback(const gz::msgs::Actuators &actuato
 		esc_status.timestamp = hrt_absolute_time();
 		_esc_status_pub.publish(esc_status);
 	}
-
-	pthread_mutex_unlock(&_node_mutex);
 }
@@ -50,10 +50,9 @@ class GZMixingInterfaceESC : public OutputModuleInterface
 public:
 	static constexpr int MAX_ACTUATORS = MixingOutput::MAX_ACTUATORS;
 
-	GZMixingInterfaceESC(gz::transport::Node &node, pthread_mutex_t &node_mutex) :
+	GZMixingInterfaceESC(gz::transport::Node &node) :
 		OutputModuleInterface(MODULE_NAME "-actuators-esc", px4::wq_configurations::rate_ctrl),
-		_node(node),
-		_node_mutex(node_mutex)
+		_node(node)
 	{}
 
 	bool updateOutputs(bool stop_motors, uint16_t outputs[MAX_ACTUATORS],
@@ -77,11 +76,11 @@ private:
 	void motorSpeedCallback(const gz::msgs::Actuators &actuators);
 
 	gz::transport::Node &_node;
-	pthread_mutex_t &_node_mutex;
 
 	MixingOutput _mixing_output{"SIM_GZ_EC", MAX_ACTUATORS, *this, MixingOutput::SchedulingPolicy::Auto, false, false};
 
 	gz::transport::Node::Publisher _actuators_pub;
+	gz::msgs::Actuators _rotor_velocity_message{}; ///< reused for every output update
 
 	uORB::Publication<esc_status_s> _esc_status_pub{ORB_ID(esc_status)};
 
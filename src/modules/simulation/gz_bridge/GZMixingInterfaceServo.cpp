@@ -63,15 +63,14 @@ bool GZMixingInterfaceServo::updateOutputs(bool stop_motors, uint16_t outputs[MA
 
 	for (auto &servo_pub : _servos_pub) {
 		if (_mixing_output.isFunctionSet(i)) {
-			gz::msgs::Double servo_output;
 			///TODO: Normalize output data
 			double output = (outputs[i] - 500) / 500.0;
 			// std::cout << "outputs[" << i << "]: " << outputs[i] << std::endl;
 			// std::cout << "  output: " << output << std::endl;
-			servo_output.set_data(output);
+			_servo_output.set_data(output);
 
 			if (servo_pub.Valid()) {
-				servo_pub.Publish(servo_output);
+				servo_pub.Publish(_servo_output);
 				updated = true;
 			}
 		}
@@ -84,8 +83,6 @@ bool GZMixingInterfaceServo::updateOutputs(bool stop_motors, uint16_t outputs[MA
 
 void GZMixingInterfaceServo::Run()
 {
-	pthread_mutex_lock(&_node_mutex);
 	_mixing_output.update();
 	_mixing_output.updateSubscriptions(false);
-	pthread_mutex_unlock(&_node_mutex);
 }
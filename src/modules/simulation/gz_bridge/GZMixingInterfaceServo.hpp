@@ -43,10 +43,9 @@
 class GZMixingInterfaceServo : public OutputModuleInterface
 {
 public:
-	GZMixingInterfaceServo(gz::transport::Node &node, pthread_mutex_t &node_mutex) :
+	GZMixingInterfaceServo(gz::transport::Node &node) :
 		OutputModuleInterface(MODULE_NAME "-actuators-servo", px4::wq_configurations::rate_ctrl),
-		_node(node),
-		_node_mutex(node_mutex)
+		_node(node)
 	{}
 
 	bool updateOutputs(bool stop_motors, uint16_t outputs[MAX_ACTUATORS],
@@ -68,9 +67,9 @@ private:
 	void Run() override;
 
 	gz::transport::Node &_node;
-	pthread_mutex_t &_node_mutex;
 
 	MixingOutput _mixing_output{"SIM_GZ_SV", MAX_ACTUATORS, *this, MixingOutput::SchedulingPolicy::Auto, false, false};
 
 	std::vector<gz::transport::Node::Publisher> _servos_pub;
+	gz::msgs::Double _servo_output{}; ///< reused for every output update
 };
@@ -73,19 +73,18 @@ bool GZMixingInterfaceWheel::updateOutputs(bool stop_wheels, uint16_t outputs[MA
 	}
 
 	if (active_output_count > 0) {
-		gz::msgs::Actuators wheel_velocity_message;
-		wheel_velocity_message.mutable_velocity()->Resize(active_output_count, 0);
+		_wheel_velocity_message.mutable_velocity()->Resize(active_output_count, 0);
 
 		for (unsigned i = 0; i < active_output_count; i++) {
 			// Offsetting the output allows for negative values despite unsigned integer to reverse the wheels
 			static constexpr double output_offset = 100.0;
 			double scaled_output = (double)outputs[i] - output_offset;
-			wheel_velocity_message.set_velocity(i, scaled_output);
+			_wheel_velocity_message.set_velocity(i, scaled_output);
 		}
 
 
 		if (_actuators_pub.Valid()) {
-			return _actuators_pub.Publish(wheel_velocity_message);
+			return _actuators_pub.Publish(_wheel_velocity_message);
 		}
 	}
 
@@ -94,10 +93,8 @@ bool GZMixingInterfaceWheel::updateOutputs(bool stop_wheels, uint16_t outputs[MA
 
 void GZMixingInterfaceWheel::Run()
 {
-	pthread_mutex_lock(&_node_mutex);
 	_mixing_output.update();
 	_mixing_output.updateSubscriptions(false);
-	pthread_mutex_unlock(&_node_mutex);
 }
 
 void GZMixingInterfaceWheel::wheelSpeedCallback(const gz::msgs::Actuators &actuators)
@@ -106,8 +103,6 @@ void GZMixingInterfaceWheel::wheelSpeedCallback(const gz::msgs::Actuators &actua
 		return;
 	}
 
-	pthread_mutex_lock(&_node_mutex);
-
 	wheel_encoders_s wheel_encoders{};
 
 	for (int i = 0; i < actuators.velocity_size(); i++) {
@@ -118,6 +113,4 @@ void GZMixingInterfaceWheel::wheelSpeedCallback(const gz::msgs::Actuators &actua
 		wheel_encoders.timestamp = hrt_absolute_time();
 		_wheel_encoders_pub.publish(wheel_encoders);
 	}
-
-	pthread_mutex_unlock(&_node_mutex);
 }
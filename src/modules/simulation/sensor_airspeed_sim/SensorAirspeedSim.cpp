@@ -52,7 +52,7 @@ SensorAirspeedSim::~SensorAirspeedSim()
 
 bool SensorAirspeedSim::init()
 {
-	ScheduleOnInterval(125_ms); // 8 Hz
+	ScheduleOnInterval(1_s / math::constrain(_sim_arspd_rate.get(), (int32_t)1, (int32_t)400));
 	return true;
 }
 
@@ -104,6 +104,8 @@ void SensorAirspeedSim::Run()
 		_parameter_update_sub.copy(&param_update);
 
 		updateParams();
+
+		ScheduleOnInterval(1_s / math::constrain(_sim_arspd_rate.get(), (int32_t)1, (int32_t)400));
 	}
 
 	if (_sim_failure.get() == 0) {
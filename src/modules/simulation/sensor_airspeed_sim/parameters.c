@@ -54,3 +54,13 @@ PARAM_DEFINE_INT32(SENS_EN_ARSPDSIM, 0);
  * @value 1 Enabled
   */
 PARAM_DEFINE_INT32(SIM_ARSPD_FAIL, 0);
+
+/**
+ * Simulated airspeed update rate
+ *
+ * @unit Hz
+ * @min 1
+ * @max 400
+ * @group Simulator
+ */
+PARAM_DEFINE_INT32(SIM_ARSPD_RATE, 8);
@@ -51,7 +51,7 @@ SensorBaroSim::~SensorBaroSim()
 
 bool SensorBaroSim::init()
 {
-	ScheduleOnInterval(50_ms); // 20 Hz
+	ScheduleOnInterval(1_s / math::constrain(_sim_baro_rate.get(), (int32_t)1, (int32_t)400));
 	return true;
 }
 
@@ -103,6 +103,8 @@ void SensorBaroSim::Run()
 		_parameter_update_sub.copy(&param_update);
 
 		updateParams();
+
+		ScheduleOnInterval(1_s / math::constrain(_sim_baro_rate.get(), (int32_t)1, (int32_t)400));
 	}
 
 	if (_vehicle_global_position_sub.updated()) {
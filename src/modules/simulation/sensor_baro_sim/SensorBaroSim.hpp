@@ -87,6 +87,7 @@ private:
 
 	DEFINE_PARAMETERS(
 		(ParamFloat<px4::params::SIM_BARO_OFF_P>) _sim_baro_off_p,
-		(ParamFloat<px4::params::SIM_BARO_OFF_T>) _sim_baro_off_t
+		(ParamFloat<px4::params::SIM_BARO_OFF_T>) _sim_baro_off_t,
+		(ParamInt<px4::params::SIM_BARO_RATE>) _sim_baro_rate
 	)
 };
@@ -57,3 +57,13 @@ PARAM_DEFINE_FLOAT(SIM_BARO_OFF_P, 0.0f);
  * @unit celcius
  */
 PARAM_DEFINE_FLOAT(SIM_BARO_OFF_T, 0.0f);
+
+/**
+ * Simulated barometer update rate
+ *
+ * @unit Hz
+ * @min 1
+ * @max 400
+ * @group Simulator
+ */
+PARAM_DEFINE_INT32(SIM_BARO_RATE, 20);
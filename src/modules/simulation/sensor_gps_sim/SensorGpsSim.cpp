@@ -52,7 +52,7 @@ SensorGpsSim::~SensorGpsSim()
 
 bool SensorGpsSim::init()
 {
-	ScheduleOnInterval(125_ms); // 8 Hz
+	ScheduleOnInterval(1_s / math::constrain(_sim_gps_rate.get(), (int32_t)1, (int32_t)400));
 	return true;
 }
 
@@ -104,6 +104,8 @@ void SensorGpsSim::Run()
 		_parameter_update_sub.copy(&param_update);
 
 		updateParams();
+
+		ScheduleOnInterval(1_s / math::constrain(_sim_gps_rate.get(), (int32_t)1, (int32_t)400));
 	}
 
 	if (_vehicle_local_position_sub.updated() && _vehicle_global_position_sub.updated()) {
@@ -50,3 +50,13 @@ PARAM_DEFINE_INT32(SENS_EN_GPSSIM, 0);
  * @group Simulator
  */
 PARAM_DEFINE_INT32(SIM_GPS_USED, 10);
+
+/**
+ * Simulated GPS update rate
+ *
+ * @unit Hz
+ * @min 1
+ * @max 400
+ * @group Simulator
+ */
+PARAM_DEFINE_INT32(SIM_GPS_RATE, 8);
@@ -34,7 +34,6 @@
 #include "SensorMagSim.hpp"
 
 #include <drivers/drv_sensor.h>
-#include <lib/world_magnetic_model/geo_mag_declination.h>
 
 using namespace matrix;
 
@@ -52,7 +51,7 @@ SensorMagSim::~SensorMagSim()
 
 bool SensorMagSim::init()
 {
-	ScheduleOnInterval(20_ms); // 50 Hz
+	ScheduleOnInterval(1_s / math::constrain(_sim_mag_rate.get(), (int32_t)1, (int32_t)400));
 	return true;
 }
 
@@ -104,6 +103,8 @@ void SensorMagSim::Run()
 		_parameter_update_sub.copy(&param_update);
 
 		updateParams();
+
+		ScheduleOnInterval(1_s / math::constrain(_sim_mag_rate.get(), (int32_t)1, (int32_t)400));
 	}
 
 	if (_vehicle_global_position_sub.updated()) {
@@ -113,9 +114,10 @@ void SensorMagSim::Run()
 			if (gpos.eph < 1000) {
 
 				// magnetic field data returned by the geo library using the current GPS position
-				const float declination_rad = math::radians(get_mag_declination_degrees(gpos.lat, gpos.lon));
-				const float inclination_rad = math::radians(get_mag_inclination_degrees(gpos.lat, gpos.lon));
-				const float field_strength_gauss = get_mag_strength_gauss(gpos.lat, gpos.lon);
+				_wmm.update(gpos.lat, gpos.lon);
+				const float declination_rad = math::radians(_wmm.declination_degrees());
+				const float inclination_rad = math::radians(_wmm.inclination_degrees());
+				const float field_strength_gauss = _wmm.strength_gauss();
 
 				_mag_earth_pred = Dcmf(Eulerf(0, -inclination_rad, declination_rad)) * Vector3f(field_strength_gauss, 0, 0);
 
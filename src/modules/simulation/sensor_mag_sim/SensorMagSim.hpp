@@ -35,6 +35,7 @@
 
 #include <lib/drivers/magnetometer/PX4Magnetometer.hpp>
 #include <lib/perf/perf_counter.h>
+#include <lib/world_magnetic_model/geo_mag_declination.h>
 #include <px4_platform_common/defines.h>
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/module_params.h>
@@ -83,12 +84,14 @@ private:
 	bool _mag_earth_available{false};
 
 	matrix::Vector3f _mag_earth_pred{};
+	GeoMagFieldCache _wmm{};
 
 	perf_counter_t _loop_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
 
 	DEFINE_PARAMETERS(
 		(ParamFloat<px4::params::SIM_MAG_OFFSET_X>) _sim_mag_offset_x,
 		(ParamFloat<px4::params::SIM_MAG_OFFSET_Y>) _sim_mag_offset_y,
-		(ParamFloat<px4::params::SIM_MAG_OFFSET_Z>) _sim_mag_offset_z
+		(ParamFloat<px4::params::SIM_MAG_OFFSET_Z>) _sim_mag_offset_z,
+		(ParamInt<px4::params::SIM_MAG_RATE>) _sim_mag_rate
 	)
 };
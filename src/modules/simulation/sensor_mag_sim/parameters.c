@@ -65,3 +65,13 @@ PARAM_DEFINE_FLOAT(SIM_MAG_OFFSET_Y, 0.0f);
  * @group Simulator
  */
 PARAM_DEFINE_FLOAT(SIM_MAG_OFFSET_Z,  0.0f);
+
+/**
+ * Simulated magnetometer update rate
+ *
+ * @unit Hz
+ * @min 1
+ * @max 400
+ * @group Simulator
+ */
+PARAM_DEFINE_INT32(SIM_MAG_RATE, 50);
@@ -119,7 +119,8 @@ void Sih::lockstep_loop()
 
 	int rt_interval_us = int(roundf(sim_interval_us / speed_factor));
 
-	PX4_INFO("Simulation loop with %d Hz (%d us sim time interval)", rate, sim_interval_us);
+	PX4_INFO("Simulation loop with %d Hz (%d us sim time interval), physics at %d Hz", rate, sim_interval_us,
+		 rate * _physics_steps);
 	PX4_INFO("Simulation with %.1fx speedup. Loop with (%d us wall time interval)", (double)speed_factor, rt_interval_us);
 	uint64_t pre_compute_wall_time_us;
 
@@ -208,11 +209,16 @@ void Sih::sensor_step()
 	const float dt = (now - _last_run) * 1e-6f;
 	_last_run = now;
 
-	read_motors(dt);
+	// integrate the dynamics in several physics steps per loop iteration, the sensors are only generated once
+	const float dt_physics = dt / _physics_steps;
 
-	generate_force_and_torques();
+	for (int i = 0; i < _physics_steps; i++) {
+		read_motors(dt_physics);
 
-	equations_of_motion(dt);
+		generate_force_and_torques();
+
+		equations_of_motion(dt_physics);
+	}
 
 	reconstruct_sensors_signals(now);
 
@@ -264,6 +270,8 @@ void Sih::parameters_updated()
 	_distance_snsr_override = _sih_distance_snsr_override.get();
 
 	_T_TAU = _sih_thrust_tau.get();
+
+	_physics_steps = math::constrain(_sih_phys_steps.get(), (int32_t)1, (int32_t)10);
 }
 
 void Sih::init_variables()
@@ -276,6 +284,7 @@ void Sih::init_variables()
 	_w_B = Vector3f(0.0f, 0.0f, 0.0f);
 
 	_u[0] = _u[1] = _u[2] = _u[3] = 0.0f;
+	_u_sp[0] = _u_sp[1] = _u_sp[2] = _u_sp[3] = 0.0f;
 }
 
 void Sih::read_motors(const float dt)
@@ -285,14 +294,17 @@ void Sih::read_motors(const float dt)
 	if (_actuator_out_sub.update(&actuators_out)) {
 		_last_actuator_output_time = actuators_out.timestamp;
 
-		for (int i = 0; i < NB_MOTORS; i++) { // saturate the motor signals
-			if ((_vehicle == VehicleType::FW && i < 3) || (_vehicle == VehicleType::TS && i > 3)) {
-				_u[i] = actuators_out.output[i];
+		for (int i = 0; i < NB_MOTORS; i++) {
+			_u_sp[i] = actuators_out.output[i];
+		}
+	}
 
-			} else {
-				float u_sp = actuators_out.output[i];
-				_u[i] = _u[i] + dt / _T_TAU * (u_sp - _u[i]); // first order transfer function with time constant tau
-			}
+	for (int i = 0; i < NB_MOTORS; i++) { // saturate the motor signals
+		if ((_vehicle == VehicleType::FW && i < 3) || (_vehicle == VehicleType::TS && i > 3)) {
+			_u[i] = _u_sp[i];
+
+		} else {
+			_u[i] = _u[i] + dt / _T_TAU * (_u_sp[i] - _u[i]); // first order transfer function with time constant tau
 		}
 	}
 }
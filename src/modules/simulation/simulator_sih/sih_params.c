@@ -338,3 +338,17 @@ PARAM_DEFINE_FLOAT(SIH_T_TAU, 0.05f);
  * @group Simulation In Hardware
  */
 PARAM_DEFINE_INT32(SIH_VEHICLE_TYPE, 0);
+
+/**
+ * Physics integration steps per simulation loop iteration
+ *
+ * The simulation loop runs at the IMU rate (IMU_GYRO_RATEMAX), the equations
+ * of motion are integrated this many times per loop iteration. Increases the
+ * fidelity of the dynamics without increasing the sensor publication rate,
+ * e.g. together with PX4_SIM_SPEED_FACTOR for faster than realtime simulation.
+ *
+ * @min 1
+ * @max 10
+ * @group Simulation In Hardware
+ */
+PARAM_DEFINE_INT32(SIH_PHYS_STEPS, 1);
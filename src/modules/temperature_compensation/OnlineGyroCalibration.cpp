@@ -0,0 +1,189 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file OnlineGyroCalibration.cpp
+ */
+
+#include "OnlineGyroCalibration.h"
+
+#include <lib/parameters/param.h>
+#include <lib/sensor_calibration/Gyroscope.hpp>
+#include <px4_platform_common/log.h>
+
+namespace temperature_compensation
+{
+
+void OnlineGyroCalibration::parameters_update()
+{
+	int32_t enabled = 0;
+	param_get(param_find("TC_G_ONLINE"), &enabled);
+	_enabled = (enabled == 1);
+
+	param_get(param_find("TC_G_ONL_SPAN"), &_temperature_span);
+}
+
+bool OnlineGyroCalibration::update(int uorb_index, const vehicle_imu_status_s &status, bool armed, bool calibrated)
+{
+	if (!_enabled || (uorb_index < 0) || (uorb_index >= GYRO_COUNT_MAX)) {
+		return false;
+	}
+
+	PerSensorData &data = _data[uorb_index];
+
+	if (data.complete || calibrated || (status.gyro_device_id == 0) || !PX4_ISFINITE(status.temperature_gyro)) {
+		return false;
+	}
+
+	if (data.device_id != status.gyro_device_id) {
+		// new sensor on this instance, restart the collection
+		data = PerSensorData{};
+		data.device_id = status.gyro_device_id;
+
+		const calibration::Gyroscope gyro_calibration{data.device_id};
+		data.rotation = gyro_calibration.rotation();
+		data.calibration_index = gyro_calibration.calibration_index();
+	}
+
+	// only use data while the vehicle is disarmed and at rest, so that the average reading is the bias
+	const matrix::Vector3f mean_gyro{status.mean_gyro};
+	const matrix::Vector3f var_gyro{status.var_gyro};
+
+	if (armed || (var_gyro.max() > MAX_GYRO_VARIANCE) || mean_gyro.longerThan(MAX_GYRO_MEAN)) {
+		return false;
+	}
+
+	const float temperature = status.temperature_gyro;
+
+	if (data.sample_count == 0) {
+		data.low_temp = temperature;
+		data.high_temp = temperature;
+		data.ref_temp = temperature + 0.5f * _temperature_span;
+	}
+
+	// the polynomial is fitted in the sensor frame, the same frame the compensation is applied in
+	const matrix::Vector3f raw_gyro{data.rotation.transpose() * mean_gyro};
+	const double relative_temperature = (double)temperature - (double)data.ref_temp;
+
+	for (int axis = 0; axis < 3; axis++) {
+		data.P[axis].update(relative_temperature, (double)raw_gyro(axis));
+	}
+
+	data.sample_count++;
+	data.low_temp = math::min(data.low_temp, temperature);
+	data.high_temp = math::max(data.high_temp, temperature);
+
+	if ((data.high_temp - data.low_temp >= _temperature_span) && (data.sample_count >= MIN_SAMPLE_COUNT)) {
+		return finish(uorb_index, data);
+	}
+
+	return false;
+}
+
+bool OnlineGyroCalibration::finish(int uorb_index, PerSensorData &data)
+{
+	data.complete = true;
+
+	char str[30] {};
+	int result = PX4_OK;
+
+	for (int axis = 0; axis < 3; axis++) {
+		double res[4] {};
+		data.P[axis].fit(res);
+
+		for (int coef_index = 0; coef_index <= 3; coef_index++) {
+			snprintf(str, sizeof(str), "TC_G%d_X%d_%d", uorb_index, 3 - coef_index, axis);
+			const float param = (float)res[coef_index];
+			result |= param_set_no_notification(param_find(str), &param);
+		}
+	}
+
+	snprintf(str, sizeof(str), "TC_G%d_ID", uorb_index);
+	const int32_t device_id = data.device_id;
+	result |= param_set_no_notification(param_find(str), &device_id);
+
+	snprintf(str, sizeof(str), "TC_G%d_TMIN", uorb_index);
+	result |= param_set_no_notification(param_find(str), &data.low_temp);
+
+	snprintf(str, sizeof(str), "TC_G%d_TMAX", uorb_index);
+	result |= param_set_no_notification(param_find(str), &data.high_temp);
+
+	snprintf(str, sizeof(str), "TC_G%d_TREF", uorb_index);
+	result |= param_set_no_notification(param_find(str), &data.ref_temp);
+
+	// the polynomial covers the whole bias, reset the static calibration offset
+	if (data.calibration_index >= 0) {
+		const float offset = 0.f;
+		const char *axes[] {"X", "Y", "Z"};
+
+		for (const char *axis : axes) {
+			snprintf(str, sizeof(str), "CAL_GYRO%d_%sOFF", data.calibration_index, axis);
+			result |= param_set_no_notification(param_find(str), &offset);
+		}
+	}
+
+	const int32_t enabled = 1;
+	result |= param_set_no_notification(param_find("TC_G_ENABLE"), &enabled);
+
+	param_notify_changes();
+
+	if (result != PX4_OK) {
+		PX4_ERR("gyro %d: failed to store the online thermal calibration", uorb_index);
+		return false;
+	}
+
+	PX4_INFO("gyro %d: online thermal calibration complete (%.1f to %.1f degC, %" PRIu32 " samples)", uorb_index,
+		 (double)data.low_temp, (double)data.high_temp, data.sample_count);
+
+	return true;
+}
+
+void OnlineGyroCalibration::print_status()
+{
+	if (!_enabled) {
+		return;
+	}
+
+	PX4_INFO("Online gyro calibration, span %.1f degC", (double)_temperature_span);
+
+	for (int uorb_index = 0; uorb_index < GYRO_COUNT_MAX; uorb_index++) {
+		const PerSensorData &data = _data[uorb_index];
+
+		if (data.device_id != 0) {
+			PX4_INFO(" gyro %d (%" PRIu32 "): %s, %.1f to %.1f degC, %" PRIu32 " samples", uorb_index, data.device_id,
+				 data.complete ? "complete" : "collecting", (double)data.low_temp, (double)data.high_temp, data.sample_count);
+		}
+	}
+}
+
+} // namespace temperature_compensation
@@ -0,0 +1,104 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file OnlineGyroCalibration.h
+ *
+ * Fits the gyro thermal compensation polynomial incrementally while the vehicle warms up on the
+ * ground, without requiring the dedicated thermal calibration procedure.
+ */
+
+#pragma once
+
+#include <matrix/math.hpp>
+#include <uORB/topics/vehicle_imu_status.h>
+
+#include "TemperatureCompensation.h"
+#include "temperature_calibration/polyfit.hpp"
+
+namespace temperature_compensation
+{
+
+/**
+ ** class OnlineGyroCalibration
+ * Accumulates the average gyro reading of each IMU against its temperature whenever the vehicle is
+ * disarmed and at rest. Once the temperature rose by the configured span, the 3rd order
+ * polynomial is fitted and written to the TC_G* parameters, and TC_G_ENABLE is set.
+ */
+class OnlineGyroCalibration
+{
+public:
+	OnlineGyroCalibration() = default;
+	~OnlineGyroCalibration() = default;
+
+	/** (re)load the parameters, the collected data is kept */
+	void parameters_update();
+
+	bool enabled() const { return _enabled; }
+
+	/**
+	 * add a vehicle_imu_status sample
+	 * @param uorb_index vehicle_imu_status instance, used as TC_G parameter index
+	 * @param calibrated true if the gyro already has thermal compensation parameters
+	 * @return true if a new calibration was written to the parameters
+	 */
+	bool update(int uorb_index, const vehicle_imu_status_s &status, bool armed, bool calibrated);
+
+	void print_status();
+
+private:
+	static constexpr float MAX_GYRO_VARIANCE = 1e-4f; ///< [(rad/s)^2] at rest threshold of the per axis variance
+	static constexpr float MAX_GYRO_MEAN = 0.2f; ///< [rad/s] at rest threshold of the average reading
+	static constexpr uint32_t MIN_SAMPLE_COUNT = 30;
+
+	struct PerSensorData {
+		polyfitter<4> P[3];
+		matrix::Dcmf rotation{};
+		uint32_t device_id{0};
+		int8_t calibration_index{-1}; ///< CAL_GYRO* index of the device, -1 if none
+		uint32_t sample_count{0};
+		float low_temp{NAN};
+		float high_temp{NAN};
+		float ref_temp{NAN};
+		bool complete{false};
+	};
+
+	bool finish(int uorb_index, PerSensorData &data);
+
+	PerSensorData _data[GYRO_COUNT_MAX] {};
+
+	float _temperature_span{10.f};
+	bool _enabled{false};
+};
+
+} // namespace temperature_compensation
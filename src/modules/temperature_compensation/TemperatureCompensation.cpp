@@ -433,16 +433,16 @@ int TemperatureCompensation::update_offsets_accel(int topic_instance, float temp
 		return -1;
 	}
 
+	// Only evaluate the polynomial when the temperature changed enough to warrant a new publication
+	if (fabsf(temperature - _accel_data.last_temperature[topic_instance]) <= TEMPERATURE_UPDATE_THRESHOLD) {
+		return 1;
+	}
+
 	// Calculate and update the offsets
 	calc_thermal_offsets_3D(_parameters.accel_cal_data[mapping], temperature, offsets);
+	_accel_data.last_temperature[topic_instance] = temperature;
 
-	// Check if temperature delta is large enough to warrant a new publication
-	if (fabsf(temperature - _accel_data.last_temperature[topic_instance]) > 1.0f) {
-		_accel_data.last_temperature[topic_instance] = temperature;
-		return 2;
-	}
-
-	return 1;
+	return 2;
 }
 
 int TemperatureCompensation::update_offsets_gyro(int topic_instance, float temperature, float *offsets)
@@ -459,16 +459,16 @@ int TemperatureCompensation::update_offsets_gyro(int topic_instance, float tempe
 		return -1;
 	}
 
+	// Only evaluate the polynomial when the temperature changed enough to warrant a new publication
+	if (fabsf(temperature - _gyro_data.last_temperature[topic_instance]) <= TEMPERATURE_UPDATE_THRESHOLD) {
+		return 1;
+	}
+
 	// Calculate and update the offsets
 	calc_thermal_offsets_3D(_parameters.gyro_cal_data[mapping], temperature, offsets);
+	_gyro_data.last_temperature[topic_instance] = temperature;
 
-	// Check if temperature delta is large enough to warrant a new publication
-	if (fabsf(temperature - _gyro_data.last_temperature[topic_instance]) > 1.0f) {
-		_gyro_data.last_temperature[topic_instance] = temperature;
-		return 2;
-	}
-
-	return 1;
+	return 2;
 }
 
 int TemperatureCompensation::update_offsets_mag(int topic_instance, float temperature, float *offsets)
@@ -485,16 +485,16 @@ int TemperatureCompensation::update_offsets_mag(int topic_instance, float temper
 		return -1;
 	}
 
+	// Only evaluate the polynomial when the temperature changed enough to warrant a new publication
+	if (fabsf(temperature - _mag_data.last_temperature[topic_instance]) <= TEMPERATURE_UPDATE_THRESHOLD) {
+		return 1;
+	}
+
 	// Calculate and update the offsets
 	calc_thermal_offsets_3D(_parameters.mag_cal_data[mapping], temperature, offsets);
+	_mag_data.last_temperature[topic_instance] = temperature;
 
-	// Check if temperature delta is large enough to warrant a new publication
-	if (fabsf(temperature - _mag_data.last_temperature[topic_instance]) > 1.0f) {
-		_mag_data.last_temperature[topic_instance] = temperature;
-		return 2;
-	}
-
-	return 1;
+	return 2;
 }
 
 int TemperatureCompensation::update_offsets_baro(int topic_instance, float temperature, float *offsets)
@@ -511,16 +511,16 @@ int TemperatureCompensation::update_offsets_baro(int topic_instance, float tempe
 		return -1;
 	}
 
+	// Only evaluate the polynomial when the temperature changed enough to warrant a new publication
+	if (fabsf(temperature - _baro_data.last_temperature[topic_instance]) <= TEMPERATURE_UPDATE_THRESHOLD) {
+		return 1;
+	}
+
 	// Calculate and update the offsets
 	calc_thermal_offsets_1D(_parameters.baro_cal_data[mapping], temperature, *offsets);
+	_baro_data.last_temperature[topic_instance] = temperature;
 
-	// Check if temperature delta is large enough to warrant a new publication
-	if (fabsf(temperature - _baro_data.last_temperature[topic_instance]) > 1.0f) {
-		_baro_data.last_temperature[topic_instance] = temperature;
-		return 2;
-	}
-
-	return 1;
+	return 2;
 }
 
 void TemperatureCompensation::print_status()
@@ -62,6 +62,8 @@ static_assert(BARO_COUNT_MAX == 4, "BARO_COUNT_MAX must be 4 (if changed, add/re
 
 static constexpr uint8_t SENSOR_COUNT_MAX = 4;
 
+static constexpr float TEMPERATURE_UPDATE_THRESHOLD = 1.0f; ///< [deg C] temperature change before the offsets are re-evaluated
+
 /**
  ** class TemperatureCompensation
  * Applies temperature compensation to sensor data. Loads the parameters from PX4 param storage.
@@ -83,10 +85,11 @@ public:
 
 	/**
 	 * Apply Thermal corrections to accel, gyro, mag, and baro sensor data.
+	 * The polynomial is only evaluated when the temperature changed by more than TEMPERATURE_UPDATE_THRESHOLD
+	 * since the last evaluation, otherwise the previously returned offsets remain valid.
 	 * @param topic_instance uORB topic instance
-	 * @param sensor_data input sensor data, output sensor data with applied corrections
 	 * @param temperature measured current temperature
-	 * @param offsets returns offsets that were applied (length = 3, except for baro), depending on return value
+	 * @param offsets returns the new offsets (length = 3, except for baro), only written if the return value is 2
 	 * @return -1: error: correction enabled, but no sensor mapping set (@see set_sendor_id_gyro)
 	 *         0: no changes (correction not enabled),
 	 *         1: corrections applied but no changes to offsets,
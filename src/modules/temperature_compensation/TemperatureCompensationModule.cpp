@@ -64,6 +64,7 @@ TemperatureCompensationModule::~TemperatureCompensationModule()
 void TemperatureCompensationModule::parameters_update()
 {
 	_temperature_compensation.parameters_update();
+	_online_gyro_calibration.parameters_update();
 
 	// Accel
 	for (uint8_t uorb_index = 0; uorb_index < ACCEL_COUNT_MAX; uorb_index++) {
@@ -266,6 +267,35 @@ void TemperatureCompensationModule::baroPoll()
 	}
 }
 
+void TemperatureCompensationModule::imuStatusPoll()
+{
+	if (!_online_gyro_calibration.enabled()) {
+		return;
+	}
+
+	if (_vehicle_status_sub.updated()) {
+		vehicle_status_s vehicle_status;
+
+		if (_vehicle_status_sub.copy(&vehicle_status)) {
+			_armed = (vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED);
+		}
+	}
+
+	for (uint8_t uorb_index = 0; uorb_index < GYRO_COUNT_MAX; uorb_index++) {
+		vehicle_imu_status_s imu_status;
+
+		if (_vehicle_imu_status_subs[uorb_index].update(&imu_status)) {
+			// gyros with a matching thermal calibration are already compensated
+			const bool calibrated = (imu_status.gyro_device_id != 0)
+						&& (_corrections.gyro_device_ids[uorb_index] == imu_status.gyro_device_id);
+
+			if (_online_gyro_calibration.update(uorb_index, imu_status, _armed, calibrated)) {
+				mavlink_log_info(&_mavlink_log_pub, "Gyro %d thermal calibration complete", uorb_index);
+			}
+		}
+	}
+}
+
 void TemperatureCompensationModule::Run()
 {
 	perf_begin(_loop_perf);
@@ -343,6 +373,7 @@ void TemperatureCompensationModule::Run()
 	gyroPoll();
 	magPoll();
 	baroPoll();
+	imuStatusPoll();
 
 	// publish sensor corrections if necessary
 	if (_corrections_changed) {
@@ -466,6 +497,7 @@ int TemperatureCompensationModule::custom_command(int argc, char *argv[])
 int TemperatureCompensationModule::print_status()
 {
 	_temperature_compensation.print_status();
+	_online_gyro_calibration.print_status();
 
 	return PX4_OK;
 }
@@ -485,6 +517,9 @@ whenever a change in temperature is detected. The module can also be configured
 routine at next boot, which allows the thermal calibration coeffecients to be calculated while the vehicle undergoes
 a temperature cycle.
 
+With TC_G_ONLINE enabled, the gyro coefficients of uncalibrated IMUs are also fitted incrementally while the vehicle
+warms up disarmed and at rest, and stored once the temperature rose by TC_G_ONL_SPAN.
+
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("temperature_compensation", "system");
@@ -57,7 +57,10 @@
 #include <uORB/topics/sensor_mag.h>
 #include <uORB/topics/vehicle_command.h>
 #include <uORB/topics/vehicle_command_ack.h>
+#include <uORB/topics/vehicle_imu_status.h>
+#include <uORB/topics/vehicle_status.h>
 
+#include "OnlineGyroCalibration.h"
 #include "TemperatureCompensation.h"
 
 using namespace time_literals;
@@ -100,6 +103,7 @@ private:
 	void gyroPoll();
 	void magPoll();
 	void baroPoll();
+	void imuStatusPoll();
 
 	/**
 	 * call this whenever parameters got updated. Make sure to have initialize_sensors() called at least
@@ -135,9 +139,17 @@ private:
 		{ORB_ID(sensor_baro), 3},
 	};
 
+	uORB::Subscription _vehicle_imu_status_subs[GYRO_COUNT_MAX] {
+		{ORB_ID(vehicle_imu_status), 0},
+		{ORB_ID(vehicle_imu_status), 1},
+		{ORB_ID(vehicle_imu_status), 2},
+		{ORB_ID(vehicle_imu_status), 3},
+	};
+
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 
 	uORB::Subscription _vehicle_command_sub{ORB_ID(vehicle_command)};
+	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
 
 	perf_counter_t _loop_perf;			/**< loop performance counter */
 
@@ -145,6 +157,9 @@ private:
 
 	/* sensor thermal compensation */
 	TemperatureCompensation _temperature_compensation;
+	OnlineGyroCalibration _online_gyro_calibration;
+
+	bool _armed{false};
 
 	sensor_correction_s _corrections{}; /**< struct containing the sensor corrections to be published to the uORB*/
 	uORB::Publication<sensor_correction_s> _sensor_correction_pub{ORB_ID(sensor_correction)};
@@ -39,3 +39,28 @@
  * @boolean
  */
 PARAM_DEFINE_INT32(TC_G_ENABLE, 0);
+
+/**
+ * Online thermal calibration for rate gyro sensors.
+ *
+ * Fits the gyro thermal compensation coefficients of IMUs without a thermal
+ * calibration while the vehicle warms up disarmed and at rest. Once the
+ * temperature rose by TC_G_ONL_SPAN, the coefficients are stored and
+ * TC_G_ENABLE is set.
+ *
+ * @group Thermal Compensation
+ * @reboot_required true
+ * @boolean
+ */
+PARAM_DEFINE_INT32(TC_G_ONLINE, 0);
+
+/**
+ * Temperature span of the online gyro thermal calibration.
+ *
+ * @group Thermal Compensation
+ * @unit celcius
+ * @min 5.0
+ * @max 40.0
+ * @decimal 1
+ */
+PARAM_DEFINE_FLOAT(TC_G_ONL_SPAN, 10.0f);
@@ -0,0 +1,331 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "UorbShmBridge.hpp"
+
+#include <px4_platform_common/getopt.h>
+#include <px4_platform_common/log.h>
+#include <uORB/topics/uORBTopics.hpp>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+ShmTopic::ShmTopic(const orb_metadata *meta, uint8_t instance) :
+	WorkItem(MODULE_NAME, px4::wq_configurations::hp_default),
+	_sub(this, meta, instance),
+	_write_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": write"))
+{
+}
+
+ShmTopic::~ShmTopic()
+{
+	_sub.unregisterCallback();
+
+	if (_header) {
+		munmap(_header, _shm_size);
+		shm_unlink(_shm_name);
+	}
+
+	perf_free(_write_perf);
+}
+
+bool ShmTopic::init(const char *prefix)
+{
+	const orb_metadata *meta = _sub.get_topic();
+
+	snprintf(_shm_name, sizeof(_shm_name), "/%s_%s_%d", prefix, meta->o_name, _sub.get_instance());
+
+	// slots are 8 byte aligned: sequence followed by the message
+	const uint32_t slot_size = (sizeof(uint64_t) + meta->o_size + 7) & ~7u;
+	_shm_size = sizeof(uorb_shm_header) + QUEUE_LENGTH * slot_size;
+
+	// remove a stale object (e.g. after a crash) so that readers never see an old header
+	shm_unlink(_shm_name);
+
+	int fd = shm_open(_shm_name, O_CREAT | O_EXCL | O_RDWR, 0644);
+
+	if (fd < 0) {
+		PX4_ERR("shm_open %s failed (%i)", _shm_name, errno);
+		return false;
+	}
+
+	void *mem = MAP_FAILED;
+
+	if (ftruncate(fd, _shm_size) == 0) {
+		mem = mmap(nullptr, _shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	}
+
+	close(fd);
+
+	if (mem == MAP_FAILED) {
+		PX4_ERR("mapping %s failed (%i)", _shm_name, errno);
+		shm_unlink(_shm_name);
+		return false;
+	}
+
+	// ftruncate zero fills, so all slot sequences are 0 (no message)
+	_header = static_cast<uorb_shm_header *>(mem);
+	_slots = reinterpret_cast<uint8_t *>(_header + 1);
+
+	_header->version = UORB_SHM_VERSION;
+	_header->message_hash = meta->message_hash;
+	_header->data_size = meta->o_size;
+	_header->slot_size = slot_size;
+	_header->queue_length = QUEUE_LENGTH;
+	_header->write_count = 0;
+	strncpy(_header->name, meta->o_name, sizeof(_header->name) - 1);
+
+	// readers check the magic last
+	__atomic_store_n(&_header->magic, UORB_SHM_MAGIC, __ATOMIC_RELEASE);
+
+	if (!_sub.registerCallback()) {
+		PX4_ERR("%s callback registration failed", meta->o_name);
+		return false;
+	}
+
+	// the current message, if there is one
+	ScheduleNow();
+
+	return true;
+}
+
+void ShmTopic::Run()
+{
+	perf_begin(_write_perf);
+
+	// drain the uORB queue, every queued message gets its own slot
+	while (_sub.updated()) {
+		const uint64_t index = _write_count;
+		uint8_t *slot = _slots + (index % QUEUE_LENGTH) * _header->slot_size;
+		uint64_t *sequence = reinterpret_cast<uint64_t *>(slot);
+		const uint64_t previous = __atomic_load_n(sequence, __ATOMIC_RELAXED);
+
+		// mark the slot as being written before touching the message
+		__atomic_store_n(sequence, 2 * index + 1, __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_RELEASE);
+
+		// copy straight from the uORB buffer into shared memory
+		if (_sub.copy(slot + sizeof(uint64_t))) {
+			__atomic_store_n(sequence, 2 * index + 2, __ATOMIC_RELEASE);
+
+			_write_count++;
+			__atomic_store_n(&_header->write_count, _write_count, __ATOMIC_RELEASE);
+
+		} else {
+			// the slot content is unchanged
+			__atomic_store_n(sequence, previous, __ATOMIC_RELEASE);
+			break;
+		}
+	}
+
+	perf_end(_write_perf);
+}
+
+void ShmTopic::print_status()
+{
+	PX4_INFO_RAW("%s: %" PRIu64 " messages, %" PRIu32 " slots of %" PRIu32 " bytes\n",
+		     _shm_name, _write_count, _header->queue_length, _header->slot_size);
+	perf_print_counter(_write_perf);
+}
+
+UorbShmBridge::~UorbShmBridge()
+{
+	for (int i = 0; i < _num_topics; i++) {
+		delete _topics[i];
+	}
+}
+
+bool UorbShmBridge::add_topic(const char *topic, const char *prefix)
+{
+	if (_num_topics >= MAX_TOPICS) {
+		PX4_ERR("too many topics");
+		return false;
+	}
+
+	char name[UORB_SHM_NAME_LEN] {};
+	strncpy(name, topic, sizeof(name) - 1);
+	uint8_t instance = 0;
+
+	char *separator = strchr(name, ':');
+
+	if (separator) {
+		*separator = '\0';
+		instance = atoi(separator + 1);
+
+		if (instance >= ORB_MULTI_MAX_INSTANCES) {
+			PX4_ERR("invalid instance %s", topic);
+			return false;
+		}
+	}
+
+	const orb_metadata *meta = nullptr;
+	const orb_metadata *const *topics = orb_get_topics();
+
+	for (size_t i = 0; i < orb_topics_count(); i++) {
+		if (strcmp(name, topics[i]->o_name) == 0) {
+			meta = topics[i];
+			break;
+		}
+	}
+
+	if (meta == nullptr) {
+		PX4_ERR("unknown topic %s", name);
+		return false;
+	}
+
+	ShmTopic *shm_topic = new ShmTopic(meta, instance);
+
+	if (shm_topic == nullptr) {
+		PX4_ERR("alloc failed");
+		return false;
+	}
+
+	if (!shm_topic->init(prefix)) {
+		delete shm_topic;
+		return false;
+	}
+
+	_topics[_num_topics++] = shm_topic;
+	return true;
+}
+
+int UorbShmBridge::task_spawn(int argc, char *argv[])
+{
+	UorbShmBridge *instance = new UorbShmBridge();
+
+	if (instance == nullptr) {
+		PX4_ERR("alloc failed");
+		return PX4_ERROR;
+	}
+
+	const char *prefix = "px4";
+	const char *topics[MAX_TOPICS] {};
+	int num_topics = 0;
+
+	int myoptind = 1;
+	int ch;
+	const char *myoptarg = nullptr;
+
+	while ((ch = px4_getopt(argc, argv, "p:t:", &myoptind, &myoptarg)) != EOF) {
+		switch (ch) {
+		case 'p':
+			prefix = myoptarg;
+			break;
+
+		case 't':
+			if (num_topics < MAX_TOPICS) {
+				topics[num_topics++] = myoptarg;
+			}
+
+			break;
+
+		default:
+			delete instance;
+			print_usage("unrecognized flag");
+			return PX4_ERROR;
+		}
+	}
+
+	if (num_topics == 0) {
+		topics[num_topics++] = "vehicle_odometry";
+		topics[num_topics++] = "sensor_combined";
+	}
+
+	_object.store(instance);
+	_task_id = task_id_is_work_queue;
+
+	for (int i = 0; i < num_topics; i++) {
+		if (!instance->add_topic(topics[i], prefix)) {
+			delete instance;
+			_object.store(nullptr);
+			_task_id = -1;
+			return PX4_ERROR;
+		}
+	}
+
+	return PX4_OK;
+}
+
+int UorbShmBridge::print_status()
+{
+	for (int i = 0; i < _num_topics; i++) {
+		_topics[i]->print_status();
+	}
+
+	return 0;
+}
+
+int UorbShmBridge::custom_command(int argc, char *argv[])
+{
+	return print_usage("unknown command");
+}
+
+int UorbShmBridge::print_usage(const char *reason)
+{
+	if (reason) {
+		PX4_WARN("%s\n", reason);
+	}
+
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Exposes uORB topics to other processes on the same machine (e.g. ROS 2 nodes next to SITL)
+through POSIX shared memory, without serialization or sockets.
+
+Every topic instance is written into its own lock-free ring (/<prefix>_<topic>_<instance>)
+directly from the uORB callback. PX4 never waits for readers, readers detect overwritten
+samples with a per-slot sequence number. The layout and a reader helper are in uorb_shm.h.
+
+### Examples
+Bridge the odometry and the first IMU:
+$ uorb_shm_bridge start -t vehicle_odometry -t sensor_combined -t vehicle_imu:0
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("uorb_shm_bridge", "communication");
+	PRINT_MODULE_USAGE_COMMAND("start");
+	PRINT_MODULE_USAGE_PARAM_STRING('t', nullptr, "<topic>[:<instance>]",
+					"Topic to bridge, can be given multiple times (default vehicle_odometry, sensor_combined)", true);
+	PRINT_MODULE_USAGE_PARAM_STRING('p', "px4", nullptr, "Shared memory name prefix", true);
+	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
+
+	return 0;
+}
+
+extern "C" __EXPORT int uorb_shm_bridge_main(int argc, char *argv[])
+{
+	return UorbShmBridge::main(argc, argv);
+}
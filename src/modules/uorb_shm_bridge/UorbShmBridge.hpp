@@ -0,0 +1,105 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/module.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+#include <lib/perf/perf_counter.h>
+#include <uORB/SubscriptionCallback.hpp>
+
+#include "uorb_shm.h"
+
+/**
+ * One uORB topic instance mirrored into a shared memory ring (see uorb_shm.h)
+ */
+class ShmTopic : public px4::WorkItem
+{
+public:
+	ShmTopic(const orb_metadata *meta, uint8_t instance);
+	~ShmTopic() override;
+
+	/**
+	 * Create and map the shared memory object and register the uORB callback
+	 * @param prefix shared memory object name prefix
+	 */
+	bool init(const char *prefix);
+
+	void print_status();
+
+private:
+	void Run() override;
+
+	static constexpr uint32_t QUEUE_LENGTH = 64;
+
+	uORB::SubscriptionCallbackWorkItem _sub;
+
+	char _shm_name[UORB_SHM_NAME_LEN + 16] {};
+	uorb_shm_header *_header{nullptr};
+	uint8_t *_slots{nullptr};
+	size_t _shm_size{0};
+
+	uint64_t _write_count{0};
+
+	perf_counter_t _write_perf;
+};
+
+class UorbShmBridge : public ModuleBase<UorbShmBridge>
+{
+public:
+	UorbShmBridge() = default;
+	~UorbShmBridge() override;
+
+	/** @see ModuleBase */
+	static int task_spawn(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int custom_command(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int print_usage(const char *reason = nullptr);
+
+	int print_status() override;
+
+private:
+	static constexpr int MAX_TOPICS = 16;
+
+	/**
+	 * Add a topic given as <name>[:<instance>]
+	 */
+	bool add_topic(const char *topic, const char *prefix);
+
+	ShmTopic *_topics[MAX_TOPICS] {};
+	int _num_topics{0};
+};
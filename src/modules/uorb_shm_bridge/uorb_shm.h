@@ -0,0 +1,107 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file uorb_shm.h
+ *
+ * Shared memory layout of the uorb_shm_bridge module, for consumers outside of PX4.
+ *
+ * Every bridged topic instance is a POSIX shared memory object named /<prefix>_<topic>_<instance>,
+ * e.g. /px4_vehicle_odometry_0 (the prefix defaults to px4 and is set with -p for multiple PX4 instances).
+ * It contains a header followed by queue_length slots, each slot holds a sequence number and the
+ * raw uORB message. PX4 is the only writer, any number of processes can map the object read-only.
+ *
+ * Slots are written as a sequence lock: while sample n is written its slot sequence is 2n + 1,
+ * afterwards 2n + 2. Readers check the sequence before and after copying the sample and discard it
+ * if it changed (the writer lapped the reader). Nothing blocks the writer, a slow reader only loses samples.
+ *
+ * Consumers must compare message_hash and data_size against the message definitions they were built with.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#define UORB_SHM_MAGIC   0x4d534f55u ///< "UOSM"
+#define UORB_SHM_VERSION 1u
+
+#define UORB_SHM_NAME_LEN 64
+
+struct uorb_shm_header {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t message_hash;    ///< uORB message hash (orb_metadata::message_hash)
+	uint32_t data_size;       ///< size of a message in bytes
+	uint32_t slot_size;       ///< size of a slot in bytes (sequence + message, multiple of 8)
+	uint32_t queue_length;    ///< number of slots
+	uint64_t write_count;     ///< number of messages written so far (atomic)
+	char name[UORB_SHM_NAME_LEN]; ///< uORB topic name
+};
+
+/**
+ * Number of messages written so far, the newest one is write_count - 1
+ */
+static inline uint64_t uorb_shm_write_count(const struct uorb_shm_header *header)
+{
+	return __atomic_load_n(&header->write_count, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * Copy message number index out of the ring
+ *
+ * @param header mapped shared memory object
+ * @param index message index, must be smaller than uorb_shm_write_count()
+ * @param dst buffer of at least data_size bytes
+ * @return 0 on success, -1 if the message is not (or no longer) available
+ */
+static inline int uorb_shm_read(const struct uorb_shm_header *header, uint64_t index, void *dst)
+{
+	const uint8_t *slot = (const uint8_t *)(header + 1) + (index % header->queue_length) * header->slot_size;
+	const uint64_t *sequence = (const uint64_t *)slot;
+	const uint64_t expected = 2 * index + 2;
+
+	if (__atomic_load_n(sequence, __ATOMIC_ACQUIRE) != expected) {
+		return -1;
+	}
+
+	memcpy(dst, slot + sizeof(uint64_t), header->data_size);
+
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+	if (__atomic_load_n(sequence, __ATOMIC_RELAXED) != expected) {
+		return -1;
+	}
+
+	return 0;
+}
@@ -21,6 +21,7 @@ import os
 #include <uxr/client/client.h>
 #include <ucdr/microcdr.h>
 
+#include <drivers/drv_hrt.h>
 #include <mathlib/mathlib.h>
 #include <uORB/Publication.hpp>
 #include <uORB/PublicationMulti.hpp>
@@ -46,6 +47,10 @@ struct SendSubscription {
 	const char* topic;
 	uint32_t topic_size;
 	UcdrSerializeMethod ucdr_serialize_method;
+	uint32_t interval_ms; ///< minimum interval between samples (rate_limit), 0: every update
+	bool reliable;
+	uint16_t history_depth;
+	uint8_t priority; ///< 0: low, 1: normal, 2: high
 };
 
 // Subscribers for messages to send
@@ -58,6 +63,10 @@ struct SendTopicsSubs {
 			  "@(pub['topic'])",
 			  ucdr_topic_size_@(pub['simple_base_type'])(),
 			  &ucdr_serialize_@(pub['simple_base_type']),
+			  @(pub['interval_ms']),
+			  @(pub['reliable']),
+			  @(pub['history_depth']),
+			  @(pub['priority']),
 			},
 @[    end for]@
 	};
@@ -65,6 +74,31 @@ struct SendTopicsSubs {
 	px4_pollfd_struct_t fds[@(len(publications))] {};
 
 	uint32_t num_payload_sent{};
+	uint32_t num_samples_dropped{}; ///< samples not sent because the byte budget was used up
+
+	// outgoing byte budget (token bucket), bursts of up to BUDGET_WINDOW worth of bytes
+	static constexpr float BUDGET_WINDOW = 0.1f; // seconds
+	uint32_t tx_budget{0}; ///< in B/s, 0: unlimited
+	float tx_tokens{0.f};
+	hrt_abstime tx_last_update{0};
+
+	// batching: samples are packed into one XRCE message until it is full or the oldest sample
+	// waited batch_interval_us, instead of flushing the output streams after every sample
+	static constexpr uint32_t BATCH_MESSAGE_OVERHEAD = 8; // message header incl. session & stream
+	static constexpr uint32_t BATCH_SAMPLE_OVERHEAD = 12; // WRITE_DATA submessage header & alignment
+	uint32_t batch_interval_us{0}; ///< 0: flush at the end of every update
+	uint32_t batch_max_size{UXR_CONFIG_SERIAL_TRANSPORT_MTU}; ///< transport MTU
+	uint32_t batch_size{0}; ///< bytes of the pending batch, 0: nothing pending
+	hrt_abstime batch_start{0};
+	uint32_t num_flushes{};
+
+	bool flush_due() const { return (batch_size > 0) && (hrt_elapsed_time(&batch_start) >= batch_interval_us); }
+
+	// flush all output streams, ends the pending batch
+	void flush(uxrSession *session);
+
+	// output streams were flushed externally (e.g. by uxr_run_session_timeout())
+	void flushed() { batch_size = 0; }
 
 	void init();
 	void update(uxrSession *session, uxrStreamId reliable_out_stream_id, uxrStreamId best_effort_stream_id, uxrObjectId participant_id, const char *client_namespace);
@@ -75,12 +109,26 @@ void SendTopicsSubs::init() {
 	for (unsigned idx = 0; idx < sizeof(send_subscriptions)/sizeof(send_subscriptions[0]); ++idx) {
 		fds[idx].fd = orb_subscribe(send_subscriptions[idx].orb_meta);
 		fds[idx].events = POLLIN;
-		orb_set_interval(fds[idx].fd, UXRCE_DEFAULT_POLL_RATE);
+		orb_set_interval(fds[idx].fd, math::max(send_subscriptions[idx].interval_ms, (uint32_t)UXRCE_DEFAULT_POLL_RATE));
+	}
+
+	tx_tokens = tx_budget * BUDGET_WINDOW;
+	tx_last_update = hrt_absolute_time();
+}
+
+void SendTopicsSubs::flush(uxrSession *session) {
+	if (batch_size > 0) {
+		uxr_flash_output_streams(session);
+		batch_size = 0;
+		num_flushes++;
 	}
 }
 
 void SendTopicsSubs::reset() {
 	num_payload_sent = 0;
+	num_samples_dropped = 0;
+	num_flushes = 0;
+	batch_size = 0;
 	for (unsigned idx = 0; idx < sizeof(send_subscriptions)/sizeof(send_subscriptions[0]); ++idx) {
 		send_subscriptions[idx].data_writer = uxr_object_id(0, UXR_INVALID_ID);
 	}
@@ -92,26 +140,62 @@ void SendTopicsSubs::update(uxrSession *session, uxrStreamId reliable_out_stream
 
 	alignas(sizeof(uint64_t)) char topic_data[max_topic_size];
 
+	const float tx_bucket_size = tx_budget * BUDGET_WINDOW;
+
+	if (tx_budget > 0) {
+		const hrt_abstime now = hrt_absolute_time();
+		tx_tokens = math::min(tx_tokens + tx_budget * (now - tx_last_update) * 1e-6f, tx_bucket_size);
+		tx_last_update = now;
+	}
+
 	for (unsigned idx = 0; idx < sizeof(send_subscriptions)/sizeof(send_subscriptions[0]); ++idx) {
 		if (fds[idx].revents & POLLIN) {
 			// Topic updated, copy data and send
 			orb_copy(send_subscriptions[idx].orb_meta, fds[idx].fd, &topic_data);
+
+			if (tx_budget > 0) {
+				// keep a reserve of the budget for higher priority topics: half for low, a quarter for normal priority
+				const float reserve = tx_bucket_size * (2 - send_subscriptions[idx].priority) / 4.f;
+
+				if (tx_tokens < send_subscriptions[idx].topic_size + reserve) {
+					num_samples_dropped++;
+					continue;
+				}
+			}
+
 			if (send_subscriptions[idx].data_writer.id == UXR_INVALID_ID) {
 				// data writer not created yet
 				create_data_writer(session, reliable_out_stream_id, participant_id, static_cast<ORB_ID>(send_subscriptions[idx].orb_meta->o_id), client_namespace, send_subscriptions[idx].topic,
-								   send_subscriptions[idx].dds_type_name, send_subscriptions[idx].data_writer);
+								   send_subscriptions[idx].dds_type_name, send_subscriptions[idx].data_writer,
+								   send_subscriptions[idx].reliable, send_subscriptions[idx].history_depth);
 			}
 
 			if (send_subscriptions[idx].data_writer.id != UXR_INVALID_ID) {
 
 				ucdrBuffer ub;
 				uint32_t topic_size = send_subscriptions[idx].topic_size;
-				if (uxr_prepare_output_stream(session, best_effort_stream_id, send_subscriptions[idx].data_writer, &ub, topic_size) != UXR_INVALID_REQUEST_ID) {
+
+				// send the pending batch first if the sample doesn't fit into the same message anymore
+				if (batch_size + topic_size + BATCH_SAMPLE_OVERHEAD > batch_max_size) {
+					flush(session);
+				}
+
+				uxrStreamId stream_id = send_subscriptions[idx].reliable ? reliable_out_stream_id : best_effort_stream_id;
+				if (uxr_prepare_output_stream(session, stream_id, send_subscriptions[idx].data_writer, &ub, topic_size) != UXR_INVALID_REQUEST_ID) {
 					send_subscriptions[idx].ucdr_serialize_method(&topic_data, ub, time_offset_us);
-					// TODO: fill up the MTU and then flush, which reduces the packet overhead
-					uxr_flash_output_streams(session);
 					num_payload_sent += topic_size;
 
+					if (batch_size == 0) {
+						batch_start = hrt_absolute_time();
+						batch_size = BATCH_MESSAGE_OVERHEAD;
+					}
+
+					batch_size += topic_size + BATCH_SAMPLE_OVERHEAD;
+
+					if (tx_budget > 0) {
+						tx_tokens -= topic_size;
+					}
+
 				} else {
 					//PX4_ERR("Error uxr_prepare_output_stream UXR_INVALID_REQUEST_ID %s", send_subscriptions[idx].subscription.get_topic()->o_name);
 				}
@@ -122,6 +206,10 @@ void SendTopicsSubs::update(uxrSession *session, uxrStreamId reliable_out_stream
 
 		}
 	}
+
+	if ((batch_interval_us == 0) || flush_due()) {
+		flush(session);
+	}
 }
 
 // Publishers for received messages
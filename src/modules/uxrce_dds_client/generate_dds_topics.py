@@ -99,10 +99,34 @@ def process_message_type(msg_type):
     # topic_simple: eg vehicle_status
     msg_type['topic_simple'] = msg_type['topic'].split('/')[-1]
 
+def process_publication_qos(pub):
+    # rate_limit: maximum publication rate in Hz (0: every update)
+    rate_limit = float(pub.get('rate_limit', 0))
+    if rate_limit < 0:
+        raise ValueError("{}: invalid rate_limit {}".format(pub['topic'], rate_limit))
+    pub['interval_ms'] = int(round(1000. / rate_limit)) if rate_limit > 0 else 0
+
+    # reliability: best_effort (default) or reliable
+    reliability = pub.get('reliability', 'best_effort')
+    if reliability not in ('best_effort', 'reliable'):
+        raise ValueError("{}: invalid reliability {}".format(pub['topic'], reliability))
+    pub['reliable'] = 'true' if reliability == 'reliable' else 'false'
+
+    # history_depth: keep last depth of the data writer
+    pub['history_depth'] = int(pub.get('history_depth', 0))
+
+    # priority: low, normal (default) or high, used when the outgoing byte budget is exhausted
+    priorities = {'low': 0, 'normal': 1, 'high': 2}
+    priority = pub.get('priority', 'normal')
+    if priority not in priorities:
+        raise ValueError("{}: invalid priority {}".format(pub['topic'], priority))
+    pub['priority'] = priorities[priority]
+
 pubs_not_empty = msg_map['publications'] is not None
 if pubs_not_empty:
     for p in msg_map['publications']:
         process_message_type(p)
+        process_publication_qos(p)
 
 merged_em_globals['publications'] = msg_map['publications'] if pubs_not_empty else []
 
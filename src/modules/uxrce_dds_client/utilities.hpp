@@ -40,7 +40,7 @@ static bool generate_topic_name(char *topic_name, const char *client_namespace,
 
 static bool create_data_writer(uxrSession *session, uxrStreamId reliable_out_stream_id, uxrObjectId participant_id,
 			       ORB_ID orb_id, const char *client_namespace, const char *topic, const char *type_name,
-			       uxrObjectId &datawriter_id)
+			       uxrObjectId &datawriter_id, bool reliable = false, uint16_t history_depth = 0)
 {
 	// topic
 	char topic_name[TOPIC_NAME_SIZE];
@@ -66,9 +66,9 @@ static bool create_data_writer(uxrSession *session, uxrStreamId reliable_out_str
 
 	uxrQoS_t qos = {
 		.durability = UXR_DURABILITY_TRANSIENT_LOCAL,
-		.reliability = UXR_RELIABILITY_BEST_EFFORT,
+		.reliability = reliable ? UXR_RELIABILITY_RELIABLE : UXR_RELIABILITY_BEST_EFFORT,
 		.history = UXR_HISTORY_KEEP_LAST,
-		.depth = 0,
+		.depth = history_depth,
 	};
 
 	uint16_t datawriter_req = uxr_buffer_create_datawriter_bin(session, reliable_out_stream_id, datawriter_id, publisher_id,
@@ -515,6 +515,9 @@ void UxrceddsClient::run()
 		uint32_t last_num_payload_received{};
 		int poll_error_counter = 0;
 
+		_subs->tx_budget = math::max(_param_uxrce_dds_tx_max.get(), 0);
+		_subs->batch_interval_us = math::max(_param_uxrce_dds_batch.get(), 0) * 1000;
+		_subs->batch_max_size = math::min((uint32_t)_comm->mtu, (uint32_t)sizeof(output_data_stream_buffer));
 		_subs->init();
 
 		while (!should_exit() && _connected) {
@@ -532,6 +535,14 @@ void UxrceddsClient::run()
 				}
 			}
 
+			// don't wait longer than the pending batch may be delayed
+			if (_subs->batch_size > 0) {
+				const hrt_abstime batch_age = hrt_elapsed_time(&_subs->batch_start);
+				const int batch_remaining_ms = (batch_age < _subs->batch_interval_us) ?
+							       (_subs->batch_interval_us - batch_age + 999) / 1000 : 0;
+				orb_poll_timeout_ms = math::min(orb_poll_timeout_ms, batch_remaining_ms);
+			}
+
 			/* Wait for topic updates for max 10 ms */
 			int poll = px4_poll(_subs->fds, (sizeof(_subs->fds) / sizeof(_subs->fds[0])), orb_poll_timeout_ms);
 
@@ -551,8 +562,12 @@ void UxrceddsClient::run()
 				}
 			}
 
-			// run session with 0 timeout (non-blocking)
-			uxr_run_session_timeout(&session, 0);
+			// run session with 0 timeout (non-blocking), this flushes the output streams as well,
+			// so skip it while a batch is still collecting samples
+			if ((_subs->batch_size == 0) || _subs->flush_due()) {
+				uxr_run_session_timeout(&session, 0);
+				_subs->flushed();
+			}
 
 			// check if there are available replies
 			process_replies();
@@ -865,6 +880,16 @@ int UxrceddsClient::print_status()
 	if (_connected) {
 		PX4_INFO("Payload tx:          %i B/s", _last_payload_tx_rate);
 		PX4_INFO("Payload rx:          %i B/s", _last_payload_rx_rate);
+
+		if (_subs->tx_budget > 0) {
+			PX4_INFO("Payload tx budget:   %" PRIu32 " B/s, %" PRIu32 " samples dropped", _subs->tx_budget,
+				 _subs->num_samples_dropped);
+		}
+
+		if (_subs->batch_interval_us > 0) {
+			PX4_INFO("Batching:            %" PRIu32 " us max delay, %" PRIu32 " B max, %" PRIu32 " flushes",
+				 _subs->batch_interval_us, _subs->batch_max_size, _subs->num_flushes);
+		}
 	}
 
 	PX4_INFO("timesync converged: %s", _timesync.sync_converged() ? "true" : "false");
@@ -104,17 +104,28 @@ VtolAttitudeControl::init()
 		return false;
 	}
 
-	if (!_vehicle_thrust_setpoint_virtual_fw_sub.registerCallback()) {
-		PX4_ERR("callback registration failed");
-		return false;
-	}
+	return true;
+}
 
-	if (!_vehicle_thrust_setpoint_virtual_mc_sub.registerCallback()) {
-		PX4_ERR("callback registration failed");
-		return false;
+void VtolAttitudeControl::update_callback_registration()
+{
+	const mode vtol_mode = _vtol_type->get_mode();
+	const bool run_on_fw = (vtol_mode != mode::ROTARY_WING);
+	const bool run_on_mc = (vtol_mode != mode::FIXED_WING);
+
+	if (run_on_fw && !_vehicle_torque_setpoint_virtual_fw_sub.registered()) {
+		_vehicle_torque_setpoint_virtual_fw_sub.registerCallback();
+
+	} else if (!run_on_fw && _vehicle_torque_setpoint_virtual_fw_sub.registered()) {
+		_vehicle_torque_setpoint_virtual_fw_sub.unregisterCallback();
 	}
 
-	return true;
+	if (run_on_mc && !_vehicle_torque_setpoint_virtual_mc_sub.registered()) {
+		_vehicle_torque_setpoint_virtual_mc_sub.registerCallback();
+
+	} else if (!run_on_mc && _vehicle_torque_setpoint_virtual_mc_sub.registered()) {
+		_vehicle_torque_setpoint_virtual_mc_sub.unregisterCallback();
+	}
 }
 
 void VtolAttitudeControl::vehicle_status_poll()
@@ -278,8 +289,6 @@ VtolAttitudeControl::Run()
 	if (should_exit()) {
 		_vehicle_torque_setpoint_virtual_fw_sub.unregisterCallback();
 		_vehicle_torque_setpoint_virtual_mc_sub.unregisterCallback();
-		_vehicle_thrust_setpoint_virtual_fw_sub.unregisterCallback();
-		_vehicle_thrust_setpoint_virtual_mc_sub.unregisterCallback();
 		exit_and_cleanup();
 		return;
 	}
@@ -420,6 +429,8 @@ VtolAttitudeControl::Run()
 			break;
 		}
 
+		update_callback_registration();
+
 		_vtol_type->fill_actuator_outputs();
 
 		_vehicle_torque_setpoint0_pub.publish(_torque_setpoint_0);
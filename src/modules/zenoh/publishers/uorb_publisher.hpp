@@ -42,7 +42,14 @@
 #pragma once
 
 #include "zenoh_publisher.hpp"
+#include "../zenoh_config.hpp"
+#include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
+#include <lib/matrix/matrix/math.hpp>
 #include <uORB/Subscription.hpp>
+#include <uORB/topics/trajectory_setpoint.h>
+#include <uORB/topics/vehicle_local_position.h>
+#include <uORB/topics/vehicle_odometry.h>
 #include <dds_serializer.h>
 
 #define CDR_SAFETY_MARGIN 12
@@ -56,30 +63,50 @@ public:
 		_cdr_ops(ops)
 	{
 		_uorb_sub = orb_subscribe(meta);
+
+		// buffers are allocated once and reused for every sample
+		_data = new uint8_t[_uorb_meta->o_size] {};
+		_buf_size = sizeof(ros2_header) + _uorb_meta->o_size + CDR_SAFETY_MARGIN;
+		_buf = new uint8_t[_buf_size];
+
+		if (_buf) {
+			memcpy(_buf, ros2_header, sizeof(ros2_header));
+		}
 	};
 
-	~uORB_Zenoh_Publisher() override = default;
+	~uORB_Zenoh_Publisher() override
+	{
+		orb_unsubscribe(_uorb_sub);
+		delete[] _data;
+		delete[] _buf;
+	}
 
 	// Update the uORB Subscription and broadcast a Zenoh ROS2 message
 	virtual int8_t update() override
 	{
-		uint8_t data[_uorb_meta->o_size];
-		orb_copy(_uorb_meta, _uorb_sub, data);
+		if (!_data || !_buf) {
+			return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+		}
+
+		orb_copy(_uorb_meta, _uorb_sub, _data);
 
-		uint8_t buf[_uorb_meta->o_size + 4 + CDR_SAFETY_MARGIN];
-		memcpy(buf, ros2_header, sizeof(ros2_header));
+		if (_min_distance > 0.f && decimate()) {
+			return 0;
+		}
 
+		// serialize behind the (constant) ROS2 header
 		dds_ostream_t os;
-		os.m_buffer = buf;
+		os.m_buffer = _buf;
 		os.m_index = (uint32_t)sizeof(ros2_header);
-		os.m_size = (uint32_t)sizeof(ros2_header) + _uorb_meta->o_size + CDR_SAFETY_MARGIN;
+		os.m_size = _buf_size;
 		os.m_xcdr_version = DDSI_RTPS_CDR_ENC_VERSION_2;
 
 		if (dds_stream_write(&os,
 				     &dds_allocator,
-				     (const char *)&data,
+				     (const char *)_data,
 				     _cdr_ops)) {
-			return publish((const uint8_t *)buf, os.m_size);
+			// only the serialized part, not the whole buffer
+			return publish((const uint8_t *)_buf, os.m_index);
 
 		} else {
 			return _Z_ERR_MESSAGE_SERIALIZATION_FAILED;
@@ -92,14 +119,97 @@ public:
 		pfd->events = POLLIN;
 	}
 
+	void setOptions(const Zenoh_Topic_Options &options)
+	{
+		if (options.rate_hz > 0.f) {
+			// the poll only wakes up once per interval
+			orb_set_interval(_uorb_sub, math::max(static_cast<unsigned>(1000.f / options.rate_hz), 1u));
+		}
+
+		if (options.min_distance > 0.f) {
+			matrix::Vector3f position;
+
+			if (getPosition(position)) {
+				_min_distance = options.min_distance;
+
+			} else {
+				PX4_WARN("%s: distance decimation not supported", _uorb_meta->o_name);
+			}
+		}
+
+		_options = options;
+	}
+
 	void print()
 	{
 		printf("uORB %s -> ", _uorb_meta->o_name);
 		Zenoh_Publisher::print();
+
+		if (_options.rate_hz > 0.f || _min_distance > 0.f) {
+			printf("\tlimit %.1f Hz, min distance %.1f m, decimated %u\n", (double)_options.rate_hz,
+			       (double)_min_distance, _decimated);
+		}
 	}
 
 private:
+	static constexpr hrt_abstime DECIMATION_MAX_INTERVAL = 1000000; ///< still publish at 1 Hz when not moving
+
+	/**
+	 * Position of the vehicle for the topics that support distance decimation
+	 */
+	bool getPosition(matrix::Vector3f &position) const
+	{
+		if (_uorb_meta == ORB_ID(vehicle_local_position)) {
+			const vehicle_local_position_s *lpos = reinterpret_cast<const vehicle_local_position_s *>(_data);
+			position = matrix::Vector3f(lpos->x, lpos->y, lpos->z);
+			return true;
+
+		} else if (_uorb_meta == ORB_ID(vehicle_odometry)) {
+			position = matrix::Vector3f(reinterpret_cast<const vehicle_odometry_s *>(_data)->position);
+			return true;
+
+		} else if (_uorb_meta == ORB_ID(trajectory_setpoint)) {
+			position = matrix::Vector3f(reinterpret_cast<const trajectory_setpoint_s *>(_data)->position);
+			return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * Send-on-delta: skip the sample if the vehicle moved less than _min_distance since the last
+	 * published sample. Peers far away do not need a high update rate of a hovering vehicle.
+	 */
+	bool decimate()
+	{
+		matrix::Vector3f position{NAN, NAN, NAN};
+		getPosition(position);
+
+		const hrt_abstime now = hrt_absolute_time();
+
+		if (position.isAllFinite() && _last_position.isAllFinite()
+		    && !(position - _last_position).longerThan(_min_distance)
+		    && (now < _last_publish + DECIMATION_MAX_INTERVAL)) {
+			_decimated++;
+			return true;
+		}
+
+		_last_position = position;
+		_last_publish = now;
+		return false;
+	}
+
+	Zenoh_Topic_Options _options{};
+	float _min_distance{0.f};
+	matrix::Vector3f _last_position{NAN, NAN, NAN};
+	hrt_abstime _last_publish{0};
+	uint32_t _decimated{0};
+
 	const orb_metadata *_uorb_meta;
 	int _uorb_sub;
 	const uint32_t *_cdr_ops;
+
+	uint8_t *_data{nullptr}; ///< uORB sample
+	uint8_t *_buf{nullptr};  ///< ROS2 header + CDR serialized sample
+	uint32_t _buf_size{0};
 };
@@ -67,7 +67,7 @@ protected:
 
 	z_owned_publisher_t _pub;
 
-	char _topic[60]; // The Topic name is somewhere is the Zenoh stack as well but no good api to fetch it.
+	char _topic[80]; // The Topic name is somewhere is the Zenoh stack as well but no good api to fetch it.
 
 	// Indicates ROS2 Topic namespace
 	bool _rostopic;
@@ -56,6 +56,19 @@
 
 extern "C" __EXPORT int zenoh_main(int argc, char *argv[]);
 
+/**
+ * Prefix the key with the vehicle namespace, unless it is absolute (starts with '/')
+ */
+static const char *namespaced_key(char *buf, size_t size, const char *key, int32_t ns_id)
+{
+	if (ns_id <= 0 || key[0] == '/') {
+		return key;
+	}
+
+	snprintf(buf, size, ZENOH_SWARM_NS_FORMAT "%s", (int)ns_id, key);
+	return buf;
+}
+
 ZENOH::ZENOH():
 	ModuleParams(nullptr)
 {
@@ -78,6 +91,17 @@ void ZENOH::run()
 
 	z_config.getNetworkConfig(mode, locator);
 
+	// vehicle namespace for swarms, 0: disabled
+	int32_t ns_id = 0;
+	int32_t swarm_ns = 0;
+	param_get(param_find("ZENOH_SWARM_NS"), &swarm_ns);
+
+	if (swarm_ns && (param_get(param_find("MAV_SYS_ID"), &ns_id) != PX4_OK)) {
+		ns_id = 1;
+	}
+
+	char key[TOPIC_INFO_SIZE + sizeof("px4_255/")];
+
 	z_owned_config_t config = z_config_default();
 	zp_config_insert(z_config_loan(&config), Z_CONFIG_MODE_KEY, z_string_make(mode));
 
@@ -114,7 +138,7 @@ void ZENOH::run()
 			_zenoh_subscribers[i] = genSubscriber(type);
 
 			if (_zenoh_subscribers[i] != 0) {
-				_zenoh_subscribers[i]->declare_subscriber(z_session_loan(&s), topic);
+				_zenoh_subscribers[i]->declare_subscriber(z_session_loan(&s), namespaced_key(key, sizeof(key), topic, ns_id));
 			}
 
 
@@ -136,13 +160,16 @@ void ZENOH::run()
 		char topic[TOPIC_INFO_SIZE];
 		char type[TOPIC_INFO_SIZE];
 
+		Zenoh_Topic_Options options;
+
 		for (i = 0; i < _pub_count; i++) {
-			z_config.getPublisherMapping(topic, type);
+			z_config.getPublisherMapping(topic, type, &options);
 			_zenoh_publishers[i] = genPublisher(type);
 
 			if (_zenoh_publishers[i] != 0) {
-				_zenoh_publishers[i]->declare_publisher(z_session_loan(&s), topic);
+				_zenoh_publishers[i]->declare_publisher(z_session_loan(&s), namespaced_key(key, sizeof(key), topic, ns_id));
 				_zenoh_publishers[i]->setPollFD(&pfds[i]);
+				_zenoh_publishers[i]->setOptions(options);
 			}
 		}
 
@@ -225,12 +252,18 @@ int ZENOH::print_usage(const char *reason)
 ### Description
 
 Zenoh demo bridge
+
+For swarms, enable ZENOH_SWARM_NS to namespace the keys with the vehicle id and use the
+publisher rate limit and distance decimation to share state without saturating the network.
 	)DESC_STR");
 	PRINT_MODULE_USAGE_COMMAND("start");
 	PRINT_MODULE_USAGE_COMMAND("stop");
 	PRINT_MODULE_USAGE_COMMAND("status");
 	PRINT_MODULE_USAGE_COMMAND("config");
-	PX4_INFO_RAW("     addpublisher  <zenoh_topic> <uorb_topic>  Publish uORB topic to Zenoh\n");
+	PX4_INFO_RAW("     addpublisher  <zenoh_topic> <uorb_topic> [rate_hz] [min_dist_m]\n");
+	PX4_INFO_RAW("                   Publish uORB topic to Zenoh, optionally rate limited and\n");
+	PX4_INFO_RAW("                   only after moving min_dist_m (vehicle_local_position,\n");
+	PX4_INFO_RAW("                   vehicle_odometry, trajectory_setpoint)\n");
 	PX4_INFO_RAW("     addsubscriber <zenoh_topic> <uorb_topic>  Publish Zenoh topic to uORB\n");
 	PX4_INFO_RAW("     net           <mode> <locator>            Zenoh network mode\n");
 	PX4_INFO_RAW("          <mode>    values: client|peer   \n");
@@ -92,7 +92,7 @@ Zenoh_Config::~Zenoh_Config()
 	}
 }
 
-int Zenoh_Config::AddPubSub(char *topic, char *datatype, const char *filename)
+int Zenoh_Config::AddPubSub(char *topic, char *datatype, const char *filename, const char *options)
 {
 	{
 		char f_topic[TOPIC_INFO_SIZE];
@@ -116,7 +116,12 @@ int Zenoh_Config::AddPubSub(char *topic, char *datatype, const char *filename)
 			FILE *fp = fopen(filename, "a");
 
 			if (fp) {
-				fprintf(fp, "%s;%s\n", topic, datatype);
+				if (options) {
+					fprintf(fp, "%s;%s;%s\n", topic, datatype, options);
+
+				} else {
+					fprintf(fp, "%s;%s\n", topic, datatype);
+				}
 
 			} else {
 				return -1;
@@ -163,6 +168,18 @@ int Zenoh_Config::cli(int argc, char *argv[])
 			SetNetworkConfig(argv[2], 0);
 		}
 
+	} else if ((argc == 5 || argc == 6) && strcmp(argv[1], "addpublisher") == 0) {
+		// optional rate limit and distance decimation
+		char options[32];
+		snprintf(options, sizeof(options), "%s;%s", argv[4], argc == 6 ? argv[5] : "0");
+
+		if (AddPubSub(argv[2], argv[3], ZENOH_PUB_CONFIG_PATH, options) > 0) {
+			printf("Added %s %s to publishers (%s Hz, %s m)\n", argv[2], argv[3], argv[4], argc == 6 ? argv[5] : "0");
+
+		} else {
+			printf("Could not add uORB %s -> %s to publishers\n",  argv[3], argv[2]);
+		}
+
 	} else if (argc == 4) {
 		if (strcmp(argv[1], "addpublisher") == 0) {
 			if (AddPubSub(argv[2], argv[3], ZENOH_PUB_CONFIG_PATH) > 0) {
@@ -262,7 +279,7 @@ int Zenoh_Config::getLineCount(const char *filename)
 }
 
 // Very rudamentary here but we've to wait for a more advanced param system
-int Zenoh_Config::getPubSubMapping(char *topic, char *type, const char *filename)
+int Zenoh_Config::getPubSubMapping(char *topic, char *type, const char *filename, Zenoh_Topic_Options *options)
 {
 	char buffer[MAX_LINE_SIZE];
 
@@ -273,11 +290,26 @@ int Zenoh_Config::getPubSubMapping(char *topic, char *type, const char *filename
 	if (fp_mapping) {
 		while (fgets(buffer, MAX_LINE_SIZE, fp_mapping) != NULL) {
 			if (buffer[0] != '\n') {
-				const char *config_type = get_csv_field(buffer, 2);
-				const char *config_topic = get_csv_field(buffer, 1);
+				// <zenoh topic>;<uORB topic>[;<rate Hz>[;<min distance m>]]
+				const char *fields[4] {};
+				int num_fields = 0;
+
+				for (char *tok = strtok(buffer, ";\n"); tok && num_fields < 4; tok = strtok(NULL, ";\n")) {
+					fields[num_fields++] = tok;
+				}
+
+				if (num_fields < 2) {
+					continue;
+				}
+
+				strncpy(type, fields[1], TOPIC_INFO_SIZE);
+				strncpy(topic, fields[0], TOPIC_INFO_SIZE);
+
+				if (options) {
+					options->rate_hz = (num_fields > 2) ? strtof(fields[2], nullptr) : 0.f;
+					options->min_distance = (num_fields > 3) ? strtof(fields[3], nullptr) : 0.f;
+				}
 
-				strncpy(type, config_type, TOPIC_INFO_SIZE);
-				strncpy(topic, config_topic, TOPIC_INFO_SIZE);
 				return 1;
 			}
 
@@ -320,11 +352,21 @@ void Zenoh_Config::dump_config()
 		char topic[TOPIC_INFO_SIZE];
 		char type[TOPIC_INFO_SIZE];
 
+		Zenoh_Topic_Options options;
+
 		printf("Publisher config:\n");
 
-		while (getPubSubMapping(topic, type, ZENOH_PUB_CONFIG_PATH) > 0) {
+		while (getPubSubMapping(topic, type, ZENOH_PUB_CONFIG_PATH, &options) > 0) {
 			printf("Topic: %s\n", topic);
 			printf("Type: %s\n", type);
+
+			if (options.rate_hz > 0.f) {
+				printf("Rate limit: %.1f Hz\n", (double)options.rate_hz);
+			}
+
+			if (options.min_distance > 0.f) {
+				printf("Min distance: %.1f m\n", (double)options.min_distance);
+			}
 		}
 
 		printf("\nSubscriber config:\n");
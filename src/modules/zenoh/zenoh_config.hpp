@@ -60,6 +60,16 @@
 #define TOPIC_INFO_SIZE 64
 #define MAX_LINE_SIZE 2*TOPIC_INFO_SIZE
 
+#define ZENOH_SWARM_NS_FORMAT "px4_%d/"
+
+/**
+ * Optional per publisher settings, the 3rd and 4th field of a publisher mapping
+ */
+struct Zenoh_Topic_Options {
+	float rate_hz{0.f};      ///< maximum publication rate [Hz], 0: unlimited
+	float min_distance{0.f}; ///< only publish after the vehicle moved this far [m], 0: disabled
+};
+
 class Zenoh_Config
 {
 public:
@@ -77,9 +87,9 @@ public:
 	{
 		return getLineCount(ZENOH_SUB_CONFIG_PATH);
 	}
-	int getPublisherMapping(char *topic, char *type)
+	int getPublisherMapping(char *topic, char *type, Zenoh_Topic_Options *options = nullptr)
 	{
-		return getPubSubMapping(topic, type, ZENOH_PUB_CONFIG_PATH);
+		return getPubSubMapping(topic, type, ZENOH_PUB_CONFIG_PATH, options);
 	}
 	int getSubscriberMapping(char *topic, char *type)
 	{
@@ -88,8 +98,8 @@ public:
 
 
 private:
-	int getPubSubMapping(char *topic, char *type, const char *filename);
-	int AddPubSub(char *topic, char *datatype, const char *filename);
+	int getPubSubMapping(char *topic, char *type, const char *filename, Zenoh_Topic_Options *options = nullptr);
+	int AddPubSub(char *topic, char *datatype, const char *filename, const char *options = nullptr);
 	int SetNetworkConfig(char *mode, char *locator);
 	int getLineCount(const char *filename);
 
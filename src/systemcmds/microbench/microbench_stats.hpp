@@ -0,0 +1,103 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file microbench_stats.hpp
+ * Latency sample collection with a common min/mean/p99/max summary.
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include <drivers/drv_hrt.h>
+
+namespace microbench
+{
+
+template<int N>
+class LatencyStats
+{
+public:
+	void reset() { _count = 0; }
+
+	void add(hrt_abstime elapsed)
+	{
+		if (_count < N) {
+			_samples[_count++] = (elapsed < UINT32_MAX) ? (uint32_t)elapsed : UINT32_MAX;
+		}
+	}
+
+	int count() const { return _count; }
+
+	/**
+	 * Print the summary as "<name>: n <count> min <us> mean <us> p99 <us> max <us>"
+	 * so the output can be compared release to release.
+	 */
+	void print(const char *name)
+	{
+		if (_count == 0) {
+			printf("%s: no samples\n", name);
+			return;
+		}
+
+		qsort(_samples, _count, sizeof(_samples[0]), compare);
+
+		uint64_t sum = 0;
+
+		for (int i = 0; i < _count; i++) {
+			sum += _samples[i];
+		}
+
+		const int p99 = ((_count * 99) - 1) / 100;
+
+		printf("%s: n %d min %lu mean %.2f p99 %lu max %lu us\n", name, _count,
+		       (unsigned long)_samples[0], (double)sum / (double)_count,
+		       (unsigned long)_samples[p99], (unsigned long)_samples[_count - 1]);
+	}
+
+private:
+	static int compare(const void *a, const void *b)
+	{
+		const uint32_t x = *static_cast<const uint32_t *>(a);
+		const uint32_t y = *static_cast<const uint32_t *>(b);
+		return (x > y) - (x < y);
+	}
+
+	uint32_t _samples[N] {};
+	int _count{0};
+};
+
+} // namespace microbench
@@ -44,6 +44,7 @@
 #include <math.h>
 
 #include <drivers/drv_hrt.h>
+#include <lib/mathlib/math/FastMath.hpp>
 #include <perf/perf_counter.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/micro_hal.h>
@@ -105,6 +106,7 @@ public:
 private:
 	bool time_single_precision_float();
 	bool time_single_precision_float_trig();
+	bool time_single_precision_float_trig_approx();
 
 	bool time_double_precision_float();
 	bool time_double_precision_float_trig();
@@ -142,6 +144,7 @@ bool MicroBenchMath::run_tests()
 {
 	ut_run_test(time_single_precision_float);
 	ut_run_test(time_single_precision_float_trig);
+	ut_run_test(time_single_precision_float_trig_approx);
 	ut_run_test(time_double_precision_float);
 	ut_run_test(time_double_precision_float_trig);
 	ut_run_test(time_8bit_integers);
@@ -212,6 +215,21 @@ bool MicroBenchMath::time_single_precision_float_trig()
 	return true;
 }
 
+bool MicroBenchMath::time_single_precision_float_trig_approx()
+{
+	float sin_out;
+	float cos_out;
+
+	PERF("sinf()+cosf() (1k ops)", sin_out = sinf(f32); cos_out = cosf(f32); f32_out = sin_out + cos_out, 1000);
+	PERF("math::sincos_approx() (1k ops)", math::sincos_approx(f32, sin_out, cos_out); f32_out = sin_out + cos_out, 1000);
+	PERF("math::sin_approx() (1k ops)", f32_out = math::sin_approx(f32), 1000);
+	PERF("atanf() (1k ops)", f32_out = atanf(f32), 1000);
+	PERF("math::atan_approx() (1k ops)", f32_out = math::atan_approx(f32), 1000);
+	PERF("math::atan2_approx() (1k ops)", f32_out = math::atan2_approx(f32, 2.0f * f32), 1000);
+
+	return true;
+}
+
 bool MicroBenchMath::time_double_precision_float()
 {
 	PERF("double add (1k ops)", f64_out += f64, 1000);
@@ -99,6 +99,8 @@ private:
 	bool time_matrix_quaternion();
 	bool time_matrix_dcm();
 	bool time_matrix_pseduo_inverse();
+	bool time_matrix_covariance_update();
+	bool time_matrix_multiplication();
 
 	void reset();
 
@@ -108,14 +110,80 @@ private:
 	matrix::Matrix<float, 16, 6> A16;
 	matrix::Matrix<float, 6, 16> B16;
 	matrix::Matrix<float, 6, 16> B16_4;
+
+	// EKF2 sized covariance update
+	matrix::SquareMatrix<float, 23> P23;
+	matrix::Vector<float, 23> K23;
+	matrix::Vector<float, 23> H23;
+	matrix::SparseVectorf<23, 0, 1, 2> H23_sparse;
+
+	matrix::SquareMatrix<float, 4> M4;
+	matrix::SquareMatrix<float, 4> M4_res;
+	matrix::SquareMatrix<float, 23> P23_res;
+	matrix::SquareMatrix<float, 6> M6_res;
 };
 
+// reference: scalar matrix multiplication, same as the default Matrix::operator*
+template<size_t M, size_t N, size_t P>
+static matrix::Matrix<float, M, P> multiply_scalar(const matrix::Matrix<float, M, N> &A, const matrix::Matrix<float, N, P> &B)
+{
+	matrix::Matrix<float, M, P> res{};
+
+	for (size_t i = 0; i < M; i++) {
+		for (size_t k = 0; k < P; k++) {
+			for (size_t j = 0; j < N; j++) {
+				res(i, k) += A(i, j) * B(j, k);
+			}
+		}
+	}
+
+	return res;
+}
+
+// reference: two pass Joseph stabilized update (full P_temp, then the stabilized update of the lower triangle)
+static void covariance_update_two_pass(matrix::SquareMatrix<float, 23> &P, const matrix::Vector<float, 23> &K,
+				       const matrix::Vector<float, 23> &H, float R)
+{
+	matrix::Vector<float, 23> PH = P * H;
+
+	for (unsigned i = 0; i < 23; i++) {
+		for (unsigned j = 0; j < 23; j++) {
+			P(i, j) -= K(i) * PH(j);
+		}
+	}
+
+	PH = P * H;
+
+	for (unsigned i = 0; i < 23; i++) {
+		for (unsigned j = 0; j <= i; j++) {
+			P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * R * K(j);
+			P(j, i) = P(i, j);
+		}
+	}
+}
+
+static void covariance_update_joseph(matrix::SquareMatrix<float, 23> &P, const matrix::Vector<float, 23> &K,
+				     const matrix::Vector<float, 23> &H, float R)
+{
+	const matrix::Vector<float, 23> PH = P * H;
+	P.josephUpdate(K, PH, H.dot(PH) + R);
+}
+
+static void covariance_update_joseph_sparse(matrix::SquareMatrix<float, 23> &P, const matrix::Vector<float, 23> &K,
+		const matrix::SparseVectorf<23, 0, 1, 2> &H, float R)
+{
+	const matrix::Vector<float, 23> PH = P * H;
+	P.josephUpdate(K, PH, H.dot(PH) + R);
+}
+
 bool MicroBenchMatrix::run_tests()
 {
 	ut_run_test(time_matrix_euler);
 	ut_run_test(time_matrix_quaternion);
 	ut_run_test(time_matrix_dcm);
 	ut_run_test(time_matrix_pseduo_inverse);
+	ut_run_test(time_matrix_covariance_update);
+	ut_run_test(time_matrix_multiplication);
 
 	return (_tests_failed == 0);
 }
@@ -145,6 +213,26 @@ void MicroBenchMatrix::reset()
 			B16_4(j, i) = random(-10.0, 10.0);
 		}
 	}
+
+	// diagonally dominant symmetric covariance, attitude observation jacobian
+	for (size_t j = 0; j < 23; j++) {
+		for (size_t i = j; i < 23; i++) {
+			P23(j, i) = P23(i, j) = (i == j) ? random(1.0, 2.0) : random(-0.01, 0.01);
+		}
+
+		H23(j) = (j < 3) ? random(-1.0, 1.0) : 0.f;
+	}
+
+	H23_sparse = matrix::SparseVectorf<23, 0, 1, 2>(H23);
+
+	for (size_t j = 0; j < 4; j++) {
+		for (size_t i = 0; i < 4; i++) {
+			M4(j, i) = random(-10.0, 10.0);
+		}
+	}
+
+	const matrix::Vector<float, 23> PH = P23 * H23;
+	K23 = PH / (H23.dot(PH) + 0.1f);
 }
 
 bool MicroBenchMatrix::time_matrix_euler()
@@ -175,6 +263,33 @@ bool MicroBenchMatrix::time_matrix_pseduo_inverse()
 	return true;
 }
 
+bool MicroBenchMatrix::time_matrix_covariance_update()
+{
+	PERF("matrix 23x23 covariance update (two pass)", covariance_update_two_pass(P23, K23, H23, 0.1f), 100);
+	PERF("matrix 23x23 covariance update (Joseph, dense H)", covariance_update_joseph(P23, K23, H23, 0.1f), 100);
+	PERF("matrix 23x23 covariance update (Joseph, 3 non-zero H)", covariance_update_joseph_sparse(P23, K23, H23_sparse, 0.1f),
+	     100);
+	return true;
+}
+
+bool MicroBenchMatrix::time_matrix_multiplication()
+{
+	// the default operator* uses the SIMD kernels if enabled (CONFIG_LIB_MATRIX_SIMD)
+	PERF("matrix 4x4 * 4x4 (scalar)", M4_res = multiply_scalar(M4, M4), 100);
+	PERF("matrix 4x4 * 4x4", M4_res = M4 * M4, 100);
+	PERF("matrix 23x23 * 23x23 (scalar)", P23_res = multiply_scalar(P23, P23), 100);
+	PERF("matrix 23x23 * 23x23", P23_res = P23 * P23, 100);
+	PERF("matrix 6x16 * 16x6 (scalar)", M6_res = multiply_scalar(B16, B16.transpose()), 100);
+	PERF("matrix 6x16 * 16x6", M6_res = B16 * B16.transpose(), 100);
+	PERF("matrix 23x23 + 23x23", P23_res = P23 + P23, 100);
+
+	ut_compare_float("23x23 SIMD matches scalar", (P23 * P23 - multiply_scalar(P23, P23)).abs().max(), 0.f, 4);
+	ut_compare_float("6x16 SIMD matches scalar", (B16 * B16.transpose() - multiply_scalar(B16, B16.transpose())).abs().max(),
+			 0.f, 4);
+
+	return true;
+}
+
 ut_declare_test_c(test_microbench_matrix, MicroBenchMatrix)
 
 } // namespace MicroBenchMatrix
@@ -0,0 +1,126 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_microbench_param.cpp
+ * Microbenchmarks for parameter lookup and access.
+ */
+
+#include <unit_test.h>
+
+#include <drivers/drv_hrt.h>
+#include <parameters/param.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/time.h>
+
+#include "microbench_stats.hpp"
+
+namespace MicroBenchParam
+{
+
+static constexpr int SAMPLES = 200;
+
+#define PERF_STATS(name, op) do { \
+		_stats.reset(); \
+		for (int i = 0; i < SAMPLES; i++) { \
+			const hrt_abstime t0 = hrt_absolute_time(); \
+			op; \
+			_stats.add(hrt_elapsed_time(&t0)); \
+		} \
+		_stats.print(name); \
+	} while (0)
+
+class MicroBenchParam : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+	bool time_param_find();
+	bool time_param_get();
+
+	microbench::LatencyStats<SAMPLES> _stats;
+};
+
+bool MicroBenchParam::run_tests()
+{
+	ut_run_test(time_param_find);
+	ut_run_test(time_param_get);
+
+	return (_tests_failed == 0);
+}
+
+ut_declare_test_c(test_microbench_param, MicroBenchParam)
+
+bool MicroBenchParam::time_param_find()
+{
+	param_t handle = PARAM_INVALID;
+
+	PERF_STATS("param_find SYS_AUTOSTART", handle = param_find("SYS_AUTOSTART"));
+	PERF_STATS("param_find_no_notification SYS_AUTOSTART", handle = param_find_no_notification("SYS_AUTOSTART"));
+	PERF_STATS("param_find_no_notification unknown", handle = param_find_no_notification("MICROBENCH_XX"));
+
+	return true;
+}
+
+bool MicroBenchParam::time_param_get()
+{
+	const param_t handle_int = param_find("SYS_AUTOSTART");
+	param_t handle_float = PARAM_INVALID;
+
+	for (unsigned i = 0; i < param_count_used(); i++) {
+		const param_t handle = param_for_used_index(i);
+
+		if (param_type(handle) == PARAM_TYPE_FLOAT) {
+			handle_float = handle;
+			break;
+		}
+	}
+
+	if (handle_int == PARAM_INVALID) {
+		PX4_ERR("SYS_AUTOSTART not found");
+		return false;
+	}
+
+	int32_t value_int = 0;
+	PERF_STATS("param_get int32", param_get(handle_int, &value_int));
+
+	if (handle_float != PARAM_INVALID) {
+		float value_float = 0.f;
+		PERF_STATS("param_get float", param_get(handle_float, &value_float));
+	}
+
+	return true;
+}
+
+} // namespace MicroBenchParam
@@ -47,6 +47,7 @@
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/micro_hal.h>
 
+#include <uORB/PublicationMulti.hpp>
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/sensor_accel.h>
 #include <uORB/topics/sensor_gyro.h>
@@ -102,6 +103,7 @@ private:
 
 	bool time_px4_uorb();
 	bool time_px4_uorb_direct();
+	bool time_px4_uorb_loan();
 
 	void reset();
 
@@ -115,6 +117,7 @@ bool MicroBenchORB::run_tests()
 {
 	ut_run_test(time_px4_uorb);
 	ut_run_test(time_px4_uorb_direct);
+	ut_run_test(time_px4_uorb_loan);
 
 	return (_tests_failed == 0);
 }
@@ -246,4 +249,53 @@ bool MicroBenchORB::time_px4_uorb_direct()
 	return true;
 }
 
+bool MicroBenchORB::time_px4_uorb_loan()
+{
+	bool ret = false;
+
+	// separate instance to not interfere with real sensor data
+	uORB::PublicationMulti<sensor_gyro_fifo_s> gyro_fifo_pub{ORB_ID(sensor_gyro_fifo)};
+	const int instance = gyro_fifo_pub.get_instance();
+
+	if (instance < 0) {
+		PX4_ERR("sensor_gyro_fifo advertise failed");
+		return false;
+	}
+
+	uORB::Subscription gyro_fifo_sub{ORB_ID(sensor_gyro_fifo), (uint8_t)instance};
+
+	PERF("uORB::PublicationMulti publish sensor_gyro_fifo", ret = gyro_fifo_pub.publish(gyro_fifo), 100);
+
+	PERF("uORB::PublicationMulti loan/commit sensor_gyro_fifo", {
+		sensor_gyro_fifo_s *loaned = gyro_fifo_pub.loan();
+
+		if (loaned) {
+			loaned->timestamp = gyro_fifo.timestamp;
+			loaned->samples = gyro_fifo.samples;
+			ret = gyro_fifo_pub.commit();
+		}
+	}, 100);
+
+	printf("\n");
+
+	PERF("uORB::Subscription update sensor_gyro_fifo", {
+		gyro_fifo_pub.publish(gyro_fifo);
+		ret = gyro_fifo_sub.update(&gyro_fifo);
+	}, 100);
+
+	PERF("uORB::Subscription borrow/release sensor_gyro_fifo", {
+		gyro_fifo_pub.publish(gyro_fifo);
+		const sensor_gyro_fifo_s *borrowed = static_cast<const sensor_gyro_fifo_s *>(gyro_fifo_sub.borrow());
+
+		if (borrowed) {
+			gyro_fifo.samples = borrowed->samples;
+			ret = gyro_fifo_sub.release();
+		}
+	}, 100);
+
+	gyro_fifo_pub.unadvertise();
+
+	return true;
+}
+
 } // namespace MicroBenchORB
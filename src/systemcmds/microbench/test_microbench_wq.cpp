@@ -0,0 +1,268 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_microbench_wq.cpp
+ * Microbenchmarks for work queue scheduling and uORB callback latency.
+ */
+
+#include <unit_test.h>
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+#include <px4_platform_common/time.h>
+
+#include <uORB/PublicationMulti.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/orb_test.h>
+
+#include "microbench_stats.hpp"
+
+using namespace time_literals;
+
+namespace MicroBenchWQ
+{
+
+static constexpr int SAMPLES = 200;
+static constexpr int FANOUT_MAX = 8;
+static constexpr hrt_abstime TIMEOUT_US = 100_ms;
+
+/**
+ * Work item recording the time from ScheduleNow() (or publication) to Run().
+ */
+class LatencyWorkItem : public px4::WorkItem
+{
+public:
+	LatencyWorkItem() : px4::WorkItem("microbench_wq", px4::wq_configurations::test1) {}
+	~LatencyWorkItem() override { _orb_test_sub.unregisterCallback(); }
+
+	bool registerCallback(uint8_t instance)
+	{
+		_orb_test_sub.ChangeInstance(instance);
+		return _orb_test_sub.registerCallback();
+	}
+
+	void schedule()
+	{
+		_done.store(false);
+		_scheduled = hrt_absolute_time();
+		ScheduleNow();
+	}
+
+	void arm() { _done.store(false); }
+
+	/**
+	 * Wait for the next Run() and return its latency, or 0 on timeout.
+	 */
+	hrt_abstime wait()
+	{
+		const hrt_abstime start = hrt_absolute_time();
+
+		while (!_done.load()) {
+			if (hrt_elapsed_time(&start) > TIMEOUT_US) {
+				return 0;
+			}
+
+			px4_usleep(50);
+		}
+
+		return _latency;
+	}
+
+private:
+	void Run() override
+	{
+		const hrt_abstime now = hrt_absolute_time();
+		orb_test_s orb_test;
+
+		if (_orb_test_sub.update(&orb_test)) {
+			_latency = now - orb_test.timestamp;
+
+		} else {
+			_latency = now - _scheduled;
+		}
+
+		_done.store(true);
+	}
+
+	uORB::SubscriptionCallbackWorkItem _orb_test_sub{this, ORB_ID(orb_multitest)};
+
+	hrt_abstime _scheduled{0};
+	hrt_abstime _latency{0};
+	px4::atomic_bool _done{false};
+};
+
+class MicroBenchWQ : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+	bool time_wq_schedule();
+	bool time_uorb_publish_callback();
+	bool time_uorb_callback_fanout();
+
+	microbench::LatencyStats<SAMPLES> _stats;
+};
+
+bool MicroBenchWQ::run_tests()
+{
+	ut_run_test(time_wq_schedule);
+	ut_run_test(time_uorb_publish_callback);
+	ut_run_test(time_uorb_callback_fanout);
+
+	return (_tests_failed == 0);
+}
+
+ut_declare_test_c(test_microbench_wq, MicroBenchWQ)
+
+bool MicroBenchWQ::time_wq_schedule()
+{
+	LatencyWorkItem work_item;
+	_stats.reset();
+
+	for (int i = 0; i < SAMPLES; i++) {
+		px4_usleep(100);
+		work_item.schedule();
+		const hrt_abstime latency = work_item.wait();
+
+		if (latency == 0) {
+			PX4_ERR("work item timeout");
+			return false;
+		}
+
+		_stats.add(latency);
+	}
+
+	_stats.print("WorkItem ScheduleNow -> Run");
+
+	return true;
+}
+
+bool MicroBenchWQ::time_uorb_publish_callback()
+{
+	// separate instance to not interfere with other users of the topic
+	uORB::PublicationMulti<orb_test_s> orb_test_pub{ORB_ID(orb_multitest)};
+	orb_test_s orb_test{};
+	orb_test_pub.publish(orb_test);
+
+	const int instance = orb_test_pub.get_instance();
+
+	if (instance < 0) {
+		PX4_ERR("orb_multitest advertise failed");
+		return false;
+	}
+
+	LatencyWorkItem work_item;
+
+	if (!work_item.registerCallback(instance)) {
+		PX4_ERR("registerCallback failed");
+		return false;
+	}
+
+	// consume the initial publication
+	px4_usleep(1000);
+	_stats.reset();
+
+	for (int i = 0; i < SAMPLES; i++) {
+		px4_usleep(100);
+		work_item.arm();
+		orb_test.val = i;
+		orb_test.timestamp = hrt_absolute_time();
+		orb_test_pub.publish(orb_test);
+		const hrt_abstime latency = work_item.wait();
+
+		if (latency == 0) {
+			PX4_ERR("callback timeout");
+			return false;
+		}
+
+		_stats.add(latency);
+	}
+
+	_stats.print("uORB publish -> SubscriptionCallbackWorkItem Run");
+
+	return true;
+}
+
+bool MicroBenchWQ::time_uorb_callback_fanout()
+{
+	uORB::PublicationMulti<orb_test_s> orb_test_pub{ORB_ID(orb_multitest)};
+	orb_test_s orb_test{};
+	orb_test_pub.publish(orb_test);
+
+	const int instance = orb_test_pub.get_instance();
+
+	if (instance < 0) {
+		PX4_ERR("orb_multitest advertise failed");
+		return false;
+	}
+
+	static constexpr int fanout[] {0, 1, 2, 4, FANOUT_MAX};
+	LatencyWorkItem work_items[FANOUT_MAX];
+	int registered = 0;
+
+	for (int callbacks : fanout) {
+		while (registered < callbacks) {
+			if (!work_items[registered].registerCallback(instance)) {
+				PX4_ERR("registerCallback failed");
+				return false;
+			}
+
+			registered++;
+		}
+
+		px4_usleep(1000);
+		_stats.reset();
+
+		for (int i = 0; i < SAMPLES; i++) {
+			// let the previous round of callbacks drain
+			px4_usleep(200);
+
+			orb_test.val = i;
+			orb_test.timestamp = hrt_absolute_time();
+			orb_test_pub.publish(orb_test);
+			_stats.add(hrt_elapsed_time(&orb_test.timestamp));
+		}
+
+		char name[48];
+		snprintf(name, sizeof(name), "uORB publish with %d callbacks", callbacks);
+		_stats.print(name);
+	}
+
+	return true;
+}
+
+} // namespace MicroBenchWQ
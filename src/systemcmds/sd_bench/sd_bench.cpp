@@ -42,6 +42,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <errno.h>
+#include <pthread.h>
 
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/module.h>
@@ -49,6 +50,8 @@
 #include <px4_platform_common/log.h>
 
 #include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/atomic.h>
 
 #define MAX(a,b) ((a) > (b) ? (a) : (b))
 
@@ -58,12 +61,21 @@ typedef struct sdb_config {
 	bool synchronized; ///< call fsync after each block?
 	int unaligned;
 	unsigned int total_blocks_written;
+	bool logger_profile; ///< emulate the logger write pattern
+	bool metadata; ///< concurrent dataman and parameter writes
+	int rate; ///< logger profile write rate [KB/s], 0 = unlimited
 } sdb_config_t;
 
 /** sequential write speed test */
 static void write_test(int fd, sdb_config_t *cfg, uint8_t *block, int block_size);
 /** sequential read speed test */
 static int read_test(int fd, sdb_config_t *cfg, uint8_t *block, int block_size);
+/** write test with the access pattern of the logger (LogWriterFile) */
+static void logger_test(int fd, sdb_config_t *cfg, uint8_t *block, int block_size);
+/** concurrent small writes as done by dataman and parameter saves */
+static void *metadata_thread(void *arg);
+/** print the latency percentiles of a histogram counter */
+static void print_latency(perf_counter_t perf);
 
 /**
  * Measure the time for fsync.
@@ -73,10 +85,35 @@ static int read_test(int fd, sdb_config_t *cfg, uint8_t *block, int block_size);
 static inline unsigned int time_fsync(int fd);
 
 static const char *BENCHMARK_FILE = PX4_STORAGEDIR"/benchmark.tmp";
+static const char *BENCHMARK_DATAMAN_FILE = PX4_STORAGEDIR"/benchmark_dm.tmp";
+static const char *BENCHMARK_PARAM_FILE = PX4_STORAGEDIR"/benchmark_param.tmp";
+
+static constexpr int LOGGER_FSYNC_WRITES = 100; ///< LogWriterFile calls fsync every 100 writes...
+static constexpr hrt_abstime LOGGER_FSYNC_INTERVAL = 1000000; ///< ...or every second
+
+static constexpr hrt_abstime DATAMAN_WRITE_INTERVAL = 50000; ///< mission item upload rate
+static constexpr int DATAMAN_ITEM_SIZE = 128;
+static constexpr int DATAMAN_ITEMS = 500;
+static constexpr hrt_abstime PARAM_SAVE_INTERVAL = 1000000;
+static constexpr int PARAM_FILE_SIZE = 2048;
+
+struct metadata_state {
+	px4::atomic_bool should_exit{false};
+	perf_counter_t dataman_perf{nullptr};
+	perf_counter_t param_perf{nullptr};
+};
 
 static void usage()
 {
-	PRINT_MODULE_DESCRIPTION("Test the speed of an SD Card");
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+Test the speed of an SD Card.
+
+With -l the write pattern of the logger is emulated: blocks are written at the given rate with an fsync
+every 100 writes or every second, and the latency percentiles of the writes and fsyncs are reported.
+Add -m to run dataman-like record writes and parameter file saves concurrently, which is where
+most of the latency outliers of real flights come from.
+)DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME_SIMPLE("sd_bench", "command");
 	PRINT_MODULE_USAGE_PARAM_INT('b', 4096, 1, 1000000, "Block size for each read/write", true);
@@ -87,6 +124,9 @@ static void usage()
 	PRINT_MODULE_USAGE_PARAM_FLAG('u', "Test performance with unaligned data", true);
 	PRINT_MODULE_USAGE_PARAM_FLAG('U', "Test performance with forced byte unaligned data", true);
 	PRINT_MODULE_USAGE_PARAM_FLAG('v', "Verify data and block number", true);
+	PRINT_MODULE_USAGE_PARAM_FLAG('l', "Emulate the logger write pattern and report latency percentiles", true);
+	PRINT_MODULE_USAGE_PARAM_FLAG('m', "Concurrent dataman and parameter writes (with -l)", true);
+	PRINT_MODULE_USAGE_PARAM_INT('R', 0, 0, 100000, "Logger write rate in KB/s, 0 for unlimited (with -l)", true);
 }
 
 extern "C" __EXPORT int sd_bench_main(int argc, char *argv[])
@@ -102,10 +142,13 @@ extern "C" __EXPORT int sd_bench_main(int argc, char *argv[])
 	cfg.num_runs = 5;
 	cfg.run_duration = 2000;
 	cfg.unaligned = 0;
+	cfg.logger_profile = false;
+	cfg.metadata = false;
+	cfg.rate = 0;
 	uint8_t *block = nullptr;
 	uint8_t *block_alloc = nullptr;
 
-	while ((ch = px4_getopt(argc, argv, "b:r:d:ksuUv", &myoptind, &myoptarg)) != EOF) {
+	while ((ch = px4_getopt(argc, argv, "b:r:d:ksuUvlmR:", &myoptind, &myoptarg)) != EOF) {
 		switch (ch) {
 		case 'b':
 			block_size = strtol(myoptarg, nullptr, 0);
@@ -139,6 +182,18 @@ extern "C" __EXPORT int sd_bench_main(int argc, char *argv[])
 			verify = true;
 			break;
 
+		case 'l':
+			cfg.logger_profile = true;
+			break;
+
+		case 'm':
+			cfg.metadata = true;
+			break;
+
+		case 'R':
+			cfg.rate = strtol(myoptarg, nullptr, 0);
+			break;
+
 		default:
 			usage();
 			return -1;
@@ -146,7 +201,7 @@ extern "C" __EXPORT int sd_bench_main(int argc, char *argv[])
 		}
 	}
 
-	if (block_size <= 0 || cfg.num_runs <= 0) {
+	if (block_size <= 0 || cfg.num_runs <= 0 || cfg.rate < 0) {
 		PX4_ERR("invalid argument");
 		return -1;
 	}
@@ -190,7 +245,13 @@ extern "C" __EXPORT int sd_bench_main(int argc, char *argv[])
 	}
 
 	PX4_INFO("Using block size = %i bytes, sync=%i", block_size, (int)cfg.synchronized);
-	write_test(bench_fd, &cfg, block, block_size);
+
+	if (cfg.logger_profile) {
+		logger_test(bench_fd, &cfg, block, block_size);
+
+	} else {
+		write_test(bench_fd, &cfg, block, block_size);
+	}
 
 	if (verify) {
 		fsync(bench_fd);
@@ -367,3 +428,181 @@ int read_test(int fd, sdb_config_t *cfg, uint8_t *block, int block_size)
 	free(block_alloc);
 	return 0;
 }
+
+void print_latency(perf_counter_t perf)
+{
+	PX4_INFO("  %-20s n %6llu  p50 %6u  p90 %6u  p99 %6u  p99.9 %6u  max %6u us", perf_name(perf),
+		 (unsigned long long)perf_event_count(perf), perf_percentile(perf, 50.f), perf_percentile(perf, 90.f),
+		 perf_percentile(perf, 99.f), perf_percentile(perf, 99.9f), perf_percentile(perf, 100.f));
+}
+
+void *metadata_thread(void *arg)
+{
+	metadata_state *state = (metadata_state *)arg;
+
+	int dm_fd = open(BENCHMARK_DATAMAN_FILE, O_CREAT | O_RDWR | O_TRUNC, PX4_O_MODE_666);
+
+	if (dm_fd < 0) {
+		PX4_ERR("Can't open %s", BENCHMARK_DATAMAN_FILE);
+		return nullptr;
+	}
+
+	uint8_t record[DATAMAN_ITEM_SIZE];
+
+	for (int i = 0; i < DATAMAN_ITEM_SIZE; ++i) {
+		record[i] = (uint8_t)i;
+	}
+
+	hrt_abstime next_param_save = hrt_absolute_time() + PARAM_SAVE_INTERVAL;
+	int item = 0;
+
+	while (!state->should_exit.load()) {
+		px4_usleep(DATAMAN_WRITE_INTERVAL);
+
+		// dataman file backend: write a record at its offset, then fsync
+		perf_begin(state->dataman_perf);
+
+		if (pwrite(dm_fd, record, sizeof(record), (off_t)item * sizeof(record)) == sizeof(record)) {
+			fsync(dm_fd);
+		}
+
+		perf_end(state->dataman_perf);
+
+		item = (item + 1) % DATAMAN_ITEMS;
+
+		// parameter save: truncate, write in small chunks, fsync, close
+		if (hrt_absolute_time() >= next_param_save) {
+			next_param_save += PARAM_SAVE_INTERVAL;
+
+			perf_begin(state->param_perf);
+			int param_fd = open(BENCHMARK_PARAM_FILE, O_CREAT | O_WRONLY | O_TRUNC, PX4_O_MODE_666);
+
+			if (param_fd >= 0) {
+				for (int written = 0; written < PARAM_FILE_SIZE; written += sizeof(record)) {
+					if (write(param_fd, record, sizeof(record)) != sizeof(record)) {
+						break;
+					}
+				}
+
+				fsync(param_fd);
+				close(param_fd);
+			}
+
+			perf_end(state->param_perf);
+		}
+	}
+
+	close(dm_fd);
+	unlink(BENCHMARK_DATAMAN_FILE);
+	unlink(BENCHMARK_PARAM_FILE);
+
+	return nullptr;
+}
+
+void logger_test(int fd, sdb_config_t *cfg, uint8_t *block, int block_size)
+{
+	PX4_INFO("");
+	PX4_INFO("Testing Logger Write Pattern (rate: %i KB/s, concurrent metadata writes: %i)...", cfg->rate,
+		 (int)cfg->metadata);
+
+	perf_counter_t write_perf = perf_alloc(PC_HISTOGRAM, "sd_bench: write");
+	perf_counter_t fsync_perf = perf_alloc(PC_HISTOGRAM, "sd_bench: fsync");
+
+	metadata_state state{};
+	pthread_t thread{};
+	bool thread_running = false;
+
+	if (cfg->metadata) {
+		state.dataman_perf = perf_alloc(PC_HISTOGRAM, "sd_bench: dataman");
+		state.param_perf = perf_alloc(PC_HISTOGRAM, "sd_bench: param save");
+		thread_running = (pthread_create(&thread, nullptr, metadata_thread, &state) == 0);
+
+		if (!thread_running) {
+			PX4_ERR("failed to start metadata thread");
+		}
+	}
+
+	// time per block to achieve the requested rate
+	const hrt_abstime block_interval = (cfg->rate > 0) ? (hrt_abstime)block_size * 1000000 / ((hrt_abstime)cfg->rate * 1024) :
+					   0;
+
+	double total_elapsed = 0.;
+	unsigned int total_blocks = 0;
+	cfg->total_blocks_written = 0;
+	unsigned int *blocknumber = (unsigned int *)(void *)&block[0];
+
+	for (int run = 0; run < cfg->num_runs; ++run) {
+		hrt_abstime start = hrt_absolute_time();
+		hrt_abstime last_fsync = start;
+		hrt_abstime next_write = start;
+		unsigned int num_blocks = 0;
+		int writes_since_fsync = 0;
+
+		while ((int64_t)hrt_elapsed_time(&start) < cfg->run_duration * 1000) {
+
+			if (block_interval > 0) {
+				const hrt_abstime now = hrt_absolute_time();
+
+				if (now < next_write) {
+					px4_usleep(next_write - now);
+				}
+
+				next_write += block_interval;
+			}
+
+			*blocknumber = total_blocks + num_blocks;
+
+			perf_begin(write_perf);
+			int written = write(fd, block, block_size);
+			perf_end(write_perf);
+
+			if (written != block_size) {
+				PX4_ERR("Write error: %d", errno);
+				run = cfg->num_runs;
+				break;
+			}
+
+			++num_blocks;
+
+			if (++writes_since_fsync >= LOGGER_FSYNC_WRITES || hrt_elapsed_time(&last_fsync) > LOGGER_FSYNC_INTERVAL) {
+				perf_begin(fsync_perf);
+				fsync(fd);
+				perf_end(fsync_perf);
+
+				last_fsync = hrt_absolute_time();
+				writes_since_fsync = 0;
+			}
+		}
+
+		double elapsed = hrt_elapsed_time(&start) / 1.e6;
+		PX4_INFO("  Run %2i: %8.2lf KB/s", run, (double)block_size * num_blocks / elapsed / 1024.);
+
+		total_elapsed += elapsed;
+		total_blocks += num_blocks;
+	}
+
+	if (thread_running) {
+		state.should_exit.store(true);
+		pthread_join(thread, nullptr);
+	}
+
+	cfg->total_blocks_written = total_blocks;
+
+	if (total_elapsed > 0.) {
+		PX4_INFO("  Avg   : %8.2lf KB/s", (double)block_size * total_blocks / total_elapsed / 1024.);
+	}
+
+	PX4_INFO("  Latency:");
+	print_latency(write_perf);
+	print_latency(fsync_perf);
+
+	if (cfg->metadata) {
+		print_latency(state.dataman_perf);
+		print_latency(state.param_perf);
+		perf_free(state.dataman_perf);
+		perf_free(state.param_perf);
+	}
+
+	perf_free(write_perf);
+	perf_free(fsync_perf);
+}
@@ -0,0 +1,434 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file startup.cpp
+ *
+ * Start boot commands concurrently, following the dependencies between them.
+ */
+
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/boot_trace.h>
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/getopt.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/module.h>
+
+#include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
+#include <uORB/Publication.hpp>
+#include <uORB/topics/boot_timeline.h>
+
+#include <pthread.h>
+#include <string.h>
+
+#if defined(__PX4_NUTTX)
+#include <builtin/builtin.h>
+#include <sys/wait.h>
+#else
+#include "../../../platforms/posix/src/px4/common/px4_daemon/pxh.h"
+#endif
+
+static constexpr int MAX_COMMANDS = 32;
+static constexpr int MAX_ARGS = 16;
+static constexpr int MAX_THREADS = 8;
+
+enum class CommandState : uint8_t {
+	Pending,
+	Running,
+	Done,
+	Failed,
+};
+
+struct StartupCommand {
+	char name[sizeof(boot_timeline_s::name)];
+	char line[128];
+	uint32_t dependencies; // bitmask of the commands that have to finish first
+	uint8_t num_dependencies;
+	CommandState state;
+	hrt_abstime start_time;
+	uint32_t duration;
+	int result;
+};
+
+static StartupCommand commands[MAX_COMMANDS] {};
+static int num_commands = 0;
+static int num_finished = 0; // commands of previous runs
+static pthread_mutex_t commands_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t commands_cond = PTHREAD_COND_INITIALIZER;
+static uORB::Publication<boot_timeline_s> boot_timeline_pub{ORB_ID(boot_timeline)};
+
+static void usage();
+
+extern "C" {
+	__EXPORT int startup_main(int argc, char *argv[]);
+}
+
+static int find_command(const char *name)
+{
+	for (int i = 0; i < num_commands; i++) {
+		if (strcmp(commands[i].name, name) == 0) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static int run_command(char *line)
+{
+#if defined(__PX4_NUTTX)
+	char *argv[MAX_ARGS + 1] {};
+	int argc = 0;
+	char *save_ptr = nullptr;
+
+	for (char *arg = strtok_r(line, " ", &save_ptr); arg && (argc < MAX_ARGS); arg = strtok_r(nullptr, " ", &save_ptr)) {
+		argv[argc++] = arg;
+	}
+
+	if (argc == 0) {
+		return PX4_ERROR;
+	}
+
+	int status = PX4_ERROR;
+	const int pid = exec_builtin(argv[0], argv, nullptr, 0);
+
+	if (pid != -1) {
+		waitpid(pid, &status, WUNTRACED);
+	}
+
+	return status;
+#else
+	return px4_daemon::Pxh::process_line(line, false);
+#endif
+}
+
+// take the next command whose dependencies are done, nullptr if there is nothing left to start
+static StartupCommand *next_command()
+{
+	pthread_mutex_lock(&commands_mutex);
+
+	while (true) {
+		bool pending = false;
+
+		for (int i = num_finished; i < num_commands; i++) {
+			StartupCommand &command = commands[i];
+
+			if (command.state != CommandState::Pending) {
+				continue;
+			}
+
+			pending = true;
+			bool ready = true;
+
+			for (int dep = 0; dep < num_commands; dep++) {
+				if ((command.dependencies & (1u << dep))
+				    && (commands[dep].state != CommandState::Done) && (commands[dep].state != CommandState::Failed)) {
+					ready = false;
+				}
+			}
+
+			if (ready) {
+				for (int dep = 0; dep < num_commands; dep++) {
+					if ((command.dependencies & (1u << dep)) && (commands[dep].state == CommandState::Failed)) {
+						PX4_WARN("%s: dependency %s failed", command.name, commands[dep].name);
+					}
+				}
+
+				command.state = CommandState::Running;
+				pthread_mutex_unlock(&commands_mutex);
+				return &command;
+			}
+		}
+
+		if (!pending) {
+			pthread_mutex_unlock(&commands_mutex);
+			return nullptr;
+		}
+
+		// wait for a running command to finish
+		pthread_cond_wait(&commands_cond, &commands_mutex);
+	}
+}
+
+static void *worker(void *)
+{
+	while (StartupCommand *command = next_command()) {
+		char line[sizeof(command->line)];
+		strncpy(line, command->line, sizeof(line));
+
+		const hrt_abstime start_time = hrt_absolute_time();
+		const int result = run_command(line);
+		const hrt_abstime now = hrt_absolute_time();
+
+		pthread_mutex_lock(&commands_mutex);
+		command->start_time = start_time;
+		command->duration = now - start_time;
+		command->result = result;
+		command->state = (result == PX4_OK) ? CommandState::Done : CommandState::Failed;
+
+		boot_timeline_s boot_timeline{};
+		boot_timeline.start_time = command->start_time;
+		boot_timeline.duration = command->duration;
+		boot_timeline.result = command->result;
+		boot_timeline.index = command - commands;
+		boot_timeline.num_dependencies = command->num_dependencies;
+		strncpy(boot_timeline.name, command->name, sizeof(boot_timeline.name) - 1);
+		boot_timeline.timestamp = now;
+		boot_timeline_pub.publish(boot_timeline);
+
+		pthread_cond_broadcast(&commands_cond);
+		pthread_mutex_unlock(&commands_mutex);
+	}
+
+	return nullptr;
+}
+
+static int add_command(int argc, char *argv[])
+{
+	uint32_t dependencies = 0;
+	uint8_t num_dependencies = 0;
+	int myoptind = 1;
+	int ch;
+	const char *myoptarg = nullptr;
+
+	while ((ch = px4_getopt(argc, argv, "d:", &myoptind, &myoptarg)) != EOF) {
+		switch (ch) {
+		case 'd': {
+				// dependencies have to be added first, which keeps the graph acyclic
+				const int dep = find_command(myoptarg);
+
+				if (dep < 0) {
+					PX4_ERR("unknown dependency %s", myoptarg);
+					return PX4_ERROR;
+				}
+
+				dependencies |= 1u << dep;
+				num_dependencies++;
+			}
+			break;
+
+		default:
+			usage();
+			return PX4_ERROR;
+		}
+	}
+
+	if (argc - myoptind < 2) {
+		usage();
+		return PX4_ERROR;
+	}
+
+	if (num_commands >= MAX_COMMANDS) {
+		PX4_ERR("too many commands");
+		return PX4_ERROR;
+	}
+
+	const char *name = argv[myoptind++];
+
+	if (find_command(name) >= 0) {
+		PX4_ERR("%s already added", name);
+		return PX4_ERROR;
+	}
+
+	StartupCommand &command = commands[num_commands];
+	command = {};
+	strncpy(command.name, name, sizeof(command.name) - 1);
+
+	for (int i = myoptind; i < argc; i++) {
+		const size_t length = strlen(command.line);
+
+		if (length + strlen(argv[i]) + 2 > sizeof(command.line)) {
+			PX4_ERR("command too long");
+			return PX4_ERROR;
+		}
+
+		if (length > 0) {
+			strcat(command.line, " ");
+		}
+
+		strcat(command.line, argv[i]);
+	}
+
+	command.dependencies = dependencies;
+	command.num_dependencies = num_dependencies;
+	command.state = CommandState::Pending;
+	num_commands++;
+	return PX4_OK;
+}
+
+static int run_commands(int argc, char *argv[])
+{
+	int num_threads = 4;
+	int myoptind = 1;
+	int ch;
+	const char *myoptarg = nullptr;
+
+	while ((ch = px4_getopt(argc, argv, "j:", &myoptind, &myoptarg)) != EOF) {
+		switch (ch) {
+		case 'j':
+			num_threads = math::constrain(atoi(myoptarg), 1, MAX_THREADS);
+			break;
+
+		default:
+			usage();
+			return PX4_ERROR;
+		}
+	}
+
+	const hrt_abstime start_time = hrt_absolute_time();
+	pthread_t threads[MAX_THREADS] {};
+	int num_started = 0;
+
+	for (int i = 0; i < num_threads; i++) {
+		if (pthread_create(&threads[num_started], nullptr, worker, nullptr) == 0) {
+			num_started++;
+		}
+	}
+
+	if (num_started == 0) {
+		// run the commands sequentially
+		worker(nullptr);
+	}
+
+	for (int i = 0; i < num_started; i++) {
+		pthread_join(threads[i], nullptr);
+	}
+
+	int failed = 0;
+
+	for (int i = num_finished; i < num_commands; i++) {
+		if (commands[i].state == CommandState::Failed) {
+			PX4_ERR("%s failed (%d)", commands[i].name, commands[i].result);
+			failed++;
+		}
+	}
+
+	PX4_INFO("started %d commands in %.1f ms (%d failed)", num_commands - num_finished,
+		 (double)(hrt_absolute_time() - start_time) * 1e-3, failed);
+
+	num_finished = num_commands;
+	return (failed == 0) ? PX4_OK : PX4_ERROR;
+}
+
+static void print_status()
+{
+	PX4_INFO_RAW("  # name                     start [ms]  duration [ms]  result  dependencies\n");
+
+	for (int i = 0; i < num_commands; i++) {
+		const StartupCommand &command = commands[i];
+
+		PX4_INFO_RAW("%3d %-24s %10.1f %14.1f %7d ", i, command.name, (double)command.start_time * 1e-3,
+			     (double)command.duration * 1e-3, command.result);
+
+		for (int dep = 0; dep < num_commands; dep++) {
+			if (command.dependencies & (1u << dep)) {
+				PX4_INFO_RAW(" %s", commands[dep].name);
+			}
+		}
+
+		PX4_INFO_RAW("%s\n", (command.state == CommandState::Pending) ? " (pending)" : "");
+	}
+}
+
+int startup_main(int argc, char *argv[])
+{
+	if (argc < 2) {
+		usage();
+		return PX4_ERROR;
+	}
+
+	if (!strcmp(argv[1], "add")) {
+		return add_command(argc - 1, argv + 1);
+
+	} else if (!strcmp(argv[1], "run")) {
+		return run_commands(argc - 1, argv + 1);
+
+	} else if (!strcmp(argv[1], "status")) {
+		print_status();
+		return PX4_OK;
+
+	} else if (!strcmp(argv[1], "trace")) {
+		if (argc == 2) {
+			px4_boot_trace_print();
+			return PX4_OK;
+
+		} else if (argc == 4 && !strcmp(argv[2], "begin")) {
+			return (px4_boot_trace_begin(argv[3]) >= 0) ? PX4_OK : PX4_ERROR;
+
+		} else if (argc == 4 && !strcmp(argv[2], "end")) {
+			return px4_boot_trace_end_name(argv[3]);
+		}
+	}
+
+	usage();
+	return PX4_ERROR;
+}
+
+static void usage()
+{
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Start boot commands concurrently, following declared dependencies.
+
+Commands are queued with `add` and started with `run`, which returns once all of them returned.
+A command is only started after the commands it depends on returned, dependencies have to be added first.
+Independent modules then block in their initialization at the same time instead of one after the other.
+
+The start time and duration of every command is published as boot_timeline (and logged),
+`status` prints the timeline.
+
+`trace` prints the boot trace: platform init, parameter load, module starts and driver probing,
+plus sections of the startup scripts marked with `trace begin` and `trace end`.
+The boot trace is also written to the log (info message boot_trace).
+
+### Examples
+$ startup add dataman dataman start
+$ startup add sensors sensors start
+$ startup add commander -d sensors -d dataman commander start
+$ startup run
+$ startup trace begin sensors_group
+$ startup trace end sensors_group
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("startup", "system");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("add", "Queue a command");
+	PRINT_MODULE_USAGE_PARAM_STRING('d', nullptr, "<name>", "Command that has to return first (repeatable)", true);
+	PRINT_MODULE_USAGE_ARG("<name> <command>", "Name and command line", false);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("run", "Run the queued commands and wait until they returned");
+	PRINT_MODULE_USAGE_PARAM_INT('j', 4, 1, MAX_THREADS, "Number of concurrent commands", true);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("status", "Print the boot timeline");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("trace", "Print the boot trace");
+	PRINT_MODULE_USAGE_ARG("begin|end <name>", "Mark the begin or end of a startup script section", true);
+}
@@ -0,0 +1,186 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <unit_test.h>
+#include <containers/AtomicIntrusiveQueue.hpp>
+
+class testAtomicContainer : public AtomicIntrusiveQueueNode<testAtomicContainer *>
+{
+public:
+	int i{0};
+};
+
+class AtomicIntrusiveQueueTest : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+	bool test_push_pop();
+	bool test_push_duplicate();
+	bool test_remove();
+	bool test_interleaved();
+
+};
+
+bool AtomicIntrusiveQueueTest::run_tests()
+{
+	ut_run_test(test_push_pop);
+	ut_run_test(test_push_duplicate);
+	ut_run_test(test_remove);
+	ut_run_test(test_interleaved);
+
+	return (_tests_failed == 0);
+}
+
+bool AtomicIntrusiveQueueTest::test_push_pop()
+{
+	AtomicIntrusiveQueue<testAtomicContainer *> q1;
+	testAtomicContainer nodes[100];
+
+	ut_assert_true(q1.empty());
+	ut_assert_true(q1.pop() == nullptr);
+
+	for (int i = 0; i < 100; i++) {
+		nodes[i].i = i;
+		ut_assert_true(q1.push(&nodes[i]));
+		ut_assert_false(q1.empty());
+	}
+
+	// pop in FIFO order
+	for (int i = 0; i < 100; i++) {
+		testAtomicContainer *node = q1.pop();
+		ut_assert_true(node != nullptr);
+		ut_compare("FIFO order", node->i, i);
+	}
+
+	ut_assert_true(q1.empty());
+	ut_assert_true(q1.pop() == nullptr);
+
+	return true;
+}
+
+bool AtomicIntrusiveQueueTest::test_push_duplicate()
+{
+	AtomicIntrusiveQueue<testAtomicContainer *> q1;
+	testAtomicContainer nodes[10];
+
+	for (int i = 0; i < 10; i++) {
+		nodes[i].i = i;
+		q1.push(&nodes[i]);
+	}
+
+	// already queued nodes are not inserted again
+	ut_assert_false(q1.push(&nodes[0]));
+	ut_assert_false(q1.push(&nodes[9]));
+
+	// a popped node can be pushed again
+	testAtomicContainer *head = q1.pop();
+	ut_compare("head", head->i, 0);
+	ut_assert_true(q1.push(head));
+
+	for (int i = 1; i < 10; i++) {
+		ut_compare("FIFO order", q1.pop()->i, i);
+	}
+
+	ut_compare("reinserted last", q1.pop()->i, 0);
+	ut_assert_true(q1.empty());
+
+	return true;
+}
+
+bool AtomicIntrusiveQueueTest::test_remove()
+{
+	AtomicIntrusiveQueue<testAtomicContainer *> q1;
+	testAtomicContainer nodes[10];
+
+	for (int i = 0; i < 10; i++) {
+		nodes[i].i = i;
+		q1.push(&nodes[i]);
+	}
+
+	// remove head, middle and tail
+	ut_assert_true(q1.remove(&nodes[0]));
+	ut_assert_true(q1.remove(&nodes[5]));
+	ut_assert_true(q1.remove(&nodes[9]));
+	ut_assert_false(q1.remove(&nodes[5]));
+
+	// removed nodes can be pushed again
+	ut_assert_true(q1.push(&nodes[5]));
+
+	const int expected[] = {1, 2, 3, 4, 6, 7, 8, 5};
+
+	for (int i : expected) {
+		ut_compare("order after remove", q1.pop()->i, i);
+	}
+
+	ut_assert_true(q1.empty());
+
+	return true;
+}
+
+bool AtomicIntrusiveQueueTest::test_interleaved()
+{
+	AtomicIntrusiveQueue<testAtomicContainer *> q1;
+	testAtomicContainer nodes[6];
+
+	for (int i = 0; i < 6; i++) {
+		nodes[i].i = i;
+	}
+
+	// pushes after a pop are appended behind already collected nodes
+	q1.push(&nodes[0]);
+	q1.push(&nodes[1]);
+	q1.push(&nodes[2]);
+	ut_compare("first", q1.pop()->i, 0);
+
+	q1.push(&nodes[3]);
+	q1.push(&nodes[4]);
+	ut_compare("second", q1.pop()->i, 1);
+	ut_compare("third", q1.pop()->i, 2);
+
+	q1.push(&nodes[5]);
+
+	ut_compare("fourth", q1.pop()->i, 3);
+	ut_compare("fifth", q1.pop()->i, 4);
+	ut_compare("sixth", q1.pop()->i, 5);
+
+	q1.push(&nodes[0]);
+	q1.push(&nodes[1]);
+	q1.clear();
+	ut_assert_true(q1.empty());
+
+	return true;
+}
+
+ut_declare_test_c(test_AtomicIntrusiveQueue, AtomicIntrusiveQueueTest)
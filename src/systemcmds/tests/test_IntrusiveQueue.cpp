@@ -40,6 +40,7 @@ class testContainer : public IntrusiveQueueNode<testContainer *>
 {
 public:
 	int i{0};
+	int key{0};
 };
 
 class IntrusiveQueueTest : public UnitTest
@@ -52,6 +53,7 @@ public:
 	bool test_push_duplicate();
 	bool test_remove();
 	bool test_reinsert();
+	bool test_pop_min();
 
 };
 
@@ -62,6 +64,7 @@ bool IntrusiveQueueTest::run_tests()
 	ut_run_test(test_push_duplicate);
 	ut_run_test(test_remove);
 	ut_run_test(test_reinsert);
+	ut_run_test(test_pop_min);
 
 	return (_tests_failed == 0);
 }
@@ -383,4 +386,45 @@ bool IntrusiveQueueTest::test_reinsert()
 	return true;
 }
 
+bool IntrusiveQueueTest::test_pop_min()
+{
+	IntrusiveQueue<testContainer *> q1;
+
+	auto less = [](testContainer * a, testContainer * b) { return a->key < b->key; };
+
+	// pop an empty queue
+	ut_assert_true(q1.pop_min(less) == nullptr);
+
+	static constexpr int keys[] = {5, 3, 7, 3, 1, 9};
+	static constexpr int expected_i[] = {4, 1, 3, 0, 2, 5}; // ascending key, FIFO among equal keys
+
+	for (int i = 0; i < 6; i++) {
+		testContainer *t = new testContainer();
+		t->i = i;
+		t->key = keys[i];
+		q1.push(t);
+	}
+
+	for (int n = 0; n < 6; n++) {
+		testContainer *t = q1.pop_min(less);
+		ut_assert_true(t != nullptr);
+		ut_compare("pop order", t->i, expected_i[n]);
+		ut_compare("size check", q1.size(), 6 - n - 1);
+
+		// popped node can be pushed again
+		if (n == 0) {
+			q1.push(t);
+			ut_compare("size check", q1.size(), 6);
+			ut_assert_true(q1.pop_min(less) == t);
+		}
+
+		delete t;
+	}
+
+	ut_assert_true(q1.empty());
+	ut_assert_true(q1.pop_min(less) == nullptr);
+
+	return true;
+}
+
 ut_declare_test_c(test_IntrusiveQueue, IntrusiveQueueTest)
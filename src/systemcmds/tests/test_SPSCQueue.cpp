@@ -0,0 +1,130 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <unit_test.h>
+#include <containers/SPSCQueue.hpp>
+
+class SPSCQueueTest : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+	bool test_push_pop();
+	bool test_full();
+	bool test_wrap_around();
+
+};
+
+bool SPSCQueueTest::run_tests()
+{
+	ut_run_test(test_push_pop);
+	ut_run_test(test_full);
+	ut_run_test(test_wrap_around);
+
+	return (_tests_failed == 0);
+}
+
+bool SPSCQueueTest::test_push_pop()
+{
+	SPSCQueue<int, 4> queue;
+	int item = -1;
+
+	// nothing pushed yet
+	ut_assert_true(queue.empty());
+	ut_assert_false(queue.pop(item));
+
+	ut_assert_true(queue.push(1));
+	ut_assert_true(queue.push(2));
+	ut_compare("size", (int)queue.size(), 2);
+
+	// first in, first out
+	ut_assert_true(queue.pop(item));
+	ut_compare("first item", item, 1);
+	ut_assert_true(queue.pop(item));
+	ut_compare("second item", item, 2);
+
+	ut_assert_true(queue.empty());
+	ut_assert_false(queue.pop(item));
+
+	return true;
+}
+
+bool SPSCQueueTest::test_full()
+{
+	SPSCQueue<int, 4> queue;
+
+	for (int i = 0; i < 4; i++) {
+		ut_assert_true(queue.push(i));
+	}
+
+	// a full queue rejects the item and keeps its content
+	ut_assert_false(queue.push(4));
+	ut_compare("size", (int)queue.size(), 4);
+
+	for (int i = 0; i < 4; i++) {
+		int item = -1;
+		ut_assert_true(queue.pop(item));
+		ut_compare("item", item, i);
+	}
+
+	return true;
+}
+
+bool SPSCQueueTest::test_wrap_around()
+{
+	SPSCQueue<int, 4> queue;
+
+	// keep the queue partially filled while the indices wrap around the ring many times
+	int next_push = 0;
+	int next_pop = 0;
+
+	for (int i = 0; i < 100; i++) {
+		ut_assert_true(queue.push(next_push++));
+		ut_assert_true(queue.push(next_push++));
+
+		int item = -1;
+		ut_assert_true(queue.pop(item));
+		ut_compare("item", item, next_pop++);
+
+		if (queue.size() >= 3) {
+			ut_assert_true(queue.pop(item));
+			ut_compare("item", item, next_pop++);
+			ut_assert_true(queue.pop(item));
+			ut_compare("item", item, next_pop++);
+		}
+	}
+
+	return true;
+}
+
+ut_declare_test_c(test_SPSCQueue, SPSCQueueTest)
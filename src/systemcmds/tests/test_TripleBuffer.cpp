@@ -0,0 +1,122 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <unit_test.h>
+#include <containers/TripleBuffer.hpp>
+
+class TripleBufferTest : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+	bool test_publish_update();
+	bool test_latest_only();
+	bool test_no_aliasing();
+
+};
+
+bool TripleBufferTest::run_tests()
+{
+	ut_run_test(test_publish_update);
+	ut_run_test(test_latest_only);
+	ut_run_test(test_no_aliasing);
+
+	return (_tests_failed == 0);
+}
+
+bool TripleBufferTest::test_publish_update()
+{
+	TripleBuffer<int> buffer;
+
+	// nothing published yet
+	ut_assert_false(buffer.update());
+
+	buffer.back() = 1;
+	buffer.publish();
+
+	ut_assert_true(buffer.update());
+	ut_compare("first publication", buffer.front(), 1);
+
+	// no new publication, front stays valid
+	ut_assert_false(buffer.update());
+	ut_compare("front unchanged", buffer.front(), 1);
+
+	buffer.back() = 2;
+	buffer.publish();
+
+	ut_assert_true(buffer.update());
+	ut_compare("second publication", buffer.front(), 2);
+
+	return true;
+}
+
+bool TripleBufferTest::test_latest_only()
+{
+	TripleBuffer<int> buffer;
+
+	// publications the consumer didn't take are dropped
+	for (int i = 0; i < 10; i++) {
+		buffer.back() = i;
+		buffer.publish();
+	}
+
+	ut_assert_true(buffer.update());
+	ut_compare("latest publication", buffer.front(), 9);
+	ut_assert_false(buffer.update());
+
+	return true;
+}
+
+bool TripleBufferTest::test_no_aliasing()
+{
+	TripleBuffer<int> buffer;
+
+	// the producer never writes into the buffer the consumer is reading
+	for (int i = 0; i < 20; i++) {
+		buffer.back() = i;
+		ut_assert_true(&buffer.back() != &buffer.front());
+		buffer.publish();
+		ut_assert_true(&buffer.back() != &buffer.front());
+
+		if (i % 3 == 0) {
+			ut_assert_true(buffer.update());
+			ut_compare("taken publication", buffer.front(), i);
+			ut_assert_true(&buffer.back() != &buffer.front());
+		}
+	}
+
+	return true;
+}
+
+ut_declare_test_c(test_TripleBuffer, TripleBufferTest)
@@ -981,11 +981,10 @@ DatamanTest::testCache()
 		return false;
 	}
 
-	uint32_t old_cache_size = _dataman_cache.size();
 	_dataman_cache.resize(5);
 
-	// check cached data after resize (reduced, the first item got overwritten by extra_index)
-	for (uint32_t index = 1; index < _dataman_cache.size(); ++index) {
+	// check cached data after resize (reduced, the first pages are kept)
+	for (uint32_t index = 0; index < _dataman_cache.size(); ++index) {
 		uint8_t value = index + uniq_number;
 		success = _dataman_cache.loadWait(item, index, _buffer_read, sizeof(_buffer_read));
 
@@ -1002,12 +1001,30 @@ DatamanTest::testCache()
 		}
 	}
 
-	for (uint32_t index = _dataman_cache.size(); index < old_cache_size; ++index) {
+	// walk through the items, the pages ahead are loaded while accessing the current one
+	_dataman_cache.invalidate();
+	_dataman_cache.resize(4);
+	_dataman_cache.load(item, 0);
+
+	for (uint32_t index = 0; index < 15; ++index) {
+		start_time = hrt_absolute_time();
+
+		while (_dataman_cache.isLoading()) {
+
+			px4_usleep(1_ms);
+			_dataman_cache.update();
+
+			if (hrt_elapsed_time(&start_time) > 2_s) {
+				PX4_ERR("Test timeout!");
+				return false;
+			}
+		}
+
 		uint8_t value = index + uniq_number;
 		success = _dataman_cache.loadWait(item, index, _buffer_read, sizeof(_buffer_read));
 
-		if (success) {
-			PX4_ERR("loadWait unexpectedly succeeded at index %" PRIu32, index);
+		if (!success || (_buffer_read[0] != value)) {
+			PX4_ERR("Failed loadWait ahead at index %" PRIu32, index);
 			return false;
 		}
 	}
@@ -69,5 +69,34 @@ test_perf(int argc, char *argv[])
 	perf_free(cc);
 	perf_free(ec);
 
+	perf_counter_t hc = perf_alloc(PC_HISTOGRAM, "test_histogram");
+
+	if (hc == NULL) {
+		printf("perf: histogram alloc failed\n");
+		return 1;
+	}
+
+	// 1000 events: 990 x 100us, 9 x 1000us, 1 x 10000us
+	for (int i = 0; i < 1000; i++) {
+		perf_set_elapsed(hc, (i < 990) ? 100 : ((i < 999) ? 1000 : 10000));
+	}
+
+	printf("perf: expect count of 1000, p50 ~100us, p99.9 ~1000us\n");
+	perf_print_counter(hc);
+
+	const uint32_t p50 = perf_percentile(hc, 50.f);
+	const uint32_t p99_9 = perf_percentile(hc, 99.9f);
+	const uint32_t p100 = perf_percentile(hc, 100.f);
+
+	if ((perf_event_count(hc) != 1000) || (p50 < 100) || (p50 > 125) || (p99_9 < 1000) || (p99_9 > 1250)
+	    || (p100 != 10000)) {
+		printf("perf: histogram percentiles wrong (p50 %u, p99.9 %u, p100 %u)\n",
+		       (unsigned)p50, (unsigned)p99_9, (unsigned)p100);
+		perf_free(hc);
+		return 1;
+	}
+
+	perf_free(hc);
+
 	return OK;
 }
@@ -77,6 +77,7 @@ const struct {
 	{"uart_console",	test_uart_console,	OPT_NOJIGTEST | OPT_NOALLTEST},
 #endif /* __PX4_NUTTX */
 
+	{"AtomicIntrusiveQueue",	test_AtomicIntrusiveQueue,	0},
 	{"atomic_bitset",	test_atomic_bitset,	0},
 	{"bezier",		test_bezierQuad,	0},
 	{"bitset",		test_bitset,		0},
@@ -100,6 +101,8 @@ const struct {
 	{"rc",			test_rc,		OPT_NOJIGTEST | OPT_NOALLTEST},
 	{"search_min",		test_search_min,	0},
 	{"sleep",		test_sleep,		OPT_NOJIGTEST},
+	{"SPSCQueue",		test_SPSCQueue,		0},
+	{"TripleBuffer",	test_TripleBuffer,	0},
 	{"uart_loopback",	test_uart_loopback,	OPT_NOJIGTEST | OPT_NOALLTEST},
 	{"uart_send",		test_uart_send,		OPT_NOJIGTEST | OPT_NOALLTEST},
 	{"versioning",		test_versioning,	0},
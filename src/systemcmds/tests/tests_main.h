@@ -43,6 +43,7 @@
 
 __BEGIN_DECLS
 
+extern int test_AtomicIntrusiveQueue(int argc, char *argv[]);
 extern int test_atomic_bitset(int argc, char *argv[]);
 extern int test_bezierQuad(int argc, char *argv[]);
 extern int test_bitset(int argc, char *argv[]);
@@ -69,7 +70,9 @@ extern int test_ppm(int argc, char *argv[]);
 extern int test_rc(int argc, char *argv[]);
 extern int test_search_min(int argc, char *argv[]);
 extern int test_sleep(int argc, char *argv[]);
+extern int test_SPSCQueue(int argc, char *argv[]);
 extern int test_time(int argc, char *argv[]);
+extern int test_TripleBuffer(int argc, char *argv[]);
 extern int test_uart_baudchange(int argc, char *argv[]);
 extern int test_uart_break(int argc, char *argv[]);
 extern int test_uart_console(int argc, char *argv[]);
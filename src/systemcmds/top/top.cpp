@@ -52,9 +52,37 @@
 #include <drivers/drv_hrt.h>
 #include <px4_platform_common/module.h>
 
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+#include <px4_platform_common/px4_work_queue/WorkQueueManager.hpp>
+
+static void print_work_item(px4::WorkQueue *wq, px4::WorkItem *item, void *user)
+{
+	px4::DurationHistogram run_time;
+	px4::DurationHistogram delay;
+	item->get_run_stats(run_time, delay, false);
+
+	dprintf(1, "%-24.24s %-16.16s %8" PRIu32 " %8.1f %8" PRIu32 " %8" PRIu32 " %8.1f %8" PRIu32 " %8" PRIu32 "\n",
+		item->ItemName(), wq->get_name(), run_time.count(),
+		(double)run_time.mean(), run_time.percentile(99.f), run_time.max(),
+		(double)delay.mean(), delay.percentile(99.f), delay.max());
+}
+
+/**
+ * Print the run time and queueing delay of all work items, accumulated since load_mon last sampled them.
+ */
+static void print_work_items()
+{
+	dprintf(1, "\n%-24s %-16s %8s %8s %8s %8s %8s %8s %8s\n", "WORK ITEM", "WORK QUEUE", "RUNS",
+		"RUN AVG", "RUN P99", "RUN MAX", "DLY AVG", "DLY P99", "DLY MAX");
+	px4::WorkQueueManagerForEachItem(print_work_item, nullptr);
+}
+#endif // CONFIG_PX4_WORK_ITEM_STATS
+
 static void print_usage()
 {
-	PRINT_MODULE_DESCRIPTION("Monitor running processes and their CPU, stack usage, priority and state");
+	PRINT_MODULE_DESCRIPTION("Monitor running processes and their CPU, stack usage, priority and state.\n"
+				 "With CONFIG_PX4_WORK_ITEM_STATS the run time and queueing delay [us] of the work items are shown as well.");
 
 	PRINT_MODULE_USAGE_NAME_SIMPLE("top", "command");
 	PRINT_MODULE_USAGE_COMMAND_DESCR("once", "print load only once");
@@ -73,6 +101,9 @@ extern "C" __EXPORT int top_main(int argc, char *argv[])
 		if (!strcmp(argv[1], "once")) {
 			px4_sleep(1);
 			print_load(STDOUT_FILENO, &load);
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+			print_work_items();
+#endif
 
 		} else {
 			print_usage();
@@ -84,6 +115,9 @@ extern "C" __EXPORT int top_main(int argc, char *argv[])
 
 	for (;;) {
 		print_load(STDOUT_FILENO, &load);
+#if defined(CONFIG_PX4_WORK_ITEM_STATS)
+		print_work_items();
+#endif
 
 		/* Sleep 200 ms waiting for user input five times ~ 1s */
 		for (int k = 0; k < 5; k++) {
@@ -44,6 +44,7 @@
 
 #include <uORB/topics/uORBTopics.hpp>
 #include "topic_listener.hpp"
+#include "ulog_capture.hpp"
 
 // Amount of time to wait when listening for a message, before giving up.
 static constexpr float MESSAGE_TIMEOUT_S = 2.0f;
@@ -52,6 +53,90 @@ extern "C" __EXPORT int listener_main(int argc, char *argv[]);
 
 static void usage();
 
+/**
+ * Capture a topic instance in binary ULog format instead of printing it.
+ * Runs until num_msgs are received (unlimited if 0), the topic times out, or the user quits.
+ */
+static int listener_capture(const orb_id_t &id, unsigned num_msgs, int topic_instance,
+			    unsigned topic_interval, const char *path)
+{
+	if (topic_instance == -1) {
+		topic_instance = 0;
+	}
+
+	if (orb_exists(id, topic_instance) != 0) {
+		PX4_INFO_RAW("never published\n");
+		return -1;
+	}
+
+	ULogCapture capture;
+
+	if (capture.open(path, id, topic_instance) != 0) {
+		return -1;
+	}
+
+	int sub = orb_subscribe_multi(id, topic_instance);
+	orb_set_interval(sub, topic_interval);
+
+	PX4_INFO_RAW("capturing %s instance %d to %s, press q to stop\n", id->o_name, topic_instance, path);
+
+	const hrt_abstime start = hrt_absolute_time();
+	unsigned msgs_received = 0;
+	bool error = false;
+
+	struct pollfd fds[2] {};
+	fds[0].fd = 0; /* stdin */
+	fds[0].events = POLLIN;
+	fds[1].fd = sub;
+	fds[1].events = POLLIN;
+
+	while (!error && (num_msgs == 0 || msgs_received < num_msgs)) {
+
+		if (poll(&fds[0], 2, int(MESSAGE_TIMEOUT_S * 1000)) <= 0) {
+			PX4_INFO_RAW("Waited for %.1f seconds without a message. Stopping.\n", (double) MESSAGE_TIMEOUT_S);
+			break;
+		}
+
+		if (fds[0].revents & POLLIN) {
+			char c = 0;
+			int ret = read(0, &c, 1);
+
+			if (ret) {
+				break;
+			}
+
+			if (c == 0x03 || c == 0x1b || c == 'q') {
+				break;
+			}
+		}
+
+		// drain everything queued since the last poll, the samples only go through the capture buffer
+		bool updated = (fds[1].revents & POLLIN);
+
+		while (updated && (num_msgs == 0 || msgs_received < num_msgs)) {
+			if (capture.copySample(sub) != 0) {
+				error = true;
+				break;
+			}
+
+			msgs_received++;
+
+			if (orb_check(sub, &updated) != PX4_OK) {
+				break;
+			}
+		}
+	}
+
+	orb_unsubscribe(sub);
+	capture.close();
+
+	const float elapsed_s = hrt_elapsed_time(&start) * 1e-6f;
+	PX4_INFO_RAW("captured %u messages (%zu bytes) in %.1f s (%.1f Hz)\n", msgs_received, capture.bytesWritten(),
+		     (double)elapsed_s, (double)(elapsed_s > 0.f ? msgs_received / elapsed_s : 0.f));
+
+	return error ? -1 : 0;
+}
+
 void listener(const orb_id_t &id, unsigned num_msgs, int topic_instance,
 	      unsigned topic_interval)
 {
@@ -172,12 +257,13 @@ int listener_main(int argc, char *argv[])
 	int topic_instance = -1;
 	unsigned topic_rate = 0;
 	unsigned num_msgs = 0;
+	const char *capture_path = nullptr;
 
 	int myoptind = 1;
 	int ch;
 	const char *myoptarg = nullptr;
 
-	while ((ch = px4_getopt(argc, argv, "i:r:n:", &myoptind, &myoptarg)) != EOF) {
+	while ((ch = px4_getopt(argc, argv, "i:r:n:f:", &myoptind, &myoptarg)) != EOF) {
 		switch (ch) {
 
 		case 'i':
@@ -192,6 +278,10 @@ int listener_main(int argc, char *argv[])
 			num_msgs = strtol(myoptarg, nullptr, 0);
 			break;
 
+		case 'f':
+			capture_path = myoptarg;
+			break;
+
 		default:
 			usage();
 			return -1;
@@ -199,7 +289,7 @@ int listener_main(int argc, char *argv[])
 		}
 	}
 
-	if (num_msgs == 0) {
+	if (num_msgs == 0 && capture_path == nullptr) {
 		if (topic_rate != 0) {
 			num_msgs = 30 * topic_rate; // arbitrary limit (30 seconds at max rate)
 
@@ -224,7 +314,10 @@ int listener_main(int argc, char *argv[])
 		}
 	}
 
-	if (found_topic) {
+	if (found_topic && capture_path) {
+		return listener_capture(found_topic, num_msgs, topic_instance, topic_interval, capture_path);
+
+	} else if (found_topic) {
 		listener(found_topic, num_msgs, topic_instance, topic_interval);
 
 	} else {
@@ -244,6 +337,15 @@ usage()
 Utility to listen on uORB topics and print the data to the console.
 
 The listener can be exited any time by pressing Ctrl+C, Esc, or Q.
+
+With -f the samples are not printed but written in binary ULog format to the given file,
+which allows capturing high-rate topics without starting the logger. The capture runs
+until -n messages are received, the topic stops publishing, or it is exited.
+A named pipe can be used to stream the data off the vehicle.
+
+### Examples
+Capture 10000 samples of the first sensor_gyro instance:
+$ listener sensor_gyro -n 10000 -f /tmp/sensor_gyro.ulg
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("listener", "command");
@@ -252,4 +354,5 @@ The listener can be exited any time by pressing Ctrl+C, Esc, or Q.
 	PRINT_MODULE_USAGE_PARAM_INT('i', 0, 0, ORB_MULTI_MAX_INSTANCES - 1, "Topic instance", true);
 	PRINT_MODULE_USAGE_PARAM_INT('n', 1, 0, 100, "Number of messages", true);
 	PRINT_MODULE_USAGE_PARAM_INT('r', 0, 0, 1000, "Subscription rate (unlimited if 0)", true);
+	PRINT_MODULE_USAGE_PARAM_STRING('f', nullptr, "<file>", "Capture to ULog file instead of printing", true);
 }
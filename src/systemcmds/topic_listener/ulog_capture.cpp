@@ -0,0 +1,323 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ulog_capture.cpp
+ */
+
+#include "ulog_capture.hpp"
+
+#include <containers/Bitset.hpp>
+#include <drivers/drv_hrt.h>
+#include <logger/messages.h>
+#include <mathlib/mathlib.h>
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/log.h>
+#include <uORB/topics/uORBTopics.hpp>
+#include <uORB/uORBMessageFields.hpp>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+// the only logged message, always written with this id
+static constexpr uint16_t CAPTURE_MSG_ID = 0;
+
+ULogCapture::~ULogCapture()
+{
+	close();
+}
+
+int ULogCapture::open(const char *path, const orb_metadata *meta, uint8_t instance)
+{
+	close();
+
+	_meta = meta;
+
+	// Room for at least one full data message
+	_buffer_size = math::max(BUFFER_SIZE, sizeof(ulog_message_data_s) + meta->o_size);
+	_buffer = new uint8_t[_buffer_size];
+
+	if (_buffer == nullptr) {
+		PX4_ERR("alloc failed");
+		return -1;
+	}
+
+	_fd = ::open(path, O_CREAT | O_WRONLY | O_TRUNC, PX4_O_MODE_666);
+
+	if (_fd < 0) {
+		PX4_ERR("failed to open %s (%i)", path, errno);
+		close();
+		return -1;
+	}
+
+	if (writeHeader() != 0 || writeFormats() != 0 || writeAddLoggedMsg(instance) != 0 || flush() != 0) {
+		close();
+		return -1;
+	}
+
+	return 0;
+}
+
+int ULogCapture::copySample(int subscription)
+{
+	if (_buffer_used + sizeof(ulog_message_data_s) + _meta->o_size > _buffer_size) {
+		if (flush() != 0) {
+			return -1;
+		}
+	}
+
+	// orb_copy() writes the full (padded) struct, only the unpadded part is kept
+	uint8_t *msg = _buffer + _buffer_used;
+
+	if (orb_copy(_meta, subscription, msg + sizeof(ulog_message_data_s)) != PX4_OK) {
+		return -1;
+	}
+
+	ulog_message_data_s header{};
+	header.msg_size = sizeof(ulog_message_data_s) - ULOG_MSG_HEADER_LEN + _meta->o_size_no_padding;
+	header.msg_id = CAPTURE_MSG_ID;
+	memcpy(msg, &header, sizeof(header));
+
+	_buffer_used += sizeof(ulog_message_data_s) + _meta->o_size_no_padding;
+	return 0;
+}
+
+void ULogCapture::close()
+{
+	if (_fd >= 0) {
+		flush();
+		::close(_fd);
+		_fd = -1;
+	}
+
+	delete[] _buffer;
+	_buffer = nullptr;
+	_buffer_size = 0;
+	_buffer_used = 0;
+}
+
+int ULogCapture::writeHeader()
+{
+	ulog_file_header_s header = {};
+	header.magic[0] = 'U';
+	header.magic[1] = 'L';
+	header.magic[2] = 'o';
+	header.magic[3] = 'g';
+	header.magic[4] = 0x01;
+	header.magic[5] = 0x12;
+	header.magic[6] = 0x35;
+	header.magic[7] = 0x01; //file version 1
+	header.timestamp = hrt_absolute_time();
+
+	if (write(&header, sizeof(header)) != 0) {
+		return -1;
+	}
+
+	// the Flags message MUST be written right after the ulog header
+	ulog_message_flag_bits_s flag_bits{};
+	flag_bits.msg_size = sizeof(flag_bits) - ULOG_MSG_HEADER_LEN;
+	flag_bits.msg_type = static_cast<uint8_t>(ULogMessageType::FLAG_BITS);
+
+	return write(&flag_bits, sizeof(flag_bits));
+}
+
+int ULogCapture::writeFormats()
+{
+	// This is large and thus we need to be careful in terms of stack size requirements
+	ulog_message_format_s *msg = new ulog_message_format_s;
+
+	if (msg == nullptr) {
+		PX4_ERR("alloc failed");
+		return -1;
+	}
+
+	// Same as the logger: the topic format plus all nested definitions it depends on
+	px4::Bitset<ORB_TOPICS_COUNT> formats_to_write;
+	formats_to_write.set(_meta->o_id);
+
+	static_assert(sizeof(msg->format) > uORB::orb_tokenized_fields_max_length, "uORB message definition too long");
+	uORB::MessageFormatReader format_reader(msg->format, sizeof(msg->format));
+	bool done = false;
+	int ret = 0;
+
+	while (!done && ret == 0) {
+		switch (format_reader.readMore()) {
+		case uORB::MessageFormatReader::State::FormatComplete: {
+				unsigned format_length = format_reader.formatLength();
+				const unsigned leftover_length = format_reader.moveLeftoverToBufferEnd();
+
+				bool needs_expansion = true;
+				int last_name_length = 0;
+
+				for (const orb_id_size_t orb_id : format_reader.orbIDs()) {
+					if (orb_id >= formats_to_write.size() || !formats_to_write[orb_id]) {
+						continue;
+					}
+
+					for (const orb_id_size_t orb_id_dep : format_reader.orbIDsDependencies()) {
+						formats_to_write.set(orb_id_dep);
+					}
+
+					formats_to_write.set(orb_id, false);
+					const orb_metadata &meta = *get_orb_meta((ORB_ID) orb_id);
+
+					if (needs_expansion) {
+						const int length = uORB::MessageFormatReader::expandMessageFormat(msg->format, format_length,
+								   sizeof(msg->format) - leftover_length);
+
+						if (length < 0) {
+							PX4_ERR("Format %s error (too long?)", meta.o_name);
+							ret = -1;
+							break;
+						}
+
+						format_length = length;
+						needs_expansion = false;
+					}
+
+					// Prepend format name and ':'
+					const int name_length = strlen(meta.o_name) + 1;
+
+					if (format_length + name_length - last_name_length + 1 > sizeof(msg->format) - leftover_length) {
+						PX4_ERR("Format %s too long", meta.o_name);
+						ret = -1;
+						break;
+					}
+
+					if (last_name_length != name_length) {
+						memmove(msg->format + name_length, msg->format + last_name_length,
+							format_length + 1 - last_name_length);
+						msg->format[name_length - 1] = ':';
+						format_length += name_length - last_name_length;
+						last_name_length = name_length;
+					}
+
+					memcpy(msg->format, meta.o_name, name_length - 1);
+
+					const size_t msg_size = sizeof(*msg) - sizeof(msg->format) + format_length;
+					msg->msg_size = msg_size - ULOG_MSG_HEADER_LEN;
+
+					if (write(msg, msg_size) != 0) {
+						ret = -1;
+						break;
+					}
+				}
+
+				format_reader.clearFormatAndRestoreLeftover();
+			}
+			break;
+
+		case uORB::MessageFormatReader::State::Failure:
+			PX4_ERR("Failed to read formats");
+			ret = -1;
+			break;
+
+		case uORB::MessageFormatReader::State::Complete:
+			done = true;
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	delete msg;
+
+	if (ret == 0 && formats_to_write.count() > 0) {
+		PX4_ERR("Not all formats written");
+		ret = -1;
+	}
+
+	return ret;
+}
+
+int ULogCapture::writeAddLoggedMsg(uint8_t instance)
+{
+	ulog_message_add_logged_s msg;
+	msg.msg_id = CAPTURE_MSG_ID;
+	msg.multi_id = instance;
+
+	const int message_name_len = strlen(_meta->o_name);
+	memcpy(msg.message_name, _meta->o_name, message_name_len);
+
+	const size_t msg_size = sizeof(msg) - sizeof(msg.message_name) + message_name_len;
+	msg.msg_size = msg_size - ULOG_MSG_HEADER_LEN;
+
+	return write(&msg, msg_size);
+}
+
+int ULogCapture::write(const void *data, size_t size)
+{
+	const uint8_t *src = static_cast<const uint8_t *>(data);
+
+	while (size > 0) {
+		if (_buffer_used == _buffer_size && flush() != 0) {
+			return -1;
+		}
+
+		const size_t chunk = math::min(size, _buffer_size - _buffer_used);
+		memcpy(_buffer + _buffer_used, src, chunk);
+		_buffer_used += chunk;
+		src += chunk;
+		size -= chunk;
+	}
+
+	return 0;
+}
+
+int ULogCapture::flush()
+{
+	size_t offset = 0;
+
+	while (offset < _buffer_used) {
+		const ssize_t ret = ::write(_fd, _buffer + offset, _buffer_used - offset);
+
+		if (ret < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			PX4_ERR("write failed (%i)", errno);
+			_buffer_used = 0;
+			return -1;
+		}
+
+		offset += ret;
+	}
+
+	_bytes_written += _buffer_used;
+	_buffer_used = 0;
+	return 0;
+}
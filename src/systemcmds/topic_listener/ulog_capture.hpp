@@ -0,0 +1,95 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ulog_capture.hpp
+ *
+ * Binary capture of a single uORB topic instance into a ULog file.
+ */
+
+#pragma once
+
+#include <uORB/uORB.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Writes a minimal, self-contained ULog stream (header, flag bits, the topic
+ * format with its nested dependencies, one subscription and the data
+ * messages) so that captures can be opened with the regular ULog tooling.
+ * The output is buffered and written in blocks, so that high-rate topics can
+ * be captured without formatting each sample as text.
+ */
+class ULogCapture
+{
+public:
+	ULogCapture() = default;
+	~ULogCapture();
+
+	/**
+	 * Open the output (regular file or named pipe) and write the definitions.
+	 * @return 0 on success, <0 otherwise
+	 */
+	int open(const char *path, const orb_metadata *meta, uint8_t instance);
+
+	/**
+	 * Copy the current sample of a subscription directly into the output buffer.
+	 * @return 0 on success, <0 otherwise
+	 */
+	int copySample(int subscription);
+
+	/**
+	 * Flush the buffer and close the output.
+	 */
+	void close();
+
+	size_t bytesWritten() const { return _bytes_written; }
+
+private:
+	int writeHeader();
+	int writeFormats();
+	int writeAddLoggedMsg(uint8_t instance);
+
+	int write(const void *data, size_t size);
+	int flush();
+
+	static constexpr size_t BUFFER_SIZE = 4096;
+
+	const orb_metadata *_meta{nullptr};
+	int _fd{-1};
+
+	uint8_t *_buffer{nullptr};
+	size_t _buffer_size{0};
+	size_t _buffer_used{0};
+	size_t _bytes_written{0};
+};